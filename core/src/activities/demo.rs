@@ -299,18 +299,20 @@ impl DemoActivity {
         Mounting pressure led Attorney General Elliot Richardson to appoint Archibald Cox as Watergate special prosecutor. Cox subpoenaed Nixon's Oval Office tapes—suspected to include Watergate conversations—but Nixon invoked executive privilege to block their release, triggering a constitutional crisis. In the \"Saturday Night Massacre\", Nixon fired Cox, forcing the resignations of the attorney general and his deputy and fueling suspicions of Nixon's involvement. Nixon released select tapes, although one was partially erased and two others disappeared. In April 1974, Cox's replacement Leon Jaworski reissued the subpoena, but Nixon provided only redacted transcripts. In July, the Supreme Court ordered the tapes' release, and the House Judiciary Committee recommended impeachment for obstructing justice, abuse of power, and contempt of Congress. The White House released the \"Smoking Gun\" tape, showing that Nixon ordered the CIA to stop the FBI's investigation. Facing impeachment, on August 9, 1974, Nixon became the first U.S. president to resign. In total, 69 people were charged for Watergate—including two cabinet members—and most pleaded guilty or were convicted. Nixon was pardoned by his successor, Gerald Ford.\n\
         Watergate, often considered the greatest presidential scandal, tarnished Nixon's legacy and had electoral ramifications for the Republican Party: heavy losses in the 1974 midterm elections and Ford's failed 1976 reelection bid. Despite significant coverage, no consensus exists on the motive for the break-in or who specifically ordered it. Theories range from an incompetent break-in by rogue campaign officials to a sexpionage operation or CIA plot. The scandal generated over 30 memoirs and left such an impression that it is common for scandals, even outside politics or the United States, to be named with the suffix \"-gate\".";
 
-        let run = layout::Run {
-            text: text.to_string(),
+        let mut run = layout::Run {
+            content: layout::Content::Text(text.to_string()),
             style,
             breaking: false,
+            hyphens: Default::default(),
             // alignment: None,
         };
+        let mut palette = font::Palette::default();
+        run.prepare(font, options.language, &mut palette);
         let runs = [run];
-        let lines = crate::layout::layout_text(options, alignment, indent, &runs);
+        let lines = crate::layout::layout_text(options, alignment, indent, &runs, &palette);
 
-        let font = font.definition(style);
         buffers.clear(BinaryColor::On).ok();
-        Self::draw_layed_out_text(font, &lines, x_start, font::Mode::Bw, buffers);
+        Self::draw_layed_out_text(font, style, &palette, &lines, x_start, font::Mode::Bw, buffers);
         display.display(
             buffers,
             if self.full_refresh {
@@ -321,25 +323,28 @@ impl DemoActivity {
         );
 
         buffers.clear(BinaryColor::Off).ok();
-        Self::draw_layed_out_text(font, &lines, x_start, font::Mode::Msb, buffers);
+        Self::draw_layed_out_text(font, style, &palette, &lines, x_start, font::Mode::Msb, buffers);
         display.copy_to_msb(buffers.get_active_buffer());
 
         buffers.clear(BinaryColor::Off).ok();
-        Self::draw_layed_out_text(font, &lines, x_start, font::Mode::Lsb, buffers);
+        Self::draw_layed_out_text(font, style, &palette, &lines, x_start, font::Mode::Lsb, buffers);
         display.copy_to_lsb(buffers.get_active_buffer());
         display.display_differential_grayscale(false);
     }
 
     fn draw_layed_out_text(
-        font: &font::FontDefinition,
+        font: font::Font,
+        style: font::FontStyle,
+        palette: &font::Palette,
         lines: &[layout::Line],
         x_start: u16,
         mode: font::Mode,
         display_buffers: &mut DisplayBuffers,
     ) {
         let size = display_buffers.size();
+        let definition = font.definition(style);
 
-        let mut y = font.y_advance as u16;
+        let mut y = definition.y_advance as u16;
 
         for line in lines.iter() {
             if y as u32 >= size.height {
@@ -347,35 +352,27 @@ impl DemoActivity {
             }
             let mut x_advance = 0u16;
             for word in line.words.iter() {
-                x_advance = x_start + word.x;
-                for codepoint in word.text.chars() {
-                    if let Ok(glyph_width) = font::draw_glyph(
-                        font,
-                        codepoint as _,
-                        display_buffers,
-                        x_advance as isize,
-                        y as isize,
-                        mode,
-                    ) {
-                        Line::new(
-                            Point {
-                                x: x_advance as _,
-                                y: (y + 3) as _,
-                            },
-                            Point {
-                                x: (x_advance + glyph_width as u16) as _,
-                                y: (y + 3) as _,
-                            },
-                        )
-                        .into_styled(PrimitiveStyle::with_stroke(BinaryColor::Off, 1))
-                        .draw(display_buffers);
-                        x_advance += glyph_width as u16;
-                    }
+                for glyph in font.place(word.style, word.glyphs, palette) {
+                    x_advance = (x_start + word.x).saturating_add_signed(glyph.x);
+                    let glyph_width = font::draw_shaped(&glyph, display_buffers, x_advance as isize, y as isize, mode);
+                    Line::new(
+                        Point {
+                            x: x_advance as _,
+                            y: (y + 3) as _,
+                        },
+                        Point {
+                            x: (x_advance + glyph_width as u16) as _,
+                            y: (y + 3) as _,
+                        },
+                    )
+                    .into_styled(PrimitiveStyle::with_stroke(BinaryColor::Off, 1))
+                    .draw(display_buffers);
+                    x_advance += glyph_width as u16;
                 }
             }
             if line.hyphenated {
                 font::draw_glyph(
-                    font,
+                    definition,
                     '-' as _,
                     display_buffers,
                     x_advance as isize,
@@ -384,7 +381,7 @@ impl DemoActivity {
                 )
                 .unwrap();
             }
-            y += font.y_advance as u16;
+            y += definition.y_advance as u16;
         }
     }
 }
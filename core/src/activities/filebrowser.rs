@@ -109,6 +109,10 @@ impl<FileEntry: crate::fs::DirEntry> super::Activity for FileBrowser<FileEntry>
         }
     }
 
+    fn resumable(&self) -> bool {
+        true
+    }
+
     fn draw(&mut self, display: &mut dyn Display, buffers: &mut DisplayBuffers) {
         buffers.clear_screen(0xFF);
 
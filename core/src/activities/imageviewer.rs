@@ -29,7 +29,7 @@ impl<Filesystem: fs::Filesystem> ImageViewerActivity<Filesystem> {
         file.seek(embedded_io::SeekFrom::Start(0)).ok();
         let sz = rotation.size();
         let file_size = file.size() as _;
-        self.image = match image::decode(self.format, file, file_size, sz.width as _, sz.height as _) {
+        self.image = match image::decode(self.format, file, file_size, sz.width as _, sz.height as _, &mut []) {
             Ok(img) => Some(Ok(img)),
             Err(e) => {
                 log::error!("Failed to decode image: {}", e);
@@ -1,3 +1,6 @@
+use alloc::vec::Vec;
+use strum::IntoEnumIterator;
+
 use crate::{
     battery::ChargeState,
     display::Display,
@@ -38,6 +41,46 @@ impl ActivityType {
     pub fn reader(path: &str) -> Self {
         ActivityType::Reader { path: path.try_into().unwrap() }
     }
+
+    /// Whether both open the same directory or book, whatever the focus.
+    pub fn same_target(&self, other: &ActivityType) -> bool {
+        match (self, other) {
+            (ActivityType::FileBrowser { path, .. }, ActivityType::FileBrowser { path: other, .. }) => path == other,
+            (ActivityType::Reader { path }, ActivityType::Reader { path: other }) => path == other,
+            _ => false,
+        }
+    }
+
+    /// Append a tag, the focus and the length-prefixed path to `out`.
+    pub(crate) fn encode(&self, out: &mut Vec<u8>) {
+        let (tag, focus, path) = match self {
+            ActivityType::Home { state } => (0, *state as u8, ""),
+            ActivityType::FileBrowser { focus, path } => (1, *focus, path.as_str()),
+            ActivityType::Settings => (2, 0, ""),
+            ActivityType::Demo => (3, 0, ""),
+            ActivityType::Reader { path } => (4, 0, path.as_str()),
+        };
+        out.extend_from_slice(&[tag, focus]);
+        out.extend_from_slice(&(path.len() as u16).to_le_bytes());
+        out.extend_from_slice(path.as_bytes());
+    }
+
+    /// Read what [`ActivityType::encode`] wrote from the front of `bytes`.
+    pub(crate) fn decode(bytes: &mut &[u8]) -> Option<Self> {
+        let (&[tag, focus, len @ ..], rest) = bytes.split_first_chunk::<4>()?;
+        let len = u16::from_le_bytes(len) as usize;
+        let path = core::str::from_utf8(rest.get(..len)?).ok()?;
+        let path: Path = path.try_into().ok()?;
+        *bytes = &rest[len..];
+        Some(match tag {
+            0 => ActivityType::Home { state: home::Focus::iter().nth(focus as usize)? },
+            1 => ActivityType::FileBrowser { focus, path },
+            2 => ActivityType::Settings,
+            3 => ActivityType::Demo,
+            4 => ActivityType::Reader { path },
+            _ => return None,
+        })
+    }
 }
 
 pub enum UpdateResult {
@@ -52,6 +95,16 @@ pub enum UpdateResult {
     Ota,
 }
 
+/// Where an activity's background work stands, see [`Activity::work`].
+pub enum Work {
+    /// Nothing to do.
+    Idle,
+    /// More steps to go.
+    Pending,
+    /// Just finished, and the result should be drawn.
+    Done,
+}
+
 pub struct ApplicationState {
     pub input: ButtonState,
     pub charge: ChargeState,
@@ -63,4 +116,18 @@ pub trait Activity {
     fn close(&mut self) {}
     fn update(&mut self, state: &ApplicationState) -> UpdateResult;
     fn draw(&mut self, display: &mut dyn Display, buffers: &mut DisplayBuffers);
+    /// Run one short step of long work like opening a book. The main loop
+    /// calls this between input polls, so `update` can preempt or cancel
+    /// the work, and keeps calling it while it is [`Work::Pending`].
+    fn work(&mut self) -> Work {
+        Work::Idle
+    }
+    /// Drop caches and other memory that can be rebuilt. The main loop
+    /// calls this when the heap runs low.
+    fn reclaim(&mut self) {}
+    /// Whether the activity can be kept after [`Activity::close`] and
+    /// started again later instead of being rebuilt.
+    fn resumable(&self) -> bool {
+        false
+    }
 }
@@ -1,11 +1,12 @@
-use alloc::vec::Vec;
+use alloc::{string::{String, ToString}, vec::Vec};
+use core::task::Poll;
 use embedded_graphics::{
     Drawable, mono_font::{MonoTextStyle, ascii::FONT_10X20}, pixelcolor::BinaryColor, prelude::{DrawTarget, OriginDimensions, Point, Primitive, Size}, primitives::{Line, PrimitiveStyle, Rectangle}, text::Text
 };
 use log::{info, warn};
 
 use crate::{
-    container::{book, image}, display::RefreshMode, framebuffer::DisplayBuffers, input::Buttons, layout, res::font
+    container::{book, image}, display::RefreshMode, framebuffer::DisplayBuffers, input::Buttons, layout, res::font, trace
 };
 
 pub struct ReaderActivity<Filesystem>
@@ -14,6 +15,7 @@ where
 {
     show_settings: bool,
     settings_cursor: usize,
+    font_family: font::FontFamily,
     font_size: font::FontSize,
     alignment: layout::Alignment,
     indent: u16,
@@ -24,6 +26,84 @@ where
     chapter_idx: usize,
     chapter: Option<book::Chapter>,
     progress: Page,
+    /// Loading in progress. The current chapter stays on screen until it
+    /// is done.
+    task: Option<Task<Filesystem>>,
+    /// The chapter before the current one, kept for turning back.
+    previous: Option<Neighbor>,
+    /// The chapter after the current one, kept for turning forward.
+    next: Option<Neighbor>,
+    /// Loading of a neighbor in the background.
+    prefetch: Option<Task<Filesystem>>,
+    /// The last two chapters prefetched or found too large to, so they
+    /// aren't tried again.
+    prefetch_tried: [Option<usize>; 2],
+}
+
+/// Paragraphs prepared per [`super::Activity::work`] step.
+const PREPARE_STEP: usize = 16;
+
+/// Start prefetching a neighbor when the current page is this many
+/// paragraphs from that end of the chapter.
+const PREFETCH_DISTANCE: usize = 20;
+
+/// Memory the previous and next chapter may hold together.
+const PREFETCH_BUDGET: usize = 64 * 1024;
+
+/// Opening the book or switching chapters, one step per
+/// [`super::Activity::work`] call.
+enum Task<Filesystem: crate::fs::Filesystem> {
+    /// Parse the book's container.
+    Open { filesystem: Filesystem, path: String },
+    /// Load the stylesheet and the saved position.
+    Stylesheet,
+    /// Parse chapter `index`. `open` is where to show it, or `None` to keep
+    /// it as a neighbor.
+    Chapter { index: usize, open: Option<Open> },
+    /// Hyphenate the parsed chapter and resolve its fallback glyphs.
+    Prepare {
+        index: usize,
+        chapter: book::Chapter,
+        preparation: book::Preparation,
+        open: Option<Open>,
+    },
+}
+
+impl<Filesystem: crate::fs::Filesystem> Task<Filesystem> {
+    /// The chapter being loaded.
+    fn index(&self) -> Option<usize> {
+        match self {
+            Task::Chapter { index, .. } | Task::Prepare { index, .. } => Some(*index),
+            _ => None,
+        }
+    }
+
+    /// Show the chapter at `open` once it is loaded.
+    fn reopen(self, open: Open) -> Self {
+        match self {
+            Task::Chapter { index, .. } => Task::Chapter { index, open: Some(open) },
+            Task::Prepare { index, chapter, preparation, .. } => {
+                Task::Prepare { index, chapter, preparation, open: Some(open) }
+            }
+            task => task,
+        }
+    }
+}
+
+/// Where to open a loaded chapter.
+#[derive(Clone, Copy)]
+enum Open {
+    At(Progress),
+    /// Its last page on a screen of this size.
+    LastPage(Size),
+}
+
+/// A loaded chapter next to the current one.
+struct Neighbor {
+    index: usize,
+    chapter: book::Chapter,
+    /// Where its last page starts, if known.
+    last_page: Option<Progress>,
 }
 
 struct Page {
@@ -49,34 +129,46 @@ struct Progress {
 impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
     pub fn new(filesystem: Filesystem, file_path: &str) -> Self {
         info!("Opening EPUB reader for path: {}", file_path);
-        let mut file = filesystem
+        let file = filesystem
             .open_file(file_path, crate::fs::Mode::Read)
             .unwrap();
 
-        let book = book::Book::from_file(file_path, filesystem, &mut file);
-
-        let language = book.as_ref().and_then(|book| book.language()).unwrap_or(hypher::Lang::English);
-
         ReaderActivity {
             show_settings: false,
             settings_cursor: 0,
+            font_family: font::FontFamily::Bookerly,
             font_size: font::FontSize::Size26,
             alignment: layout::Alignment::Justify,
             indent: 10,
-            language,
+            language: hypher::Lang::English,
             debug_width: false,
             file,
-            book,
+            book: None,
             chapter_idx: 0,
             chapter: None,
             progress: Page::default(),
+            task: Some(Task::Open { filesystem, path: file_path.to_string() }),
+            previous: None,
+            next: None,
+            prefetch: None,
+            prefetch_tried: [None; 2],
+        }
+    }
+
+    /// Where the current page starts.
+    pub fn position(&self) -> book::Progress {
+        book::Progress {
+            chapter: self.chapter_idx as u16,
+            paragraph: self.progress.start.paragraph,
+            line: self.progress.start.line,
         }
     }
 
     fn draw_layed_out_text(
         &self,
-        font: font::Font,
+        fonts: &[font::Font],
         lines: &[layout::Line],
+        palette: &font::Palette,
         y_offsets: &[u16],
         x_start: u16,
         y_base: u16,
@@ -85,32 +177,24 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
     ) {
         let size = display_buffers.size();
 
-        for (line, y_offset) in lines.iter().zip(y_offsets) {
+        for ((line, y_offset), font) in lines.iter().zip(y_offsets).zip(fonts) {
             let y = y_base + y_offset;
             if y as u32 >= size.height {
                 return;
             }
             let mut x_advance = 0u16;
             for word in line.words.iter() {
-                let font = font.definition(word.style);
                 x_advance = x_start + word.x;
-                for codepoint in word.text.chars() {
-                    if let Ok(glyph_width) = font::draw_glyph(
-                        font,
-                        codepoint as _,
-                        display_buffers,
-                        x_advance as isize,
-                        y as isize,
-                        mode,
-                    ) {
-                        self.print_debug_line(x_advance, y, glyph_width as u16, display_buffers);
-                        x_advance += glyph_width as u16;
-                    }
+                for glyph in font.place(word.style, word.glyphs, palette) {
+                    let x = (x_start + word.x).saturating_add_signed(glyph.x);
+                    let glyph_width = font::draw_shaped(&glyph, display_buffers, x as isize, y as isize, mode);
+                    self.print_debug_line(x, y, glyph_width as u16, display_buffers);
+                    x_advance = x + glyph_width as u16;
                 }
             }
             if line.hyphenated {
                 let font = font.definition(font::FontStyle::Regular);
-                if let Ok(glyph_width) = font::draw_glyph(
+                if let Some(glyph_width) = font::draw_glyph(
                     font,
                     '-' as _,
                     display_buffers,
@@ -143,7 +227,7 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         .draw(display_buffers);
     }
 
-    fn next_page(&mut self, _: Size) {
+    fn next_page(&mut self) {
         let Some(chapter) = &self.chapter else {
             self.next_chapter();
             return;
@@ -165,22 +249,52 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         if self.chapter_idx + 1 >= book.chapter_count() {
             return;
         }
-        self.chapter_idx += 1;
-        self.chapter = book.chapter(self.chapter_idx, &mut self.file);
-        self.progress.start = Progress { paragraph: 0, line: 0 };
+        let index = self.chapter_idx + 1;
+        let open = Open::At(Progress { paragraph: 0, line: 0 });
+        if let Some(next) = self.next.take_if(|next| next.index == index) {
+            self.show(index, next.chapter, open);
+            return;
+        }
+        self.load(index, open);
     }
 
-    fn prev_page(&mut self, Size { width, height }: Size) {
+    /// Load chapter `index` and show it at `open`, finishing what the
+    /// prefetch started if it was loading it.
+    fn load(&mut self, index: usize, open: Open) {
+        self.task = match self.prefetch.take() {
+            Some(task) if task.index() == Some(index) => Some(task.reopen(open)),
+            _ => Some(Task::Chapter { index, open: Some(open) }),
+        };
+    }
+
+    /// Drop the neighbors and prepare the current chapter again, after a
+    /// setting that preparing depends on changed.
+    fn reprepare(&mut self) {
+        self.previous = None;
+        self.next = None;
+        self.prefetch = None;
+        self.prefetch_tried = [None; 2];
+        if self.chapter.is_some() {
+            self.load(self.chapter_idx, Open::At(self.progress.start));
+        }
+    }
+
+    /// Layout options and page height for a screen of `size`.
+    fn page_options(&self, Size { width, height }: Size) -> (layout::Options, u16) {
         let padding = 10u32;
-        let font = font::Font::new(font::FontFamily::Bookerly, self.font_size);
+        let font = font::Font::new(self.font_family, self.font_size);
         let options = layout::Options::new(
             (width - 2 * padding) as _,
             self.language,
             font,
         );
-        let page_height = (height - padding - 10) as u16;
+        (options, (height - padding - 10) as u16)
+    }
+
+    fn prev_page(&mut self, size: Size) {
+        let (options, page_height) = self.page_options(size);
         let Some(chapter) = &self.chapter else {
-            self.prev_chapter(options, page_height);
+            self.prev_chapter(size);
             return;
         };
         if let Some(progress) = self.compute_prev_page(
@@ -191,46 +305,179 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         ) {
             self.progress.start = progress;
         } else {
-            self.prev_chapter(options, page_height);
+            self.prev_chapter(size);
         };
     }
 
-    fn prev_chapter(&mut self, options: layout::Options, page_height: u16) {
-        let Some(book) = &self.book else { return; };
-        if self.chapter_idx == 0 {
+    fn prev_chapter(&mut self, size: Size) {
+        if self.book.is_none() || self.chapter_idx == 0 {
             return;
         }
-        self.chapter_idx -= 1;
-        let Some(chapter) = book.chapter(self.chapter_idx, &mut self.file) else { return; };
-        if chapter.paragraphs.is_empty() {
-            self.chapter = Some(chapter);
-            self.progress.start = Progress { paragraph: 0, line: 0 };
+        let index = self.chapter_idx - 1;
+        if let Some(previous) = self.previous.take_if(|previous| previous.index == index) {
+            let open = previous.last_page.map_or(Open::LastPage(size), Open::At);
+            self.show(index, previous.chapter, open);
             return;
         }
-        let last_para = chapter.paragraphs.len() - 1;
+        self.load(index, Open::LastPage(size));
+    }
+
+    /// Make chapter `index` the current one. The chapter it replaces is
+    /// kept if it is a neighbor of the new one.
+    fn show(&mut self, index: usize, chapter: book::Chapter, open: Open) {
+        if let Some(old) = self.chapter.take() {
+            let neighbor = Neighbor {
+                index: self.chapter_idx,
+                chapter: old,
+                last_page: None,
+            };
+            if neighbor.index + 1 == index {
+                // Turned past its end, so the page shown was its last
+                let last_page = Some(self.progress.start);
+                self.previous = Some(Neighbor { last_page, ..neighbor });
+            } else if index + 1 == neighbor.index {
+                self.next = Some(neighbor);
+            }
+        }
+        self.previous.take_if(|previous| previous.index + 1 != index);
+        self.next.take_if(|next| next.index != index + 1);
+        self.prefetch = None;
+
+        let start = match open {
+            Open::At(start) => start,
+            Open::LastPage(size) => self.last_page(&chapter, size),
+        };
+        // The end is only known once the page is drawn
+        self.progress = Page { start, end: start };
+        self.chapter_idx = index;
+        self.chapter = Some(chapter);
+        self.trim();
+    }
+
+    /// Keep a prefetched chapter if it is still a neighbor.
+    fn keep(&mut self, neighbor: Neighbor) {
+        if neighbor.index == self.chapter_idx + 1 {
+            self.next = Some(neighbor);
+        } else if neighbor.index + 1 == self.chapter_idx {
+            self.previous = Some(neighbor);
+        }
+        self.trim();
+    }
+
+    /// Drop neighbors until they fit in [`PREFETCH_BUDGET`], the one on
+    /// the far side of the current page first.
+    fn trim(&mut self) {
+        let size = |neighbor: &Option<Neighbor>| neighbor.as_ref().map_or(0, |n| n.chapter.heap_size());
+        let paragraphs = self.chapter.as_ref().map_or(0, |chapter| chapter.paragraphs.len());
+        let near_start = (self.progress.start.paragraph as usize) < paragraphs / 2;
+        while size(&self.previous) + size(&self.next) > PREFETCH_BUDGET {
+            if self.previous.is_none() || near_start && self.next.is_some() {
+                self.next = None;
+            } else {
+                self.previous = None;
+            }
+        }
+    }
+
+    /// Start loading a neighbor once the current page is within
+    /// [`PREFETCH_DISTANCE`] paragraphs of that end of the chapter.
+    fn start_prefetch(&mut self) -> Option<Task<Filesystem>> {
+        let chapter = self.chapter.as_ref()?;
+        let book = self.book.as_ref()?;
+        let untried = |index: usize| !self.prefetch_tried.contains(&Some(index));
+        let near_end = self.progress.end.paragraph as usize + PREFETCH_DISTANCE >= chapter.paragraphs.len();
+        let near_start = (self.progress.start.paragraph as usize) < PREFETCH_DISTANCE;
+        let next = self.chapter_idx + 1;
+        let index = if near_end && next < book.chapter_count() && self.next.is_none() && untried(next) {
+            next
+        } else if near_start && self.chapter_idx > 0 && self.previous.is_none() && untried(self.chapter_idx - 1) {
+            self.chapter_idx - 1
+        } else {
+            return None;
+        };
+        self.prefetch_tried = [self.prefetch_tried[1], Some(index)];
+        if book.chapter_size(index).is_some_and(|size| size as usize > PREFETCH_BUDGET) {
+            info!("Chapter {index} is too large to prefetch");
+            return None;
+        }
+        Some(Task::Chapter { index, open: None })
+    }
+
+    /// Where the last page of `chapter` starts.
+    fn last_page(&self, chapter: &book::Chapter, size: Size) -> Progress {
+        let (options, page_height) = self.page_options(size);
+        let Some(last_para) = chapter.paragraphs.len().checked_sub(1) else {
+            return Progress { paragraph: 0, line: 0 };
+        };
         match &chapter.paragraphs[last_para] {
             book::Paragraph::Text(text) => {
-                let lines = self.layout_text(options, text);
+                let lines = self.layout_text(options, text, &chapter.palette);
                 // Try to show the last 10 lines
                 // NOTE: unless we lay out the entire chapter, there doesn't seem to be a sane way of getting
                 // the correct line number. Fill the entire page :(
-                self.progress.start = self.compute_prev_page(
-                    &chapter,
+                self.compute_prev_page(
+                    chapter,
                     Progress { paragraph: last_para as u16, line: lines.len() as u16 },
                     options,
                     page_height,
-                ).unwrap_or(Progress { paragraph: last_para as u16, line: 0 });
+                ).unwrap_or(Progress { paragraph: last_para as u16, line: 0 })
             }
             book::Paragraph::Image { .. } => {
                 // Can't do much with an image, just start at the beginning of the chapter
-                self.progress.start = Progress { paragraph: 0, line: 0 };
+                Progress { paragraph: 0, line: 0 }
             }
             book::Paragraph::Hr => {
                 // Just display the HR line
-                self.progress.start = Progress { paragraph: 0, line: 0 };
+                Progress { paragraph: 0, line: 0 }
+            }
+            book::Paragraph::PageBreak => {
+                // Breaks at the end of a chapter are dropped by the parser
+                Progress { paragraph: 0, line: 0 }
+            }
+        }
+    }
+
+    /// Run one step of `task`, returning what is left of it.
+    fn step(&mut self, task: Task<Filesystem>) -> Option<Task<Filesystem>> {
+        match task {
+            Task::Open { filesystem, path } => {
+                self.book = book::Book::open(&path, filesystem, &mut self.file);
+                let book = self.book.as_ref()?;
+                self.language = book.language().unwrap_or(hypher::Lang::English);
+                Some(Task::Stylesheet)
+            }
+            Task::Stylesheet => {
+                let book = self.book.as_mut()?;
+                book.load_stylesheet(&mut self.file);
+                let progress = book.load_progress();
+                let open = Open::At(Progress { paragraph: progress.paragraph, line: progress.line });
+                Some(Task::Chapter { index: progress.chapter as _, open: Some(open) })
+            }
+            Task::Chapter { index, open } => {
+                let _span = trace::span(trace::Span::LoadChapter);
+                let Some(chapter) = self.book.as_ref()?.chapter(index, &mut self.file) else {
+                    if open.is_some() {
+                        // Show the failure rather than the old chapter
+                        self.chapter_idx = index;
+                        self.chapter = None;
+                    }
+                    return None;
+                };
+                let preparation = book::Preparation::default();
+                Some(Task::Prepare { index, chapter, preparation, open })
+            }
+            Task::Prepare { index, mut chapter, mut preparation, open } => {
+                let font = font::Font::new(self.font_family, self.font_size);
+                let Poll::Ready(()) = preparation.step(&mut chapter, self.language, font, PREPARE_STEP) else {
+                    return Some(Task::Prepare { index, chapter, preparation, open });
+                };
+                match open {
+                    Some(open) => self.show(index, chapter, open),
+                    None => self.keep(Neighbor { index, chapter, last_page: None }),
+                }
+                None
             }
         }
-        self.chapter = Some(chapter);
     }
 
     /// Compute the previous page start by laying out paragraphs backwards
@@ -243,7 +490,6 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         page_height: u16,
     ) -> Option<Progress> {
         let y_advance = options.font.y_advance();
-        let para_spacing = y_advance / 2;
         let mut remaining = page_height;
 
         let cur_para = current.paragraph as usize;
@@ -263,6 +509,7 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         // We iterate from cur_para down to 0
         // Start from the paragraph just before current position
         let mut first_iter = true;
+        let mut has_content = false;
         let mut para_idx = core::cmp::min(
             if cur_line > 0 { cur_para } else { cur_para.saturating_sub(1) },
             chapter.paragraphs.len().saturating_sub(1),
@@ -272,6 +519,7 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         loop {
             // Add paragraph spacing (between paragraphs, not before the bottom-most)
             if !first_iter {
+                let para_spacing = self.spacing_before(&chapter.paragraphs[para_idx + 1], y_advance);
                 if remaining < para_spacing {
                     // Can't fit the spacing; previous result stands
                     break;
@@ -292,7 +540,8 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
                         continue;
                     }
 
-                    let para_lines = self.layout_text(options, text);
+                    let para_lines = self.layout_text(options, text, &chapter.palette);
+                    let line_advance = self.paragraph_options(options, text).font.y_advance();
                     // How many lines from this paragraph are available
                     let available = if para_idx == cur_para && at_line != usize::MAX {
                         at_line
@@ -303,16 +552,17 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
                     // Try to fit lines from the end backwards
                     let mut fitted = 0usize;
                     for _ in (0..available).rev() {
-                        if remaining < y_advance {
+                        if remaining < line_advance {
                             break;
                         }
-                        remaining -= y_advance;
+                        remaining -= line_advance;
                         fitted += 1;
                     }
 
                     if fitted > 0 {
                         result_para = para_idx;
                         result_line = available - fitted;
+                        has_content = true;
                     }
                 }
                 book::Paragraph::Image { width: raw_w, height: raw_h, .. } => {
@@ -323,11 +573,19 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
                     result_para = para_idx;
                     result_line = 0;
                     remaining -= img_h;
+                    has_content = true;
                 }
                 book::Paragraph::Hr => {
                     result_para = para_idx;
                     result_line = 0;
                 }
+                book::Paragraph::PageBreak => {
+                    // The page starts right after the break. A break directly
+                    // above the current page just ends the previous one.
+                    if has_content {
+                        break;
+                    }
+                }
             }
 
             if remaining < y_advance {
@@ -348,10 +606,38 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
         })
     }
 
-    fn layout_text<'a>(&self, options: layout::Options, text: &'a book::Text) -> Vec<layout::Line<'a>> {
+    fn layout_text<'a>(
+        &self,
+        options: layout::Options,
+        text: &'a book::Text,
+        palette: &font::Palette,
+    ) -> Vec<layout::Line<'a>> {
         let alignment = text.alignment.unwrap_or(self.alignment);
         let indent = text.indent.unwrap_or(self.indent);
-        layout::layout_text(options, alignment, indent, &text.runs)
+        layout::layout_text(self.paragraph_options(options, text), alignment, indent, &text.runs, palette)
+    }
+
+    /// Layout options for a paragraph with a relative font size.
+    fn paragraph_options(&self, options: layout::Options, text: &book::Text) -> layout::Options {
+        let Some(scale) = text.font_scale else {
+            return options;
+        };
+        let size = self.font_size.scaled(scale);
+        if size == options.font.size {
+            return options;
+        }
+        layout::Options::new(options.width, options.language, font::Font::new(options.font.family, size))
+    }
+
+    /// Vertical space above a paragraph that follows other content.
+    fn spacing_before(&self, paragraph: &book::Paragraph, y_advance: u16) -> u16 {
+        match paragraph {
+            book::Paragraph::Text(book::Text { margin_top: Some(margin), .. }) => {
+                (*margin as u32 * y_advance as u32 / 10).min(u16::MAX as u32) as u16
+            }
+            book::Paragraph::PageBreak => 0,
+            _ => y_advance / 2,
+        }
     }
 
     fn display_settings(&self, buffers: &mut DisplayBuffers) {
@@ -395,43 +681,51 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
             .draw(buffers)
             .ok();
 
+        // Font
+        Text::new("Font:", Point::new(desc_pos, size.height as i32 / 2 + 80), text_style)
+            .draw(buffers)
+            .ok();
+        Text::new(self.font_family.repr(), Point::new(value_pos, size.height as i32 / 2 + 80), text_style)
+            .draw(buffers)
+            .ok();
+
         // Alignment
-        Text::new("Alignment:", Point::new(desc_pos, size.height as i32 / 2 + 80), text_style)
+        Text::new("Alignment:", Point::new(desc_pos, size.height as i32 / 2 + 110), text_style)
             .draw(buffers)
             .ok();
-        Text::new(self.alignment.repr(), Point::new(value_pos, size.height as i32 / 2 + 80), text_style)
+        Text::new(self.alignment.repr(), Point::new(value_pos, size.height as i32 / 2 + 110), text_style)
             .draw(buffers)
             .ok();
         
         // Indent
-        Text::new("Indent:", Point::new(desc_pos, size.height as i32 / 2 + 110), text_style)
+        Text::new("Indent:", Point::new(desc_pos, size.height as i32 / 2 + 140), text_style)
             .draw(buffers)
             .ok();
-        Text::new(&alloc::format!("{}", self.indent), Point::new(value_pos, size.height as i32 / 2 + 110), text_style)
+        Text::new(&alloc::format!("{}", self.indent), Point::new(value_pos, size.height as i32 / 2 + 140), text_style)
             .draw(buffers)
             .ok();
 
         // Rotation
-        Text::new("Rotation:", Point::new(desc_pos, size.height as i32 / 2 + 140), text_style)
+        Text::new("Rotation:", Point::new(desc_pos, size.height as i32 / 2 + 170), text_style)
             .draw(buffers)
             .ok();
-        Text::new(buffers.rotation().repr(), Point::new(value_pos, size.height as i32 / 2 + 140), text_style)
+        Text::new(buffers.rotation().repr(), Point::new(value_pos, size.height as i32 / 2 + 170), text_style)
             .draw(buffers)
             .ok();
 
         // Language
-        Text::new("Language:", Point::new(desc_pos, size.height as i32 / 2 + 170), text_style)
+        Text::new("Language:", Point::new(desc_pos, size.height as i32 / 2 + 200), text_style)
             .draw(buffers)
             .ok();
-        Text::new(&alloc::format!("{:?}", self.language), Point::new(value_pos, size.height as i32 / 2 + 170), text_style)
+        Text::new(&alloc::format!("{:?}", self.language), Point::new(value_pos, size.height as i32 / 2 + 200), text_style)
             .draw(buffers)
             .ok();
 
         // Justification debug lines
-        Text::new("Debug Justify:", Point::new(desc_pos, size.height as i32 / 2 + 200), text_style)
+        Text::new("Debug Justify:", Point::new(desc_pos, size.height as i32 / 2 + 230), text_style)
             .draw(buffers)
             .ok();
-        Text::new(if self.debug_width { "On" } else { "Off" }, Point::new(value_pos, size.height as i32 / 2 + 200), text_style)
+        Text::new(if self.debug_width { "On" } else { "Off" }, Point::new(value_pos, size.height as i32 / 2 + 230), text_style)
             .draw(buffers)
             .ok();
     }
@@ -459,26 +753,37 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
             use font::FontSize::*;
             use crate::framebuffer::Rotation::*;
             use layout::Alignment::*;
+            // Layout changes move the previous chapter's last page
+            if let Some(previous) = &mut self.previous {
+                previous.last_page = None;
+            }
             match self.settings_cursor {
                 0 => self.font_size = match self.font_size {
                     Size26 => Size30,
                     Size28 => Size26,
                     Size30 => Size28,
                 },
-                1 => self.alignment = match self.alignment {
+                1 => {
+                    let families: Vec<_> = font::FontFamily::all().collect();
+                    let at = families.iter().position(|&family| family == self.font_family).unwrap_or(0);
+                    self.font_family = families[(at + 1) % families.len()];
+                    // Chapters resolved their glyphs in the old family
+                    self.reprepare();
+                }
+                2 => self.alignment = match self.alignment {
                     Start => Center,
                     Center => End,
                     End => Justify,
                     Justify => Start,
                 },
-                2 => self.indent = match self.indent {
+                3 => self.indent = match self.indent {
                     0 => 10,
                     10 => 20,
                     20 => 30,
                     30 => 40,
                     _ => 0,
                 },
-                3 => {
+                4 => {
                     let new_rotation = match state.rotation {
                         Rotate0 => Rotate90,
                         Rotate90 => Rotate180,
@@ -487,15 +792,19 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
                     };
                     return super::UpdateResult::SetRotation(new_rotation);
                 },
-                4 => self.language = match self.language {
-                    hypher::Lang::English => hypher::Lang::French,
-                    hypher::Lang::French => hypher::Lang::German,
-                    hypher::Lang::German => hypher::Lang::Spanish,
-                    hypher::Lang::Spanish => hypher::Lang::Italian,
-                    hypher::Lang::Italian => hypher::Lang::English,
-                    _ => self.language, // Don't cycle unsupported languages
-                },
-                5 => self.debug_width = !self.debug_width,
+                5 => {
+                    self.language = match self.language {
+                        hypher::Lang::English => hypher::Lang::French,
+                        hypher::Lang::French => hypher::Lang::German,
+                        hypher::Lang::German => hypher::Lang::Spanish,
+                        hypher::Lang::Spanish => hypher::Lang::Italian,
+                        hypher::Lang::Italian => hypher::Lang::English,
+                        _ => self.language, // Don't cycle unsupported languages
+                    };
+                    // Chapters were hyphenated for the old language
+                    self.reprepare();
+                }
+                6 => self.debug_width = !self.debug_width,
                 _ => return super::UpdateResult::None
             }
             super::UpdateResult::Redraw
@@ -503,7 +812,7 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
             self.settings_cursor = if self.settings_cursor > 0 { self.settings_cursor - 1 } else { 0 };
             super::UpdateResult::Redraw
         } else if buttons.is_pressed(Buttons::Down) {
-            self.settings_cursor = if self.settings_cursor < 5 { self.settings_cursor + 1 } else { 5 };
+            self.settings_cursor = if self.settings_cursor < 6 { self.settings_cursor + 1 } else { 6 };
             super::UpdateResult::Redraw
         } else {
             super::UpdateResult::None
@@ -513,40 +822,50 @@ impl<Filesystem: crate::fs::Filesystem> ReaderActivity<Filesystem> {
 
 impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Filesystem> {
     fn start(&mut self) {
-        let Some(book) = &self.book else {
-            return;
-        };
-        let progress = book.load_progress();
-        self.chapter_idx = progress.chapter as _;
-        self.chapter = self.book.as_ref().and_then(|b| b.chapter(self.chapter_idx, &mut self.file));
-        self.progress.start = Progress { paragraph: progress.paragraph, line: progress.line };
+        // Resuming after being parked, which dropped the neighbors
+        self.prefetch_tried = [None; 2];
     }
 
     fn close(&mut self) {
         let Some(book) = &self.book else {
             return;
         };
-        let progress = book::Progress {
-            chapter: self.chapter_idx as u16,
-            paragraph: self.progress.start.paragraph,
-            line: self.progress.start.line,
-        };
-        book.store_progress(progress);
+        // Until a chapter is shown there's no position to save, and a load
+        // cancelled before it would overwrite the stored one
+        if self.chapter.is_none() {
+            return;
+        }
+        book.store_progress(self.position());
     }
 
     fn update(&mut self, state: &super::ApplicationState) -> super::UpdateResult {
+        let buttons = &state.input;
+
+        if self.task.is_some() {
+            // Back cancels loading, everything else waits for it
+            if buttons.is_pressed(Buttons::Back) {
+                self.task = None;
+                return super::UpdateResult::PopActivity;
+            }
+            return super::UpdateResult::None;
+        }
+
         if self.show_settings {
             return self.update_settings(state);
         }
 
-        let buttons = &state.input;
+        // Turning into another chapter redraws once it has loaded
+        let redraw = |reader: &Self| match reader.task {
+            Some(_) => super::UpdateResult::None,
+            None => super::UpdateResult::Redraw,
+        };
 
         if buttons.is_pressed(Buttons::Up) || buttons.is_pressed(Buttons::Right){
             self.prev_page(state.rotation.size());
-            super::UpdateResult::Redraw
+            redraw(self)
         } else if buttons.is_pressed(Buttons::Down) || buttons.is_pressed(Buttons::Left) {
-            self.next_page(state.rotation.size());
-            super::UpdateResult::Redraw
+            self.next_page();
+            redraw(self)
         } else if buttons.is_pressed(Buttons::Confirm) {
             self.show_settings = !self.show_settings;
             super::UpdateResult::Redraw
@@ -557,7 +876,50 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
         }
     }
 
+    fn work(&mut self) -> super::Work {
+        if let Some(task) = self.task.take() {
+            self.task = self.step(task);
+            return match self.task {
+                Some(_) => super::Work::Pending,
+                None => super::Work::Done,
+            };
+        }
+        // Prefetching has nothing to draw
+        if self.prefetch.is_none() {
+            self.prefetch = self.start_prefetch();
+        }
+        let Some(task) = self.prefetch.take() else {
+            return super::Work::Idle;
+        };
+        self.prefetch = self.step(task);
+        match self.prefetch {
+            Some(_) => super::Work::Pending,
+            None => super::Work::Idle,
+        }
+    }
+
+    fn reclaim(&mut self) {
+        if self.previous.is_none() && self.next.is_none() && self.prefetch.is_none() {
+            return;
+        }
+        info!("Dropping neighbor chapters to free memory");
+        self.previous = None;
+        self.next = None;
+        self.prefetch = None;
+        // Don't prefetch again until another chapter is shown
+        self.prefetch_tried = [self.chapter_idx.checked_sub(1), Some(self.chapter_idx + 1)];
+    }
+
+    fn resumable(&self) -> bool {
+        // Loading was cancelled or failed before a chapter was shown otherwise
+        self.task.is_none() && self.chapter.is_some()
+    }
+
     fn draw(&mut self, display: &mut dyn crate::display::Display, buffers: &mut DisplayBuffers) {
+        if self.task.is_some() {
+            // Keep the old screen up until loading is done
+            return;
+        }
         if self.book.is_none() {
             warn!("No book loaded");
 
@@ -587,7 +949,7 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
         let padding = 10;
         let Size { width, height } = buffers.size();
 
-        let font = font::Font::new(font::FontFamily::Bookerly, self.font_size);
+        let font = font::Font::new(self.font_family, self.font_size);
         let options = layout::Options::new(
             (width - 2 * padding) as _,
             self.language,
@@ -596,7 +958,6 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
 
         let x_start = padding as u16;
         let y_advance = font.y_advance();
-        let para_spacing = y_advance / 2;
         let y_start = y_advance / 2 + padding as u16;
         let page_height = if self.show_settings {
             (height / 2 - padding) as u16
@@ -609,6 +970,7 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
         let start_line = self.progress.start.line as usize;
 
         let mut all_lines: Vec<layout::Line> = Vec::new();
+        let mut fonts: Vec<font::Font> = Vec::new();
         let mut images: Vec<layout::Image> = Vec::new();
         let mut y_offsets: Vec<u16> = Vec::new();
         let mut end_paragraph = start_paragraph;
@@ -621,7 +983,7 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
             // Add paragraph spacing before each paragraph (except the first on the page)
             if para_idx > start_paragraph || start_line == 0 {
                 if has_content {
-                    y_cursor += para_spacing;
+                    y_cursor += self.spacing_before(&chapter.paragraphs[para_idx], y_advance);
                 }
             }
 
@@ -633,9 +995,9 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
                         continue;
                     }
 
-                    let alignment = text.alignment.unwrap_or(self.alignment);
-                    let indent = text.indent.unwrap_or(self.indent);
-                    let para_lines = layout::layout_text(options, alignment, indent, &text.runs);
+                    let para_font = self.paragraph_options(options, text).font;
+                    let line_advance = para_font.y_advance();
+                    let para_lines = self.layout_text(options, text, &chapter.palette);
                     let skip = if para_idx == start_paragraph { start_line } else { 0 };
 
                     for (line_idx, line) in para_lines.into_iter().enumerate() {
@@ -643,15 +1005,17 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
                             continue;
                         }
 
-                        if y_cursor + y_advance > page_height {
+                        if y_cursor + line_advance > page_height {
                             end_paragraph = para_idx;
                             end_line = line_idx;
                             break 'outer;
                         }
 
-                        y_offsets.push(y_cursor);
+                        // Keep baselines apart when the size changes
+                        y_offsets.push((y_cursor + line_advance).saturating_sub(y_advance));
+                        fonts.push(para_font);
                         all_lines.push(line);
-                        y_cursor += y_advance;
+                        y_cursor += line_advance;
                         has_content = true;
                         end_paragraph = para_idx;
                         end_line = line_idx + 1;
@@ -686,6 +1050,13 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
                     end_paragraph = para_idx + 1;
                     end_line = 0;
                 }
+                book::Paragraph::PageBreak => {
+                    end_paragraph = para_idx + 1;
+                    end_line = 0;
+                    if has_content {
+                        break 'outer;
+                    }
+                }
             }
         }
 
@@ -695,11 +1066,13 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
         };
 
         buffers.clear(BinaryColor::On).ok();
-        self.draw_layed_out_text(font, &all_lines, &y_offsets, x_start, y_start, font::Mode::Bw, buffers);
-        // Decode and draw images during the BW render pass
+        self.draw_layed_out_text(&fonts, &all_lines, &chapter.palette, &y_offsets, x_start, y_start, font::Mode::Bw, buffers);
+        // Decode and draw images during the BW render pass, decoding in the
+        // inactive framebuffer
         for img in &images {
             let book = self.book.as_ref().unwrap();
-            if let Some(decoded) = book.image(img.key, (options.width, page_height), &mut self.file) {
+            let dimensions = (options.width, page_height);
+            if let Some(decoded) = book.image(img.key, dimensions, &mut self.file, &mut buffers.scratch()) {
                 decoded.blit(img.y_offset, buffers);
             }
         }
@@ -708,11 +1081,11 @@ impl<Filesystem: crate::fs::Filesystem> super::Activity for ReaderActivity<Files
         display.display(buffers, RefreshMode::Fast);
 
         buffers.clear(BinaryColor::Off).ok();
-        self.draw_layed_out_text(font, &all_lines, &y_offsets, x_start, y_start, font::Mode::Msb, buffers);
+        self.draw_layed_out_text(&fonts, &all_lines, &chapter.palette, &y_offsets, x_start, y_start, font::Mode::Msb, buffers);
         display.copy_to_msb(buffers.get_active_buffer());
 
         buffers.clear(BinaryColor::Off).ok();
-        self.draw_layed_out_text(font, &all_lines, &y_offsets, x_start, y_start, font::Mode::Lsb, buffers);
+        self.draw_layed_out_text(&fonts, &all_lines, &chapter.palette, &y_offsets, x_start, y_start, font::Mode::Lsb, buffers);
         display.copy_to_lsb(buffers.get_active_buffer());
         display.display_differential_grayscale(false);
     }
@@ -1,4 +1,4 @@
-use alloc::boxed::Box;
+use alloc::{boxed::Box, vec::Vec};
 
 use log::info;
 
@@ -12,16 +12,72 @@ use crate::activities::settings::SettingsActivity;
 
 use crate::container::image;
 use crate::display::RefreshMode;
-use crate::res::img::bebop;
+use crate::res::{font, img::bebop};
 
 use crate::{
-    activities::{Activity, ApplicationState},
+    activities::{Activity, ApplicationState, Work},
     battery::ChargeState,
-    framebuffer::DisplayBuffers,
+    framebuffer::{DisplayBuffers, Rotation},
     fs::Directory,
     input,
+    trace,
 };
 
+/// Where the application was when it went to sleep, so waking up can go
+/// straight back there. See [`Application::suspend`].
+pub struct Snapshot {
+    rotation: Rotation,
+    stack: heapless::Vec<ActivityType, 8>,
+    activity_type: ActivityType,
+}
+
+/// Starts an encoded [`Snapshot`], with the format version last.
+const SNAPSHOT_MAGIC: [u8; 4] = *b"TRS\x01";
+
+impl Snapshot {
+    /// Write the snapshot to `out`, like memory that survives deep sleep.
+    /// Returns false and invalidates `out` if it doesn't fit.
+    pub fn encode(&self, out: &mut [u8]) -> bool {
+        let mut bytes = Vec::from(SNAPSHOT_MAGIC);
+        bytes.extend_from_slice(&[self.rotation as u8, self.stack.len() as u8]);
+        for activity_type in self.stack.iter().chain([&self.activity_type]) {
+            activity_type.encode(&mut bytes);
+        }
+        let Some(out) = out.get_mut(..bytes.len()) else {
+            out.iter_mut().take(SNAPSHOT_MAGIC.len()).for_each(|b| *b = 0);
+            return false;
+        };
+        out.copy_from_slice(&bytes);
+        true
+    }
+
+    /// Read a snapshot written by [`Snapshot::encode`], or `None` if
+    /// `bytes` hold anything else.
+    pub fn decode(bytes: &[u8]) -> Option<Self> {
+        let rest = bytes.strip_prefix(&SNAPSHOT_MAGIC)?;
+        let (&[rotation, depth], mut rest) = rest.split_first_chunk::<2>()?;
+        let rotation = match rotation {
+            0 => Rotation::Rotate0,
+            1 => Rotation::Rotate90,
+            2 => Rotation::Rotate180,
+            3 => Rotation::Rotate270,
+            _ => return None,
+        };
+        let mut stack = heapless::Vec::new();
+        for _ in 0..depth {
+            stack.push(ActivityType::decode(&mut rest)?).ok()?;
+        }
+        let activity_type = ActivityType::decode(&mut rest)?;
+        Some(Self { rotation, stack, activity_type })
+    }
+}
+
+/// Closed activities kept for reopening.
+const PARKED: usize = 2;
+
+/// Directory on the card with font files to install, see [`font::file`].
+const FONTS_PATH: &str = "fonts";
+
 pub struct Application<'a, Filesystem> {
     dirty: bool,
     display_buffers: &'a mut DisplayBuffers,
@@ -29,6 +85,9 @@ pub struct Application<'a, Filesystem> {
     stack: heapless::Vec<ActivityType, 8>,
     activity: Option<Box<dyn Activity>>,
     activity_type: ActivityType,
+    /// Recently closed activities, oldest first, so going back to a
+    /// directory or book doesn't list or parse it again.
+    parked: heapless::Vec<(ActivityType, Box<dyn Activity>), PARKED>,
     sleep: bool,
     ota: bool,
 }
@@ -36,6 +95,7 @@ pub struct Application<'a, Filesystem> {
 impl<'a, Filesystem> Application<'a, Filesystem>
 where
     Filesystem: crate::fs::Filesystem + Clone + 'static,
+    Filesystem::File: 'static,
 {
     pub fn new(display_buffers: &'a mut DisplayBuffers, filesystem: Filesystem) -> Self {
         Self::with_intent(display_buffers, filesystem, ActivityType::home())
@@ -46,6 +106,7 @@ where
         filesystem: Filesystem,
         activity_type: ActivityType,
     ) -> Self {
+        font::file::install(&filesystem, FONTS_PATH);
         let mut activity = Self::create_activity(&activity_type, &filesystem);
         activity.start();
 
@@ -56,11 +117,50 @@ where
             stack: heapless::Vec::new(),
             activity: Some(activity),
             activity_type,
+            parked: heapless::Vec::new(),
             sleep: false,
             ota: false,
         }
     }
 
+    /// Start where [`Application::suspend`] left off, or on the home
+    /// screen if the book or directory is gone.
+    pub fn resume(
+        display_buffers: &'a mut DisplayBuffers,
+        filesystem: Filesystem,
+        snapshot: Snapshot,
+    ) -> Self {
+        display_buffers.set_rotation(snapshot.rotation);
+        let available = match &snapshot.activity_type {
+            ActivityType::Reader { path } => filesystem.exists(path).unwrap_or(false),
+            ActivityType::FileBrowser { path, .. } if !path.is_empty() => {
+                filesystem.exists(path).unwrap_or(false)
+            }
+            _ => true,
+        };
+        if !available {
+            info!("Can't resume, opening home instead");
+            return Self::new(display_buffers, filesystem);
+        }
+        let mut application = Self::with_intent(display_buffers, filesystem, snapshot.activity_type);
+        application.stack = snapshot.stack;
+        application
+    }
+
+    /// Close the current activity, saving its state, and capture where
+    /// the application is for [`Application::resume`].
+    pub fn suspend(&mut self) -> Snapshot {
+        if let Some(mut activity) = self.activity.take() {
+            activity.close();
+        }
+        self.parked.clear();
+        Snapshot {
+            rotation: self.display_buffers.rotation(),
+            stack: self.stack.clone(),
+            activity_type: self.activity_type.clone(),
+        }
+    }
+
     pub fn running(&self) -> bool {
         !self.sleep && !self.ota
     }
@@ -69,6 +169,11 @@ where
         self.ota
     }
 
+    /// Whether something changed since the last draw.
+    pub fn dirty(&self) -> bool {
+        self.dirty
+    }
+
     pub fn update(&mut self, buttons: &input::ButtonState, charge: ChargeState) {
         if buttons.is_pressed(input::Buttons::Power) {
             self.sleep = true;
@@ -83,6 +188,7 @@ where
             return;
         }
 
+        let _span = trace::span(trace::Span::Update);
         match self.activity.as_mut().unwrap().update(&state) {
             crate::activities::UpdateResult::None => {}
             crate::activities::UpdateResult::Redraw => self.dirty = true,
@@ -107,6 +213,38 @@ where
         }
     }
 
+    /// Run one step of the activity's background work. Returns whether
+    /// more is pending, in which case the main loop shouldn't idle.
+    pub fn work(&mut self) -> bool {
+        if !self.running() {
+            return false;
+        }
+        let Some(activity) = &mut self.activity else {
+            return false;
+        };
+        match activity.work() {
+            Work::Idle => false,
+            Work::Pending => true,
+            Work::Done => {
+                self.dirty = true;
+                false
+            }
+        }
+    }
+
+    /// Give back memory that can be rebuilt, parked activities first and
+    /// then what the current activity can do without.
+    pub fn reclaim(&mut self) {
+        if !self.parked.is_empty() {
+            info!("Dropping parked activities to free memory");
+            self.parked.clear();
+            return;
+        }
+        if let Some(activity) = &mut self.activity {
+            activity.reclaim();
+        }
+    }
+
     pub fn draw(&mut self, display: &mut impl crate::display::Display) {
         if self.sleep {
             self.display_buffers
@@ -122,6 +260,7 @@ where
         }
         if let Some(activity) = &mut self.activity {
             info!("Drawing activity");
+            let _span = trace::span(trace::Span::Draw);
             activity.draw(display, self.display_buffers);
         }
         self.dirty = false;
@@ -130,14 +269,40 @@ where
     fn open(&mut self, activity_type: ActivityType) {
         if let Some(mut current) = self.activity.take() {
             current.close();
+            self.park(current);
         }
-        let mut activity = Self::create_activity(&activity_type, &self.filesystem);
+        let mut activity = self
+            .unpark(&activity_type)
+            .unwrap_or_else(|| Self::create_activity(&activity_type, &self.filesystem));
         activity.start();
         self.activity = Some(activity);
         self.dirty = true;
         self.activity_type = activity_type;
     }
 
+    /// Keep the closed current activity if it can be resumed, evicting the
+    /// oldest parked one when full.
+    fn park(&mut self, mut activity: Box<dyn Activity>) {
+        if !activity.resumable() {
+            return;
+        }
+        // Only keep what it needs to draw again
+        activity.reclaim();
+        if self.parked.is_full() {
+            self.parked.remove(0);
+        }
+        self.parked.push((self.activity_type.clone(), activity)).ok();
+    }
+
+    fn unpark(&mut self, activity_type: &ActivityType) -> Option<Box<dyn Activity>> {
+        let index = self
+            .parked
+            .iter()
+            .position(|(parked, _)| parked.same_target(activity_type))?;
+        info!("Resuming parked activity");
+        Some(self.parked.remove(index).1)
+    }
+
     fn create_activity(activity_type: &ActivityType, filesystem: &Filesystem) -> Box<dyn Activity> {
         match activity_type {
             ActivityType::Home { state } => Box::new(HomeActivity::new(*state)),
@@ -164,3 +329,30 @@ impl<'a, Filesystem> Drop for Application<'a, Filesystem> {
         self.activity.as_deref_mut().map(Activity::close);
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn snapshot_roundtrip() {
+        let mut stack = heapless::Vec::new();
+        stack.push(ActivityType::home()).ok();
+        stack.push(ActivityType::FileBrowser { focus: 3, path: "books".try_into().unwrap() }).ok();
+        let activity_type = ActivityType::reader("books/a.epub");
+        let snapshot = Snapshot { rotation: Rotation::Rotate270, stack, activity_type };
+
+        let mut bytes = [0u8; 64];
+        assert!(snapshot.encode(&mut bytes));
+        let decoded = Snapshot::decode(&bytes).unwrap();
+        assert_eq!(decoded.rotation, Rotation::Rotate270);
+        assert_eq!(decoded.stack.len(), 2);
+        assert!(matches!(decoded.stack[1], ActivityType::FileBrowser { focus: 3, .. }));
+        assert!(decoded.stack[1].same_target(&snapshot.stack[1]));
+        assert!(decoded.activity_type.same_target(&snapshot.activity_type));
+
+        // A snapshot that doesn't fit leaves nothing to resume from
+        assert!(!snapshot.encode(&mut bytes[..16]));
+        assert!(Snapshot::decode(&bytes).is_none());
+    }
+}
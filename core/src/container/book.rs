@@ -2,6 +2,9 @@ use alloc::{
     string::{String, ToString},
     vec::Vec,
 };
+use core::ops::DerefMut;
+use core::task::Poll;
+
 use embedded_io::Write;
 use log::info;
 use zerocopy::{FromBytes, IntoBytes};
@@ -11,6 +14,7 @@ use crate::{
     container::image,
     fs::{self, File},
     layout,
+    res::font,
 };
 
 enum BookFormat {
@@ -28,7 +32,7 @@ pub struct Book<Filesystem: fs::Filesystem> {
     format: BookFormat,
 }
 
-#[derive(zerocopy::Immutable, zerocopy::FromBytes, zerocopy::IntoBytes)]
+#[derive(Clone, Copy, PartialEq, Eq, zerocopy::Immutable, zerocopy::FromBytes, zerocopy::IntoBytes)]
 pub struct Progress {
     pub chapter: u16,
     pub paragraph: u16,
@@ -41,27 +45,48 @@ pub struct Chapter {
     // Keep it like this for now? We have roughly 200KB free rn and an extra 48kB
     // if we reuse the framebuffer here.
     pub paragraphs: Vec<Paragraph>,
+    /// The glyphs of the prepared runs.
+    pub palette: font::Palette,
 }
 
 pub struct Text {
     pub runs: Vec<layout::Run>,
     pub alignment: Option<layout::Alignment>,
     pub indent: Option<u16>,
+    /// Space above the paragraph in tenths of an em.
+    pub margin_top: Option<u16>,
+    /// Font size relative to the reader's font size in percent.
+    pub font_scale: Option<u8>,
 }
 
 pub enum Paragraph {
     Text(Text),
     Image { key: u16, width: u16, height: u16 },
     Hr,
+    /// Hard page break. The paginator ends the current page here.
+    PageBreak,
 }
 
 const BASE_PATH: &str = ".trusty";
+const STYLESHEET_CACHE_FILE: &str = "stylesheet.css.bin";
 
 impl<Filesystem: fs::Filesystem> Book<Filesystem> {
     pub fn from_file(
         file_path: &str,
         filesystem: Filesystem,
         file: &mut impl File,
+    ) -> Option<Self> {
+        let mut book = Self::open(file_path, filesystem, file)?;
+        book.load_stylesheet(file);
+        Some(book)
+    }
+
+    /// Like [`Book::from_file`], but leaves the EPUB stylesheet to a later
+    /// [`Book::load_stylesheet`] so opening can be split into steps.
+    pub fn open(
+        file_path: &str,
+        filesystem: Filesystem,
+        file: &mut impl File,
     ) -> Option<Self> {
         info!("Loading book from file: {}", file_path);
         let (name, ext) = file_path.rsplit_once('.').unwrap_or((file_path, ""));
@@ -72,7 +97,7 @@ impl<Filesystem: fs::Filesystem> Book<Filesystem> {
                 BookFormat::Markdown(name.to_string(), text)
             }
             "epub" => {
-                let epub = epub::parse(file).ok()?;
+                let epub = epub::parse_package(file).ok()?;
                 BookFormat::Epub(epub)
             }
             "xml" => {
@@ -130,6 +155,34 @@ impl<Filesystem: fs::Filesystem> Book<Filesystem> {
         })
     }
 
+    /// Fill in the EPUB stylesheet, preferring the compiled copy in the
+    /// cache directory over parsing every CSS file again.
+    pub fn load_stylesheet(&mut self, file: &mut impl File) {
+        let BookFormat::Epub(epub) = &self.format else {
+            return;
+        };
+        let fingerprint = epub.stylesheet_fingerprint();
+        let stylesheet = if let Some(stylesheet) = self
+            .open_cache_file(STYLESHEET_CACHE_FILE, crate::fs::Mode::Read)
+            .and_then(|mut cached_file| css::Stylesheet::from_cache(&mut cached_file, fingerprint))
+        {
+            log::info!("Loaded stylesheet from cache");
+            stylesheet
+        } else {
+            let stylesheet = epub::parse_stylesheet(epub, file);
+            if let Some(()) = self
+                .open_cache_file(STYLESHEET_CACHE_FILE, crate::fs::Mode::Write)
+                .and_then(|mut cache_file| stylesheet.to_cache(&mut cache_file, fingerprint))
+            {
+                log::info!("Cached stylesheet");
+            }
+            stylesheet
+        };
+        if let BookFormat::Epub(epub) = &mut self.format {
+            epub.stylesheet = stylesheet;
+        }
+    }
+
     pub fn title(&self) -> &str {
         match &self.format {
             BookFormat::PlainText(title, _) => title,
@@ -148,6 +201,18 @@ impl<Filesystem: fs::Filesystem> Book<Filesystem> {
         }
     }
 
+    /// Uncompressed size of chapter `index`'s source, a rough measure of
+    /// what parsing it costs. `None` if unknown.
+    pub fn chapter_size(&self, index: usize) -> Option<u32> {
+        match &self.format {
+            BookFormat::Epub(epub) => {
+                let item = epub.spine.get(index)?;
+                epub.file_resolver.entry(item.file_idx).map(|entry| entry.size)
+            }
+            _ => None,
+        }
+    }
+
     pub fn chapter(&self, index: usize, file: &mut impl File) -> Option<Chapter> {
         let size = file.size();
         match &self.format {
@@ -162,11 +227,14 @@ impl<Filesystem: fs::Filesystem> Book<Filesystem> {
         }
     }
 
+    /// Load a decoded image from the cache or decode it. `scratch` is only
+    /// written to when decoding.
     pub fn image(
         &self,
         key: u16,
         (w, h): (u16, u16),
         file: &mut impl File,
+        scratch: &mut impl DerefMut<Target = [u8]>,
     ) -> Option<image::DecodedImage> {
         let cache_key = alloc::format!("image_{key}_{w}x{h}.poi");
         if let Some(image) = self
@@ -178,7 +246,7 @@ impl<Filesystem: fs::Filesystem> Book<Filesystem> {
         }
 
         let image = match &self.format {
-            BookFormat::Epub(epub) => epub::parse_image(epub, key, (w, h), file).ok(),
+            BookFormat::Epub(epub) => epub::parse_image(epub, key, (w, h), file, scratch).ok(),
             _ => None,
         }?;
 
@@ -261,4 +329,66 @@ impl Chapter {
             Some(plaintext::from_str(text))
         }
     }
+
+    /// Precompute the hyphenation points and glyphs of every run, so
+    /// laying out a page never has to call into `hypher` or search fonts.
+    /// Runs that are already prepared are left as they are.
+    pub fn prepare(&mut self, font: font::Font, language: hypher::Lang) {
+        for paragraph in &mut self.paragraphs {
+            if let Paragraph::Text(text) = paragraph {
+                for run in &mut text.runs {
+                    run.prepare(font, language, &mut self.palette);
+                }
+            }
+        }
+        self.palette.finish();
+    }
+
+    /// Roughly the heap memory the chapter holds.
+    pub fn heap_size(&self) -> usize {
+        let mut size = self.paragraphs.capacity() * core::mem::size_of::<Paragraph>();
+        for paragraph in &self.paragraphs {
+            if let Paragraph::Text(text) = paragraph {
+                size += text.runs.capacity() * core::mem::size_of::<layout::Run>();
+                for run in &text.runs {
+                    size += run.content.heap_size() + run.hyphens.heap_size();
+                }
+            }
+        }
+        size + self.palette.heap_size() + self.title.as_ref().map_or(0, String::capacity)
+    }
+}
+
+/// [`Chapter::prepare`] a few paragraphs at a time, so a long chapter
+/// doesn't block input.
+#[derive(Default)]
+pub struct Preparation {
+    next: usize,
+}
+
+impl Preparation {
+    /// Prepare up to `count` more paragraphs of `chapter`. Ready once all
+    /// of them are done.
+    pub fn step(
+        &mut self,
+        chapter: &mut Chapter,
+        language: hypher::Lang,
+        font: font::Font,
+        count: usize,
+    ) -> Poll<()> {
+        let end = chapter.paragraphs.len().min(self.next + count);
+        for paragraph in &mut chapter.paragraphs[self.next..end] {
+            if let Paragraph::Text(text) = paragraph {
+                for run in &mut text.runs {
+                    run.prepare(font, language, &mut chapter.palette);
+                }
+            }
+        }
+        self.next = end;
+        if end < chapter.paragraphs.len() {
+            return Poll::Pending;
+        }
+        chapter.palette.finish();
+        Poll::Ready(())
+    }
 }
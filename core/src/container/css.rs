@@ -1,9 +1,12 @@
 use core::ops::Add;
 
-use alloc::{string::String, vec::Vec};
+use alloc::{collections::btree_map::BTreeMap, string::String, vec::Vec};
 
 use crate::layout;
 
+const CACHE_FILE_MAGIC: &[u8; 4] = b"CSS4";
+const NO_ATOM: u16 = u16::MAX;
+
 #[derive(Default)]
 pub struct Stylesheet {
     rules: Vec<(Selector, Rule)>,
@@ -124,6 +127,12 @@ impl Stylesheet {
             .fold(Rule::default(), |acc, (_, _, rule)| acc + *rule)
     }
 
+    /// Whether any rule is keyed on an `id`. If not, the `id` attribute can
+    /// never influence [`Stylesheet::get`].
+    pub fn uses_ids(&self) -> bool {
+        self.rules.iter().any(|(sel, _)| sel.id.is_some())
+    }
+
     pub fn extend_from_sheet(&mut self, sheet: &str) {
         let sheet = Self::filter_comments(sheet);
 
@@ -200,6 +209,132 @@ impl Stylesheet {
         None
     }
 
+    /// Load a stylesheet compiled by [`Stylesheet::to_cache`].
+    /// Returns `None` if the file is damaged or was compiled from different
+    /// sources (`fingerprint` mismatch).
+    pub fn from_cache(reader: &mut impl crate::fs::File, fingerprint: u32) -> Option<Self> {
+        let data = reader.read_to_end().ok()?;
+        Self::decode(&data, fingerprint)
+    }
+
+    /// Store the stylesheet in a compact binary form so it can be loaded
+    /// without running any of the CSS text processing again. Returns `None`
+    /// without writing if the sheet exceeds the limits of the format.
+    pub fn to_cache(&self, writer: &mut impl embedded_io::Write, fingerprint: u32) -> Option<()> {
+        writer.write_all(&self.encode(fingerprint)?).ok()
+    }
+
+    /// Layout:
+    /// - magic, fingerprint (u32)
+    /// - atom count (u16), then per atom: length (u8) and bytes
+    /// - rule count (u16), then per rule: element atom (u16), id atom (u16),
+    ///   class count (u8), class atoms (u16 each) and the packed [`Rule`] (u64)
+    ///
+    /// Selector parts are interned, so `.calibre1` used by a hundred rules is
+    /// only stored once.
+    ///
+    /// Returns `None` if an atom is longer than 255 bytes, a selector has more
+    /// than 255 classes, or the rules or atoms don't fit their u16 counts.
+    fn encode(&self, fingerprint: u32) -> Option<Vec<u8>> {
+        fn intern<'a>(atoms: &mut BTreeMap<&'a str, usize>, atom: &'a str) -> Option<u16> {
+            if atom.len() > u8::MAX as usize {
+                return None;
+            }
+            let next = atoms.len();
+            let idx = *atoms.entry(atom).or_insert(next);
+            u16::try_from(idx).ok().filter(|&idx| idx != NO_ATOM)
+        }
+
+        let mut atoms = BTreeMap::new();
+        let mut rules = Vec::new();
+        let count = u16::try_from(self.rules.len()).ok()?;
+        for (selector, rule) in &self.rules {
+            let element = selector.element.as_deref().map_or(Some(NO_ATOM), |a| intern(&mut atoms, a))?;
+            let id = selector.id.as_deref().map_or(Some(NO_ATOM), |a| intern(&mut atoms, a))?;
+            rules.extend_from_slice(&element.to_le_bytes());
+            rules.extend_from_slice(&id.to_le_bytes());
+            rules.push(u8::try_from(selector.classes.len()).ok()?);
+            for class in &selector.classes {
+                rules.extend_from_slice(&intern(&mut atoms, class)?.to_le_bytes());
+            }
+            rules.extend_from_slice(&rule.pack().to_le_bytes());
+        }
+
+        let mut atoms: Vec<_> = atoms.into_iter().collect();
+        atoms.sort_unstable_by_key(|&(_, idx)| idx);
+        let mut out = Vec::with_capacity(12 + rules.len() + atoms.iter().map(|(a, _)| a.len() + 1).sum::<usize>());
+        out.extend_from_slice(CACHE_FILE_MAGIC);
+        out.extend_from_slice(&fingerprint.to_le_bytes());
+        out.extend_from_slice(&(atoms.len() as u16).to_le_bytes());
+        for (atom, _) in &atoms {
+            out.push(atom.len() as u8);
+            out.extend_from_slice(atom.as_bytes());
+        }
+        out.extend_from_slice(&count.to_le_bytes());
+        out.extend_from_slice(&rules);
+        Some(out)
+    }
+
+    fn decode(data: &[u8], fingerprint: u32) -> Option<Self> {
+        struct Cursor<'a>(&'a [u8]);
+        impl<'a> Cursor<'a> {
+            fn take(&mut self, n: usize) -> Option<&'a [u8]> {
+                if self.0.len() < n {
+                    return None;
+                }
+                let (head, tail) = self.0.split_at(n);
+                self.0 = tail;
+                Some(head)
+            }
+            fn u8(&mut self) -> Option<u8> {
+                self.take(1).map(|b| b[0])
+            }
+            fn u16(&mut self) -> Option<u16> {
+                self.take(2).map(|b| u16::from_le_bytes([b[0], b[1]]))
+            }
+            fn u32(&mut self) -> Option<u32> {
+                self.take(4).map(|b| u32::from_le_bytes([b[0], b[1], b[2], b[3]]))
+            }
+            fn u64(&mut self) -> Option<u64> {
+                self.take(8).map(|b| u64::from_le_bytes(b.try_into().unwrap()))
+            }
+        }
+
+        let mut cursor = Cursor(data);
+        if cursor.take(4)? != &CACHE_FILE_MAGIC[..] || cursor.u32()? != fingerprint {
+            return None;
+        }
+
+        let atom_count = cursor.u16()? as usize;
+        let mut atoms = Vec::with_capacity(atom_count);
+        for _ in 0..atom_count {
+            let len = cursor.u8()? as usize;
+            atoms.push(core::str::from_utf8(cursor.take(len)?).ok()?);
+        }
+        let atom = |idx: u16| -> Option<Option<String>> {
+            match idx {
+                NO_ATOM => Some(None),
+                idx => atoms.get(idx as usize).map(|a| Some(String::from(*a))),
+            }
+        };
+
+        let rule_count = cursor.u16()? as usize;
+        let mut rules = Vec::with_capacity(rule_count);
+        for _ in 0..rule_count {
+            let element = atom(cursor.u16()?)?;
+            let id = atom(cursor.u16()?)?;
+            let class_count = cursor.u8()? as usize;
+            let mut classes = Vec::with_capacity(class_count);
+            for _ in 0..class_count {
+                classes.push(atom(cursor.u16()?)??);
+            }
+            let rule = Rule::unpack(cursor.u64()?)?;
+            rules.push((Selector { element, id, classes }, rule));
+        }
+
+        Some(Self { rules })
+    }
+
     fn filter_comments(sheet: &str) -> String {
         let mut result = String::new();
         let mut chars = sheet.char_indices().peekable();
@@ -234,12 +369,71 @@ impl Stylesheet {
     }
 }
 
-#[derive(Clone, Copy, Default)]
+#[derive(Clone, Copy, Default, Debug, PartialEq, Eq)]
 pub struct Rule {
     pub alignment: Option<layout::Alignment>,
     pub italic: Option<bool>,
     pub bold: Option<bool>,
     pub indent: Option<u16>,
+    /// `display: none`. `Some(false)` for any other display value, so an
+    /// inline style can un-hide an element hidden by the stylesheet.
+    pub hidden: Option<bool>,
+    /// Space above the block in tenths of an em.
+    pub margin_top: Option<u16>,
+    pub font_scale: Option<FontScale>,
+    pub page_break_before: Option<bool>,
+    pub page_break_after: Option<bool>,
+}
+
+/// A `font-size` in percent.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum FontScale {
+    /// Of the body text, for keywords, `rem` and absolute lengths.
+    Body(u8),
+    /// Of the parent element's font, for `em`, percentages, `smaller` and
+    /// `larger`.
+    Parent(u8),
+}
+
+impl FontScale {
+    /// The size relative to the body text inside a parent at `parent` percent.
+    pub fn resolve(self, parent: u8) -> u8 {
+        match self {
+            Self::Body(scale) => scale,
+            Self::Parent(scale) => (scale as u32 * parent as u32 / 100).min(u8::MAX as u32) as u8,
+        }
+    }
+
+    fn percent(self) -> u8 {
+        match self {
+            Self::Body(scale) | Self::Parent(scale) => scale,
+        }
+    }
+}
+
+/// CSS pixels per em, used to convert absolute lengths to relative ones.
+const PX_PER_EM: f32 = 16.0;
+
+/// Parse a length into ems. Percentages are only accepted for font sizes.
+fn parse_em(value: &str, percent: bool) -> Option<f32> {
+    let value = value.trim();
+    let (number, scale) = if let Some(n) = value.strip_suffix("em") {
+        (n.strip_suffix('r').unwrap_or(n), 1.0)
+    } else if let Some(n) = value.strip_suffix("px") {
+        (n, 1.0 / PX_PER_EM)
+    } else if let Some(n) = value.strip_suffix("pt") {
+        (n, 4.0 / 3.0 / PX_PER_EM)
+    } else if let Some(n) = value.strip_suffix('%')
+        && percent
+    {
+        (n, 0.01)
+    } else if value == "0" {
+        ("0", 0.0)
+    } else {
+        return None;
+    };
+    let em = number.trim().parse::<f32>().ok()? * scale;
+    (em >= 0.0).then_some(em)
 }
 
 impl Rule {
@@ -252,6 +446,11 @@ impl Rule {
             let Some((key, value)) = part.split_once(':') else {
                 continue;
             };
+            // Rules aren't ranked by importance, the value is what counts
+            let value = match value.trim_end().strip_suffix("important") {
+                Some(rest) => rest.trim_end().strip_suffix('!').unwrap_or(value),
+                None => value,
+            };
 
             match key.trim() {
                 "text-align" => {
@@ -284,6 +483,44 @@ impl Rule {
                         rule.indent = Some(indent);
                     }
                 }
+                "display" => {
+                    rule.hidden = Some(value.trim() == "none");
+                }
+                "margin-top" | "margin" => {
+                    // The first value of the shorthand is always the top margin.
+                    if let Some(top) = value.split_whitespace().next()
+                        && let Some(em) = parse_em(top, false)
+                    {
+                        rule.margin_top = Some((em * 10.0).min(u16::MAX as f32) as u16);
+                    }
+                }
+                "font-size" => {
+                    rule.font_scale = match value.trim() {
+                        "xx-small" => Some(FontScale::Body(60)),
+                        "x-small" => Some(FontScale::Body(75)),
+                        "small" => Some(FontScale::Body(89)),
+                        "smaller" => Some(FontScale::Parent(83)),
+                        "medium" => Some(FontScale::Body(100)),
+                        "large" => Some(FontScale::Body(120)),
+                        "larger" => Some(FontScale::Parent(120)),
+                        "x-large" => Some(FontScale::Body(150)),
+                        "xx-large" => Some(FontScale::Body(200)),
+                        value => parse_em(value, true).map(|em| {
+                            let scale = (em * 100.0).round().min(u8::MAX as f32) as u8;
+                            if value.ends_with('%') || (value.ends_with("em") && !value.ends_with("rem")) {
+                                FontScale::Parent(scale)
+                            } else {
+                                FontScale::Body(scale)
+                            }
+                        }),
+                    }
+                }
+                "page-break-before" | "break-before" => {
+                    rule.page_break_before = parse_page_break(value);
+                }
+                "page-break-after" | "break-after" => {
+                    rule.page_break_after = parse_page_break(value);
+                }
                 _ => {}
             }
         }
@@ -291,11 +528,105 @@ impl Rule {
         rule
     }
 
+    /// Pack into a bitfield for the stylesheet cache.
+    ///
+    /// | bits  | field                                     |
+    /// |-------|-------------------------------------------|
+    /// | 0-2   | alignment (0 = unset, 1-4 = variant)      |
+    /// | 3-4   | italic (0 = unset, 1 = false, 2 = true)   |
+    /// | 5-6   | bold (0 = unset, 1 = false, 2 = true)     |
+    /// | 7     | indent set                                |
+    /// | 8-9   | hidden (tristate)                         |
+    /// | 10-11 | page break before (tristate)              |
+    /// | 12-13 | page break after (tristate)               |
+    /// | 14    | margin top set                            |
+    /// | 15    | font scale set                            |
+    /// | 16-31 | indent                                    |
+    /// | 32-47 | margin top                                |
+    /// | 48-55 | font scale                                |
+    /// | 56    | font scale relative to the parent         |
+    fn pack(&self) -> u64 {
+        fn tristate(value: Option<bool>) -> u64 {
+            match value {
+                None => 0,
+                Some(false) => 1,
+                Some(true) => 2,
+            }
+        }
+        let alignment = match self.alignment {
+            None => 0,
+            Some(layout::Alignment::Start) => 1,
+            Some(layout::Alignment::Center) => 2,
+            Some(layout::Alignment::End) => 3,
+            Some(layout::Alignment::Justify) => 4,
+        };
+        alignment
+            | (tristate(self.italic) << 3)
+            | (tristate(self.bold) << 5)
+            | ((self.indent.is_some() as u64) << 7)
+            | (tristate(self.hidden) << 8)
+            | (tristate(self.page_break_before) << 10)
+            | (tristate(self.page_break_after) << 12)
+            | ((self.margin_top.is_some() as u64) << 14)
+            | ((self.font_scale.is_some() as u64) << 15)
+            | ((self.indent.unwrap_or(0) as u64) << 16)
+            | ((self.margin_top.unwrap_or(0) as u64) << 32)
+            | ((self.font_scale.map_or(0, FontScale::percent) as u64) << 48)
+            | ((matches!(self.font_scale, Some(FontScale::Parent(_))) as u64) << 56)
+    }
+
+    fn unpack(packed: u64) -> Option<Self> {
+        fn tristate(value: u64) -> Option<Option<bool>> {
+            match value & 0b11 {
+                0 => Some(None),
+                1 => Some(Some(false)),
+                2 => Some(Some(true)),
+                _ => None,
+            }
+        }
+        let alignment = match packed & 0b111 {
+            0 => None,
+            1 => Some(layout::Alignment::Start),
+            2 => Some(layout::Alignment::Center),
+            3 => Some(layout::Alignment::End),
+            4 => Some(layout::Alignment::Justify),
+            _ => return None,
+        };
+        let flag = |bit: u32| packed & (1 << bit) != 0;
+        Some(Self {
+            alignment,
+            italic: tristate(packed >> 3)?,
+            bold: tristate(packed >> 5)?,
+            indent: flag(7).then_some((packed >> 16) as u16),
+            hidden: tristate(packed >> 8)?,
+            page_break_before: tristate(packed >> 10)?,
+            page_break_after: tristate(packed >> 12)?,
+            margin_top: flag(14).then_some((packed >> 32) as u16),
+            font_scale: flag(15).then(|| match flag(56) {
+                false => FontScale::Body((packed >> 48) as u8),
+                true => FontScale::Parent((packed >> 48) as u8),
+            }),
+        })
+    }
+
     fn has_any(&self) -> bool {
         self.alignment.is_some()
             || self.italic.is_some()
             || self.bold.is_some()
             || self.indent.is_some()
+            || self.hidden.is_some()
+            || self.margin_top.is_some()
+            || self.font_scale.is_some()
+            || self.page_break_before.is_some()
+            || self.page_break_after.is_some()
+    }
+}
+
+fn parse_page_break(value: &str) -> Option<bool> {
+    match value.trim() {
+        "always" | "page" | "left" | "right" | "recto" | "verso" => Some(true),
+        "auto" | "avoid" | "avoid-page" => Some(false),
+        _ => None,
     }
 }
 
@@ -308,6 +639,89 @@ impl Add for Rule {
             italic: self.italic.or(rhs.italic),
             bold: self.bold.or(rhs.bold),
             indent: self.indent.or(rhs.indent),
+            hidden: self.hidden.or(rhs.hidden),
+            margin_top: self.margin_top.or(rhs.margin_top),
+            font_scale: self.font_scale.or(rhs.font_scale),
+            page_break_before: self.page_break_before.or(rhs.page_break_before),
+            page_break_after: self.page_break_after.or(rhs.page_break_after),
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use alloc::vec;
+
+    use super::*;
+
+    #[test]
+    fn important() {
+        let rule = Rule::parse("font-weight: bold !important; display:none!important; text-align: center ! important");
+        assert_eq!((rule.bold, rule.hidden), (Some(true), Some(true)));
+        assert_eq!(rule.alignment, Some(layout::Alignment::Center));
+    }
+
+    #[test]
+    fn cache_roundtrip() {
+        let mut sheet = Stylesheet::default();
+        sheet.extend_from_sheet(
+            "/* comment */ p.calibre1 { text-align: center; text-indent: 12px }
+             .calibre1, #title { font-weight: bold }
+             h1#title.big.red { font-style: italic; text-align: justify }
+             .chapter { page-break-before: always; margin-top: 3em; font-size: 150% }
+             .note { display: none; margin: 12px 0 }
+             .aside { font-size: small }",
+        );
+
+        let data = sheet.encode(0xC0FFEE).unwrap();
+        assert!(Stylesheet::decode(&data, 0xBAD).is_none());
+        let cached = Stylesheet::decode(&data, 0xC0FFEE).unwrap();
+        assert_eq!(cached.rules.len(), sheet.rules.len());
+
+        for (element, id, class) in [
+            ("p", None, Some("calibre1")),
+            ("span", None, Some("calibre1")),
+            ("h1", Some("title"), Some("red big")),
+            ("div", None, None),
+            ("div", None, Some("chapter")),
+            ("aside", None, Some("note")),
+            ("p", None, Some("aside")),
+        ] {
+            assert_eq!(cached.get(element, id, class), sheet.get(element, id, class));
+        }
+
+        // Sheets the format can't hold fall back to parsing
+        let selector = |element: Option<String>, id: Option<String>, classes: Vec<String>| {
+            Selector { element, id, classes }
+        };
+        let rule = Rule::parse("font-weight: bold");
+        let stylesheet = |rules: Vec<(Selector, Rule)>| Stylesheet { rules };
+
+        // Parts longer than their u8 length are refused instead of dropped
+        let long = "x".repeat(256);
+        assert!(stylesheet(vec![(selector(None, None, vec![long.clone()]), rule)]).encode(0).is_none());
+        assert!(stylesheet(vec![(selector(None, None, vec![long[1..].into()]), rule)]).encode(0).is_some());
+        let classes: Vec<String> = (0..256).map(|i| alloc::format!("c{i}")).collect();
+        assert!(stylesheet(vec![(selector(None, None, classes), rule)]).encode(0).is_none());
+
+        // More rules than the u16 count
+        let rules = vec![(selector(Some("p".into()), None, Vec::new()), rule); u16::MAX as usize + 1];
+        assert!(stylesheet(rules).encode(0).is_none());
+
+        // Atom indices up to the one before NO_ATOM
+        let atoms = |count: usize| -> Vec<(Selector, Rule)> {
+            (0..count / 3)
+                .map(|i| {
+                    let atom = |kind| Some(alloc::format!("{kind}{i}"));
+                    (selector(atom("e"), atom("i"), vec![atom("c").unwrap()]), rule)
+                })
+                .collect()
+        };
+        let fits = stylesheet(atoms(NO_ATOM as usize));
+        let cached = Stylesheet::decode(&fits.encode(0).unwrap(), 0).unwrap();
+        let last = ("e21844", Some("i21844"), Some("c21844"));
+        assert_eq!(cached.get(last.0, last.1, last.2), fits.get(last.0, last.1, last.2));
+        assert!(cached.get(last.0, last.1, last.2).bold.is_some());
+        assert!(stylesheet(atoms(NO_ATOM as usize + 3)).encode(0).is_none());
+    }
+}
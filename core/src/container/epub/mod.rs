@@ -1,7 +1,7 @@
 use alloc::{borrow::ToOwned, boxed::Box, string::String, vec::Vec};
 use log::{info, trace};
 
-use crate::{container::{css, image}, fs::File, zip::{self, ZipEntryReader}};
+use crate::{container::{css, image}, fs::File, heap, zip::{self, ZipEntryReader}};
 use super::book;
 
 pub mod container;
@@ -47,13 +47,50 @@ pub struct Epub {
     pub metadata: opf::Metadata,
     pub toc: Option<ncx::TableOfContents>,
     pub cover: Option<u16>,
+    /// File indices of all CSS manifest items.
+    pub stylesheets: Vec<u16>,
+    /// Merged stylesheet, see [`parse_stylesheet`].
     pub stylesheet: css::Stylesheet,
 }
 
+impl Epub {
+    /// Identifies the set of CSS files this book ships and their contents,
+    /// so a cached stylesheet can be told apart from one compiled for
+    /// another book or an earlier edition of this one.
+    pub fn stylesheet_fingerprint(&self) -> u32 {
+        // FNV-1a over name, size and CRC-32 of each stylesheet entry
+        let mut hash = 0x811C_9DC5u32;
+        let mut feed = |bytes: &[u8]| {
+            for &b in bytes {
+                hash = (hash ^ b as u32).wrapping_mul(0x0100_0193);
+            }
+        };
+        for entry in self.stylesheets.iter().filter_map(|&idx| self.file_resolver.entry(idx)) {
+            feed(entry.name.as_bytes());
+            feed(&entry.size.to_le_bytes());
+            feed(&entry.crc32.to_le_bytes());
+        }
+        hash
+    }
+}
+
 type PathBuf = heapless::String<256>;
 
+/// Parse the container, OPF and TOC, as well as all stylesheets.
 pub fn parse(file: &mut impl File) -> Result<Epub> {
-    let entries = zip::parse_zip(file)?;
+    let mut epub = parse_package(file)?;
+    epub.stylesheet = parse_stylesheet(&epub, file);
+    Ok(epub)
+}
+
+/// Like [`parse`], but leaves [`Epub::stylesheet`] empty so the caller can
+/// fill it from a cache.
+pub fn parse_package(file: &mut impl File) -> Result<Epub> {
+    let _scope = heap::scope(heap::Tag::Epub);
+    let entries = {
+        let _scope = heap::scope(heap::Tag::Zip);
+        zip::parse_zip(file)?
+    };
     info!("Parsed ZIP with {} entries", entries.len());
     let rootfile = container::parse(file, &entries)?;
     info!("Located rootfile: {}", rootfile);
@@ -70,6 +107,28 @@ pub fn parse(file: &mut impl File) -> Result<Epub> {
     Ok(epub)
 }
 
+/// Read and merge every CSS item of the manifest.
+pub fn parse_stylesheet(epub: &Epub, file: &mut impl File) -> css::Stylesheet {
+    let _scope = heap::scope(heap::Tag::Css);
+    let mut sheet = css::Stylesheet::default();
+    for &idx in &epub.stylesheets {
+        let Some(entry) = epub.file_resolver.entry(idx) else {
+            continue;
+        };
+
+        let Ok(reader) = ZipEntryReader::new(file, entry) else {
+            log::error!("Failed to read stylesheet entry: {}", entry.name);
+            continue;
+        };
+        let Some(text) = reader.read_to_end().ok().and_then(|bytes| String::from_utf8(bytes).ok()) else {
+            log::error!("Failed to read stylesheet content: {}", entry.name);
+            continue;
+        };
+        sheet.extend_from_sheet(&text);
+    }
+    sheet
+}
+
 pub fn parse_chapter(epub: &Epub, index: usize, file: &mut impl File) -> Result<super::book::Chapter> {
     trace!("Loading chapter {} from EPUB", index);
     let chapter = epub.spine.get(index).ok_or(error::EpubError::InvalidData)?;
@@ -95,6 +154,7 @@ pub fn parse_chapter(epub: &Epub, index: usize, file: &mut impl File) -> Result<
         ""
     };
     let resolver = spine::SpineFileResolver { folder, file_resolver: &epub.file_resolver };
+    let _scope = heap::scope(heap::Tag::Spine);
     let mut chapter = spine::parse(title, reader, entry.size as usize, Some(&epub.stylesheet), Some(resolver))?;
 
     // Resolve image sizes now that the XHTML reader has released the file
@@ -118,19 +178,51 @@ pub fn read_image_size(epub: &Epub, key: u16, file: &mut impl File) -> Result<(u
         .map_err(|_| error::EpubError::InvalidData)
 }
 
-pub fn parse_image(epub: &Epub, key: u16, max: (u16, u16), file: &mut impl File) -> Result<image::DecodedImage> {
+pub fn parse_image(
+    epub: &Epub,
+    key: u16,
+    max: (u16, u16),
+    file: &mut impl File,
+    scratch: &mut [u8],
+) -> Result<image::DecodedImage> {
     trace!("Loading image with key {} from EPUB", key);
     let entry = epub.file_resolver.entry(key).ok_or(error::EpubError::InvalidState)?;
     trace!("Image file entry: {}", entry.name);
     // TODO: use mime type from manifest, maybe Vec<Option<Format>>
     let format = image::Format::guess_from_filename(&entry.name).ok_or(error::EpubError::InvalidFormat)?;
     let mut reader = ZipEntryReader::new(file, entry)?;
-    let img = image::decode(format, &mut reader, entry.size, max.0, max.1)
+    let img = image::decode(format, &mut reader, entry.size, max.0, max.1, scratch)
         .map_err(|_| error::EpubError::InvalidData)?;
     Ok(img)
 }
 
+/// Appends `text` to `out` with entities decoded. XHTML content often uses
+/// HTML named entities on top of the ones XML defines.
 #[inline(never)]
-pub(super) fn decode_html_entities(text: &str) -> alloc::borrow::Cow<'_, str> {
-    html_escape::decode_html_entities(text)
+pub(super) fn decode_text(text: &str, whitespace: embedded_xml::Whitespace, out: &mut String) {
+    embedded_xml::decode_text(text, whitespace, out, html_entity)
+}
+
+fn html_entity(name: &str) -> Option<char> {
+    Some(match name {
+        "nbsp" => '\u{a0}',
+        "shy" => '\u{ad}',
+        "ndash" => '–',
+        "mdash" => '—',
+        "lsquo" => '‘',
+        "rsquo" => '’',
+        "ldquo" => '“',
+        "rdquo" => '”',
+        "hellip" => '…',
+        _ => {
+            let reference = alloc::format!("&{name};");
+            let decoded = html_escape::decode_html_entities(&reference);
+            let mut chars = decoded.chars();
+            // Unknown names come back unchanged, which is more than one char
+            match (chars.next(), chars.next()) {
+                (Some(c), None) => c,
+                _ => return None,
+            }
+        }
+    })
 }
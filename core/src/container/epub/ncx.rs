@@ -1,7 +1,7 @@
 use super::error::EpubError;
 use embedded_xml as xml;
 
-use alloc::{borrow::ToOwned, string::{String, ToString}, vec::Vec};
+use alloc::{borrow::ToOwned, string::String, vec::Vec};
 use log::{info, trace};
 
 pub struct TableOfContents {
@@ -25,6 +25,10 @@ pub fn parse(
                 let nav_map = parse_nav_map(&mut parser, file_resolver)?;
                 return Ok(TableOfContents { nav_map });
             }
+            // Metadata and the document title/author aren't used.
+            xml::Event::StartElement { name: "head" | "docTitle" | "docAuthor", .. } => {
+                parser.skip_element()?;
+            }
             xml::Event::EndOfFile => break,
             _ => {}
         }
@@ -100,8 +104,9 @@ fn parse_nav_map(
                 let xml::Event::Text { content } = parser.next_event()? else {
                     return Err(EpubError::InvalidData);
                 };
-                let content = super::decode_html_entities(&content);
-                label = Some(content.to_string());
+                let mut decoded = String::new();
+                super::decode_text(content, xml::Whitespace::Preserve, &mut decoded);
+                label = Some(decoded);
                 let xml::Event::EndElement { name: "text" } = parser.next_event()? else {
                     return Err(EpubError::InvalidData);
                 };
@@ -1,7 +1,7 @@
 use alloc::{
     borrow::ToOwned,
     collections::btree_map::BTreeMap,
-    string::{String, ToString},
+    string::String,
     vec::Vec,
 };
 use log::{error, info};
@@ -12,6 +12,7 @@ use crate::{
         error::{EpubError, RequiredFileTypes},
     }},
     fs::File,
+    heap,
     zip::ZipEntryReader,
 };
 use embedded_xml as xml;
@@ -94,6 +95,7 @@ pub fn parse(file: &mut impl File, file_resolver: FileResolver, rootfile: &str)
         }
     }
     drop(parser);
+    drop(reader);
 
     let cover = metadata
         .as_ref()
@@ -101,30 +103,18 @@ pub fn parse(file: &mut impl File, file_resolver: FileResolver, rootfile: &str)
         .and_then(|cover_id| manifest.get(cover_id))
         .map(|item| item.file_idx);
 
-    let stylesheet = manifest
-    .iter().filter(|(_, item)| item.media_type == MediaType::Css)
-    .fold(css::Stylesheet::default(), |mut sheet, (_, item)| {
-        let Some(entry) = file_resolver.entry(item.file_idx) else {
-            return sheet;
-        };
-
-        let Ok(reader) = ZipEntryReader::new(file, entry) else {
-            log::error!("Failed to read stylesheet entry: {}", entry.name);
-            return sheet;
-        };
-        let Some(text) = reader.read_to_end().ok().and_then(|bytes| String::from_utf8(bytes).ok()) else {
-            log::error!("Failed to read stylesheet content: {}", entry.name);
-            return sheet;
-        };
-        sheet.extend_from_sheet(&text);
-        sheet
-    });
+    let stylesheets = manifest
+        .values()
+        .filter(|item| item.media_type == MediaType::Css)
+        .map(|item| item.file_idx)
+        .collect();
 
     drop(manifest);
 
     let toc = if let Some(entry) = ncx_toc_entry {
         if let Some(entry) = file_resolver.entry(entry) {
             let mut reader = ZipEntryReader::new(file, entry)?;
+            let _scope = heap::scope(heap::Tag::Toc);
             match super::ncx::parse(&mut reader, entry.size as _, &file_resolver) {
                 Ok(toc) => Some(toc),
                 Err(e) => {
@@ -147,7 +137,8 @@ pub fn parse(file: &mut impl File, file_resolver: FileResolver, rootfile: &str)
         metadata: metadata.ok_or(EpubError::InvalidData)?,
         toc,
         cover,
-        stylesheet,
+        stylesheets,
+        stylesheet: css::Stylesheet::default(),
     };
     Ok(epub)
 }
@@ -165,15 +156,17 @@ fn parse_metadata(parser: &mut xml::OwnedReader) -> Result<Metadata> {
                 let xml::Event::Text { content } = parser.next_event()? else {
                     return Err(EpubError::InvalidData);
                 };
-                let content = super::decode_html_entities(&content);
-                title = Some(content.to_string());
+                let mut decoded = String::new();
+                super::decode_text(content, xml::Whitespace::Preserve, &mut decoded);
+                title = Some(decoded);
             }
             xml::Event::StartElement { name: "dc:creator", .. } => {
                 let xml::Event::Text { content } = parser.next_event()? else {
                     return Err(EpubError::InvalidData);
                 };
-                let content = super::decode_html_entities(&content);
-                author = Some(content.to_string());
+                let mut decoded = String::new();
+                super::decode_text(content, xml::Whitespace::Preserve, &mut decoded);
+                author = Some(decoded);
             }
             xml::Event::StartElement { name: "dc:language", .. } => {
                 let xml::Event::Text { content } = parser.next_event()? else {
@@ -185,9 +178,7 @@ fn parse_metadata(parser: &mut xml::OwnedReader) -> Result<Metadata> {
                 language = hypher::Lang::from_iso(code);
             }
             xml::Event::StartElement { name: "meta", attrs } => {
-                if attrs.get("name") == Some("cover")
-                    && let Some(content) = attrs.get("content")
-                {
+                if let [Some("cover"), Some(content)] = attrs.extract(["name", "content"]) {
                     cover_id = Some(content.to_owned());
                 }
             }
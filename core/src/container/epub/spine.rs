@@ -10,6 +10,7 @@ use crate::{
         css,
     },
     layout,
+    pool,
     res::font,
 };
 use embedded_xml as xml;
@@ -50,7 +51,9 @@ pub fn parse<R: embedded_io::Read>(
     file_resolver: Option<SpineFileResolver>,
 ) -> super::Result<Chapter> {
     // TODO: Ensure this is XHTML here or while parsing?
-    let mut parser = xml::Reader::new(&mut reader, size as _, 8096)?;
+    let mut buffer = pool::buffer(8096);
+    let mut parser = xml::Reader::new_borrowed(&mut reader, size as _, &mut buffer)?;
+    parser.validate_on_read()?;
 
     let mut paragraphs = alloc::vec![];
     let mut inline_stylesheet = css::Stylesheet::default();
@@ -76,11 +79,11 @@ pub fn parse<R: embedded_io::Read>(
         }
     }
 
-    Ok(Chapter { title, paragraphs })
+    Ok(Chapter { title, paragraphs, palette: Default::default() })
 }
 
 fn parse_head(
-    reader: &mut xml::OwnedReader,
+    reader: &mut xml::BorrowedReader,
 ) -> super::Result<css::Stylesheet> {
     let mut stylesheet = css::Stylesheet::default();
 
@@ -98,6 +101,8 @@ fn parse_head(
                 };
                 stylesheet.extend_from_sheet(content);
             }
+            // Titles, metadata and scripts never end up on the page.
+            xml::Event::StartElement { .. } => reader.skip_element()?,
             xml::Event::EndOfFile => break,
             _ => {}
         }
@@ -107,34 +112,50 @@ fn parse_head(
 }
 
 fn parse_body(
-    reader: &mut xml::OwnedReader,
+    reader: &mut xml::BorrowedReader,
     inline_stylesheet: css::Stylesheet,
     extern_stylesheet: Option<&css::Stylesheet>,
     file_resolver: Option<SpineFileResolver>,
 ) -> super::Result<Vec<Paragraph>> {
     let mut parser = BodyParser::new();
+    let mut styles = StyleMemo::new(inline_stylesheet, extern_stylesheet);
 
-    fn is_block_element(name: &str) -> bool {
-        matches!(name, "h1" | "h2" | "h3" | "h4" | "h5" | "h6" | "p" | "li")
+    fn is_block_element(tag: Option<u8>) -> bool {
+        matches!(tag, Some(tags::H1..=tags::LI))
     }
-    fn is_italic(name: &str) -> bool {
-        matches!(name, "i" | "em")
+    /// Phrasing elements, whose margins and font size would otherwise apply
+    /// to the whole paragraph around them.
+    fn is_inline_element(tag: Option<u8>, name: &str) -> bool {
+        matches!(tag, Some(tags::B..=tags::BR))
+            || matches!(
+                name,
+                "a" | "abbr" | "big" | "cite" | "code" | "font" | "q" | "s" | "small" | "span" | "strong" | "sub"
+                    | "sup" | "u"
+            )
     }
-    fn is_bold(name: &str) -> bool {
-        matches!(name, "h1" | "h2" | "h3" | "h4" | "h5" | "h6" | "b")
+    fn is_italic(tag: Option<u8>) -> bool {
+        matches!(tag, Some(tags::I | tags::EM))
     }
-    fn is_breaking(name: &str) -> bool {
-        matches!(name, "br" | "tr")
+    fn is_bold(tag: Option<u8>) -> bool {
+        matches!(tag, Some(tags::H1..=tags::H6 | tags::B))
+    }
+    fn is_breaking(tag: Option<u8>) -> bool {
+        matches!(tag, Some(tags::BR | tags::TR))
     }
 
     loop {
-        let event = reader.next_event()?;
+        let (tag, event) = reader.next_tagged(&tags::TABLE)?;
         trace!("XML event: {:?}", event);
         match event {
-            xml::Event::EndElement { name: "body" } => break,
-            xml::Event::StartElement { name, attrs } if name == "img" || name == "image" => {
-                let src_attr = if name == "img" { "src" } else { "xlink:href" };
-                let Some(src) = attrs.get(src_attr) else {
+            xml::Event::EndElement { .. } if tag == Some(tags::BODY) => break,
+            xml::Event::StartElement { name, attrs } if matches!(tag, Some(tags::IMG | tags::IMAGE)) => {
+                let src_attr = if tag == Some(tags::IMG) { "src" } else { "xlink:href" };
+                let [src, id, class, inline_style] = attrs.extract([src_attr, "id", "class", "style"]);
+                let inline_style = inline_style.map(css::Rule::parse).unwrap_or_default();
+                if (inline_style + styles.get(name, id, class)).hidden == Some(true) {
+                    continue;
+                }
+                let Some(src) = src else {
                     continue;
                 };
                 log::info!("Found image with {}: {}", src_attr, src);
@@ -147,30 +168,36 @@ fn parse_body(
                 log::trace!("Resolved image {} to content index: {}", src_attr, idx);
                 parser.push_image(idx, 0, 0);
             }
-            xml::Event::StartElement { name: "hr", .. } => {
+            xml::Event::StartElement { .. } if tag == Some(tags::HR) => {
                 parser.push_hr();
             }
+            xml::Event::StartElement { .. } if matches!(tag, Some(tags::SCRIPT | tags::STYLE)) => {
+                reader.skip_element()?;
+            }
             xml::Event::StartElement { name, attrs } => {
-                if is_block_element(name) {
+                let [id, class, inline_style] = attrs.extract(["id", "class", "style"]);
+                let inline_style = inline_style.map(css::Rule::parse).unwrap_or_default();
+                let style = inline_style + styles.get(name, id, class);
+
+                if style.hidden == Some(true) {
+                    reader.skip_element()?;
+                    continue;
+                }
+
+                if is_block_element(tag) {
                     parser.flush_run();
                 }
+                if style.page_break_before == Some(true) {
+                    parser.push_page_break();
+                }
 
                 parser.increase_depth();
 
-                let id = attrs.get("id");
-                let class = attrs.get("class");
-                let inline_style = attrs.get("style").map(css::Rule::parse).unwrap_or_default();
-                let style = inline_style
-                    + inline_stylesheet.get(name, id, class)
-                    + extern_stylesheet
-                        .map(|s| s.get(name, id, class))
-                        .unwrap_or_default();
-
-                if is_bold(name) {
+                if is_bold(tag) {
                     parser.set_bold(true);
-                } else if is_italic(name) {
+                } else if is_italic(tag) {
                     parser.set_italic(true);
-                } else if is_breaking(name) {
+                } else if is_breaking(tag) {
                     parser.break_line();
                 }
 
@@ -182,21 +209,32 @@ fn parse_body(
                     parser.set_bold(bold);
                     parser.bold_depth = Some(parser.depth);
                 }
+                if style.page_break_after == Some(true) {
+                    parser.page_breaks.push(parser.depth);
+                }
                 if let Some(alignment) = style.alignment {
                     parser.alignment = Some(alignment);
                 }
                 if let Some(indent) = style.indent {
                     parser.indent = Some(indent);
                 }
+                if !is_inline_element(tag, name) {
+                    if let Some(font_scale) = style.font_scale {
+                        parser.set_font_scale(font_scale);
+                    }
+                    if let Some(margin_top) = style.margin_top {
+                        parser.margin_top = Some(margin_top);
+                    }
+                }
             }
-            xml::Event::EndElement { name } => {
-                if is_block_element(name) {
+            xml::Event::EndElement { .. } => {
+                if is_block_element(tag) {
                     parser.flush_run();
                 }
 
-                if parser.bold_depth.is_none() && is_bold(name) {
+                if parser.bold_depth.is_none() && is_bold(tag) {
                     parser.set_bold(false);
-                } else if parser.italic_depth.is_none() && is_italic(name) {
+                } else if parser.italic_depth.is_none() && is_italic(tag) {
                     parser.set_italic(false);
                 }
 
@@ -213,11 +251,94 @@ fn parse_body(
     Ok(parser.into_blocks())
 }
 
+/// Elements `parse_body` treats specially, as ids into [`tags::TABLE`].
+/// Ordered so headings and blocks form ranges.
+mod tags {
+    use embedded_xml as xml;
+
+    pub const H1: u8 = 0;
+    pub const H6: u8 = 5;
+    pub const LI: u8 = 7;
+    pub const B: u8 = 8;
+    pub const I: u8 = 9;
+    pub const EM: u8 = 10;
+    pub const BR: u8 = 11;
+    pub const TR: u8 = 12;
+    pub const IMG: u8 = 13;
+    pub const IMAGE: u8 = 14;
+    pub const HR: u8 = 15;
+    pub const BODY: u8 = 16;
+    pub const SCRIPT: u8 = 17;
+    pub const STYLE: u8 = 18;
+
+    pub const TABLE: xml::TagTable<19> = xml::TagTable::new([
+        "h1", "h2", "h3", "h4", "h5", "h6", "p", "li", "b", "i", "em", "br", "tr", "img", "image", "hr", "body",
+        "script", "style",
+    ]);
+}
+
+/// Memoizes the cascaded stylesheet rule per `(element, id, class)` for one
+/// chapter. Chapters repeat the same few combinations (`<p class="calibre1">`)
+/// thousands of times, so selector matching mostly turns into a lookup.
+struct StyleMemo<'a> {
+    inline_stylesheet: css::Stylesheet,
+    extern_stylesheet: Option<&'a css::Stylesheet>,
+    use_ids: bool,
+    /// Direct-mapped on the key hash; a collision just evicts the old entry.
+    slots: Vec<Option<(u64, css::Rule)>>,
+}
+
+impl<'a> StyleMemo<'a> {
+    const SLOTS: usize = 64;
+
+    fn new(inline_stylesheet: css::Stylesheet, extern_stylesheet: Option<&'a css::Stylesheet>) -> Self {
+        // Ids are unique per element, keying on them would defeat the memo.
+        let use_ids = inline_stylesheet.uses_ids() || extern_stylesheet.is_some_and(|s| s.uses_ids());
+        Self {
+            inline_stylesheet,
+            extern_stylesheet,
+            use_ids,
+            slots: alloc::vec![None; Self::SLOTS],
+        }
+    }
+
+    fn get(&mut self, element: &str, id: Option<&str>, class: Option<&str>) -> css::Rule {
+        let id = id.filter(|_| self.use_ids);
+
+        // FNV-1a, with a separator that can't appear in names
+        let mut key = 0xCBF2_9CE4_8422_2325u64;
+        for part in [element, id.unwrap_or(""), class.unwrap_or("")] {
+            for &b in part.as_bytes().iter().chain(&[0xFF]) {
+                key = (key ^ b as u64).wrapping_mul(0x0000_0100_0000_01B3);
+            }
+        }
+
+        let slot = &mut self.slots[key as usize % Self::SLOTS];
+        if let Some((cached, rule)) = slot
+            && *cached == key
+        {
+            return *rule;
+        }
+
+        let rule = self.inline_stylesheet.get(element, id, class)
+            + self
+                .extern_stylesheet
+                .map(|s| s.get(element, id, class))
+                .unwrap_or_default();
+        *slot = Some((key, rule));
+        rule
+    }
+}
+
 struct BodyParser {
     blocks: Vec<Paragraph>,
     runs: Vec<layout::Run>,
     alignment: Option<layout::Alignment>,
     indent: Option<u16>,
+    margin_top: Option<u16>,
+    /// Font sizes of the enclosing elements as `(depth, percent of the body
+    /// text)`, innermost last.
+    font_scales: Vec<(u8, u8)>,
     current_run: String,
     bold: bool,
     italic: bool,
@@ -225,6 +346,9 @@ struct BodyParser {
     has_trailing_space: bool,
     italic_depth: Option<u8>,
     bold_depth: Option<u8>,
+    /// Depths of the enclosing elements with a page break after them,
+    /// innermost last.
+    page_breaks: Vec<u8>,
 }
 
 impl BodyParser {
@@ -234,6 +358,8 @@ impl BodyParser {
             runs: Vec::new(),
             alignment: None,
             indent: None,
+            margin_top: None,
+            font_scales: Vec::new(),
             current_run: String::new(),
             bold: false,
             italic: false,
@@ -241,6 +367,7 @@ impl BodyParser {
             has_trailing_space: false,
             italic_depth: None,
             bold_depth: None,
+            page_breaks: Vec::new(),
         }
     }
 
@@ -271,9 +398,10 @@ impl BodyParser {
         if !self.current_run.is_empty() {
             let text = core::mem::take(&mut self.current_run);
             self.runs.push(layout::Run {
-                text,
+                content: layout::Content::Text(text),
                 style: self.style(),
                 breaking,
+                hyphens: Default::default(),
             });
         }
     }
@@ -287,16 +415,19 @@ impl BodyParser {
         if !self.runs.is_empty() {
             let mut runs = core::mem::take(&mut self.runs);
             // trim whitespace off the end of the last run
-            if let Some(run) = runs.last_mut() {
-                run.text = run.text.trim_ascii_end().to_string();
+            if let Some(layout::Run { content: layout::Content::Text(text), .. }) = runs.last_mut() {
+                *text = text.trim_ascii_end().to_string();
             }
             self.blocks.push(Paragraph::Text(Text {
                 runs,
                 indent: self.indent,
                 alignment: self.alignment,
+                margin_top: self.margin_top,
+                font_scale: self.font_scales.last().map(|&(_, scale)| scale),
             }));
             self.indent = None;
             self.alignment = None;
+            self.margin_top = None;
         }
     }
 
@@ -310,8 +441,20 @@ impl BodyParser {
         self.blocks.push(Paragraph::Hr);
     }
 
+    fn push_page_break(&mut self) {
+        self.flush_run();
+        // Chapters already start on a fresh page, and two breaks in a row
+        // would produce an empty page.
+        if !matches!(self.blocks.last(), None | Some(Paragraph::PageBreak)) {
+            self.blocks.push(Paragraph::PageBreak);
+        }
+    }
+
     fn into_blocks(mut self) -> Vec<Paragraph> {
         self.flush_run();
+        if matches!(self.blocks.last(), Some(Paragraph::PageBreak)) {
+            self.blocks.pop();
+        }
         self.blocks
     }
 
@@ -325,23 +468,20 @@ impl BodyParser {
             self.current_run.push(' ');
         }
         self.has_trailing_space = text.ends_with(char::is_whitespace);
-        let decoded = super::decode_html_entities(text);
-        let text = decoded
-            .as_ref()
-            .split_whitespace()
-            .fold(String::new(), |mut acc, word| {
-                if !acc.is_empty() {
-                    acc.push(' ');
-                }
-                acc.push_str(word);
-                acc
-            });
-        self.current_run.push_str(&text);
+        super::decode_text(text, xml::Whitespace::Collapse, &mut self.current_run);
         if self.has_trailing_space {
             self.current_run.push(' ');
         }
     }
 
+    /// Set the font size of the current element. Paragraphs have a single
+    /// size, so the text before it ends the previous paragraph.
+    fn set_font_scale(&mut self, font_scale: css::FontScale) {
+        let parent = self.font_scales.last().map_or(100, |&(_, scale)| scale);
+        self.flush_run();
+        self.font_scales.push((self.depth, font_scale.resolve(parent)));
+    }
+
     fn increase_depth(&mut self) {
         self.depth += 1;
     }
@@ -362,6 +502,18 @@ impl BodyParser {
             self.set_bold(false);
             self.bold_depth = None;
         }
+        if let Some(&(font_depth, _)) = self.font_scales.last()
+            && self.depth < font_depth
+        {
+            self.flush_run();
+            self.font_scales.pop();
+        }
+        if let Some(&page_break_depth) = self.page_breaks.last()
+            && self.depth < page_break_depth
+        {
+            self.page_breaks.pop();
+            self.push_page_break();
+        }
     }
 }
 
@@ -370,7 +522,7 @@ impl BodyParser {
 mod test {
     use alloc::string::ToString;
 
-    use crate::{container::book, layout::Run, res::font::FontStyle};
+    use crate::{container::book, layout::{Content, Run}, res::font::FontStyle};
 
     #[test]
     fn inline_styles() {
@@ -385,14 +537,14 @@ mod test {
         assert_eq!(chapter.paragraphs.len(), 1);
         let book::Paragraph::Text(text) = &chapter.paragraphs[0] else { panic!("Expected text block"); };
         let mut runs = text.runs.iter();
-        assert_eq!(runs.next().unwrap(), &Run { text: "Text with ".to_string(), style: FontStyle::Regular, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: "Inline".to_string(), style: FontStyle::Italic, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: " styles ".to_string(), style: FontStyle::Regular, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: "bold".to_string(), style: FontStyle::Bold, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: ", ".to_string(), style: FontStyle::Regular, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: "emphasized".to_string(), style: FontStyle::Italic, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: " or ".to_string(), style: FontStyle::Regular, breaking: false });
-        assert_eq!(runs.next().unwrap(), &Run { text: "italic".to_string(), style: FontStyle::Italic, breaking: false });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text("Text with ".to_string()), style: FontStyle::Regular, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text("Inline".to_string()), style: FontStyle::Italic, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text(" styles ".to_string()), style: FontStyle::Regular, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text("bold".to_string()), style: FontStyle::Bold, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text(", ".to_string()), style: FontStyle::Regular, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text("emphasized".to_string()), style: FontStyle::Italic, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text(" or ".to_string()), style: FontStyle::Regular, breaking: false, hyphens: Default::default() });
+        assert_eq!(runs.next().unwrap(), &Run { content: Content::Text("italic".to_string()), style: FontStyle::Italic, breaking: false, hyphens: Default::default() });
         assert!(runs.next().is_none());
     }
 
@@ -415,7 +567,192 @@ mod test {
         let book::Paragraph::Text(text) = &chapter.paragraphs[0] else { panic!("Expected text block"); };
         assert_eq!(text.runs.len(), 1);
         let run = &text.runs[0];
-        assert_eq!(run.text, "Text with White space before and afterSpans");
+        assert_eq!(run.text(), "Text with White space before and afterSpans");
+    }
+
+    #[test]
+    fn repeated_classes() {
+        let body = r#"
+        <?xml version="1.0" encoding="utf-8"?>
+        <html xmlns="http://www.w3.org/1999/xhtml">
+            <head>
+                <style type="text/css">.calibre1 { font-weight: bold } #title { font-style: italic }</style>
+            </head>
+            <body>
+                <p class="calibre1">One</p>
+                <p class="calibre1">Two</p>
+                <p id="title" class="calibre1">Three</p>
+                <p class="calibre1">Four</p>
+            </body>
+        </html>"#;
+        let chapter = super::parse(None, body.as_bytes(), body.len(), None, None).unwrap();
+        let styles: alloc::vec::Vec<_> = chapter.paragraphs.iter().map(|p| {
+            let book::Paragraph::Text(text) = p else { panic!("Expected text block"); };
+            text.runs[0].style
+        }).collect();
+        assert_eq!(styles, [FontStyle::Bold, FontStyle::Bold, FontStyle::BoldItalic, FontStyle::Bold]);
+    }
+
+    #[test]
+    fn block_styles() {
+        let body = r#"
+        <?xml version="1.0" encoding="utf-8"?>
+        <html xmlns="http://www.w3.org/1999/xhtml">
+            <head>
+                <style type="text/css">
+                    .chapter { page-break-before: always; font-size: 1.5em; margin-top: 2em }
+                    .footnote { display: none }
+                    .end { page-break-after: always }
+                </style>
+            </head>
+            <body>
+                <h1 class="chapter">One</h1>
+                <p>First<span class="footnote">Hidden <b>note</b></span></p>
+                <div class="end"><p>Last</p></div>
+                <h1 class="chapter">Two</h1>
+                <p style="display: none">Gone</p>
+            </body>
+        </html>"#;
+        let chapter = super::parse(None, body.as_bytes(), body.len(), None, None).unwrap();
+        let mut paragraphs = chapter.paragraphs.iter();
+        let Some(book::Paragraph::Text(one)) = paragraphs.next() else { panic!("Expected text block"); };
+        assert_eq!((one.font_scale, one.margin_top), (Some(150), Some(20)));
+        let Some(book::Paragraph::Text(first)) = paragraphs.next() else { panic!("Expected text block"); };
+        assert_eq!(first.runs.len(), 1);
+        assert_eq!(first.runs[0].text(), "First");
+        assert_eq!((first.font_scale, first.margin_top), (None, None));
+        let Some(book::Paragraph::Text(last)) = paragraphs.next() else { panic!("Expected text block"); };
+        assert_eq!(last.runs[0].text(), "Last");
+        // The break after .end and before the second heading collapse into one
+        assert!(matches!(paragraphs.next(), Some(book::Paragraph::PageBreak)));
+        let Some(book::Paragraph::Text(two)) = paragraphs.next() else { panic!("Expected text block"); };
+        assert_eq!(two.runs[0].text(), "Two");
+        assert!(paragraphs.next().is_none());
+    }
+
+    #[test]
+    fn nested_page_breaks() {
+        let body = r#"
+        <?xml version="1.0" encoding="utf-8"?>
+        <html xmlns="http://www.w3.org/1999/xhtml">
+            <head>
+                <style type="text/css">.end { page-break-after: always }</style>
+            </head>
+            <body>
+                <div class="end"><p>One</p><div class="end"><p>Two</p></div><p>Three</p></div>
+                <p>Four</p>
+            </body>
+        </html>"#;
+        let chapter = super::parse(None, body.as_bytes(), body.len(), None, None).unwrap();
+        let paragraphs: alloc::vec::Vec<_> = chapter.paragraphs.iter().map(|p| match p {
+            book::Paragraph::Text(text) => text.runs[0].text(),
+            book::Paragraph::PageBreak => "break",
+            _ => panic!("Expected text or page break"),
+        }).collect();
+        // The outer break survives the inner one
+        assert_eq!(paragraphs, ["One", "Two", "break", "Three", "break", "Four"]);
+    }
+
+    /// Reads and seeks in memory.
+    struct Cursor(alloc::vec::Vec<u8>, usize);
+
+    impl embedded_io::ErrorType for Cursor {
+        type Error = embedded_io::ErrorKind;
+    }
+
+    impl embedded_io::Read for Cursor {
+        fn read(&mut self, buf: &mut [u8]) -> Result<usize, Self::Error> {
+            let data = self.0.get(self.1..).unwrap_or_default();
+            let len = data.len().min(buf.len());
+            buf[..len].copy_from_slice(&data[..len]);
+            self.1 += len;
+            Ok(len)
+        }
+    }
+
+    impl embedded_io::Seek for Cursor {
+        fn seek(&mut self, pos: embedded_io::SeekFrom) -> Result<u64, Self::Error> {
+            self.1 = match pos {
+                embedded_io::SeekFrom::Start(offset) => offset as i64,
+                embedded_io::SeekFrom::End(offset) => self.0.len() as i64 + offset,
+                embedded_io::SeekFrom::Current(offset) => self.1 as i64 + offset,
+            } as usize;
+            Ok(self.1 as u64)
+        }
+    }
+
+    /// A resolver over a zip with only a central directory listing `names`.
+    fn resolver(names: &[&str]) -> super::super::FileResolver {
+        // Padded, the end record is searched for in the last kilobyte
+        let mut zip = alloc::vec![0u8; 1024];
+        let start = zip.len();
+        for name in names {
+            zip.extend(b"PK\x01\x02");
+            zip.extend([0; 24]);
+            zip.extend((name.len() as u16).to_le_bytes());
+            zip.extend([0; 16]);
+            zip.extend(name.as_bytes());
+        }
+        let size = zip.len() - start;
+        zip.extend(b"PK\x05\x06");
+        zip.extend([0; 4]);
+        zip.extend([names.len() as u8, 0, names.len() as u8, 0]);
+        zip.extend((size as u32).to_le_bytes());
+        zip.extend((start as u32).to_le_bytes());
+        zip.extend([0; 2]);
+        let entries = zip::parse_zip(&mut Cursor(zip, 0)).unwrap();
+        super::super::FileResolver { entries, root: "".to_string() }
+    }
+
+    #[test]
+    fn hidden_images() {
+        let body = r#"
+        <?xml version="1.0" encoding="utf-8"?>
+        <html xmlns="http://www.w3.org/1999/xhtml">
+            <head>
+                <style type="text/css">.cover { display: none }</style>
+            </head>
+            <body>
+                <img class="cover" src="shown.png"/>
+                <img src="hidden.png" style="display: none"/>
+                <img src="shown.png"/>
+            </body>
+        </html>"#;
+        let resolver = resolver(&["shown.png", "hidden.png"]);
+        let spine = super::SpineFileResolver { folder: "", file_resolver: &resolver };
+        let chapter = super::parse(None, body.as_bytes(), body.len(), None, Some(spine)).unwrap();
+        assert!(matches!(chapter.paragraphs[..], [book::Paragraph::Image { key: 0, .. }]));
+    }
+
+    #[test]
+    fn font_sizes() {
+        let body = r#"
+        <?xml version="1.0" encoding="utf-8"?>
+        <html xmlns="http://www.w3.org/1999/xhtml">
+            <head>
+                <style type="text/css">
+                    .small { font-size: 80% }
+                    .big { font-size: 1.5rem }
+                    .gap { margin-top: 2em; font-size: 200% }
+                </style>
+            </head>
+            <body>
+                <div class="small"><p class="small">Nested</p>Direct</div>
+                <div class="small"><p class="big">Body</p></div>
+                <p>Plain <span class="gap">span</span> text</p>
+            </body>
+        </html>"#;
+        let chapter = super::parse(None, body.as_bytes(), body.len(), None, None).unwrap();
+        let paragraphs: alloc::vec::Vec<_> = chapter.paragraphs.iter().map(|p| {
+            let book::Paragraph::Text(text) = p else { panic!("Expected text block"); };
+            (text.runs[0].text(), text.font_scale, text.margin_top)
+        }).collect();
+        assert_eq!(paragraphs, [
+            ("Nested", Some(64), None),
+            ("Direct", Some(80), None),
+            ("Body", Some(150), None),
+            ("Plain span text", None, None),
+        ]);
     }
 
     #[test]
@@ -432,6 +769,6 @@ mod test {
         let book::Paragraph::Text(text) = &chapter.paragraphs[0] else { panic!("Expected text block"); };
         assert_eq!(text.runs.len(), 1);
         let run = &text.runs[0];
-        assert_eq!(run.text, "We support \"&amp;\" escaping now!!!");
+        assert_eq!(run.text(), "We support \"&amp;\" escaping now!!!");
     }
 }
@@ -2,6 +2,7 @@ use embedded_io::{Read, Seek};
 
 use crate::{
     container::{jpeg, png},
+    heap,
 };
 
 pub struct DecodedImage {
@@ -53,20 +54,24 @@ impl DecodedImage {
     }
 }
 
+/// Decode an image scaled to fit `max_w`×`max_h`. Working buffers are
+/// carved from `scratch` where possible, see [`crate::pool::carve`].
 pub fn decode<R: Read + Seek>(
     format: Format,
     file: &mut R,
     size: u32,
     max_w: u16,
     max_h: u16,
+    scratch: &mut [u8],
 ) -> Result<DecodedImage, &'static str> {
+    let _scope = heap::scope(heap::Tag::Image);
     match format {
         Format::Jpeg => {
-            let image = jpeg::decode_jpeg_streaming(file, size, max_w, max_h)?;
+            let image = jpeg::decode_jpeg_streaming(file, size, max_w, max_h, scratch)?;
             Ok(image)
         }
         Format::Png => {
-            let image = png::decode_png_from(file, max_w, max_h)?;
+            let image = png::decode_png_from(file, max_w, max_h, scratch)?;
             Ok(image)
         }
     }
@@ -39,6 +39,7 @@ use alloc::vec;
 use alloc::vec::Vec;
 
 use crate::container::image::DecodedImage;
+use crate::pool;
 
 // JPEG marker bytes
 
@@ -309,10 +310,7 @@ pub fn read_jpeg_size<R: embedded_io::Read>(
     data_size: u32,
 ) -> Result<(u16, u16), &'static str> {
     let hdr_size = HEADER_READ.min(data_size as usize);
-    let mut hdr = Vec::new();
-    hdr.try_reserve_exact(hdr_size)
-        .map_err(|_| "jpeg: OOM for header")?;
-    hdr.resize(hdr_size, 0);
+    let mut hdr = pool::try_buffer(hdr_size).ok_or("jpeg: OOM for header")?;
     hdr[0..2].copy_from_slice(&[0xFF, M_SOI]);
     reader
         .read_exact(&mut hdr[2..])
@@ -372,19 +370,18 @@ pub fn read_jpeg_size<R: embedded_io::Read>(
 ///
 /// `read_fn(offset, buf)` reads bytes at the given absolute offset and
 /// returns the number of bytes actually read. Progressive JPEGs are
-/// decoded using the first scan only.
+/// decoded using the first scan only. The header and row buffers come
+/// from `scratch` when it is large enough.
 pub fn decode_jpeg_streaming<R: embedded_io::Read + embedded_io::Seek>(
     mut reader: R,
     data_size: u32,
     max_w: u16,
     max_h: u16,
+    scratch: &mut [u8],
 ) -> Result<DecodedImage, &'static str> {
     // read the first portion of the JPEG for marker parsing
     let hdr_size = HEADER_READ.min(data_size as usize);
-    let mut hdr = Vec::new();
-    hdr.try_reserve_exact(hdr_size)
-        .map_err(|_| "jpeg: OOM for header")?;
-    hdr.resize(hdr_size, 0);
+    let mut hdr = pool::carve(&mut &mut *scratch, hdr_size).ok_or("jpeg: OOM for header")?;
     reader
         .read_exact(&mut hdr)
         .map_err(|_| "jpeg: read error for header")?;
@@ -398,7 +395,7 @@ pub fn decode_jpeg_streaming<R: embedded_io::Read + embedded_io::Seek>(
 
     reader.seek(embedded_io::SeekFrom::Start(st.scan_start as u64)).map_err(|_| "jpeg: seek error")?;
 
-    decode_baseline(&st, BitReader::new(&mut reader), max_w, max_h)
+    decode_baseline(&st, BitReader::new(&mut reader), max_w, max_h, scratch)
 }
 
 // baseline decode core (generic over byte source)
@@ -425,6 +422,7 @@ fn decode_baseline(
     mut reader: BitReader<'_>,
     max_w: u16,
     max_h: u16,
+    mut scratch: &mut [u8],
 ) -> Result<DecodedImage, &'static str> {
     let w = st.width as usize;
     let h = st.height as usize;
@@ -470,7 +468,8 @@ fn decode_baseline(
 
     // allocate buffers
 
-    let mut y_row = vec![128u8; row_w * mcu_h];
+    // refilled for every MCU row
+    let mut y_row = pool::carve(&mut scratch, row_w * mcu_h).ok_or("jpeg: OOM for row")?;
     let mut output = Vec::new();
     output
         .try_reserve_exact(out_stride * out_h)
@@ -16,9 +16,10 @@ pub fn from_str(text: &str) -> book::Chapter {
                 font::FontStyle::Regular
             };
             runs.push(layout::Run {
-                text: line.to_string(),
+                content: layout::Content::Text(line.to_string()),
                 style,
                 breaking: true,
+                hyphens: Default::default(),
             })
         }
 
@@ -26,8 +27,10 @@ pub fn from_str(text: &str) -> book::Chapter {
             runs,
             alignment: Some(layout::Alignment::Start),
             indent: Some(0),
+            margin_top: None,
+            font_scale: None,
         }));
     }
 
-    book::Chapter { title: None, paragraphs: blocks }
+    book::Chapter { title: None, paragraphs: blocks, palette: Default::default() }
 }
@@ -9,14 +9,17 @@ pub fn from_str(text: &str) -> book::Chapter {
             runs: p
                 .split("\n")
                 .map(|line| layout::Run {
-                    text: line.to_string(),
+                    content: layout::Content::Text(line.to_string()),
                     style: font::FontStyle::Regular,
                     breaking: true,
+                    hyphens: Default::default(),
                 })
                 .collect(),
             alignment: None,
             indent: None,
+            margin_top: None,
+            font_scale: None,
         }))
         .collect();
-    book::Chapter { title: None, paragraphs: blocks }
+    book::Chapter { title: None, paragraphs: blocks, palette: Default::default() }
 }
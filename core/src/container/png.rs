@@ -18,6 +18,7 @@ use alloc::vec::Vec;
 use embedded_io::{Read, Seek, SeekFrom};
 
 use crate::container::image::DecodedImage;
+use crate::pool;
 
 // PNG constants
 
@@ -84,11 +85,13 @@ pub fn read_png_size<R: Read + Seek>(
 
 /// Core streaming PNG decoder; generic over byte source.
 /// Reads chunks sequentially, feeds IDAT into zlib row-by-row;
-/// never holds the full PNG in RAM.
+/// never holds the full PNG in RAM. The inflate window and row buffers
+/// come from `scratch` when it is large enough.
 pub fn decode_png_from<R: Read + Seek>(
     mut src: R,
     max_w: u16,
     max_h: u16,
+    mut scratch: &mut [u8],
 ) -> Result<DecodedImage, &'static str> {
     // PNG signature
     let mut sig = [0u8; 8];
@@ -192,12 +195,13 @@ pub fn decode_png_from<R: Read + Seek>(
         .map_err(|_| "png: OOM for output bitmap")?;
     output.resize(out_stride * out_h, 0u8);
 
-    let mut prev_row = vec![0u8; scanline_bytes];
-    let mut curr_row = vec![0u8; scanline_bytes];
+    let mut dict = pool::carve(&mut scratch, DICT_SIZE).ok_or("png: OOM for window")?;
+    let mut prev_row = pool::carve(&mut scratch, scanline_bytes).ok_or("png: OOM for rows")?;
+    let mut curr_row = pool::carve(&mut scratch, scanline_bytes).ok_or("png: OOM for rows")?;
     let mut err_cur = vec![0i16; out_w + 2];
     let mut err_nxt = vec![0i16; out_w + 2];
     let row_total = 1 + scanline_bytes;
-    let mut row_buf = vec![0u8; row_total];
+    let mut row_buf = pool::carve(&mut scratch, row_total).ok_or("png: OOM for rows")?;
     let mut row_pos: usize = 0;
 
     // streaming zlib decompressor for IDAT data
@@ -208,7 +212,6 @@ pub fn decode_png_from<R: Read + Seek>(
     }
     let mut decomp =
         unsafe { Box::from_raw(decomp_ptr as *mut miniz_oxide::inflate::core::DecompressorOxide) };
-    let mut dict = vec![0u8; DICT_SIZE];
     let mut dict_pos: usize = 0;
     let mut src_y: usize = 0;
     let mut out_y: usize = 0;
@@ -1,4 +1,4 @@
-use crate::{container::book, layout, res::font};
+use crate::{container::book, layout, pool, res::font};
 use alloc::{string::String, vec::Vec};
 use log::info;
 use core::fmt::Write;
@@ -6,7 +6,8 @@ use embedded_xml as xml;
 
 pub fn from_str(text: &str) -> Option<book::Chapter> {
     let mut data = text.as_bytes();
-    let mut reader = xml::Reader::new(&mut data, text.len() as _, 8096).ok()?;
+    let mut buffer = pool::buffer(8096);
+    let mut reader = xml::Reader::new_borrowed(&mut data, text.len() as _, &mut buffer).ok()?;
 
     let mut depth = 0;
 
@@ -26,9 +27,10 @@ pub fn from_str(text: &str) -> Option<book::Chapter> {
         write!(text, "{event:?}").unwrap();
         info!("XML event: {text:?}");
         runs.push(layout::Run {
-            text,
+            content: layout::Content::Text(text),
             style: font::FontStyle::Regular,
             breaking: true,
+            hyphens: Default::default(),
         });
     }
 
@@ -36,7 +38,9 @@ pub fn from_str(text: &str) -> Option<book::Chapter> {
         runs,
         alignment: Some(layout::Alignment::Start),
         indent: Some(0),
+        margin_top: None,
+        font_scale: None,
     };
     let blocks = alloc::vec![book::Paragraph::Text(paragraph)];
-    Some(book::Chapter { title: None, paragraphs: blocks })
+    Some(book::Chapter { title: None, paragraphs: blocks, palette: Default::default() })
 }
@@ -4,6 +4,10 @@ use embedded_graphics::{
     prelude::{DrawTarget, OriginDimensions, Size},
 };
 
+use core::ops::{Deref, DerefMut};
+
+use crate::trace;
+
 pub const WIDTH: usize = 800;
 pub const HEIGHT: usize = 480;
 pub const BUFFER_SIZE: usize = WIDTH * HEIGHT / 8;
@@ -41,6 +45,9 @@ impl Rotation {
 pub struct DisplayBuffers {
     framebuffer: [[u8; BUFFER_SIZE]; 2],
     active: bool,
+    /// The inactive buffer was written through a [`Scratch`] since the
+    /// last swap and no longer holds the frame on screen.
+    previous_lent: bool,
     pub rotation: Rotation,
 }
 
@@ -56,6 +63,7 @@ impl DisplayBuffers {
         let mut ret = Self {
             framebuffer: [[0; BUFFER_SIZE]; 2],
             active: false,
+            previous_lent: false,
             rotation,
         };
         ret.framebuffer[0].fill(0xFF);
@@ -95,12 +103,30 @@ impl DisplayBuffers {
         }
     }
 
+    /// Whether the inactive buffer still holds the frame on screen, which
+    /// a fast refresh diffs against.
+    pub fn has_previous(&self) -> bool {
+        !self.previous_lent
+    }
+
+    /// Lend the inactive buffer as scratch memory until the next refresh.
+    /// The borrow ends before the buffers can be displayed again, and once
+    /// it has been written to the next refresh can't be a fast one.
+    pub fn scratch(&mut self) -> Scratch<'_> {
+        let index = !self.active as usize;
+        Scratch {
+            buffer: &mut self.framebuffer[index],
+            lent: &mut self.previous_lent,
+        }
+    }
+
     pub fn clear_screen(&mut self, color: u8) {
         self.get_active_buffer_mut().fill(color);
     }
 
     pub fn swap_buffers(&mut self) {
         self.active = !self.active;
+        self.previous_lent = false;
     }
 
     pub fn set_pixel(&mut self, x: i32, y: i32, color: BinaryColor) {
@@ -130,6 +156,7 @@ impl DisplayBuffers {
     }
 
     pub fn blit(&mut self, src: &[u8], w: u16, h: u16, offset_y: u16) {
+        let _span = trace::span(trace::Span::Blit);
         let Size { width, .. } = self.size();
 
         log::info!("Blitting image of size {}x{} to display with rotation {}, offset_y {}", w, h, self.rotation.repr(), offset_y);
@@ -154,6 +181,28 @@ impl DisplayBuffers {
     }
 }
 
+/// The inactive framebuffer, borrowed from [`DisplayBuffers::scratch`].
+/// Reading it is free; the first write gives up the previous frame.
+pub struct Scratch<'a> {
+    buffer: &'a mut [u8; BUFFER_SIZE],
+    lent: &'a mut bool,
+}
+
+impl Deref for Scratch<'_> {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        self.buffer
+    }
+}
+
+impl DerefMut for Scratch<'_> {
+    fn deref_mut(&mut self) -> &mut [u8] {
+        *self.lent = true;
+        self.buffer
+    }
+}
+
 impl OriginDimensions for DisplayBuffers {
     fn size(&self) -> Size {
         self.rotation.size()
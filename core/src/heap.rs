@@ -0,0 +1,234 @@
+//! Heap accounting per subsystem.
+//!
+//! Code marks what it allocates for with [`scope`]. When a
+//! [`TaggingAllocator`] is the global allocator, every allocation is
+//! charged to the innermost scope, tracking live bytes, peak bytes and
+//! the number of allocations. Freeing charges the scope that allocated,
+//! wherever it happens. Without the wrapper a scope costs two stores.
+
+use core::alloc::{GlobalAlloc, Layout};
+use core::sync::atomic::{AtomicU8, AtomicUsize, Ordering};
+
+/// What an allocation is for.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+#[repr(u8)]
+pub enum Tag {
+    /// Anything outside a scope.
+    Other,
+    /// The zip central directory, mostly entry names.
+    Zip,
+    /// Container, OPF and manifest.
+    Epub,
+    /// The NCX table of contents.
+    Toc,
+    /// Stylesheet rules.
+    Css,
+    /// Chapter XHTML, the runs and paragraphs it produces.
+    Spine,
+    /// Decoded images.
+    Image,
+    /// Lines and words while breaking paragraphs.
+    Layout,
+}
+
+impl Tag {
+    pub const ALL: [Tag; 8] = [
+        Tag::Other,
+        Tag::Zip,
+        Tag::Epub,
+        Tag::Toc,
+        Tag::Css,
+        Tag::Spine,
+        Tag::Image,
+        Tag::Layout,
+    ];
+
+    pub fn name(self) -> &'static str {
+        match self {
+            Tag::Other => "other",
+            Tag::Zip => "zip::parse",
+            Tag::Epub => "epub::parse",
+            Tag::Toc => "ncx::parse",
+            Tag::Css => "css::parse",
+            Tag::Spine => "spine::parse",
+            Tag::Image => "image::decode",
+            Tag::Layout => "layout",
+        }
+    }
+
+    fn from_u8(value: u8) -> Self {
+        Self::ALL.get(value as usize).copied().unwrap_or(Tag::Other)
+    }
+}
+
+static CURRENT: AtomicU8 = AtomicU8::new(Tag::Other as u8);
+
+/// Restores the enclosing tag when dropped.
+#[must_use = "the scope ends when the guard is dropped"]
+pub struct Scope {
+    previous: u8,
+}
+
+/// Charge allocations to `tag` until the returned guard goes out of scope.
+pub fn scope(tag: Tag) -> Scope {
+    let previous = CURRENT.load(Ordering::Relaxed);
+    CURRENT.store(tag as u8, Ordering::Relaxed);
+    Scope { previous }
+}
+
+impl Drop for Scope {
+    fn drop(&mut self) {
+        CURRENT.store(self.previous, Ordering::Relaxed);
+    }
+}
+
+#[derive(Clone, Copy, Debug, Default)]
+pub struct Stats {
+    /// Bytes currently allocated.
+    pub live: usize,
+    /// Most bytes allocated at once since the last [`reset`].
+    pub peak: usize,
+    /// Allocations and reallocations since the last [`reset`].
+    pub count: usize,
+}
+
+struct Counters {
+    live: AtomicUsize,
+    peak: AtomicUsize,
+    count: AtomicUsize,
+}
+
+impl Counters {
+    const fn new() -> Self {
+        Self {
+            live: AtomicUsize::new(0),
+            peak: AtomicUsize::new(0),
+            count: AtomicUsize::new(0),
+        }
+    }
+}
+
+static COUNTERS: [Counters; Tag::ALL.len()] = [const { Counters::new() }; Tag::ALL.len()];
+
+/// Add to a counter, returning the new value. The ESP32-C3 has no atomic
+/// read-modify-write, but it has a single core that only allocates from
+/// tasks, so a load and a store suffice there.
+fn add(counter: &AtomicUsize, value: usize) -> usize {
+    #[cfg(target_has_atomic = "ptr")]
+    let new = counter.fetch_add(value, Ordering::Relaxed).wrapping_add(value);
+    #[cfg(not(target_has_atomic = "ptr"))]
+    let new = {
+        let new = counter.load(Ordering::Relaxed).wrapping_add(value);
+        counter.store(new, Ordering::Relaxed);
+        new
+    };
+    new
+}
+
+fn charge(tag: u8, size: usize) {
+    let counters = &COUNTERS[Tag::from_u8(tag) as usize];
+    let live = add(&counters.live, size);
+    add(&counters.count, 1);
+    if live > counters.peak.load(Ordering::Relaxed) {
+        counters.peak.store(live, Ordering::Relaxed);
+    }
+}
+
+fn release(tag: u8, size: usize) {
+    add(&COUNTERS[Tag::from_u8(tag) as usize].live, size.wrapping_neg());
+}
+
+/// The counters of every tag.
+pub fn stats() -> impl Iterator<Item = (Tag, Stats)> {
+    Tag::ALL.into_iter().map(|tag| {
+        let counters = &COUNTERS[tag as usize];
+        let stats = Stats {
+            live: counters.live.load(Ordering::Relaxed),
+            peak: counters.peak.load(Ordering::Relaxed),
+            count: counters.count.load(Ordering::Relaxed),
+        };
+        (tag, stats)
+    })
+}
+
+/// Total allocations and reallocations across all tags.
+pub fn allocations() -> usize {
+    stats().map(|(_, stats)| stats.count).sum()
+}
+
+/// Start a new measurement: peaks drop to the live bytes and counts to zero.
+pub fn reset() {
+    for counters in &COUNTERS {
+        counters.peak.store(counters.live.load(Ordering::Relaxed), Ordering::Relaxed);
+        counters.count.store(0, Ordering::Relaxed);
+    }
+}
+
+/// Wraps an allocator to attribute its allocations to the current
+/// [`scope`]. Each block gets one trailing byte recording its tag.
+pub struct TaggingAllocator<A> {
+    inner: A,
+}
+
+impl<A> TaggingAllocator<A> {
+    pub const fn new(inner: A) -> Self {
+        Self { inner }
+    }
+}
+
+/// The layout with room for the tag after `size` bytes.
+fn tagged(size: usize, align: usize) -> Option<Layout> {
+    Layout::from_size_align(size.checked_add(1)?, align).ok()
+}
+
+unsafe impl<A: GlobalAlloc> GlobalAlloc for TaggingAllocator<A> {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        let Some(tagged) = tagged(layout.size(), layout.align()) else {
+            return core::ptr::null_mut();
+        };
+        let ptr = unsafe { self.inner.alloc(tagged) };
+        if !ptr.is_null() {
+            let tag = CURRENT.load(Ordering::Relaxed);
+            unsafe { ptr.add(layout.size()).write(tag) };
+            charge(tag, layout.size());
+        }
+        ptr
+    }
+
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        let Some(tagged) = tagged(layout.size(), layout.align()) else {
+            return core::ptr::null_mut();
+        };
+        let ptr = unsafe { self.inner.alloc_zeroed(tagged) };
+        if !ptr.is_null() {
+            let tag = CURRENT.load(Ordering::Relaxed);
+            unsafe { ptr.add(layout.size()).write(tag) };
+            charge(tag, layout.size());
+        }
+        ptr
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        let tag = unsafe { ptr.add(layout.size()).read() };
+        release(tag, layout.size());
+        // Allocating checked that the tagged layout is valid
+        let tagged = unsafe { Layout::from_size_align_unchecked(layout.size() + 1, layout.align()) };
+        unsafe { self.inner.dealloc(ptr, tagged) }
+    }
+
+    /// The block stays charged to whoever allocated it.
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        if tagged(new_size, layout.align()).is_none() {
+            return core::ptr::null_mut();
+        }
+        let tag = unsafe { ptr.add(layout.size()).read() };
+        let tagged = unsafe { Layout::from_size_align_unchecked(layout.size() + 1, layout.align()) };
+        let new = unsafe { self.inner.realloc(ptr, tagged, new_size + 1) };
+        if !new.is_null() {
+            unsafe { new.add(new_size).write(tag) };
+            release(tag, layout.size());
+            charge(tag, new_size);
+        }
+        new
+    }
+}
@@ -1,6 +1,7 @@
 use alloc::{string::String, vec::Vec};
 
 use crate::res::font;
+use crate::{heap, trace};
 
 #[derive(Clone, Copy)]
 pub struct Options {
@@ -50,7 +51,7 @@ impl Alignment {
 }
 
 pub struct Text<'a> {
-    pub text: &'a str,
+    pub glyphs: font::Glyphs<'a>,
     pub x: u16,
     pub style: font::FontStyle,
 }
@@ -75,17 +76,127 @@ pub enum Block<'a> {
 /// Input for layouting.
 #[derive(Debug, PartialEq, Eq)]
 pub struct Run {
-    pub text: String,
+    pub content: Content,
     pub style: font::FontStyle,
     pub breaking: bool,
+    pub hyphens: Hyphens,
+}
+
+/// The characters of a run.
+#[derive(Debug, PartialEq, Eq)]
+pub enum Content {
+    /// UTF-8 text as parsed.
+    Text(String),
+    /// One entry of the chapter's [`font::Palette`] per character, written
+    /// over the text's buffer by [`Run::prepare`].
+    Glyphs(Vec<u8>),
+    /// The glyph ids, for runs with glyphs beyond their style's 256
+    /// palette entries.
+    Glyphs16(Vec<font::GlyphId>),
+}
+
+impl Content {
+    /// Bytes allocated for the characters.
+    pub fn heap_size(&self) -> usize {
+        match self {
+            Content::Text(text) => text.capacity(),
+            Content::Glyphs(glyphs) => glyphs.capacity(),
+            Content::Glyphs16(glyphs) => glyphs.capacity() * core::mem::size_of::<font::GlyphId>(),
+        }
+    }
+}
+
+impl Run {
+    /// The text, empty once prepared.
+    pub fn text(&self) -> &str {
+        match &self.content {
+            Content::Text(text) => text,
+            Content::Glyphs(_) | Content::Glyphs16(_) => "",
+        }
+    }
+
+    /// The glyphs, empty until prepared.
+    pub fn glyphs(&self) -> font::Glyphs<'_> {
+        match &self.content {
+            Content::Text(_) => font::Glyphs::Palette(&[]),
+            Content::Glyphs(glyphs) => font::Glyphs::Palette(glyphs),
+            Content::Glyphs16(glyphs) => font::Glyphs::Ids(glyphs),
+        }
+    }
+
+    /// Precompute the hyphenation points and glyphs, so laying out and
+    /// drawing never have to look at the text.
+    pub fn prepare(&mut self, font: font::Font, language: hypher::Lang, palette: &mut font::Palette) {
+        let Content::Text(text) = &mut self.content else {
+            return;
+        };
+        let text = core::mem::take(text);
+        self.hyphens = Hyphens::new(&text, language);
+        self.content = match palette.resolve(font, self.style, text, |index| self.hyphens.get(index)) {
+            font::Resolved::Palette(glyphs) => Content::Glyphs(glyphs),
+            font::Resolved::Ids(glyphs) => Content::Glyphs16(glyphs),
+        };
+    }
+}
+
+/// Hyphenation opportunities of a run, one bit per character of its text.
+/// A set bit allows breaking the word before that character.
+///
+/// Computed once per chapter so line breaking never has to call into
+/// `hypher`. Runs without any opportunity don't allocate.
+#[derive(Default, Debug, Clone, PartialEq, Eq)]
+pub struct Hyphens(Vec<u8>);
+
+impl Hyphens {
+    pub fn new(text: &str, language: hypher::Lang) -> Self {
+        let mut bits = Vec::new();
+        // Characters before the byte offset `counted`
+        let (mut counted, mut chars) = (0, 0);
+        for word in text.split_whitespace() {
+            let Some((prefix, main)) = trim_to_alphanumeric(word) else {
+                continue;
+            };
+            if main.len() < 5 {
+                continue;
+            }
+            let start = word.as_ptr() as usize - text.as_ptr() as usize;
+            chars += text[counted..start].chars().count();
+            counted = start;
+            let mut offset = chars + word[..prefix].chars().count();
+            let mut parts = hypher::hyphenate(main, language).peekable();
+            while let Some(part) = parts.next() {
+                offset += part.chars().count();
+                if parts.peek().is_none() {
+                    break;
+                }
+                if bits.is_empty() {
+                    bits.resize(text.len().div_ceil(8), 0);
+                }
+                bits[offset / 8] |= 1 << (offset % 8);
+            }
+        }
+        Self(bits)
+    }
+
+    /// Bytes allocated for the bits.
+    pub fn heap_size(&self) -> usize {
+        self.0.capacity()
+    }
+
+    fn get(&self, offset: usize) -> bool {
+        self.0.get(offset / 8).is_some_and(|b| b & (1 << (offset % 8)) != 0)
+    }
 }
 
 pub fn layout_text<'a>(
     options: Options,
     alignment: Alignment,
     indent: u16,
-    runs: &'a [Run]
+    runs: &'a [Run],
+    palette: &font::Palette,
 ) -> Vec<Line<'a>> {
+    let _span = trace::span(trace::Span::LayoutText);
+    let _scope = heap::scope(heap::Tag::Layout);
     let mut x = indent;
     let mut lines: Vec<Line> = Vec::new();
     let mut current_line = Line {
@@ -94,48 +205,10 @@ pub fn layout_text<'a>(
     };
 
     for run in runs {
-        let font = options.font.definition(run.style);
-
-        // keep the spaces on newlines
-        if current_line.words.is_empty() {
-            run.text.chars().take_while(|c| c.is_whitespace()).for_each(|c| {
-                if let Some(width) = font.char_width(c) {
-                    x += width as u16;
-                }
-            });
-        }
-
-        for mut word in run.text.split_whitespace() {
-            let mut word_width = font.word_width(word);
-
-            // advance to the next line
-            if x + options.space_width + word_width >= options.width {
-                if let Some((remaining, remaining_width)) =
-                    hyphenate(x, word, &mut current_line, options, run.style)
-                {
-                    word = remaining;
-                    word_width = font.word_width(word);
-                    x = options.width - remaining_width;
-                }
-
-                let space = options.width.saturating_sub(x);
-                align(alignment, space, &mut current_line.words);
-                lines.push(current_line);
-                x = 0;
-                current_line = Line {
-                    words: Vec::new(),
-                    hyphenated: false,
-                };
-            }
-
-            // add space before the word
-            if !current_line.words.is_empty() {
-                x += options.space_width;
-            }
-
-            // Add word to current line
-            current_line.words.push(Text { text: word, x, style: run.style });
-            x += word_width;
+        match &run.content {
+            Content::Text(_) => {}
+            Content::Glyphs(glyphs) => layout_run(glyphs, run, &mut x, &mut current_line, &mut lines, options, alignment, palette),
+            Content::Glyphs16(glyphs) => layout_run(glyphs, run, &mut x, &mut current_line, &mut lines, options, alignment, palette),
         }
 
         if run.breaking {
@@ -160,6 +233,64 @@ pub fn layout_text<'a>(
     lines
 }
 
+/// Breaks the words of one run into lines, continuing `current_line` at `x`.
+fn layout_run<'a, G: font::PreparedGlyph>(
+    glyphs: &'a [G],
+    run: &'a Run,
+    x: &mut u16,
+    current_line: &mut Line<'a>,
+    lines: &mut Vec<Line<'a>>,
+    options: Options,
+    alignment: Alignment,
+    palette: &font::Palette,
+) {
+    let is_space = |glyph: &G| glyph.id(palette, run.style).is_space();
+    let width = |glyphs: &[G]| options.font.width(run.style, G::slice(glyphs), palette);
+
+    // keep the spaces on newlines
+    if current_line.words.is_empty() {
+        let leading = glyphs.iter().take_while(|&glyph| is_space(glyph)).count();
+        *x += width(&glyphs[..leading]);
+    }
+
+    let words = glyphs.split(is_space).filter(|word| !word.is_empty());
+    for mut word in words {
+        let mut word_width = width(word);
+
+        // advance to the next line
+        if *x + options.space_width + word_width >= options.width {
+            let offset = (word.as_ptr() as usize - glyphs.as_ptr() as usize) / core::mem::size_of::<G>();
+            if let Some((remaining, remaining_width)) =
+                hyphenate(*x, word, &run.hyphens, offset, current_line, options, run.style, palette)
+            {
+                word = remaining;
+                word_width = width(word);
+                *x = options.width - remaining_width;
+            }
+
+            let space = options.width.saturating_sub(*x);
+            align(alignment, space, &mut current_line.words);
+            lines.push(core::mem::replace(
+                current_line,
+                Line {
+                    words: Vec::new(),
+                    hyphenated: false,
+                },
+            ));
+            *x = 0;
+        }
+
+        // add space before the word
+        if !current_line.words.is_empty() {
+            *x += options.space_width;
+        }
+
+        // Add word to current line
+        current_line.words.push(Text { glyphs: G::slice(word), x: *x, style: run.style });
+        *x += word_width;
+    }
+}
+
 /// Trims non-alphanumeric prefix and suffix 
 fn trim_to_alphanumeric(word: &str) -> Option<(usize, &str)> {
     let prefix = word.find(|c: char| c.is_alphanumeric())?;
@@ -172,32 +303,49 @@ fn trim_to_alphanumeric(word: &str) -> Option<(usize, &str)> {
 }
 
 /// Greedily hyphenate the given word to fit in the remaining space.
-fn hyphenate<'a>(
+///
+/// `offset` is the position of `word` in the run `hyphens` was computed for.
+fn hyphenate<'a, G: font::PreparedGlyph>(
     mut x: u16,
-    word: &'a str,
+    word: &'a [G],
+    hyphens: &Hyphens,
+    offset: usize,
     current_line: &mut Line<'a>,
     options: Options,
     style: font::FontStyle,
-) -> Option<(&'a str, u16)> {
-    let (prefix_byte_len, main) = trim_to_alphanumeric(word)?;
-    if main.len() < 5 {
+    palette: &font::Palette,
+) -> Option<(&'a [G], u16)> {
+    // Trim non-alphanumeric prefix and suffix, keeping ligatures whole
+    let codepoint = |glyph: G| options.font.codepoint(style, glyph.id(palette, style));
+    let width = |glyphs: &[G]| options.font.width(style, G::slice(glyphs), palette);
+    let alphanumeric = |&glyph: &G| {
+        glyph.id(palette, style) == font::GlyphId::JOINED
+            || codepoint(glyph).and_then(char::from_u32).is_some_and(char::is_alphanumeric)
+    };
+    let prefix = word.iter().position(alphanumeric)?;
+    let end = word.iter().rposition(alphanumeric)? + 1;
+    let main = &word[prefix..end];
+    let offset = offset + prefix;
+    if !(1..main.len()).any(|i| hyphens.get(offset + i)) {
         return None;
     }
 
-    let font = options.font.definition(style);
     let space_width = options.space_width;
     let dash_width = options.dash_width;
     let mut space = options.width.saturating_sub(x + space_width + dash_width);
-    if prefix_byte_len > 0 {
-        space = space.saturating_sub(font.word_width(&word[0..prefix_byte_len]));
+    if prefix > 0 {
+        space = space.saturating_sub(width(&word[..prefix]));
     }
     if space == 0 {
         return None;
     }
 
     let mut length = 0;
-    for part in hypher::hyphenate(main, options.language) {
-        let part_width = font.word_width(part);
+    let parts = (1..=main.len())
+        .filter(|&i| i == main.len() || hyphens.get(offset + i))
+        .scan(0, |start, end| Some(&main[core::mem::replace(start, end)..end]));
+    for part in parts {
+        let part_width = width(part);
         if part_width > space {
             if length == 0 {
                 return None;
@@ -208,13 +356,13 @@ fn hyphenate<'a>(
                 x += options.space_width;
             }
 
-            let text = &word[0..length + prefix_byte_len];
-            if text.chars().last() != Some('-') {
+            let glyphs = &word[..length + prefix];
+            if glyphs.last().and_then(|&glyph| codepoint(glyph)) != Some('-' as u32) {
                 current_line.hyphenated = true;
             }
-            current_line.words.push(Text { text, x, style });
-            let remaining = &word[length + prefix_byte_len..];
-            log::trace!("Hyphenating word '{word}' from '{main}' into '{text}' and '{remaining}'");
+            current_line.words.push(Text { glyphs: G::slice(glyphs), x, style });
+            let remaining = &word[length + prefix..];
+            log::trace!("Hyphenating a word of {} glyphs after {}", word.len(), glyphs.len());
             return Some((remaining, space));
         }
 
@@ -271,6 +419,27 @@ fn align(alignment: Alignment, space: u16, words: &mut [Text]) {
 
 #[cfg(test)]
 mod tests {
+    #[test]
+    fn hyphens_roundtrip() {
+        let text = "\u{201C}Hyphenation\" of it";
+        let hyphens = super::Hyphens::new(text, hypher::Lang::English);
+        let chars: alloc::vec::Vec<char> = text.chars().collect();
+        let mut parts = alloc::vec::Vec::new();
+        let mut start = 0;
+        for i in 1..=chars.len() {
+            if i == chars.len() || hyphens.get(i) {
+                parts.push(chars[start..i].iter().collect::<alloc::string::String>());
+                start = i;
+            }
+        }
+        // Breaks are only inside the long word, never around the quotes
+        let mut expected: alloc::vec::Vec<alloc::string::String> = hypher::hyphenate("Hyphenation", hypher::Lang::English).map(Into::into).collect();
+        expected[0].insert(0, '\u{201C}');
+        expected.last_mut().unwrap().push_str("\" of it");
+        assert_eq!(parts, expected);
+        assert!(super::Hyphens::new("tiny bits only", hypher::Lang::English).0.is_empty());
+    }
+
     #[test]
     fn test_trim() {
         use super::trim_to_alphanumeric as trim;
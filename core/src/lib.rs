@@ -9,9 +9,12 @@ pub mod container;
 pub mod display;
 pub mod framebuffer;
 pub mod fs;
+pub mod heap;
 pub mod input;
 pub mod layout;
+pub mod pool;
 pub mod res;
+pub mod trace;
 
 extern crate alloc;
 extern crate embedded_zip as zip;
@@ -0,0 +1,169 @@
+//! Reusable scratch buffers for parsers and decoders.
+//!
+//! Parsing a chapter or decoding an image needs large transient buffers:
+//! the XML read buffer, the JPEG header and the PNG inflate window.
+//! Allocating and freeing them for every chapter leaves holes in the heap
+//! that later large allocations can't fit into. Buffers taken from here
+//! go back into a few retained slots instead, so after the first chapter
+//! the same blocks are reused for the whole session.
+//!
+//! Callers that were lent memory, like the inactive framebuffer, [`carve`]
+//! their buffers from it first and only fall back to the pool.
+
+use alloc::{boxed::Box, vec::Vec};
+use core::ops::{Deref, DerefMut};
+use core::ptr;
+use core::sync::atomic::{AtomicPtr, Ordering};
+
+/// Fixed slots holding boxed values for reuse.
+pub struct Pool<T, const N: usize> {
+    slots: [AtomicPtr<T>; N],
+}
+
+impl<T, const N: usize> Pool<T, N> {
+    pub const fn new() -> Self {
+        Self { slots: [const { AtomicPtr::new(ptr::null_mut()) }; N] }
+    }
+
+    /// Take out the retained value `better` prefers, if any passes `fits`.
+    pub fn take(&self, fits: impl Fn(&T) -> bool, better: impl Fn(&T, &T) -> bool) -> Option<Box<T>> {
+        let mut best: Option<(usize, &T)> = None;
+        for (idx, slot) in self.slots.iter().enumerate() {
+            let Some(value) = (unsafe { slot.load(Ordering::Acquire).as_ref() }) else {
+                continue;
+            };
+            if fits(value) && best.is_none_or(|(_, best)| better(value, best)) {
+                best = Some((idx, value));
+            }
+        }
+        let ptr = take_slot(&self.slots[best?.0]);
+        (!ptr.is_null()).then(|| unsafe { Box::from_raw(ptr) })
+    }
+
+    /// Retain `value` in a free slot, or drop it if all are taken.
+    pub fn put(&self, value: Box<T>) {
+        let Some(slot) = self.slots.iter().find(|slot| slot.load(Ordering::Relaxed).is_null()) else {
+            return;
+        };
+        slot.store(Box::into_raw(value), Ordering::Release);
+    }
+}
+
+/// Empty a slot, returning what it held. The ESP32-C3 has no atomic swap,
+/// but pools are only used from the main task there.
+fn take_slot<T>(slot: &AtomicPtr<T>) -> *mut T {
+    #[cfg(target_has_atomic = "ptr")]
+    let ptr = slot.swap(ptr::null_mut(), Ordering::Acquire);
+    #[cfg(not(target_has_atomic = "ptr"))]
+    let ptr = {
+        let ptr = slot.load(Ordering::Acquire);
+        slot.store(ptr::null_mut(), Ordering::Relaxed);
+        ptr
+    };
+    ptr
+}
+
+/// XML buffer, JPEG header and PNG window can all be alive at once.
+static BUFFERS: Pool<Vec<u8>, 3> = Pool::new();
+
+/// A zeroed scratch buffer that returns to the pool when dropped.
+pub struct Buffer {
+    data: Option<Box<Vec<u8>>>,
+    len: usize,
+}
+
+/// Borrow a zeroed buffer of `len` bytes, reusing the smallest retained
+/// one that is large enough.
+pub fn buffer(len: usize) -> Buffer {
+    reuse(len).unwrap_or_else(|| Buffer { data: Some(Box::new(alloc::vec![0u8; len])), len })
+}
+
+/// Like [`buffer`], but fails instead of aborting when the heap is full.
+pub fn try_buffer(len: usize) -> Option<Buffer> {
+    if let Some(buffer) = reuse(len) {
+        return Some(buffer);
+    }
+    let mut data = Vec::new();
+    data.try_reserve_exact(len).ok()?;
+    data.resize(len, 0);
+    Some(Buffer { data: Some(Box::new(data)), len })
+}
+
+/// Allocate and retain a buffer of `len` bytes up front. Called at boot,
+/// it lands next to the other long-lived blocks instead of between
+/// chapter data. Returns false if the heap can't hold it.
+pub fn reserve(len: usize) -> bool {
+    let mut data = Vec::new();
+    if data.try_reserve_exact(len).is_err() {
+        return false;
+    }
+    data.resize(len, 0);
+    BUFFERS.put(Box::new(data));
+    true
+}
+
+fn reuse(len: usize) -> Option<Buffer> {
+    let mut data = BUFFERS.take(|data| data.len() >= len, |a, b| a.len() < b.len())?;
+    data[..len].fill(0);
+    Some(Buffer { data: Some(data), len })
+}
+
+impl Deref for Buffer {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        &self.data.as_ref().unwrap()[..self.len]
+    }
+}
+
+impl DerefMut for Buffer {
+    fn deref_mut(&mut self) -> &mut [u8] {
+        &mut self.data.as_mut().unwrap()[..self.len]
+    }
+}
+
+impl Drop for Buffer {
+    fn drop(&mut self) {
+        if let Some(data) = self.data.take() {
+            BUFFERS.put(data);
+        }
+    }
+}
+
+/// A zeroed buffer carved from lent memory or, failing that, the pool.
+pub enum Borrowed<'a> {
+    Lent(&'a mut [u8]),
+    Pooled(Buffer),
+}
+
+/// Split `len` bytes off the front of `scratch`, or take a pool buffer if
+/// it is too short. Fails only when the heap is full.
+pub fn carve<'a>(scratch: &mut &'a mut [u8], len: usize) -> Option<Borrowed<'a>> {
+    if scratch.len() < len {
+        return try_buffer(len).map(Borrowed::Pooled);
+    }
+    let (head, tail) = core::mem::take(scratch).split_at_mut(len);
+    *scratch = tail;
+    head.fill(0);
+    Some(Borrowed::Lent(head))
+}
+
+impl Deref for Borrowed<'_> {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        match self {
+            Borrowed::Lent(data) => data,
+            Borrowed::Pooled(buffer) => buffer,
+        }
+    }
+}
+
+impl DerefMut for Borrowed<'_> {
+    fn deref_mut(&mut self) -> &mut [u8] {
+        match self {
+            Borrowed::Lent(data) => data,
+            Borrowed::Pooled(buffer) => buffer,
+        }
+    }
+}
@@ -1,308 +1,526 @@
 // Auto-generated font file
 // Font: Bookerly
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 10072,
+    size: 16215,
     y_advance: 26,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 6, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 8, 4, 21, 2, -1),
-    Glyph::new(0x0022, 0x000B, 10, 8, 9, 1, 10),
-    Glyph::new(0x0023, 0x0014, 17, 16, 17, 0, -2),
-    Glyph::new(0x0024, 0x0036, 17, 12, 26, 2, -5),
-    Glyph::new(0x0025, 0x005D, 26, 23, 21, 1, -2),
-    Glyph::new(0x0026, 0x009A, 21, 20, 20, 1, -1),
-    Glyph::new(0x0027, 0x00CC, 6, 3, 9, 1, 10),
-    Glyph::new(0x0028, 0x00D0, 10, 8, 26, 1, -5),
-    Glyph::new(0x0029, 0x00EA, 10, 9, 26, 0, -5),
-    Glyph::new(0x002A, 0x0108, 10, 9, 9, 0, 10),
-    Glyph::new(0x002B, 0x0113, 17, 12, 12, 2, 3),
-    Glyph::new(0x002C, 0x0125, 8, 6, 9, 0, -5),
-    Glyph::new(0x002D, 0x012C, 10, 8, 3, 1, 5),
-    Glyph::new(0x002E, 0x012F, 8, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x0133, 13, 12, 21, 0, -2),
-    Glyph::new(0x0030, 0x0153, 17, 15, 20, 1, -1),
-    Glyph::new(0x0031, 0x0179, 17, 10, 19, 3, 0),
-    Glyph::new(0x0032, 0x0191, 17, 14, 19, 1, 0),
-    Glyph::new(0x0033, 0x01B3, 17, 12, 20, 2, -1),
-    Glyph::new(0x0034, 0x01D1, 17, 15, 20, 0, -1),
-    Glyph::new(0x0035, 0x01F7, 17, 12, 19, 2, -1),
-    Glyph::new(0x0036, 0x0214, 17, 14, 20, 1, -1),
-    Glyph::new(0x0037, 0x0237, 17, 13, 19, 2, -1),
-    Glyph::new(0x0038, 0x0256, 17, 13, 20, 2, -1),
-    Glyph::new(0x0039, 0x0277, 17, 13, 20, 1, -1),
-    Glyph::new(0x003A, 0x0298, 8, 5, 14, 1, -1),
-    Glyph::new(0x003B, 0x02A1, 8, 6, 18, 0, -5),
-    Glyph::new(0x003C, 0x02AF, 17, 12, 12, 2, 3),
-    Glyph::new(0x003D, 0x02C1, 17, 12, 8, 2, 5),
-    Glyph::new(0x003E, 0x02CD, 17, 12, 12, 2, 3),
-    Glyph::new(0x003F, 0x02DF, 13, 10, 20, 1, -1),
-    Glyph::new(0x0040, 0x02F8, 25, 23, 23, 1, -5),
-    Glyph::new(0x0041, 0x033B, 20, 20, 19, 0, 0),
-    Glyph::new(0x0042, 0x036B, 17, 15, 20, 1, -1),
-    Glyph::new(0x0043, 0x0391, 17, 15, 20, 1, -1),
-    Glyph::new(0x0044, 0x03B7, 20, 18, 20, 1, -1),
-    Glyph::new(0x0045, 0x03E4, 17, 15, 19, 1, 0),
-    Glyph::new(0x0046, 0x0408, 15, 13, 19, 1, 0),
-    Glyph::new(0x0047, 0x0427, 19, 17, 20, 1, -1),
-    Glyph::new(0x0048, 0x0452, 22, 20, 19, 1, 0),
-    Glyph::new(0x0049, 0x0482, 10, 8, 19, 1, 0),
-    Glyph::new(0x004A, 0x0495, 10, 11, 25, -2, -6),
-    Glyph::new(0x004B, 0x04B8, 19, 18, 20, 1, -1),
-    Glyph::new(0x004C, 0x04E5, 16, 15, 19, 1, 0),
-    Glyph::new(0x004D, 0x0509, 24, 23, 19, 0, 0),
-    Glyph::new(0x004E, 0x0540, 22, 20, 20, 1, -1),
-    Glyph::new(0x004F, 0x0572, 21, 19, 20, 1, -1),
-    Glyph::new(0x0050, 0x05A2, 16, 14, 19, 1, 0),
-    Glyph::new(0x0051, 0x05C4, 21, 20, 25, 1, -6),
-    Glyph::new(0x0052, 0x0603, 18, 17, 20, 1, -1),
-    Glyph::new(0x0053, 0x062E, 15, 12, 20, 1, -1),
-    Glyph::new(0x0054, 0x064C, 18, 16, 19, 1, 0),
-    Glyph::new(0x0055, 0x0672, 21, 20, 20, 0, -1),
-    Glyph::new(0x0056, 0x06A4, 20, 19, 20, 0, -1),
-    Glyph::new(0x0057, 0x06D4, 29, 29, 20, 0, -1),
-    Glyph::new(0x0058, 0x071D, 19, 19, 19, 0, 0),
-    Glyph::new(0x0059, 0x074B, 18, 18, 19, 0, 0),
-    Glyph::new(0x005A, 0x0776, 16, 15, 20, 0, -1),
-    Glyph::new(0x005B, 0x079C, 8, 6, 26, 1, -5),
-    Glyph::new(0x005C, 0x07B0, 13, 12, 21, 0, -2),
-    Glyph::new(0x005D, 0x07D0, 8, 6, 26, 1, -5),
-    Glyph::new(0x005E, 0x07E4, 17, 12, 13, 2, 4),
-    Glyph::new(0x005F, 0x07F8, 13, 13, 3, 0, -4),
-    Glyph::new(0x0060, 0x07FD, 18, 7, 7, 5, 15),
-    Glyph::new(0x0061, 0x0804, 15, 14, 15, 1, -1),
-    Glyph::new(0x0062, 0x081F, 16, 16, 22, -1, -1),
-    Glyph::new(0x0063, 0x084B, 14, 12, 15, 1, -1),
-    Glyph::new(0x0064, 0x0862, 17, 16, 22, 1, -1),
-    Glyph::new(0x0065, 0x088E, 14, 12, 15, 1, -1),
-    Glyph::new(0x0066, 0x08A5, 11, 13, 21, 0, 0),
-    Glyph::new(0x0067, 0x08C8, 16, 15, 21, 0, -7),
-    Glyph::new(0x0068, 0x08F0, 18, 17, 21, 0, 0),
-    Glyph::new(0x0069, 0x091D, 9, 9, 20, 0, 0),
-    Glyph::new(0x006A, 0x0934, 8, 8, 27, -2, -7),
-    Glyph::new(0x006B, 0x094F, 16, 16, 22, 0, -1),
-    Glyph::new(0x006C, 0x097B, 9, 9, 21, 0, 0),
-    Glyph::new(0x006D, 0x0993, 26, 26, 14, 0, 0),
-    Glyph::new(0x006E, 0x09C1, 18, 17, 14, 0, 0),
-    Glyph::new(0x006F, 0x09DF, 16, 14, 15, 1, -1),
-    Glyph::new(0x0070, 0x09FA, 16, 15, 20, 0, -6),
-    Glyph::new(0x0071, 0x0A20, 16, 15, 20, 1, -6),
-    Glyph::new(0x0072, 0x0A46, 12, 12, 14, 0, 0),
-    Glyph::new(0x0073, 0x0A5B, 13, 11, 15, 1, -1),
-    Glyph::new(0x0074, 0x0A70, 11, 11, 18, 0, -1),
-    Glyph::new(0x0075, 0x0A89, 17, 17, 15, 0, -1),
-    Glyph::new(0x0076, 0x0AA9, 16, 16, 15, 0, -1),
-    Glyph::new(0x0077, 0x0AC7, 24, 23, 15, 0, -1),
-    Glyph::new(0x0078, 0x0AF3, 16, 16, 14, 0, 0),
-    Glyph::new(0x0079, 0x0B0F, 16, 16, 21, 0, -7),
-    Glyph::new(0x007A, 0x0B39, 14, 13, 15, 0, -1),
-    Glyph::new(0x007B, 0x0B52, 11, 9, 26, 1, -5),
-    Glyph::new(0x007C, 0x0B70, 8, 3, 24, 2, -4),
-    Glyph::new(0x007D, 0x0B79, 11, 9, 26, 0, -5),
-    Glyph::new(0x007E, 0x0B97, 17, 12, 5, 2, 6),
-    Glyph::new(0x00A1, 0x0B9F, 8, 5, 21, 1, -7),
-    Glyph::new(0x00A2, 0x0BAD, 17, 13, 25, 1, -5),
-    Glyph::new(0x00A3, 0x0BD6, 17, 15, 20, 1, -1),
-    Glyph::new(0x00A4, 0x0BFC, 17, 14, 13, 1, 2),
-    Glyph::new(0x00A5, 0x0C13, 17, 18, 18, -1, 0),
-    Glyph::new(0x00A7, 0x0C3C, 14, 12, 21, 1, -3),
-    Glyph::new(0x00A9, 0x0C5C, 21, 20, 20, 0, -1),
-    Glyph::new(0x00AA, 0x0C8E, 12, 10, 13, 1, 6),
-    Glyph::new(0x00AB, 0x0C9F, 14, 14, 11, 0, 1),
-    Glyph::new(0x00AE, 0x0CB3, 16, 15, 15, 0, 6),
-    Glyph::new(0x00B0, 0x0CD0, 14, 10, 10, 2, 9),
-    Glyph::new(0x00B1, 0x0CDD, 17, 12, 16, 2, 0),
-    Glyph::new(0x00B2, 0x0CF5, 12, 10, 13, 1, 9),
-    Glyph::new(0x00B3, 0x0D06, 12, 9, 13, 1, 9),
-    Glyph::new(0x00B5, 0x0D15, 18, 17, 20, 1, -6),
-    Glyph::new(0x00B6, 0x0D40, 15, 14, 23, 0, -4),
-    Glyph::new(0x00B7, 0x0D69, 8, 5, 4, 1, 5),
-    Glyph::new(0x00B9, 0x0D6C, 12, 8, 13, 2, 9),
-    Glyph::new(0x00BA, 0x0D79, 12, 10, 13, 1, 6),
-    Glyph::new(0x00BB, 0x0D8A, 14, 13, 11, 1, 1),
-    Glyph::new(0x00BC, 0x0D9C, 28, 25, 21, 2, -2),
-    Glyph::new(0x00BD, 0x0DDE, 28, 25, 21, 2, -2),
-    Glyph::new(0x00BE, 0x0E20, 28, 26, 21, 1, -2),
-    Glyph::new(0x00BF, 0x0E65, 13, 10, 20, 1, -6),
-    Glyph::new(0x00C0, 0x0E7E, 20, 20, 25, 0, 0),
-    Glyph::new(0x00C1, 0x0EBD, 20, 20, 25, 0, 0),
-    Glyph::new(0x00C2, 0x0EFC, 20, 20, 25, 0, 0),
-    Glyph::new(0x00C3, 0x0F3B, 20, 20, 25, 0, 0),
-    Glyph::new(0x00C4, 0x0F7A, 20, 20, 24, 0, 0),
-    Glyph::new(0x00C5, 0x0FB6, 20, 20, 26, 0, 0),
-    Glyph::new(0x00C6, 0x0FF7, 25, 25, 19, -1, 0),
-    Glyph::new(0x00C7, 0x1033, 17, 15, 26, 1, -7),
-    Glyph::new(0x00C8, 0x1064, 17, 15, 25, 1, 0),
-    Glyph::new(0x00C9, 0x1093, 17, 15, 25, 1, 0),
-    Glyph::new(0x00CA, 0x10C2, 17, 15, 25, 1, 0),
-    Glyph::new(0x00CB, 0x10F1, 17, 15, 24, 1, 0),
-    Glyph::new(0x00CC, 0x111E, 10, 8, 25, 1, 0),
-    Glyph::new(0x00CD, 0x1137, 10, 8, 25, 1, 0),
-    Glyph::new(0x00CE, 0x1150, 10, 10, 25, 0, 0),
-    Glyph::new(0x00CF, 0x1170, 10, 10, 24, 0, 0),
-    Glyph::new(0x00D0, 0x118E, 20, 19, 20, 0, -1),
-    Glyph::new(0x00D1, 0x11BE, 22, 20, 26, 1, -1),
-    Glyph::new(0x00D2, 0x11FF, 21, 19, 26, 1, -1),
-    Glyph::new(0x00D3, 0x123D, 21, 19, 26, 1, -1),
-    Glyph::new(0x00D4, 0x127B, 21, 19, 26, 1, -1),
-    Glyph::new(0x00D5, 0x12B9, 21, 19, 26, 1, -1),
-    Glyph::new(0x00D6, 0x12F7, 21, 19, 25, 1, -1),
-    Glyph::new(0x00D7, 0x1333, 17, 11, 11, 3, 3),
-    Glyph::new(0x00D8, 0x1343, 21, 20, 20, 0, -1),
-    Glyph::new(0x00D9, 0x1375, 21, 20, 26, 0, -1),
-    Glyph::new(0x00DA, 0x13B6, 21, 20, 26, 0, -1),
-    Glyph::new(0x00DB, 0x13F7, 21, 20, 26, 0, -1),
-    Glyph::new(0x00DC, 0x1438, 21, 20, 25, 0, -1),
-    Glyph::new(0x00DE, 0x1477, 17, 14, 19, 1, 0),
-    Glyph::new(0x00DF, 0x1499, 17, 16, 22, 0, -1),
-    Glyph::new(0x00E0, 0x14C5, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E1, 0x14EE, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E2, 0x1517, 15, 14, 22, 1, -1),
-    Glyph::new(0x00E3, 0x153E, 15, 14, 21, 1, -1),
-    Glyph::new(0x00E4, 0x1563, 15, 14, 21, 1, -1),
-    Glyph::new(0x00E5, 0x1588, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E6, 0x15B1, 22, 20, 15, 1, -1),
-    Glyph::new(0x00E7, 0x15D7, 14, 12, 21, 1, -7),
-    Glyph::new(0x00E8, 0x15F7, 14, 12, 23, 1, -1),
-    Glyph::new(0x00E9, 0x161A, 14, 12, 23, 1, -1),
-    Glyph::new(0x00EA, 0x163D, 14, 12, 22, 1, -1),
-    Glyph::new(0x00EB, 0x165E, 14, 12, 21, 1, -1),
-    Glyph::new(0x00EC, 0x167E, 9, 9, 22, 0, 0),
-    Glyph::new(0x00ED, 0x1697, 9, 9, 22, 0, 0),
-    Glyph::new(0x00EE, 0x16B0, 9, 9, 21, 0, 0),
-    Glyph::new(0x00EF, 0x16C8, 9, 10, 20, -1, 0),
-    Glyph::new(0x00F0, 0x16E1, 16, 14, 22, 1, -1),
-    Glyph::new(0x00F1, 0x1708, 18, 17, 20, 0, 0),
-    Glyph::new(0x00F2, 0x1733, 16, 14, 23, 1, -1),
-    Glyph::new(0x00F3, 0x175C, 16, 14, 23, 1, -1),
-    Glyph::new(0x00F4, 0x1785, 16, 14, 22, 1, -1),
-    Glyph::new(0x00F5, 0x17AC, 16, 14, 21, 1, -1),
-    Glyph::new(0x00F6, 0x17D1, 16, 14, 21, 1, -1),
-    Glyph::new(0x00F7, 0x17F6, 17, 12, 13, 2, 2),
-    Glyph::new(0x00F8, 0x180A, 16, 15, 15, 0, -1),
-    Glyph::new(0x00F9, 0x1827, 17, 17, 23, 0, -1),
-    Glyph::new(0x00FA, 0x1858, 17, 17, 23, 0, -1),
-    Glyph::new(0x00FB, 0x1889, 17, 17, 22, 0, -1),
-    Glyph::new(0x00FC, 0x18B8, 17, 17, 21, 0, -1),
-    Glyph::new(0x00FE, 0x18E5, 17, 16, 27, 0, -6),
-    Glyph::new(0x00FF, 0x191B, 16, 16, 27, 0, -7),
-    Glyph::new(0x0104, 0x1951, 20, 20, 25, 0, -6),
-    Glyph::new(0x0105, 0x1990, 15, 14, 20, 1, -6),
-    Glyph::new(0x0106, 0x19B3, 17, 15, 26, 1, -1),
-    Glyph::new(0x0107, 0x19E4, 14, 12, 23, 1, -1),
-    Glyph::new(0x010C, 0x1A07, 17, 15, 26, 1, -1),
-    Glyph::new(0x010D, 0x1A38, 14, 12, 23, 1, -1),
-    Glyph::new(0x010E, 0x1A5B, 20, 18, 26, 1, -1),
-    Glyph::new(0x010F, 0x1A96, 17, 18, 22, 1, -1),
-    Glyph::new(0x0118, 0x1AC8, 17, 15, 25, 1, -6),
-    Glyph::new(0x0119, 0x1AF7, 14, 12, 20, 1, -6),
-    Glyph::new(0x011A, 0x1B15, 17, 15, 25, 1, 0),
-    Glyph::new(0x011B, 0x1B44, 14, 12, 23, 1, -1),
-    Glyph::new(0x0139, 0x1B67, 16, 15, 25, 1, 0),
-    Glyph::new(0x013A, 0x1B96, 9, 9, 27, 0, 0),
-    Glyph::new(0x013D, 0x1BB5, 16, 15, 21, 1, 0),
-    Glyph::new(0x013E, 0x1BDD, 9, 11, 21, 0, 0),
-    Glyph::new(0x0141, 0x1BFA, 16, 17, 19, -1, 0),
-    Glyph::new(0x0142, 0x1C23, 9, 10, 21, -1, 0),
-    Glyph::new(0x0143, 0x1C3E, 22, 20, 26, 1, -1),
-    Glyph::new(0x0144, 0x1C7F, 18, 17, 22, 0, 0),
-    Glyph::new(0x0147, 0x1CAE, 22, 20, 26, 1, -1),
-    Glyph::new(0x0148, 0x1CEF, 18, 17, 22, 0, 0),
-    Glyph::new(0x0152, 0x1D1E, 26, 24, 20, 1, -1),
-    Glyph::new(0x0153, 0x1D5A, 24, 22, 15, 1, -1),
-    Glyph::new(0x0158, 0x1D84, 18, 17, 26, 1, -1),
-    Glyph::new(0x0159, 0x1DBC, 12, 12, 22, 0, 0),
-    Glyph::new(0x015A, 0x1DDD, 15, 12, 26, 1, -1),
-    Glyph::new(0x015B, 0x1E04, 13, 11, 23, 1, -1),
-    Glyph::new(0x0160, 0x1E24, 15, 12, 26, 1, -1),
-    Glyph::new(0x0161, 0x1E4B, 13, 11, 23, 1, -1),
-    Glyph::new(0x0164, 0x1E6B, 18, 16, 25, 1, 0),
-    Glyph::new(0x0165, 0x1E9D, 11, 11, 22, 0, -1),
-    Glyph::new(0x016E, 0x1EBC, 21, 20, 27, 0, -1),
-    Glyph::new(0x016F, 0x1F00, 17, 17, 23, 0, -1),
-    Glyph::new(0x0170, 0x1F31, 21, 20, 27, 0, -1),
-    Glyph::new(0x0171, 0x1F75, 17, 17, 23, 0, -1),
-    Glyph::new(0x0178, 0x1FA6, 18, 18, 24, 0, 0),
-    Glyph::new(0x0179, 0x1FDC, 16, 15, 26, 0, -1),
-    Glyph::new(0x017A, 0x200D, 14, 13, 23, 0, -1),
-    Glyph::new(0x017B, 0x2033, 16, 15, 26, 0, -1),
-    Glyph::new(0x017C, 0x2064, 14, 13, 21, 0, -1),
-    Glyph::new(0x017D, 0x2087, 16, 15, 26, 0, -1),
-    Glyph::new(0x017E, 0x20B8, 14, 13, 23, 0, -1),
-    Glyph::new(0x03C0, 0x20DE, 18, 17, 15, 0, -1),
-    Glyph::new(0x1E9E, 0x20FE, 20, 19, 20, 0, -1),
-    Glyph::new(0x2013, 0x212E, 13, 13, 3, 0, 5),
-    Glyph::new(0x2014, 0x2133, 26, 26, 3, 0, 5),
-    Glyph::new(0x2018, 0x213D, 7, 5, 9, 1, 11),
-    Glyph::new(0x2019, 0x2143, 7, 5, 9, 0, 11),
-    Glyph::new(0x201A, 0x2149, 7, 5, 9, 0, -5),
-    Glyph::new(0x201B, 0x214F, 7, 5, 9, 1, 11),
-    Glyph::new(0x201C, 0x2155, 12, 10, 9, 1, 11),
-    Glyph::new(0x201D, 0x2161, 12, 11, 9, 0, 11),
-    Glyph::new(0x201E, 0x216E, 12, 11, 9, 0, -5),
-    Glyph::new(0x201F, 0x217B, 12, 10, 9, 1, 11),
-    Glyph::new(0x2020, 0x2187, 13, 13, 18, 0, 1),
-    Glyph::new(0x2021, 0x21A5, 13, 13, 21, 0, -2),
-    Glyph::new(0x2022, 0x21C8, 8, 6, 6, 1, 4),
-    Glyph::new(0x2026, 0x21CD, 26, 22, 5, 2, -1),
-    Glyph::new(0x2039, 0x21DB, 9, 8, 11, 0, 1),
-    Glyph::new(0x203A, 0x21E6, 9, 7, 11, 1, 1),
-    Glyph::new(0x2070, 0x21F0, 12, 11, 13, 0, 9),
-    Glyph::new(0x2074, 0x2202, 12, 11, 13, 0, 9),
-    Glyph::new(0x2075, 0x2214, 12, 9, 13, 1, 9),
-    Glyph::new(0x2076, 0x2223, 12, 10, 13, 1, 9),
-    Glyph::new(0x2077, 0x2234, 12, 9, 13, 2, 9),
-    Glyph::new(0x2078, 0x2243, 12, 10, 13, 1, 9),
-    Glyph::new(0x2079, 0x2254, 12, 10, 13, 1, 9),
-    Glyph::new(0x2080, 0x2265, 12, 11, 13, 0, -4),
-    Glyph::new(0x2081, 0x2277, 12, 8, 13, 2, -4),
-    Glyph::new(0x2082, 0x2284, 12, 10, 13, 1, -4),
-    Glyph::new(0x2083, 0x2295, 12, 9, 13, 1, -4),
-    Glyph::new(0x2084, 0x22A4, 12, 11, 13, 0, -4),
-    Glyph::new(0x2085, 0x22B6, 12, 9, 13, 1, -4),
-    Glyph::new(0x2086, 0x22C5, 12, 10, 13, 1, -4),
-    Glyph::new(0x2087, 0x22D6, 12, 9, 13, 2, -4),
-    Glyph::new(0x2088, 0x22E5, 12, 10, 13, 1, -4),
-    Glyph::new(0x2089, 0x22F6, 12, 10, 13, 1, -4),
-    Glyph::new(0x20AC, 0x2307, 17, 16, 20, 0, -1),
-    Glyph::new(0x2122, 0x232F, 22, 20, 10, 1, 9),
-    Glyph::new(0x2153, 0x2348, 28, 24, 21, 2, -2),
-    Glyph::new(0x2154, 0x2387, 28, 25, 21, 1, -2),
-    Glyph::new(0x215B, 0x23C9, 28, 25, 21, 2, -2),
-    Glyph::new(0x215C, 0x240B, 28, 26, 21, 1, -2),
-    Glyph::new(0x215D, 0x2450, 28, 26, 21, 1, -2),
-    Glyph::new(0x215E, 0x2495, 28, 25, 21, 2, -2),
-    Glyph::new(0x2190, 0x24D7, 26, 16, 12, 5, 3),
-    Glyph::new(0x2191, 0x24EF, 26, 12, 18, 7, 0),
-    Glyph::new(0x2192, 0x250A, 26, 16, 12, 5, 3),
-    Glyph::new(0x2193, 0x2522, 26, 12, 18, 7, 0),
-    Glyph::new(0x2194, 0x253D, 26, 16, 12, 5, 3),
-    Glyph::new(0x2195, 0x2555, 26, 12, 18, 7, 0),
-    Glyph::new(0x21D0, 0x2570, 26, 16, 12, 5, 3),
-    Glyph::new(0x21D1, 0x2588, 26, 12, 16, 7, 1),
-    Glyph::new(0x21D2, 0x25A0, 26, 16, 12, 5, 3),
-    Glyph::new(0x21D3, 0x25B8, 26, 12, 16, 7, 1),
-    Glyph::new(0x21D4, 0x25D0, 26, 16, 12, 5, 3),
-    Glyph::new(0x2202, 0x25E8, 17, 13, 22, 2, -1),
-    Glyph::new(0x2206, 0x260C, 18, 17, 19, 0, 0),
-    Glyph::new(0x220F, 0x2635, 22, 20, 24, 1, -5),
-    Glyph::new(0x2211, 0x2671, 16, 16, 24, 0, -5),
-    Glyph::new(0x221A, 0x26A1, 17, 17, 24, 0, -3),
-    Glyph::new(0x221E, 0x26D4, 17, 16, 9, 0, 4),
-    Glyph::new(0x222B, 0x26E6, 17, 14, 27, 1, -6),
-    Glyph::new(0x2260, 0x2716, 17, 12, 12, 2, 3),
-    Glyph::new(0x2264, 0x2728, 17, 12, 16, 2, 0),
-    Glyph::new(0x2265, 0x2740, 17, 12, 16, 2, 0),
+    Glyph::new(0x0022, 0x0020, 10, 8, 9, 1, 10),
+    Glyph::new(0x0023, 0x003A, 17, 16, 17, 0, -2),
+    Glyph::new(0x0024, 0x0077, 17, 12, 26, 2, -5),
+    Glyph::new(0x0025, 0x00C7, 26, 23, 21, 1, -2),
+    Glyph::new(0x0026, 0x0135, 21, 20, 20, 1, -1),
+    Glyph::new(0x0027, 0x018A, 6, 3, 9, 1, 10),
+    Glyph::new(0x0028, 0x0197, 10, 8, 26, 1, -5),
+    Glyph::new(0x0029, 0x01CD, 10, 9, 26, 0, -5),
+    Glyph::new(0x002A, 0x01FB, 10, 9, 9, 0, 10),
+    Glyph::new(0x002B, 0x0215, 17, 12, 12, 2, 3),
+    Glyph::new(0x002C, 0x022F, 8, 6, 9, 0, -5),
+    Glyph::new(0x002D, 0x023E, 10, 8, 3, 1, 5),
+    Glyph::new(0x002E, 0x0248, 8, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x024E, 13, 12, 21, 0, -2),
+    Glyph::new(0x0030, 0x0278, 17, 15, 20, 1, -1),
+    Glyph::new(0x0031, 0x02B6, 17, 10, 19, 3, 0),
+    Glyph::new(0x0032, 0x02DB, 17, 14, 19, 1, 0),
+    Glyph::new(0x0033, 0x0310, 17, 12, 20, 2, -1),
+    Glyph::new(0x0034, 0x033D, 17, 15, 20, 0, -1),
+    Glyph::new(0x0035, 0x0375, 17, 12, 19, 2, -1),
+    Glyph::new(0x0036, 0x03A7, 17, 14, 20, 1, -1),
+    Glyph::new(0x0037, 0x03DE, 17, 13, 19, 2, -1),
+    Glyph::new(0x0038, 0x0413, 17, 13, 20, 2, -1),
+    Glyph::new(0x0039, 0x044F, 17, 13, 20, 1, -1),
+    Glyph::new(0x003A, 0x0486, 8, 5, 14, 1, -1),
+    Glyph::new(0x003B, 0x0495, 8, 6, 18, 0, -5),
+    Glyph::new(0x003C, 0x04AC, 17, 12, 12, 2, 3),
+    Glyph::new(0x003D, 0x04C9, 17, 12, 8, 2, 5),
+    Glyph::new(0x003E, 0x04DD, 17, 12, 12, 2, 3),
+    Glyph::new(0x003F, 0x04F7, 13, 10, 20, 1, -1),
+    Glyph::new(0x0040, 0x0520, 25, 23, 23, 1, -5),
+    Glyph::new(0x0041, 0x0596, 20, 20, 19, 0, 0),
+    Glyph::new(0x0042, 0x05DB, 17, 15, 20, 1, -1),
+    Glyph::new(0x0043, 0x061D, 17, 15, 20, 1, -1),
+    Glyph::new(0x0044, 0x064F, 20, 18, 20, 1, -1),
+    Glyph::new(0x0045, 0x0692, 17, 15, 19, 1, 0),
+    Glyph::new(0x0046, 0x06C9, 15, 13, 19, 1, 0),
+    Glyph::new(0x0047, 0x06FA, 19, 17, 20, 1, -1),
+    Glyph::new(0x0048, 0x073A, 22, 20, 19, 1, 0),
+    Glyph::new(0x0049, 0x0786, 10, 8, 19, 1, 0),
+    Glyph::new(0x004A, 0x07AB, 10, 11, 25, -2, -6),
+    Glyph::new(0x004B, 0x07E1, 19, 18, 20, 1, -1),
+    Glyph::new(0x004C, 0x082B, 16, 15, 19, 1, 0),
+    Glyph::new(0x004D, 0x085E, 24, 23, 19, 0, 0),
+    Glyph::new(0x004E, 0x08C1, 22, 20, 20, 1, -1),
+    Glyph::new(0x004F, 0x0917, 21, 19, 20, 1, -1),
+    Glyph::new(0x0050, 0x0961, 16, 14, 19, 1, 0),
+    Glyph::new(0x0051, 0x099D, 21, 20, 25, 1, -6),
+    Glyph::new(0x0052, 0x09F2, 18, 17, 20, 1, -1),
+    Glyph::new(0x0053, 0x0A3D, 15, 12, 20, 1, -1),
+    Glyph::new(0x0054, 0x0A75, 18, 16, 19, 1, 0),
+    Glyph::new(0x0055, 0x0AA4, 21, 20, 20, 0, -1),
+    Glyph::new(0x0056, 0x0AEE, 20, 19, 20, 0, -1),
+    Glyph::new(0x0057, 0x0B2C, 29, 29, 20, 0, -1),
+    Glyph::new(0x0058, 0x0B9B, 19, 19, 19, 0, 0),
+    Glyph::new(0x0059, 0x0BDA, 18, 18, 19, 0, 0),
+    Glyph::new(0x005A, 0x0C14, 16, 15, 20, 0, -1),
+    Glyph::new(0x005B, 0x0C44, 8, 6, 26, 1, -5),
+    Glyph::new(0x005C, 0x0C63, 13, 12, 21, 0, -2),
+    Glyph::new(0x005D, 0x0C8E, 8, 6, 26, 1, -5),
+    Glyph::new(0x005E, 0x0CAD, 17, 12, 13, 2, 4),
+    Glyph::new(0x005F, 0x0CD0, 13, 13, 3, 0, -4),
+    Glyph::new(0x0060, 0x0CD9, 18, 7, 7, 5, 15),
+    Glyph::new(0x0061, 0x0CE3, 15, 14, 15, 1, -1),
+    Glyph::new(0x0062, 0x0D16, 16, 16, 22, -1, -1),
+    Glyph::new(0x0063, 0x0D59, 14, 12, 15, 1, -1),
+    Glyph::new(0x0064, 0x0D7F, 17, 16, 22, 1, -1),
+    Glyph::new(0x0065, 0x0DC5, 14, 12, 15, 1, -1),
+    Glyph::new(0x0066, 0x0DEF, 11, 13, 21, 0, 0),
+    Glyph::new(0x0067, 0x0E21, 16, 15, 21, 0, -7),
+    Glyph::new(0x0068, 0x0E63, 18, 17, 21, 0, 0),
+    Glyph::new(0x0069, 0x0EA5, 9, 9, 20, 0, 0),
+    Glyph::new(0x006A, 0x0EC8, 8, 8, 27, -2, -7),
+    Glyph::new(0x006B, 0x0EF9, 16, 16, 22, 0, -1),
+    Glyph::new(0x006C, 0x0F3D, 9, 9, 21, 0, 0),
+    Glyph::new(0x006D, 0x0F60, 26, 26, 14, 0, 0),
+    Glyph::new(0x006E, 0x0FAB, 18, 17, 14, 0, 0),
+    Glyph::new(0x006F, 0x0FE0, 16, 14, 15, 1, -1),
+    Glyph::new(0x0070, 0x1012, 16, 15, 20, 0, -6),
+    Glyph::new(0x0071, 0x1056, 16, 15, 20, 1, -6),
+    Glyph::new(0x0072, 0x1098, 12, 12, 14, 0, 0),
+    Glyph::new(0x0073, 0x10BA, 13, 11, 15, 1, -1),
+    Glyph::new(0x0074, 0x10E6, 11, 11, 18, 0, -1),
+    Glyph::new(0x0075, 0x110A, 17, 17, 15, 0, -1),
+    Glyph::new(0x0076, 0x1143, 16, 16, 15, 0, -1),
+    Glyph::new(0x0077, 0x1176, 24, 23, 15, 0, -1),
+    Glyph::new(0x0078, 0x11C7, 16, 16, 14, 0, 0),
+    Glyph::new(0x0079, 0x11FB, 16, 16, 21, 0, -7),
+    Glyph::new(0x007A, 0x123D, 14, 13, 15, 0, -1),
+    Glyph::new(0x007B, 0x1269, 11, 9, 26, 1, -5),
+    Glyph::new(0x007C, 0x129A, 8, 3, 24, 2, -4),
+    Glyph::new(0x007D, 0x12BD, 11, 9, 26, 0, -5),
+    Glyph::new(0x007E, 0x12ED, 17, 12, 5, 2, 6),
+    Glyph::new(0x00A1, 0x12FD, 8, 5, 21, 1, -7),
+    Glyph::new(0x00A2, 0x131C, 17, 13, 25, 1, -5),
+    Glyph::new(0x00A3, 0x1366, 17, 15, 20, 1, -1),
+    Glyph::new(0x00A4, 0x1398, 17, 14, 13, 1, 2),
+    Glyph::new(0x00A5, 0x13C5, 17, 18, 18, -1, 0),
+    Glyph::new(0x00A7, 0x1406, 14, 12, 21, 1, -3),
+    Glyph::new(0x00A9, 0x1443, 21, 20, 20, 0, -1),
+    Glyph::new(0x00AA, 0x14A5, 12, 10, 13, 1, 6),
+    Glyph::new(0x00AB, 0x14C9, 14, 14, 11, 0, 1),
+    Glyph::new(0x00AE, 0x14EC, 16, 15, 15, 0, 6),
+    Glyph::new(0x00B0, 0x1530, 14, 10, 10, 2, 9),
+    Glyph::new(0x00B1, 0x1547, 17, 12, 16, 2, 0),
+    Glyph::new(0x00B2, 0x1566, 12, 10, 13, 1, 9),
+    Glyph::new(0x00B3, 0x1589, 12, 9, 13, 1, 9),
+    Glyph::new(0x00B5, 0x15A7, 18, 17, 20, 1, -6),
+    Glyph::new(0x00B6, 0x15F0, 15, 14, 23, 0, -4),
+    Glyph::new(0x00B7, 0x1632, 8, 5, 4, 1, 5),
+    Glyph::new(0x00B9, 0x163A, 12, 8, 13, 2, 9),
+    Glyph::new(0x00BA, 0x1656, 12, 10, 13, 1, 6),
+    Glyph::new(0x00BB, 0x1679, 14, 13, 11, 1, 1),
+    Glyph::new(0x00BC, 0x169C, 28, 25, 21, 2, -2),
+    Glyph::new(0x00BD, 0x1706, 28, 25, 21, 2, -2),
+    Glyph::new(0x00BE, 0x1768, 28, 26, 21, 1, -2),
+    Glyph::new(0x00BF, 0x17C9, 13, 10, 20, 1, -6),
+    Glyph::new(0x00C0, 0x17F2, 20, 20, 25, 0, 0),
+    Glyph::new(0x00C1, 0x1844, 20, 20, 25, 0, 0),
+    Glyph::new(0x00C2, 0x1896, 20, 20, 25, 0, 0),
+    Glyph::new(0x00C3, 0x18EC, 20, 20, 25, 0, 0),
+    Glyph::new(0x00C4, 0x1942, 20, 20, 24, 0, 0),
+    Glyph::new(0x00C5, 0x1997, 20, 20, 26, 0, 0),
+    Glyph::new(0x00C6, 0x19F2, 25, 25, 19, -1, 0),
+    Glyph::new(0x00C7, 0x1A45, 17, 15, 26, 1, -7),
+    Glyph::new(0x00C8, 0x1A83, 17, 15, 25, 1, 0),
+    Glyph::new(0x00C9, 0x1AC5, 17, 15, 25, 1, 0),
+    Glyph::new(0x00CA, 0x1B08, 17, 15, 25, 1, 0),
+    Glyph::new(0x00CB, 0x1B4F, 17, 15, 24, 1, 0),
+    Glyph::new(0x00CC, 0x1B95, 10, 8, 25, 1, 0),
+    Glyph::new(0x00CD, 0x1BC4, 10, 8, 25, 1, 0),
+    Glyph::new(0x00CE, 0x1BF3, 10, 10, 25, 0, 0),
+    Glyph::new(0x00CF, 0x1C27, 10, 10, 24, 0, 0),
+    Glyph::new(0x00D0, 0x1C5C, 20, 19, 20, 0, -1),
+    Glyph::new(0x00D1, 0x1CA3, 22, 20, 26, 1, -1),
+    Glyph::new(0x00D2, 0x1D0A, 21, 19, 26, 1, -1),
+    Glyph::new(0x00D3, 0x1D60, 21, 19, 26, 1, -1),
+    Glyph::new(0x00D4, 0x1DB7, 21, 19, 26, 1, -1),
+    Glyph::new(0x00D5, 0x1E11, 21, 19, 26, 1, -1),
+    Glyph::new(0x00D6, 0x1E6A, 21, 19, 25, 1, -1),
+    Glyph::new(0x00D7, 0x1EC4, 17, 11, 11, 3, 3),
+    Glyph::new(0x00D8, 0x1EE0, 21, 20, 20, 0, -1),
+    Glyph::new(0x00D9, 0x1F3D, 21, 20, 26, 0, -1),
+    Glyph::new(0x00DA, 0x1F94, 21, 20, 26, 0, -1),
+    Glyph::new(0x00DB, 0x1FEB, 21, 20, 26, 0, -1),
+    Glyph::new(0x00DC, 0x2046, 21, 20, 25, 0, -1),
+    Glyph::new(0x00DE, 0x20A0, 17, 14, 19, 1, 0),
+    Glyph::new(0x00DF, 0x20D8, 17, 16, 22, 0, -1),
+    Glyph::new(0x00E0, 0x2125, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E1, 0x2164, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E2, 0x21A4, 15, 14, 22, 1, -1),
+    Glyph::new(0x00E3, 0x21E9, 15, 14, 21, 1, -1),
+    Glyph::new(0x00E4, 0x222C, 15, 14, 21, 1, -1),
+    Glyph::new(0x00E5, 0x226D, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E6, 0x22B6, 22, 20, 15, 1, -1),
+    Glyph::new(0x00E7, 0x22FD, 14, 12, 21, 1, -7),
+    Glyph::new(0x00E8, 0x2330, 14, 12, 23, 1, -1),
+    Glyph::new(0x00E9, 0x2367, 14, 12, 23, 1, -1),
+    Glyph::new(0x00EA, 0x239C, 14, 12, 22, 1, -1),
+    Glyph::new(0x00EB, 0x23D7, 14, 12, 21, 1, -1),
+    Glyph::new(0x00EC, 0x240E, 9, 9, 22, 0, 0),
+    Glyph::new(0x00ED, 0x2433, 9, 9, 22, 0, 0),
+    Glyph::new(0x00EE, 0x2459, 9, 9, 21, 0, 0),
+    Glyph::new(0x00EF, 0x2483, 9, 10, 20, -1, 0),
+    Glyph::new(0x00F0, 0x24AF, 16, 14, 22, 1, -1),
+    Glyph::new(0x00F1, 0x24F5, 18, 17, 20, 0, 0),
+    Glyph::new(0x00F2, 0x253A, 16, 14, 23, 1, -1),
+    Glyph::new(0x00F3, 0x2579, 16, 14, 23, 1, -1),
+    Glyph::new(0x00F4, 0x25B9, 16, 14, 22, 1, -1),
+    Glyph::new(0x00F5, 0x25FE, 16, 14, 21, 1, -1),
+    Glyph::new(0x00F6, 0x263F, 16, 14, 21, 1, -1),
+    Glyph::new(0x00F7, 0x267F, 17, 12, 13, 2, 2),
+    Glyph::new(0x00F8, 0x2699, 16, 15, 15, 0, -1),
+    Glyph::new(0x00F9, 0x26DB, 17, 17, 23, 0, -1),
+    Glyph::new(0x00FA, 0x2722, 17, 17, 23, 0, -1),
+    Glyph::new(0x00FB, 0x2768, 17, 17, 22, 0, -1),
+    Glyph::new(0x00FC, 0x27B3, 17, 17, 21, 0, -1),
+    Glyph::new(0x00FE, 0x27FD, 17, 16, 27, 0, -6),
+    Glyph::new(0x00FF, 0x2846, 16, 16, 27, 0, -7),
+    Glyph::new(0x0104, 0x2897, 20, 20, 25, 0, -6),
+    Glyph::new(0x0105, 0x28EB, 15, 14, 20, 1, -6),
+    Glyph::new(0x0106, 0x2928, 17, 15, 26, 1, -1),
+    Glyph::new(0x0107, 0x2966, 14, 12, 23, 1, -1),
+    Glyph::new(0x010C, 0x299A, 17, 15, 26, 1, -1),
+    Glyph::new(0x010D, 0x29DA, 14, 12, 23, 1, -1),
+    Glyph::new(0x010E, 0x2A13, 20, 18, 26, 1, -1),
+    Glyph::new(0x010F, 0x2A65, 17, 18, 22, 1, -1),
+    Glyph::new(0x0118, 0x2ABA, 17, 15, 25, 1, -6),
+    Glyph::new(0x0119, 0x2AFF, 14, 12, 20, 1, -6),
+    Glyph::new(0x011A, 0x2B33, 17, 15, 25, 1, 0),
+    Glyph::new(0x011B, 0x2B7A, 14, 12, 23, 1, -1),
+    Glyph::new(0x0139, 0x2BB6, 16, 15, 25, 1, 0),
+    Glyph::new(0x013A, 0x2BF5, 9, 9, 27, 0, 0),
+    Glyph::new(0x013D, 0x2C21, 16, 15, 21, 1, 0),
+    Glyph::new(0x013E, 0x2C5D, 9, 11, 21, 0, 0),
+    Glyph::new(0x0141, 0x2C87, 16, 17, 19, -1, 0),
+    Glyph::new(0x0142, 0x2CC0, 9, 10, 21, -1, 0),
+    Glyph::new(0x0143, 0x2CEE, 22, 20, 26, 1, -1),
+    Glyph::new(0x0144, 0x2D52, 18, 17, 22, 0, 0),
+    Glyph::new(0x0147, 0x2D95, 22, 20, 26, 1, -1),
+    Glyph::new(0x0148, 0x2DFE, 18, 17, 22, 0, 0),
+    Glyph::new(0x0152, 0x2E46, 26, 24, 20, 1, -1),
+    Glyph::new(0x0153, 0x2EA0, 24, 22, 15, 1, -1),
+    Glyph::new(0x0158, 0x2EF0, 18, 17, 26, 1, -1),
+    Glyph::new(0x0159, 0x2F4B, 12, 12, 22, 0, 0),
+    Glyph::new(0x015A, 0x2F7D, 15, 12, 26, 1, -1),
+    Glyph::new(0x015B, 0x2FC0, 13, 11, 23, 1, -1),
+    Glyph::new(0x0160, 0x2FF8, 15, 12, 26, 1, -1),
+    Glyph::new(0x0161, 0x3040, 13, 11, 23, 1, -1),
+    Glyph::new(0x0164, 0x307C, 18, 16, 25, 1, 0),
+    Glyph::new(0x0165, 0x30BA, 11, 11, 22, 0, -1),
+    Glyph::new(0x016E, 0x30E8, 21, 20, 27, 0, -1),
+    Glyph::new(0x016F, 0x3147, 17, 17, 23, 0, -1),
+    Glyph::new(0x0170, 0x3196, 21, 20, 27, 0, -1),
+    Glyph::new(0x0171, 0x31F7, 17, 17, 23, 0, -1),
+    Glyph::new(0x0178, 0x3246, 18, 18, 24, 0, 0),
+    Glyph::new(0x0179, 0x3291, 16, 15, 26, 0, -1),
+    Glyph::new(0x017A, 0x32CD, 14, 13, 23, 0, -1),
+    Glyph::new(0x017B, 0x3307, 16, 15, 26, 0, -1),
+    Glyph::new(0x017C, 0x3341, 14, 13, 21, 0, -1),
+    Glyph::new(0x017D, 0x3378, 16, 15, 26, 0, -1),
+    Glyph::new(0x017E, 0x33B8, 14, 13, 23, 0, -1),
+    Glyph::new(0x03C0, 0x33F5, 18, 17, 15, 0, -1),
+    Glyph::new(0x1E9E, 0x342B, 20, 19, 20, 0, -1),
+    Glyph::new(0x2013, 0x347D, 13, 13, 3, 0, 5),
+    Glyph::new(0x2014, 0x348C, 26, 26, 3, 0, 5),
+    Glyph::new(0x2018, 0x34A8, 7, 5, 9, 1, 11),
+    Glyph::new(0x2019, 0x34B6, 7, 5, 9, 0, 11),
+    Glyph::new(0x201A, 0x34C3, 7, 5, 9, 0, -5),
+    Glyph::new(0x201B, 0x34D1, 7, 5, 9, 1, 11),
+    Glyph::new(0x201C, 0x34DE, 12, 10, 9, 1, 11),
+    Glyph::new(0x201D, 0x34F9, 12, 11, 9, 0, 11),
+    Glyph::new(0x201E, 0x3512, 12, 11, 9, 0, -5),
+    Glyph::new(0x201F, 0x352D, 12, 10, 9, 1, 11),
+    Glyph::new(0x2020, 0x3547, 13, 13, 18, 0, 1),
+    Glyph::new(0x2021, 0x3574, 13, 13, 21, 0, -2),
+    Glyph::new(0x2022, 0x35AD, 8, 6, 6, 1, 4),
+    Glyph::new(0x2026, 0x35B7, 26, 22, 5, 2, -1),
+    Glyph::new(0x2039, 0x35CD, 9, 8, 11, 0, 1),
+    Glyph::new(0x203A, 0x35DF, 9, 7, 11, 1, 1),
+    Glyph::new(0x2070, 0x35F3, 12, 11, 13, 0, 9),
+    Glyph::new(0x2074, 0x361D, 12, 11, 13, 0, 9),
+    Glyph::new(0x2075, 0x363F, 12, 9, 13, 1, 9),
+    Glyph::new(0x2076, 0x3659, 12, 10, 13, 1, 9),
+    Glyph::new(0x2077, 0x3678, 12, 9, 13, 2, 9),
+    Glyph::new(0x2078, 0x3694, 12, 10, 13, 1, 9),
+    Glyph::new(0x2079, 0x36BB, 12, 10, 13, 1, 9),
+    Glyph::new(0x2080, 0x36DC, 12, 11, 13, 0, -4),
+    Glyph::new(0x2081, 0x3705, 12, 8, 13, 2, -4),
+    Glyph::new(0x2082, 0x3721, 12, 10, 13, 1, -4),
+    Glyph::new(0x2083, 0x3742, 12, 9, 13, 1, -4),
+    Glyph::new(0x2084, 0x3760, 12, 11, 13, 0, -4),
+    Glyph::new(0x2085, 0x3782, 12, 9, 13, 1, -4),
+    Glyph::new(0x2086, 0x379A, 12, 10, 13, 1, -4),
+    Glyph::new(0x2087, 0x37B9, 12, 9, 13, 2, -4),
+    Glyph::new(0x2088, 0x37D3, 12, 10, 13, 1, -4),
+    Glyph::new(0x2089, 0x37F9, 12, 10, 13, 1, -4),
+    Glyph::new(0x20AC, 0x3818, 17, 16, 20, 0, -1),
+    Glyph::new(0x2122, 0x3852, 22, 20, 10, 1, 9),
+    Glyph::new(0x2153, 0x388A, 28, 24, 21, 2, -2),
+    Glyph::new(0x2154, 0x38ED, 28, 25, 21, 1, -2),
+    Glyph::new(0x215B, 0x3954, 28, 25, 21, 2, -2),
+    Glyph::new(0x215C, 0x39C0, 28, 26, 21, 1, -2),
+    Glyph::new(0x215D, 0x3A28, 28, 26, 21, 1, -2),
+    Glyph::new(0x215E, 0x3A8F, 28, 25, 21, 2, -2),
+    Glyph::new(0x2190, 0x3AFC, 26, 16, 12, 5, 3),
+    Glyph::new(0x2191, 0x3B14, 26, 12, 18, 7, 0),
+    Glyph::new(0x2192, 0x3B34, 26, 16, 12, 5, 3),
+    Glyph::new(0x2193, 0x3B4C, 26, 12, 18, 7, 0),
+    Glyph::new(0x2194, 0x3B6D, 26, 16, 12, 5, 3),
+    Glyph::new(0x2195, 0x3B93, 26, 12, 18, 7, 0),
+    Glyph::new(0x21D0, 0x3BC5, 26, 16, 12, 5, 3),
+    Glyph::new(0x21D1, 0x3BEB, 26, 12, 16, 7, 1),
+    Glyph::new(0x21D2, 0x3C21, 26, 16, 12, 5, 3),
+    Glyph::new(0x21D3, 0x3C47, 26, 12, 16, 7, 1),
+    Glyph::new(0x21D4, 0x3C7D, 26, 16, 12, 5, 3),
+    Glyph::new(0x2202, 0x3CAE, 17, 13, 22, 2, -1),
+    Glyph::new(0x2206, 0x3CEF, 18, 17, 19, 0, 0),
+    Glyph::new(0x220F, 0x3D29, 22, 20, 24, 1, -5),
+    Glyph::new(0x2211, 0x3D83, 16, 16, 24, 0, -5),
+    Glyph::new(0x221A, 0x3DBD, 17, 17, 24, 0, -3),
+    Glyph::new(0x221E, 0x3DFE, 17, 16, 9, 0, 4),
+    Glyph::new(0x222B, 0x3E28, 17, 14, 27, 1, -6),
+    Glyph::new(0x2260, 0x3E62, 17, 12, 12, 2, 3),
+    Glyph::new(0x2264, 0x3E80, 17, 12, 16, 2, 0),
+    Glyph::new(0x2265, 0x3E9F, 17, 12, 16, 2, 0),
+    Glyph::new(0xFB01, 0x3EC0, 20, 20, 21, 0, 0),
+    Glyph::new(0xFB02, 0x3F0A, 20, 20, 21, 0, 0),
 ];
 
-const BITMAP_BW: &[u8; 10072] = include_bytes!("./bookerly_26.bw");
-const BITMAP_MSB: &[u8; 10072] = include_bytes!("./bookerly_26.msb");
-const BITMAP_LSB: &[u8; 10072] = include_bytes!("./bookerly_26.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 13), (18, 13), (19, 14),
+    (20, 13), (20, 13), (21, 15), (22, 13), (23, 13), (24, 16), (25, 13), (26, 17),
+    (27, 13), (28, 18), (29, 13), (30, 19), (31, 20), (32, 21), (33, 22), (34, 23),
+    (35, 24), (36, 25), (37, 26), (38, 27), (0, 0), (39, 28), (0, 0), (0, 0),
+    (0, 0), (40, 29), (41, 30), (42, 31), (43, 31), (44, 32), (45, 33), (46, 34),
+    (47, 35), (48, 36), (49, 37), (50, 35), (48, 38), (51, 33), (40, 33), (52, 31),
+    (53, 39), (54, 31), (55, 33), (56, 40), (50, 41), (57, 42), (58, 43), (59, 44),
+    (60, 45), (58, 46), (61, 47), (62, 48), (0, 0), (63, 49), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (64, 50), (65, 51),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (66, 52), (0, 0), (0, 0),
+    (0, 0), (67, 53), (68, 54), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (17, 55), (15, 14), (17, 13),
+    (17, 13), (69, 13), (17, 13), (20, 13), (20, 13), (70, 56), (70, 57), (16, 58),
+    (25, 13), (26, 17), (26, 17), (26, 17), (26, 17), (26, 17), (0, 0), (71, 59),
+    (32, 21), (32, 21), (32, 21), (32, 21), (72, 13), (73, 60), (40, 61), (74, 62),
+    (75, 61), (75, 63), (75, 64), (74, 61), (76, 29), (77, 31), (78, 65), (79, 32),
+    (80, 66), (81, 67), (82, 68), (83, 69), (84, 70), (85, 71), (86, 72), (74, 33),
+    (52, 73), (87, 31), (88, 74), (89, 73), (89, 75), (0, 0), (90, 76), (57, 42),
+    (57, 42), (91, 42), (91, 42), (92, 77), (58, 78), (93, 12), (94, 29), (15, 14),
+    (95, 31), (15, 14), (95, 79), (16, 13), (96, 31), (69, 13), (97, 32), (17, 13),
+    (79, 65), (23, 13), (48, 38), (73, 13), (98, 38), (23, 80), (99, 81), (25, 13),
+    (40, 33), (25, 13), (40, 33), (17, 82), (100, 83), (29, 13), (101, 36), (30, 19),
+    (102, 84), (30, 19), (103, 85), (31, 20), (104, 41), (32, 21), (57, 42), (32, 21),
+    (105, 42), (36, 25), (37, 26), (106, 47), (37, 26), (61, 47), (37, 26), (106, 86),
+    (107, 87), (108, 88), (109, 89), (109, 89), (110, 90), (111, 91), (112, 92), (0, 0),
+    (110, 90), (113, 91), (114, 92), (0, 0), (0, 0), (0, 0), (0, 0), (115, 93),
+    (116, 51), (117, 54), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (48, 33), (48, 33),
+];
+
+const KERNING: [&[i8]; 118] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -2, 0, 0, -2, -1, -1, -1, 0, -1, 0, 0, -2, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, -2, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, -2, 0, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, -1, 0, 0, -2, -2, -2, -1, -1, 0, 0, -1, 0, 0, -2, -2, -1, -1, -1, -2, 0, -2, -1, 0, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, -1, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, -1, -1, -1, -2, 0, -1, -1, -2, 0, -1, -1, -1, -2, -2, -2, -2, 0, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2, 0, -2, -1, -1, -2, -2, -2, 0, -2, -1, -2, -2, 0, -2, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, 0, -2, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -2, 0, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -2, -1, -1, -2, -2, 0, 0, 0, -1, -1, -1, -2, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -2, -1, -2, 0, 0, -1, 0, 0, -1, -2, -2, 0, -1, -1, -1, -2, 0, 0, -2, -2],
+    &[0, -1, -1, -1, -2, -1, 0, -1, -1, -1, -1, -2, 0, -1, -1, -2, 0, -1, -1, -1, -1, -2, -2, -2, 0, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -2, -2, -2, -2, -1, -1, -1, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -2, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -2, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -2, 0, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -2],
+    &[0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -2, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, -2, -1, -1, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -2, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2, 0, -2, -2, 0, 0, 0, -1, -1, -1, -2, 0, 0, -1, -1, -1, 0, -1, 0, 0, -2, -1, -1, -1, -2, 0, -1, -1, 0, 0, -2, -2, -2, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2, 0, -2, -2, 0, 0, 0, -1, -1, -1, -2, 0, 0, -1, -1, -1, 0, -1, 0, 0, -2, -1, -1, -1, -2, 0, -1, -1, 0, 0, -1, -2, -2, -1, -1, -1, -2, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, -1, -2, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -2, -2, 0, -2, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, -1, -2, -1, 0, 0, -1, -1, -2, 0, 0, -2, -2],
+    &[0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, -1, 0, 0, -1, -2, -1, -2, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -2, -1, 0, -2, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -2, -2, -1, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -2, 0, -1, -1, 0, 0, -1, -1, -1, -1, -2, -2, -2, 0, -2, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -2, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, -1, -1, -1, 0, 0, -1, -2, -2, -2, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -1, -1, 0, -1, -1, 0, -2, -1, -1, -2, -2, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, 0, 0, -2],
+    &[0, -1, -1, -1, -1, -2, -1, -2, -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -2, -1, 0, -1, -1, -1, -2, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2],
+    &[0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, -1, -1, -1, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -2, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -2, -2, -1, -2, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -2, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, -1, -1, -2, -2, 0, 0, 0, -1, -1, -1, -2, -1, -1, -2, -1, -1, 0, -1, 0, 0, -2, -2, -2, -1, -2, 0, 0, -2, 0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, -1, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -2, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -2, -1, -1, -2, -2, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, 0, -1, 0, 0, -2, -2, -2, -1, -2, 0, 0, -1, 0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, 0, 0, -1, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -2, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1],
+    &[0, 0, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, -1, 0, 0, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -2, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 16215] = include_bytes!("./bookerly_26.rle");
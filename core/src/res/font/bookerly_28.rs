@@ -1,308 +1,522 @@
 // Auto-generated font file
 // Font: Bookerly
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 11527,
+    size: 17778,
     y_advance: 28,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 8, 5, 23, 2, -1),
-    Glyph::new(0x0022, 0x000F, 11, 8, 10, 1, 11),
-    Glyph::new(0x0023, 0x0019, 18, 17, 18, 0, -2),
-    Glyph::new(0x0024, 0x0040, 18, 14, 29, 2, -6),
-    Glyph::new(0x0025, 0x0073, 28, 25, 23, 1, -2),
-    Glyph::new(0x0026, 0x00BB, 23, 21, 22, 1, -1),
-    Glyph::new(0x0027, 0x00F5, 6, 4, 10, 1, 11),
-    Glyph::new(0x0028, 0x00FA, 11, 9, 28, 1, -5),
-    Glyph::new(0x0029, 0x011A, 11, 9, 28, 0, -5),
-    Glyph::new(0x002A, 0x013A, 11, 10, 10, 0, 11),
-    Glyph::new(0x002B, 0x0147, 18, 13, 13, 2, 3),
-    Glyph::new(0x002C, 0x015D, 8, 7, 10, 0, -6),
-    Glyph::new(0x002D, 0x0166, 11, 9, 4, 1, 5),
-    Glyph::new(0x002E, 0x016B, 8, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x016F, 14, 12, 23, 1, -2),
-    Glyph::new(0x0030, 0x0192, 18, 16, 21, 1, -1),
-    Glyph::new(0x0031, 0x01BC, 18, 11, 20, 3, 0),
-    Glyph::new(0x0032, 0x01D8, 18, 14, 20, 2, 0),
-    Glyph::new(0x0033, 0x01FB, 18, 13, 21, 2, -1),
-    Glyph::new(0x0034, 0x021E, 18, 15, 21, 1, -1),
-    Glyph::new(0x0035, 0x0246, 18, 13, 21, 2, -1),
-    Glyph::new(0x0036, 0x0269, 18, 14, 21, 2, -1),
-    Glyph::new(0x0037, 0x028E, 18, 14, 21, 2, -1),
-    Glyph::new(0x0038, 0x02B3, 18, 14, 21, 2, -1),
-    Glyph::new(0x0039, 0x02D8, 18, 15, 21, 1, -1),
-    Glyph::new(0x003A, 0x0300, 8, 5, 15, 1, -1),
-    Glyph::new(0x003B, 0x030A, 8, 7, 20, 0, -6),
-    Glyph::new(0x003C, 0x031C, 18, 13, 13, 2, 3),
-    Glyph::new(0x003D, 0x0332, 18, 13, 7, 2, 6),
-    Glyph::new(0x003E, 0x033E, 18, 13, 13, 2, 3),
-    Glyph::new(0x003F, 0x0354, 14, 10, 22, 2, -1),
-    Glyph::new(0x0040, 0x0370, 27, 25, 26, 1, -6),
-    Glyph::new(0x0041, 0x03C2, 21, 21, 20, 0, 0),
-    Glyph::new(0x0042, 0x03F7, 18, 16, 21, 1, -1),
-    Glyph::new(0x0043, 0x0421, 18, 16, 21, 1, -1),
-    Glyph::new(0x0044, 0x044B, 21, 19, 21, 1, -1),
-    Glyph::new(0x0045, 0x047D, 18, 16, 20, 1, 0),
-    Glyph::new(0x0046, 0x04A5, 16, 15, 20, 1, 0),
-    Glyph::new(0x0047, 0x04CB, 21, 18, 21, 1, -1),
-    Glyph::new(0x0048, 0x04FB, 24, 22, 20, 1, 0),
-    Glyph::new(0x0049, 0x0532, 11, 9, 20, 1, 0),
-    Glyph::new(0x004A, 0x0549, 11, 12, 26, -2, -6),
-    Glyph::new(0x004B, 0x0570, 21, 20, 21, 1, -1),
-    Glyph::new(0x004C, 0x05A5, 17, 16, 20, 1, 0),
-    Glyph::new(0x004D, 0x05CD, 26, 25, 20, 0, 0),
-    Glyph::new(0x004E, 0x060C, 23, 22, 21, 1, -1),
-    Glyph::new(0x004F, 0x0646, 22, 20, 21, 1, -1),
-    Glyph::new(0x0050, 0x067B, 17, 15, 20, 1, 0),
-    Glyph::new(0x0051, 0x06A1, 22, 22, 26, 1, -6),
-    Glyph::new(0x0052, 0x06E9, 19, 19, 21, 1, -1),
-    Glyph::new(0x0053, 0x071B, 16, 13, 21, 1, -1),
-    Glyph::new(0x0054, 0x073E, 20, 18, 20, 1, 0),
-    Glyph::new(0x0055, 0x076B, 22, 22, 21, 0, -1),
-    Glyph::new(0x0056, 0x07A5, 21, 21, 21, 0, -1),
-    Glyph::new(0x0057, 0x07DD, 32, 31, 21, 0, -1),
-    Glyph::new(0x0058, 0x082F, 21, 21, 20, 0, 0),
-    Glyph::new(0x0059, 0x0864, 20, 19, 20, 0, 0),
-    Glyph::new(0x005A, 0x0894, 17, 16, 21, 0, -1),
-    Glyph::new(0x005B, 0x08BE, 9, 6, 27, 2, -5),
-    Glyph::new(0x005C, 0x08D3, 14, 12, 23, 1, -2),
-    Glyph::new(0x005D, 0x08F6, 9, 6, 27, 1, -5),
-    Glyph::new(0x005E, 0x090B, 18, 14, 13, 2, 5),
-    Glyph::new(0x005F, 0x0922, 14, 14, 3, 0, -4),
-    Glyph::new(0x0060, 0x0928, 19, 7, 8, 6, 16),
-    Glyph::new(0x0061, 0x092F, 16, 15, 16, 1, -1),
-    Glyph::new(0x0062, 0x094D, 17, 17, 23, -1, -1),
-    Glyph::new(0x0063, 0x097E, 15, 13, 16, 1, -1),
-    Glyph::new(0x0064, 0x0998, 18, 17, 23, 1, -1),
-    Glyph::new(0x0065, 0x09C9, 15, 13, 16, 1, -1),
-    Glyph::new(0x0066, 0x09E3, 12, 14, 22, 0, 0),
-    Glyph::new(0x0067, 0x0A0A, 17, 16, 22, 0, -7),
-    Glyph::new(0x0068, 0x0A36, 19, 18, 22, 0, 0),
-    Glyph::new(0x0069, 0x0A68, 10, 9, 22, 0, 0),
-    Glyph::new(0x006A, 0x0A81, 9, 9, 29, -2, -7),
-    Glyph::new(0x006B, 0x0AA2, 17, 17, 23, 0, -1),
-    Glyph::new(0x006C, 0x0AD3, 10, 9, 22, 0, 0),
-    Glyph::new(0x006D, 0x0AEC, 28, 28, 15, 0, 0),
-    Glyph::new(0x006E, 0x0B21, 19, 19, 15, 0, 0),
-    Glyph::new(0x006F, 0x0B45, 17, 15, 16, 1, -1),
-    Glyph::new(0x0070, 0x0B63, 18, 17, 22, 0, -7),
-    Glyph::new(0x0071, 0x0B92, 17, 16, 22, 1, -7),
-    Glyph::new(0x0072, 0x0BBE, 13, 13, 15, 0, 0),
-    Glyph::new(0x0073, 0x0BD7, 14, 12, 16, 1, -1),
-    Glyph::new(0x0074, 0x0BEF, 12, 11, 20, 0, -1),
-    Glyph::new(0x0075, 0x0C0B, 19, 19, 16, 0, -1),
-    Glyph::new(0x0076, 0x0C31, 17, 17, 16, 0, -1),
-    Glyph::new(0x0077, 0x0C53, 25, 25, 16, 0, -1),
-    Glyph::new(0x0078, 0x0C85, 17, 17, 15, 0, 0),
-    Glyph::new(0x0079, 0x0CA5, 17, 17, 22, 0, -7),
-    Glyph::new(0x007A, 0x0CD4, 15, 14, 16, 0, -1),
-    Glyph::new(0x007B, 0x0CF0, 11, 9, 28, 2, -5),
-    Glyph::new(0x007C, 0x0D10, 8, 3, 26, 2, -4),
-    Glyph::new(0x007D, 0x0D1A, 11, 9, 28, 0, -5),
-    Glyph::new(0x007E, 0x0D3A, 18, 14, 5, 2, 7),
-    Glyph::new(0x00A1, 0x0D43, 8, 5, 22, 1, -7),
-    Glyph::new(0x00A2, 0x0D51, 18, 14, 28, 1, -6),
-    Glyph::new(0x00A3, 0x0D82, 18, 16, 21, 1, -1),
-    Glyph::new(0x00A4, 0x0DAC, 18, 16, 13, 1, 3),
-    Glyph::new(0x00A5, 0x0DC6, 18, 19, 20, -1, 0),
-    Glyph::new(0x00A7, 0x0DF6, 15, 13, 23, 1, -3),
-    Glyph::new(0x00A9, 0x0E1C, 22, 22, 21, 0, -1),
-    Glyph::new(0x00AA, 0x0E56, 13, 10, 14, 1, 6),
-    Glyph::new(0x00AB, 0x0E68, 15, 15, 11, 0, 2),
-    Glyph::new(0x00AE, 0x0E7D, 17, 16, 15, 0, 7),
-    Glyph::new(0x00B0, 0x0E9B, 15, 10, 10, 2, 10),
-    Glyph::new(0x00B1, 0x0EA8, 18, 13, 17, 2, 0),
-    Glyph::new(0x00B2, 0x0EC4, 13, 11, 14, 1, 10),
-    Glyph::new(0x00B3, 0x0ED8, 13, 10, 14, 1, 10),
-    Glyph::new(0x00B5, 0x0EEA, 19, 17, 22, 2, -7),
-    Glyph::new(0x00B6, 0x0F19, 16, 15, 24, 0, -4),
-    Glyph::new(0x00B7, 0x0F46, 8, 5, 5, 1, 5),
-    Glyph::new(0x00B9, 0x0F4A, 13, 9, 14, 2, 10),
-    Glyph::new(0x00BA, 0x0F5A, 13, 11, 14, 1, 6),
-    Glyph::new(0x00BB, 0x0F6E, 15, 15, 11, 1, 2),
-    Glyph::new(0x00BC, 0x0F83, 31, 27, 23, 2, -2),
-    Glyph::new(0x00BD, 0x0FD1, 31, 27, 23, 2, -2),
-    Glyph::new(0x00BE, 0x101F, 31, 29, 23, 1, -2),
-    Glyph::new(0x00BF, 0x1073, 14, 11, 21, 1, -6),
-    Glyph::new(0x00C0, 0x1090, 21, 21, 27, 0, 0),
-    Glyph::new(0x00C1, 0x10D7, 21, 21, 27, 0, 0),
-    Glyph::new(0x00C2, 0x111E, 21, 21, 27, 0, 0),
-    Glyph::new(0x00C3, 0x1165, 21, 21, 27, 0, 0),
-    Glyph::new(0x00C4, 0x11AC, 21, 21, 26, 0, 0),
-    Glyph::new(0x00C5, 0x11F1, 21, 21, 28, 0, 0),
-    Glyph::new(0x00C6, 0x123B, 27, 26, 20, -1, 0),
-    Glyph::new(0x00C7, 0x127C, 18, 16, 28, 1, -8),
-    Glyph::new(0x00C8, 0x12B4, 18, 16, 27, 1, 0),
-    Glyph::new(0x00C9, 0x12EA, 18, 16, 27, 1, 0),
-    Glyph::new(0x00CA, 0x1320, 18, 16, 27, 1, 0),
-    Glyph::new(0x00CB, 0x1356, 18, 16, 26, 1, 0),
-    Glyph::new(0x00CC, 0x138A, 11, 9, 27, 1, 0),
-    Glyph::new(0x00CD, 0x13A9, 11, 9, 27, 1, 0),
-    Glyph::new(0x00CE, 0x13C8, 11, 11, 27, 0, 0),
-    Glyph::new(0x00CF, 0x13EE, 11, 11, 26, 0, 0),
-    Glyph::new(0x00D0, 0x1412, 21, 20, 21, 0, -1),
-    Glyph::new(0x00D1, 0x1447, 23, 22, 28, 1, -1),
-    Glyph::new(0x00D2, 0x1494, 22, 20, 28, 1, -1),
-    Glyph::new(0x00D3, 0x14DA, 22, 20, 28, 1, -1),
-    Glyph::new(0x00D4, 0x1520, 22, 20, 28, 1, -1),
-    Glyph::new(0x00D5, 0x1566, 22, 20, 28, 1, -1),
-    Glyph::new(0x00D6, 0x15AC, 22, 20, 27, 1, -1),
-    Glyph::new(0x00D7, 0x15F0, 18, 12, 11, 3, 4),
-    Glyph::new(0x00D8, 0x1601, 22, 22, 21, 0, -1),
-    Glyph::new(0x00D9, 0x163B, 22, 22, 28, 0, -1),
-    Glyph::new(0x00DA, 0x1688, 22, 22, 28, 0, -1),
-    Glyph::new(0x00DB, 0x16D5, 22, 22, 28, 0, -1),
-    Glyph::new(0x00DC, 0x1722, 22, 22, 27, 0, -1),
-    Glyph::new(0x00DE, 0x176D, 18, 16, 20, 1, 0),
-    Glyph::new(0x00DF, 0x1795, 19, 18, 23, 0, -1),
-    Glyph::new(0x00E0, 0x17C9, 16, 15, 25, 1, -1),
-    Glyph::new(0x00E1, 0x17F8, 16, 15, 24, 1, -1),
-    Glyph::new(0x00E2, 0x1825, 16, 15, 24, 1, -1),
-    Glyph::new(0x00E3, 0x1852, 16, 15, 23, 1, -1),
-    Glyph::new(0x00E4, 0x187E, 16, 15, 22, 1, -1),
-    Glyph::new(0x00E5, 0x18A8, 16, 15, 25, 1, -1),
-    Glyph::new(0x00E6, 0x18D7, 23, 21, 16, 1, -1),
-    Glyph::new(0x00E7, 0x1901, 15, 13, 23, 1, -8),
-    Glyph::new(0x00E8, 0x1927, 15, 13, 25, 1, -1),
-    Glyph::new(0x00E9, 0x1950, 15, 13, 24, 1, -1),
-    Glyph::new(0x00EA, 0x1977, 15, 13, 24, 1, -1),
-    Glyph::new(0x00EB, 0x199E, 15, 13, 22, 1, -1),
-    Glyph::new(0x00EC, 0x19C2, 10, 9, 24, 0, 0),
-    Glyph::new(0x00ED, 0x19DD, 10, 9, 23, 0, 0),
-    Glyph::new(0x00EE, 0x19F7, 10, 9, 23, 0, 0),
-    Glyph::new(0x00EF, 0x1A11, 10, 11, 21, -1, 0),
-    Glyph::new(0x00F0, 0x1A2E, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F1, 0x1A5B, 19, 19, 22, 0, 0),
-    Glyph::new(0x00F2, 0x1A90, 17, 15, 25, 1, -1),
-    Glyph::new(0x00F3, 0x1ABF, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F4, 0x1AEC, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F5, 0x1B19, 17, 15, 23, 1, -1),
-    Glyph::new(0x00F6, 0x1B45, 17, 15, 22, 1, -1),
-    Glyph::new(0x00F7, 0x1B6F, 18, 13, 13, 2, 3),
-    Glyph::new(0x00F8, 0x1B85, 17, 17, 16, 0, -1),
-    Glyph::new(0x00F9, 0x1BA7, 19, 19, 25, 0, -1),
-    Glyph::new(0x00FA, 0x1BE3, 19, 19, 24, 0, -1),
-    Glyph::new(0x00FB, 0x1C1C, 19, 19, 24, 0, -1),
-    Glyph::new(0x00FC, 0x1C55, 19, 19, 22, 0, -1),
-    Glyph::new(0x00FE, 0x1C8A, 18, 17, 29, 0, -7),
-    Glyph::new(0x00FF, 0x1CC8, 17, 17, 28, 0, -7),
-    Glyph::new(0x0104, 0x1D04, 21, 21, 26, 0, -6),
-    Glyph::new(0x0105, 0x1D49, 16, 15, 21, 1, -6),
-    Glyph::new(0x0106, 0x1D71, 18, 16, 28, 1, -1),
-    Glyph::new(0x0107, 0x1DA9, 15, 13, 24, 1, -1),
-    Glyph::new(0x010C, 0x1DD0, 18, 16, 28, 1, -1),
-    Glyph::new(0x010D, 0x1E08, 15, 13, 24, 1, -1),
-    Glyph::new(0x010E, 0x1E2F, 21, 19, 28, 1, -1),
-    Glyph::new(0x010F, 0x1E72, 19, 19, 23, 1, -1),
-    Glyph::new(0x0118, 0x1EA9, 18, 16, 26, 1, -6),
-    Glyph::new(0x0119, 0x1EDD, 15, 13, 21, 1, -6),
-    Glyph::new(0x011A, 0x1F00, 18, 16, 27, 1, 0),
-    Glyph::new(0x011B, 0x1F36, 15, 13, 24, 1, -1),
-    Glyph::new(0x0139, 0x1F5D, 17, 16, 27, 1, 0),
-    Glyph::new(0x013A, 0x1F93, 10, 9, 29, 0, 0),
-    Glyph::new(0x013D, 0x1FB4, 17, 16, 22, 1, 0),
-    Glyph::new(0x013E, 0x1FE0, 10, 12, 22, 0, 0),
-    Glyph::new(0x0141, 0x2001, 17, 18, 20, -1, 0),
-    Glyph::new(0x0142, 0x202E, 10, 11, 22, -1, 0),
-    Glyph::new(0x0143, 0x204D, 23, 22, 28, 1, -1),
-    Glyph::new(0x0144, 0x209A, 19, 19, 23, 0, 0),
-    Glyph::new(0x0147, 0x20D1, 23, 22, 28, 1, -1),
-    Glyph::new(0x0148, 0x211E, 19, 19, 23, 0, 0),
-    Glyph::new(0x0152, 0x2155, 28, 26, 21, 1, -1),
-    Glyph::new(0x0153, 0x219A, 26, 24, 16, 1, -1),
-    Glyph::new(0x0158, 0x21CA, 19, 19, 28, 1, -1),
-    Glyph::new(0x0159, 0x220D, 13, 13, 23, 0, 0),
-    Glyph::new(0x015A, 0x2233, 16, 13, 28, 1, -1),
-    Glyph::new(0x015B, 0x2261, 14, 12, 24, 1, -1),
-    Glyph::new(0x0160, 0x2285, 16, 13, 28, 1, -1),
-    Glyph::new(0x0161, 0x22B3, 14, 12, 24, 1, -1),
-    Glyph::new(0x0164, 0x22D7, 20, 18, 27, 1, 0),
-    Glyph::new(0x0165, 0x2314, 12, 11, 24, 0, -1),
-    Glyph::new(0x016E, 0x2335, 22, 22, 29, 0, -1),
-    Glyph::new(0x016F, 0x2385, 19, 19, 25, 0, -1),
-    Glyph::new(0x0170, 0x23C1, 22, 22, 29, 0, -1),
-    Glyph::new(0x0171, 0x2411, 19, 19, 24, 0, -1),
-    Glyph::new(0x0178, 0x244A, 20, 19, 26, 0, 0),
-    Glyph::new(0x0179, 0x2488, 17, 16, 28, 0, -1),
-    Glyph::new(0x017A, 0x24C0, 15, 14, 24, 0, -1),
-    Glyph::new(0x017B, 0x24EA, 17, 16, 28, 0, -1),
-    Glyph::new(0x017C, 0x2522, 15, 14, 23, 0, -1),
-    Glyph::new(0x017D, 0x254B, 17, 16, 28, 0, -1),
-    Glyph::new(0x017E, 0x2583, 15, 14, 24, 0, -1),
-    Glyph::new(0x03C0, 0x25AD, 19, 18, 16, 0, -1),
-    Glyph::new(0x1E9E, 0x25D1, 21, 21, 21, 0, -1),
-    Glyph::new(0x2013, 0x2609, 14, 14, 3, 0, 6),
-    Glyph::new(0x2014, 0x260F, 28, 28, 3, 0, 6),
-    Glyph::new(0x2018, 0x261A, 7, 5, 9, 1, 12),
-    Glyph::new(0x2019, 0x2620, 7, 6, 9, 0, 12),
-    Glyph::new(0x201A, 0x2627, 7, 6, 9, 0, -5),
-    Glyph::new(0x201B, 0x262E, 7, 5, 9, 1, 12),
-    Glyph::new(0x201C, 0x2634, 13, 11, 9, 1, 12),
-    Glyph::new(0x201D, 0x2641, 13, 11, 9, 0, 12),
-    Glyph::new(0x201E, 0x264E, 13, 11, 9, 0, -5),
-    Glyph::new(0x201F, 0x265B, 13, 11, 9, 1, 12),
-    Glyph::new(0x2020, 0x2668, 14, 14, 19, 0, 1),
-    Glyph::new(0x2021, 0x268A, 14, 14, 22, 0, -2),
-    Glyph::new(0x2022, 0x26B1, 9, 7, 6, 1, 4),
-    Glyph::new(0x2026, 0x26B7, 28, 24, 5, 2, -1),
-    Glyph::new(0x2039, 0x26C6, 9, 8, 11, 0, 2),
-    Glyph::new(0x203A, 0x26D1, 9, 8, 11, 1, 2),
-    Glyph::new(0x2070, 0x26DC, 13, 12, 14, 0, 10),
-    Glyph::new(0x2074, 0x26F1, 13, 11, 14, 1, 10),
-    Glyph::new(0x2075, 0x2705, 13, 10, 13, 1, 10),
-    Glyph::new(0x2076, 0x2716, 13, 11, 14, 1, 10),
-    Glyph::new(0x2077, 0x272A, 13, 10, 13, 2, 10),
-    Glyph::new(0x2078, 0x273B, 13, 10, 14, 1, 10),
-    Glyph::new(0x2079, 0x274D, 13, 10, 14, 1, 10),
-    Glyph::new(0x2080, 0x275F, 13, 12, 14, 0, -5),
-    Glyph::new(0x2081, 0x2774, 13, 9, 14, 2, -4),
-    Glyph::new(0x2082, 0x2784, 13, 11, 13, 1, -4),
-    Glyph::new(0x2083, 0x2796, 13, 10, 14, 1, -5),
-    Glyph::new(0x2084, 0x27A8, 13, 11, 14, 1, -5),
-    Glyph::new(0x2085, 0x27BC, 13, 10, 14, 1, -5),
-    Glyph::new(0x2086, 0x27CE, 13, 11, 14, 1, -5),
-    Glyph::new(0x2087, 0x27E2, 13, 10, 14, 2, -5),
-    Glyph::new(0x2088, 0x27F4, 13, 10, 14, 1, -5),
-    Glyph::new(0x2089, 0x2806, 13, 10, 14, 1, -5),
-    Glyph::new(0x20AC, 0x2818, 18, 17, 21, 0, -1),
-    Glyph::new(0x2122, 0x2845, 24, 22, 10, 1, 10),
-    Glyph::new(0x2153, 0x2861, 31, 26, 23, 2, -2),
-    Glyph::new(0x2154, 0x28AC, 31, 27, 23, 1, -2),
-    Glyph::new(0x215B, 0x28FA, 31, 27, 23, 2, -2),
-    Glyph::new(0x215C, 0x2948, 31, 28, 23, 1, -2),
-    Glyph::new(0x215D, 0x2999, 31, 28, 23, 1, -2),
-    Glyph::new(0x215E, 0x29EA, 31, 27, 23, 2, -2),
-    Glyph::new(0x2190, 0x2A38, 28, 16, 12, 6, 4),
-    Glyph::new(0x2191, 0x2A50, 28, 12, 19, 8, 0),
-    Glyph::new(0x2192, 0x2A6D, 28, 16, 12, 6, 4),
-    Glyph::new(0x2193, 0x2A85, 28, 12, 19, 8, 0),
-    Glyph::new(0x2194, 0x2AA2, 28, 18, 12, 5, 4),
-    Glyph::new(0x2195, 0x2ABD, 28, 12, 19, 8, 0),
-    Glyph::new(0x21D0, 0x2ADA, 28, 16, 13, 6, 3),
-    Glyph::new(0x21D1, 0x2AF4, 28, 12, 17, 8, 1),
-    Glyph::new(0x21D2, 0x2B0E, 28, 16, 13, 6, 3),
-    Glyph::new(0x21D3, 0x2B28, 28, 12, 17, 8, 1),
-    Glyph::new(0x21D4, 0x2B42, 28, 18, 13, 5, 3),
-    Glyph::new(0x2202, 0x2B60, 18, 14, 23, 2, -1),
-    Glyph::new(0x2206, 0x2B89, 19, 18, 20, 0, 0),
-    Glyph::new(0x220F, 0x2BB6, 23, 21, 25, 1, -5),
-    Glyph::new(0x2211, 0x2BF8, 18, 17, 25, 0, -5),
-    Glyph::new(0x221A, 0x2C2E, 18, 18, 27, 0, -4),
-    Glyph::new(0x221E, 0x2C6B, 18, 18, 10, 0, 4),
-    Glyph::new(0x222B, 0x2C82, 18, 15, 29, 1, -7),
-    Glyph::new(0x2260, 0x2CB9, 18, 13, 13, 2, 3),
-    Glyph::new(0x2264, 0x2CCF, 18, 13, 17, 2, 0),
-    Glyph::new(0x2265, 0x2CEB, 18, 13, 17, 2, 0),
+    Glyph::new(0x0022, 0x0021, 11, 8, 10, 1, 11),
+    Glyph::new(0x0023, 0x003D, 18, 17, 18, 0, -2),
+    Glyph::new(0x0024, 0x0082, 18, 14, 29, 2, -6),
+    Glyph::new(0x0025, 0x00DB, 28, 25, 23, 1, -2),
+    Glyph::new(0x0026, 0x0156, 23, 21, 22, 1, -1),
+    Glyph::new(0x0027, 0x01AB, 6, 4, 10, 1, 11),
+    Glyph::new(0x0028, 0x01BB, 11, 9, 28, 1, -5),
+    Glyph::new(0x0029, 0x01EB, 11, 9, 28, 0, -5),
+    Glyph::new(0x002A, 0x021A, 11, 10, 10, 0, 11),
+    Glyph::new(0x002B, 0x0235, 18, 13, 13, 2, 3),
+    Glyph::new(0x002C, 0x0258, 8, 7, 10, 0, -6),
+    Glyph::new(0x002D, 0x0265, 11, 9, 4, 1, 5),
+    Glyph::new(0x002E, 0x026E, 8, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x0277, 14, 12, 23, 1, -2),
+    Glyph::new(0x0030, 0x02A3, 18, 16, 21, 1, -1),
+    Glyph::new(0x0031, 0x02E7, 18, 11, 20, 3, 0),
+    Glyph::new(0x0032, 0x0317, 18, 14, 20, 2, 0),
+    Glyph::new(0x0033, 0x0352, 18, 13, 21, 2, -1),
+    Glyph::new(0x0034, 0x0388, 18, 15, 21, 1, -1),
+    Glyph::new(0x0035, 0x03C2, 18, 13, 21, 2, -1),
+    Glyph::new(0x0036, 0x03F4, 18, 14, 21, 2, -1),
+    Glyph::new(0x0037, 0x042C, 18, 14, 21, 2, -1),
+    Glyph::new(0x0038, 0x045F, 18, 14, 21, 2, -1),
+    Glyph::new(0x0039, 0x04A2, 18, 15, 21, 1, -1),
+    Glyph::new(0x003A, 0x04DA, 8, 5, 15, 1, -1),
+    Glyph::new(0x003B, 0x04EB, 8, 7, 20, 0, -6),
+    Glyph::new(0x003C, 0x0501, 18, 13, 13, 2, 3),
+    Glyph::new(0x003D, 0x0520, 18, 13, 7, 2, 6),
+    Glyph::new(0x003E, 0x052A, 18, 13, 13, 2, 3),
+    Glyph::new(0x003F, 0x054B, 14, 10, 22, 2, -1),
+    Glyph::new(0x0040, 0x0575, 27, 25, 26, 1, -6),
+    Glyph::new(0x0041, 0x05F1, 21, 21, 20, 0, 0),
+    Glyph::new(0x0042, 0x0634, 18, 16, 21, 1, -1),
+    Glyph::new(0x0043, 0x0680, 18, 16, 21, 1, -1),
+    Glyph::new(0x0044, 0x06BB, 21, 19, 21, 1, -1),
+    Glyph::new(0x0045, 0x0711, 18, 16, 20, 1, 0),
+    Glyph::new(0x0046, 0x0752, 16, 15, 20, 1, 0),
+    Glyph::new(0x0047, 0x0791, 21, 18, 21, 1, -1),
+    Glyph::new(0x0048, 0x07DA, 24, 22, 20, 1, 0),
+    Glyph::new(0x0049, 0x083D, 11, 9, 20, 1, 0),
+    Glyph::new(0x004A, 0x0860, 11, 12, 26, -2, -6),
+    Glyph::new(0x004B, 0x089A, 21, 20, 21, 1, -1),
+    Glyph::new(0x004C, 0x08EE, 17, 16, 20, 1, 0),
+    Glyph::new(0x004D, 0x0925, 26, 25, 20, 0, 0),
+    Glyph::new(0x004E, 0x0996, 23, 22, 21, 1, -1),
+    Glyph::new(0x004F, 0x09FF, 22, 20, 21, 1, -1),
+    Glyph::new(0x0050, 0x0A4A, 17, 15, 20, 1, 0),
+    Glyph::new(0x0051, 0x0A8E, 22, 22, 26, 1, -6),
+    Glyph::new(0x0052, 0x0AE9, 19, 19, 21, 1, -1),
+    Glyph::new(0x0053, 0x0B3C, 16, 13, 21, 1, -1),
+    Glyph::new(0x0054, 0x0B79, 20, 18, 20, 1, 0),
+    Glyph::new(0x0055, 0x0BB0, 22, 22, 21, 0, -1),
+    Glyph::new(0x0056, 0x0BFD, 21, 21, 21, 0, -1),
+    Glyph::new(0x0057, 0x0C49, 32, 31, 21, 0, -1),
+    Glyph::new(0x0058, 0x0CC8, 21, 21, 20, 0, 0),
+    Glyph::new(0x0059, 0x0D14, 20, 19, 20, 0, 0),
+    Glyph::new(0x005A, 0x0D56, 17, 16, 21, 0, -1),
+    Glyph::new(0x005B, 0x0D95, 9, 6, 27, 2, -5),
+    Glyph::new(0x005C, 0x0DC1, 14, 12, 23, 1, -2),
+    Glyph::new(0x005D, 0x0DEF, 9, 6, 27, 1, -5),
+    Glyph::new(0x005E, 0x0E1B, 18, 14, 13, 2, 5),
+    Glyph::new(0x005F, 0x0E48, 14, 14, 3, 0, -4),
+    Glyph::new(0x0060, 0x0E57, 19, 7, 8, 6, 16),
+    Glyph::new(0x0061, 0x0E62, 16, 15, 16, 1, -1),
+    Glyph::new(0x0062, 0x0E9A, 17, 17, 23, -1, -1),
+    Glyph::new(0x0063, 0x0EEA, 15, 13, 16, 1, -1),
+    Glyph::new(0x0064, 0x0F15, 18, 17, 23, 1, -1),
+    Glyph::new(0x0065, 0x0F66, 15, 13, 16, 1, -1),
+    Glyph::new(0x0066, 0x0F91, 12, 14, 22, 0, 0),
+    Glyph::new(0x0067, 0x0FC8, 17, 16, 22, 0, -7),
+    Glyph::new(0x0068, 0x1013, 19, 18, 22, 0, 0),
+    Glyph::new(0x0069, 0x1056, 10, 9, 22, 0, 0),
+    Glyph::new(0x006A, 0x1079, 9, 9, 29, -2, -7),
+    Glyph::new(0x006B, 0x10AC, 17, 17, 23, 0, -1),
+    Glyph::new(0x006C, 0x10F3, 10, 9, 22, 0, 0),
+    Glyph::new(0x006D, 0x1110, 28, 28, 15, 0, 0),
+    Glyph::new(0x006E, 0x1161, 19, 19, 15, 0, 0),
+    Glyph::new(0x006F, 0x119C, 17, 15, 16, 1, -1),
+    Glyph::new(0x0070, 0x11D1, 18, 17, 22, 0, -7),
+    Glyph::new(0x0071, 0x1218, 17, 16, 22, 1, -7),
+    Glyph::new(0x0072, 0x1265, 13, 13, 15, 0, 0),
+    Glyph::new(0x0073, 0x128C, 14, 12, 16, 1, -1),
+    Glyph::new(0x0074, 0x12BC, 12, 11, 20, 0, -1),
+    Glyph::new(0x0075, 0x12E9, 19, 19, 16, 0, -1),
+    Glyph::new(0x0076, 0x1326, 17, 17, 16, 0, -1),
+    Glyph::new(0x0077, 0x135D, 25, 25, 16, 0, -1),
+    Glyph::new(0x0078, 0x13B7, 17, 17, 15, 0, 0),
+    Glyph::new(0x0079, 0x13EC, 17, 17, 22, 0, -7),
+    Glyph::new(0x007A, 0x1433, 15, 14, 16, 0, -1),
+    Glyph::new(0x007B, 0x1464, 11, 9, 28, 2, -5),
+    Glyph::new(0x007C, 0x149B, 8, 3, 26, 2, -4),
+    Glyph::new(0x007D, 0x14B6, 11, 9, 28, 0, -5),
+    Glyph::new(0x007E, 0x14E8, 18, 14, 5, 2, 7),
+    Glyph::new(0x00A1, 0x14FC, 8, 5, 22, 1, -7),
+    Glyph::new(0x00A2, 0x1520, 18, 14, 28, 1, -6),
+    Glyph::new(0x00A3, 0x1570, 18, 16, 21, 1, -1),
+    Glyph::new(0x00A4, 0x15AF, 18, 16, 13, 1, 3),
+    Glyph::new(0x00A5, 0x15E6, 18, 19, 20, -1, 0),
+    Glyph::new(0x00A7, 0x1628, 15, 13, 23, 1, -3),
+    Glyph::new(0x00A9, 0x166D, 22, 22, 21, 0, -1),
+    Glyph::new(0x00AA, 0x16D4, 13, 10, 14, 1, 6),
+    Glyph::new(0x00AB, 0x16F7, 15, 15, 11, 0, 2),
+    Glyph::new(0x00AE, 0x1719, 17, 16, 15, 0, 7),
+    Glyph::new(0x00B0, 0x1767, 15, 10, 10, 2, 10),
+    Glyph::new(0x00B1, 0x1785, 18, 13, 17, 2, 0),
+    Glyph::new(0x00B2, 0x17AC, 13, 11, 14, 1, 10),
+    Glyph::new(0x00B3, 0x17D0, 13, 10, 14, 1, 10),
+    Glyph::new(0x00B5, 0x17EE, 19, 17, 22, 2, -7),
+    Glyph::new(0x00B6, 0x1839, 16, 15, 24, 0, -4),
+    Glyph::new(0x00B7, 0x1892, 8, 5, 5, 1, 5),
+    Glyph::new(0x00B9, 0x189A, 13, 9, 14, 2, 10),
+    Glyph::new(0x00BA, 0x18B6, 13, 11, 14, 1, 6),
+    Glyph::new(0x00BB, 0x18DD, 15, 15, 11, 1, 2),
+    Glyph::new(0x00BC, 0x1900, 31, 27, 23, 2, -2),
+    Glyph::new(0x00BD, 0x1976, 31, 27, 23, 2, -2),
+    Glyph::new(0x00BE, 0x19E1, 31, 29, 23, 1, -2),
+    Glyph::new(0x00BF, 0x1A54, 14, 11, 21, 1, -6),
+    Glyph::new(0x00C0, 0x1A7F, 21, 21, 27, 0, 0),
+    Glyph::new(0x00C1, 0x1AD1, 21, 21, 27, 0, 0),
+    Glyph::new(0x00C2, 0x1B23, 21, 21, 27, 0, 0),
+    Glyph::new(0x00C3, 0x1B79, 21, 21, 27, 0, 0),
+    Glyph::new(0x00C4, 0x1BCF, 21, 21, 26, 0, 0),
+    Glyph::new(0x00C5, 0x1C23, 21, 21, 28, 0, 0),
+    Glyph::new(0x00C6, 0x1C7E, 27, 26, 20, -1, 0),
+    Glyph::new(0x00C7, 0x1CD8, 18, 16, 28, 1, -8),
+    Glyph::new(0x00C8, 0x1D1F, 18, 16, 27, 1, 0),
+    Glyph::new(0x00C9, 0x1D6C, 18, 16, 27, 1, 0),
+    Glyph::new(0x00CA, 0x1DBC, 18, 16, 27, 1, 0),
+    Glyph::new(0x00CB, 0x1E10, 18, 16, 26, 1, 0),
+    Glyph::new(0x00CC, 0x1E60, 11, 9, 27, 1, 0),
+    Glyph::new(0x00CD, 0x1E8F, 11, 9, 27, 1, 0),
+    Glyph::new(0x00CE, 0x1EBD, 11, 11, 27, 0, 0),
+    Glyph::new(0x00CF, 0x1EF3, 11, 11, 26, 0, 0),
+    Glyph::new(0x00D0, 0x1F26, 21, 20, 21, 0, -1),
+    Glyph::new(0x00D1, 0x1F7F, 23, 22, 28, 1, -1),
+    Glyph::new(0x00D2, 0x1FFB, 22, 20, 28, 1, -1),
+    Glyph::new(0x00D3, 0x2054, 22, 20, 28, 1, -1),
+    Glyph::new(0x00D4, 0x20AD, 22, 20, 28, 1, -1),
+    Glyph::new(0x00D5, 0x210C, 22, 20, 28, 1, -1),
+    Glyph::new(0x00D6, 0x2169, 22, 20, 27, 1, -1),
+    Glyph::new(0x00D7, 0x21C6, 18, 12, 11, 3, 4),
+    Glyph::new(0x00D8, 0x21E5, 22, 22, 21, 0, -1),
+    Glyph::new(0x00D9, 0x2248, 22, 22, 28, 0, -1),
+    Glyph::new(0x00DA, 0x22A4, 22, 22, 28, 0, -1),
+    Glyph::new(0x00DB, 0x2300, 22, 22, 28, 0, -1),
+    Glyph::new(0x00DC, 0x2362, 22, 22, 27, 0, -1),
+    Glyph::new(0x00DE, 0x23C0, 18, 16, 20, 1, 0),
+    Glyph::new(0x00DF, 0x2400, 19, 18, 23, 0, -1),
+    Glyph::new(0x00E0, 0x245A, 16, 15, 25, 1, -1),
+    Glyph::new(0x00E1, 0x249F, 16, 15, 24, 1, -1),
+    Glyph::new(0x00E2, 0x24E3, 16, 15, 24, 1, -1),
+    Glyph::new(0x00E3, 0x252E, 16, 15, 23, 1, -1),
+    Glyph::new(0x00E4, 0x2578, 16, 15, 22, 1, -1),
+    Glyph::new(0x00E5, 0x25C0, 16, 15, 25, 1, -1),
+    Glyph::new(0x00E6, 0x2610, 23, 21, 16, 1, -1),
+    Glyph::new(0x00E7, 0x2660, 15, 13, 23, 1, -8),
+    Glyph::new(0x00E8, 0x2698, 15, 13, 25, 1, -1),
+    Glyph::new(0x00E9, 0x26D1, 15, 13, 24, 1, -1),
+    Glyph::new(0x00EA, 0x270A, 15, 13, 24, 1, -1),
+    Glyph::new(0x00EB, 0x2748, 15, 13, 22, 1, -1),
+    Glyph::new(0x00EC, 0x2781, 10, 9, 24, 0, 0),
+    Glyph::new(0x00ED, 0x27A7, 10, 9, 23, 0, 0),
+    Glyph::new(0x00EE, 0x27CD, 10, 9, 23, 0, 0),
+    Glyph::new(0x00EF, 0x27F6, 10, 11, 21, -1, 0),
+    Glyph::new(0x00F0, 0x281E, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F1, 0x286B, 19, 19, 22, 0, 0),
+    Glyph::new(0x00F2, 0x28B9, 17, 15, 25, 1, -1),
+    Glyph::new(0x00F3, 0x28FC, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F4, 0x293C, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F5, 0x2984, 17, 15, 23, 1, -1),
+    Glyph::new(0x00F6, 0x29CA, 17, 15, 22, 1, -1),
+    Glyph::new(0x00F7, 0x2A0E, 18, 13, 13, 2, 3),
+    Glyph::new(0x00F8, 0x2A31, 17, 17, 16, 0, -1),
+    Glyph::new(0x00F9, 0x2A76, 19, 19, 25, 0, -1),
+    Glyph::new(0x00FA, 0x2AC3, 19, 19, 24, 0, -1),
+    Glyph::new(0x00FB, 0x2B10, 19, 19, 24, 0, -1),
+    Glyph::new(0x00FC, 0x2B61, 19, 19, 22, 0, -1),
+    Glyph::new(0x00FE, 0x2BB0, 18, 17, 29, 0, -7),
+    Glyph::new(0x00FF, 0x2BFF, 17, 17, 28, 0, -7),
+    Glyph::new(0x0104, 0x2C57, 21, 21, 26, 0, -6),
+    Glyph::new(0x0105, 0x2CAB, 16, 15, 21, 1, -6),
+    Glyph::new(0x0106, 0x2CEC, 18, 16, 28, 1, -1),
+    Glyph::new(0x0107, 0x2D34, 15, 13, 24, 1, -1),
+    Glyph::new(0x010C, 0x2D6C, 18, 16, 28, 1, -1),
+    Glyph::new(0x010D, 0x2DB6, 15, 13, 24, 1, -1),
+    Glyph::new(0x010E, 0x2DF4, 21, 19, 28, 1, -1),
+    Glyph::new(0x010F, 0x2E59, 19, 19, 23, 1, -1),
+    Glyph::new(0x0118, 0x2EB7, 18, 16, 26, 1, -6),
+    Glyph::new(0x0119, 0x2F05, 15, 13, 21, 1, -6),
+    Glyph::new(0x011A, 0x2F3D, 18, 16, 27, 1, 0),
+    Glyph::new(0x011B, 0x2F92, 15, 13, 24, 1, -1),
+    Glyph::new(0x0139, 0x2FD0, 17, 16, 27, 1, 0),
+    Glyph::new(0x013A, 0x3014, 10, 9, 29, 0, 0),
+    Glyph::new(0x013D, 0x303C, 17, 16, 22, 1, 0),
+    Glyph::new(0x013E, 0x307F, 10, 12, 22, 0, 0),
+    Glyph::new(0x0141, 0x30AF, 17, 18, 20, -1, 0),
+    Glyph::new(0x0142, 0x30F1, 10, 11, 22, -1, 0),
+    Glyph::new(0x0143, 0x311A, 23, 22, 28, 1, -1),
+    Glyph::new(0x0144, 0x3192, 19, 19, 23, 0, 0),
+    Glyph::new(0x0147, 0x31DD, 23, 22, 28, 1, -1),
+    Glyph::new(0x0148, 0x325B, 19, 19, 23, 0, 0),
+    Glyph::new(0x0152, 0x32AA, 28, 26, 21, 1, -1),
+    Glyph::new(0x0153, 0x3314, 26, 24, 16, 1, -1),
+    Glyph::new(0x0158, 0x3362, 19, 19, 28, 1, -1),
+    Glyph::new(0x0159, 0x33C4, 13, 13, 23, 0, 0),
+    Glyph::new(0x015A, 0x33FC, 16, 13, 28, 1, -1),
+    Glyph::new(0x015B, 0x3446, 14, 12, 24, 1, -1),
+    Glyph::new(0x0160, 0x3482, 16, 13, 28, 1, -1),
+    Glyph::new(0x0161, 0x34D3, 14, 12, 24, 1, -1),
+    Glyph::new(0x0164, 0x3515, 20, 18, 27, 1, 0),
+    Glyph::new(0x0165, 0x355D, 12, 11, 24, 0, -1),
+    Glyph::new(0x016E, 0x3595, 22, 22, 29, 0, -1),
+    Glyph::new(0x016F, 0x35FB, 19, 19, 25, 0, -1),
+    Glyph::new(0x0170, 0x364E, 22, 22, 29, 0, -1),
+    Glyph::new(0x0171, 0x36B4, 19, 19, 24, 0, -1),
+    Glyph::new(0x0178, 0x370A, 20, 19, 26, 0, 0),
+    Glyph::new(0x0179, 0x375F, 17, 16, 28, 0, -1),
+    Glyph::new(0x017A, 0x37AB, 15, 14, 24, 0, -1),
+    Glyph::new(0x017B, 0x37E8, 17, 16, 28, 0, -1),
+    Glyph::new(0x017C, 0x3832, 15, 14, 23, 0, -1),
+    Glyph::new(0x017D, 0x386D, 17, 16, 28, 0, -1),
+    Glyph::new(0x017E, 0x38BB, 15, 14, 24, 0, -1),
+    Glyph::new(0x03C0, 0x38FE, 19, 18, 16, 0, -1),
+    Glyph::new(0x1E9E, 0x393E, 21, 21, 21, 0, -1),
+    Glyph::new(0x2013, 0x3990, 14, 14, 3, 0, 6),
+    Glyph::new(0x2014, 0x3999, 28, 28, 3, 0, 6),
+    Glyph::new(0x2018, 0x39AB, 7, 5, 9, 1, 12),
+    Glyph::new(0x2019, 0x39BB, 7, 6, 9, 0, 12),
+    Glyph::new(0x201A, 0x39CB, 7, 6, 9, 0, -5),
+    Glyph::new(0x201B, 0x39DA, 7, 5, 9, 1, 12),
+    Glyph::new(0x201C, 0x39EA, 13, 11, 9, 1, 12),
+    Glyph::new(0x201D, 0x3A08, 13, 11, 9, 0, 12),
+    Glyph::new(0x201E, 0x3A24, 13, 11, 9, 0, -5),
+    Glyph::new(0x201F, 0x3A41, 13, 11, 9, 1, 12),
+    Glyph::new(0x2020, 0x3A5F, 14, 14, 19, 0, 1),
+    Glyph::new(0x2021, 0x3A8C, 14, 14, 22, 0, -2),
+    Glyph::new(0x2022, 0x3ACA, 9, 7, 6, 1, 4),
+    Glyph::new(0x2026, 0x3AD7, 28, 24, 5, 2, -1),
+    Glyph::new(0x2039, 0x3AF3, 9, 8, 11, 0, 2),
+    Glyph::new(0x203A, 0x3B05, 9, 8, 11, 1, 2),
+    Glyph::new(0x2070, 0x3B17, 13, 12, 14, 0, 10),
+    Glyph::new(0x2074, 0x3B41, 13, 11, 14, 1, 10),
+    Glyph::new(0x2075, 0x3B61, 13, 10, 13, 1, 10),
+    Glyph::new(0x2076, 0x3B82, 13, 11, 14, 1, 10),
+    Glyph::new(0x2077, 0x3BA7, 13, 10, 13, 2, 10),
+    Glyph::new(0x2078, 0x3BC8, 13, 10, 14, 1, 10),
+    Glyph::new(0x2079, 0x3BEE, 13, 10, 14, 1, 10),
+    Glyph::new(0x2080, 0x3C10, 13, 12, 14, 0, -5),
+    Glyph::new(0x2081, 0x3C3A, 13, 9, 14, 2, -4),
+    Glyph::new(0x2082, 0x3C56, 13, 11, 13, 1, -4),
+    Glyph::new(0x2083, 0x3C7A, 13, 10, 14, 1, -5),
+    Glyph::new(0x2084, 0x3C9B, 13, 11, 14, 1, -5),
+    Glyph::new(0x2085, 0x3CBD, 13, 10, 14, 1, -5),
+    Glyph::new(0x2086, 0x3CDF, 13, 11, 14, 1, -5),
+    Glyph::new(0x2087, 0x3D03, 13, 10, 14, 2, -5),
+    Glyph::new(0x2088, 0x3D24, 13, 10, 14, 1, -5),
+    Glyph::new(0x2089, 0x3D4A, 13, 10, 14, 1, -5),
+    Glyph::new(0x20AC, 0x3D6D, 18, 17, 21, 0, -1),
+    Glyph::new(0x2122, 0x3DAB, 24, 22, 10, 1, 10),
+    Glyph::new(0x2153, 0x3DF5, 31, 26, 23, 2, -2),
+    Glyph::new(0x2154, 0x3E64, 31, 27, 23, 1, -2),
+    Glyph::new(0x215B, 0x3ED3, 31, 27, 23, 2, -2),
+    Glyph::new(0x215C, 0x3F48, 31, 28, 23, 1, -2),
+    Glyph::new(0x215D, 0x3FC1, 31, 28, 23, 1, -2),
+    Glyph::new(0x215E, 0x4033, 31, 27, 23, 2, -2),
+    Glyph::new(0x2190, 0x40A4, 28, 16, 12, 6, 4),
+    Glyph::new(0x2191, 0x40C5, 28, 12, 19, 8, 0),
+    Glyph::new(0x2192, 0x40ED, 28, 16, 12, 6, 4),
+    Glyph::new(0x2193, 0x410E, 28, 12, 19, 8, 0),
+    Glyph::new(0x2194, 0x4133, 28, 18, 12, 5, 4),
+    Glyph::new(0x2195, 0x415E, 28, 12, 19, 8, 0),
+    Glyph::new(0x21D0, 0x418E, 28, 16, 13, 6, 3),
+    Glyph::new(0x21D1, 0x41BC, 28, 12, 17, 8, 1),
+    Glyph::new(0x21D2, 0x41EB, 28, 16, 13, 6, 3),
+    Glyph::new(0x21D3, 0x4219, 28, 12, 17, 8, 1),
+    Glyph::new(0x21D4, 0x4242, 28, 18, 13, 5, 3),
+    Glyph::new(0x2202, 0x4277, 18, 14, 23, 2, -1),
+    Glyph::new(0x2206, 0x42BE, 19, 18, 20, 0, 0),
+    Glyph::new(0x220F, 0x42FB, 23, 21, 25, 1, -5),
+    Glyph::new(0x2211, 0x436D, 18, 17, 25, 0, -5),
+    Glyph::new(0x221A, 0x43C0, 18, 18, 27, 0, -4),
+    Glyph::new(0x221E, 0x4408, 18, 18, 10, 0, 4),
+    Glyph::new(0x222B, 0x4439, 18, 15, 29, 1, -7),
+    Glyph::new(0x2260, 0x4473, 18, 13, 13, 2, 3),
+    Glyph::new(0x2264, 0x448C, 18, 13, 17, 2, 0),
+    Glyph::new(0x2265, 0x44B0, 18, 13, 17, 2, 0),
+    Glyph::new(0xFB01, 0x44D3, 22, 21, 22, 0, 0),
+    Glyph::new(0xFB02, 0x4524, 22, 21, 22, 0, 0),
 ];
 
-const BITMAP_BW: &[u8; 11527] = include_bytes!("./bookerly_28.bw");
-const BITMAP_MSB: &[u8; 11527] = include_bytes!("./bookerly_28.msb");
-const BITMAP_LSB: &[u8; 11527] = include_bytes!("./bookerly_28.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (2, 2),
+    (3, 3), (4, 4), (0, 0), (0, 0), (5, 5), (6, 6), (7, 7), (8, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (9, 9), (10, 10), (0, 0), (0, 0), (0, 0), (11, 11),
+    (0, 0), (12, 12), (13, 13), (14, 14), (15, 13), (16, 15), (17, 15), (18, 16),
+    (19, 15), (19, 15), (20, 17), (21, 15), (22, 15), (23, 18), (24, 15), (25, 19),
+    (26, 13), (27, 19), (28, 13), (29, 20), (30, 21), (31, 22), (32, 23), (33, 24),
+    (34, 25), (35, 26), (36, 27), (37, 28), (0, 0), (38, 29), (0, 0), (0, 0),
+    (0, 0), (39, 30), (40, 31), (41, 32), (42, 32), (43, 32), (44, 33), (45, 34),
+    (46, 35), (47, 36), (48, 37), (49, 35), (50, 38), (51, 39), (51, 39), (52, 32),
+    (53, 40), (54, 32), (55, 39), (56, 41), (57, 42), (39, 43), (58, 44), (59, 45),
+    (57, 46), (58, 47), (60, 48), (61, 49), (0, 0), (62, 50), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (63, 51), (64, 52),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (65, 53), (0, 0), (0, 0),
+    (0, 0), (66, 54), (67, 55), (0, 0), (0, 0), (0, 0), (0, 0), (12, 12),
+    (12, 12), (12, 12), (12, 12), (12, 12), (12, 12), (68, 12), (14, 14), (16, 15),
+    (16, 15), (16, 15), (16, 15), (19, 15), (19, 15), (69, 56), (69, 57), (15, 58),
+    (24, 15), (25, 19), (25, 19), (25, 19), (25, 19), (25, 19), (0, 0), (70, 59),
+    (31, 22), (31, 22), (31, 22), (31, 22), (71, 15), (72, 60), (39, 61), (39, 30),
+    (42, 62), (42, 61), (42, 63), (73, 64), (74, 30), (75, 32), (43, 65), (76, 32),
+    (77, 66), (78, 67), (42, 68), (79, 69), (80, 70), (81, 71), (82, 32), (83, 39),
+    (52, 65), (52, 32), (84, 72), (85, 66), (85, 66), (0, 0), (86, 73), (39, 43),
+    (39, 43), (39, 43), (39, 74), (87, 75), (58, 76), (88, 12), (89, 30), (14, 14),
+    (90, 32), (14, 14), (90, 77), (15, 13), (91, 32), (92, 15), (93, 32), (16, 15),
+    (94, 77), (22, 15), (50, 38), (95, 15), (96, 38), (22, 78), (97, 79), (24, 15),
+    (51, 39), (24, 15), (51, 39), (98, 80), (43, 32), (28, 13), (99, 81), (29, 20),
+    (100, 41), (29, 20), (101, 82), (30, 21), (102, 42), (31, 22), (39, 43), (31, 22),
+    (73, 43), (35, 26), (36, 27), (103, 48), (36, 27), (60, 48), (36, 27), (103, 83),
+    (104, 84), (105, 85), (106, 86), (106, 86), (107, 87), (108, 88), (109, 89), (0, 0),
+    (107, 87), (110, 88), (5, 89), (0, 0), (0, 0), (0, 0), (0, 0), (111, 90),
+    (112, 52), (113, 55), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (47, 33), (50, 33),
+];
+
+const KERNING: [&[i8]; 114] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, -1, -2, 0, 0, -2, -2, -1, -2, 0, -1, -1, -1, -2, -1, -2, 0, -1, -2, -2, -1, 0, 0, 0, -1, 0, -1, -1, 0, -2, 0, -2, -1, 0, 0, -1, 0, 0, -1, 0, -2, -2, -2, -2, -2, -1, 0, -1, -2, 0, -2, -2, -1, -2, -2, 0, 0, -1, -1, -1, -1, -2, -1, -2, -2, -2, -1, 0, -1, -1, 0, -2, -1, -2, 0, 0, -1, -1, 0, -2, -1, -1, -1, -2, -1, -2, -1, 0, 0, -2],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -2],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2, -2, 0, -1, 0, -1, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1, -2, -2, 0, -2, 0, -2, -1, 0, 0, -2, -1, -2, -2, -2, -2, -1, -1, -2, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -2, -2, -1, -2, -1, 0, -1, -1, -2, -2, -2, -2, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, -1, -2, -2, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, 0, -1, -1, 0, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -2, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -2, -1, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, -2, -1, -2, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -2, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, -2, -2, -2, -2, -2, -1, -1, -1, -2, -1, 0, -1, 0, -1, -2, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -2, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -2, 0, -1, -1, -1, -2, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, -1],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -1, -2, -2, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -2, 0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, 0, 0, 0, -1, -2, -2, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2],
+    &[0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -2, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, -1, 0, -1, -1, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -2, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -2, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -2, 0, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, -1, 0, -2, 0, -2, -2, -2, -2, -2, -2, -1, -2, 0, -2, 0, -2, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -2, -2, -2, 0, -1, -1, 0, -2, -1, -2, -1, -1, -1, -2, -2, -1, -2, -1, 0, -1, -2, -2, -1, -2, 0, 0, 0, -2, -2, -1, -1, -1, -2, -2, -2, -1, 0, -1, 0, 0, -2, -2, -1, 0, -1, -2, 0, 0, -2, -1, -1, -1, -2, -2, -2, -1, 0, -2, -2],
+    &[0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, -1, 0, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -2, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -2, 0, -1, 0, 0, -2, -1, -2, -1, -1, -1, -2, -2, -1, -2, -1, 0, 0, -2, -2, 0, -2, 0, 0, 0, -2, -1, -1, -1, 0, -1, -2, -1, -1, 0, -1, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, -2, -1, -1, -1, -2, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, -1, -2, 0, 0, -2, -2, -2, -2, 0, -1, -1, -2, -2, -1, -2, 0, -1, -2, -2, -1, 0, 0, 0, -1, 0, -1, -1, 0, -2, 0, -2, -2, 0, 0, -1, 0, 0, -2, -1, -2, -1, -1, -1, -2, -1, 0, -2, -2, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -2, -1, -2, -1, -2, -2, -2, -1, 0, -2, -1, 0, -2, -2, -1, 0, 0, -1, -1, 0, -2, -1, -1, -1, -2, -1, -1, -1, 0, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, 0, -1, 0, -2, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -2, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -2, -1, 0, 0, -1, -1, -2, -2, -1, -2, -1, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -2],
+    &[0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -2, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2, -2, -2, 0, -2, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -2],
+    &[0, 0, 0, 0, -1, -2, -2, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, -1, -1, -1, 0, 0, -1, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, -2, -1, -1, -1, -1, -1, 0, -1, -1, 0, -2, -1, 0, -2, -2, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -2],
+    &[0, -1, -1, 0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -2],
+    &[0, -1, -1, 0, -2, 0, -1, 0, -2, -1, -1, -2, -2, -1, 0, -1, 0, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, -1, -1, 0, -1, 0, -2, -1, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -2, -2, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2],
+    &[0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, -1, -1, 0, -2, -2, 0, -2, -2, -1, -1, -1, -2, -2, 0, -2, 0, -2, -1, 0, -1, -1, -1, -2, -2, -2, -2, -1, -1, -2, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -2, -2, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -2, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, -1, -1, -1, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, 0, -1, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -2, -1, 0, 0, -1, -1, -1, -2, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -2, -1, 0, 0, -1, -1, -2, -2, -1, -2, -1, -1, -2, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -2, -1, -2, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -2, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, -2, -2, -1, 0, -1, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -2, -1, -2, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -2, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -2, -1, 0, -1, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, -1, -1, -1, -1, -1, -2, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -2, 0, -1, -1, -1, -2, -2, 0, -1, -1, -1, -1, -2, 0, -2, -1, -2, -2, -2, -2, 0, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -2, 0, -1, -2, -1, -2, -2, -2, -2, 0, -2, -1, -2, -2, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, 0, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -2],
+    &[0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -2, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -1, -2, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -2, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 17778] = include_bytes!("./bookerly_28.rle");
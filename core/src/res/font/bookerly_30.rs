@@ -1,308 +1,521 @@
 // Auto-generated font file
 // Font: Bookerly
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 13055,
+    size: 19421,
     y_advance: 30,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 9, 5, 24, 2, -1),
-    Glyph::new(0x0022, 0x000F, 12, 9, 10, 1, 12),
-    Glyph::new(0x0023, 0x001B, 19, 19, 19, 0, -2),
-    Glyph::new(0x0024, 0x0049, 19, 15, 30, 2, -6),
-    Glyph::new(0x0025, 0x0082, 30, 27, 24, 1, -2),
-    Glyph::new(0x0026, 0x00D3, 25, 23, 23, 1, -1),
-    Glyph::new(0x0027, 0x0116, 6, 4, 10, 1, 12),
-    Glyph::new(0x0028, 0x011B, 11, 10, 30, 1, -6),
-    Glyph::new(0x0029, 0x0141, 11, 10, 30, 0, -6),
-    Glyph::new(0x002A, 0x0167, 12, 11, 10, 0, 12),
-    Glyph::new(0x002B, 0x0175, 19, 13, 14, 3, 3),
-    Glyph::new(0x002C, 0x018C, 9, 7, 10, 0, -6),
-    Glyph::new(0x002D, 0x0195, 12, 10, 3, 1, 6),
-    Glyph::new(0x002E, 0x0199, 9, 6, 5, 1, -1),
-    Glyph::new(0x002F, 0x019D, 15, 13, 24, 1, -2),
-    Glyph::new(0x0030, 0x01C4, 19, 17, 22, 1, -1),
-    Glyph::new(0x0031, 0x01F3, 19, 12, 21, 3, 0),
-    Glyph::new(0x0032, 0x0213, 19, 15, 21, 2, 0),
-    Glyph::new(0x0033, 0x023B, 19, 14, 22, 2, -1),
-    Glyph::new(0x0034, 0x0262, 19, 17, 22, 1, -1),
-    Glyph::new(0x0035, 0x0291, 19, 14, 22, 2, -1),
-    Glyph::new(0x0036, 0x02B8, 19, 15, 22, 2, -1),
-    Glyph::new(0x0037, 0x02E2, 19, 14, 22, 3, -1),
-    Glyph::new(0x0038, 0x0309, 19, 15, 22, 2, -1),
-    Glyph::new(0x0039, 0x0333, 19, 16, 22, 1, -1),
-    Glyph::new(0x003A, 0x035F, 9, 6, 16, 1, -1),
-    Glyph::new(0x003B, 0x036B, 9, 7, 21, 0, -6),
-    Glyph::new(0x003C, 0x037E, 19, 13, 14, 3, 3),
-    Glyph::new(0x003D, 0x0395, 19, 13, 8, 3, 6),
-    Glyph::new(0x003E, 0x03A2, 19, 13, 14, 3, 3),
-    Glyph::new(0x003F, 0x03B9, 15, 11, 23, 2, -1),
-    Glyph::new(0x0040, 0x03D9, 29, 27, 27, 1, -6),
-    Glyph::new(0x0041, 0x0435, 23, 23, 22, 0, 0),
-    Glyph::new(0x0042, 0x0475, 19, 17, 23, 1, -1),
-    Glyph::new(0x0043, 0x04A6, 20, 17, 23, 1, -1),
-    Glyph::new(0x0044, 0x04D7, 23, 21, 23, 1, -1),
-    Glyph::new(0x0045, 0x0514, 19, 17, 21, 1, 0),
-    Glyph::new(0x0046, 0x0541, 18, 16, 21, 1, 0),
-    Glyph::new(0x0047, 0x056B, 22, 20, 23, 1, -1),
-    Glyph::new(0x0048, 0x05A5, 26, 23, 21, 1, 0),
-    Glyph::new(0x0049, 0x05E2, 12, 10, 21, 1, 0),
-    Glyph::new(0x004A, 0x05FD, 11, 13, 28, -2, -7),
-    Glyph::new(0x004B, 0x062B, 22, 21, 22, 1, -1),
-    Glyph::new(0x004C, 0x0665, 19, 17, 21, 1, 0),
-    Glyph::new(0x004D, 0x0692, 27, 27, 21, 0, 0),
-    Glyph::new(0x004E, 0x06D9, 25, 23, 22, 1, -1),
-    Glyph::new(0x004F, 0x0719, 24, 21, 23, 1, -1),
-    Glyph::new(0x0050, 0x0756, 18, 17, 22, 1, 0),
-    Glyph::new(0x0051, 0x0785, 24, 23, 28, 1, -6),
-    Glyph::new(0x0052, 0x07D6, 21, 20, 23, 1, -1),
-    Glyph::new(0x0053, 0x0810, 17, 14, 23, 1, -1),
-    Glyph::new(0x0054, 0x0839, 21, 19, 21, 1, 0),
-    Glyph::new(0x0055, 0x086B, 24, 23, 22, 0, -1),
-    Glyph::new(0x0056, 0x08AB, 23, 22, 22, 0, -1),
-    Glyph::new(0x0057, 0x08E8, 34, 33, 22, 0, -1),
-    Glyph::new(0x0058, 0x0943, 22, 22, 21, 0, 0),
-    Glyph::new(0x0059, 0x097D, 21, 21, 21, 0, 0),
-    Glyph::new(0x005A, 0x09B5, 18, 16, 22, 1, -1),
-    Glyph::new(0x005B, 0x09E1, 10, 6, 29, 2, -5),
-    Glyph::new(0x005C, 0x09F7, 15, 13, 24, 1, -2),
-    Glyph::new(0x005D, 0x0A1E, 10, 7, 29, 1, -5),
-    Glyph::new(0x005E, 0x0A38, 19, 15, 15, 2, 5),
-    Glyph::new(0x005F, 0x0A55, 15, 15, 3, 0, -4),
-    Glyph::new(0x0060, 0x0A5B, 21, 7, 8, 6, 17),
-    Glyph::new(0x0061, 0x0A62, 17, 16, 17, 1, -1),
-    Glyph::new(0x0062, 0x0A84, 18, 18, 25, -1, -1),
-    Glyph::new(0x0063, 0x0ABD, 16, 14, 17, 1, -1),
-    Glyph::new(0x0064, 0x0ADB, 19, 18, 25, 1, -1),
-    Glyph::new(0x0065, 0x0B14, 16, 14, 17, 1, -1),
-    Glyph::new(0x0066, 0x0B32, 13, 15, 24, 0, 0),
-    Glyph::new(0x0067, 0x0B5F, 18, 18, 24, 0, -8),
-    Glyph::new(0x0068, 0x0B95, 20, 20, 24, 0, 0),
-    Glyph::new(0x0069, 0x0BD1, 10, 10, 24, 0, 0),
-    Glyph::new(0x006A, 0x0BEF, 9, 9, 32, -2, -8),
-    Glyph::new(0x006B, 0x0C13, 19, 18, 25, 0, -1),
-    Glyph::new(0x006C, 0x0C4C, 10, 10, 24, 0, 0),
-    Glyph::new(0x006D, 0x0C6A, 30, 30, 16, 0, 0),
-    Glyph::new(0x006E, 0x0CA6, 21, 20, 16, 0, 0),
-    Glyph::new(0x006F, 0x0CCE, 18, 16, 17, 1, -1),
-    Glyph::new(0x0070, 0x0CF0, 19, 18, 23, 0, -7),
-    Glyph::new(0x0071, 0x0D24, 18, 17, 23, 1, -7),
-    Glyph::new(0x0072, 0x0D55, 14, 14, 16, 0, 0),
-    Glyph::new(0x0073, 0x0D71, 15, 12, 17, 1, -1),
-    Glyph::new(0x0074, 0x0D8B, 13, 12, 21, 0, -1),
-    Glyph::new(0x0075, 0x0DAB, 20, 20, 17, 0, -1),
-    Glyph::new(0x0076, 0x0DD6, 18, 18, 17, 0, -1),
-    Glyph::new(0x0077, 0x0DFD, 27, 27, 17, 0, -1),
-    Glyph::new(0x0078, 0x0E37, 18, 18, 16, 0, 0),
-    Glyph::new(0x0079, 0x0E5B, 18, 18, 24, 0, -8),
-    Glyph::new(0x007A, 0x0E91, 16, 15, 17, 0, -1),
-    Glyph::new(0x007B, 0x0EB1, 12, 9, 30, 2, -6),
-    Glyph::new(0x007C, 0x0ED3, 9, 4, 27, 2, -4),
-    Glyph::new(0x007D, 0x0EE1, 12, 10, 30, 0, -6),
-    Glyph::new(0x007E, 0x0F07, 19, 15, 6, 2, 7),
-    Glyph::new(0x00A1, 0x0F13, 9, 5, 24, 1, -8),
-    Glyph::new(0x00A2, 0x0F22, 19, 14, 29, 2, -6),
-    Glyph::new(0x00A3, 0x0F55, 19, 17, 22, 1, -1),
-    Glyph::new(0x00A4, 0x0F84, 19, 17, 15, 1, 3),
-    Glyph::new(0x00A5, 0x0FA4, 19, 20, 21, -1, 0),
-    Glyph::new(0x00A7, 0x0FD9, 16, 13, 24, 1, -3),
-    Glyph::new(0x00A9, 0x1000, 24, 23, 23, 0, -1),
-    Glyph::new(0x00AA, 0x1043, 14, 11, 15, 1, 7),
-    Glyph::new(0x00AB, 0x1058, 16, 15, 12, 1, 2),
-    Glyph::new(0x00AE, 0x106F, 18, 17, 17, 0, 7),
-    Glyph::new(0x00B0, 0x1094, 16, 10, 10, 3, 11),
-    Glyph::new(0x00B1, 0x10A1, 19, 13, 18, 3, 0),
-    Glyph::new(0x00B2, 0x10BF, 14, 10, 14, 2, 11),
-    Glyph::new(0x00B3, 0x10D1, 14, 10, 15, 2, 10),
-    Glyph::new(0x00B5, 0x10E4, 21, 19, 23, 2, -7),
-    Glyph::new(0x00B6, 0x111B, 17, 16, 26, 0, -5),
-    Glyph::new(0x00B7, 0x114F, 9, 6, 5, 1, 6),
-    Glyph::new(0x00B9, 0x1153, 14, 9, 14, 2, 11),
-    Glyph::new(0x00BA, 0x1163, 14, 11, 15, 1, 7),
-    Glyph::new(0x00BB, 0x1178, 16, 16, 12, 1, 2),
-    Glyph::new(0x00BC, 0x1190, 33, 29, 24, 2, -2),
-    Glyph::new(0x00BD, 0x11E7, 33, 29, 24, 2, -2),
-    Glyph::new(0x00BE, 0x123E, 33, 30, 24, 2, -2),
-    Glyph::new(0x00BF, 0x1298, 15, 11, 23, 1, -7),
-    Glyph::new(0x00C0, 0x12B8, 23, 23, 29, 0, 0),
-    Glyph::new(0x00C1, 0x130C, 23, 23, 29, 0, 0),
-    Glyph::new(0x00C2, 0x1360, 23, 23, 29, 0, 0),
-    Glyph::new(0x00C3, 0x13B4, 23, 23, 29, 0, 0),
-    Glyph::new(0x00C4, 0x1408, 23, 23, 28, 0, 0),
-    Glyph::new(0x00C5, 0x1459, 23, 23, 30, 0, 0),
-    Glyph::new(0x00C6, 0x14B0, 28, 28, 21, -1, 0),
-    Glyph::new(0x00C7, 0x14FA, 20, 17, 30, 1, -8),
-    Glyph::new(0x00C8, 0x153A, 19, 17, 29, 1, 0),
-    Glyph::new(0x00C9, 0x1578, 19, 17, 29, 1, 0),
-    Glyph::new(0x00CA, 0x15B6, 19, 17, 29, 1, 0),
-    Glyph::new(0x00CB, 0x15F4, 19, 17, 28, 1, 0),
-    Glyph::new(0x00CC, 0x1630, 12, 10, 29, 1, 0),
-    Glyph::new(0x00CD, 0x1655, 12, 10, 29, 1, 0),
-    Glyph::new(0x00CE, 0x167A, 12, 11, 29, 0, 0),
-    Glyph::new(0x00CF, 0x16A2, 12, 11, 28, 0, 0),
-    Glyph::new(0x00D0, 0x16C9, 23, 22, 23, 0, -1),
-    Glyph::new(0x00D1, 0x1709, 25, 23, 30, 1, -1),
-    Glyph::new(0x00D2, 0x1760, 24, 21, 30, 1, -1),
-    Glyph::new(0x00D3, 0x17AF, 24, 21, 30, 1, -1),
-    Glyph::new(0x00D4, 0x17FE, 24, 21, 30, 1, -1),
-    Glyph::new(0x00D5, 0x184D, 24, 21, 30, 1, -1),
-    Glyph::new(0x00D6, 0x189C, 24, 21, 29, 1, -1),
-    Glyph::new(0x00D7, 0x18E9, 19, 13, 13, 3, 4),
-    Glyph::new(0x00D8, 0x18FF, 24, 23, 23, 0, -1),
-    Glyph::new(0x00D9, 0x1942, 24, 23, 30, 0, -1),
-    Glyph::new(0x00DA, 0x1999, 24, 23, 30, 0, -1),
-    Glyph::new(0x00DB, 0x19F0, 24, 23, 30, 0, -1),
-    Glyph::new(0x00DC, 0x1A47, 24, 23, 29, 0, -1),
-    Glyph::new(0x00DE, 0x1A9B, 19, 17, 21, 1, 0),
-    Glyph::new(0x00DF, 0x1AC8, 20, 19, 25, 0, -1),
-    Glyph::new(0x00E0, 0x1B04, 17, 16, 26, 1, -1),
-    Glyph::new(0x00E1, 0x1B38, 17, 16, 26, 1, -1),
-    Glyph::new(0x00E2, 0x1B6C, 17, 16, 25, 1, -1),
-    Glyph::new(0x00E3, 0x1B9E, 17, 16, 25, 1, -1),
-    Glyph::new(0x00E4, 0x1BD0, 17, 16, 24, 1, -1),
-    Glyph::new(0x00E5, 0x1C00, 17, 16, 26, 1, -1),
-    Glyph::new(0x00E6, 0x1C34, 25, 23, 17, 1, -1),
-    Glyph::new(0x00E7, 0x1C65, 16, 14, 24, 1, -8),
-    Glyph::new(0x00E8, 0x1C8F, 16, 14, 26, 1, -1),
-    Glyph::new(0x00E9, 0x1CBD, 16, 14, 26, 1, -1),
-    Glyph::new(0x00EA, 0x1CEB, 16, 14, 25, 1, -1),
-    Glyph::new(0x00EB, 0x1D17, 16, 14, 24, 1, -1),
-    Glyph::new(0x00EC, 0x1D41, 10, 10, 25, 0, 0),
-    Glyph::new(0x00ED, 0x1D61, 10, 10, 25, 0, 0),
-    Glyph::new(0x00EE, 0x1D81, 10, 10, 24, 0, 0),
-    Glyph::new(0x00EF, 0x1D9F, 10, 11, 23, -1, 0),
-    Glyph::new(0x00F0, 0x1DBF, 18, 16, 26, 1, -1),
-    Glyph::new(0x00F1, 0x1DF3, 21, 20, 24, 0, 0),
-    Glyph::new(0x00F2, 0x1E2F, 18, 16, 26, 1, -1),
-    Glyph::new(0x00F3, 0x1E63, 18, 16, 26, 1, -1),
-    Glyph::new(0x00F4, 0x1E97, 18, 16, 25, 1, -1),
-    Glyph::new(0x00F5, 0x1EC9, 18, 16, 25, 1, -1),
-    Glyph::new(0x00F6, 0x1EFB, 18, 16, 24, 1, -1),
-    Glyph::new(0x00F7, 0x1F2B, 19, 13, 14, 3, 3),
-    Glyph::new(0x00F8, 0x1F42, 18, 18, 17, 0, -1),
-    Glyph::new(0x00F9, 0x1F69, 20, 20, 26, 0, -1),
-    Glyph::new(0x00FA, 0x1FAA, 20, 20, 26, 0, -1),
-    Glyph::new(0x00FB, 0x1FEB, 20, 20, 25, 0, -1),
-    Glyph::new(0x00FC, 0x202A, 20, 20, 24, 0, -1),
-    Glyph::new(0x00FE, 0x2066, 19, 18, 31, 0, -7),
-    Glyph::new(0x00FF, 0x20AC, 18, 18, 31, 0, -8),
-    Glyph::new(0x0104, 0x20F2, 23, 23, 29, 0, -7),
-    Glyph::new(0x0105, 0x2146, 17, 16, 23, 1, -7),
-    Glyph::new(0x0106, 0x2174, 20, 17, 30, 1, -1),
-    Glyph::new(0x0107, 0x21B4, 16, 14, 26, 1, -1),
-    Glyph::new(0x010C, 0x21E2, 20, 17, 30, 1, -1),
-    Glyph::new(0x010D, 0x2222, 16, 14, 26, 1, -1),
-    Glyph::new(0x010E, 0x2250, 23, 21, 30, 1, -1),
-    Glyph::new(0x010F, 0x229F, 20, 20, 25, 1, -1),
-    Glyph::new(0x0118, 0x22DE, 19, 17, 28, 1, -7),
-    Glyph::new(0x0119, 0x231A, 16, 14, 23, 1, -7),
-    Glyph::new(0x011A, 0x2343, 19, 17, 29, 1, 0),
-    Glyph::new(0x011B, 0x2381, 16, 14, 26, 1, -1),
-    Glyph::new(0x0139, 0x23AF, 19, 17, 29, 1, 0),
-    Glyph::new(0x013A, 0x23ED, 10, 10, 31, 0, 0),
-    Glyph::new(0x013D, 0x2414, 19, 17, 24, 1, 0),
-    Glyph::new(0x013E, 0x2447, 11, 12, 24, 0, 0),
-    Glyph::new(0x0141, 0x246B, 19, 19, 21, -1, 0),
-    Glyph::new(0x0142, 0x249D, 10, 12, 24, -1, 0),
-    Glyph::new(0x0143, 0x24C1, 25, 23, 30, 1, -1),
-    Glyph::new(0x0144, 0x2518, 21, 20, 25, 0, 0),
-    Glyph::new(0x0147, 0x2557, 25, 23, 30, 1, -1),
-    Glyph::new(0x0148, 0x25AE, 21, 20, 25, 0, 0),
-    Glyph::new(0x0152, 0x25ED, 30, 27, 22, 1, -1),
-    Glyph::new(0x0153, 0x2638, 28, 25, 17, 1, -1),
-    Glyph::new(0x0158, 0x266E, 21, 20, 30, 1, -1),
-    Glyph::new(0x0159, 0x26B9, 14, 14, 25, 0, 0),
-    Glyph::new(0x015A, 0x26E5, 17, 14, 30, 1, -1),
-    Glyph::new(0x015B, 0x271A, 15, 12, 26, 1, -1),
-    Glyph::new(0x0160, 0x2741, 17, 14, 30, 1, -1),
-    Glyph::new(0x0161, 0x2776, 15, 12, 26, 1, -1),
-    Glyph::new(0x0164, 0x279D, 21, 19, 29, 1, 0),
-    Glyph::new(0x0165, 0x27E2, 13, 12, 25, 0, -1),
-    Glyph::new(0x016E, 0x2808, 24, 23, 31, 0, -1),
-    Glyph::new(0x016F, 0x2862, 20, 20, 26, 0, -1),
-    Glyph::new(0x0170, 0x28A3, 24, 23, 31, 0, -1),
-    Glyph::new(0x0171, 0x28FD, 20, 20, 26, 0, -1),
-    Glyph::new(0x0178, 0x293E, 21, 21, 28, 0, 0),
-    Glyph::new(0x0179, 0x2988, 18, 16, 30, 1, -1),
-    Glyph::new(0x017A, 0x29C4, 16, 15, 26, 0, -1),
-    Glyph::new(0x017B, 0x29F5, 18, 16, 29, 1, -1),
-    Glyph::new(0x017C, 0x2A2F, 16, 15, 24, 0, -1),
-    Glyph::new(0x017D, 0x2A5C, 18, 16, 30, 1, -1),
-    Glyph::new(0x017E, 0x2A98, 16, 15, 26, 0, -1),
-    Glyph::new(0x03C0, 0x2AC9, 20, 20, 17, 0, -1),
-    Glyph::new(0x1E9E, 0x2AF4, 23, 22, 23, 0, -1),
-    Glyph::new(0x2013, 0x2B34, 15, 15, 3, 0, 6),
-    Glyph::new(0x2014, 0x2B3A, 30, 30, 3, 0, 6),
-    Glyph::new(0x2018, 0x2B46, 8, 6, 10, 1, 13),
-    Glyph::new(0x2019, 0x2B4E, 8, 6, 10, 0, 13),
-    Glyph::new(0x201A, 0x2B56, 8, 6, 10, 0, -6),
-    Glyph::new(0x201B, 0x2B5E, 8, 6, 10, 1, 13),
-    Glyph::new(0x201C, 0x2B66, 14, 12, 10, 1, 13),
-    Glyph::new(0x201D, 0x2B75, 14, 12, 10, 0, 13),
-    Glyph::new(0x201E, 0x2B84, 14, 12, 10, 0, -6),
-    Glyph::new(0x201F, 0x2B93, 14, 12, 10, 1, 13),
-    Glyph::new(0x2020, 0x2BA2, 15, 13, 20, 1, 2),
-    Glyph::new(0x2021, 0x2BC3, 15, 13, 24, 1, -2),
-    Glyph::new(0x2022, 0x2BEA, 9, 7, 7, 1, 4),
-    Glyph::new(0x2026, 0x2BF1, 30, 26, 5, 2, -1),
-    Glyph::new(0x2039, 0x2C02, 10, 8, 12, 1, 2),
-    Glyph::new(0x203A, 0x2C0E, 10, 8, 12, 1, 2),
-    Glyph::new(0x2070, 0x2C1A, 14, 12, 15, 1, 10),
-    Glyph::new(0x2074, 0x2C31, 14, 12, 15, 1, 10),
-    Glyph::new(0x2075, 0x2C48, 14, 10, 15, 1, 10),
-    Glyph::new(0x2076, 0x2C5B, 14, 11, 15, 1, 10),
-    Glyph::new(0x2077, 0x2C70, 14, 10, 15, 2, 10),
-    Glyph::new(0x2078, 0x2C83, 14, 11, 15, 1, 10),
-    Glyph::new(0x2079, 0x2C98, 14, 11, 15, 1, 10),
-    Glyph::new(0x2080, 0x2CAD, 14, 12, 15, 1, -5),
-    Glyph::new(0x2081, 0x2CC4, 14, 9, 14, 2, -4),
-    Glyph::new(0x2082, 0x2CD4, 14, 10, 14, 2, -4),
-    Glyph::new(0x2083, 0x2CE6, 14, 10, 15, 2, -5),
-    Glyph::new(0x2084, 0x2CF9, 14, 12, 15, 1, -5),
-    Glyph::new(0x2085, 0x2D10, 14, 10, 15, 1, -5),
-    Glyph::new(0x2086, 0x2D23, 14, 11, 15, 1, -5),
-    Glyph::new(0x2087, 0x2D38, 14, 10, 15, 2, -5),
-    Glyph::new(0x2088, 0x2D4B, 14, 11, 15, 1, -5),
-    Glyph::new(0x2089, 0x2D60, 14, 11, 15, 1, -5),
-    Glyph::new(0x20AC, 0x2D75, 19, 18, 22, 0, -1),
-    Glyph::new(0x2122, 0x2DA7, 25, 23, 11, 1, 10),
-    Glyph::new(0x2153, 0x2DC7, 33, 28, 24, 2, -2),
-    Glyph::new(0x2154, 0x2E1B, 33, 28, 24, 2, -2),
-    Glyph::new(0x215B, 0x2E6F, 33, 29, 24, 2, -2),
-    Glyph::new(0x215C, 0x2EC6, 33, 29, 24, 2, -2),
-    Glyph::new(0x215D, 0x2F1D, 33, 30, 24, 1, -2),
-    Glyph::new(0x215E, 0x2F77, 33, 29, 24, 2, -2),
-    Glyph::new(0x2190, 0x2FCE, 30, 18, 13, 6, 4),
-    Glyph::new(0x2191, 0x2FEC, 30, 12, 20, 9, 0),
-    Glyph::new(0x2192, 0x300A, 30, 18, 13, 6, 4),
-    Glyph::new(0x2193, 0x3028, 30, 12, 20, 9, 0),
-    Glyph::new(0x2194, 0x3046, 30, 18, 13, 6, 4),
-    Glyph::new(0x2195, 0x3064, 30, 12, 21, 9, 0),
-    Glyph::new(0x21D0, 0x3084, 30, 18, 14, 6, 3),
-    Glyph::new(0x21D1, 0x30A4, 30, 14, 18, 8, 1),
-    Glyph::new(0x21D2, 0x30C4, 30, 18, 14, 6, 3),
-    Glyph::new(0x21D3, 0x30E4, 30, 14, 18, 8, 1),
-    Glyph::new(0x21D4, 0x3104, 30, 18, 14, 6, 3),
-    Glyph::new(0x2202, 0x3124, 19, 15, 25, 2, -1),
-    Glyph::new(0x2206, 0x3153, 20, 19, 22, 0, 0),
-    Glyph::new(0x220F, 0x3188, 25, 23, 26, 1, -5),
-    Glyph::new(0x2211, 0x31D3, 19, 18, 26, 0, -5),
-    Glyph::new(0x221A, 0x320E, 19, 19, 29, 0, -4),
-    Glyph::new(0x221E, 0x3253, 19, 19, 11, 0, 4),
-    Glyph::new(0x222B, 0x326E, 19, 16, 31, 1, -7),
-    Glyph::new(0x2260, 0x32AC, 19, 13, 14, 3, 3),
-    Glyph::new(0x2264, 0x32C3, 19, 13, 18, 3, 0),
-    Glyph::new(0x2265, 0x32E1, 19, 13, 18, 3, 0),
+    Glyph::new(0x0022, 0x0027, 12, 9, 10, 1, 12),
+    Glyph::new(0x0023, 0x0043, 19, 19, 19, 0, -2),
+    Glyph::new(0x0024, 0x0092, 19, 15, 30, 2, -6),
+    Glyph::new(0x0025, 0x00ED, 30, 27, 24, 1, -2),
+    Glyph::new(0x0026, 0x016B, 25, 23, 23, 1, -1),
+    Glyph::new(0x0027, 0x01D2, 6, 4, 10, 1, 12),
+    Glyph::new(0x0028, 0x01E0, 11, 10, 30, 1, -6),
+    Glyph::new(0x0029, 0x0219, 11, 10, 30, 0, -6),
+    Glyph::new(0x002A, 0x0251, 12, 11, 10, 0, 12),
+    Glyph::new(0x002B, 0x0271, 19, 13, 14, 3, 3),
+    Glyph::new(0x002C, 0x028E, 9, 7, 10, 0, -6),
+    Glyph::new(0x002D, 0x029F, 12, 10, 3, 1, 6),
+    Glyph::new(0x002E, 0x02A8, 9, 6, 5, 1, -1),
+    Glyph::new(0x002F, 0x02B0, 15, 13, 24, 1, -2),
+    Glyph::new(0x0030, 0x02E5, 19, 17, 22, 1, -1),
+    Glyph::new(0x0031, 0x032E, 19, 12, 21, 3, 0),
+    Glyph::new(0x0032, 0x035D, 19, 15, 21, 2, 0),
+    Glyph::new(0x0033, 0x0396, 19, 14, 22, 2, -1),
+    Glyph::new(0x0034, 0x03D3, 19, 17, 22, 1, -1),
+    Glyph::new(0x0035, 0x0419, 19, 14, 22, 2, -1),
+    Glyph::new(0x0036, 0x0452, 19, 15, 22, 2, -1),
+    Glyph::new(0x0037, 0x0499, 19, 14, 22, 3, -1),
+    Glyph::new(0x0038, 0x04D1, 19, 15, 22, 2, -1),
+    Glyph::new(0x0039, 0x051B, 19, 16, 22, 1, -1),
+    Glyph::new(0x003A, 0x0560, 9, 6, 16, 1, -1),
+    Glyph::new(0x003B, 0x0570, 9, 7, 21, 0, -6),
+    Glyph::new(0x003C, 0x058A, 19, 13, 14, 3, 3),
+    Glyph::new(0x003D, 0x05AA, 19, 13, 8, 3, 6),
+    Glyph::new(0x003E, 0x05C4, 19, 13, 14, 3, 3),
+    Glyph::new(0x003F, 0x05E5, 15, 11, 23, 2, -1),
+    Glyph::new(0x0040, 0x0615, 29, 27, 27, 1, -6),
+    Glyph::new(0x0041, 0x06A7, 23, 23, 22, 0, 0),
+    Glyph::new(0x0042, 0x06F9, 19, 17, 23, 1, -1),
+    Glyph::new(0x0043, 0x073E, 20, 17, 23, 1, -1),
+    Glyph::new(0x0044, 0x077F, 23, 21, 23, 1, -1),
+    Glyph::new(0x0045, 0x07CA, 19, 17, 21, 1, 0),
+    Glyph::new(0x0046, 0x080D, 18, 16, 21, 1, 0),
+    Glyph::new(0x0047, 0x0844, 22, 20, 23, 1, -1),
+    Glyph::new(0x0048, 0x0895, 26, 23, 21, 1, 0),
+    Glyph::new(0x0049, 0x08E5, 12, 10, 21, 1, 0),
+    Glyph::new(0x004A, 0x090B, 11, 13, 28, -2, -7),
+    Glyph::new(0x004B, 0x093E, 22, 21, 22, 1, -1),
+    Glyph::new(0x004C, 0x0990, 19, 17, 21, 1, 0),
+    Glyph::new(0x004D, 0x09C1, 27, 27, 21, 0, 0),
+    Glyph::new(0x004E, 0x0A3B, 25, 23, 22, 1, -1),
+    Glyph::new(0x004F, 0x0A9B, 24, 21, 23, 1, -1),
+    Glyph::new(0x0050, 0x0AE8, 18, 17, 22, 1, 0),
+    Glyph::new(0x0051, 0x0B22, 24, 23, 28, 1, -6),
+    Glyph::new(0x0052, 0x0B83, 21, 20, 23, 1, -1),
+    Glyph::new(0x0053, 0x0BCC, 17, 14, 23, 1, -1),
+    Glyph::new(0x0054, 0x0C0F, 21, 19, 21, 1, 0),
+    Glyph::new(0x0055, 0x0C5B, 24, 23, 22, 0, -1),
+    Glyph::new(0x0056, 0x0CB4, 23, 22, 22, 0, -1),
+    Glyph::new(0x0057, 0x0D04, 34, 33, 22, 0, -1),
+    Glyph::new(0x0058, 0x0D89, 22, 22, 21, 0, 0),
+    Glyph::new(0x0059, 0x0DDD, 21, 21, 21, 0, 0),
+    Glyph::new(0x005A, 0x0E1E, 18, 16, 22, 1, -1),
+    Glyph::new(0x005B, 0x0E62, 10, 6, 29, 2, -5),
+    Glyph::new(0x005C, 0x0E92, 15, 13, 24, 1, -2),
+    Glyph::new(0x005D, 0x0EC4, 10, 7, 29, 1, -5),
+    Glyph::new(0x005E, 0x0EF6, 19, 15, 15, 2, 5),
+    Glyph::new(0x005F, 0x0F24, 15, 15, 3, 0, -4),
+    Glyph::new(0x0060, 0x0F35, 21, 7, 8, 6, 17),
+    Glyph::new(0x0061, 0x0F43, 17, 16, 17, 1, -1),
+    Glyph::new(0x0062, 0x0F81, 18, 18, 25, -1, -1),
+    Glyph::new(0x0063, 0x0FD8, 16, 14, 17, 1, -1),
+    Glyph::new(0x0064, 0x1007, 19, 18, 25, 1, -1),
+    Glyph::new(0x0065, 0x105F, 16, 14, 17, 1, -1),
+    Glyph::new(0x0066, 0x1097, 13, 15, 24, 0, 0),
+    Glyph::new(0x0067, 0x10D5, 18, 18, 24, 0, -8),
+    Glyph::new(0x0068, 0x112C, 20, 20, 24, 0, 0),
+    Glyph::new(0x0069, 0x1182, 10, 10, 24, 0, 0),
+    Glyph::new(0x006A, 0x11AA, 9, 9, 32, -2, -8),
+    Glyph::new(0x006B, 0x11D4, 19, 18, 25, 0, -1),
+    Glyph::new(0x006C, 0x122D, 10, 10, 24, 0, 0),
+    Glyph::new(0x006D, 0x125E, 30, 30, 16, 0, 0),
+    Glyph::new(0x006E, 0x12C3, 21, 20, 16, 0, 0),
+    Glyph::new(0x006F, 0x1300, 18, 16, 17, 1, -1),
+    Glyph::new(0x0070, 0x133B, 19, 18, 23, 0, -7),
+    Glyph::new(0x0071, 0x137E, 18, 17, 23, 1, -7),
+    Glyph::new(0x0072, 0x13D6, 14, 14, 16, 0, 0),
+    Glyph::new(0x0073, 0x1405, 15, 12, 17, 1, -1),
+    Glyph::new(0x0074, 0x1437, 13, 12, 21, 0, -1),
+    Glyph::new(0x0075, 0x145E, 20, 20, 17, 0, -1),
+    Glyph::new(0x0076, 0x149C, 18, 18, 17, 0, -1),
+    Glyph::new(0x0077, 0x14D7, 27, 27, 17, 0, -1),
+    Glyph::new(0x0078, 0x1538, 18, 18, 16, 0, 0),
+    Glyph::new(0x0079, 0x1573, 18, 18, 24, 0, -8),
+    Glyph::new(0x007A, 0x15C0, 16, 15, 17, 0, -1),
+    Glyph::new(0x007B, 0x15F6, 12, 9, 30, 2, -6),
+    Glyph::new(0x007C, 0x162B, 9, 4, 27, 2, -4),
+    Glyph::new(0x007D, 0x1654, 12, 10, 30, 0, -6),
+    Glyph::new(0x007E, 0x168E, 19, 15, 6, 2, 7),
+    Glyph::new(0x00A1, 0x16A1, 9, 5, 24, 1, -8),
+    Glyph::new(0x00A2, 0x16C4, 19, 14, 29, 2, -6),
+    Glyph::new(0x00A3, 0x1714, 19, 17, 22, 1, -1),
+    Glyph::new(0x00A4, 0x1756, 19, 17, 15, 1, 3),
+    Glyph::new(0x00A5, 0x178F, 19, 20, 21, -1, 0),
+    Glyph::new(0x00A7, 0x17DE, 16, 13, 24, 1, -3),
+    Glyph::new(0x00A9, 0x1828, 24, 23, 23, 0, -1),
+    Glyph::new(0x00AA, 0x189E, 14, 11, 15, 1, 7),
+    Glyph::new(0x00AB, 0x18CC, 16, 15, 12, 1, 2),
+    Glyph::new(0x00AE, 0x18F4, 18, 17, 17, 0, 7),
+    Glyph::new(0x00B0, 0x194C, 16, 10, 10, 3, 11),
+    Glyph::new(0x00B1, 0x196C, 19, 13, 18, 3, 0),
+    Glyph::new(0x00B2, 0x198D, 14, 10, 14, 2, 11),
+    Glyph::new(0x00B3, 0x19B3, 14, 10, 15, 2, 10),
+    Glyph::new(0x00B5, 0x19D7, 21, 19, 23, 2, -7),
+    Glyph::new(0x00B6, 0x1A31, 17, 16, 26, 0, -5),
+    Glyph::new(0x00B7, 0x1A8A, 9, 6, 5, 1, 6),
+    Glyph::new(0x00B9, 0x1A92, 14, 9, 14, 2, 11),
+    Glyph::new(0x00BA, 0x1AB5, 14, 11, 15, 1, 7),
+    Glyph::new(0x00BB, 0x1ADF, 16, 16, 12, 1, 2),
+    Glyph::new(0x00BC, 0x1B08, 33, 29, 24, 2, -2),
+    Glyph::new(0x00BD, 0x1B88, 33, 29, 24, 2, -2),
+    Glyph::new(0x00BE, 0x1C01, 33, 30, 24, 2, -2),
+    Glyph::new(0x00BF, 0x1C7E, 15, 11, 23, 1, -7),
+    Glyph::new(0x00C0, 0x1CAA, 23, 23, 29, 0, 0),
+    Glyph::new(0x00C1, 0x1D0C, 23, 23, 29, 0, 0),
+    Glyph::new(0x00C2, 0x1D6D, 23, 23, 29, 0, 0),
+    Glyph::new(0x00C3, 0x1DD3, 23, 23, 29, 0, 0),
+    Glyph::new(0x00C4, 0x1E39, 23, 23, 28, 0, 0),
+    Glyph::new(0x00C5, 0x1E9D, 23, 23, 30, 0, 0),
+    Glyph::new(0x00C6, 0x1F0A, 28, 28, 21, -1, 0),
+    Glyph::new(0x00C7, 0x1F72, 20, 17, 30, 1, -8),
+    Glyph::new(0x00C8, 0x1FC3, 19, 17, 29, 1, 0),
+    Glyph::new(0x00C9, 0x2015, 19, 17, 29, 1, 0),
+    Glyph::new(0x00CA, 0x2066, 19, 17, 29, 1, 0),
+    Glyph::new(0x00CB, 0x20BC, 19, 17, 28, 1, 0),
+    Glyph::new(0x00CC, 0x2111, 12, 10, 29, 1, 0),
+    Glyph::new(0x00CD, 0x2145, 12, 10, 29, 1, 0),
+    Glyph::new(0x00CE, 0x2179, 12, 11, 29, 0, 0),
+    Glyph::new(0x00CF, 0x21BA, 12, 11, 28, 0, 0),
+    Glyph::new(0x00D0, 0x21F8, 23, 22, 23, 0, -1),
+    Glyph::new(0x00D1, 0x224D, 25, 23, 30, 1, -1),
+    Glyph::new(0x00D2, 0x22C3, 24, 21, 30, 1, -1),
+    Glyph::new(0x00D3, 0x231F, 24, 21, 30, 1, -1),
+    Glyph::new(0x00D4, 0x237B, 24, 21, 30, 1, -1),
+    Glyph::new(0x00D5, 0x23DB, 24, 21, 30, 1, -1),
+    Glyph::new(0x00D6, 0x243A, 24, 21, 29, 1, -1),
+    Glyph::new(0x00D7, 0x249A, 19, 13, 13, 3, 4),
+    Glyph::new(0x00D8, 0x24C1, 24, 23, 23, 0, -1),
+    Glyph::new(0x00D9, 0x2525, 24, 23, 30, 0, -1),
+    Glyph::new(0x00DA, 0x2590, 24, 23, 30, 0, -1),
+    Glyph::new(0x00DB, 0x25FB, 24, 23, 30, 0, -1),
+    Glyph::new(0x00DC, 0x2669, 24, 23, 29, 0, -1),
+    Glyph::new(0x00DE, 0x26D6, 19, 17, 21, 1, 0),
+    Glyph::new(0x00DF, 0x2710, 20, 19, 25, 0, -1),
+    Glyph::new(0x00E0, 0x2771, 17, 16, 26, 1, -1),
+    Glyph::new(0x00E1, 0x27BD, 17, 16, 26, 1, -1),
+    Glyph::new(0x00E2, 0x2809, 17, 16, 25, 1, -1),
+    Glyph::new(0x00E3, 0x285B, 17, 16, 25, 1, -1),
+    Glyph::new(0x00E4, 0x28AC, 17, 16, 24, 1, -1),
+    Glyph::new(0x00E5, 0x28FB, 17, 16, 26, 1, -1),
+    Glyph::new(0x00E6, 0x2953, 25, 23, 17, 1, -1),
+    Glyph::new(0x00E7, 0x29AB, 16, 14, 24, 1, -8),
+    Glyph::new(0x00E8, 0x29EB, 16, 14, 26, 1, -1),
+    Glyph::new(0x00E9, 0x2A32, 16, 14, 26, 1, -1),
+    Glyph::new(0x00EA, 0x2A79, 16, 14, 25, 1, -1),
+    Glyph::new(0x00EB, 0x2AC4, 16, 14, 24, 1, -1),
+    Glyph::new(0x00EC, 0x2B0C, 10, 10, 25, 0, 0),
+    Glyph::new(0x00ED, 0x2B3A, 10, 10, 25, 0, 0),
+    Glyph::new(0x00EE, 0x2B69, 10, 10, 24, 0, 0),
+    Glyph::new(0x00EF, 0x2B9C, 10, 11, 23, -1, 0),
+    Glyph::new(0x00F0, 0x2BD2, 18, 16, 26, 1, -1),
+    Glyph::new(0x00F1, 0x2C24, 21, 20, 24, 0, 0),
+    Glyph::new(0x00F2, 0x2C76, 18, 16, 26, 1, -1),
+    Glyph::new(0x00F3, 0x2CC0, 18, 16, 26, 1, -1),
+    Glyph::new(0x00F4, 0x2D0A, 18, 16, 25, 1, -1),
+    Glyph::new(0x00F5, 0x2D5A, 18, 16, 25, 1, -1),
+    Glyph::new(0x00F6, 0x2DA7, 18, 16, 24, 1, -1),
+    Glyph::new(0x00F7, 0x2DF2, 19, 13, 14, 3, 3),
+    Glyph::new(0x00F8, 0x2E10, 18, 18, 17, 0, -1),
+    Glyph::new(0x00F9, 0x2E5A, 20, 20, 26, 0, -1),
+    Glyph::new(0x00FA, 0x2EAA, 20, 20, 26, 0, -1),
+    Glyph::new(0x00FB, 0x2EFA, 20, 20, 25, 0, -1),
+    Glyph::new(0x00FC, 0x2F4C, 20, 20, 24, 0, -1),
+    Glyph::new(0x00FE, 0x2F9C, 19, 18, 31, 0, -7),
+    Glyph::new(0x00FF, 0x3006, 18, 18, 31, 0, -8),
+    Glyph::new(0x0104, 0x3067, 23, 23, 29, 0, -7),
+    Glyph::new(0x0105, 0x30CD, 17, 16, 23, 1, -7),
+    Glyph::new(0x0106, 0x3118, 20, 17, 30, 1, -1),
+    Glyph::new(0x0107, 0x3168, 16, 14, 26, 1, -1),
+    Glyph::new(0x010C, 0x31A5, 20, 17, 30, 1, -1),
+    Glyph::new(0x010D, 0x31F9, 16, 14, 26, 1, -1),
+    Glyph::new(0x010E, 0x323C, 23, 21, 30, 1, -1),
+    Glyph::new(0x010F, 0x329B, 20, 20, 25, 1, -1),
+    Glyph::new(0x0118, 0x3302, 19, 17, 28, 1, -7),
+    Glyph::new(0x0119, 0x3355, 16, 14, 23, 1, -7),
+    Glyph::new(0x011A, 0x3399, 19, 17, 29, 1, 0),
+    Glyph::new(0x011B, 0x33F0, 16, 14, 26, 1, -1),
+    Glyph::new(0x0139, 0x343C, 19, 17, 29, 1, 0),
+    Glyph::new(0x013A, 0x347C, 10, 10, 31, 0, 0),
+    Glyph::new(0x013D, 0x34B8, 19, 17, 24, 1, 0),
+    Glyph::new(0x013E, 0x34F7, 11, 12, 24, 0, 0),
+    Glyph::new(0x0141, 0x3532, 19, 19, 21, -1, 0),
+    Glyph::new(0x0142, 0x356E, 10, 12, 24, -1, 0),
+    Glyph::new(0x0143, 0x35A7, 25, 23, 30, 1, -1),
+    Glyph::new(0x0144, 0x3619, 21, 20, 25, 0, 0),
+    Glyph::new(0x0147, 0x3668, 25, 23, 30, 1, -1),
+    Glyph::new(0x0148, 0x36DC, 21, 20, 25, 0, 0),
+    Glyph::new(0x0152, 0x372E, 30, 27, 22, 1, -1),
+    Glyph::new(0x0153, 0x37A7, 28, 25, 17, 1, -1),
+    Glyph::new(0x0158, 0x3800, 21, 20, 30, 1, -1),
+    Glyph::new(0x0159, 0x385A, 14, 14, 25, 0, 0),
+    Glyph::new(0x015A, 0x389C, 17, 14, 30, 1, -1),
+    Glyph::new(0x015B, 0x38ED, 15, 12, 26, 1, -1),
+    Glyph::new(0x0160, 0x392D, 17, 14, 30, 1, -1),
+    Glyph::new(0x0161, 0x3984, 15, 12, 26, 1, -1),
+    Glyph::new(0x0164, 0x39C8, 21, 19, 29, 1, 0),
+    Glyph::new(0x0165, 0x3A29, 13, 12, 25, 0, -1),
+    Glyph::new(0x016E, 0x3A5C, 24, 23, 31, 0, -1),
+    Glyph::new(0x016F, 0x3AD2, 20, 20, 26, 0, -1),
+    Glyph::new(0x0170, 0x3B2C, 24, 23, 31, 0, -1),
+    Glyph::new(0x0171, 0x3B9F, 20, 20, 26, 0, -1),
+    Glyph::new(0x0178, 0x3BF6, 21, 21, 28, 0, 0),
+    Glyph::new(0x0179, 0x3C49, 18, 16, 30, 1, -1),
+    Glyph::new(0x017A, 0x3C9C, 16, 15, 26, 0, -1),
+    Glyph::new(0x017B, 0x3CE1, 18, 16, 29, 1, -1),
+    Glyph::new(0x017C, 0x3D2D, 16, 15, 24, 0, -1),
+    Glyph::new(0x017D, 0x3D6D, 18, 16, 30, 1, -1),
+    Glyph::new(0x017E, 0x3DC1, 16, 15, 26, 0, -1),
+    Glyph::new(0x03C0, 0x3E0A, 20, 20, 17, 0, -1),
+    Glyph::new(0x1E9E, 0x3E51, 23, 22, 23, 0, -1),
+    Glyph::new(0x2013, 0x3EB3, 15, 15, 3, 0, 6),
+    Glyph::new(0x2014, 0x3EC4, 30, 30, 3, 0, 6),
+    Glyph::new(0x2018, 0x3EE4, 8, 6, 10, 1, 13),
+    Glyph::new(0x2019, 0x3EF5, 8, 6, 10, 0, 13),
+    Glyph::new(0x201A, 0x3F06, 8, 6, 10, 0, -6),
+    Glyph::new(0x201B, 0x3F17, 8, 6, 10, 1, 13),
+    Glyph::new(0x201C, 0x3F29, 14, 12, 10, 1, 13),
+    Glyph::new(0x201D, 0x3F49, 14, 12, 10, 0, 13),
+    Glyph::new(0x201E, 0x3F69, 14, 12, 10, 0, -6),
+    Glyph::new(0x201F, 0x3F8B, 14, 12, 10, 1, 13),
+    Glyph::new(0x2020, 0x3FAD, 15, 13, 20, 1, 2),
+    Glyph::new(0x2021, 0x3FDB, 15, 13, 24, 1, -2),
+    Glyph::new(0x2022, 0x4014, 9, 7, 7, 1, 4),
+    Glyph::new(0x2026, 0x4022, 30, 26, 5, 2, -1),
+    Glyph::new(0x2039, 0x4039, 10, 8, 12, 1, 2),
+    Glyph::new(0x203A, 0x404E, 10, 8, 12, 1, 2),
+    Glyph::new(0x2070, 0x4062, 14, 12, 15, 1, 10),
+    Glyph::new(0x2074, 0x408F, 14, 12, 15, 1, 10),
+    Glyph::new(0x2075, 0x40B2, 14, 10, 15, 1, 10),
+    Glyph::new(0x2076, 0x40D8, 14, 11, 15, 1, 10),
+    Glyph::new(0x2077, 0x40FE, 14, 10, 15, 2, 10),
+    Glyph::new(0x2078, 0x4120, 14, 11, 15, 1, 10),
+    Glyph::new(0x2079, 0x414B, 14, 11, 15, 1, 10),
+    Glyph::new(0x2080, 0x4174, 14, 12, 15, 1, -5),
+    Glyph::new(0x2081, 0x41A3, 14, 9, 14, 2, -4),
+    Glyph::new(0x2082, 0x41C6, 14, 10, 14, 2, -4),
+    Glyph::new(0x2083, 0x41EB, 14, 10, 15, 2, -5),
+    Glyph::new(0x2084, 0x420E, 14, 12, 15, 1, -5),
+    Glyph::new(0x2085, 0x4231, 14, 10, 15, 1, -5),
+    Glyph::new(0x2086, 0x4256, 14, 11, 15, 1, -5),
+    Glyph::new(0x2087, 0x427E, 14, 10, 15, 2, -5),
+    Glyph::new(0x2088, 0x429F, 14, 11, 15, 1, -5),
+    Glyph::new(0x2089, 0x42CB, 14, 11, 15, 1, -5),
+    Glyph::new(0x20AC, 0x42F5, 19, 18, 22, 0, -1),
+    Glyph::new(0x2122, 0x433E, 25, 23, 11, 1, 10),
+    Glyph::new(0x2153, 0x438A, 33, 28, 24, 2, -2),
+    Glyph::new(0x2154, 0x4401, 33, 28, 24, 2, -2),
+    Glyph::new(0x215B, 0x447D, 33, 29, 24, 2, -2),
+    Glyph::new(0x215C, 0x44FE, 33, 29, 24, 2, -2),
+    Glyph::new(0x215D, 0x457D, 33, 30, 24, 1, -2),
+    Glyph::new(0x215E, 0x45FD, 33, 29, 24, 2, -2),
+    Glyph::new(0x2190, 0x4683, 30, 18, 13, 6, 4),
+    Glyph::new(0x2191, 0x46AA, 30, 12, 20, 9, 0),
+    Glyph::new(0x2192, 0x46D4, 30, 18, 13, 6, 4),
+    Glyph::new(0x2193, 0x46FB, 30, 12, 20, 9, 0),
+    Glyph::new(0x2194, 0x4723, 30, 18, 13, 6, 4),
+    Glyph::new(0x2195, 0x4758, 30, 12, 21, 9, 0),
+    Glyph::new(0x21D0, 0x478E, 30, 18, 14, 6, 3),
+    Glyph::new(0x21D1, 0x47C4, 30, 14, 18, 8, 1),
+    Glyph::new(0x21D2, 0x47EE, 30, 18, 14, 6, 3),
+    Glyph::new(0x21D3, 0x4824, 30, 14, 18, 8, 1),
+    Glyph::new(0x21D4, 0x484F, 30, 18, 14, 6, 3),
+    Glyph::new(0x2202, 0x488D, 19, 15, 25, 2, -1),
+    Glyph::new(0x2206, 0x48D8, 20, 19, 22, 0, 0),
+    Glyph::new(0x220F, 0x4922, 25, 23, 26, 1, -5),
+    Glyph::new(0x2211, 0x4988, 19, 18, 26, 0, -5),
+    Glyph::new(0x221A, 0x49DD, 19, 19, 29, 0, -4),
+    Glyph::new(0x221E, 0x4A2B, 19, 19, 11, 0, 4),
+    Glyph::new(0x222B, 0x4A61, 19, 16, 31, 1, -7),
+    Glyph::new(0x2260, 0x4A9F, 19, 13, 14, 3, 3),
+    Glyph::new(0x2264, 0x4AC5, 19, 13, 18, 3, 0),
+    Glyph::new(0x2265, 0x4AED, 19, 13, 18, 3, 0),
+    Glyph::new(0xFB01, 0x4B13, 23, 23, 24, 0, 0),
+    Glyph::new(0xFB02, 0x4B72, 23, 23, 24, 0, 0),
 ];
 
-const BITMAP_BW: &[u8; 13055] = include_bytes!("./bookerly_30.bw");
-const BITMAP_MSB: &[u8; 13055] = include_bytes!("./bookerly_30.msb");
-const BITMAP_LSB: &[u8; 13055] = include_bytes!("./bookerly_30.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 15), (18, 15), (19, 14),
+    (20, 15), (20, 15), (21, 16), (22, 15), (23, 15), (24, 17), (25, 15), (16, 18),
+    (26, 13), (27, 14), (28, 13), (29, 19), (30, 20), (31, 21), (32, 22), (32, 23),
+    (22, 24), (33, 22), (34, 25), (35, 26), (0, 0), (36, 27), (0, 0), (0, 0),
+    (0, 0), (37, 28), (38, 29), (39, 30), (40, 30), (41, 31), (42, 32), (43, 33),
+    (44, 34), (45, 35), (46, 36), (47, 37), (40, 38), (48, 39), (49, 39), (50, 30),
+    (51, 40), (52, 30), (53, 41), (54, 42), (55, 43), (56, 44), (57, 45), (58, 46),
+    (59, 47), (57, 48), (60, 49), (61, 50), (0, 0), (62, 51), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (63, 52), (64, 53),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (65, 54), (0, 0), (0, 0),
+    (0, 0), (66, 55), (67, 56), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (17, 57), (15, 14), (17, 15),
+    (17, 15), (17, 15), (17, 15), (68, 15), (69, 58), (70, 59), (70, 60), (16, 61),
+    (25, 15), (16, 18), (16, 18), (16, 18), (16, 18), (16, 18), (0, 0), (71, 62),
+    (31, 21), (31, 21), (31, 21), (31, 21), (72, 15), (73, 63), (37, 64), (37, 28),
+    (74, 65), (74, 66), (75, 67), (37, 68), (41, 28), (76, 30), (41, 69), (77, 31),
+    (78, 70), (79, 71), (80, 72), (81, 73), (82, 74), (83, 75), (84, 30), (49, 39),
+    (50, 30), (84, 30), (85, 76), (86, 77), (86, 77), (0, 0), (87, 78), (56, 44),
+    (56, 44), (56, 44), (56, 79), (88, 80), (89, 81), (90, 12), (91, 28), (15, 14),
+    (92, 30), (15, 14), (93, 77), (16, 13), (94, 30), (95, 15), (96, 31), (17, 15),
+    (77, 82), (23, 58), (40, 38), (97, 15), (94, 38), (23, 83), (98, 84), (25, 15),
+    (49, 39), (25, 15), (49, 39), (99, 85), (41, 31), (28, 13), (100, 86), (29, 19),
+    (101, 42), (29, 19), (101, 87), (30, 20), (102, 43), (31, 21), (56, 44), (31, 21),
+    (103, 44), (33, 22), (34, 25), (104, 49), (34, 25), (60, 49), (34, 25), (104, 88),
+    (105, 89), (106, 90), (107, 91), (107, 91), (108, 92), (109, 93), (110, 94), (0, 0),
+    (108, 92), (109, 93), (110, 94), (0, 0), (0, 0), (0, 0), (0, 0), (8, 95),
+    (111, 53), (112, 56), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (45, 32), (40, 32),
+];
+
+const KERNING: [&[i8]; 113] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, -2, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, -2, -2, -1, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -2, -2, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -2, 0, -1, -1, 0, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, -1, -2, 0, 0, -2, -2, -1, -2, 0, -1, -1, -1, -2, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -2, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, -2, -2, -2, -1, 0, -1, -1, 0, -2, -2, 0, -2, -2, -1, 0, 0, 0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -2, -1, 0, -1, 0, 0, -2, -1, -1, -1, 0, 0, -1, 0, 0, -2, 0, 0, -1, -2, -1, -2, -1, 0, 0, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2],
+    &[0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, -1, 0, -2, -2, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -2, -2, 0, -1, 0, -2, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, -2, -2, 0, -2, -2, -1, 0, 0, -2, -1, -2, -2, -2, -1, -1, -2, -1, -1, 0, 0, -2, -1, -1, -2, -1, -1, -1, -2, -1, -2, -1, -1, -1, -2, -1, -2, -2, -2, -1, -2, -1, 0, -1, -1, -2, -2, -2, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -2, -2, -2, -2, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -2, -1, -2, -2, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -2, 0, -1, -1, -1, -2, -2, 0, -1, -2, -1, -2, 0, -2, -1, -2, -2, -2, -2, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, -1, -2, -1, -1, -2, -2, -2, -2, 0, -2, -1, -2, -2, 0, -2, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, 0, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -2],
+    &[0, -1, 0, -2, 0, -2, -2, -2, -2, -2, -2, -1, -2, 0, -2, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, -2, -2, -1, -2, 0, -1, -1, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, -2, 0, -1, -2, -2, -1, -2, -2, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -2, -2, -2, -1, 0, -1, 0, 0, -2, -2, -2, -1, 0, -1, -2, 0, 0, -2, -1, -1, -1, -1, -2, -2, -1, -1, -2, -2],
+    &[0, -1, -1, -1, -2, -2, 0, -1, -1, -1, -1, -2, 0, -1, -1, -1, -2, 0, -1, -1, -1, -2, -2, -2, 0, -1, -1, -2, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -2, -2, -1, -2, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2],
+    &[0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, -1, -1, -2, -2, -2, -2, -2, -1, -1, -2, -2, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, -2, -1, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, -2, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, -2, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -1, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -2, -2, -1, -1, -2, -2, -2, 0, -2, -2, -1, 0, -1, 0, -1, -1, -2, -2, -1, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -2, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, -1, -1, -2, -1, -2, -2, -1, -2, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -2, 0, 0, -1, -2, -2],
+    &[0, -1, -1, 0, -1, -2, 0, -1, -1, -1, -2, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2],
+    &[0, -1, 0, -1, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -2, -2, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, -1, 0, -2, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -2, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -2, 0, -1],
+    &[0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, -1, -1, 0, 0, 0, 0, -2, -2, -1, 0, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, -1, -1, -2, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -2, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -2, -2, -2, -2, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1, -1, -2, -2, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -2, -2, -2, -1, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -2, 0, 0, -1, 0, -1, -1, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -2, -1, 0, 0, -2, -2],
+    &[0, 0, 0, -2, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -1, -1, -2, -2, -1, -2, -1, -1, -1, -2, -2, -1, -2, -2, 0, 0, 0, 0, -2, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -2, -1, -2, -1, 0, -1, -1, 0, 0, -2, -1, -1, -1, -2, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -1, -1, -2, -2, -1, -2, -1, -1, 0, -2, -2, 0, -2, -2, 0, 0, 0, 0, -2, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -2, -1, 0, -1, -1, 0, 0, -2, -1, -1, -1, -2, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, 0, -1],
+    &[0, -1, -2, -2, 0, 0, -2, -2, -2, -2, 0, -2, -1, -2, -2, -2, 0, -1, -2, -2, -2, -2, -1, -2, -1, -2, -1, 0, -2, 0, -2, -2, -1, 0, 0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -1, -1, -2, -1, 0, -2, -2, 0, -2, -2, -1, -2, -2, -1, -1, 0, -1, -2, -2, -2, -1, -2, -1, -1, -2, -2, -2, -1, 0, -2, -1, 0, -2, -2, -2, -1, 0, 0, -1, -1, 0, -2, -1, -1, -1, -2, -1, -1, -2, -1, 0, -2],
+    &[0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2],
+    &[0, 0, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -2, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -1, -2, -1, -1, -1, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, -2, 0, 0, -1, -2, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, -2, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2],
+    &[0, 0, -1, -1, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, -1, -2, -1, -2, -1, -1, -1, 0, -1, -1, -2, 0, 0, -1, 0, -2, 0, -1, 0, -2, -2, -2, -2, 0, 0, -1, -2, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -2, -2, -2, -1, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -2, -1, -1, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -2, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -2, -1, -2, 0, -2, -2, -1, 0, 0, -1, -1, -2, -2, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, -2, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -2],
+    &[0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -2, 0, -1, -1, -1, 0, 0, -1, -1, -1, -2, -2, -2, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -2],
+    &[0, 0, 0, 0, -2, -2, -2, -2, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -1, -2, 0, -1, -1, -1, -2, 0, -1, 0, -1, -1, -2, -2, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, -1, -1, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, 0, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -2, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -2, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, -1, -1, -1, -2, -1, -2, -1, 0, -1, -1, -2, 0, 0, -1, 0, -2, 0, -1, 0, 0, -1, -2, -2, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, -1, -2, -2, 0, 0, -2, -2, -2, -2, 0, -2, -1, -2, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -2, 0, 0, -2, 0, -2, -2, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, -1, -1, -1, -1, 0, -1, -1, 0, -2, -2, 0, -2, -2, -1, -1, 0, 0, -2, -1, -2, -1, -2, -1, -1, -2, -2, -2, -1, 0, -1, -1, 0, -2, -2, -2, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, -2],
+    &[0, -2, -1, -1, -2, -2, -1, -2, -1, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -2, -2, -2],
+    &[0, -1, -1, -1, -2, 0, -1, 0, -2, -1, -1, -2, -2, -1, 0, -1, -1, -2, 0, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -2, -1, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, 0, -1, 0, -1, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, -1],
+    &[0, -1, 0, -1, -1, 0, -1, 0, -2, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -2, 0, -2, -2, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, -2, -2],
+    &[0, -1, 0, -1, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -2, -1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, -1, 0, -2, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -2, -1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, -1, 0, -2, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -2, 0, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, 0, 0, -2, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -2, 0, -2, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -2, -2, 0, -2, -2, -1, -1, -2, -2, -2, 0, -2, -2, -1, 0, -1, -1, -1, -2, -2, -2, -1, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -2, -2, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, -1, -1, -1],
+    &[0, 0, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, 0, -1],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, 0, -1],
+    &[0, -1, -1, 0, -2, -1, -2, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, 0, -1, -2, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, -1, -2, -1, 0, 0, -1, -1, -2, -2, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, -1],
+    &[0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -1, 0, -1],
+    &[0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1],
+    &[0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -2, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -2, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, -1, -1, 0, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, 0, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1],
+    &[0, -1, -1, -1, -1, -1, -2, -1, 0, -1, -1, -2, 0, 0, -1, 0, -2, 0, -1, 0, 0, -1, -1, -2, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -2, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -2, -1, -1, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -2, -1, 0, -2, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, -2, -1, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -2, 0, -2, -2, -2, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -2, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -2, -2, -1, -2, 0, -1, -1, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -2, -2, -1, -2, -2, 0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -2, -2, -2, -1, 0, -1, 0, 0, -2, -2, -2, -1, 0, -1, -2, 0, 0, -2, -1, -1, -2, -1, -2, 0, -1, -1, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -2, 0, 0, 0, -2, 0, -2, -2, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -2, -2, 0, -1, 0, -2, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1],
+    &[0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, 0, -1, 0, -1, -2, 0, 0, 0, -2, -1, -2, -2, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, -2, -1, -2, -2, -2, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -2, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -2, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 19421] = include_bytes!("./bookerly_30.rle");
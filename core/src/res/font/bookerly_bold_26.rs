@@ -1,308 +1,516 @@
 // Auto-generated font file
 // Font: Bookerly Bold
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 10812,
+    size: 16361,
     y_advance: 26,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 6, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 8, 6, 21, 1, -1),
-    Glyph::new(0x0022, 0x0010, 11, 9, 9, 1, 10),
-    Glyph::new(0x0023, 0x001B, 17, 17, 17, 0, -2),
-    Glyph::new(0x0024, 0x0040, 17, 14, 26, 1, -5),
-    Glyph::new(0x0025, 0x006E, 26, 24, 22, 1, -2),
-    Glyph::new(0x0026, 0x00B0, 21, 21, 20, 0, -1),
-    Glyph::new(0x0027, 0x00E5, 6, 4, 9, 1, 10),
-    Glyph::new(0x0028, 0x00EA, 10, 9, 26, 1, -5),
-    Glyph::new(0x0029, 0x0108, 10, 9, 26, 0, -5),
-    Glyph::new(0x002A, 0x0126, 11, 10, 10, 0, 10),
-    Glyph::new(0x002B, 0x0133, 17, 12, 13, 2, 2),
-    Glyph::new(0x002C, 0x0147, 8, 7, 9, 0, -5),
-    Glyph::new(0x002D, 0x014F, 10, 9, 4, 0, 5),
-    Glyph::new(0x002E, 0x0154, 8, 6, 5, 1, -1),
-    Glyph::new(0x002F, 0x0158, 14, 13, 21, 0, -2),
-    Glyph::new(0x0030, 0x017B, 17, 16, 20, 0, -1),
-    Glyph::new(0x0031, 0x01A3, 17, 12, 19, 2, 0),
-    Glyph::new(0x0032, 0x01C0, 17, 14, 19, 1, 0),
-    Glyph::new(0x0033, 0x01E2, 17, 14, 20, 1, -1),
-    Glyph::new(0x0034, 0x0205, 17, 16, 20, 0, -1),
-    Glyph::new(0x0035, 0x022D, 17, 13, 19, 1, -1),
-    Glyph::new(0x0036, 0x024C, 17, 14, 20, 1, -1),
-    Glyph::new(0x0037, 0x026F, 17, 14, 19, 1, -1),
-    Glyph::new(0x0038, 0x0291, 17, 14, 20, 1, -1),
-    Glyph::new(0x0039, 0x02B4, 17, 14, 20, 1, -1),
-    Glyph::new(0x003A, 0x02D7, 8, 6, 15, 1, -1),
-    Glyph::new(0x003B, 0x02E3, 8, 7, 19, 0, -5),
-    Glyph::new(0x003C, 0x02F4, 17, 12, 13, 2, 2),
-    Glyph::new(0x003D, 0x0308, 17, 12, 8, 2, 5),
-    Glyph::new(0x003E, 0x0314, 17, 12, 13, 2, 2),
-    Glyph::new(0x003F, 0x0328, 13, 11, 21, 1, -1),
-    Glyph::new(0x0040, 0x0345, 26, 24, 25, 1, -6),
-    Glyph::new(0x0041, 0x0390, 21, 20, 19, 0, 0),
-    Glyph::new(0x0042, 0x03C0, 17, 16, 20, 0, -1),
-    Glyph::new(0x0043, 0x03E8, 18, 16, 20, 1, -1),
-    Glyph::new(0x0044, 0x0410, 21, 20, 20, 0, -1),
-    Glyph::new(0x0045, 0x0442, 17, 16, 19, 0, 0),
-    Glyph::new(0x0046, 0x0468, 16, 15, 19, 0, 0),
-    Glyph::new(0x0047, 0x048C, 20, 18, 20, 1, -1),
-    Glyph::new(0x0048, 0x04B9, 23, 22, 19, 0, 0),
-    Glyph::new(0x0049, 0x04EE, 11, 10, 19, 0, 0),
-    Glyph::new(0x004A, 0x0506, 11, 12, 25, -2, -6),
-    Glyph::new(0x004B, 0x052C, 20, 20, 20, 0, -1),
-    Glyph::new(0x004C, 0x055E, 17, 16, 19, 0, 0),
-    Glyph::new(0x004D, 0x0584, 25, 25, 19, 0, 0),
-    Glyph::new(0x004E, 0x05C0, 21, 21, 20, 0, -1),
-    Glyph::new(0x004F, 0x05F5, 21, 19, 20, 1, -1),
-    Glyph::new(0x0050, 0x0625, 17, 16, 19, 0, 0),
-    Glyph::new(0x0051, 0x064B, 21, 20, 25, 1, -6),
-    Glyph::new(0x0052, 0x068A, 19, 19, 20, 0, -1),
-    Glyph::new(0x0053, 0x06BA, 16, 13, 20, 1, -1),
-    Glyph::new(0x0054, 0x06DB, 19, 18, 19, 0, 0),
-    Glyph::new(0x0055, 0x0706, 21, 21, 20, 0, -1),
-    Glyph::new(0x0056, 0x073B, 21, 20, 20, 0, -1),
-    Glyph::new(0x0057, 0x076D, 29, 29, 20, 0, -1),
-    Glyph::new(0x0058, 0x07B6, 20, 20, 19, 0, 0),
-    Glyph::new(0x0059, 0x07E6, 19, 19, 19, 0, 0),
-    Glyph::new(0x005A, 0x0814, 16, 16, 20, 0, -1),
-    Glyph::new(0x005B, 0x083C, 9, 7, 26, 1, -5),
-    Glyph::new(0x005C, 0x0853, 14, 13, 21, 0, -2),
-    Glyph::new(0x005D, 0x0876, 9, 7, 26, 1, -5),
-    Glyph::new(0x005E, 0x088D, 17, 14, 13, 1, 4),
-    Glyph::new(0x005F, 0x08A4, 13, 13, 3, 0, -4),
-    Glyph::new(0x0060, 0x08A9, 18, 7, 7, 5, 15),
-    Glyph::new(0x0061, 0x08B0, 15, 14, 15, 1, -1),
-    Glyph::new(0x0062, 0x08CB, 17, 17, 22, -1, -1),
-    Glyph::new(0x0063, 0x08FA, 14, 13, 15, 0, -1),
-    Glyph::new(0x0064, 0x0913, 17, 17, 22, 0, -1),
-    Glyph::new(0x0065, 0x0942, 15, 14, 15, 0, -1),
-    Glyph::new(0x0066, 0x095D, 12, 14, 21, 0, 0),
-    Glyph::new(0x0067, 0x0982, 16, 16, 21, 0, -7),
-    Glyph::new(0x0068, 0x09AC, 18, 17, 21, 0, 0),
-    Glyph::new(0x0069, 0x09D9, 10, 9, 21, 0, 0),
-    Glyph::new(0x006A, 0x09F1, 9, 9, 28, -2, -7),
-    Glyph::new(0x006B, 0x0A11, 17, 17, 22, 0, -1),
-    Glyph::new(0x006C, 0x0A40, 10, 9, 21, 0, 0),
-    Glyph::new(0x006D, 0x0A58, 26, 26, 14, 0, 0),
-    Glyph::new(0x006E, 0x0A86, 18, 18, 14, 0, 0),
-    Glyph::new(0x006F, 0x0AA6, 16, 15, 15, 0, -1),
-    Glyph::new(0x0070, 0x0AC3, 17, 16, 20, 0, -6),
-    Glyph::new(0x0071, 0x0AEB, 16, 16, 20, 0, -6),
-    Glyph::new(0x0072, 0x0B13, 13, 12, 14, 0, 0),
-    Glyph::new(0x0073, 0x0B28, 14, 12, 15, 1, -1),
-    Glyph::new(0x0074, 0x0B3F, 12, 12, 19, -1, -1),
-    Glyph::new(0x0075, 0x0B5C, 17, 18, 15, 0, -1),
-    Glyph::new(0x0076, 0x0B7E, 17, 17, 15, 0, -1),
-    Glyph::new(0x0077, 0x0B9E, 24, 24, 15, 0, -1),
-    Glyph::new(0x0078, 0x0BCB, 17, 16, 14, 0, 0),
-    Glyph::new(0x0079, 0x0BE7, 17, 17, 21, 0, -7),
-    Glyph::new(0x007A, 0x0C14, 14, 13, 15, 0, -1),
-    Glyph::new(0x007B, 0x0C2D, 11, 9, 26, 1, -5),
-    Glyph::new(0x007C, 0x0C4B, 9, 4, 24, 2, -4),
-    Glyph::new(0x007D, 0x0C57, 11, 9, 26, 0, -5),
-    Glyph::new(0x007E, 0x0C75, 17, 14, 6, 1, 6),
-    Glyph::new(0x00A1, 0x0C80, 8, 5, 21, 1, -6),
-    Glyph::new(0x00A2, 0x0C8E, 17, 14, 25, 1, -5),
-    Glyph::new(0x00A3, 0x0CBA, 17, 16, 20, 0, -1),
-    Glyph::new(0x00A4, 0x0CE2, 17, 15, 13, 1, 2),
-    Glyph::new(0x00A5, 0x0CFB, 17, 18, 18, -1, 0),
-    Glyph::new(0x00A7, 0x0D24, 14, 13, 21, 0, -3),
-    Glyph::new(0x00A9, 0x0D47, 21, 20, 20, 0, -1),
-    Glyph::new(0x00AA, 0x0D79, 12, 10, 13, 1, 6),
-    Glyph::new(0x00AB, 0x0D8A, 16, 15, 11, 0, 1),
-    Glyph::new(0x00AE, 0x0D9F, 16, 15, 15, 0, 6),
-    Glyph::new(0x00B0, 0x0DBC, 14, 10, 11, 2, 8),
-    Glyph::new(0x00B1, 0x0DCA, 17, 12, 17, 2, -1),
-    Glyph::new(0x00B2, 0x0DE4, 12, 10, 13, 1, 9),
-    Glyph::new(0x00B3, 0x0DF5, 12, 10, 13, 1, 9),
-    Glyph::new(0x00B5, 0x0E06, 18, 17, 20, 1, -6),
-    Glyph::new(0x00B6, 0x0E31, 16, 15, 23, 0, -4),
-    Glyph::new(0x00B7, 0x0E5D, 8, 6, 5, 1, 5),
-    Glyph::new(0x00B9, 0x0E61, 12, 9, 13, 1, 9),
-    Glyph::new(0x00BA, 0x0E70, 12, 10, 13, 1, 6),
-    Glyph::new(0x00BB, 0x0E81, 16, 14, 11, 1, 1),
-    Glyph::new(0x00BC, 0x0E95, 28, 27, 22, 1, -2),
-    Glyph::new(0x00BD, 0x0EE0, 28, 26, 22, 1, -2),
-    Glyph::new(0x00BE, 0x0F28, 28, 27, 22, 1, -2),
-    Glyph::new(0x00BF, 0x0F73, 13, 11, 21, 1, -6),
-    Glyph::new(0x00C0, 0x0F90, 21, 20, 26, 0, 0),
-    Glyph::new(0x00C1, 0x0FD1, 21, 20, 26, 0, 0),
-    Glyph::new(0x00C2, 0x1012, 21, 20, 26, 0, 0),
-    Glyph::new(0x00C3, 0x1053, 21, 20, 25, 0, 0),
-    Glyph::new(0x00C4, 0x1092, 21, 20, 24, 0, 0),
-    Glyph::new(0x00C5, 0x10CE, 21, 20, 26, 0, 0),
-    Glyph::new(0x00C6, 0x110F, 26, 26, 19, -1, 0),
-    Glyph::new(0x00C7, 0x114D, 18, 16, 26, 1, -7),
-    Glyph::new(0x00C8, 0x1181, 17, 16, 26, 0, 0),
-    Glyph::new(0x00C9, 0x11B5, 17, 16, 26, 0, 0),
-    Glyph::new(0x00CA, 0x11E9, 17, 16, 26, 0, 0),
-    Glyph::new(0x00CB, 0x121D, 17, 16, 24, 0, 0),
-    Glyph::new(0x00CC, 0x124D, 11, 10, 26, 0, 0),
-    Glyph::new(0x00CD, 0x126E, 11, 10, 26, 0, 0),
-    Glyph::new(0x00CE, 0x128F, 11, 11, 26, 0, 0),
-    Glyph::new(0x00CF, 0x12B3, 11, 11, 24, 0, 0),
-    Glyph::new(0x00D0, 0x12D4, 21, 20, 20, 0, -1),
-    Glyph::new(0x00D1, 0x1306, 21, 21, 26, 0, -1),
-    Glyph::new(0x00D2, 0x134B, 21, 19, 27, 1, -1),
-    Glyph::new(0x00D3, 0x138C, 21, 19, 27, 1, -1),
-    Glyph::new(0x00D4, 0x13CD, 21, 19, 27, 1, -1),
-    Glyph::new(0x00D5, 0x140E, 21, 19, 26, 1, -1),
-    Glyph::new(0x00D6, 0x144C, 21, 19, 25, 1, -1),
-    Glyph::new(0x00D7, 0x1488, 17, 12, 12, 2, 3),
-    Glyph::new(0x00D8, 0x149A, 21, 20, 20, 0, -1),
-    Glyph::new(0x00D9, 0x14CC, 21, 21, 27, 0, -1),
-    Glyph::new(0x00DA, 0x1513, 21, 21, 27, 0, -1),
-    Glyph::new(0x00DB, 0x155A, 21, 21, 27, 0, -1),
-    Glyph::new(0x00DC, 0x15A1, 21, 21, 25, 0, -1),
-    Glyph::new(0x00DE, 0x15E3, 17, 16, 19, 0, 0),
-    Glyph::new(0x00DF, 0x1609, 18, 17, 22, 0, -1),
-    Glyph::new(0x00E0, 0x1638, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E1, 0x1661, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E2, 0x168A, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E3, 0x16B3, 15, 14, 22, 1, -1),
-    Glyph::new(0x00E4, 0x16DA, 15, 14, 21, 1, -1),
-    Glyph::new(0x00E5, 0x16FF, 15, 14, 23, 1, -1),
-    Glyph::new(0x00E6, 0x1728, 22, 20, 15, 1, -1),
-    Glyph::new(0x00E7, 0x174E, 14, 13, 21, 0, -7),
-    Glyph::new(0x00E8, 0x1771, 15, 14, 23, 0, -1),
-    Glyph::new(0x00E9, 0x179A, 15, 14, 23, 0, -1),
-    Glyph::new(0x00EA, 0x17C3, 15, 14, 23, 0, -1),
-    Glyph::new(0x00EB, 0x17EC, 15, 14, 21, 0, -1),
-    Glyph::new(0x00EC, 0x1811, 10, 9, 22, 0, 0),
-    Glyph::new(0x00ED, 0x182A, 10, 9, 22, 0, 0),
-    Glyph::new(0x00EE, 0x1843, 10, 10, 22, 0, 0),
-    Glyph::new(0x00EF, 0x185F, 10, 10, 20, 0, 0),
-    Glyph::new(0x00F0, 0x1878, 16, 15, 22, 0, -1),
-    Glyph::new(0x00F1, 0x18A2, 18, 18, 21, 0, 0),
-    Glyph::new(0x00F2, 0x18D2, 16, 15, 23, 0, -1),
-    Glyph::new(0x00F3, 0x18FE, 16, 15, 23, 0, -1),
-    Glyph::new(0x00F4, 0x192A, 16, 15, 23, 0, -1),
-    Glyph::new(0x00F5, 0x1956, 16, 15, 22, 0, -1),
-    Glyph::new(0x00F6, 0x1980, 16, 15, 21, 0, -1),
-    Glyph::new(0x00F7, 0x19A8, 17, 12, 13, 2, 2),
-    Glyph::new(0x00F8, 0x19BC, 16, 16, 15, 0, -1),
-    Glyph::new(0x00F9, 0x19DA, 17, 18, 23, 0, -1),
-    Glyph::new(0x00FA, 0x1A0E, 17, 18, 23, 0, -1),
-    Glyph::new(0x00FB, 0x1A42, 17, 18, 23, 0, -1),
-    Glyph::new(0x00FC, 0x1A76, 17, 18, 21, 0, -1),
-    Glyph::new(0x00FE, 0x1AA6, 17, 16, 27, 0, -6),
-    Glyph::new(0x00FF, 0x1ADC, 17, 17, 27, 0, -7),
-    Glyph::new(0x0104, 0x1B16, 21, 20, 25, 0, -6),
-    Glyph::new(0x0105, 0x1B55, 15, 14, 20, 1, -6),
-    Glyph::new(0x0106, 0x1B78, 18, 16, 27, 1, -1),
-    Glyph::new(0x0107, 0x1BAE, 14, 13, 23, 0, -1),
-    Glyph::new(0x010C, 0x1BD4, 18, 16, 27, 1, -1),
-    Glyph::new(0x010D, 0x1C0A, 14, 13, 23, 0, -1),
-    Glyph::new(0x010E, 0x1C30, 21, 20, 27, 0, -1),
-    Glyph::new(0x010F, 0x1C74, 17, 19, 22, 0, -1),
-    Glyph::new(0x0118, 0x1CA9, 17, 16, 25, 0, -6),
-    Glyph::new(0x0119, 0x1CDB, 15, 14, 20, 0, -6),
-    Glyph::new(0x011A, 0x1CFE, 17, 16, 26, 0, 0),
-    Glyph::new(0x011B, 0x1D32, 15, 14, 23, 0, -1),
-    Glyph::new(0x0139, 0x1D5B, 17, 16, 26, 0, 0),
-    Glyph::new(0x013A, 0x1D8F, 10, 9, 27, 0, 0),
-    Glyph::new(0x013D, 0x1DAE, 17, 16, 21, 0, 0),
-    Glyph::new(0x013E, 0x1DD8, 10, 12, 21, 0, 0),
-    Glyph::new(0x0141, 0x1DF8, 17, 17, 19, -1, 0),
-    Glyph::new(0x0142, 0x1E21, 10, 11, 21, -1, 0),
-    Glyph::new(0x0143, 0x1E3E, 21, 21, 27, 0, -1),
-    Glyph::new(0x0144, 0x1E85, 18, 18, 22, 0, 0),
-    Glyph::new(0x0147, 0x1EB7, 21, 21, 27, 0, -1),
-    Glyph::new(0x0148, 0x1EFE, 18, 18, 22, 0, 0),
-    Glyph::new(0x0152, 0x1F30, 27, 25, 20, 1, -1),
-    Glyph::new(0x0153, 0x1F6F, 24, 23, 15, 0, -1),
-    Glyph::new(0x0158, 0x1F9B, 19, 19, 27, 0, -1),
-    Glyph::new(0x0159, 0x1FDC, 13, 12, 22, 0, 0),
-    Glyph::new(0x015A, 0x1FFD, 16, 13, 27, 1, -1),
-    Glyph::new(0x015B, 0x2029, 14, 12, 23, 1, -1),
-    Glyph::new(0x0160, 0x204C, 16, 13, 27, 1, -1),
-    Glyph::new(0x0161, 0x2078, 14, 12, 23, 1, -1),
-    Glyph::new(0x0164, 0x209B, 19, 18, 26, 0, 0),
-    Glyph::new(0x0165, 0x20D6, 12, 12, 22, -1, -1),
-    Glyph::new(0x016E, 0x20F7, 21, 21, 27, 0, -1),
-    Glyph::new(0x016F, 0x213E, 17, 18, 23, 0, -1),
-    Glyph::new(0x0170, 0x2172, 21, 21, 27, 0, -1),
-    Glyph::new(0x0171, 0x21B9, 17, 18, 23, 0, -1),
-    Glyph::new(0x0178, 0x21ED, 19, 19, 24, 0, 0),
-    Glyph::new(0x0179, 0x2226, 16, 16, 27, 0, -1),
-    Glyph::new(0x017A, 0x225C, 14, 13, 23, 0, -1),
-    Glyph::new(0x017B, 0x2282, 16, 16, 26, 0, -1),
-    Glyph::new(0x017C, 0x22B6, 14, 13, 22, 0, -1),
-    Glyph::new(0x017D, 0x22DA, 16, 16, 27, 0, -1),
-    Glyph::new(0x017E, 0x2310, 14, 13, 23, 0, -1),
-    Glyph::new(0x03C0, 0x2336, 18, 18, 15, 0, -1),
-    Glyph::new(0x1E9E, 0x2358, 20, 20, 20, 0, -1),
-    Glyph::new(0x2013, 0x238A, 13, 13, 3, 0, 5),
-    Glyph::new(0x2014, 0x238F, 26, 26, 3, 0, 5),
-    Glyph::new(0x2018, 0x2399, 7, 6, 9, 0, 11),
-    Glyph::new(0x2019, 0x23A0, 7, 6, 9, 0, 11),
-    Glyph::new(0x201A, 0x23A7, 7, 6, 9, 0, -5),
-    Glyph::new(0x201B, 0x23AE, 7, 6, 9, 0, 11),
-    Glyph::new(0x201C, 0x23B5, 12, 11, 9, 0, 11),
-    Glyph::new(0x201D, 0x23C2, 12, 11, 9, 0, 11),
-    Glyph::new(0x201E, 0x23CF, 12, 11, 9, 0, -5),
-    Glyph::new(0x201F, 0x23DC, 12, 11, 9, 0, 11),
-    Glyph::new(0x2020, 0x23E9, 13, 13, 18, 0, 1),
-    Glyph::new(0x2021, 0x2407, 13, 13, 21, 0, -2),
-    Glyph::new(0x2022, 0x242A, 8, 6, 6, 1, 4),
-    Glyph::new(0x2026, 0x242F, 26, 22, 5, 2, -1),
-    Glyph::new(0x2039, 0x243D, 9, 8, 11, 0, 1),
-    Glyph::new(0x203A, 0x2448, 9, 7, 11, 1, 1),
-    Glyph::new(0x2070, 0x2452, 12, 12, 13, 0, 9),
-    Glyph::new(0x2074, 0x2466, 12, 11, 13, 0, 9),
-    Glyph::new(0x2075, 0x2478, 12, 9, 13, 1, 9),
-    Glyph::new(0x2076, 0x2487, 12, 10, 13, 1, 9),
-    Glyph::new(0x2077, 0x2498, 12, 10, 13, 1, 9),
-    Glyph::new(0x2078, 0x24A9, 12, 10, 13, 1, 9),
-    Glyph::new(0x2079, 0x24BA, 12, 10, 13, 1, 9),
-    Glyph::new(0x2080, 0x24CB, 12, 12, 13, 0, -4),
-    Glyph::new(0x2081, 0x24DF, 12, 9, 13, 1, -4),
-    Glyph::new(0x2082, 0x24EE, 12, 10, 13, 1, -4),
-    Glyph::new(0x2083, 0x24FF, 12, 10, 13, 1, -4),
-    Glyph::new(0x2084, 0x2510, 12, 11, 13, 0, -4),
-    Glyph::new(0x2085, 0x2522, 12, 9, 13, 1, -4),
-    Glyph::new(0x2086, 0x2531, 12, 10, 13, 1, -4),
-    Glyph::new(0x2087, 0x2542, 12, 10, 13, 1, -4),
-    Glyph::new(0x2088, 0x2553, 12, 10, 13, 1, -4),
-    Glyph::new(0x2089, 0x2564, 12, 10, 13, 1, -4),
-    Glyph::new(0x20AC, 0x2575, 17, 16, 20, 0, -1),
-    Glyph::new(0x2122, 0x259D, 23, 22, 10, 0, 9),
-    Glyph::new(0x2153, 0x25B9, 28, 26, 22, 1, -2),
-    Glyph::new(0x2154, 0x2601, 28, 26, 22, 1, -2),
-    Glyph::new(0x215B, 0x2649, 28, 26, 22, 1, -2),
-    Glyph::new(0x215C, 0x2691, 28, 26, 22, 1, -2),
-    Glyph::new(0x215D, 0x26D9, 28, 26, 22, 1, -2),
-    Glyph::new(0x215E, 0x2721, 28, 26, 22, 1, -2),
-    Glyph::new(0x2190, 0x2769, 26, 16, 12, 5, 3),
-    Glyph::new(0x2191, 0x2781, 26, 12, 18, 7, 0),
-    Glyph::new(0x2192, 0x279C, 26, 16, 12, 5, 3),
-    Glyph::new(0x2193, 0x27B4, 26, 12, 18, 7, 0),
-    Glyph::new(0x2194, 0x27CF, 26, 18, 12, 4, 3),
-    Glyph::new(0x2195, 0x27EA, 26, 12, 18, 7, 0),
-    Glyph::new(0x21D0, 0x2805, 26, 18, 16, 4, 1),
-    Glyph::new(0x21D1, 0x2829, 26, 16, 18, 5, 0),
-    Glyph::new(0x21D2, 0x284D, 26, 18, 16, 4, 1),
-    Glyph::new(0x21D3, 0x2871, 26, 16, 18, 5, 0),
-    Glyph::new(0x21D4, 0x2895, 26, 18, 14, 4, 2),
-    Glyph::new(0x2202, 0x28B5, 17, 14, 22, 1, -1),
-    Glyph::new(0x2206, 0x28DC, 18, 18, 19, 0, 0),
-    Glyph::new(0x220F, 0x2907, 22, 21, 24, 0, -5),
-    Glyph::new(0x2211, 0x2946, 18, 17, 24, 0, -5),
-    Glyph::new(0x221A, 0x2979, 17, 18, 24, -1, -3),
-    Glyph::new(0x221E, 0x29AF, 17, 16, 10, 0, 3),
-    Glyph::new(0x222B, 0x29C3, 17, 15, 28, 1, -7),
-    Glyph::new(0x2260, 0x29F8, 17, 12, 13, 2, 2),
-    Glyph::new(0x2264, 0x2A0C, 17, 12, 16, 2, 0),
-    Glyph::new(0x2265, 0x2A24, 17, 12, 16, 2, 0),
+    Glyph::new(0x0022, 0x0023, 11, 9, 9, 1, 10),
+    Glyph::new(0x0023, 0x0041, 17, 17, 17, 0, -2),
+    Glyph::new(0x0024, 0x007D, 17, 14, 26, 1, -5),
+    Glyph::new(0x0025, 0x00CA, 26, 24, 22, 1, -2),
+    Glyph::new(0x0026, 0x0137, 21, 21, 20, 0, -1),
+    Glyph::new(0x0027, 0x0189, 6, 4, 9, 1, 10),
+    Glyph::new(0x0028, 0x0197, 10, 9, 26, 1, -5),
+    Glyph::new(0x0029, 0x01C9, 10, 9, 26, 0, -5),
+    Glyph::new(0x002A, 0x01FB, 11, 10, 10, 0, 10),
+    Glyph::new(0x002B, 0x0216, 17, 12, 13, 2, 2),
+    Glyph::new(0x002C, 0x0233, 8, 7, 9, 0, -5),
+    Glyph::new(0x002D, 0x0243, 10, 9, 4, 0, 5),
+    Glyph::new(0x002E, 0x0248, 8, 6, 5, 1, -1),
+    Glyph::new(0x002F, 0x0252, 14, 13, 21, 0, -2),
+    Glyph::new(0x0030, 0x027A, 17, 16, 20, 0, -1),
+    Glyph::new(0x0031, 0x02B2, 17, 12, 19, 2, 0),
+    Glyph::new(0x0032, 0x02E0, 17, 14, 19, 1, 0),
+    Glyph::new(0x0033, 0x030E, 17, 14, 20, 1, -1),
+    Glyph::new(0x0034, 0x0345, 17, 16, 20, 0, -1),
+    Glyph::new(0x0035, 0x037F, 17, 13, 19, 1, -1),
+    Glyph::new(0x0036, 0x03B2, 17, 14, 20, 1, -1),
+    Glyph::new(0x0037, 0x03EB, 17, 14, 19, 1, -1),
+    Glyph::new(0x0038, 0x041F, 17, 14, 20, 1, -1),
+    Glyph::new(0x0039, 0x0459, 17, 14, 20, 1, -1),
+    Glyph::new(0x003A, 0x048E, 8, 6, 15, 1, -1),
+    Glyph::new(0x003B, 0x04A2, 8, 7, 19, 0, -5),
+    Glyph::new(0x003C, 0x04BB, 17, 12, 13, 2, 2),
+    Glyph::new(0x003D, 0x04DA, 17, 12, 8, 2, 5),
+    Glyph::new(0x003E, 0x04EE, 17, 12, 13, 2, 2),
+    Glyph::new(0x003F, 0x050A, 13, 11, 21, 1, -1),
+    Glyph::new(0x0040, 0x0532, 26, 24, 25, 1, -6),
+    Glyph::new(0x0041, 0x05A9, 21, 20, 19, 0, 0),
+    Glyph::new(0x0042, 0x05E5, 17, 16, 20, 0, -1),
+    Glyph::new(0x0043, 0x0624, 18, 16, 20, 1, -1),
+    Glyph::new(0x0044, 0x065F, 21, 20, 20, 0, -1),
+    Glyph::new(0x0045, 0x06A7, 17, 16, 19, 0, 0),
+    Glyph::new(0x0046, 0x06E9, 16, 15, 19, 0, 0),
+    Glyph::new(0x0047, 0x071D, 20, 18, 20, 1, -1),
+    Glyph::new(0x0048, 0x0766, 23, 22, 19, 0, 0),
+    Glyph::new(0x0049, 0x07AC, 11, 10, 19, 0, 0),
+    Glyph::new(0x004A, 0x07D6, 11, 12, 25, -2, -6),
+    Glyph::new(0x004B, 0x0807, 20, 20, 20, 0, -1),
+    Glyph::new(0x004C, 0x084E, 17, 16, 19, 0, 0),
+    Glyph::new(0x004D, 0x0881, 25, 25, 19, 0, 0),
+    Glyph::new(0x004E, 0x08DA, 21, 21, 20, 0, -1),
+    Glyph::new(0x004F, 0x092F, 21, 19, 20, 1, -1),
+    Glyph::new(0x0050, 0x0973, 17, 16, 19, 0, 0),
+    Glyph::new(0x0051, 0x09AD, 21, 20, 25, 1, -6),
+    Glyph::new(0x0052, 0x09FC, 19, 19, 20, 0, -1),
+    Glyph::new(0x0053, 0x0A46, 16, 13, 20, 1, -1),
+    Glyph::new(0x0054, 0x0A81, 19, 18, 19, 0, 0),
+    Glyph::new(0x0055, 0x0AB4, 21, 21, 20, 0, -1),
+    Glyph::new(0x0056, 0x0AF3, 21, 20, 20, 0, -1),
+    Glyph::new(0x0057, 0x0B2E, 29, 29, 20, 0, -1),
+    Glyph::new(0x0058, 0x0B8D, 20, 20, 19, 0, 0),
+    Glyph::new(0x0059, 0x0BCB, 19, 19, 19, 0, 0),
+    Glyph::new(0x005A, 0x0C03, 16, 16, 20, 0, -1),
+    Glyph::new(0x005B, 0x0C3B, 9, 7, 26, 1, -5),
+    Glyph::new(0x005C, 0x0C67, 14, 13, 21, 0, -2),
+    Glyph::new(0x005D, 0x0C93, 9, 7, 26, 1, -5),
+    Glyph::new(0x005E, 0x0CB3, 17, 14, 13, 1, 4),
+    Glyph::new(0x005F, 0x0CDB, 13, 13, 3, 0, -4),
+    Glyph::new(0x0060, 0x0CE4, 18, 7, 7, 5, 15),
+    Glyph::new(0x0061, 0x0CEF, 15, 14, 15, 1, -1),
+    Glyph::new(0x0062, 0x0D20, 17, 17, 22, -1, -1),
+    Glyph::new(0x0063, 0x0D60, 14, 13, 15, 0, -1),
+    Glyph::new(0x0064, 0x0D86, 17, 17, 22, 0, -1),
+    Glyph::new(0x0065, 0x0DBF, 15, 14, 15, 0, -1),
+    Glyph::new(0x0066, 0x0DE8, 12, 14, 21, 0, 0),
+    Glyph::new(0x0067, 0x0E13, 16, 16, 21, 0, -7),
+    Glyph::new(0x0068, 0x0E5B, 18, 17, 21, 0, 0),
+    Glyph::new(0x0069, 0x0E97, 10, 9, 21, 0, 0),
+    Glyph::new(0x006A, 0x0EB8, 9, 9, 28, -2, -7),
+    Glyph::new(0x006B, 0x0EEB, 17, 17, 22, 0, -1),
+    Glyph::new(0x006C, 0x0F33, 10, 9, 21, 0, 0),
+    Glyph::new(0x006D, 0x0F5E, 26, 26, 14, 0, 0),
+    Glyph::new(0x006E, 0x0FA5, 18, 18, 14, 0, 0),
+    Glyph::new(0x006F, 0x0FD8, 16, 15, 15, 0, -1),
+    Glyph::new(0x0070, 0x1007, 17, 16, 20, 0, -6),
+    Glyph::new(0x0071, 0x1049, 16, 16, 20, 0, -6),
+    Glyph::new(0x0072, 0x1081, 13, 12, 14, 0, 0),
+    Glyph::new(0x0073, 0x10A4, 14, 12, 15, 1, -1),
+    Glyph::new(0x0074, 0x10D1, 12, 12, 19, -1, -1),
+    Glyph::new(0x0075, 0x10F2, 17, 18, 15, 0, -1),
+    Glyph::new(0x0076, 0x1134, 17, 17, 15, 0, -1),
+    Glyph::new(0x0077, 0x1167, 24, 24, 15, 0, -1),
+    Glyph::new(0x0078, 0x11B2, 17, 16, 14, 0, 0),
+    Glyph::new(0x0079, 0x11E3, 17, 17, 21, 0, -7),
+    Glyph::new(0x007A, 0x1223, 14, 13, 15, 0, -1),
+    Glyph::new(0x007B, 0x124F, 11, 9, 26, 1, -5),
+    Glyph::new(0x007C, 0x1286, 9, 4, 24, 2, -4),
+    Glyph::new(0x007D, 0x12A9, 11, 9, 26, 0, -5),
+    Glyph::new(0x007E, 0x12E0, 17, 14, 6, 1, 6),
+    Glyph::new(0x00A1, 0x12F2, 8, 5, 21, 1, -6),
+    Glyph::new(0x00A2, 0x1311, 17, 14, 25, 1, -5),
+    Glyph::new(0x00A3, 0x135C, 17, 16, 20, 0, -1),
+    Glyph::new(0x00A4, 0x1396, 17, 15, 13, 1, 2),
+    Glyph::new(0x00A5, 0x13C3, 17, 18, 18, -1, 0),
+    Glyph::new(0x00A7, 0x1403, 14, 13, 21, 0, -3),
+    Glyph::new(0x00A9, 0x1444, 21, 20, 20, 0, -1),
+    Glyph::new(0x00AA, 0x14A6, 12, 10, 13, 1, 6),
+    Glyph::new(0x00AB, 0x14C9, 16, 15, 11, 0, 1),
+    Glyph::new(0x00AE, 0x14EE, 16, 15, 15, 0, 6),
+    Glyph::new(0x00B0, 0x152F, 14, 10, 11, 2, 8),
+    Glyph::new(0x00B1, 0x1547, 17, 12, 17, 2, -1),
+    Glyph::new(0x00B2, 0x156F, 12, 10, 13, 1, 9),
+    Glyph::new(0x00B3, 0x158E, 12, 10, 13, 1, 9),
+    Glyph::new(0x00B5, 0x15B0, 18, 17, 20, 1, -6),
+    Glyph::new(0x00B6, 0x15EC, 16, 15, 23, 0, -4),
+    Glyph::new(0x00B7, 0x1636, 8, 6, 5, 1, 5),
+    Glyph::new(0x00B9, 0x163F, 12, 9, 13, 1, 9),
+    Glyph::new(0x00BA, 0x165F, 12, 10, 13, 1, 6),
+    Glyph::new(0x00BB, 0x1681, 16, 14, 11, 1, 1),
+    Glyph::new(0x00BC, 0x16A5, 28, 27, 22, 1, -2),
+    Glyph::new(0x00BD, 0x170F, 28, 26, 22, 1, -2),
+    Glyph::new(0x00BE, 0x1777, 28, 27, 22, 1, -2),
+    Glyph::new(0x00BF, 0x17DF, 13, 11, 21, 1, -6),
+    Glyph::new(0x00C0, 0x1807, 21, 20, 26, 0, 0),
+    Glyph::new(0x00C1, 0x1851, 21, 20, 26, 0, 0),
+    Glyph::new(0x00C2, 0x189C, 21, 20, 26, 0, 0),
+    Glyph::new(0x00C3, 0x18EB, 21, 20, 25, 0, 0),
+    Glyph::new(0x00C4, 0x1937, 21, 20, 24, 0, 0),
+    Glyph::new(0x00C5, 0x1984, 21, 20, 26, 0, 0),
+    Glyph::new(0x00C6, 0x19D6, 26, 26, 19, -1, 0),
+    Glyph::new(0x00C7, 0x1A2F, 18, 16, 26, 1, -7),
+    Glyph::new(0x00C8, 0x1A75, 17, 16, 26, 0, 0),
+    Glyph::new(0x00C9, 0x1AC4, 17, 16, 26, 0, 0),
+    Glyph::new(0x00CA, 0x1B13, 17, 16, 26, 0, 0),
+    Glyph::new(0x00CB, 0x1B65, 17, 16, 24, 0, 0),
+    Glyph::new(0x00CC, 0x1BB7, 11, 10, 26, 0, 0),
+    Glyph::new(0x00CD, 0x1BED, 11, 10, 26, 0, 0),
+    Glyph::new(0x00CE, 0x1C22, 11, 11, 26, 0, 0),
+    Glyph::new(0x00CF, 0x1C54, 11, 11, 24, 0, 0),
+    Glyph::new(0x00D0, 0x1C86, 21, 20, 20, 0, -1),
+    Glyph::new(0x00D1, 0x1CCE, 21, 21, 26, 0, -1),
+    Glyph::new(0x00D2, 0x1D34, 21, 19, 27, 1, -1),
+    Glyph::new(0x00D3, 0x1D86, 21, 19, 27, 1, -1),
+    Glyph::new(0x00D4, 0x1DD8, 21, 19, 27, 1, -1),
+    Glyph::new(0x00D5, 0x1E2D, 21, 19, 26, 1, -1),
+    Glyph::new(0x00D6, 0x1E83, 21, 19, 25, 1, -1),
+    Glyph::new(0x00D7, 0x1ED7, 17, 12, 12, 2, 3),
+    Glyph::new(0x00D8, 0x1EF7, 21, 20, 20, 0, -1),
+    Glyph::new(0x00D9, 0x1F49, 21, 21, 27, 0, -1),
+    Glyph::new(0x00DA, 0x1F97, 21, 21, 27, 0, -1),
+    Glyph::new(0x00DB, 0x1FE5, 21, 21, 27, 0, -1),
+    Glyph::new(0x00DC, 0x2034, 21, 21, 25, 0, -1),
+    Glyph::new(0x00DE, 0x2085, 17, 16, 19, 0, 0),
+    Glyph::new(0x00DF, 0x20BF, 18, 17, 22, 0, -1),
+    Glyph::new(0x00E0, 0x2113, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E1, 0x2152, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E2, 0x2190, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E3, 0x21D1, 15, 14, 22, 1, -1),
+    Glyph::new(0x00E4, 0x2211, 15, 14, 21, 1, -1),
+    Glyph::new(0x00E5, 0x2253, 15, 14, 23, 1, -1),
+    Glyph::new(0x00E6, 0x229A, 22, 20, 15, 1, -1),
+    Glyph::new(0x00E7, 0x22DD, 14, 13, 21, 0, -7),
+    Glyph::new(0x00E8, 0x2310, 15, 14, 23, 0, -1),
+    Glyph::new(0x00E9, 0x2345, 15, 14, 23, 0, -1),
+    Glyph::new(0x00EA, 0x237B, 15, 14, 23, 0, -1),
+    Glyph::new(0x00EB, 0x23B6, 15, 14, 21, 0, -1),
+    Glyph::new(0x00EC, 0x23EF, 10, 9, 22, 0, 0),
+    Glyph::new(0x00ED, 0x2414, 10, 9, 22, 0, 0),
+    Glyph::new(0x00EE, 0x243B, 10, 10, 22, 0, 0),
+    Glyph::new(0x00EF, 0x2469, 10, 10, 20, 0, 0),
+    Glyph::new(0x00F0, 0x2495, 16, 15, 22, 0, -1),
+    Glyph::new(0x00F1, 0x24D8, 18, 18, 21, 0, 0),
+    Glyph::new(0x00F2, 0x251B, 16, 15, 23, 0, -1),
+    Glyph::new(0x00F3, 0x2557, 16, 15, 23, 0, -1),
+    Glyph::new(0x00F4, 0x2595, 16, 15, 23, 0, -1),
+    Glyph::new(0x00F5, 0x25D7, 16, 15, 22, 0, -1),
+    Glyph::new(0x00F6, 0x2616, 16, 15, 21, 0, -1),
+    Glyph::new(0x00F7, 0x2656, 17, 12, 13, 2, 2),
+    Glyph::new(0x00F8, 0x2670, 16, 16, 15, 0, -1),
+    Glyph::new(0x00F9, 0x26A5, 17, 18, 23, 0, -1),
+    Glyph::new(0x00FA, 0x26F5, 17, 18, 23, 0, -1),
+    Glyph::new(0x00FB, 0x2745, 17, 18, 23, 0, -1),
+    Glyph::new(0x00FC, 0x279A, 17, 18, 21, 0, -1),
+    Glyph::new(0x00FE, 0x27ED, 17, 16, 27, 0, -6),
+    Glyph::new(0x00FF, 0x283D, 17, 17, 27, 0, -7),
+    Glyph::new(0x0104, 0x288F, 21, 20, 25, 0, -6),
+    Glyph::new(0x0105, 0x28DD, 15, 14, 20, 1, -6),
+    Glyph::new(0x0106, 0x291A, 18, 16, 27, 1, -1),
+    Glyph::new(0x0107, 0x2963, 14, 13, 23, 0, -1),
+    Glyph::new(0x010C, 0x2994, 18, 16, 27, 1, -1),
+    Glyph::new(0x010D, 0x29DD, 14, 13, 23, 0, -1),
+    Glyph::new(0x010E, 0x2A13, 21, 20, 27, 0, -1),
+    Glyph::new(0x010F, 0x2A6D, 17, 19, 22, 0, -1),
+    Glyph::new(0x0118, 0x2AB2, 17, 16, 25, 0, -6),
+    Glyph::new(0x0119, 0x2B02, 15, 14, 20, 0, -6),
+    Glyph::new(0x011A, 0x2B37, 17, 16, 26, 0, 0),
+    Glyph::new(0x011B, 0x2B89, 15, 14, 23, 0, -1),
+    Glyph::new(0x0139, 0x2BC4, 17, 16, 26, 0, 0),
+    Glyph::new(0x013A, 0x2C04, 10, 9, 27, 0, 0),
+    Glyph::new(0x013D, 0x2C39, 17, 16, 21, 0, 0),
+    Glyph::new(0x013E, 0x2C75, 10, 12, 21, 0, 0),
+    Glyph::new(0x0141, 0x2CB1, 17, 17, 19, -1, 0),
+    Glyph::new(0x0142, 0x2CE6, 10, 11, 21, -1, 0),
+    Glyph::new(0x0143, 0x2D14, 21, 21, 27, 0, -1),
+    Glyph::new(0x0144, 0x2D77, 18, 18, 22, 0, 0),
+    Glyph::new(0x0147, 0x2DB8, 21, 21, 27, 0, -1),
+    Glyph::new(0x0148, 0x2E1F, 18, 18, 22, 0, 0),
+    Glyph::new(0x0152, 0x2E64, 27, 25, 20, 1, -1),
+    Glyph::new(0x0153, 0x2EBC, 24, 23, 15, 0, -1),
+    Glyph::new(0x0158, 0x2F03, 19, 19, 27, 0, -1),
+    Glyph::new(0x0159, 0x2F5F, 13, 12, 22, 0, 0),
+    Glyph::new(0x015A, 0x2F92, 16, 13, 27, 1, -1),
+    Glyph::new(0x015B, 0x2FDA, 14, 12, 23, 1, -1),
+    Glyph::new(0x0160, 0x3013, 16, 13, 27, 1, -1),
+    Glyph::new(0x0161, 0x305B, 14, 12, 23, 1, -1),
+    Glyph::new(0x0164, 0x3097, 19, 18, 26, 0, 0),
+    Glyph::new(0x0165, 0x30DC, 12, 12, 22, -1, -1),
+    Glyph::new(0x016E, 0x3109, 21, 21, 27, 0, -1),
+    Glyph::new(0x016F, 0x315E, 17, 18, 23, 0, -1),
+    Glyph::new(0x0170, 0x31B6, 21, 21, 27, 0, -1),
+    Glyph::new(0x0171, 0x320D, 17, 18, 23, 0, -1),
+    Glyph::new(0x0178, 0x3268, 19, 19, 24, 0, 0),
+    Glyph::new(0x0179, 0x32B1, 16, 16, 27, 0, -1),
+    Glyph::new(0x017A, 0x32F7, 14, 13, 23, 0, -1),
+    Glyph::new(0x017B, 0x3331, 16, 16, 26, 0, -1),
+    Glyph::new(0x017C, 0x3372, 14, 13, 22, 0, -1),
+    Glyph::new(0x017D, 0x33A9, 16, 16, 27, 0, -1),
+    Glyph::new(0x017E, 0x33F0, 14, 13, 23, 0, -1),
+    Glyph::new(0x03C0, 0x342D, 18, 18, 15, 0, -1),
+    Glyph::new(0x1E9E, 0x346A, 20, 20, 20, 0, -1),
+    Glyph::new(0x2013, 0x34B8, 13, 13, 3, 0, 5),
+    Glyph::new(0x2014, 0x34C1, 26, 26, 3, 0, 5),
+    Glyph::new(0x2018, 0x34D2, 7, 6, 9, 0, 11),
+    Glyph::new(0x2019, 0x34E1, 7, 6, 9, 0, 11),
+    Glyph::new(0x201A, 0x34EE, 7, 6, 9, 0, -5),
+    Glyph::new(0x201B, 0x34FC, 7, 6, 9, 0, 11),
+    Glyph::new(0x201C, 0x350A, 12, 11, 9, 0, 11),
+    Glyph::new(0x201D, 0x3527, 12, 11, 9, 0, 11),
+    Glyph::new(0x201E, 0x3541, 12, 11, 9, 0, -5),
+    Glyph::new(0x201F, 0x355D, 12, 11, 9, 0, 11),
+    Glyph::new(0x2020, 0x3579, 13, 13, 18, 0, 1),
+    Glyph::new(0x2021, 0x359E, 13, 13, 21, 0, -2),
+    Glyph::new(0x2022, 0x35D0, 8, 6, 6, 1, 4),
+    Glyph::new(0x2026, 0x35DC, 26, 22, 5, 2, -1),
+    Glyph::new(0x2039, 0x35F7, 9, 8, 11, 0, 1),
+    Glyph::new(0x203A, 0x360A, 9, 7, 11, 1, 1),
+    Glyph::new(0x2070, 0x361D, 12, 12, 13, 0, 9),
+    Glyph::new(0x2074, 0x3640, 12, 11, 13, 0, 9),
+    Glyph::new(0x2075, 0x365B, 12, 9, 13, 1, 9),
+    Glyph::new(0x2076, 0x3677, 12, 10, 13, 1, 9),
+    Glyph::new(0x2077, 0x3698, 12, 10, 13, 1, 9),
+    Glyph::new(0x2078, 0x36B1, 12, 10, 13, 1, 9),
+    Glyph::new(0x2079, 0x36D2, 12, 10, 13, 1, 9),
+    Glyph::new(0x2080, 0x36F7, 12, 12, 13, 0, -4),
+    Glyph::new(0x2081, 0x371A, 12, 9, 13, 1, -4),
+    Glyph::new(0x2082, 0x373A, 12, 10, 13, 1, -4),
+    Glyph::new(0x2083, 0x375B, 12, 10, 13, 1, -4),
+    Glyph::new(0x2084, 0x377D, 12, 11, 13, 0, -4),
+    Glyph::new(0x2085, 0x379D, 12, 9, 13, 1, -4),
+    Glyph::new(0x2086, 0x37B9, 12, 10, 13, 1, -4),
+    Glyph::new(0x2087, 0x37DB, 12, 10, 13, 1, -4),
+    Glyph::new(0x2088, 0x37F4, 12, 10, 13, 1, -4),
+    Glyph::new(0x2089, 0x3816, 12, 10, 13, 1, -4),
+    Glyph::new(0x20AC, 0x383A, 17, 16, 20, 0, -1),
+    Glyph::new(0x2122, 0x3874, 23, 22, 10, 0, 9),
+    Glyph::new(0x2153, 0x38B1, 28, 26, 22, 1, -2),
+    Glyph::new(0x2154, 0x3919, 28, 26, 22, 1, -2),
+    Glyph::new(0x215B, 0x3983, 28, 26, 22, 1, -2),
+    Glyph::new(0x215C, 0x39F4, 28, 26, 22, 1, -2),
+    Glyph::new(0x215D, 0x3A64, 28, 26, 22, 1, -2),
+    Glyph::new(0x215E, 0x3AD8, 28, 26, 22, 1, -2),
+    Glyph::new(0x2190, 0x3B49, 26, 16, 12, 5, 3),
+    Glyph::new(0x2191, 0x3B6A, 26, 12, 18, 7, 0),
+    Glyph::new(0x2192, 0x3B93, 26, 16, 12, 5, 3),
+    Glyph::new(0x2193, 0x3BB4, 26, 12, 18, 7, 0),
+    Glyph::new(0x2194, 0x3BDD, 26, 18, 12, 4, 3),
+    Glyph::new(0x2195, 0x3C06, 26, 12, 18, 7, 0),
+    Glyph::new(0x21D0, 0x3C3D, 26, 18, 16, 4, 1),
+    Glyph::new(0x21D1, 0x3C63, 26, 16, 18, 5, 0),
+    Glyph::new(0x21D2, 0x3C99, 26, 18, 16, 4, 1),
+    Glyph::new(0x21D3, 0x3CBF, 26, 16, 18, 5, 0),
+    Glyph::new(0x21D4, 0x3CF6, 26, 18, 14, 4, 2),
+    Glyph::new(0x2202, 0x3D25, 17, 14, 22, 1, -1),
+    Glyph::new(0x2206, 0x3D66, 18, 18, 19, 0, 0),
+    Glyph::new(0x220F, 0x3DA1, 22, 21, 24, 0, -5),
+    Glyph::new(0x2211, 0x3E04, 18, 17, 24, 0, -5),
+    Glyph::new(0x221A, 0x3E40, 17, 18, 24, -1, -3),
+    Glyph::new(0x221E, 0x3E83, 17, 16, 10, 0, 3),
+    Glyph::new(0x222B, 0x3EAD, 17, 15, 28, 1, -7),
+    Glyph::new(0x2260, 0x3EE3, 17, 12, 13, 2, 2),
+    Glyph::new(0x2264, 0x3F01, 17, 12, 16, 2, 0),
+    Glyph::new(0x2265, 0x3F23, 17, 12, 16, 2, 0),
+    Glyph::new(0xFB01, 0x3F48, 22, 21, 21, 0, 0),
+    Glyph::new(0xFB02, 0x3F92, 22, 21, 21, 0, 0),
 ];
 
-const BITMAP_BW: &[u8; 10812] = include_bytes!("./bookerly_bold_26.bw");
-const BITMAP_MSB: &[u8; 10812] = include_bytes!("./bookerly_bold_26.msb");
-const BITMAP_LSB: &[u8; 10812] = include_bytes!("./bookerly_bold_26.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 13), (18, 13), (19, 14),
+    (20, 13), (21, 13), (22, 15), (23, 13), (24, 13), (25, 16), (26, 13), (27, 14),
+    (28, 13), (29, 14), (30, 13), (31, 17), (32, 18), (33, 19), (34, 20), (35, 21),
+    (36, 22), (37, 23), (38, 24), (39, 25), (0, 0), (40, 26), (0, 0), (0, 0),
+    (0, 0), (41, 27), (42, 28), (43, 29), (44, 30), (45, 31), (46, 32), (47, 33),
+    (48, 34), (44, 35), (49, 36), (50, 34), (44, 37), (51, 38), (48, 38), (52, 31),
+    (53, 39), (54, 31), (55, 38), (56, 40), (57, 41), (58, 42), (59, 43), (60, 44),
+    (61, 45), (59, 46), (62, 47), (39, 48), (0, 0), (63, 49), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (64, 50), (65, 51),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (66, 52), (0, 0), (0, 0),
+    (0, 0), (67, 53), (68, 54), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (69, 12), (15, 14), (17, 13),
+    (17, 13), (17, 13), (17, 13), (21, 13), (21, 13), (21, 55), (21, 55), (16, 0),
+    (26, 13), (27, 14), (27, 14), (27, 14), (27, 14), (27, 14), (0, 0), (70, 56),
+    (33, 19), (33, 19), (33, 19), (33, 19), (71, 13), (72, 57), (41, 58), (73, 27),
+    (74, 59), (74, 59), (75, 60), (74, 58), (76, 27), (77, 29), (45, 61), (78, 31),
+    (79, 62), (79, 62), (80, 35), (81, 63), (21, 35), (21, 64), (82, 65), (83, 38),
+    (52, 66), (52, 31), (84, 61), (84, 61), (5, 62), (0, 0), (84, 30), (58, 42),
+    (58, 42), (58, 42), (58, 42), (53, 67), (59, 46), (85, 12), (86, 27), (15, 14),
+    (43, 29), (15, 14), (87, 61), (16, 13), (88, 30), (17, 13), (89, 31), (17, 13),
+    (78, 61), (24, 13), (44, 37), (90, 13), (88, 37), (24, 68), (91, 0), (26, 13),
+    (48, 38), (26, 13), (48, 38), (92, 14), (93, 29), (30, 13), (94, 63), (31, 17),
+    (95, 40), (31, 17), (95, 69), (32, 18), (96, 41), (33, 19), (58, 42), (33, 19),
+    (58, 42), (37, 23), (38, 24), (62, 47), (38, 24), (62, 47), (38, 24), (62, 70),
+    (97, 71), (98, 72), (99, 73), (99, 73), (100, 74), (101, 2), (102, 75), (0, 0),
+    (103, 74), (104, 2), (105, 75), (0, 0), (0, 0), (0, 0), (0, 0), (8, 76),
+    (106, 51), (107, 54), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (44, 32), (44, 32),
+];
+
+const KERNING: [&[i8]; 108] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -2, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -1, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -2, 0, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -2, -1, 0, 0, 0, 0, -1, -1, -1, 0, -2, -2],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, -1, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, -2, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -2, 0, -2, -2],
+    &[0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -2, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -2, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -2, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -2, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, -1, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, -1, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0],
+    &[0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, -1, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -2, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -2],
+];
+
+const BITMAP: &[u8; 16361] = include_bytes!("./bookerly_bold_26.rle");
@@ -1,308 +1,520 @@
 // Auto-generated font file
 // Font: Bookerly Bold
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 12395,
+    size: 18042,
     y_advance: 28,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 9, 7, 22, 1, -1),
-    Glyph::new(0x0022, 0x0014, 12, 10, 11, 1, 10),
-    Glyph::new(0x0023, 0x0022, 18, 18, 18, 0, -2),
-    Glyph::new(0x0024, 0x004B, 18, 14, 29, 2, -6),
-    Glyph::new(0x0025, 0x007E, 28, 25, 23, 1, -2),
-    Glyph::new(0x0026, 0x00C6, 23, 23, 22, 0, -1),
-    Glyph::new(0x0027, 0x0106, 7, 5, 11, 1, 10),
-    Glyph::new(0x0028, 0x010D, 11, 9, 28, 1, -5),
-    Glyph::new(0x0029, 0x012D, 11, 10, 28, 0, -5),
-    Glyph::new(0x002A, 0x0150, 11, 11, 10, 0, 11),
-    Glyph::new(0x002B, 0x015E, 18, 13, 13, 2, 3),
-    Glyph::new(0x002C, 0x0174, 9, 7, 10, 0, -6),
-    Glyph::new(0x002D, 0x017D, 11, 10, 4, 0, 5),
-    Glyph::new(0x002E, 0x0182, 9, 6, 5, 1, -1),
-    Glyph::new(0x002F, 0x0186, 15, 14, 23, 0, -2),
-    Glyph::new(0x0030, 0x01AF, 18, 17, 21, 0, -1),
-    Glyph::new(0x0031, 0x01DC, 18, 13, 20, 2, 0),
-    Glyph::new(0x0032, 0x01FD, 18, 15, 20, 1, 0),
-    Glyph::new(0x0033, 0x0223, 18, 15, 21, 1, -1),
-    Glyph::new(0x0034, 0x024B, 18, 17, 21, 0, -1),
-    Glyph::new(0x0035, 0x0278, 18, 14, 21, 1, -1),
-    Glyph::new(0x0036, 0x029D, 18, 15, 21, 1, -1),
-    Glyph::new(0x0037, 0x02C5, 18, 15, 21, 1, -1),
-    Glyph::new(0x0038, 0x02ED, 18, 15, 21, 1, -1),
-    Glyph::new(0x0039, 0x0315, 18, 15, 21, 1, -1),
-    Glyph::new(0x003A, 0x033D, 9, 6, 16, 1, -1),
-    Glyph::new(0x003B, 0x0349, 9, 7, 21, 0, -6),
-    Glyph::new(0x003C, 0x035C, 18, 13, 13, 2, 3),
-    Glyph::new(0x003D, 0x0372, 18, 13, 9, 2, 5),
-    Glyph::new(0x003E, 0x0381, 18, 13, 13, 2, 3),
-    Glyph::new(0x003F, 0x0397, 14, 12, 22, 1, -1),
-    Glyph::new(0x0040, 0x03B8, 28, 26, 26, 1, -6),
-    Glyph::new(0x0041, 0x040D, 22, 22, 20, 0, 0),
-    Glyph::new(0x0042, 0x0444, 19, 18, 21, 0, -1),
-    Glyph::new(0x0043, 0x0474, 19, 17, 21, 1, -1),
-    Glyph::new(0x0044, 0x04A1, 22, 21, 21, 0, -1),
-    Glyph::new(0x0045, 0x04D9, 19, 18, 20, 0, 0),
-    Glyph::new(0x0046, 0x0506, 17, 16, 20, 0, 0),
-    Glyph::new(0x0047, 0x052E, 21, 19, 21, 1, -1),
-    Glyph::new(0x0048, 0x0560, 25, 24, 20, 0, 0),
-    Glyph::new(0x0049, 0x059C, 12, 11, 20, 0, 0),
-    Glyph::new(0x004A, 0x05B8, 12, 13, 26, -2, -6),
-    Glyph::new(0x004B, 0x05E3, 22, 22, 21, 0, -1),
-    Glyph::new(0x004C, 0x061D, 18, 18, 20, 0, 0),
-    Glyph::new(0x004D, 0x064A, 27, 26, 20, 0, 0),
-    Glyph::new(0x004E, 0x068B, 23, 23, 21, 0, -1),
-    Glyph::new(0x004F, 0x06C8, 22, 20, 21, 1, -1),
-    Glyph::new(0x0050, 0x06FD, 18, 17, 20, 0, 0),
-    Glyph::new(0x0051, 0x0728, 22, 22, 27, 1, -7),
-    Glyph::new(0x0052, 0x0773, 20, 21, 21, 0, -1),
-    Glyph::new(0x0053, 0x07AB, 17, 15, 21, 1, -1),
-    Glyph::new(0x0054, 0x07D3, 21, 20, 20, 0, 0),
-    Glyph::new(0x0055, 0x0805, 23, 23, 21, 0, -1),
-    Glyph::new(0x0056, 0x0842, 22, 22, 21, 0, -1),
-    Glyph::new(0x0057, 0x087C, 32, 31, 21, 0, -1),
-    Glyph::new(0x0058, 0x08CE, 22, 22, 20, 0, 0),
-    Glyph::new(0x0059, 0x0905, 21, 20, 20, 0, 0),
-    Glyph::new(0x005A, 0x0937, 18, 17, 21, 0, -1),
-    Glyph::new(0x005B, 0x0964, 10, 8, 27, 1, -5),
-    Glyph::new(0x005C, 0x097F, 15, 14, 23, 0, -2),
-    Glyph::new(0x005D, 0x09A8, 10, 7, 27, 1, -5),
-    Glyph::new(0x005E, 0x09C0, 18, 15, 13, 1, 5),
-    Glyph::new(0x005F, 0x09D9, 14, 14, 4, 0, -5),
-    Glyph::new(0x0060, 0x09E0, 19, 7, 8, 6, 16),
-    Glyph::new(0x0061, 0x09E7, 16, 15, 17, 1, -1),
-    Glyph::new(0x0062, 0x0A07, 18, 18, 23, -1, -1),
-    Glyph::new(0x0063, 0x0A3B, 15, 13, 17, 1, -1),
-    Glyph::new(0x0064, 0x0A57, 18, 17, 23, 1, -1),
-    Glyph::new(0x0065, 0x0A88, 16, 14, 17, 1, -1),
-    Glyph::new(0x0066, 0x0AA6, 13, 15, 22, 0, 0),
-    Glyph::new(0x0067, 0x0AD0, 17, 17, 23, 0, -7),
-    Glyph::new(0x0068, 0x0B01, 19, 19, 22, 0, 0),
-    Glyph::new(0x0069, 0x0B36, 10, 10, 22, 0, 0),
-    Glyph::new(0x006A, 0x0B52, 9, 10, 29, -2, -7),
-    Glyph::new(0x006B, 0x0B77, 18, 18, 23, 0, -1),
-    Glyph::new(0x006C, 0x0BAB, 10, 10, 22, 0, 0),
-    Glyph::new(0x006D, 0x0BC7, 28, 28, 16, 0, 0),
-    Glyph::new(0x006E, 0x0BFF, 19, 19, 16, 0, 0),
-    Glyph::new(0x006F, 0x0C25, 17, 15, 17, 1, -1),
-    Glyph::new(0x0070, 0x0C45, 18, 17, 23, 0, -7),
-    Glyph::new(0x0071, 0x0C76, 17, 16, 23, 1, -7),
-    Glyph::new(0x0072, 0x0CA4, 14, 13, 16, 0, 0),
-    Glyph::new(0x0073, 0x0CBE, 15, 13, 17, 1, -1),
-    Glyph::new(0x0074, 0x0CDA, 12, 13, 20, -1, -1),
-    Glyph::new(0x0075, 0x0CFB, 19, 19, 16, 0, -1),
-    Glyph::new(0x0076, 0x0D21, 19, 19, 16, 0, -1),
-    Glyph::new(0x0077, 0x0D47, 26, 25, 16, 0, -1),
-    Glyph::new(0x0078, 0x0D79, 18, 18, 15, 0, 0),
-    Glyph::new(0x0079, 0x0D9B, 19, 19, 22, 0, -7),
-    Glyph::new(0x007A, 0x0DD0, 15, 14, 16, 0, -1),
-    Glyph::new(0x007B, 0x0DEC, 12, 10, 28, 1, -5),
-    Glyph::new(0x007C, 0x0E0F, 9, 5, 26, 2, -4),
-    Glyph::new(0x007D, 0x0E20, 12, 10, 28, 0, -5),
-    Glyph::new(0x007E, 0x0E43, 18, 14, 6, 2, 6),
-    Glyph::new(0x00A1, 0x0E4E, 9, 6, 23, 1, -7),
-    Glyph::new(0x00A2, 0x0E60, 18, 15, 28, 1, -6),
-    Glyph::new(0x00A3, 0x0E95, 18, 17, 21, 0, -1),
-    Glyph::new(0x00A4, 0x0EC2, 18, 16, 15, 1, 2),
-    Glyph::new(0x00A5, 0x0EE0, 18, 19, 20, -1, 0),
-    Glyph::new(0x00A7, 0x0F10, 15, 13, 23, 1, -3),
-    Glyph::new(0x00A9, 0x0F36, 22, 22, 21, 0, -1),
-    Glyph::new(0x00AA, 0x0F70, 13, 11, 14, 1, 6),
-    Glyph::new(0x00AB, 0x0F84, 17, 16, 12, 0, 1),
-    Glyph::new(0x00AE, 0x0F9C, 17, 16, 15, 0, 7),
-    Glyph::new(0x00B0, 0x0FBA, 15, 11, 11, 2, 9),
-    Glyph::new(0x00B1, 0x0FCA, 18, 13, 18, 2, -1),
-    Glyph::new(0x00B2, 0x0FE8, 13, 11, 14, 1, 10),
-    Glyph::new(0x00B3, 0x0FFC, 13, 10, 14, 1, 10),
-    Glyph::new(0x00B5, 0x100E, 19, 18, 23, 1, -7),
-    Glyph::new(0x00B6, 0x1042, 17, 16, 24, 0, -4),
-    Glyph::new(0x00B7, 0x1072, 9, 6, 5, 1, 5),
-    Glyph::new(0x00B9, 0x1076, 13, 10, 14, 1, 10),
-    Glyph::new(0x00BA, 0x1088, 13, 11, 14, 1, 6),
-    Glyph::new(0x00BB, 0x109C, 17, 15, 12, 1, 1),
-    Glyph::new(0x00BC, 0x10B3, 31, 29, 23, 1, -2),
-    Glyph::new(0x00BD, 0x1107, 31, 29, 23, 1, -2),
-    Glyph::new(0x00BE, 0x115B, 31, 29, 23, 1, -2),
-    Glyph::new(0x00BF, 0x11AF, 14, 11, 22, 1, -6),
-    Glyph::new(0x00C0, 0x11CE, 22, 22, 28, 0, 0),
-    Glyph::new(0x00C1, 0x121B, 22, 22, 28, 0, 0),
-    Glyph::new(0x00C2, 0x1268, 22, 22, 28, 0, 0),
-    Glyph::new(0x00C3, 0x12B5, 22, 22, 27, 0, 0),
-    Glyph::new(0x00C4, 0x1300, 22, 22, 26, 0, 0),
-    Glyph::new(0x00C5, 0x1348, 22, 22, 28, 0, 0),
-    Glyph::new(0x00C6, 0x1395, 28, 28, 20, -1, 0),
-    Glyph::new(0x00C7, 0x13DB, 19, 17, 28, 1, -8),
-    Glyph::new(0x00C8, 0x1417, 19, 18, 28, 0, 0),
-    Glyph::new(0x00C9, 0x1456, 19, 18, 28, 0, 0),
-    Glyph::new(0x00CA, 0x1495, 19, 18, 28, 0, 0),
-    Glyph::new(0x00CB, 0x14D4, 19, 18, 26, 0, 0),
-    Glyph::new(0x00CC, 0x150F, 12, 11, 28, 0, 0),
-    Glyph::new(0x00CD, 0x1536, 12, 11, 28, 0, 0),
-    Glyph::new(0x00CE, 0x155D, 12, 11, 28, 0, 0),
-    Glyph::new(0x00CF, 0x1584, 12, 12, 26, 0, 0),
-    Glyph::new(0x00D0, 0x15AB, 22, 21, 21, 0, -1),
-    Glyph::new(0x00D1, 0x15E3, 23, 23, 28, 0, -1),
-    Glyph::new(0x00D2, 0x1634, 22, 20, 29, 1, -1),
-    Glyph::new(0x00D3, 0x167D, 22, 20, 29, 1, -1),
-    Glyph::new(0x00D4, 0x16C6, 22, 20, 29, 1, -1),
-    Glyph::new(0x00D5, 0x170F, 22, 20, 28, 1, -1),
-    Glyph::new(0x00D6, 0x1755, 22, 20, 27, 1, -1),
-    Glyph::new(0x00D7, 0x1799, 18, 13, 13, 2, 3),
-    Glyph::new(0x00D8, 0x17AF, 22, 22, 22, 0, -1),
-    Glyph::new(0x00D9, 0x17EC, 23, 23, 29, 0, -1),
-    Glyph::new(0x00DA, 0x1840, 23, 23, 29, 0, -1),
-    Glyph::new(0x00DB, 0x1894, 23, 23, 29, 0, -1),
-    Glyph::new(0x00DC, 0x18E8, 23, 23, 27, 0, -1),
-    Glyph::new(0x00DE, 0x1936, 19, 18, 20, 0, 0),
-    Glyph::new(0x00DF, 0x1963, 19, 18, 23, 0, -1),
-    Glyph::new(0x00E0, 0x1997, 16, 15, 25, 1, -1),
-    Glyph::new(0x00E1, 0x19C6, 16, 15, 25, 1, -1),
-    Glyph::new(0x00E2, 0x19F5, 16, 15, 24, 1, -1),
-    Glyph::new(0x00E3, 0x1A22, 16, 15, 24, 1, -1),
-    Glyph::new(0x00E4, 0x1A4F, 16, 15, 23, 1, -1),
-    Glyph::new(0x00E5, 0x1A7B, 16, 15, 25, 1, -1),
-    Glyph::new(0x00E6, 0x1AAA, 24, 22, 17, 1, -1),
-    Glyph::new(0x00E7, 0x1AD9, 15, 13, 24, 1, -8),
-    Glyph::new(0x00E8, 0x1B00, 16, 14, 25, 1, -1),
-    Glyph::new(0x00E9, 0x1B2C, 16, 14, 25, 1, -1),
-    Glyph::new(0x00EA, 0x1B58, 16, 14, 24, 1, -1),
-    Glyph::new(0x00EB, 0x1B82, 16, 14, 23, 1, -1),
-    Glyph::new(0x00EC, 0x1BAB, 10, 10, 24, 0, 0),
-    Glyph::new(0x00ED, 0x1BC9, 10, 10, 24, 0, 0),
-    Glyph::new(0x00EE, 0x1BE7, 10, 10, 23, 0, 0),
-    Glyph::new(0x00EF, 0x1C04, 10, 11, 22, 0, 0),
-    Glyph::new(0x00F0, 0x1C23, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F1, 0x1C50, 19, 19, 23, 0, 0),
-    Glyph::new(0x00F2, 0x1C87, 17, 15, 25, 1, -1),
-    Glyph::new(0x00F3, 0x1CB6, 17, 15, 25, 1, -1),
-    Glyph::new(0x00F4, 0x1CE5, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F5, 0x1D12, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F6, 0x1D3F, 17, 15, 23, 1, -1),
-    Glyph::new(0x00F7, 0x1D6B, 18, 13, 14, 2, 2),
-    Glyph::new(0x00F8, 0x1D82, 17, 17, 17, 0, -1),
-    Glyph::new(0x00F9, 0x1DA7, 19, 19, 25, 0, -1),
-    Glyph::new(0x00FA, 0x1DE3, 19, 19, 25, 0, -1),
-    Glyph::new(0x00FB, 0x1E1F, 19, 19, 24, 0, -1),
-    Glyph::new(0x00FC, 0x1E58, 19, 19, 23, 0, -1),
-    Glyph::new(0x00FE, 0x1E8F, 18, 17, 29, 0, -7),
-    Glyph::new(0x00FF, 0x1ECD, 19, 19, 29, 0, -7),
-    Glyph::new(0x0104, 0x1F12, 22, 22, 27, 0, -7),
-    Glyph::new(0x0105, 0x1F5D, 16, 15, 22, 1, -6),
-    Glyph::new(0x0106, 0x1F87, 19, 17, 29, 1, -1),
-    Glyph::new(0x0107, 0x1FC5, 15, 13, 25, 1, -1),
-    Glyph::new(0x010C, 0x1FEE, 19, 17, 29, 1, -1),
-    Glyph::new(0x010D, 0x202C, 15, 13, 24, 1, -1),
-    Glyph::new(0x010E, 0x2053, 22, 21, 29, 0, -1),
-    Glyph::new(0x010F, 0x20A0, 19, 20, 23, 1, -1),
-    Glyph::new(0x0118, 0x20DA, 19, 18, 27, 0, -7),
-    Glyph::new(0x0119, 0x2117, 16, 14, 22, 1, -6),
-    Glyph::new(0x011A, 0x213E, 19, 18, 28, 0, 0),
-    Glyph::new(0x011B, 0x217D, 16, 14, 24, 1, -1),
-    Glyph::new(0x0139, 0x21A7, 18, 18, 28, 0, 0),
-    Glyph::new(0x013A, 0x21E6, 10, 10, 29, 0, 0),
-    Glyph::new(0x013D, 0x220B, 18, 18, 22, 0, 0),
-    Glyph::new(0x013E, 0x223D, 11, 13, 22, 0, 0),
-    Glyph::new(0x0141, 0x2261, 18, 19, 20, -1, 0),
-    Glyph::new(0x0142, 0x2291, 10, 11, 22, -1, 0),
-    Glyph::new(0x0143, 0x22B0, 23, 23, 29, 0, -1),
-    Glyph::new(0x0144, 0x2304, 19, 19, 24, 0, 0),
-    Glyph::new(0x0147, 0x233D, 23, 23, 29, 0, -1),
-    Glyph::new(0x0148, 0x2391, 19, 19, 23, 0, 0),
-    Glyph::new(0x0152, 0x23C8, 29, 27, 21, 1, -1),
-    Glyph::new(0x0153, 0x240F, 26, 24, 17, 1, -1),
-    Glyph::new(0x0158, 0x2442, 20, 21, 29, 0, -1),
-    Glyph::new(0x0159, 0x248F, 14, 13, 23, 0, 0),
-    Glyph::new(0x015A, 0x24B5, 17, 15, 29, 1, -1),
-    Glyph::new(0x015B, 0x24EC, 15, 13, 25, 1, -1),
-    Glyph::new(0x0160, 0x2515, 17, 15, 29, 1, -1),
-    Glyph::new(0x0161, 0x254C, 15, 13, 24, 1, -1),
-    Glyph::new(0x0164, 0x2573, 21, 20, 28, 0, 0),
-    Glyph::new(0x0165, 0x25B9, 12, 13, 24, -1, -1),
-    Glyph::new(0x016E, 0x25E0, 23, 23, 29, 0, -1),
-    Glyph::new(0x016F, 0x2634, 19, 19, 25, 0, -1),
-    Glyph::new(0x0170, 0x2670, 23, 23, 29, 0, -1),
-    Glyph::new(0x0171, 0x26C4, 19, 19, 25, 0, -1),
-    Glyph::new(0x0178, 0x2700, 21, 20, 26, 0, 0),
-    Glyph::new(0x0179, 0x2741, 18, 17, 29, 0, -1),
-    Glyph::new(0x017A, 0x277F, 15, 14, 25, 0, -1),
-    Glyph::new(0x017B, 0x27AB, 18, 17, 28, 0, -1),
-    Glyph::new(0x017C, 0x27E7, 15, 14, 23, 0, -1),
-    Glyph::new(0x017D, 0x2810, 18, 17, 29, 0, -1),
-    Glyph::new(0x017E, 0x284E, 15, 14, 24, 0, -1),
-    Glyph::new(0x03C0, 0x2878, 20, 19, 17, 0, -1),
-    Glyph::new(0x1E9E, 0x28A1, 22, 21, 21, 0, -1),
-    Glyph::new(0x2013, 0x28D9, 14, 14, 4, 0, 5),
-    Glyph::new(0x2014, 0x28E0, 28, 28, 4, 0, 5),
-    Glyph::new(0x2018, 0x28EE, 7, 6, 9, 1, 12),
-    Glyph::new(0x2019, 0x28F5, 7, 6, 9, 0, 12),
-    Glyph::new(0x201A, 0x28FC, 7, 6, 10, 0, -6),
-    Glyph::new(0x201B, 0x2904, 7, 6, 9, 1, 12),
-    Glyph::new(0x201C, 0x290B, 13, 11, 9, 1, 12),
-    Glyph::new(0x201D, 0x2918, 13, 12, 9, 0, 12),
-    Glyph::new(0x201E, 0x2926, 13, 12, 10, 0, -6),
-    Glyph::new(0x201F, 0x2935, 13, 11, 9, 1, 12),
-    Glyph::new(0x2020, 0x2942, 14, 14, 19, 0, 1),
-    Glyph::new(0x2021, 0x2964, 14, 14, 22, 0, -2),
-    Glyph::new(0x2022, 0x298B, 9, 7, 7, 1, 4),
-    Glyph::new(0x2026, 0x2992, 28, 24, 5, 2, -1),
-    Glyph::new(0x2039, 0x29A1, 10, 9, 12, 0, 1),
-    Glyph::new(0x203A, 0x29AF, 10, 8, 12, 1, 1),
-    Glyph::new(0x2070, 0x29BB, 13, 12, 14, 0, 10),
-    Glyph::new(0x2074, 0x29D0, 13, 12, 14, 0, 10),
-    Glyph::new(0x2075, 0x29E5, 13, 10, 13, 1, 10),
-    Glyph::new(0x2076, 0x29F6, 13, 11, 14, 1, 10),
-    Glyph::new(0x2077, 0x2A0A, 13, 11, 13, 1, 10),
-    Glyph::new(0x2078, 0x2A1C, 13, 11, 14, 1, 10),
-    Glyph::new(0x2079, 0x2A30, 13, 11, 14, 1, 10),
-    Glyph::new(0x2080, 0x2A44, 13, 12, 14, 0, -5),
-    Glyph::new(0x2081, 0x2A59, 13, 10, 14, 1, -4),
-    Glyph::new(0x2082, 0x2A6B, 13, 11, 13, 1, -4),
-    Glyph::new(0x2083, 0x2A7D, 13, 10, 14, 1, -5),
-    Glyph::new(0x2084, 0x2A8F, 13, 12, 14, 0, -5),
-    Glyph::new(0x2085, 0x2AA4, 13, 10, 14, 1, -5),
-    Glyph::new(0x2086, 0x2AB6, 13, 11, 14, 1, -5),
-    Glyph::new(0x2087, 0x2ACA, 13, 11, 14, 1, -5),
-    Glyph::new(0x2088, 0x2ADE, 13, 11, 14, 1, -5),
-    Glyph::new(0x2089, 0x2AF2, 13, 11, 14, 1, -5),
-    Glyph::new(0x20AC, 0x2B06, 18, 18, 21, 0, -1),
-    Glyph::new(0x2122, 0x2B36, 25, 24, 10, 0, 10),
-    Glyph::new(0x2153, 0x2B54, 31, 28, 23, 1, -2),
-    Glyph::new(0x2154, 0x2BA5, 31, 28, 23, 1, -2),
-    Glyph::new(0x215B, 0x2BF6, 31, 28, 23, 1, -2),
-    Glyph::new(0x215C, 0x2C47, 31, 28, 23, 1, -2),
-    Glyph::new(0x215D, 0x2C98, 31, 28, 23, 1, -2),
-    Glyph::new(0x215E, 0x2CE9, 31, 28, 23, 1, -2),
-    Glyph::new(0x2190, 0x2D3A, 28, 18, 13, 5, 3),
-    Glyph::new(0x2191, 0x2D58, 28, 14, 19, 7, 0),
-    Glyph::new(0x2192, 0x2D7A, 28, 18, 13, 5, 3),
-    Glyph::new(0x2193, 0x2D98, 28, 14, 19, 7, 0),
-    Glyph::new(0x2194, 0x2DBA, 28, 18, 13, 5, 3),
-    Glyph::new(0x2195, 0x2DD8, 28, 12, 19, 8, 0),
-    Glyph::new(0x21D0, 0x2DF5, 28, 18, 16, 5, 2),
-    Glyph::new(0x21D1, 0x2E19, 28, 16, 18, 6, 1),
-    Glyph::new(0x21D2, 0x2E3D, 28, 18, 16, 5, 2),
-    Glyph::new(0x21D3, 0x2E61, 28, 16, 18, 6, 1),
-    Glyph::new(0x21D4, 0x2E85, 28, 18, 15, 5, 2),
-    Glyph::new(0x2202, 0x2EA7, 18, 15, 23, 1, -1),
-    Glyph::new(0x2206, 0x2ED3, 20, 19, 20, 0, 0),
-    Glyph::new(0x220F, 0x2F03, 24, 23, 25, 0, -5),
-    Glyph::new(0x2211, 0x2F4B, 19, 18, 25, 0, -5),
-    Glyph::new(0x221A, 0x2F84, 18, 19, 27, -1, -4),
-    Glyph::new(0x221E, 0x2FC5, 18, 18, 11, 0, 3),
-    Glyph::new(0x222B, 0x2FDE, 18, 16, 29, 1, -7),
-    Glyph::new(0x2260, 0x3018, 18, 13, 15, 2, 2),
-    Glyph::new(0x2264, 0x3031, 18, 13, 17, 2, 0),
-    Glyph::new(0x2265, 0x304D, 18, 13, 18, 2, 0),
+    Glyph::new(0x0022, 0x0023, 12, 10, 11, 1, 10),
+    Glyph::new(0x0023, 0x0041, 18, 18, 18, 0, -2),
+    Glyph::new(0x0024, 0x0080, 18, 14, 29, 2, -6),
+    Glyph::new(0x0025, 0x00D2, 28, 25, 23, 1, -2),
+    Glyph::new(0x0026, 0x0148, 23, 23, 22, 0, -1),
+    Glyph::new(0x0027, 0x01A0, 7, 5, 11, 1, 10),
+    Glyph::new(0x0028, 0x01B0, 11, 9, 28, 1, -5),
+    Glyph::new(0x0029, 0x01E6, 11, 10, 28, 0, -5),
+    Glyph::new(0x002A, 0x021D, 11, 11, 10, 0, 11),
+    Glyph::new(0x002B, 0x0237, 18, 13, 13, 2, 3),
+    Glyph::new(0x002C, 0x0253, 9, 7, 10, 0, -6),
+    Glyph::new(0x002D, 0x0263, 11, 10, 4, 0, 5),
+    Glyph::new(0x002E, 0x0270, 9, 6, 5, 1, -1),
+    Glyph::new(0x002F, 0x0279, 15, 14, 23, 0, -2),
+    Glyph::new(0x0030, 0x02A9, 18, 17, 21, 0, -1),
+    Glyph::new(0x0031, 0x02EC, 18, 13, 20, 2, 0),
+    Glyph::new(0x0032, 0x0312, 18, 15, 20, 1, 0),
+    Glyph::new(0x0033, 0x0349, 18, 15, 21, 1, -1),
+    Glyph::new(0x0034, 0x0382, 18, 17, 21, 0, -1),
+    Glyph::new(0x0035, 0x03BE, 18, 14, 21, 1, -1),
+    Glyph::new(0x0036, 0x03F0, 18, 15, 21, 1, -1),
+    Glyph::new(0x0037, 0x042C, 18, 15, 21, 1, -1),
+    Glyph::new(0x0038, 0x045E, 18, 15, 21, 1, -1),
+    Glyph::new(0x0039, 0x04A1, 18, 15, 21, 1, -1),
+    Glyph::new(0x003A, 0x04DF, 9, 6, 16, 1, -1),
+    Glyph::new(0x003B, 0x04F2, 9, 7, 21, 0, -6),
+    Glyph::new(0x003C, 0x050E, 18, 13, 13, 2, 3),
+    Glyph::new(0x003D, 0x052F, 18, 13, 9, 2, 5),
+    Glyph::new(0x003E, 0x0550, 18, 13, 13, 2, 3),
+    Glyph::new(0x003F, 0x056E, 14, 12, 22, 1, -1),
+    Glyph::new(0x0040, 0x059F, 28, 26, 26, 1, -6),
+    Glyph::new(0x0041, 0x0623, 22, 22, 20, 0, 0),
+    Glyph::new(0x0042, 0x0664, 19, 18, 21, 0, -1),
+    Glyph::new(0x0043, 0x06AE, 19, 17, 21, 1, -1),
+    Glyph::new(0x0044, 0x06E8, 22, 21, 21, 0, -1),
+    Glyph::new(0x0045, 0x0733, 19, 18, 20, 0, 0),
+    Glyph::new(0x0046, 0x0775, 17, 16, 20, 0, 0),
+    Glyph::new(0x0047, 0x07B1, 21, 19, 21, 1, -1),
+    Glyph::new(0x0048, 0x07FA, 25, 24, 20, 0, 0),
+    Glyph::new(0x0049, 0x084D, 12, 11, 20, 0, 0),
+    Glyph::new(0x004A, 0x0874, 12, 13, 26, -2, -6),
+    Glyph::new(0x004B, 0x08A6, 22, 22, 21, 0, -1),
+    Glyph::new(0x004C, 0x08FD, 18, 18, 20, 0, 0),
+    Glyph::new(0x004D, 0x0931, 27, 26, 20, 0, 0),
+    Glyph::new(0x004E, 0x09A0, 23, 23, 21, 0, -1),
+    Glyph::new(0x004F, 0x09FC, 22, 20, 21, 1, -1),
+    Glyph::new(0x0050, 0x0A43, 18, 17, 20, 0, 0),
+    Glyph::new(0x0051, 0x0A7C, 22, 22, 27, 1, -7),
+    Glyph::new(0x0052, 0x0AD8, 20, 21, 21, 0, -1),
+    Glyph::new(0x0053, 0x0B27, 17, 15, 21, 1, -1),
+    Glyph::new(0x0054, 0x0B67, 21, 20, 20, 0, 0),
+    Glyph::new(0x0055, 0x0BA3, 23, 23, 21, 0, -1),
+    Glyph::new(0x0056, 0x0BFB, 22, 22, 21, 0, -1),
+    Glyph::new(0x0057, 0x0C43, 32, 31, 21, 0, -1),
+    Glyph::new(0x0058, 0x0CB3, 22, 22, 20, 0, 0),
+    Glyph::new(0x0059, 0x0D05, 21, 20, 20, 0, 0),
+    Glyph::new(0x005A, 0x0D48, 18, 17, 21, 0, -1),
+    Glyph::new(0x005B, 0x0D8C, 10, 8, 27, 1, -5),
+    Glyph::new(0x005C, 0x0DC3, 15, 14, 23, 0, -2),
+    Glyph::new(0x005D, 0x0DF1, 10, 7, 27, 1, -5),
+    Glyph::new(0x005E, 0x0E1F, 18, 15, 13, 1, 5),
+    Glyph::new(0x005F, 0x0E45, 14, 14, 4, 0, -5),
+    Glyph::new(0x0060, 0x0E4F, 19, 7, 8, 6, 16),
+    Glyph::new(0x0061, 0x0E5B, 16, 15, 17, 1, -1),
+    Glyph::new(0x0062, 0x0E8F, 18, 18, 23, -1, -1),
+    Glyph::new(0x0063, 0x0EDC, 15, 13, 17, 1, -1),
+    Glyph::new(0x0064, 0x0F05, 18, 17, 23, 1, -1),
+    Glyph::new(0x0065, 0x0F45, 16, 14, 17, 1, -1),
+    Glyph::new(0x0066, 0x0F74, 13, 15, 22, 0, 0),
+    Glyph::new(0x0067, 0x0FAB, 17, 17, 23, 0, -7),
+    Glyph::new(0x0068, 0x0FF7, 19, 19, 22, 0, 0),
+    Glyph::new(0x0069, 0x103E, 10, 10, 22, 0, 0),
+    Glyph::new(0x006A, 0x1069, 9, 10, 29, -2, -7),
+    Glyph::new(0x006B, 0x10A1, 18, 18, 23, 0, -1),
+    Glyph::new(0x006C, 0x10E7, 10, 10, 22, 0, 0),
+    Glyph::new(0x006D, 0x1113, 28, 28, 16, 0, 0),
+    Glyph::new(0x006E, 0x1165, 19, 19, 16, 0, 0),
+    Glyph::new(0x006F, 0x119F, 17, 15, 17, 1, -1),
+    Glyph::new(0x0070, 0x11CF, 18, 17, 23, 0, -7),
+    Glyph::new(0x0071, 0x1215, 17, 16, 23, 1, -7),
+    Glyph::new(0x0072, 0x1255, 14, 13, 16, 0, 0),
+    Glyph::new(0x0073, 0x1276, 15, 13, 17, 1, -1),
+    Glyph::new(0x0074, 0x12A3, 12, 13, 20, -1, -1),
+    Glyph::new(0x0075, 0x12CF, 19, 19, 16, 0, -1),
+    Glyph::new(0x0076, 0x1314, 19, 19, 16, 0, -1),
+    Glyph::new(0x0077, 0x1349, 26, 25, 16, 0, -1),
+    Glyph::new(0x0078, 0x13A0, 18, 18, 15, 0, 0),
+    Glyph::new(0x0079, 0x13D9, 19, 19, 22, 0, -7),
+    Glyph::new(0x007A, 0x141F, 15, 14, 16, 0, -1),
+    Glyph::new(0x007B, 0x144E, 12, 10, 28, 1, -5),
+    Glyph::new(0x007C, 0x1482, 9, 5, 26, 2, -4),
+    Glyph::new(0x007D, 0x14AB, 12, 10, 28, 0, -5),
+    Glyph::new(0x007E, 0x14E0, 18, 14, 6, 2, 6),
+    Glyph::new(0x00A1, 0x14F2, 9, 6, 23, 1, -7),
+    Glyph::new(0x00A2, 0x1513, 18, 15, 28, 1, -6),
+    Glyph::new(0x00A3, 0x1561, 18, 17, 21, 0, -1),
+    Glyph::new(0x00A4, 0x159F, 18, 16, 15, 1, 2),
+    Glyph::new(0x00A5, 0x15CF, 18, 19, 20, -1, 0),
+    Glyph::new(0x00A7, 0x1611, 15, 13, 23, 1, -3),
+    Glyph::new(0x00A9, 0x1655, 22, 22, 21, 0, -1),
+    Glyph::new(0x00AA, 0x16BE, 13, 11, 14, 1, 6),
+    Glyph::new(0x00AB, 0x16EA, 17, 16, 12, 0, 1),
+    Glyph::new(0x00AE, 0x170F, 17, 16, 15, 0, 7),
+    Glyph::new(0x00B0, 0x175E, 15, 11, 11, 2, 9),
+    Glyph::new(0x00B1, 0x177E, 18, 13, 18, 2, -1),
+    Glyph::new(0x00B2, 0x17A8, 13, 11, 14, 1, 10),
+    Glyph::new(0x00B3, 0x17CE, 13, 10, 14, 1, 10),
+    Glyph::new(0x00B5, 0x17EC, 19, 18, 23, 1, -7),
+    Glyph::new(0x00B6, 0x1834, 17, 16, 24, 0, -4),
+    Glyph::new(0x00B7, 0x1889, 9, 6, 5, 1, 5),
+    Glyph::new(0x00B9, 0x1892, 13, 10, 14, 1, 10),
+    Glyph::new(0x00BA, 0x18AF, 13, 11, 14, 1, 6),
+    Glyph::new(0x00BB, 0x18D7, 17, 15, 12, 1, 1),
+    Glyph::new(0x00BC, 0x18FF, 31, 29, 23, 1, -2),
+    Glyph::new(0x00BD, 0x1976, 31, 29, 23, 1, -2),
+    Glyph::new(0x00BE, 0x19E2, 31, 29, 23, 1, -2),
+    Glyph::new(0x00BF, 0x1A59, 14, 11, 22, 1, -6),
+    Glyph::new(0x00C0, 0x1A86, 22, 22, 28, 0, 0),
+    Glyph::new(0x00C1, 0x1AD9, 22, 22, 28, 0, 0),
+    Glyph::new(0x00C2, 0x1B2B, 22, 22, 28, 0, 0),
+    Glyph::new(0x00C3, 0x1B84, 22, 22, 27, 0, 0),
+    Glyph::new(0x00C4, 0x1BD7, 22, 22, 26, 0, 0),
+    Glyph::new(0x00C5, 0x1C2A, 22, 22, 28, 0, 0),
+    Glyph::new(0x00C6, 0x1C82, 28, 28, 20, -1, 0),
+    Glyph::new(0x00C7, 0x1CE8, 19, 17, 28, 1, -8),
+    Glyph::new(0x00C8, 0x1D2F, 19, 18, 28, 0, 0),
+    Glyph::new(0x00C9, 0x1D80, 19, 18, 28, 0, 0),
+    Glyph::new(0x00CA, 0x1DD2, 19, 18, 28, 0, 0),
+    Glyph::new(0x00CB, 0x1E26, 19, 18, 26, 0, 0),
+    Glyph::new(0x00CC, 0x1E79, 12, 11, 28, 0, 0),
+    Glyph::new(0x00CD, 0x1EAD, 12, 11, 28, 0, 0),
+    Glyph::new(0x00CE, 0x1EE1, 12, 11, 28, 0, 0),
+    Glyph::new(0x00CF, 0x1F18, 12, 12, 26, 0, 0),
+    Glyph::new(0x00D0, 0x1F55, 22, 21, 21, 0, -1),
+    Glyph::new(0x00D1, 0x1FA6, 23, 23, 28, 0, -1),
+    Glyph::new(0x00D2, 0x2017, 22, 20, 29, 1, -1),
+    Glyph::new(0x00D3, 0x206E, 22, 20, 29, 1, -1),
+    Glyph::new(0x00D4, 0x20C5, 22, 20, 29, 1, -1),
+    Glyph::new(0x00D5, 0x211F, 22, 20, 28, 1, -1),
+    Glyph::new(0x00D6, 0x217B, 22, 20, 27, 1, -1),
+    Glyph::new(0x00D7, 0x21D4, 18, 13, 13, 2, 3),
+    Glyph::new(0x00D8, 0x21FA, 22, 22, 22, 0, -1),
+    Glyph::new(0x00D9, 0x225A, 23, 23, 29, 0, -1),
+    Glyph::new(0x00DA, 0x22C4, 23, 23, 29, 0, -1),
+    Glyph::new(0x00DB, 0x232D, 23, 23, 29, 0, -1),
+    Glyph::new(0x00DC, 0x239B, 23, 23, 27, 0, -1),
+    Glyph::new(0x00DE, 0x2404, 19, 18, 20, 0, 0),
+    Glyph::new(0x00DF, 0x2440, 19, 18, 23, 0, -1),
+    Glyph::new(0x00E0, 0x249B, 16, 15, 25, 1, -1),
+    Glyph::new(0x00E1, 0x24DC, 16, 15, 25, 1, -1),
+    Glyph::new(0x00E2, 0x251D, 16, 15, 24, 1, -1),
+    Glyph::new(0x00E3, 0x2561, 16, 15, 24, 1, -1),
+    Glyph::new(0x00E4, 0x25A6, 16, 15, 23, 1, -1),
+    Glyph::new(0x00E5, 0x25EE, 16, 15, 25, 1, -1),
+    Glyph::new(0x00E6, 0x2638, 24, 22, 17, 1, -1),
+    Glyph::new(0x00E7, 0x267E, 15, 13, 24, 1, -8),
+    Glyph::new(0x00E8, 0x26B6, 16, 14, 25, 1, -1),
+    Glyph::new(0x00E9, 0x26F4, 16, 14, 25, 1, -1),
+    Glyph::new(0x00EA, 0x2732, 16, 14, 24, 1, -1),
+    Glyph::new(0x00EB, 0x2773, 16, 14, 23, 1, -1),
+    Glyph::new(0x00EC, 0x27B1, 10, 10, 24, 0, 0),
+    Glyph::new(0x00ED, 0x27DD, 10, 10, 24, 0, 0),
+    Glyph::new(0x00EE, 0x280A, 10, 10, 23, 0, 0),
+    Glyph::new(0x00EF, 0x283A, 10, 11, 22, 0, 0),
+    Glyph::new(0x00F0, 0x2865, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F1, 0x28AE, 19, 19, 23, 0, 0),
+    Glyph::new(0x00F2, 0x28FD, 17, 15, 25, 1, -1),
+    Glyph::new(0x00F3, 0x293B, 17, 15, 25, 1, -1),
+    Glyph::new(0x00F4, 0x2979, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F5, 0x29B9, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F6, 0x29F8, 17, 15, 23, 1, -1),
+    Glyph::new(0x00F7, 0x2A3B, 18, 13, 14, 2, 2),
+    Glyph::new(0x00F8, 0x2A5D, 17, 17, 17, 0, -1),
+    Glyph::new(0x00F9, 0x2A99, 19, 19, 25, 0, -1),
+    Glyph::new(0x00FA, 0x2AEE, 19, 19, 25, 0, -1),
+    Glyph::new(0x00FB, 0x2B44, 19, 19, 24, 0, -1),
+    Glyph::new(0x00FC, 0x2B9D, 19, 19, 23, 0, -1),
+    Glyph::new(0x00FE, 0x2BF4, 18, 17, 29, 0, -7),
+    Glyph::new(0x00FF, 0x2C45, 19, 19, 29, 0, -7),
+    Glyph::new(0x0104, 0x2CA0, 22, 22, 27, 0, -7),
+    Glyph::new(0x0105, 0x2CF3, 16, 15, 22, 1, -6),
+    Glyph::new(0x0106, 0x2D33, 19, 17, 29, 1, -1),
+    Glyph::new(0x0107, 0x2D7D, 15, 13, 25, 1, -1),
+    Glyph::new(0x010C, 0x2DB4, 19, 17, 29, 1, -1),
+    Glyph::new(0x010D, 0x2E02, 15, 13, 24, 1, -1),
+    Glyph::new(0x010E, 0x2E3D, 22, 21, 29, 0, -1),
+    Glyph::new(0x010F, 0x2E9F, 19, 20, 23, 1, -1),
+    Glyph::new(0x0118, 0x2EEB, 19, 18, 27, 0, -7),
+    Glyph::new(0x0119, 0x2F3B, 16, 14, 22, 1, -6),
+    Glyph::new(0x011A, 0x2F74, 19, 18, 28, 0, 0),
+    Glyph::new(0x011B, 0x2FC9, 16, 14, 24, 1, -1),
+    Glyph::new(0x0139, 0x300A, 18, 18, 28, 0, 0),
+    Glyph::new(0x013A, 0x304D, 10, 10, 29, 0, 0),
+    Glyph::new(0x013D, 0x3086, 18, 18, 22, 0, 0),
+    Glyph::new(0x013E, 0x30C6, 11, 13, 22, 0, 0),
+    Glyph::new(0x0141, 0x30F5, 18, 19, 20, -1, 0),
+    Glyph::new(0x0142, 0x3134, 10, 11, 22, -1, 0),
+    Glyph::new(0x0143, 0x315E, 23, 23, 29, 0, -1),
+    Glyph::new(0x0144, 0x31CB, 19, 19, 24, 0, 0),
+    Glyph::new(0x0147, 0x3213, 23, 23, 29, 0, -1),
+    Glyph::new(0x0148, 0x3286, 19, 19, 23, 0, 0),
+    Glyph::new(0x0152, 0x32D2, 29, 27, 21, 1, -1),
+    Glyph::new(0x0153, 0x3341, 26, 24, 17, 1, -1),
+    Glyph::new(0x0158, 0x338F, 20, 21, 29, 0, -1),
+    Glyph::new(0x0159, 0x33F5, 14, 13, 23, 0, 0),
+    Glyph::new(0x015A, 0x3425, 17, 15, 29, 1, -1),
+    Glyph::new(0x015B, 0x3472, 15, 13, 25, 1, -1),
+    Glyph::new(0x0160, 0x34AD, 17, 15, 29, 1, -1),
+    Glyph::new(0x0161, 0x3500, 15, 13, 24, 1, -1),
+    Glyph::new(0x0164, 0x353F, 21, 20, 28, 0, 0),
+    Glyph::new(0x0165, 0x3590, 12, 13, 24, -1, -1),
+    Glyph::new(0x016E, 0x35CA, 23, 23, 29, 0, -1),
+    Glyph::new(0x016F, 0x3639, 19, 19, 25, 0, -1),
+    Glyph::new(0x0170, 0x3699, 23, 23, 29, 0, -1),
+    Glyph::new(0x0171, 0x370C, 19, 19, 25, 0, -1),
+    Glyph::new(0x0178, 0x376A, 21, 20, 26, 0, 0),
+    Glyph::new(0x0179, 0x37BF, 18, 17, 29, 0, -1),
+    Glyph::new(0x017A, 0x3812, 15, 14, 25, 0, -1),
+    Glyph::new(0x017B, 0x3850, 18, 17, 28, 0, -1),
+    Glyph::new(0x017C, 0x389E, 15, 14, 23, 0, -1),
+    Glyph::new(0x017D, 0x38D9, 18, 17, 29, 0, -1),
+    Glyph::new(0x017E, 0x392F, 15, 14, 24, 0, -1),
+    Glyph::new(0x03C0, 0x3971, 20, 19, 17, 0, -1),
+    Glyph::new(0x1E9E, 0x39B2, 22, 21, 21, 0, -1),
+    Glyph::new(0x2013, 0x3A06, 14, 14, 4, 0, 5),
+    Glyph::new(0x2014, 0x3A10, 28, 28, 4, 0, 5),
+    Glyph::new(0x2018, 0x3A23, 7, 6, 9, 1, 12),
+    Glyph::new(0x2019, 0x3A33, 7, 6, 9, 0, 12),
+    Glyph::new(0x201A, 0x3A43, 7, 6, 10, 0, -6),
+    Glyph::new(0x201B, 0x3A53, 7, 6, 9, 1, 12),
+    Glyph::new(0x201C, 0x3A63, 13, 11, 9, 1, 12),
+    Glyph::new(0x201D, 0x3A83, 13, 12, 9, 0, 12),
+    Glyph::new(0x201E, 0x3AA3, 13, 12, 10, 0, -6),
+    Glyph::new(0x201F, 0x3AC3, 13, 11, 9, 1, 12),
+    Glyph::new(0x2020, 0x3AE3, 14, 14, 19, 0, 1),
+    Glyph::new(0x2021, 0x3B13, 14, 14, 22, 0, -2),
+    Glyph::new(0x2022, 0x3B52, 9, 7, 7, 1, 4),
+    Glyph::new(0x2026, 0x3B5F, 28, 24, 5, 2, -1),
+    Glyph::new(0x2039, 0x3B7B, 10, 9, 12, 0, 1),
+    Glyph::new(0x203A, 0x3B8F, 10, 8, 12, 1, 1),
+    Glyph::new(0x2070, 0x3BA4, 13, 12, 14, 0, 10),
+    Glyph::new(0x2074, 0x3BCB, 13, 12, 14, 0, 10),
+    Glyph::new(0x2075, 0x3BED, 13, 10, 13, 1, 10),
+    Glyph::new(0x2076, 0x3C0E, 13, 11, 14, 1, 10),
+    Glyph::new(0x2077, 0x3C2F, 13, 11, 13, 1, 10),
+    Glyph::new(0x2078, 0x3C51, 13, 11, 14, 1, 10),
+    Glyph::new(0x2079, 0x3C75, 13, 11, 14, 1, 10),
+    Glyph::new(0x2080, 0x3C96, 13, 12, 14, 0, -5),
+    Glyph::new(0x2081, 0x3CBB, 13, 10, 14, 1, -4),
+    Glyph::new(0x2082, 0x3CD8, 13, 11, 13, 1, -4),
+    Glyph::new(0x2083, 0x3CFD, 13, 10, 14, 1, -5),
+    Glyph::new(0x2084, 0x3D1E, 13, 12, 14, 0, -5),
+    Glyph::new(0x2085, 0x3D41, 13, 10, 14, 1, -5),
+    Glyph::new(0x2086, 0x3D60, 13, 11, 14, 1, -5),
+    Glyph::new(0x2087, 0x3D84, 13, 11, 14, 1, -5),
+    Glyph::new(0x2088, 0x3DA5, 13, 11, 14, 1, -5),
+    Glyph::new(0x2089, 0x3DCA, 13, 11, 14, 1, -5),
+    Glyph::new(0x20AC, 0x3DEC, 18, 18, 21, 0, -1),
+    Glyph::new(0x2122, 0x3E2F, 25, 24, 10, 0, 10),
+    Glyph::new(0x2153, 0x3E75, 31, 28, 23, 1, -2),
+    Glyph::new(0x2154, 0x3EE4, 31, 28, 23, 1, -2),
+    Glyph::new(0x215B, 0x3F56, 31, 28, 23, 1, -2),
+    Glyph::new(0x215C, 0x3FCB, 31, 28, 23, 1, -2),
+    Glyph::new(0x215D, 0x403E, 31, 28, 23, 1, -2),
+    Glyph::new(0x215E, 0x40B2, 31, 28, 23, 1, -2),
+    Glyph::new(0x2190, 0x4129, 28, 18, 13, 5, 3),
+    Glyph::new(0x2191, 0x414B, 28, 14, 19, 7, 0),
+    Glyph::new(0x2192, 0x4180, 28, 18, 13, 5, 3),
+    Glyph::new(0x2193, 0x41A1, 28, 14, 19, 7, 0),
+    Glyph::new(0x2194, 0x41D6, 28, 18, 13, 5, 3),
+    Glyph::new(0x2195, 0x4205, 28, 12, 19, 8, 0),
+    Glyph::new(0x21D0, 0x423A, 28, 18, 16, 5, 2),
+    Glyph::new(0x21D1, 0x4270, 28, 16, 18, 6, 1),
+    Glyph::new(0x21D2, 0x42AF, 28, 18, 16, 5, 2),
+    Glyph::new(0x21D3, 0x42E6, 28, 16, 18, 6, 1),
+    Glyph::new(0x21D4, 0x4322, 28, 18, 15, 5, 2),
+    Glyph::new(0x2202, 0x4361, 18, 15, 23, 1, -1),
+    Glyph::new(0x2206, 0x43A6, 20, 19, 20, 0, 0),
+    Glyph::new(0x220F, 0x43E5, 24, 23, 25, 0, -5),
+    Glyph::new(0x2211, 0x444E, 19, 18, 25, 0, -5),
+    Glyph::new(0x221A, 0x449D, 18, 19, 27, -1, -4),
+    Glyph::new(0x221E, 0x44E6, 18, 18, 11, 0, 3),
+    Glyph::new(0x222B, 0x4515, 18, 16, 29, 1, -7),
+    Glyph::new(0x2260, 0x4558, 18, 13, 15, 2, 2),
+    Glyph::new(0x2264, 0x457F, 18, 13, 17, 2, 0),
+    Glyph::new(0x2265, 0x45A8, 18, 13, 18, 2, 0),
+    Glyph::new(0xFB01, 0x45D2, 23, 23, 22, 0, 0),
+    Glyph::new(0xFB02, 0x4624, 23, 23, 22, 0, 0),
 ];
 
-const BITMAP_BW: &[u8; 12395] = include_bytes!("./bookerly_bold_28.bw");
-const BITMAP_MSB: &[u8; 12395] = include_bytes!("./bookerly_bold_28.msb");
-const BITMAP_LSB: &[u8; 12395] = include_bytes!("./bookerly_bold_28.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 15), (18, 15), (19, 16),
+    (20, 15), (21, 17), (22, 18), (23, 15), (24, 15), (25, 19), (26, 15), (27, 14),
+    (28, 13), (29, 14), (30, 13), (31, 20), (32, 21), (33, 22), (34, 23), (35, 24),
+    (36, 25), (37, 26), (38, 27), (39, 28), (0, 0), (40, 29), (0, 0), (0, 0),
+    (0, 0), (41, 30), (42, 31), (43, 32), (44, 32), (45, 32), (46, 33), (47, 34),
+    (48, 35), (49, 36), (50, 37), (51, 35), (52, 38), (48, 39), (53, 39), (54, 32),
+    (55, 40), (56, 32), (57, 39), (58, 30), (59, 41), (48, 42), (60, 43), (61, 44),
+    (51, 45), (60, 46), (62, 47), (63, 48), (0, 0), (64, 29), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (65, 49), (66, 50),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (67, 51), (0, 0), (0, 0),
+    (0, 0), (68, 52), (69, 53), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (70, 54), (15, 14), (17, 15),
+    (17, 15), (17, 15), (17, 15), (21, 17), (21, 17), (21, 55), (21, 55), (16, 56),
+    (26, 15), (27, 14), (27, 14), (27, 14), (27, 14), (27, 14), (0, 0), (71, 57),
+    (33, 22), (33, 22), (33, 22), (33, 22), (72, 15), (73, 58), (41, 59), (41, 30),
+    (74, 60), (74, 61), (44, 62), (75, 63), (45, 30), (76, 32), (45, 64), (45, 32),
+    (77, 65), (77, 66), (52, 67), (49, 68), (78, 69), (79, 69), (80, 70), (81, 39),
+    (54, 32), (54, 32), (82, 70), (83, 71), (84, 66), (0, 0), (82, 72), (48, 42),
+    (48, 42), (85, 42), (85, 73), (55, 74), (60, 75), (86, 12), (87, 30), (15, 14),
+    (88, 32), (15, 14), (89, 76), (16, 13), (90, 32), (17, 15), (91, 32), (17, 15),
+    (92, 77), (24, 15), (52, 38), (93, 15), (94, 38), (95, 78), (96, 79), (26, 15),
+    (53, 39), (26, 15), (53, 39), (97, 80), (98, 32), (30, 13), (99, 81), (31, 20),
+    (92, 30), (31, 20), (92, 82), (32, 21), (100, 41), (33, 22), (48, 42), (33, 22),
+    (101, 42), (37, 26), (38, 27), (62, 47), (38, 27), (62, 47), (38, 27), (62, 83),
+    (102, 84), (103, 85), (104, 86), (104, 86), (105, 87), (106, 88), (107, 89), (0, 0),
+    (108, 87), (109, 88), (110, 89), (0, 0), (0, 0), (0, 0), (0, 0), (111, 90),
+    (66, 50), (69, 53), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (49, 33), (52, 33),
+];
+
+const KERNING: [&[i8]; 112] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, -2, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, 0, -1, -1, -1, -2, 0, -1, -2, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, -2, -1, 0, -1, 0, -2, -1, -1, -1, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, -2, 0, -2, -1, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, -2, 0, -1, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -2, -2, 0, -2, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -1, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -2, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -2, -1, -2, -2, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -2, 0, -2, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1],
+    &[0, -1, 0, -1, -1, -1, -2, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -2, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -1, -1, -1, -1, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -2, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, 0, -1, -1, -2, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -2, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -2, 0, 0, 0, -1, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -1, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -2, 0, -2, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2, 0, -2, -2, 0, 0, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -1, -1, -2, 0, 0, -2, -1, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -2, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, -2, -2, 0, -2, -2, 0, 0, -1, -1, -2, -1, -1, 0, -1, -2, -1, -1, 0, -1, 0, -1, -1, -2, -1, 0, -1, -1, -2, 0, 0, -2, -1, -1, -1, -2, -2, -2, 0, 0, -2, -2],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, -2, 0, 0, -2, -2, -2, -2, 0, -1, -1, 0, -2, 0, -2, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, -1, 0, 0, -1, 0, 0, -2, 0, -1, -1, -2, -2, -1, 0, -2, -1, -1, -2, -1, -1, -2, -1, 0, 0, -2, -1, -2, -2, -1, -1, -2, -2, -2, -1, 0, -1, 0, -2, -2, -2, -1, 0, 0, -1, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -2, -2, -1, -1, 0, 0, -2, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, -1, -2, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, -2],
+    &[0, -1, -1, -1, -1, -2, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -2],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -2, 0, -1, -1, -2, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, 0, -1, 0, -2, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -2, -2, 0, -1, -1, -1, -2, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -2, -2, -2, -2],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, 0, -1, -1, -2, -1, 0, -1, 0, -2, -1, -1, -1, 0, -1, -1, -1, -2, -2, -1, -1, -2, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, -1, -2, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, -2, -2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, -2, 0, -2, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+];
+
+const BITMAP: &[u8; 18042] = include_bytes!("./bookerly_bold_28.rle");
@@ -1,308 +1,516 @@
 // Auto-generated font file
 // Font: Bookerly Bold
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 14040,
+    size: 19575,
     y_advance: 30,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 9, 6, 24, 2, -1),
-    Glyph::new(0x0022, 0x0012, 13, 11, 11, 1, 11),
-    Glyph::new(0x0023, 0x0022, 19, 19, 20, 0, -2),
-    Glyph::new(0x0024, 0x0052, 19, 15, 30, 2, -6),
-    Glyph::new(0x0025, 0x008B, 30, 27, 25, 1, -2),
-    Glyph::new(0x0026, 0x00E0, 24, 24, 23, 0, -1),
-    Glyph::new(0x0027, 0x0125, 7, 5, 11, 1, 11),
-    Glyph::new(0x0028, 0x012C, 12, 10, 30, 1, -6),
-    Glyph::new(0x0029, 0x0152, 12, 11, 30, 0, -6),
-    Glyph::new(0x002A, 0x017C, 12, 11, 12, 0, 11),
-    Glyph::new(0x002B, 0x018D, 19, 14, 14, 2, 3),
-    Glyph::new(0x002C, 0x01A6, 9, 8, 11, 0, -6),
-    Glyph::new(0x002D, 0x01B1, 12, 10, 4, 1, 6),
-    Glyph::new(0x002E, 0x01B6, 9, 7, 6, 1, -1),
-    Glyph::new(0x002F, 0x01BC, 16, 15, 24, 0, -2),
-    Glyph::new(0x0030, 0x01E9, 19, 18, 22, 0, -1),
-    Glyph::new(0x0031, 0x021B, 19, 14, 21, 2, 0),
-    Glyph::new(0x0032, 0x0240, 19, 17, 21, 1, 0),
-    Glyph::new(0x0033, 0x026D, 19, 16, 22, 1, -1),
-    Glyph::new(0x0034, 0x0299, 19, 19, 22, 0, -1),
-    Glyph::new(0x0035, 0x02CE, 19, 15, 22, 1, -1),
-    Glyph::new(0x0036, 0x02F8, 19, 16, 22, 1, -1),
-    Glyph::new(0x0037, 0x0324, 19, 16, 22, 2, -1),
-    Glyph::new(0x0038, 0x0350, 19, 16, 22, 1, -1),
-    Glyph::new(0x0039, 0x037C, 19, 16, 22, 1, -1),
-    Glyph::new(0x003A, 0x03A8, 9, 7, 17, 1, -1),
-    Glyph::new(0x003B, 0x03B7, 9, 8, 22, 0, -6),
-    Glyph::new(0x003C, 0x03CD, 19, 14, 14, 2, 3),
-    Glyph::new(0x003D, 0x03E6, 19, 14, 10, 2, 5),
-    Glyph::new(0x003E, 0x03F8, 19, 14, 14, 2, 3),
-    Glyph::new(0x003F, 0x0411, 15, 13, 23, 1, -1),
-    Glyph::new(0x0040, 0x0437, 30, 28, 27, 1, -6),
-    Glyph::new(0x0041, 0x0496, 24, 23, 22, 0, 0),
-    Glyph::new(0x0042, 0x04D6, 20, 18, 23, 1, -1),
-    Glyph::new(0x0043, 0x050A, 20, 18, 23, 1, -1),
-    Glyph::new(0x0044, 0x053E, 24, 22, 23, 1, -1),
-    Glyph::new(0x0045, 0x057E, 20, 18, 21, 1, 0),
-    Glyph::new(0x0046, 0x05AE, 18, 16, 21, 1, 0),
-    Glyph::new(0x0047, 0x05D8, 23, 20, 23, 1, -1),
-    Glyph::new(0x0048, 0x0612, 26, 24, 21, 1, 0),
-    Glyph::new(0x0049, 0x0651, 13, 11, 21, 1, 0),
-    Glyph::new(0x004A, 0x066E, 12, 14, 28, -2, -7),
-    Glyph::new(0x004B, 0x069F, 23, 22, 22, 1, -1),
-    Glyph::new(0x004C, 0x06DC, 19, 18, 21, 1, 0),
-    Glyph::new(0x004D, 0x070C, 29, 28, 21, 0, 0),
-    Glyph::new(0x004E, 0x0756, 25, 25, 22, 0, -1),
-    Glyph::new(0x004F, 0x079B, 24, 22, 23, 1, -1),
-    Glyph::new(0x0050, 0x07DB, 19, 18, 22, 1, 0),
-    Glyph::new(0x0051, 0x080D, 24, 23, 29, 1, -7),
-    Glyph::new(0x0052, 0x0861, 22, 21, 23, 1, -1),
-    Glyph::new(0x0053, 0x089E, 18, 16, 23, 1, -1),
-    Glyph::new(0x0054, 0x08CC, 22, 21, 21, 0, 0),
-    Glyph::new(0x0055, 0x0904, 25, 24, 22, 0, -1),
-    Glyph::new(0x0056, 0x0946, 24, 24, 22, 0, -1),
-    Glyph::new(0x0057, 0x0988, 34, 33, 22, 0, -1),
-    Glyph::new(0x0058, 0x09E3, 24, 23, 21, 0, 0),
-    Glyph::new(0x0059, 0x0A20, 22, 22, 21, 0, 0),
-    Glyph::new(0x005A, 0x0A5A, 19, 18, 22, 0, -1),
-    Glyph::new(0x005B, 0x0A8C, 11, 8, 29, 1, -5),
-    Glyph::new(0x005C, 0x0AA9, 16, 15, 24, 0, -2),
-    Glyph::new(0x005D, 0x0AD6, 11, 8, 29, 1, -5),
-    Glyph::new(0x005E, 0x0AF3, 19, 15, 15, 2, 5),
-    Glyph::new(0x005F, 0x0B10, 15, 15, 4, 0, -5),
-    Glyph::new(0x0060, 0x0B18, 21, 7, 8, 6, 18),
-    Glyph::new(0x0061, 0x0B1F, 18, 16, 18, 1, -1),
-    Glyph::new(0x0062, 0x0B43, 19, 19, 25, -1, -1),
-    Glyph::new(0x0063, 0x0B7F, 16, 14, 18, 1, -1),
-    Glyph::new(0x0064, 0x0B9F, 19, 18, 25, 1, -1),
-    Glyph::new(0x0065, 0x0BD8, 17, 15, 18, 1, -1),
-    Glyph::new(0x0066, 0x0BFA, 13, 16, 24, 0, 0),
-    Glyph::new(0x0067, 0x0C2A, 19, 18, 25, 0, -8),
-    Glyph::new(0x0068, 0x0C63, 20, 20, 24, 0, 0),
-    Glyph::new(0x0069, 0x0C9F, 11, 11, 24, 0, 0),
-    Glyph::new(0x006A, 0x0CC0, 10, 10, 32, -2, -8),
-    Glyph::new(0x006B, 0x0CE8, 20, 19, 25, 0, -1),
-    Glyph::new(0x006C, 0x0D24, 11, 10, 24, 0, 0),
-    Glyph::new(0x006D, 0x0D42, 30, 30, 17, 0, 0),
-    Glyph::new(0x006E, 0x0D82, 21, 20, 17, 0, 0),
-    Glyph::new(0x006F, 0x0DAD, 19, 17, 18, 1, -1),
-    Glyph::new(0x0070, 0x0DD4, 19, 18, 24, 0, -7),
-    Glyph::new(0x0071, 0x0E0A, 18, 17, 24, 1, -7),
-    Glyph::new(0x0072, 0x0E3D, 15, 14, 17, 0, 0),
-    Glyph::new(0x0073, 0x0E5B, 16, 13, 18, 1, -1),
-    Glyph::new(0x0074, 0x0E79, 13, 14, 21, -1, -1),
-    Glyph::new(0x0075, 0x0E9E, 20, 20, 17, 0, -1),
-    Glyph::new(0x0076, 0x0EC9, 20, 20, 17, 0, -1),
-    Glyph::new(0x0077, 0x0EF4, 28, 27, 17, 0, -1),
-    Glyph::new(0x0078, 0x0F2E, 19, 19, 16, 0, 0),
-    Glyph::new(0x0079, 0x0F54, 20, 20, 24, 0, -8),
-    Glyph::new(0x007A, 0x0F90, 16, 15, 17, 0, -1),
-    Glyph::new(0x007B, 0x0FB0, 13, 11, 30, 1, -6),
-    Glyph::new(0x007C, 0x0FDA, 10, 5, 27, 2, -4),
-    Glyph::new(0x007D, 0x0FEB, 13, 11, 30, 0, -6),
-    Glyph::new(0x007E, 0x1015, 19, 15, 6, 2, 7),
-    Glyph::new(0x00A1, 0x1021, 9, 6, 24, 1, -7),
-    Glyph::new(0x00A2, 0x1033, 19, 16, 29, 1, -6),
-    Glyph::new(0x00A3, 0x106D, 19, 18, 22, 0, -1),
-    Glyph::new(0x00A4, 0x109F, 19, 17, 15, 1, 3),
-    Glyph::new(0x00A5, 0x10BF, 19, 21, 21, -1, 0),
-    Glyph::new(0x00A7, 0x10F7, 16, 14, 24, 1, -3),
-    Glyph::new(0x00A9, 0x1121, 24, 23, 23, 0, -1),
-    Glyph::new(0x00AA, 0x1164, 14, 11, 16, 1, 6),
-    Glyph::new(0x00AB, 0x117A, 18, 17, 12, 0, 2),
-    Glyph::new(0x00AE, 0x1194, 18, 17, 17, 0, 7),
-    Glyph::new(0x00B0, 0x11B9, 16, 12, 11, 2, 10),
-    Glyph::new(0x00B1, 0x11CA, 19, 14, 19, 2, -1),
-    Glyph::new(0x00B2, 0x11EC, 14, 12, 14, 1, 11),
-    Glyph::new(0x00B3, 0x1201, 14, 11, 15, 1, 10),
-    Glyph::new(0x00B5, 0x1216, 20, 20, 24, 1, -7),
-    Glyph::new(0x00B6, 0x1252, 18, 17, 26, 0, -5),
-    Glyph::new(0x00B7, 0x128A, 9, 7, 6, 1, 5),
-    Glyph::new(0x00B9, 0x1290, 14, 10, 14, 2, 11),
-    Glyph::new(0x00BA, 0x12A2, 14, 11, 16, 1, 6),
-    Glyph::new(0x00BB, 0x12B8, 18, 16, 12, 1, 2),
-    Glyph::new(0x00BC, 0x12D0, 33, 30, 26, 2, -3),
-    Glyph::new(0x00BD, 0x1332, 33, 30, 26, 2, -3),
-    Glyph::new(0x00BE, 0x1394, 33, 31, 26, 1, -3),
-    Glyph::new(0x00BF, 0x13F9, 15, 12, 24, 1, -7),
-    Glyph::new(0x00C0, 0x141D, 24, 23, 30, 0, 0),
-    Glyph::new(0x00C1, 0x1474, 24, 23, 30, 0, 0),
-    Glyph::new(0x00C2, 0x14CB, 24, 23, 29, 0, 0),
-    Glyph::new(0x00C3, 0x151F, 24, 23, 29, 0, 0),
-    Glyph::new(0x00C4, 0x1573, 24, 23, 28, 0, 0),
-    Glyph::new(0x00C5, 0x15C4, 24, 23, 30, 0, 0),
-    Glyph::new(0x00C6, 0x161B, 30, 30, 21, -1, 0),
-    Glyph::new(0x00C7, 0x166A, 20, 18, 30, 1, -8),
-    Glyph::new(0x00C8, 0x16AE, 20, 18, 30, 1, 0),
-    Glyph::new(0x00C9, 0x16F2, 20, 18, 30, 1, 0),
-    Glyph::new(0x00CA, 0x1736, 20, 18, 29, 1, 0),
-    Glyph::new(0x00CB, 0x1778, 20, 18, 28, 1, 0),
-    Glyph::new(0x00CC, 0x17B7, 13, 11, 30, 1, 0),
-    Glyph::new(0x00CD, 0x17E1, 13, 11, 30, 1, 0),
-    Glyph::new(0x00CE, 0x180B, 13, 12, 29, 0, 0),
-    Glyph::new(0x00CF, 0x1837, 13, 12, 28, 0, 0),
-    Glyph::new(0x00D0, 0x1861, 24, 23, 23, 0, -1),
-    Glyph::new(0x00D1, 0x18A4, 25, 25, 30, 0, -1),
-    Glyph::new(0x00D2, 0x1902, 24, 22, 31, 1, -1),
-    Glyph::new(0x00D3, 0x1958, 24, 22, 31, 1, -1),
-    Glyph::new(0x00D4, 0x19AE, 24, 22, 30, 1, -1),
-    Glyph::new(0x00D5, 0x1A01, 24, 22, 30, 1, -1),
-    Glyph::new(0x00D6, 0x1A54, 24, 22, 29, 1, -1),
-    Glyph::new(0x00D7, 0x1AA4, 19, 13, 14, 3, 3),
-    Glyph::new(0x00D8, 0x1ABB, 24, 23, 23, 0, -1),
-    Glyph::new(0x00D9, 0x1AFE, 25, 24, 31, 0, -1),
-    Glyph::new(0x00DA, 0x1B5B, 25, 24, 31, 0, -1),
-    Glyph::new(0x00DB, 0x1BB8, 25, 24, 30, 0, -1),
-    Glyph::new(0x00DC, 0x1C12, 25, 24, 29, 0, -1),
-    Glyph::new(0x00DE, 0x1C69, 20, 18, 21, 1, 0),
-    Glyph::new(0x00DF, 0x1C99, 21, 19, 25, 0, -1),
-    Glyph::new(0x00E0, 0x1CD5, 18, 16, 27, 1, -1),
-    Glyph::new(0x00E1, 0x1D0B, 18, 16, 27, 1, -1),
-    Glyph::new(0x00E2, 0x1D41, 18, 16, 26, 1, -1),
-    Glyph::new(0x00E3, 0x1D75, 18, 16, 25, 1, -1),
-    Glyph::new(0x00E4, 0x1DA7, 18, 16, 24, 1, -1),
-    Glyph::new(0x00E5, 0x1DD7, 18, 16, 27, 1, -1),
-    Glyph::new(0x00E6, 0x1E0D, 25, 23, 18, 1, -1),
-    Glyph::new(0x00E7, 0x1E41, 16, 14, 25, 1, -8),
-    Glyph::new(0x00E8, 0x1E6D, 17, 15, 27, 1, -1),
-    Glyph::new(0x00E9, 0x1EA0, 17, 15, 27, 1, -1),
-    Glyph::new(0x00EA, 0x1ED3, 17, 15, 26, 1, -1),
-    Glyph::new(0x00EB, 0x1F04, 17, 15, 24, 1, -1),
-    Glyph::new(0x00EC, 0x1F31, 11, 11, 26, 0, 0),
-    Glyph::new(0x00ED, 0x1F55, 11, 11, 26, 0, 0),
-    Glyph::new(0x00EE, 0x1F79, 11, 11, 25, 0, 0),
-    Glyph::new(0x00EF, 0x1F9C, 11, 11, 23, 0, 0),
-    Glyph::new(0x00F0, 0x1FBC, 19, 16, 26, 1, -1),
-    Glyph::new(0x00F1, 0x1FF0, 21, 20, 24, 0, 0),
-    Glyph::new(0x00F2, 0x202C, 19, 17, 27, 1, -1),
-    Glyph::new(0x00F3, 0x2066, 19, 17, 27, 1, -1),
-    Glyph::new(0x00F4, 0x20A0, 19, 17, 26, 1, -1),
-    Glyph::new(0x00F5, 0x20D8, 19, 17, 25, 1, -1),
-    Glyph::new(0x00F6, 0x210E, 19, 17, 24, 1, -1),
-    Glyph::new(0x00F7, 0x2141, 19, 14, 14, 2, 3),
-    Glyph::new(0x00F8, 0x215A, 19, 18, 18, 0, -1),
-    Glyph::new(0x00F9, 0x2183, 20, 20, 27, 0, -1),
-    Glyph::new(0x00FA, 0x21C7, 20, 20, 27, 0, -1),
-    Glyph::new(0x00FB, 0x220B, 20, 20, 26, 0, -1),
-    Glyph::new(0x00FC, 0x224C, 20, 20, 24, 0, -1),
-    Glyph::new(0x00FE, 0x2288, 19, 18, 31, 0, -7),
-    Glyph::new(0x00FF, 0x22CE, 20, 20, 31, 0, -8),
-    Glyph::new(0x0104, 0x231C, 24, 23, 29, 0, -7),
-    Glyph::new(0x0105, 0x2370, 18, 16, 24, 1, -7),
-    Glyph::new(0x0106, 0x23A0, 20, 18, 31, 1, -1),
-    Glyph::new(0x0107, 0x23E6, 16, 14, 27, 1, -1),
-    Glyph::new(0x010C, 0x2416, 20, 18, 30, 1, -1),
-    Glyph::new(0x010D, 0x245A, 16, 14, 26, 1, -1),
-    Glyph::new(0x010E, 0x2488, 24, 22, 30, 1, -1),
-    Glyph::new(0x010F, 0x24DB, 20, 21, 25, 1, -1),
-    Glyph::new(0x0118, 0x251D, 20, 18, 28, 1, -7),
-    Glyph::new(0x0119, 0x255C, 17, 15, 24, 1, -7),
-    Glyph::new(0x011A, 0x2589, 20, 18, 29, 1, 0),
-    Glyph::new(0x011B, 0x25CB, 17, 15, 26, 1, -1),
-    Glyph::new(0x0139, 0x25FC, 19, 18, 30, 1, 0),
-    Glyph::new(0x013A, 0x2640, 11, 10, 31, 0, 0),
-    Glyph::new(0x013D, 0x2667, 19, 18, 24, 1, 0),
-    Glyph::new(0x013E, 0x269D, 12, 14, 24, 0, 0),
-    Glyph::new(0x0141, 0x26C7, 19, 20, 21, -1, 0),
-    Glyph::new(0x0142, 0x26FC, 11, 12, 24, -1, 0),
-    Glyph::new(0x0143, 0x2720, 25, 25, 31, 0, -1),
-    Glyph::new(0x0144, 0x2781, 21, 20, 26, 0, 0),
-    Glyph::new(0x0147, 0x27C2, 25, 25, 30, 0, -1),
-    Glyph::new(0x0148, 0x2820, 21, 20, 25, 0, 0),
-    Glyph::new(0x0152, 0x285F, 31, 29, 22, 1, -1),
-    Glyph::new(0x0153, 0x28AF, 28, 26, 18, 1, -1),
-    Glyph::new(0x0158, 0x28EA, 22, 21, 30, 1, -1),
-    Glyph::new(0x0159, 0x2939, 15, 14, 25, 0, 0),
-    Glyph::new(0x015A, 0x2965, 18, 16, 31, 1, -1),
-    Glyph::new(0x015B, 0x29A3, 16, 13, 27, 1, -1),
-    Glyph::new(0x0160, 0x29CF, 18, 16, 30, 1, -1),
-    Glyph::new(0x0161, 0x2A0B, 16, 13, 26, 1, -1),
-    Glyph::new(0x0164, 0x2A36, 22, 21, 29, 0, 0),
-    Glyph::new(0x0165, 0x2A83, 13, 14, 25, -1, -1),
-    Glyph::new(0x016E, 0x2AAF, 25, 24, 31, 0, -1),
-    Glyph::new(0x016F, 0x2B0C, 20, 20, 27, 0, -1),
-    Glyph::new(0x0170, 0x2B50, 25, 24, 31, 0, -1),
-    Glyph::new(0x0171, 0x2BAD, 20, 20, 27, 0, -1),
-    Glyph::new(0x0178, 0x2BF1, 22, 22, 28, 0, 0),
-    Glyph::new(0x0179, 0x2C3E, 19, 18, 31, 0, -1),
-    Glyph::new(0x017A, 0x2C84, 16, 15, 27, 0, -1),
-    Glyph::new(0x017B, 0x2CB7, 19, 18, 30, 0, -1),
-    Glyph::new(0x017C, 0x2CFB, 16, 15, 25, 0, -1),
-    Glyph::new(0x017D, 0x2D2A, 19, 18, 30, 0, -1),
-    Glyph::new(0x017E, 0x2D6E, 16, 15, 26, 0, -1),
-    Glyph::new(0x03C0, 0x2D9F, 21, 21, 18, 0, -1),
-    Glyph::new(0x1E9E, 0x2DCF, 23, 22, 23, 0, -1),
-    Glyph::new(0x2013, 0x2E0F, 15, 15, 4, 0, 6),
-    Glyph::new(0x2014, 0x2E17, 30, 30, 4, 0, 6),
-    Glyph::new(0x2018, 0x2E26, 8, 6, 11, 1, 12),
-    Glyph::new(0x2019, 0x2E2F, 8, 7, 11, 0, 12),
-    Glyph::new(0x201A, 0x2E39, 8, 7, 10, 0, -6),
-    Glyph::new(0x201B, 0x2E42, 8, 6, 11, 1, 12),
-    Glyph::new(0x201C, 0x2E4B, 14, 12, 11, 1, 12),
-    Glyph::new(0x201D, 0x2E5C, 14, 13, 11, 0, 12),
-    Glyph::new(0x201E, 0x2E6E, 14, 13, 10, 0, -6),
-    Glyph::new(0x201F, 0x2E7F, 14, 12, 11, 1, 12),
-    Glyph::new(0x2020, 0x2E90, 15, 14, 20, 0, 2),
-    Glyph::new(0x2021, 0x2EB3, 15, 15, 24, 0, -2),
-    Glyph::new(0x2022, 0x2EE0, 9, 7, 8, 1, 4),
-    Glyph::new(0x2026, 0x2EE7, 30, 26, 6, 2, -1),
-    Glyph::new(0x2039, 0x2EFB, 11, 9, 12, 0, 2),
-    Glyph::new(0x203A, 0x2F09, 11, 9, 12, 1, 2),
-    Glyph::new(0x2070, 0x2F17, 14, 13, 15, 0, 10),
-    Glyph::new(0x2074, 0x2F30, 14, 13, 15, 0, 10),
-    Glyph::new(0x2075, 0x2F49, 14, 11, 15, 1, 10),
-    Glyph::new(0x2076, 0x2F5E, 14, 12, 15, 1, 10),
-    Glyph::new(0x2077, 0x2F75, 14, 12, 15, 1, 10),
-    Glyph::new(0x2078, 0x2F8C, 14, 11, 15, 1, 10),
-    Glyph::new(0x2079, 0x2FA1, 14, 12, 15, 1, 10),
-    Glyph::new(0x2080, 0x2FB8, 14, 13, 15, 0, -5),
-    Glyph::new(0x2081, 0x2FD1, 14, 10, 14, 2, -4),
-    Glyph::new(0x2082, 0x2FE3, 14, 12, 14, 1, -4),
-    Glyph::new(0x2083, 0x2FF8, 14, 11, 15, 1, -5),
-    Glyph::new(0x2084, 0x300D, 14, 13, 15, 0, -5),
-    Glyph::new(0x2085, 0x3026, 14, 11, 15, 1, -5),
-    Glyph::new(0x2086, 0x303B, 14, 12, 15, 1, -5),
-    Glyph::new(0x2087, 0x3052, 14, 12, 15, 1, -5),
-    Glyph::new(0x2088, 0x3069, 14, 11, 15, 1, -5),
-    Glyph::new(0x2089, 0x307E, 14, 12, 15, 1, -5),
-    Glyph::new(0x20AC, 0x3095, 19, 19, 22, 0, -1),
-    Glyph::new(0x2122, 0x30CA, 26, 25, 11, 0, 10),
-    Glyph::new(0x2153, 0x30ED, 33, 29, 26, 2, -3),
-    Glyph::new(0x2154, 0x314C, 33, 30, 26, 1, -3),
-    Glyph::new(0x215B, 0x31AE, 33, 29, 26, 2, -3),
-    Glyph::new(0x215C, 0x320D, 33, 30, 26, 1, -3),
-    Glyph::new(0x215D, 0x326F, 33, 30, 26, 1, -3),
-    Glyph::new(0x215E, 0x32D1, 33, 30, 26, 1, -3),
-    Glyph::new(0x2190, 0x3333, 30, 20, 15, 5, 3),
-    Glyph::new(0x2191, 0x3359, 30, 14, 20, 8, 0),
-    Glyph::new(0x2192, 0x337C, 30, 20, 15, 5, 3),
-    Glyph::new(0x2193, 0x33A2, 30, 14, 20, 8, 0),
-    Glyph::new(0x2194, 0x33C5, 30, 20, 13, 5, 4),
-    Glyph::new(0x2195, 0x33E6, 30, 14, 21, 8, 0),
-    Glyph::new(0x21D0, 0x340B, 30, 20, 17, 5, 2),
-    Glyph::new(0x21D1, 0x3436, 30, 18, 19, 6, 1),
-    Glyph::new(0x21D2, 0x3461, 30, 20, 17, 5, 2),
-    Glyph::new(0x21D3, 0x348C, 30, 18, 19, 6, 1),
-    Glyph::new(0x21D4, 0x34B7, 30, 20, 15, 5, 3),
-    Glyph::new(0x2202, 0x34DD, 19, 16, 25, 1, -1),
-    Glyph::new(0x2206, 0x350F, 21, 20, 22, 0, 0),
-    Glyph::new(0x220F, 0x3546, 26, 24, 26, 1, -5),
-    Glyph::new(0x2211, 0x3594, 20, 19, 26, 1, -5),
-    Glyph::new(0x221A, 0x35D2, 19, 20, 29, -1, -4),
-    Glyph::new(0x221E, 0x361B, 19, 19, 11, 0, 4),
-    Glyph::new(0x222B, 0x3636, 19, 17, 32, 1, -8),
-    Glyph::new(0x2260, 0x367A, 19, 14, 16, 2, 2),
-    Glyph::new(0x2264, 0x3696, 19, 14, 18, 2, 0),
-    Glyph::new(0x2265, 0x36B6, 19, 14, 19, 2, 0),
+    Glyph::new(0x0022, 0x0023, 13, 11, 11, 1, 11),
+    Glyph::new(0x0023, 0x0046, 19, 19, 20, 0, -2),
+    Glyph::new(0x0024, 0x008D, 19, 15, 30, 2, -6),
+    Glyph::new(0x0025, 0x00ED, 30, 27, 25, 1, -2),
+    Glyph::new(0x0026, 0x016E, 24, 24, 23, 0, -1),
+    Glyph::new(0x0027, 0x01CE, 7, 5, 11, 1, 11),
+    Glyph::new(0x0028, 0x01DF, 12, 10, 30, 1, -6),
+    Glyph::new(0x0029, 0x0218, 12, 11, 30, 0, -6),
+    Glyph::new(0x002A, 0x024F, 12, 11, 12, 0, 11),
+    Glyph::new(0x002B, 0x026E, 19, 14, 14, 2, 3),
+    Glyph::new(0x002C, 0x0294, 9, 8, 11, 0, -6),
+    Glyph::new(0x002D, 0x02A6, 12, 10, 4, 1, 6),
+    Glyph::new(0x002E, 0x02B0, 9, 7, 6, 1, -1),
+    Glyph::new(0x002F, 0x02BB, 16, 15, 24, 0, -2),
+    Glyph::new(0x0030, 0x02F1, 19, 18, 22, 0, -1),
+    Glyph::new(0x0031, 0x033E, 19, 14, 21, 2, 0),
+    Glyph::new(0x0032, 0x036E, 19, 17, 21, 1, 0),
+    Glyph::new(0x0033, 0x03AE, 19, 16, 22, 1, -1),
+    Glyph::new(0x0034, 0x03EC, 19, 19, 22, 0, -1),
+    Glyph::new(0x0035, 0x042B, 19, 15, 22, 1, -1),
+    Glyph::new(0x0036, 0x0465, 19, 16, 22, 1, -1),
+    Glyph::new(0x0037, 0x04A8, 19, 16, 22, 2, -1),
+    Glyph::new(0x0038, 0x04E2, 19, 16, 22, 1, -1),
+    Glyph::new(0x0039, 0x0527, 19, 16, 22, 1, -1),
+    Glyph::new(0x003A, 0x056E, 9, 7, 17, 1, -1),
+    Glyph::new(0x003B, 0x0585, 9, 8, 22, 0, -6),
+    Glyph::new(0x003C, 0x05A3, 19, 14, 14, 2, 3),
+    Glyph::new(0x003D, 0x05C8, 19, 14, 10, 2, 5),
+    Glyph::new(0x003E, 0x05E8, 19, 14, 14, 2, 3),
+    Glyph::new(0x003F, 0x060C, 15, 13, 23, 1, -1),
+    Glyph::new(0x0040, 0x063D, 30, 28, 27, 1, -6),
+    Glyph::new(0x0041, 0x06C8, 24, 23, 22, 0, 0),
+    Glyph::new(0x0042, 0x0712, 20, 18, 23, 1, -1),
+    Glyph::new(0x0043, 0x0757, 20, 18, 23, 1, -1),
+    Glyph::new(0x0044, 0x0797, 24, 22, 23, 1, -1),
+    Glyph::new(0x0045, 0x07E3, 20, 18, 21, 1, 0),
+    Glyph::new(0x0046, 0x081F, 18, 16, 21, 1, 0),
+    Glyph::new(0x0047, 0x0861, 23, 20, 23, 1, -1),
+    Glyph::new(0x0048, 0x08B0, 26, 24, 21, 1, 0),
+    Glyph::new(0x0049, 0x08FF, 13, 11, 21, 1, 0),
+    Glyph::new(0x004A, 0x0927, 12, 14, 28, -2, -7),
+    Glyph::new(0x004B, 0x0965, 23, 22, 22, 1, -1),
+    Glyph::new(0x004C, 0x09BC, 19, 18, 21, 1, 0),
+    Glyph::new(0x004D, 0x09F3, 29, 28, 21, 0, 0),
+    Glyph::new(0x004E, 0x0A6E, 25, 25, 22, 0, -1),
+    Glyph::new(0x004F, 0x0AD7, 24, 22, 23, 1, -1),
+    Glyph::new(0x0050, 0x0B30, 19, 18, 22, 1, 0),
+    Glyph::new(0x0051, 0x0B6D, 24, 23, 29, 1, -7),
+    Glyph::new(0x0052, 0x0BD7, 22, 21, 23, 1, -1),
+    Glyph::new(0x0053, 0x0C28, 18, 16, 23, 1, -1),
+    Glyph::new(0x0054, 0x0C6C, 22, 21, 21, 0, 0),
+    Glyph::new(0x0055, 0x0CAE, 25, 24, 22, 0, -1),
+    Glyph::new(0x0056, 0x0D03, 24, 24, 22, 0, -1),
+    Glyph::new(0x0057, 0x0D56, 34, 33, 22, 0, -1),
+    Glyph::new(0x0058, 0x0DD7, 24, 23, 21, 0, 0),
+    Glyph::new(0x0059, 0x0E2F, 22, 22, 21, 0, 0),
+    Glyph::new(0x005A, 0x0E79, 19, 18, 22, 0, -1),
+    Glyph::new(0x005B, 0x0EC0, 11, 8, 29, 1, -5),
+    Glyph::new(0x005C, 0x0EF1, 16, 15, 24, 0, -2),
+    Glyph::new(0x005D, 0x0F25, 11, 8, 29, 1, -5),
+    Glyph::new(0x005E, 0x0F61, 19, 15, 15, 2, 5),
+    Glyph::new(0x005F, 0x0F8E, 15, 15, 4, 0, -5),
+    Glyph::new(0x0060, 0x0F9F, 21, 7, 8, 6, 18),
+    Glyph::new(0x0061, 0x0FAB, 18, 16, 18, 1, -1),
+    Glyph::new(0x0062, 0x0FE4, 19, 19, 25, -1, -1),
+    Glyph::new(0x0063, 0x1038, 16, 14, 18, 1, -1),
+    Glyph::new(0x0064, 0x1065, 19, 18, 25, 1, -1),
+    Glyph::new(0x0065, 0x10AF, 17, 15, 18, 1, -1),
+    Glyph::new(0x0066, 0x10DD, 13, 16, 24, 0, 0),
+    Glyph::new(0x0067, 0x111D, 19, 18, 25, 0, -8),
+    Glyph::new(0x0068, 0x1169, 20, 20, 24, 0, 0),
+    Glyph::new(0x0069, 0x11B5, 11, 11, 24, 0, 0),
+    Glyph::new(0x006A, 0x11DE, 10, 10, 32, -2, -8),
+    Glyph::new(0x006B, 0x121C, 20, 19, 25, 0, -1),
+    Glyph::new(0x006C, 0x1269, 11, 10, 24, 0, 0),
+    Glyph::new(0x006D, 0x1299, 30, 30, 17, 0, 0),
+    Glyph::new(0x006E, 0x12EF, 21, 20, 17, 0, 0),
+    Glyph::new(0x006F, 0x1332, 19, 17, 18, 1, -1),
+    Glyph::new(0x0070, 0x136E, 19, 18, 24, 0, -7),
+    Glyph::new(0x0071, 0x13BA, 18, 17, 24, 1, -7),
+    Glyph::new(0x0072, 0x1403, 15, 14, 17, 0, 0),
+    Glyph::new(0x0073, 0x142C, 16, 13, 18, 1, -1),
+    Glyph::new(0x0074, 0x1461, 13, 14, 21, -1, -1),
+    Glyph::new(0x0075, 0x1495, 20, 20, 17, 0, -1),
+    Glyph::new(0x0076, 0x14DA, 20, 20, 17, 0, -1),
+    Glyph::new(0x0077, 0x1515, 28, 27, 17, 0, -1),
+    Glyph::new(0x0078, 0x1572, 19, 19, 16, 0, 0),
+    Glyph::new(0x0079, 0x15AC, 20, 20, 24, 0, -8),
+    Glyph::new(0x007A, 0x15FA, 16, 15, 17, 0, -1),
+    Glyph::new(0x007B, 0x162E, 13, 11, 30, 1, -6),
+    Glyph::new(0x007C, 0x1669, 10, 5, 27, 2, -4),
+    Glyph::new(0x007D, 0x1693, 13, 11, 30, 0, -6),
+    Glyph::new(0x007E, 0x16CD, 19, 15, 6, 2, 7),
+    Glyph::new(0x00A1, 0x16E4, 9, 6, 24, 1, -7),
+    Glyph::new(0x00A2, 0x170D, 19, 16, 29, 1, -6),
+    Glyph::new(0x00A3, 0x175C, 19, 18, 22, 0, -1),
+    Glyph::new(0x00A4, 0x17A0, 19, 17, 15, 1, 3),
+    Glyph::new(0x00A5, 0x17D4, 19, 21, 21, -1, 0),
+    Glyph::new(0x00A7, 0x1824, 16, 14, 24, 1, -3),
+    Glyph::new(0x00A9, 0x1873, 24, 23, 23, 0, -1),
+    Glyph::new(0x00AA, 0x18E6, 14, 11, 16, 1, 6),
+    Glyph::new(0x00AB, 0x190C, 18, 17, 12, 0, 2),
+    Glyph::new(0x00AE, 0x1939, 18, 17, 17, 0, 7),
+    Glyph::new(0x00B0, 0x198E, 16, 12, 11, 2, 10),
+    Glyph::new(0x00B1, 0x19AD, 19, 14, 19, 2, -1),
+    Glyph::new(0x00B2, 0x19DE, 14, 12, 14, 1, 11),
+    Glyph::new(0x00B3, 0x1A01, 14, 11, 15, 1, 10),
+    Glyph::new(0x00B5, 0x1A26, 20, 20, 24, 1, -7),
+    Glyph::new(0x00B6, 0x1A7C, 18, 17, 26, 0, -5),
+    Glyph::new(0x00B7, 0x1AD8, 9, 7, 6, 1, 5),
+    Glyph::new(0x00B9, 0x1AE2, 14, 10, 14, 2, 11),
+    Glyph::new(0x00BA, 0x1AFA, 14, 11, 16, 1, 6),
+    Glyph::new(0x00BB, 0x1B21, 18, 16, 12, 1, 2),
+    Glyph::new(0x00BC, 0x1B4C, 33, 30, 26, 2, -3),
+    Glyph::new(0x00BD, 0x1BC8, 33, 30, 26, 2, -3),
+    Glyph::new(0x00BE, 0x1C3B, 33, 31, 26, 1, -3),
+    Glyph::new(0x00BF, 0x1CC1, 15, 12, 24, 1, -7),
+    Glyph::new(0x00C0, 0x1CF1, 24, 23, 30, 0, 0),
+    Glyph::new(0x00C1, 0x1D4A, 24, 23, 30, 0, 0),
+    Glyph::new(0x00C2, 0x1DA7, 24, 23, 29, 0, 0),
+    Glyph::new(0x00C3, 0x1E07, 24, 23, 29, 0, 0),
+    Glyph::new(0x00C4, 0x1E66, 24, 23, 28, 0, 0),
+    Glyph::new(0x00C5, 0x1EC5, 24, 23, 30, 0, 0),
+    Glyph::new(0x00C6, 0x1F2A, 30, 30, 21, -1, 0),
+    Glyph::new(0x00C7, 0x1F8E, 20, 18, 30, 1, -8),
+    Glyph::new(0x00C8, 0x1FE0, 20, 18, 30, 1, 0),
+    Glyph::new(0x00C9, 0x202E, 20, 18, 30, 1, 0),
+    Glyph::new(0x00CA, 0x207B, 20, 18, 29, 1, 0),
+    Glyph::new(0x00CB, 0x20CD, 20, 18, 28, 1, 0),
+    Glyph::new(0x00CC, 0x211F, 13, 11, 30, 1, 0),
+    Glyph::new(0x00CD, 0x2154, 13, 11, 30, 1, 0),
+    Glyph::new(0x00CE, 0x218B, 13, 12, 29, 0, 0),
+    Glyph::new(0x00CF, 0x21D1, 13, 12, 28, 0, 0),
+    Glyph::new(0x00D0, 0x2215, 24, 23, 23, 0, -1),
+    Glyph::new(0x00D1, 0x226D, 25, 25, 30, 0, -1),
+    Glyph::new(0x00D2, 0x22EC, 24, 22, 31, 1, -1),
+    Glyph::new(0x00D3, 0x2357, 24, 22, 31, 1, -1),
+    Glyph::new(0x00D4, 0x23C0, 24, 22, 30, 1, -1),
+    Glyph::new(0x00D5, 0x242E, 24, 22, 30, 1, -1),
+    Glyph::new(0x00D6, 0x2499, 24, 22, 29, 1, -1),
+    Glyph::new(0x00D7, 0x2506, 19, 13, 14, 3, 3),
+    Glyph::new(0x00D8, 0x252E, 24, 23, 23, 0, -1),
+    Glyph::new(0x00D9, 0x259A, 25, 24, 31, 0, -1),
+    Glyph::new(0x00DA, 0x2602, 25, 24, 31, 0, -1),
+    Glyph::new(0x00DB, 0x266B, 25, 24, 30, 0, -1),
+    Glyph::new(0x00DC, 0x26D7, 25, 24, 29, 0, -1),
+    Glyph::new(0x00DE, 0x2742, 20, 18, 21, 1, 0),
+    Glyph::new(0x00DF, 0x2782, 21, 19, 25, 0, -1),
+    Glyph::new(0x00E0, 0x27E3, 18, 16, 27, 1, -1),
+    Glyph::new(0x00E1, 0x282A, 18, 16, 27, 1, -1),
+    Glyph::new(0x00E2, 0x2873, 18, 16, 26, 1, -1),
+    Glyph::new(0x00E3, 0x28BF, 18, 16, 25, 1, -1),
+    Glyph::new(0x00E4, 0x290B, 18, 16, 24, 1, -1),
+    Glyph::new(0x00E5, 0x2953, 18, 16, 27, 1, -1),
+    Glyph::new(0x00E6, 0x29A4, 25, 23, 18, 1, -1),
+    Glyph::new(0x00E7, 0x29F3, 16, 14, 25, 1, -8),
+    Glyph::new(0x00E8, 0x2A31, 17, 15, 27, 1, -1),
+    Glyph::new(0x00E9, 0x2A6E, 17, 15, 27, 1, -1),
+    Glyph::new(0x00EA, 0x2AAB, 17, 15, 26, 1, -1),
+    Glyph::new(0x00EB, 0x2AEC, 17, 15, 24, 1, -1),
+    Glyph::new(0x00EC, 0x2B2A, 11, 11, 26, 0, 0),
+    Glyph::new(0x00ED, 0x2B56, 11, 11, 26, 0, 0),
+    Glyph::new(0x00EE, 0x2B81, 11, 11, 25, 0, 0),
+    Glyph::new(0x00EF, 0x2BB0, 11, 11, 23, 0, 0),
+    Glyph::new(0x00F0, 0x2BDC, 19, 16, 26, 1, -1),
+    Glyph::new(0x00F1, 0x2C27, 21, 20, 24, 0, 0),
+    Glyph::new(0x00F2, 0x2C7D, 19, 17, 27, 1, -1),
+    Glyph::new(0x00F3, 0x2CC9, 19, 17, 27, 1, -1),
+    Glyph::new(0x00F4, 0x2D14, 19, 17, 26, 1, -1),
+    Glyph::new(0x00F5, 0x2D65, 19, 17, 25, 1, -1),
+    Glyph::new(0x00F6, 0x2DB4, 19, 17, 24, 1, -1),
+    Glyph::new(0x00F7, 0x2E00, 19, 14, 14, 2, 3),
+    Glyph::new(0x00F8, 0x2E21, 19, 18, 18, 0, -1),
+    Glyph::new(0x00F9, 0x2E62, 20, 20, 27, 0, -1),
+    Glyph::new(0x00FA, 0x2EB8, 20, 20, 27, 0, -1),
+    Glyph::new(0x00FB, 0x2F0D, 20, 20, 26, 0, -1),
+    Glyph::new(0x00FC, 0x2F68, 20, 20, 24, 0, -1),
+    Glyph::new(0x00FE, 0x2FC1, 19, 18, 31, 0, -7),
+    Glyph::new(0x00FF, 0x301A, 20, 20, 31, 0, -8),
+    Glyph::new(0x0104, 0x307B, 24, 23, 29, 0, -7),
+    Glyph::new(0x0105, 0x30D6, 18, 16, 24, 1, -7),
+    Glyph::new(0x0106, 0x3119, 20, 18, 31, 1, -1),
+    Glyph::new(0x0107, 0x3169, 16, 14, 27, 1, -1),
+    Glyph::new(0x010C, 0x31A5, 20, 18, 30, 1, -1),
+    Glyph::new(0x010D, 0x31F8, 16, 14, 26, 1, -1),
+    Glyph::new(0x010E, 0x323B, 24, 22, 30, 1, -1),
+    Glyph::new(0x010F, 0x329C, 20, 21, 25, 1, -1),
+    Glyph::new(0x0118, 0x32F4, 20, 18, 28, 1, -7),
+    Glyph::new(0x0119, 0x333E, 17, 15, 24, 1, -7),
+    Glyph::new(0x011A, 0x337B, 20, 18, 29, 1, 0),
+    Glyph::new(0x011B, 0x33CE, 17, 15, 26, 1, -1),
+    Glyph::new(0x0139, 0x3412, 19, 18, 30, 1, 0),
+    Glyph::new(0x013A, 0x345B, 11, 10, 31, 0, 0),
+    Glyph::new(0x013D, 0x3498, 19, 18, 24, 1, 0),
+    Glyph::new(0x013E, 0x34DD, 12, 14, 24, 0, 0),
+    Glyph::new(0x0141, 0x3517, 19, 20, 21, -1, 0),
+    Glyph::new(0x0142, 0x3557, 11, 12, 24, -1, 0),
+    Glyph::new(0x0143, 0x358C, 25, 25, 31, 0, -1),
+    Glyph::new(0x0144, 0x3607, 21, 20, 26, 0, 0),
+    Glyph::new(0x0147, 0x365B, 25, 25, 30, 0, -1),
+    Glyph::new(0x0148, 0x36DB, 21, 20, 25, 0, 0),
+    Glyph::new(0x0152, 0x3734, 31, 29, 22, 1, -1),
+    Glyph::new(0x0153, 0x37A2, 28, 26, 18, 1, -1),
+    Glyph::new(0x0158, 0x37F4, 22, 21, 30, 1, -1),
+    Glyph::new(0x0159, 0x3859, 15, 14, 25, 0, 0),
+    Glyph::new(0x015A, 0x3897, 18, 16, 31, 1, -1),
+    Glyph::new(0x015B, 0x38EB, 16, 13, 27, 1, -1),
+    Glyph::new(0x0160, 0x392E, 18, 16, 30, 1, -1),
+    Glyph::new(0x0161, 0x3987, 16, 13, 26, 1, -1),
+    Glyph::new(0x0164, 0x39D2, 22, 21, 29, 0, 0),
+    Glyph::new(0x0165, 0x3A2B, 13, 14, 25, -1, -1),
+    Glyph::new(0x016E, 0x3A69, 25, 24, 31, 0, -1),
+    Glyph::new(0x016F, 0x3ADB, 20, 20, 27, 0, -1),
+    Glyph::new(0x0170, 0x3B39, 25, 24, 31, 0, -1),
+    Glyph::new(0x0171, 0x3BAB, 20, 20, 27, 0, -1),
+    Glyph::new(0x0178, 0x3C0C, 22, 22, 28, 0, 0),
+    Glyph::new(0x0179, 0x3C6D, 19, 18, 31, 0, -1),
+    Glyph::new(0x017A, 0x3CC5, 16, 15, 27, 0, -1),
+    Glyph::new(0x017B, 0x3D08, 19, 18, 30, 0, -1),
+    Glyph::new(0x017C, 0x3D5D, 16, 15, 25, 0, -1),
+    Glyph::new(0x017D, 0x3D9E, 19, 18, 30, 0, -1),
+    Glyph::new(0x017E, 0x3DFB, 16, 15, 26, 0, -1),
+    Glyph::new(0x03C0, 0x3E46, 21, 21, 18, 0, -1),
+    Glyph::new(0x1E9E, 0x3E8D, 23, 22, 23, 0, -1),
+    Glyph::new(0x2013, 0x3EEB, 15, 15, 4, 0, 6),
+    Glyph::new(0x2014, 0x3EFC, 30, 30, 4, 0, 6),
+    Glyph::new(0x2018, 0x3F1E, 8, 6, 11, 1, 12),
+    Glyph::new(0x2019, 0x3F2E, 8, 7, 11, 0, 12),
+    Glyph::new(0x201A, 0x3F3F, 8, 7, 10, 0, -6),
+    Glyph::new(0x201B, 0x3F50, 8, 6, 11, 1, 12),
+    Glyph::new(0x201C, 0x3F5F, 14, 12, 11, 1, 12),
+    Glyph::new(0x201D, 0x3F7E, 14, 13, 11, 0, 12),
+    Glyph::new(0x201E, 0x3F9F, 14, 13, 10, 0, -6),
+    Glyph::new(0x201F, 0x3FC1, 14, 12, 11, 1, 12),
+    Glyph::new(0x2020, 0x3FDD, 15, 14, 20, 0, 2),
+    Glyph::new(0x2021, 0x400D, 15, 15, 24, 0, -2),
+    Glyph::new(0x2022, 0x404D, 9, 7, 8, 1, 4),
+    Glyph::new(0x2026, 0x405B, 30, 26, 6, 2, -1),
+    Glyph::new(0x2039, 0x407D, 11, 9, 12, 0, 2),
+    Glyph::new(0x203A, 0x4093, 11, 9, 12, 1, 2),
+    Glyph::new(0x2070, 0x40AA, 14, 13, 15, 0, 10),
+    Glyph::new(0x2074, 0x40D5, 14, 13, 15, 0, 10),
+    Glyph::new(0x2075, 0x40FF, 14, 11, 15, 1, 10),
+    Glyph::new(0x2076, 0x4124, 14, 12, 15, 1, 10),
+    Glyph::new(0x2077, 0x414D, 14, 12, 15, 1, 10),
+    Glyph::new(0x2078, 0x4170, 14, 11, 15, 1, 10),
+    Glyph::new(0x2079, 0x419A, 14, 12, 15, 1, 10),
+    Glyph::new(0x2080, 0x41C0, 14, 13, 15, 0, -5),
+    Glyph::new(0x2081, 0x41EB, 14, 10, 14, 2, -4),
+    Glyph::new(0x2082, 0x4204, 14, 12, 14, 1, -4),
+    Glyph::new(0x2083, 0x4226, 14, 11, 15, 1, -5),
+    Glyph::new(0x2084, 0x424C, 14, 13, 15, 0, -5),
+    Glyph::new(0x2085, 0x4277, 14, 11, 15, 1, -5),
+    Glyph::new(0x2086, 0x429D, 14, 12, 15, 1, -5),
+    Glyph::new(0x2087, 0x42C6, 14, 12, 15, 1, -5),
+    Glyph::new(0x2088, 0x42E8, 14, 11, 15, 1, -5),
+    Glyph::new(0x2089, 0x4310, 14, 12, 15, 1, -5),
+    Glyph::new(0x20AC, 0x4338, 19, 19, 22, 0, -1),
+    Glyph::new(0x2122, 0x437E, 26, 25, 11, 0, 10),
+    Glyph::new(0x2153, 0x43C6, 33, 29, 26, 2, -3),
+    Glyph::new(0x2154, 0x443A, 33, 30, 26, 1, -3),
+    Glyph::new(0x215B, 0x44BA, 33, 29, 26, 2, -3),
+    Glyph::new(0x215C, 0x4533, 33, 30, 26, 1, -3),
+    Glyph::new(0x215D, 0x45B4, 33, 30, 26, 1, -3),
+    Glyph::new(0x215E, 0x4637, 33, 30, 26, 1, -3),
+    Glyph::new(0x2190, 0x46BA, 30, 20, 15, 5, 3),
+    Glyph::new(0x2191, 0x46DE, 30, 14, 20, 8, 0),
+    Glyph::new(0x2192, 0x4712, 30, 20, 15, 5, 3),
+    Glyph::new(0x2193, 0x4737, 30, 14, 20, 8, 0),
+    Glyph::new(0x2194, 0x4771, 30, 20, 13, 5, 4),
+    Glyph::new(0x2195, 0x479D, 30, 14, 21, 8, 0),
+    Glyph::new(0x21D0, 0x47DC, 30, 20, 17, 5, 2),
+    Glyph::new(0x21D1, 0x4813, 30, 18, 19, 6, 1),
+    Glyph::new(0x21D2, 0x4853, 30, 20, 17, 5, 2),
+    Glyph::new(0x21D3, 0x488C, 30, 18, 19, 6, 1),
+    Glyph::new(0x21D4, 0x48D2, 30, 20, 15, 5, 3),
+    Glyph::new(0x2202, 0x4911, 19, 16, 25, 1, -1),
+    Glyph::new(0x2206, 0x495F, 21, 20, 22, 0, 0),
+    Glyph::new(0x220F, 0x49AB, 26, 24, 26, 1, -5),
+    Glyph::new(0x2211, 0x4A23, 20, 19, 26, 1, -5),
+    Glyph::new(0x221A, 0x4A77, 19, 20, 29, -1, -4),
+    Glyph::new(0x221E, 0x4AC7, 19, 19, 11, 0, 4),
+    Glyph::new(0x222B, 0x4AFD, 19, 17, 32, 1, -8),
+    Glyph::new(0x2260, 0x4B3F, 19, 14, 16, 2, 2),
+    Glyph::new(0x2264, 0x4B69, 19, 14, 18, 2, 0),
+    Glyph::new(0x2265, 0x4B94, 19, 14, 19, 2, 0),
+    Glyph::new(0xFB01, 0x4BBF, 24, 24, 24, 0, 0),
+    Glyph::new(0xFB02, 0x4C16, 24, 23, 24, 0, 0),
 ];
 
-const BITMAP_BW: &[u8; 14040] = include_bytes!("./bookerly_bold_30.bw");
-const BITMAP_MSB: &[u8; 14040] = include_bytes!("./bookerly_bold_30.msb");
-const BITMAP_LSB: &[u8; 14040] = include_bytes!("./bookerly_bold_30.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 13), (18, 13), (19, 15),
+    (20, 13), (21, 13), (22, 16), (23, 13), (24, 13), (25, 17), (26, 18), (27, 19),
+    (28, 13), (29, 20), (30, 13), (31, 21), (32, 22), (33, 23), (34, 24), (35, 25),
+    (36, 26), (35, 27), (37, 28), (38, 29), (0, 0), (39, 30), (0, 0), (0, 0),
+    (0, 0), (40, 31), (41, 32), (42, 33), (43, 34), (44, 33), (45, 35), (46, 36),
+    (47, 37), (48, 38), (49, 39), (50, 37), (48, 40), (47, 41), (47, 41), (51, 33),
+    (52, 42), (53, 33), (54, 35), (55, 43), (56, 44), (57, 45), (58, 46), (59, 47),
+    (60, 48), (61, 49), (62, 50), (38, 51), (0, 0), (63, 30), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (64, 52), (65, 53),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (66, 54), (0, 0), (0, 0),
+    (0, 0), (67, 55), (68, 56), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (69, 57), (15, 14), (17, 13),
+    (17, 13), (17, 13), (17, 13), (21, 13), (21, 13), (21, 58), (21, 58), (16, 59),
+    (26, 18), (27, 19), (27, 19), (27, 19), (27, 19), (27, 19), (0, 0), (70, 60),
+    (33, 23), (33, 23), (33, 23), (33, 23), (71, 61), (72, 62), (40, 63), (40, 31),
+    (73, 63), (73, 64), (74, 64), (40, 63), (75, 31), (76, 33), (44, 65), (44, 33),
+    (77, 66), (77, 67), (78, 68), (79, 41), (80, 69), (80, 70), (81, 33), (47, 41),
+    (51, 33), (51, 33), (82, 66), (82, 71), (83, 71), (0, 0), (84, 72), (57, 45),
+    (57, 45), (85, 45), (85, 73), (52, 74), (61, 75), (86, 12), (87, 31), (15, 14),
+    (88, 33), (15, 14), (89, 71), (16, 13), (90, 34), (17, 13), (91, 33), (17, 13),
+    (92, 71), (24, 13), (48, 40), (93, 13), (94, 40), (24, 76), (95, 77), (26, 18),
+    (47, 41), (26, 18), (47, 41), (96, 78), (44, 33), (30, 13), (97, 35), (31, 21),
+    (55, 43), (31, 21), (98, 79), (32, 22), (99, 44), (33, 23), (57, 45), (33, 23),
+    (85, 45), (35, 27), (37, 28), (62, 50), (37, 28), (62, 50), (37, 28), (62, 80),
+    (60, 81), (100, 82), (101, 83), (101, 83), (102, 84), (103, 85), (104, 86), (0, 0),
+    (102, 84), (103, 85), (104, 86), (0, 0), (0, 0), (0, 0), (0, 0), (105, 87),
+    (106, 53), (107, 56), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (48, 35), (48, 35),
+];
+
+const KERNING: [&[i8]; 108] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, -1, -2, 0, 0, -2, -2, -1, -2, 0, -1, -1, 0, -2, -2, 0, -1, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, -2, -2, -1, 0, 0, -1, 0, 0, -1, 0, -1, -2, -2, -2, -2, -1, 0, -1, -2, -1, -2, -1, -1, -2, -1, 0, 0, -1, 0, -1, -2, -1, -2, -2, -1, 0, -1, 0, -2, -1, -2, 0, 0, 0, 0, -2, -1, -1, -2, -1, -2, -1, 0, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -1, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, -1, -2, 0, 0, -2, -1, -1, 0, 0, -1, -2, -1, -2, -2, -2, -2, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -2, -1, -1, 0, 0, -1, -1, -1, -2, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -2, 0, 0, 0, -1, -1, -2, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, 0, -2, -2, 0, 0, -1, 0, -1, -1, -1, -1, -2, -1, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, -1, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, -2, -2, -2, -2, -2, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, -2, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, -1, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, -1, -1, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -2, -1, 0, -1, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, -1, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -2, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -2, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -1, -1, 0, -2, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -2, -2, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -2, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, -2, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -2, -1, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2, 0, -2, -2, 0, 0, -1, 0, -1, -1, -1, -2, -1, -1, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, -2, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, 0, -2, -2, 0, -2, -2, 0, 0, -1, 0, -1, -1, -1, -2, -1, -1, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, -2, -1, -1, -1, -2, -2, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, -1, 0, -2, -1, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, -1, -2, 0, 0, -2, -2, -2, -2, 0, -1, -1, 0, -2, -2, 0, -1, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, -2, -2, -1, 0, 0, -1, 0, 0, -2, 0, -2, -1, -1, -2, -2, -1, 0, -2, -2, -1, -2, -1, -1, -2, -1, 0, 0, -2, 0, -1, -2, -1, -2, -2, -1, 0, -1, 0, -2, -2, -1, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, -2],
+    &[0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, -1, -1, -1, -2, -1, 0, -1, -1, -2, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, 0, -2, -1, -1, 0, 0, 0, -1, -1, -2, -2, -1, -2, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -2, -2, -2, -1, 0, 0, -2, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, 0, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -2, -1, -2, -2, -1, -2, -2, -1, -1, -2, -1, -2, -1, -1, -1, -2, -2, -1, -1, -2, -2, -1, -1, -2, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -1, -1, -1, -1, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -2, 0, 0, -1, -1, -1, 0, -1, 0, -2, -2, -2, -2],
+    &[0, -1, -1, 0, -2, 0, -1, 0, -2, -1, -1, -2, -2, -1, 0, 0, -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0],
+    &[0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, -1, -1, 0, -1, 0, -2, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -2, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -2, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, -2, -2, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -2, 0, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -2, 0, 0, -1, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -2, -2, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, 0, -2, -1, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, 0, -2, -1, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1],
+    &[0, -1, -1, 0, -1, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -2, 0, -1, -1, -1, -1, -2, -1, -1, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -2, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -2, -2, 0, 0],
+    &[0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -1, 0, 0, -2, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -2, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, -1, -2, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, -2, 0, -2, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, -2, -1, -2, -1, 0, -1, -2, 0, 0, -1, 0, -1, -1, -1, -2, -2, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, 0, -1, -2, -1, 0, -1, -1, -1, -1, -2, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -2, -2, -2, -2, 0, -2, 0, -1, -2, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -2, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1],
+    &[0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -2, -2, -2, -2, -1, -2, 0, 0, -2, -1, -1, 0, 0, -1, -2, -1, -2, -2, -2, -2, -1, -1, -2, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -2, -1, -1, 0, 0, -1, -1, -1, -2, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, 0, -2, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 19575] = include_bytes!("./bookerly_bold_30.rle");
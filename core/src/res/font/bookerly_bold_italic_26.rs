@@ -1,308 +1,526 @@
 // Auto-generated font file
 // Font: Bookerly Bold Italic
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 11292,
+    size: 16461,
     y_advance: 26,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 6, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 9, 8, 21, 1, -1),
-    Glyph::new(0x0022, 0x0015, 11, 10, 9, 1, 10),
-    Glyph::new(0x0023, 0x0021, 17, 17, 17, 0, -2),
-    Glyph::new(0x0024, 0x0046, 17, 14, 26, 1, -5),
-    Glyph::new(0x0025, 0x0074, 26, 24, 22, 1, -2),
-    Glyph::new(0x0026, 0x00B6, 23, 21, 21, 1, -2),
-    Glyph::new(0x0027, 0x00EE, 6, 6, 9, 1, 10),
-    Glyph::new(0x0028, 0x00F5, 11, 12, 27, 0, -6),
-    Glyph::new(0x0029, 0x011E, 11, 12, 27, -2, -6),
-    Glyph::new(0x002A, 0x0147, 11, 10, 10, 1, 10),
-    Glyph::new(0x002B, 0x0154, 17, 12, 13, 2, 2),
-    Glyph::new(0x002C, 0x0168, 9, 7, 9, -1, -5),
-    Glyph::new(0x002D, 0x0170, 11, 9, 4, 1, 5),
-    Glyph::new(0x002E, 0x0175, 9, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x0179, 14, 16, 21, -1, -2),
-    Glyph::new(0x0030, 0x01A3, 17, 16, 20, 0, -1),
-    Glyph::new(0x0031, 0x01CB, 17, 12, 19, 1, 0),
-    Glyph::new(0x0032, 0x01E8, 17, 16, 19, 0, 0),
-    Glyph::new(0x0033, 0x020E, 17, 15, 20, 0, -1),
-    Glyph::new(0x0034, 0x0234, 17, 16, 19, 0, 0),
-    Glyph::new(0x0035, 0x025A, 17, 16, 19, 0, -1),
-    Glyph::new(0x0036, 0x0280, 17, 16, 20, 1, -1),
-    Glyph::new(0x0037, 0x02A8, 17, 15, 19, 2, -1),
-    Glyph::new(0x0038, 0x02CC, 17, 16, 20, 0, -1),
-    Glyph::new(0x0039, 0x02F4, 17, 17, 20, -1, -1),
-    Glyph::new(0x003A, 0x031F, 9, 7, 15, 1, -1),
-    Glyph::new(0x003B, 0x032D, 9, 9, 19, -1, -5),
-    Glyph::new(0x003C, 0x0343, 17, 12, 13, 2, 2),
-    Glyph::new(0x003D, 0x0357, 17, 12, 8, 2, 5),
-    Glyph::new(0x003E, 0x0363, 17, 12, 13, 2, 2),
-    Glyph::new(0x003F, 0x0377, 11, 9, 20, 2, -1),
-    Glyph::new(0x0040, 0x038E, 26, 24, 25, 1, -6),
-    Glyph::new(0x0041, 0x03D9, 20, 21, 19, -2, 0),
-    Glyph::new(0x0042, 0x040B, 17, 17, 20, -1, -1),
-    Glyph::new(0x0043, 0x0436, 18, 17, 20, 0, -1),
-    Glyph::new(0x0044, 0x0461, 20, 20, 20, -1, -1),
-    Glyph::new(0x0045, 0x0493, 17, 18, 19, -1, 0),
-    Glyph::new(0x0046, 0x04BE, 16, 17, 19, -1, 0),
-    Glyph::new(0x0047, 0x04E7, 19, 18, 20, 0, -1),
-    Glyph::new(0x0048, 0x0514, 21, 23, 19, -1, 0),
-    Glyph::new(0x0049, 0x054B, 11, 13, 19, -1, 0),
-    Glyph::new(0x004A, 0x056A, 10, 17, 25, -5, -6),
-    Glyph::new(0x004B, 0x05A0, 19, 21, 20, -1, -1),
-    Glyph::new(0x004C, 0x05D5, 16, 16, 19, -1, 0),
-    Glyph::new(0x004D, 0x05FB, 24, 26, 19, -2, 0),
-    Glyph::new(0x004E, 0x0639, 21, 23, 20, -1, -1),
-    Glyph::new(0x004F, 0x0673, 20, 19, 20, 0, -1),
-    Glyph::new(0x0050, 0x06A3, 16, 17, 19, -1, 0),
-    Glyph::new(0x0051, 0x06CC, 20, 22, 25, 0, -6),
-    Glyph::new(0x0052, 0x0711, 18, 18, 20, -1, -1),
-    Glyph::new(0x0053, 0x073E, 15, 15, 20, -1, -1),
-    Glyph::new(0x0054, 0x0764, 18, 18, 19, 1, 0),
-    Glyph::new(0x0055, 0x078F, 21, 20, 20, 2, -1),
-    Glyph::new(0x0056, 0x07C1, 20, 20, 20, 1, -1),
-    Glyph::new(0x0057, 0x07F3, 26, 27, 20, 1, -1),
-    Glyph::new(0x0058, 0x0837, 18, 22, 19, -3, 0),
-    Glyph::new(0x0059, 0x086C, 18, 18, 19, 1, 0),
-    Glyph::new(0x005A, 0x0897, 17, 17, 20, -1, -1),
-    Glyph::new(0x005B, 0x08C2, 9, 12, 26, -2, -5),
-    Glyph::new(0x005C, 0x08E9, 14, 11, 21, 1, -2),
-    Glyph::new(0x005D, 0x0906, 9, 13, 26, -2, -5),
-    Glyph::new(0x005E, 0x0931, 17, 14, 13, 1, 4),
-    Glyph::new(0x005F, 0x0948, 13, 13, 3, 0, -4),
-    Glyph::new(0x0060, 0x094D, 17, 6, 7, 5, 15),
-    Glyph::new(0x0061, 0x0953, 16, 16, 15, 0, -1),
-    Glyph::new(0x0062, 0x0971, 15, 14, 22, 0, -1),
-    Glyph::new(0x0063, 0x0998, 12, 12, 15, 0, -1),
-    Glyph::new(0x0064, 0x09AF, 16, 16, 22, 0, -1),
-    Glyph::new(0x0065, 0x09DB, 13, 12, 15, 0, -1),
-    Glyph::new(0x0066, 0x09F2, 12, 20, 28, -5, -7),
-    Glyph::new(0x0067, 0x0A38, 14, 18, 21, -2, -7),
-    Glyph::new(0x0068, 0x0A68, 16, 15, 22, 0, -1),
-    Glyph::new(0x0069, 0x0A92, 9, 9, 21, 0, -1),
-    Glyph::new(0x006A, 0x0AAA, 9, 15, 27, -6, -7),
-    Glyph::new(0x006B, 0x0ADD, 14, 14, 22, 0, -1),
-    Glyph::new(0x006C, 0x0B04, 9, 8, 22, 0, -1),
-    Glyph::new(0x006D, 0x0B1A, 23, 23, 15, 0, -1),
-    Glyph::new(0x006E, 0x0B46, 17, 16, 15, 0, -1),
-    Glyph::new(0x006F, 0x0B64, 15, 14, 15, 0, -1),
-    Glyph::new(0x0070, 0x0B7F, 15, 17, 20, -2, -6),
-    Glyph::new(0x0071, 0x0BAA, 15, 15, 20, 0, -6),
-    Glyph::new(0x0072, 0x0BD0, 13, 13, 14, 0, 0),
-    Glyph::new(0x0073, 0x0BE7, 12, 12, 15, -1, -1),
-    Glyph::new(0x0074, 0x0BFE, 11, 12, 19, 0, -1),
-    Glyph::new(0x0075, 0x0C1B, 16, 16, 15, 0, -1),
-    Glyph::new(0x0076, 0x0C39, 14, 14, 15, 0, -1),
-    Glyph::new(0x0077, 0x0C54, 20, 20, 15, 0, -1),
-    Glyph::new(0x0078, 0x0C7A, 15, 16, 15, -1, -1),
-    Glyph::new(0x0079, 0x0C98, 14, 18, 21, -4, -7),
-    Glyph::new(0x007A, 0x0CC8, 13, 14, 15, -1, -1),
-    Glyph::new(0x007B, 0x0CE3, 11, 11, 26, 1, -5),
-    Glyph::new(0x007C, 0x0D07, 8, 9, 24, -1, -4),
-    Glyph::new(0x007D, 0x0D22, 11, 12, 26, -2, -5),
-    Glyph::new(0x007E, 0x0D49, 17, 14, 6, 1, 6),
-    Glyph::new(0x00A1, 0x0D54, 9, 9, 21, -1, -7),
-    Glyph::new(0x00A2, 0x0D6C, 17, 14, 25, 1, -5),
-    Glyph::new(0x00A3, 0x0D98, 17, 18, 20, -1, -1),
-    Glyph::new(0x00A4, 0x0DC5, 17, 16, 13, 0, 2),
-    Glyph::new(0x00A5, 0x0DDF, 17, 18, 18, 1, 0),
-    Glyph::new(0x00A7, 0x0E08, 14, 13, 21, -1, -3),
-    Glyph::new(0x00A9, 0x0E2B, 21, 20, 20, 0, -1),
-    Glyph::new(0x00AA, 0x0E5D, 12, 11, 13, 1, 6),
-    Glyph::new(0x00AB, 0x0E6F, 16, 16, 11, 0, 1),
-    Glyph::new(0x00AE, 0x0E85, 16, 15, 15, 0, 6),
-    Glyph::new(0x00B0, 0x0EA2, 14, 10, 11, 2, 8),
-    Glyph::new(0x00B1, 0x0EB0, 17, 12, 17, 2, -1),
-    Glyph::new(0x00B2, 0x0ECA, 12, 11, 13, 0, 9),
-    Glyph::new(0x00B3, 0x0EDC, 12, 10, 13, 1, 9),
-    Glyph::new(0x00B5, 0x0EED, 17, 17, 21, -1, -7),
-    Glyph::new(0x00B6, 0x0F1A, 16, 18, 23, -1, -4),
-    Glyph::new(0x00B7, 0x0F4E, 9, 6, 5, 1, 5),
-    Glyph::new(0x00B9, 0x0F52, 12, 8, 13, 1, 9),
-    Glyph::new(0x00BA, 0x0F5F, 12, 10, 13, 1, 6),
-    Glyph::new(0x00BB, 0x0F70, 16, 15, 11, 0, 1),
-    Glyph::new(0x00BC, 0x0F85, 28, 27, 22, 1, -2),
-    Glyph::new(0x00BD, 0x0FD0, 28, 26, 22, 1, -2),
-    Glyph::new(0x00BE, 0x1018, 28, 27, 22, 1, -2),
-    Glyph::new(0x00BF, 0x1063, 11, 9, 20, 0, -6),
-    Glyph::new(0x00C0, 0x107A, 20, 21, 26, -2, 0),
-    Glyph::new(0x00C1, 0x10BF, 20, 21, 26, -2, 0),
-    Glyph::new(0x00C2, 0x1104, 20, 21, 26, -2, 0),
-    Glyph::new(0x00C3, 0x1149, 20, 21, 25, -2, 0),
-    Glyph::new(0x00C4, 0x118B, 20, 21, 24, -2, 0),
-    Glyph::new(0x00C5, 0x11CA, 20, 21, 26, -2, 0),
-    Glyph::new(0x00C6, 0x120F, 25, 27, 19, -2, 0),
-    Glyph::new(0x00C7, 0x1250, 18, 17, 26, 0, -7),
-    Glyph::new(0x00C8, 0x1288, 17, 18, 26, -1, 0),
-    Glyph::new(0x00C9, 0x12C3, 17, 18, 26, -1, 0),
-    Glyph::new(0x00CA, 0x12FE, 17, 18, 26, -1, 0),
-    Glyph::new(0x00CB, 0x1339, 17, 18, 24, -1, 0),
-    Glyph::new(0x00CC, 0x136F, 11, 13, 26, -1, 0),
-    Glyph::new(0x00CD, 0x139A, 11, 13, 26, -1, 0),
-    Glyph::new(0x00CE, 0x13C5, 11, 13, 26, -1, 0),
-    Glyph::new(0x00CF, 0x13F0, 11, 14, 24, -1, 0),
-    Glyph::new(0x00D0, 0x141A, 20, 20, 20, -1, -1),
-    Glyph::new(0x00D1, 0x144C, 21, 23, 26, -1, -1),
-    Glyph::new(0x00D2, 0x1497, 20, 19, 27, 0, -1),
-    Glyph::new(0x00D3, 0x14D8, 20, 19, 27, 0, -1),
-    Glyph::new(0x00D4, 0x1519, 20, 19, 27, 0, -1),
-    Glyph::new(0x00D5, 0x155A, 20, 19, 26, 0, -1),
-    Glyph::new(0x00D6, 0x1598, 20, 19, 25, 0, -1),
-    Glyph::new(0x00D7, 0x15D4, 17, 12, 12, 2, 3),
-    Glyph::new(0x00D8, 0x15E6, 20, 21, 20, -1, -1),
-    Glyph::new(0x00D9, 0x161B, 21, 20, 27, 2, -1),
-    Glyph::new(0x00DA, 0x165F, 21, 20, 27, 2, -1),
-    Glyph::new(0x00DB, 0x16A3, 21, 20, 27, 2, -1),
-    Glyph::new(0x00DC, 0x16E7, 21, 20, 25, 2, -1),
-    Glyph::new(0x00DE, 0x1726, 16, 17, 19, -1, 0),
-    Glyph::new(0x00DF, 0x174F, 17, 21, 28, -5, -7),
-    Glyph::new(0x00E0, 0x1799, 16, 16, 23, 0, -1),
-    Glyph::new(0x00E1, 0x17C7, 16, 16, 24, 0, -1),
-    Glyph::new(0x00E2, 0x17F7, 16, 16, 23, 0, -1),
-    Glyph::new(0x00E3, 0x1825, 16, 16, 22, 0, -1),
-    Glyph::new(0x00E4, 0x1851, 16, 16, 21, 0, -1),
-    Glyph::new(0x00E5, 0x187B, 16, 16, 23, 0, -1),
-    Glyph::new(0x00E6, 0x18A9, 21, 20, 15, 0, -1),
-    Glyph::new(0x00E7, 0x18CF, 12, 12, 21, 0, -7),
-    Glyph::new(0x00E8, 0x18EF, 13, 12, 23, 0, -1),
-    Glyph::new(0x00E9, 0x1912, 13, 13, 24, 0, -1),
-    Glyph::new(0x00EA, 0x1939, 13, 13, 23, 0, -1),
-    Glyph::new(0x00EB, 0x195F, 13, 13, 21, 0, -1),
-    Glyph::new(0x00EC, 0x1982, 9, 8, 23, 0, -1),
-    Glyph::new(0x00ED, 0x1999, 9, 11, 24, 0, -1),
-    Glyph::new(0x00EE, 0x19BA, 9, 11, 23, 0, -1),
-    Glyph::new(0x00EF, 0x19DA, 9, 11, 21, 0, -1),
-    Glyph::new(0x00F0, 0x19F7, 15, 14, 22, 0, -1),
-    Glyph::new(0x00F1, 0x1A1E, 17, 16, 22, 0, -1),
-    Glyph::new(0x00F2, 0x1A4A, 15, 14, 23, 0, -1),
-    Glyph::new(0x00F3, 0x1A73, 15, 14, 24, 0, -1),
-    Glyph::new(0x00F4, 0x1A9D, 15, 14, 23, 0, -1),
-    Glyph::new(0x00F5, 0x1AC6, 15, 15, 22, 0, -1),
-    Glyph::new(0x00F6, 0x1AF0, 15, 15, 21, 0, -1),
-    Glyph::new(0x00F7, 0x1B18, 17, 12, 13, 2, 2),
-    Glyph::new(0x00F8, 0x1B2C, 15, 18, 16, -2, -1),
-    Glyph::new(0x00F9, 0x1B50, 16, 16, 23, 0, -1),
-    Glyph::new(0x00FA, 0x1B7E, 16, 16, 24, 0, -1),
-    Glyph::new(0x00FB, 0x1BAE, 16, 16, 23, 0, -1),
-    Glyph::new(0x00FC, 0x1BDC, 16, 16, 21, 0, -1),
-    Glyph::new(0x00FE, 0x1C06, 15, 17, 27, -3, -6),
-    Glyph::new(0x00FF, 0x1C40, 14, 18, 27, -4, -7),
-    Glyph::new(0x0104, 0x1C7D, 20, 21, 25, -2, -6),
-    Glyph::new(0x0105, 0x1CBF, 16, 16, 20, 0, -6),
-    Glyph::new(0x0106, 0x1CE7, 18, 17, 27, 0, -1),
-    Glyph::new(0x0107, 0x1D21, 12, 13, 24, 0, -1),
-    Glyph::new(0x010C, 0x1D48, 18, 18, 27, 0, -1),
-    Glyph::new(0x010D, 0x1D85, 12, 14, 23, 0, -1),
-    Glyph::new(0x010E, 0x1DAE, 20, 20, 27, -1, -1),
-    Glyph::new(0x010F, 0x1DF2, 17, 20, 22, 0, -1),
-    Glyph::new(0x0118, 0x1E29, 17, 18, 25, -1, -6),
-    Glyph::new(0x0119, 0x1E62, 13, 12, 20, 0, -6),
-    Glyph::new(0x011A, 0x1E80, 17, 18, 26, -1, 0),
-    Glyph::new(0x011B, 0x1EBB, 13, 14, 23, 0, -1),
-    Glyph::new(0x0139, 0x1EE4, 16, 16, 26, -1, 0),
-    Glyph::new(0x013A, 0x1F18, 9, 10, 28, 0, -1),
-    Glyph::new(0x013D, 0x1F3B, 16, 17, 21, -1, 0),
-    Glyph::new(0x013E, 0x1F68, 10, 13, 22, 0, -1),
-    Glyph::new(0x0141, 0x1F8C, 16, 16, 19, -1, 0),
-    Glyph::new(0x0142, 0x1FB2, 9, 11, 22, -1, -1),
-    Glyph::new(0x0143, 0x1FD1, 21, 23, 27, -1, -1),
-    Glyph::new(0x0144, 0x201F, 17, 16, 24, 0, -1),
-    Glyph::new(0x0147, 0x204F, 21, 23, 27, -1, -1),
-    Glyph::new(0x0148, 0x209D, 17, 16, 23, 0, -1),
-    Glyph::new(0x0152, 0x20CB, 26, 26, 20, 0, -1),
-    Glyph::new(0x0153, 0x210C, 22, 21, 15, 0, -1),
-    Glyph::new(0x0158, 0x2134, 18, 18, 27, -1, -1),
-    Glyph::new(0x0159, 0x2171, 13, 14, 22, 0, 0),
-    Glyph::new(0x015A, 0x2198, 15, 15, 27, -1, -1),
-    Glyph::new(0x015B, 0x21CB, 12, 14, 24, -1, -1),
-    Glyph::new(0x0160, 0x21F5, 15, 16, 27, -1, -1),
-    Glyph::new(0x0161, 0x222B, 12, 14, 23, -1, -1),
-    Glyph::new(0x0164, 0x2254, 18, 18, 26, 1, 0),
-    Glyph::new(0x0165, 0x228F, 11, 13, 22, 0, -1),
-    Glyph::new(0x016E, 0x22B3, 21, 20, 27, 2, -1),
-    Glyph::new(0x016F, 0x22F7, 16, 16, 23, 0, -1),
-    Glyph::new(0x0170, 0x2325, 21, 20, 27, 2, -1),
-    Glyph::new(0x0171, 0x2369, 16, 16, 23, 0, -1),
-    Glyph::new(0x0178, 0x2397, 18, 18, 24, 1, 0),
-    Glyph::new(0x0179, 0x23CD, 17, 17, 27, -1, -1),
-    Glyph::new(0x017A, 0x2407, 13, 14, 24, -1, -1),
-    Glyph::new(0x017B, 0x2431, 17, 17, 26, -1, -1),
-    Glyph::new(0x017C, 0x2469, 13, 14, 22, -1, -1),
-    Glyph::new(0x017D, 0x2490, 17, 17, 27, -1, -1),
-    Glyph::new(0x017E, 0x24CA, 13, 14, 23, -1, -1),
-    Glyph::new(0x03C0, 0x24F3, 17, 17, 15, 0, -1),
-    Glyph::new(0x1E9E, 0x2513, 19, 20, 20, -2, -1),
-    Glyph::new(0x2013, 0x2545, 13, 13, 3, 0, 5),
-    Glyph::new(0x2014, 0x254A, 26, 26, 3, 0, 5),
-    Glyph::new(0x2018, 0x2554, 8, 6, 9, 2, 11),
-    Glyph::new(0x2019, 0x255B, 8, 7, 9, 1, 11),
-    Glyph::new(0x201A, 0x2563, 8, 6, 9, 0, -5),
-    Glyph::new(0x201B, 0x256A, 8, 6, 10, 1, 10),
-    Glyph::new(0x201C, 0x2572, 14, 12, 9, 2, 11),
-    Glyph::new(0x201D, 0x2580, 14, 12, 10, 1, 10),
-    Glyph::new(0x201E, 0x258F, 13, 11, 9, 0, -5),
-    Glyph::new(0x201F, 0x259C, 13, 11, 10, 1, 10),
-    Glyph::new(0x2020, 0x25AA, 13, 12, 18, 1, 1),
-    Glyph::new(0x2021, 0x25C5, 13, 14, 21, -1, -2),
-    Glyph::new(0x2022, 0x25EA, 8, 7, 6, 0, 4),
-    Glyph::new(0x2026, 0x25F0, 26, 22, 5, 2, -1),
-    Glyph::new(0x2039, 0x25FE, 10, 9, 11, 0, 1),
-    Glyph::new(0x203A, 0x260B, 10, 9, 11, 0, 1),
-    Glyph::new(0x2070, 0x2618, 12, 11, 13, 0, 9),
-    Glyph::new(0x2074, 0x262A, 12, 11, 13, 0, 9),
-    Glyph::new(0x2075, 0x263C, 12, 11, 13, 0, 9),
-    Glyph::new(0x2076, 0x264E, 12, 11, 13, 1, 9),
-    Glyph::new(0x2077, 0x2660, 12, 10, 13, 2, 9),
-    Glyph::new(0x2078, 0x2671, 12, 11, 13, 0, 9),
-    Glyph::new(0x2079, 0x2683, 12, 11, 13, 0, 9),
-    Glyph::new(0x2080, 0x2695, 12, 11, 13, 0, -4),
-    Glyph::new(0x2081, 0x26A7, 12, 8, 13, 1, -4),
-    Glyph::new(0x2082, 0x26B4, 12, 11, 13, 0, -4),
-    Glyph::new(0x2083, 0x26C6, 12, 10, 13, 1, -4),
-    Glyph::new(0x2084, 0x26D7, 12, 11, 13, 0, -4),
-    Glyph::new(0x2085, 0x26E9, 12, 11, 13, 0, -4),
-    Glyph::new(0x2086, 0x26FB, 12, 11, 13, 1, -4),
-    Glyph::new(0x2087, 0x270D, 12, 10, 13, 2, -4),
-    Glyph::new(0x2088, 0x271E, 12, 11, 13, 0, -4),
-    Glyph::new(0x2089, 0x2730, 12, 11, 13, 0, -4),
-    Glyph::new(0x20AC, 0x2742, 17, 19, 20, -1, -1),
-    Glyph::new(0x2122, 0x2772, 21, 20, 10, 1, 9),
-    Glyph::new(0x2153, 0x278B, 28, 26, 22, 1, -2),
-    Glyph::new(0x2154, 0x27D3, 28, 27, 22, 0, -2),
-    Glyph::new(0x215B, 0x281E, 28, 27, 22, 1, -2),
-    Glyph::new(0x215C, 0x2869, 28, 27, 22, 1, -2),
-    Glyph::new(0x215D, 0x28B4, 28, 28, 22, 0, -2),
-    Glyph::new(0x215E, 0x2901, 28, 26, 22, 2, -2),
-    Glyph::new(0x2190, 0x2949, 26, 16, 12, 5, 3),
-    Glyph::new(0x2191, 0x2961, 26, 12, 18, 7, 0),
-    Glyph::new(0x2192, 0x297C, 26, 16, 12, 5, 3),
-    Glyph::new(0x2193, 0x2994, 26, 12, 18, 7, 0),
-    Glyph::new(0x2194, 0x29AF, 26, 18, 12, 4, 3),
-    Glyph::new(0x2195, 0x29CA, 26, 12, 18, 7, 0),
-    Glyph::new(0x21D0, 0x29E5, 26, 18, 16, 4, 1),
-    Glyph::new(0x21D1, 0x2A09, 26, 16, 18, 5, 0),
-    Glyph::new(0x21D2, 0x2A2D, 26, 18, 16, 4, 1),
-    Glyph::new(0x21D3, 0x2A51, 26, 16, 18, 5, 0),
-    Glyph::new(0x21D4, 0x2A75, 26, 18, 14, 4, 2),
-    Glyph::new(0x2202, 0x2A95, 17, 14, 22, 1, -1),
-    Glyph::new(0x2206, 0x2ABC, 18, 18, 19, 0, 0),
-    Glyph::new(0x220F, 0x2AE7, 22, 21, 24, 0, -5),
-    Glyph::new(0x2211, 0x2B26, 18, 17, 24, 0, -5),
-    Glyph::new(0x221A, 0x2B59, 17, 18, 24, -1, -3),
-    Glyph::new(0x221E, 0x2B8F, 17, 16, 10, 0, 3),
-    Glyph::new(0x222B, 0x2BA3, 17, 15, 28, 1, -7),
-    Glyph::new(0x2260, 0x2BD8, 17, 12, 13, 2, 2),
-    Glyph::new(0x2264, 0x2BEC, 17, 12, 16, 2, 0),
-    Glyph::new(0x2265, 0x2C04, 17, 12, 16, 2, 0),
+    Glyph::new(0x0022, 0x0025, 11, 10, 9, 1, 10),
+    Glyph::new(0x0023, 0x0044, 17, 17, 17, 0, -2),
+    Glyph::new(0x0024, 0x007F, 17, 14, 26, 1, -5),
+    Glyph::new(0x0025, 0x00CA, 26, 24, 22, 1, -2),
+    Glyph::new(0x0026, 0x0136, 23, 21, 21, 1, -2),
+    Glyph::new(0x0027, 0x018F, 6, 6, 9, 1, 10),
+    Glyph::new(0x0028, 0x019F, 11, 12, 27, 0, -6),
+    Glyph::new(0x0029, 0x01D2, 11, 12, 27, -2, -6),
+    Glyph::new(0x002A, 0x0204, 11, 10, 10, 1, 10),
+    Glyph::new(0x002B, 0x021F, 17, 12, 13, 2, 2),
+    Glyph::new(0x002C, 0x023C, 9, 7, 9, -1, -5),
+    Glyph::new(0x002D, 0x024C, 11, 9, 4, 1, 5),
+    Glyph::new(0x002E, 0x0253, 9, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x025C, 14, 16, 21, -1, -2),
+    Glyph::new(0x0030, 0x0283, 17, 16, 20, 0, -1),
+    Glyph::new(0x0031, 0x02C2, 17, 12, 19, 1, 0),
+    Glyph::new(0x0032, 0x02EC, 17, 16, 19, 0, 0),
+    Glyph::new(0x0033, 0x031C, 17, 15, 20, 0, -1),
+    Glyph::new(0x0034, 0x0354, 17, 16, 19, 0, 0),
+    Glyph::new(0x0035, 0x0387, 17, 16, 19, 0, -1),
+    Glyph::new(0x0036, 0x03B7, 17, 16, 20, 1, -1),
+    Glyph::new(0x0037, 0x03ED, 17, 15, 19, 2, -1),
+    Glyph::new(0x0038, 0x0420, 17, 16, 20, 0, -1),
+    Glyph::new(0x0039, 0x045E, 17, 17, 20, -1, -1),
+    Glyph::new(0x003A, 0x0497, 9, 7, 15, 1, -1),
+    Glyph::new(0x003B, 0x04AB, 9, 9, 19, -1, -5),
+    Glyph::new(0x003C, 0x04C8, 17, 12, 13, 2, 2),
+    Glyph::new(0x003D, 0x04E7, 17, 12, 8, 2, 5),
+    Glyph::new(0x003E, 0x04FB, 17, 12, 13, 2, 2),
+    Glyph::new(0x003F, 0x0517, 11, 9, 20, 2, -1),
+    Glyph::new(0x0040, 0x0542, 26, 24, 25, 1, -6),
+    Glyph::new(0x0041, 0x05B5, 20, 21, 19, -2, 0),
+    Glyph::new(0x0042, 0x05F1, 17, 17, 20, -1, -1),
+    Glyph::new(0x0043, 0x0631, 18, 17, 20, 0, -1),
+    Glyph::new(0x0044, 0x0668, 20, 20, 20, -1, -1),
+    Glyph::new(0x0045, 0x06AE, 17, 18, 19, -1, 0),
+    Glyph::new(0x0046, 0x06E7, 16, 17, 19, -1, 0),
+    Glyph::new(0x0047, 0x0716, 19, 18, 20, 0, -1),
+    Glyph::new(0x0048, 0x075C, 21, 23, 19, -1, 0),
+    Glyph::new(0x0049, 0x07A0, 11, 13, 19, -1, 0),
+    Glyph::new(0x004A, 0x07C2, 10, 17, 25, -5, -6),
+    Glyph::new(0x004B, 0x07F2, 19, 21, 20, -1, -1),
+    Glyph::new(0x004C, 0x0838, 16, 16, 19, -1, 0),
+    Glyph::new(0x004D, 0x0865, 24, 26, 19, -2, 0),
+    Glyph::new(0x004E, 0x08C6, 21, 23, 20, -1, -1),
+    Glyph::new(0x004F, 0x0912, 20, 19, 20, 0, -1),
+    Glyph::new(0x0050, 0x0953, 16, 17, 19, -1, 0),
+    Glyph::new(0x0051, 0x098C, 20, 22, 25, 0, -6),
+    Glyph::new(0x0052, 0x09E1, 18, 18, 20, -1, -1),
+    Glyph::new(0x0053, 0x0A27, 15, 15, 20, -1, -1),
+    Glyph::new(0x0054, 0x0A62, 18, 18, 19, 1, 0),
+    Glyph::new(0x0055, 0x0A96, 21, 20, 20, 2, -1),
+    Glyph::new(0x0056, 0x0ADB, 20, 20, 20, 1, -1),
+    Glyph::new(0x0057, 0x0B18, 26, 27, 20, 1, -1),
+    Glyph::new(0x0058, 0x0B78, 18, 22, 19, -3, 0),
+    Glyph::new(0x0059, 0x0BB9, 18, 18, 19, 1, 0),
+    Glyph::new(0x005A, 0x0BEB, 17, 17, 20, -1, -1),
+    Glyph::new(0x005B, 0x0C23, 9, 12, 26, -2, -5),
+    Glyph::new(0x005C, 0x0C51, 14, 11, 21, 1, -2),
+    Glyph::new(0x005D, 0x0C77, 9, 13, 26, -2, -5),
+    Glyph::new(0x005E, 0x0CAF, 17, 14, 13, 1, 4),
+    Glyph::new(0x005F, 0x0CD7, 13, 13, 3, 0, -4),
+    Glyph::new(0x0060, 0x0CE0, 17, 6, 7, 5, 15),
+    Glyph::new(0x0061, 0x0CEB, 16, 16, 15, 0, -1),
+    Glyph::new(0x0062, 0x0D22, 15, 14, 22, 0, -1),
+    Glyph::new(0x0063, 0x0D60, 12, 12, 15, 0, -1),
+    Glyph::new(0x0064, 0x0D84, 16, 16, 22, 0, -1),
+    Glyph::new(0x0065, 0x0DC6, 13, 12, 15, 0, -1),
+    Glyph::new(0x0066, 0x0DF4, 12, 20, 28, -5, -7),
+    Glyph::new(0x0067, 0x0E39, 14, 18, 21, -2, -7),
+    Glyph::new(0x0068, 0x0E7D, 16, 15, 22, 0, -1),
+    Glyph::new(0x0069, 0x0EBF, 9, 9, 21, 0, -1),
+    Glyph::new(0x006A, 0x0EE9, 9, 15, 27, -6, -7),
+    Glyph::new(0x006B, 0x0F23, 14, 14, 22, 0, -1),
+    Glyph::new(0x006C, 0x0F62, 9, 8, 22, 0, -1),
+    Glyph::new(0x006D, 0x0F86, 23, 23, 15, 0, -1),
+    Glyph::new(0x006E, 0x0FD7, 17, 16, 15, 0, -1),
+    Glyph::new(0x006F, 0x100D, 15, 14, 15, 0, -1),
+    Glyph::new(0x0070, 0x103A, 15, 17, 20, -2, -6),
+    Glyph::new(0x0071, 0x107B, 15, 15, 20, 0, -6),
+    Glyph::new(0x0072, 0x10B9, 13, 13, 14, 0, 0),
+    Glyph::new(0x0073, 0x10DC, 12, 12, 15, -1, -1),
+    Glyph::new(0x0074, 0x1101, 11, 12, 19, 0, -1),
+    Glyph::new(0x0075, 0x1128, 16, 16, 15, 0, -1),
+    Glyph::new(0x0076, 0x1164, 14, 14, 15, 0, -1),
+    Glyph::new(0x0077, 0x1191, 20, 20, 15, 0, -1),
+    Glyph::new(0x0078, 0x11D4, 15, 16, 15, -1, -1),
+    Glyph::new(0x0079, 0x1208, 14, 18, 21, -4, -7),
+    Glyph::new(0x007A, 0x1246, 13, 14, 15, -1, -1),
+    Glyph::new(0x007B, 0x1275, 11, 11, 26, 1, -5),
+    Glyph::new(0x007C, 0x12AB, 8, 9, 24, -1, -4),
+    Glyph::new(0x007D, 0x12DA, 11, 12, 26, -2, -5),
+    Glyph::new(0x007E, 0x130D, 17, 14, 6, 1, 6),
+    Glyph::new(0x00A1, 0x131F, 9, 9, 21, -1, -7),
+    Glyph::new(0x00A2, 0x1342, 17, 14, 25, 1, -5),
+    Glyph::new(0x00A3, 0x138A, 17, 18, 20, -1, -1),
+    Glyph::new(0x00A4, 0x13C6, 17, 16, 13, 0, 2),
+    Glyph::new(0x00A5, 0x13F6, 17, 18, 18, 1, 0),
+    Glyph::new(0x00A7, 0x1439, 14, 13, 21, -1, -3),
+    Glyph::new(0x00A9, 0x147B, 21, 20, 20, 0, -1),
+    Glyph::new(0x00AA, 0x14DD, 12, 11, 13, 1, 6),
+    Glyph::new(0x00AB, 0x1504, 16, 16, 11, 0, 1),
+    Glyph::new(0x00AE, 0x1529, 16, 15, 15, 0, 6),
+    Glyph::new(0x00B0, 0x156A, 14, 10, 11, 2, 8),
+    Glyph::new(0x00B1, 0x1582, 17, 12, 17, 2, -1),
+    Glyph::new(0x00B2, 0x15AA, 12, 11, 13, 0, 9),
+    Glyph::new(0x00B3, 0x15CA, 12, 10, 13, 1, 9),
+    Glyph::new(0x00B5, 0x15EA, 17, 17, 21, -1, -7),
+    Glyph::new(0x00B6, 0x162C, 16, 18, 23, -1, -4),
+    Glyph::new(0x00B7, 0x1679, 9, 6, 5, 1, 5),
+    Glyph::new(0x00B9, 0x1681, 12, 8, 13, 1, 9),
+    Glyph::new(0x00BA, 0x169C, 12, 10, 13, 1, 6),
+    Glyph::new(0x00BB, 0x16C0, 16, 15, 11, 0, 1),
+    Glyph::new(0x00BC, 0x16E3, 28, 27, 22, 1, -2),
+    Glyph::new(0x00BD, 0x174C, 28, 26, 22, 1, -2),
+    Glyph::new(0x00BE, 0x17AB, 28, 27, 22, 1, -2),
+    Glyph::new(0x00BF, 0x1815, 11, 9, 20, 0, -6),
+    Glyph::new(0x00C0, 0x183F, 20, 21, 26, -2, 0),
+    Glyph::new(0x00C1, 0x188A, 20, 21, 26, -2, 0),
+    Glyph::new(0x00C2, 0x18D4, 20, 21, 26, -2, 0),
+    Glyph::new(0x00C3, 0x191F, 20, 21, 25, -2, 0),
+    Glyph::new(0x00C4, 0x196B, 20, 21, 24, -2, 0),
+    Glyph::new(0x00C5, 0x19B7, 20, 21, 26, -2, 0),
+    Glyph::new(0x00C6, 0x1A0B, 25, 27, 19, -2, 0),
+    Glyph::new(0x00C7, 0x1A61, 18, 17, 26, 0, -7),
+    Glyph::new(0x00C8, 0x1AA5, 17, 18, 26, -1, 0),
+    Glyph::new(0x00C9, 0x1AEA, 17, 18, 26, -1, 0),
+    Glyph::new(0x00CA, 0x1B31, 17, 18, 26, -1, 0),
+    Glyph::new(0x00CB, 0x1B7A, 17, 18, 24, -1, 0),
+    Glyph::new(0x00CC, 0x1BC2, 11, 13, 26, -1, 0),
+    Glyph::new(0x00CD, 0x1BF0, 11, 13, 26, -1, 0),
+    Glyph::new(0x00CE, 0x1C1F, 11, 13, 26, -1, 0),
+    Glyph::new(0x00CF, 0x1C4D, 11, 14, 24, -1, 0),
+    Glyph::new(0x00D0, 0x1C88, 20, 20, 20, -1, -1),
+    Glyph::new(0x00D1, 0x1CCF, 21, 23, 26, -1, -1),
+    Glyph::new(0x00D2, 0x1D2C, 20, 19, 27, 0, -1),
+    Glyph::new(0x00D3, 0x1D7A, 20, 19, 27, 0, -1),
+    Glyph::new(0x00D4, 0x1DC9, 20, 19, 27, 0, -1),
+    Glyph::new(0x00D5, 0x1E19, 20, 19, 26, 0, -1),
+    Glyph::new(0x00D6, 0x1E6A, 20, 19, 25, 0, -1),
+    Glyph::new(0x00D7, 0x1EBB, 17, 12, 12, 2, 3),
+    Glyph::new(0x00D8, 0x1EDB, 20, 21, 20, -1, -1),
+    Glyph::new(0x00D9, 0x1F2C, 21, 20, 27, 2, -1),
+    Glyph::new(0x00DA, 0x1F7E, 21, 20, 27, 2, -1),
+    Glyph::new(0x00DB, 0x1FD1, 21, 20, 27, 2, -1),
+    Glyph::new(0x00DC, 0x2026, 21, 20, 25, 2, -1),
+    Glyph::new(0x00DE, 0x207B, 16, 17, 19, -1, 0),
+    Glyph::new(0x00DF, 0x20B4, 17, 21, 28, -5, -7),
+    Glyph::new(0x00E0, 0x2117, 16, 16, 23, 0, -1),
+    Glyph::new(0x00E1, 0x215D, 16, 16, 24, 0, -1),
+    Glyph::new(0x00E2, 0x21A2, 16, 16, 23, 0, -1),
+    Glyph::new(0x00E3, 0x21ED, 16, 16, 22, 0, -1),
+    Glyph::new(0x00E4, 0x2236, 16, 16, 21, 0, -1),
+    Glyph::new(0x00E5, 0x227F, 16, 16, 23, 0, -1),
+    Glyph::new(0x00E6, 0x22CE, 21, 20, 15, 0, -1),
+    Glyph::new(0x00E7, 0x2316, 12, 12, 21, 0, -7),
+    Glyph::new(0x00E8, 0x2347, 13, 12, 23, 0, -1),
+    Glyph::new(0x00E9, 0x2383, 13, 13, 24, 0, -1),
+    Glyph::new(0x00EA, 0x23C0, 13, 13, 23, 0, -1),
+    Glyph::new(0x00EB, 0x2401, 13, 13, 21, 0, -1),
+    Glyph::new(0x00EC, 0x2440, 9, 8, 23, 0, -1),
+    Glyph::new(0x00ED, 0x2469, 9, 11, 24, 0, -1),
+    Glyph::new(0x00EE, 0x2498, 9, 11, 23, 0, -1),
+    Glyph::new(0x00EF, 0x24CB, 9, 11, 21, 0, -1),
+    Glyph::new(0x00F0, 0x24FC, 15, 14, 22, 0, -1),
+    Glyph::new(0x00F1, 0x253B, 17, 16, 22, 0, -1),
+    Glyph::new(0x00F2, 0x2582, 15, 14, 23, 0, -1),
+    Glyph::new(0x00F3, 0x25BE, 15, 14, 24, 0, -1),
+    Glyph::new(0x00F4, 0x25F9, 15, 14, 23, 0, -1),
+    Glyph::new(0x00F5, 0x263A, 15, 15, 22, 0, -1),
+    Glyph::new(0x00F6, 0x2677, 15, 15, 21, 0, -1),
+    Glyph::new(0x00F7, 0x26B5, 17, 12, 13, 2, 2),
+    Glyph::new(0x00F8, 0x26CF, 15, 18, 16, -2, -1),
+    Glyph::new(0x00F9, 0x2709, 16, 16, 23, 0, -1),
+    Glyph::new(0x00FA, 0x2753, 16, 16, 24, 0, -1),
+    Glyph::new(0x00FB, 0x279E, 16, 16, 23, 0, -1),
+    Glyph::new(0x00FC, 0x27ED, 16, 16, 21, 0, -1),
+    Glyph::new(0x00FE, 0x283B, 15, 17, 27, -3, -6),
+    Glyph::new(0x00FF, 0x288B, 14, 18, 27, -4, -7),
+    Glyph::new(0x0104, 0x28D9, 20, 21, 25, -2, -6),
+    Glyph::new(0x0105, 0x2924, 16, 16, 20, 0, -6),
+    Glyph::new(0x0106, 0x2968, 18, 17, 27, 0, -1),
+    Glyph::new(0x0107, 0x29AD, 12, 13, 24, 0, -1),
+    Glyph::new(0x010C, 0x29E0, 18, 18, 27, 0, -1),
+    Glyph::new(0x010D, 0x2A29, 12, 14, 23, 0, -1),
+    Glyph::new(0x010E, 0x2A61, 20, 20, 27, -1, -1),
+    Glyph::new(0x010F, 0x2AB9, 17, 20, 22, 0, -1),
+    Glyph::new(0x0118, 0x2B06, 17, 18, 25, -1, -6),
+    Glyph::new(0x0119, 0x2B4E, 13, 12, 20, 0, -6),
+    Glyph::new(0x011A, 0x2B88, 17, 18, 26, -1, 0),
+    Glyph::new(0x011B, 0x2BD0, 13, 14, 23, 0, -1),
+    Glyph::new(0x0139, 0x2C10, 16, 16, 26, -1, 0),
+    Glyph::new(0x013A, 0x2C4B, 9, 10, 28, 0, -1),
+    Glyph::new(0x013D, 0x2C7D, 16, 17, 21, -1, 0),
+    Glyph::new(0x013E, 0x2CB3, 10, 13, 22, 0, -1),
+    Glyph::new(0x0141, 0x2CE7, 16, 16, 19, -1, 0),
+    Glyph::new(0x0142, 0x2D17, 9, 11, 22, -1, -1),
+    Glyph::new(0x0143, 0x2D44, 21, 23, 27, -1, -1),
+    Glyph::new(0x0144, 0x2DA0, 17, 16, 24, 0, -1),
+    Glyph::new(0x0147, 0x2DE4, 21, 23, 27, -1, -1),
+    Glyph::new(0x0148, 0x2E43, 17, 16, 23, 0, -1),
+    Glyph::new(0x0152, 0x2E89, 26, 26, 20, 0, -1),
+    Glyph::new(0x0153, 0x2EE5, 22, 21, 15, 0, -1),
+    Glyph::new(0x0158, 0x2F2F, 18, 18, 27, -1, -1),
+    Glyph::new(0x0159, 0x2F84, 13, 14, 22, 0, 0),
+    Glyph::new(0x015A, 0x2FBB, 15, 15, 27, -1, -1),
+    Glyph::new(0x015B, 0x3003, 12, 14, 24, -1, -1),
+    Glyph::new(0x0160, 0x3039, 15, 16, 27, -1, -1),
+    Glyph::new(0x0161, 0x3087, 12, 14, 23, -1, -1),
+    Glyph::new(0x0164, 0x30C4, 18, 18, 26, 1, 0),
+    Glyph::new(0x0165, 0x3108, 11, 13, 22, 0, -1),
+    Glyph::new(0x016E, 0x313B, 21, 20, 27, 2, -1),
+    Glyph::new(0x016F, 0x3195, 16, 16, 23, 0, -1),
+    Glyph::new(0x0170, 0x31E8, 21, 20, 27, 2, -1),
+    Glyph::new(0x0171, 0x3244, 16, 16, 23, 0, -1),
+    Glyph::new(0x0178, 0x3297, 18, 18, 24, 1, 0),
+    Glyph::new(0x0179, 0x32DA, 17, 17, 27, -1, -1),
+    Glyph::new(0x017A, 0x331F, 13, 14, 24, -1, -1),
+    Glyph::new(0x017B, 0x335A, 17, 17, 26, -1, -1),
+    Glyph::new(0x017C, 0x339C, 13, 14, 22, -1, -1),
+    Glyph::new(0x017D, 0x33D7, 17, 17, 27, -1, -1),
+    Glyph::new(0x017E, 0x3420, 13, 14, 23, -1, -1),
+    Glyph::new(0x03C0, 0x3460, 17, 17, 15, 0, -1),
+    Glyph::new(0x1E9E, 0x349A, 19, 20, 20, -2, -1),
+    Glyph::new(0x2013, 0x34E5, 13, 13, 3, 0, 5),
+    Glyph::new(0x2014, 0x34EE, 26, 26, 3, 0, 5),
+    Glyph::new(0x2018, 0x34FF, 8, 6, 9, 2, 11),
+    Glyph::new(0x2019, 0x350E, 8, 7, 9, 1, 11),
+    Glyph::new(0x201A, 0x351C, 8, 6, 9, 0, -5),
+    Glyph::new(0x201B, 0x352A, 8, 6, 10, 1, 10),
+    Glyph::new(0x201C, 0x3538, 14, 12, 9, 2, 11),
+    Glyph::new(0x201D, 0x3554, 14, 12, 10, 1, 10),
+    Glyph::new(0x201E, 0x3570, 13, 11, 9, 0, -5),
+    Glyph::new(0x201F, 0x358F, 13, 11, 10, 1, 10),
+    Glyph::new(0x2020, 0x35AB, 13, 12, 18, 1, 1),
+    Glyph::new(0x2021, 0x35D2, 13, 14, 21, -1, -2),
+    Glyph::new(0x2022, 0x360C, 8, 7, 6, 0, 4),
+    Glyph::new(0x2026, 0x3619, 26, 22, 5, 2, -1),
+    Glyph::new(0x2039, 0x3633, 10, 9, 11, 0, 1),
+    Glyph::new(0x203A, 0x3646, 10, 9, 11, 0, 1),
+    Glyph::new(0x2070, 0x365A, 12, 11, 13, 0, 9),
+    Glyph::new(0x2074, 0x367F, 12, 11, 13, 0, 9),
+    Glyph::new(0x2075, 0x369D, 12, 11, 13, 0, 9),
+    Glyph::new(0x2076, 0x36B9, 12, 11, 13, 1, 9),
+    Glyph::new(0x2077, 0x36DD, 12, 10, 13, 2, 9),
+    Glyph::new(0x2078, 0x36F7, 12, 11, 13, 0, 9),
+    Glyph::new(0x2079, 0x371D, 12, 11, 13, 0, 9),
+    Glyph::new(0x2080, 0x3742, 12, 11, 13, 0, -4),
+    Glyph::new(0x2081, 0x3767, 12, 8, 13, 1, -4),
+    Glyph::new(0x2082, 0x3781, 12, 11, 13, 0, -4),
+    Glyph::new(0x2083, 0x37A2, 12, 10, 13, 1, -4),
+    Glyph::new(0x2084, 0x37C2, 12, 11, 13, 0, -4),
+    Glyph::new(0x2085, 0x37E0, 12, 11, 13, 0, -4),
+    Glyph::new(0x2086, 0x37FC, 12, 11, 13, 1, -4),
+    Glyph::new(0x2087, 0x381E, 12, 10, 13, 2, -4),
+    Glyph::new(0x2088, 0x3837, 12, 11, 13, 0, -4),
+    Glyph::new(0x2089, 0x385D, 12, 11, 13, 0, -4),
+    Glyph::new(0x20AC, 0x3881, 17, 19, 20, -1, -1),
+    Glyph::new(0x2122, 0x38C3, 21, 20, 10, 1, 9),
+    Glyph::new(0x2153, 0x3901, 28, 26, 22, 1, -2),
+    Glyph::new(0x2154, 0x3965, 28, 27, 22, 0, -2),
+    Glyph::new(0x215B, 0x39D1, 28, 27, 22, 1, -2),
+    Glyph::new(0x215C, 0x3A38, 28, 27, 22, 1, -2),
+    Glyph::new(0x215D, 0x3AA0, 28, 28, 22, 0, -2),
+    Glyph::new(0x215E, 0x3B09, 28, 26, 22, 2, -2),
+    Glyph::new(0x2190, 0x3B78, 26, 16, 12, 5, 3),
+    Glyph::new(0x2191, 0x3B99, 26, 12, 18, 7, 0),
+    Glyph::new(0x2192, 0x3BC2, 26, 16, 12, 5, 3),
+    Glyph::new(0x2193, 0x3BE3, 26, 12, 18, 7, 0),
+    Glyph::new(0x2194, 0x3C0C, 26, 18, 12, 4, 3),
+    Glyph::new(0x2195, 0x3C35, 26, 12, 18, 7, 0),
+    Glyph::new(0x21D0, 0x3C6C, 26, 18, 16, 4, 1),
+    Glyph::new(0x21D1, 0x3C92, 26, 16, 18, 5, 0),
+    Glyph::new(0x21D2, 0x3CC8, 26, 18, 16, 4, 1),
+    Glyph::new(0x21D3, 0x3CEE, 26, 16, 18, 5, 0),
+    Glyph::new(0x21D4, 0x3D25, 26, 18, 14, 4, 2),
+    Glyph::new(0x2202, 0x3D54, 17, 14, 22, 1, -1),
+    Glyph::new(0x2206, 0x3D95, 18, 18, 19, 0, 0),
+    Glyph::new(0x220F, 0x3DD0, 22, 21, 24, 0, -5),
+    Glyph::new(0x2211, 0x3E33, 18, 17, 24, 0, -5),
+    Glyph::new(0x221A, 0x3E6F, 17, 18, 24, -1, -3),
+    Glyph::new(0x221E, 0x3EB2, 17, 16, 10, 0, 3),
+    Glyph::new(0x222B, 0x3EDC, 17, 15, 28, 1, -7),
+    Glyph::new(0x2260, 0x3F12, 17, 12, 13, 2, 2),
+    Glyph::new(0x2264, 0x3F30, 17, 12, 16, 2, 0),
+    Glyph::new(0x2265, 0x3F52, 17, 12, 16, 2, 0),
+    Glyph::new(0xFB01, 0x3F77, 21, 26, 28, -5, -7),
+    Glyph::new(0xFB02, 0x3FE0, 21, 25, 28, -5, -7),
 ];
 
-const BITMAP_BW: &[u8; 11292] = include_bytes!("./bookerly_bold_italic_26.bw");
-const BITMAP_MSB: &[u8; 11292] = include_bytes!("./bookerly_bold_italic_26.msb");
-const BITMAP_LSB: &[u8; 11292] = include_bytes!("./bookerly_bold_italic_26.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 15), (18, 15), (19, 16),
+    (20, 15), (21, 17), (22, 18), (23, 15), (24, 15), (25, 19), (26, 15), (27, 20),
+    (28, 13), (29, 20), (30, 13), (31, 21), (32, 22), (33, 23), (34, 24), (35, 25),
+    (23, 26), (36, 27), (37, 28), (38, 29), (0, 0), (39, 30), (0, 0), (0, 0),
+    (0, 0), (40, 31), (41, 32), (42, 31), (43, 31), (44, 33), (45, 34), (46, 35),
+    (40, 36), (47, 37), (48, 38), (49, 36), (50, 39), (51, 40), (52, 40), (53, 41),
+    (54, 42), (55, 31), (56, 43), (57, 44), (58, 45), (59, 46), (60, 47), (61, 47),
+    (62, 48), (63, 49), (64, 50), (65, 51), (0, 0), (66, 52), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (67, 53), (68, 54),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (69, 55), (0, 0), (0, 0),
+    (0, 0), (70, 56), (71, 57), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (72, 58), (73, 14), (17, 15),
+    (17, 15), (17, 15), (17, 15), (21, 17), (21, 17), (74, 59), (75, 59), (16, 0),
+    (26, 15), (27, 20), (27, 20), (27, 20), (27, 20), (27, 20), (0, 0), (76, 60),
+    (33, 23), (33, 23), (33, 23), (33, 23), (77, 15), (78, 61), (40, 62), (79, 31),
+    (79, 63), (79, 64), (79, 64), (79, 62), (44, 31), (42, 31), (44, 65), (80, 33),
+    (81, 66), (82, 67), (50, 68), (83, 40), (84, 69), (84, 69), (85, 70), (86, 40),
+    (53, 71), (87, 41), (87, 72), (88, 73), (88, 73), (0, 0), (89, 74), (59, 46),
+    (59, 46), (59, 46), (59, 46), (41, 75), (90, 76), (91, 12), (92, 31), (15, 14),
+    (93, 31), (15, 14), (93, 64), (16, 13), (94, 31), (95, 15), (96, 33), (17, 15),
+    (97, 65), (24, 15), (50, 39), (98, 15), (94, 39), (99, 77), (100, 78), (26, 15),
+    (52, 40), (26, 15), (52, 40), (101, 14), (44, 41), (30, 13), (102, 43), (31, 21),
+    (103, 44), (31, 21), (104, 79), (32, 22), (105, 45), (33, 23), (59, 46), (33, 23),
+    (59, 46), (36, 27), (37, 28), (64, 50), (37, 28), (64, 50), (37, 28), (64, 80),
+    (106, 81), (107, 82), (108, 83), (108, 83), (109, 84), (110, 85), (111, 86), (0, 0),
+    (112, 84), (113, 85), (114, 86), (0, 0), (0, 0), (0, 0), (0, 0), (115, 87),
+    (116, 54), (117, 57), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (47, 34), (50, 34),
+];
+
+const KERNING: [&[i8]; 118] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -2, -2],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -2, 0, 0, -2, -2, -1, -2, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -2, -1, -1, -1, -1, 0, -1, -1, 0, -1, -2, 0, -1, -2, 0, 0, -1, 0, -1, -2, -1, -1, -1, 0, 0, 0, -1, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, -2],
+    &[0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -2, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, 0, -2, 0, -1, -2, 0, -2, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -2, 0, -1, -1, 0, -1, -2, -1, -1, -2, -1, -1, 0, -1, 0, -1, -1, -1, 0, -2, -2, -1, -2, -2, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, -2, -2, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -2, -2, 0, -1, -2, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -2, -1, -2, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -2, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -2, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1],
+    &[0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -2, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -2, 0, 0, -2, -2],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, -1, 0, -1, -2, -1, -1, -2, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, -2, 0, -2, -2, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, -1, -1, -2, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -2, 0, 0, -1, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -2, 0, 0, 0, 0, -1, 0, -1, -1, -2, 0, 0, -2, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, -1, -2, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1],
+    &[0, 0, 0, -1, 0, 0, -1, -2, -1, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -1, 0, 0, -2, -2, -1, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -2, -1, -2, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -2, -1, 0, -2, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, -2, -2, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1],
+    &[0, -1, -1, 0, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, -2, 0, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, -2, 0, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -1, 0, -1, -2, -1, 0, -2, -1, -1, -2, -2, -1, -1, -1, -2, -2, -2, -2, -1, -1, 0, 0, -2, -2, -2, -2, -2, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -2, -1, -1, -2, -1, -1, -1, -2, -1, -1, -2, -2, -2, -2, -2, -1, -1, -1, 0, -2, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -2, 0, -1, -1, 0, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -1, -2, 0, -1, -1, 0, -1, -2, -1, -1, -2, -1, -1, 0, -1, 0, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -2, -1, -1, -1, 0, -2, -2, -2, -2, -2, 0, 0, -1, 0, -2, -1, -1, -2, 0, -1, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1],
+    &[0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1],
+    &[0, -1, -1, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -2, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 16461] = include_bytes!("./bookerly_bold_italic_26.rle");
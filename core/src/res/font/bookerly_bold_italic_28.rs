@@ -1,308 +1,528 @@
 // Auto-generated font file
 // Font: Bookerly Bold Italic
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 12850,
+    size: 18287,
     y_advance: 28,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 10, 9, 22, 1, -1),
-    Glyph::new(0x0022, 0x0019, 12, 11, 11, 1, 10),
-    Glyph::new(0x0023, 0x0029, 18, 18, 18, 0, -2),
-    Glyph::new(0x0024, 0x0052, 18, 16, 29, 1, -6),
-    Glyph::new(0x0025, 0x008C, 28, 26, 23, 1, -2),
-    Glyph::new(0x0026, 0x00D7, 25, 23, 23, 1, -2),
-    Glyph::new(0x0027, 0x011A, 7, 6, 11, 1, 10),
-    Glyph::new(0x0028, 0x0123, 12, 12, 29, 1, -6),
-    Glyph::new(0x0029, 0x014F, 12, 13, 29, -2, -6),
-    Glyph::new(0x002A, 0x017F, 11, 11, 10, 1, 11),
-    Glyph::new(0x002B, 0x018D, 18, 13, 13, 2, 3),
-    Glyph::new(0x002C, 0x01A3, 9, 8, 9, -1, -5),
-    Glyph::new(0x002D, 0x01AC, 11, 9, 4, 1, 5),
-    Glyph::new(0x002E, 0x01B1, 9, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x01B5, 15, 17, 23, -1, -2),
-    Glyph::new(0x0030, 0x01E6, 18, 17, 21, 0, -1),
-    Glyph::new(0x0031, 0x0213, 18, 12, 20, 2, 0),
-    Glyph::new(0x0032, 0x0231, 18, 17, 20, 0, 0),
-    Glyph::new(0x0033, 0x025C, 18, 16, 21, 0, -1),
-    Glyph::new(0x0034, 0x0286, 18, 17, 20, 0, 0),
-    Glyph::new(0x0035, 0x02B1, 18, 16, 21, 1, -1),
-    Glyph::new(0x0036, 0x02DB, 18, 17, 21, 1, -1),
-    Glyph::new(0x0037, 0x0308, 18, 15, 21, 3, -1),
-    Glyph::new(0x0038, 0x0330, 18, 17, 21, 0, -1),
-    Glyph::new(0x0039, 0x035D, 18, 18, 21, -1, -1),
-    Glyph::new(0x003A, 0x038D, 9, 8, 16, 1, -1),
-    Glyph::new(0x003B, 0x039D, 9, 10, 20, -1, -5),
-    Glyph::new(0x003C, 0x03B6, 18, 13, 13, 2, 3),
-    Glyph::new(0x003D, 0x03CC, 18, 13, 9, 2, 5),
-    Glyph::new(0x003E, 0x03DB, 18, 13, 13, 2, 3),
-    Glyph::new(0x003F, 0x03F1, 12, 10, 22, 2, -1),
-    Glyph::new(0x0040, 0x040D, 28, 26, 26, 1, -6),
-    Glyph::new(0x0041, 0x0462, 21, 22, 20, -2, 0),
-    Glyph::new(0x0042, 0x0499, 18, 18, 21, -1, -1),
-    Glyph::new(0x0043, 0x04C9, 19, 19, 21, 0, -1),
-    Glyph::new(0x0044, 0x04FB, 21, 21, 21, -1, -1),
-    Glyph::new(0x0045, 0x0533, 18, 19, 20, -1, 0),
-    Glyph::new(0x0046, 0x0563, 17, 18, 20, -1, 0),
-    Glyph::new(0x0047, 0x0590, 21, 20, 21, 0, -1),
-    Glyph::new(0x0048, 0x05C5, 23, 25, 20, -1, 0),
-    Glyph::new(0x0049, 0x0604, 12, 14, 20, -1, 0),
-    Glyph::new(0x004A, 0x0627, 11, 18, 26, -5, -6),
-    Glyph::new(0x004B, 0x0662, 20, 23, 21, -1, -1),
-    Glyph::new(0x004C, 0x069F, 17, 17, 20, -1, 0),
-    Glyph::new(0x004D, 0x06CA, 26, 27, 20, -2, 0),
-    Glyph::new(0x004E, 0x070E, 22, 25, 21, -1, -1),
-    Glyph::new(0x004F, 0x0750, 21, 20, 21, 0, -1),
-    Glyph::new(0x0050, 0x0785, 18, 19, 20, -1, 0),
-    Glyph::new(0x0051, 0x07B5, 21, 24, 27, 0, -7),
-    Glyph::new(0x0052, 0x0806, 20, 20, 21, -1, -1),
-    Glyph::new(0x0053, 0x083B, 16, 16, 21, -1, -1),
-    Glyph::new(0x0054, 0x0865, 19, 19, 20, 1, 0),
-    Glyph::new(0x0055, 0x0895, 22, 22, 21, 2, -1),
-    Glyph::new(0x0056, 0x08CF, 21, 22, 21, 1, -1),
-    Glyph::new(0x0057, 0x0909, 28, 28, 21, 2, -1),
-    Glyph::new(0x0058, 0x0953, 19, 24, 20, -3, 0),
-    Glyph::new(0x0059, 0x098F, 19, 20, 20, 1, 0),
-    Glyph::new(0x005A, 0x09C1, 18, 18, 21, -1, -1),
-    Glyph::new(0x005B, 0x09F1, 10, 13, 27, -2, -5),
-    Glyph::new(0x005C, 0x0A1D, 15, 12, 23, 1, -2),
-    Glyph::new(0x005D, 0x0A40, 10, 13, 27, -2, -5),
-    Glyph::new(0x005E, 0x0A6C, 18, 15, 13, 1, 5),
-    Glyph::new(0x005F, 0x0A85, 14, 14, 4, 0, -5),
-    Glyph::new(0x0060, 0x0A8C, 18, 7, 8, 5, 16),
-    Glyph::new(0x0061, 0x0A93, 17, 17, 16, 0, -1),
-    Glyph::new(0x0062, 0x0AB5, 16, 15, 23, 0, -1),
-    Glyph::new(0x0063, 0x0AE1, 13, 13, 16, 0, -1),
-    Glyph::new(0x0064, 0x0AFB, 17, 17, 23, 0, -1),
-    Glyph::new(0x0065, 0x0B2C, 14, 13, 16, 0, -1),
-    Glyph::new(0x0066, 0x0B46, 12, 22, 29, -6, -7),
-    Glyph::new(0x0067, 0x0B96, 15, 19, 22, -2, -7),
-    Glyph::new(0x0068, 0x0BCB, 17, 16, 23, 0, -1),
-    Glyph::new(0x0069, 0x0BF9, 10, 9, 23, 1, -1),
-    Glyph::new(0x006A, 0x0C13, 9, 16, 29, -6, -7),
-    Glyph::new(0x006B, 0x0C4D, 15, 15, 23, 0, -1),
-    Glyph::new(0x006C, 0x0C79, 10, 9, 23, 0, -1),
-    Glyph::new(0x006D, 0x0C93, 25, 24, 16, 0, -1),
-    Glyph::new(0x006E, 0x0CC3, 18, 17, 16, 0, -1),
-    Glyph::new(0x006F, 0x0CE5, 16, 15, 16, 0, -1),
-    Glyph::new(0x0070, 0x0D03, 17, 19, 22, -3, -7),
-    Glyph::new(0x0071, 0x0D38, 16, 16, 22, 0, -7),
-    Glyph::new(0x0072, 0x0D64, 14, 14, 15, 0, 0),
-    Glyph::new(0x0073, 0x0D7F, 13, 13, 16, -1, -1),
-    Glyph::new(0x0074, 0x0D99, 12, 12, 20, 0, -1),
-    Glyph::new(0x0075, 0x0DB7, 18, 17, 16, 0, -1),
-    Glyph::new(0x0076, 0x0DD9, 15, 15, 16, 0, -1),
-    Glyph::new(0x0077, 0x0DF7, 22, 21, 16, 0, -1),
-    Glyph::new(0x0078, 0x0E21, 17, 18, 16, -1, -1),
-    Glyph::new(0x0079, 0x0E45, 15, 19, 22, -4, -7),
-    Glyph::new(0x007A, 0x0E7A, 14, 15, 16, -1, -1),
-    Glyph::new(0x007B, 0x0E98, 12, 12, 28, 1, -5),
-    Glyph::new(0x007C, 0x0EC2, 9, 10, 26, -1, -4),
-    Glyph::new(0x007D, 0x0EE3, 12, 13, 28, -2, -5),
-    Glyph::new(0x007E, 0x0F11, 18, 14, 6, 2, 6),
-    Glyph::new(0x00A1, 0x0F1C, 10, 10, 22, -1, -7),
-    Glyph::new(0x00A2, 0x0F38, 18, 15, 28, 1, -6),
-    Glyph::new(0x00A3, 0x0F6D, 18, 19, 21, -1, -1),
-    Glyph::new(0x00A4, 0x0F9F, 18, 18, 15, 0, 2),
-    Glyph::new(0x00A5, 0x0FC1, 18, 19, 20, 1, 0),
-    Glyph::new(0x00A7, 0x0FF1, 15, 14, 23, -1, -3),
-    Glyph::new(0x00A9, 0x101A, 22, 22, 21, 0, -1),
-    Glyph::new(0x00AA, 0x1054, 13, 12, 14, 1, 6),
-    Glyph::new(0x00AB, 0x1069, 17, 17, 12, 0, 1),
-    Glyph::new(0x00AE, 0x1083, 17, 16, 15, 0, 7),
-    Glyph::new(0x00B0, 0x10A1, 15, 11, 11, 2, 9),
-    Glyph::new(0x00B1, 0x10B1, 18, 13, 18, 2, -1),
-    Glyph::new(0x00B2, 0x10CF, 13, 12, 14, 0, 10),
-    Glyph::new(0x00B3, 0x10E4, 13, 10, 14, 1, 10),
-    Glyph::new(0x00B5, 0x10F6, 18, 19, 22, -2, -7),
-    Glyph::new(0x00B6, 0x112B, 17, 19, 25, -1, -5),
-    Glyph::new(0x00B7, 0x1167, 9, 5, 6, 2, 5),
-    Glyph::new(0x00B9, 0x116B, 13, 9, 14, 1, 10),
-    Glyph::new(0x00BA, 0x117B, 13, 11, 14, 1, 6),
-    Glyph::new(0x00BB, 0x118F, 17, 17, 12, 0, 1),
-    Glyph::new(0x00BC, 0x11A9, 31, 29, 23, 1, -2),
-    Glyph::new(0x00BD, 0x11FD, 31, 28, 23, 1, -2),
-    Glyph::new(0x00BE, 0x124E, 31, 29, 23, 1, -2),
-    Glyph::new(0x00BF, 0x12A2, 12, 10, 21, 0, -6),
-    Glyph::new(0x00C0, 0x12BD, 21, 22, 28, -2, 0),
-    Glyph::new(0x00C1, 0x130A, 21, 22, 28, -2, 0),
-    Glyph::new(0x00C2, 0x1357, 21, 22, 28, -2, 0),
-    Glyph::new(0x00C3, 0x13A4, 21, 22, 27, -2, 0),
-    Glyph::new(0x00C4, 0x13EF, 21, 22, 26, -2, 0),
-    Glyph::new(0x00C5, 0x1437, 21, 22, 28, -2, 0),
-    Glyph::new(0x00C6, 0x1484, 27, 30, 20, -3, 0),
-    Glyph::new(0x00C7, 0x14CF, 19, 19, 28, 0, -8),
-    Glyph::new(0x00C8, 0x1512, 18, 19, 28, -1, 0),
-    Glyph::new(0x00C9, 0x1555, 18, 19, 28, -1, 0),
-    Glyph::new(0x00CA, 0x1598, 18, 19, 28, -1, 0),
-    Glyph::new(0x00CB, 0x15DB, 18, 19, 26, -1, 0),
-    Glyph::new(0x00CC, 0x1619, 12, 14, 28, -1, 0),
-    Glyph::new(0x00CD, 0x164A, 12, 14, 28, -1, 0),
-    Glyph::new(0x00CE, 0x167B, 12, 14, 28, -1, 0),
-    Glyph::new(0x00CF, 0x16AC, 12, 14, 26, -1, 0),
-    Glyph::new(0x00D0, 0x16DA, 21, 21, 21, -1, -1),
-    Glyph::new(0x00D1, 0x1712, 22, 25, 28, -1, -1),
-    Glyph::new(0x00D2, 0x176A, 21, 20, 29, 0, -1),
-    Glyph::new(0x00D3, 0x17B3, 21, 20, 29, 0, -1),
-    Glyph::new(0x00D4, 0x17FC, 21, 20, 29, 0, -1),
-    Glyph::new(0x00D5, 0x1845, 21, 20, 28, 0, -1),
-    Glyph::new(0x00D6, 0x188B, 21, 20, 27, 0, -1),
-    Glyph::new(0x00D7, 0x18CF, 18, 13, 13, 2, 3),
-    Glyph::new(0x00D8, 0x18E5, 21, 23, 22, -1, -1),
-    Glyph::new(0x00D9, 0x1925, 22, 22, 29, 2, -1),
-    Glyph::new(0x00DA, 0x1975, 22, 22, 29, 2, -1),
-    Glyph::new(0x00DB, 0x19C5, 22, 22, 29, 2, -1),
-    Glyph::new(0x00DC, 0x1A15, 22, 22, 27, 2, -1),
-    Glyph::new(0x00DE, 0x1A60, 17, 18, 20, -1, 0),
-    Glyph::new(0x00DF, 0x1A8D, 18, 24, 29, -6, -7),
-    Glyph::new(0x00E0, 0x1AE4, 17, 17, 25, 0, -1),
-    Glyph::new(0x00E1, 0x1B1A, 17, 17, 25, 0, -1),
-    Glyph::new(0x00E2, 0x1B50, 17, 17, 24, 0, -1),
-    Glyph::new(0x00E3, 0x1B83, 17, 17, 23, 0, -1),
-    Glyph::new(0x00E4, 0x1BB4, 17, 17, 23, 0, -1),
-    Glyph::new(0x00E5, 0x1BE5, 17, 17, 25, 0, -1),
-    Glyph::new(0x00E6, 0x1C1B, 22, 22, 16, 0, -1),
-    Glyph::new(0x00E7, 0x1C47, 13, 13, 23, 0, -8),
-    Glyph::new(0x00E8, 0x1C6D, 14, 13, 25, 0, -1),
-    Glyph::new(0x00E9, 0x1C96, 14, 14, 25, 0, -1),
-    Glyph::new(0x00EA, 0x1CC2, 14, 14, 24, 0, -1),
-    Glyph::new(0x00EB, 0x1CEC, 14, 14, 23, 0, -1),
-    Glyph::new(0x00EC, 0x1D15, 10, 8, 25, 1, -1),
-    Glyph::new(0x00ED, 0x1D2E, 10, 11, 25, 1, -1),
-    Glyph::new(0x00EE, 0x1D51, 10, 10, 24, 1, -1),
-    Glyph::new(0x00EF, 0x1D6F, 10, 11, 23, 1, -1),
-    Glyph::new(0x00F0, 0x1D8F, 16, 15, 24, 0, -1),
-    Glyph::new(0x00F1, 0x1DBC, 18, 17, 23, 0, -1),
-    Glyph::new(0x00F2, 0x1DED, 16, 15, 25, 0, -1),
-    Glyph::new(0x00F3, 0x1E1C, 16, 15, 25, 0, -1),
-    Glyph::new(0x00F4, 0x1E4B, 16, 15, 24, 0, -1),
-    Glyph::new(0x00F5, 0x1E78, 16, 16, 23, 0, -1),
-    Glyph::new(0x00F6, 0x1EA6, 16, 16, 23, 0, -1),
-    Glyph::new(0x00F7, 0x1ED4, 18, 13, 14, 2, 2),
-    Glyph::new(0x00F8, 0x1EEB, 16, 19, 17, -2, -1),
-    Glyph::new(0x00F9, 0x1F14, 18, 17, 25, 0, -1),
-    Glyph::new(0x00FA, 0x1F4A, 18, 17, 25, 0, -1),
-    Glyph::new(0x00FB, 0x1F80, 18, 17, 24, 0, -1),
-    Glyph::new(0x00FC, 0x1FB3, 18, 17, 23, 0, -1),
-    Glyph::new(0x00FE, 0x1FE4, 16, 18, 29, -3, -7),
-    Glyph::new(0x00FF, 0x2026, 15, 19, 29, -4, -7),
-    Glyph::new(0x0104, 0x206B, 21, 22, 26, -2, -6),
-    Glyph::new(0x0105, 0x20B3, 17, 17, 21, 0, -6),
-    Glyph::new(0x0106, 0x20E0, 19, 19, 29, 0, -1),
-    Glyph::new(0x0107, 0x2125, 13, 14, 25, 0, -1),
-    Glyph::new(0x010C, 0x2151, 19, 19, 29, 0, -1),
-    Glyph::new(0x010D, 0x2196, 13, 15, 25, 0, -1),
-    Glyph::new(0x010E, 0x21C5, 21, 21, 29, -1, -1),
-    Glyph::new(0x010F, 0x2212, 18, 22, 23, 0, -1),
-    Glyph::new(0x0118, 0x2252, 18, 19, 26, -1, -6),
-    Glyph::new(0x0119, 0x2290, 14, 13, 21, 0, -6),
-    Glyph::new(0x011A, 0x22B3, 18, 19, 28, -1, 0),
-    Glyph::new(0x011B, 0x22F6, 14, 15, 25, 0, -1),
-    Glyph::new(0x0139, 0x2325, 17, 17, 28, -1, 0),
-    Glyph::new(0x013A, 0x2361, 10, 11, 30, 0, -1),
-    Glyph::new(0x013D, 0x238B, 17, 18, 22, -1, 0),
-    Glyph::new(0x013E, 0x23BD, 10, 14, 23, 0, -1),
-    Glyph::new(0x0141, 0x23E6, 17, 17, 20, -1, 0),
-    Glyph::new(0x0142, 0x2411, 9, 11, 23, -1, -1),
-    Glyph::new(0x0143, 0x2431, 22, 25, 29, -1, -1),
-    Glyph::new(0x0144, 0x248C, 18, 17, 25, 0, -1),
-    Glyph::new(0x0147, 0x24C2, 22, 25, 29, -1, -1),
-    Glyph::new(0x0148, 0x251D, 18, 17, 25, 0, -1),
-    Glyph::new(0x0152, 0x2553, 28, 28, 21, 0, -1),
-    Glyph::new(0x0153, 0x259D, 23, 23, 16, 0, -1),
-    Glyph::new(0x0158, 0x25CB, 20, 20, 29, -1, -1),
-    Glyph::new(0x0159, 0x2614, 14, 15, 24, 0, 0),
-    Glyph::new(0x015A, 0x2641, 16, 16, 29, -1, -1),
-    Glyph::new(0x015B, 0x267B, 13, 14, 25, -1, -1),
-    Glyph::new(0x0160, 0x26A7, 16, 17, 29, -1, -1),
-    Glyph::new(0x0161, 0x26E5, 13, 15, 25, -1, -1),
-    Glyph::new(0x0164, 0x2714, 19, 19, 28, 1, 0),
-    Glyph::new(0x0165, 0x2757, 12, 14, 24, 0, -1),
-    Glyph::new(0x016E, 0x2781, 22, 22, 29, 2, -1),
-    Glyph::new(0x016F, 0x27D1, 18, 17, 25, 0, -1),
-    Glyph::new(0x0170, 0x2807, 22, 22, 29, 2, -1),
-    Glyph::new(0x0171, 0x2857, 18, 17, 25, 0, -1),
-    Glyph::new(0x0178, 0x288D, 19, 20, 26, 1, 0),
-    Glyph::new(0x0179, 0x28CE, 18, 18, 29, -1, -1),
-    Glyph::new(0x017A, 0x2910, 14, 15, 25, -1, -1),
-    Glyph::new(0x017B, 0x293F, 18, 18, 28, -1, -1),
-    Glyph::new(0x017C, 0x297E, 14, 15, 23, -1, -1),
-    Glyph::new(0x017D, 0x29AA, 18, 18, 29, -1, -1),
-    Glyph::new(0x017E, 0x29EC, 14, 15, 25, -1, -1),
-    Glyph::new(0x03C0, 0x2A1B, 18, 19, 16, 0, -1),
-    Glyph::new(0x1E9E, 0x2A41, 20, 21, 21, -2, -1),
-    Glyph::new(0x2013, 0x2A79, 14, 14, 4, 0, 5),
-    Glyph::new(0x2014, 0x2A80, 28, 28, 4, 0, 5),
-    Glyph::new(0x2018, 0x2A8E, 9, 7, 9, 2, 12),
-    Glyph::new(0x2019, 0x2A96, 9, 7, 9, 1, 12),
-    Glyph::new(0x201A, 0x2A9E, 9, 7, 10, 0, -6),
-    Glyph::new(0x201B, 0x2AA7, 9, 7, 10, 1, 11),
-    Glyph::new(0x201C, 0x2AB0, 15, 13, 9, 2, 12),
-    Glyph::new(0x201D, 0x2ABF, 15, 13, 10, 1, 11),
-    Glyph::new(0x201E, 0x2AD0, 14, 12, 10, 0, -6),
-    Glyph::new(0x201F, 0x2ADF, 14, 12, 10, 1, 11),
-    Glyph::new(0x2020, 0x2AEE, 14, 13, 19, 1, 1),
-    Glyph::new(0x2021, 0x2B0D, 14, 15, 22, -1, -2),
-    Glyph::new(0x2022, 0x2B37, 9, 7, 7, 1, 4),
-    Glyph::new(0x2026, 0x2B3E, 28, 24, 5, 2, -1),
-    Glyph::new(0x2039, 0x2B4D, 10, 10, 12, 0, 1),
-    Glyph::new(0x203A, 0x2B5C, 10, 9, 12, 0, 1),
-    Glyph::new(0x2070, 0x2B6A, 13, 12, 14, 0, 10),
-    Glyph::new(0x2074, 0x2B7F, 13, 12, 14, 0, 10),
-    Glyph::new(0x2075, 0x2B94, 13, 12, 13, 0, 10),
-    Glyph::new(0x2076, 0x2BA8, 13, 12, 14, 1, 10),
-    Glyph::new(0x2077, 0x2BBD, 13, 11, 13, 2, 10),
-    Glyph::new(0x2078, 0x2BCF, 13, 11, 14, 1, 10),
-    Glyph::new(0x2079, 0x2BE3, 13, 12, 14, 0, 10),
-    Glyph::new(0x2080, 0x2BF8, 13, 12, 14, 0, -5),
-    Glyph::new(0x2081, 0x2C0D, 13, 9, 14, 1, -4),
-    Glyph::new(0x2082, 0x2C1D, 13, 12, 13, 0, -4),
-    Glyph::new(0x2083, 0x2C31, 13, 10, 14, 1, -5),
-    Glyph::new(0x2084, 0x2C43, 13, 12, 13, 0, -4),
-    Glyph::new(0x2085, 0x2C57, 13, 12, 14, 0, -5),
-    Glyph::new(0x2086, 0x2C6C, 13, 12, 14, 1, -5),
-    Glyph::new(0x2087, 0x2C81, 13, 11, 14, 2, -5),
-    Glyph::new(0x2088, 0x2C95, 13, 11, 13, 1, -4),
-    Glyph::new(0x2089, 0x2CA7, 13, 12, 13, 0, -4),
-    Glyph::new(0x20AC, 0x2CBB, 18, 20, 21, -1, -1),
-    Glyph::new(0x2122, 0x2CF0, 22, 22, 10, 1, 10),
-    Glyph::new(0x2153, 0x2D0C, 31, 28, 23, 1, -2),
-    Glyph::new(0x2154, 0x2D5D, 31, 29, 23, 0, -2),
-    Glyph::new(0x215B, 0x2DB1, 31, 29, 23, 1, -2),
-    Glyph::new(0x215C, 0x2E05, 31, 29, 23, 1, -2),
-    Glyph::new(0x215D, 0x2E59, 31, 30, 23, 0, -2),
-    Glyph::new(0x215E, 0x2EB0, 31, 28, 23, 2, -2),
-    Glyph::new(0x2190, 0x2F01, 28, 18, 13, 5, 3),
-    Glyph::new(0x2191, 0x2F1F, 28, 14, 19, 7, 0),
-    Glyph::new(0x2192, 0x2F41, 28, 18, 13, 5, 3),
-    Glyph::new(0x2193, 0x2F5F, 28, 14, 19, 7, 0),
-    Glyph::new(0x2194, 0x2F81, 28, 18, 13, 5, 3),
-    Glyph::new(0x2195, 0x2F9F, 28, 12, 19, 8, 0),
-    Glyph::new(0x21D0, 0x2FBC, 28, 18, 16, 5, 2),
-    Glyph::new(0x21D1, 0x2FE0, 28, 16, 18, 6, 1),
-    Glyph::new(0x21D2, 0x3004, 28, 18, 16, 5, 2),
-    Glyph::new(0x21D3, 0x3028, 28, 16, 18, 6, 1),
-    Glyph::new(0x21D4, 0x304C, 28, 18, 15, 5, 2),
-    Glyph::new(0x2202, 0x306E, 18, 15, 23, 1, -1),
-    Glyph::new(0x2206, 0x309A, 20, 19, 20, 0, 0),
-    Glyph::new(0x220F, 0x30CA, 24, 23, 25, 0, -5),
-    Glyph::new(0x2211, 0x3112, 19, 18, 25, 0, -5),
-    Glyph::new(0x221A, 0x314B, 18, 19, 27, -1, -4),
-    Glyph::new(0x221E, 0x318C, 18, 18, 11, 0, 3),
-    Glyph::new(0x222B, 0x31A5, 18, 16, 29, 1, -7),
-    Glyph::new(0x2260, 0x31DF, 18, 13, 15, 2, 2),
-    Glyph::new(0x2264, 0x31F8, 18, 13, 17, 2, 0),
-    Glyph::new(0x2265, 0x3214, 18, 13, 18, 2, 0),
+    Glyph::new(0x0022, 0x0028, 12, 11, 11, 1, 10),
+    Glyph::new(0x0023, 0x0049, 18, 18, 18, 0, -2),
+    Glyph::new(0x0024, 0x0088, 18, 16, 29, 1, -6),
+    Glyph::new(0x0025, 0x00E0, 28, 26, 23, 1, -2),
+    Glyph::new(0x0026, 0x0158, 25, 23, 23, 1, -2),
+    Glyph::new(0x0027, 0x01BC, 7, 6, 11, 1, 10),
+    Glyph::new(0x0028, 0x01CD, 12, 12, 29, 1, -6),
+    Glyph::new(0x0029, 0x0202, 12, 13, 29, -2, -6),
+    Glyph::new(0x002A, 0x023C, 11, 11, 10, 1, 11),
+    Glyph::new(0x002B, 0x0256, 18, 13, 13, 2, 3),
+    Glyph::new(0x002C, 0x0272, 9, 8, 9, -1, -5),
+    Glyph::new(0x002D, 0x0283, 11, 9, 4, 1, 5),
+    Glyph::new(0x002E, 0x028F, 9, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x0297, 15, 17, 23, -1, -2),
+    Glyph::new(0x0030, 0x02C1, 18, 17, 21, 0, -1),
+    Glyph::new(0x0031, 0x0305, 18, 12, 20, 2, 0),
+    Glyph::new(0x0032, 0x0331, 18, 17, 20, 0, 0),
+    Glyph::new(0x0033, 0x0369, 18, 16, 21, 0, -1),
+    Glyph::new(0x0034, 0x03A3, 18, 17, 20, 0, 0),
+    Glyph::new(0x0035, 0x03E1, 18, 16, 21, 1, -1),
+    Glyph::new(0x0036, 0x0411, 18, 17, 21, 1, -1),
+    Glyph::new(0x0037, 0x044F, 18, 15, 21, 3, -1),
+    Glyph::new(0x0038, 0x0481, 18, 17, 21, 0, -1),
+    Glyph::new(0x0039, 0x04C5, 18, 18, 21, -1, -1),
+    Glyph::new(0x003A, 0x0502, 9, 8, 16, 1, -1),
+    Glyph::new(0x003B, 0x0516, 9, 10, 20, -1, -5),
+    Glyph::new(0x003C, 0x0536, 18, 13, 13, 2, 3),
+    Glyph::new(0x003D, 0x0557, 18, 13, 9, 2, 5),
+    Glyph::new(0x003E, 0x0578, 18, 13, 13, 2, 3),
+    Glyph::new(0x003F, 0x0596, 12, 10, 22, 2, -1),
+    Glyph::new(0x0040, 0x05C6, 28, 26, 26, 1, -6),
+    Glyph::new(0x0041, 0x064B, 21, 22, 20, -2, 0),
+    Glyph::new(0x0042, 0x068D, 18, 18, 21, -1, -1),
+    Glyph::new(0x0043, 0x06D4, 19, 19, 21, 0, -1),
+    Glyph::new(0x0044, 0x0714, 21, 21, 21, -1, -1),
+    Glyph::new(0x0045, 0x0764, 18, 19, 20, -1, 0),
+    Glyph::new(0x0046, 0x07A4, 17, 18, 20, -1, 0),
+    Glyph::new(0x0047, 0x07E0, 21, 20, 21, 0, -1),
+    Glyph::new(0x0048, 0x082A, 23, 25, 20, -1, 0),
+    Glyph::new(0x0049, 0x087F, 12, 14, 20, -1, 0),
+    Glyph::new(0x004A, 0x08AE, 11, 18, 26, -5, -6),
+    Glyph::new(0x004B, 0x08EB, 20, 23, 21, -1, -1),
+    Glyph::new(0x004C, 0x0939, 17, 17, 20, -1, 0),
+    Glyph::new(0x004D, 0x0969, 26, 27, 20, -2, 0),
+    Glyph::new(0x004E, 0x09D5, 22, 25, 21, -1, -1),
+    Glyph::new(0x004F, 0x0A33, 21, 20, 21, 0, -1),
+    Glyph::new(0x0050, 0x0A7D, 18, 19, 20, -1, 0),
+    Glyph::new(0x0051, 0x0ABB, 21, 24, 27, 0, -7),
+    Glyph::new(0x0052, 0x0B1E, 20, 20, 21, -1, -1),
+    Glyph::new(0x0053, 0x0B6A, 16, 16, 21, -1, -1),
+    Glyph::new(0x0054, 0x0BAC, 19, 19, 20, 1, 0),
+    Glyph::new(0x0055, 0x0BE9, 22, 22, 21, 2, -1),
+    Glyph::new(0x0056, 0x0C3C, 21, 22, 21, 1, -1),
+    Glyph::new(0x0057, 0x0C83, 28, 28, 21, 2, -1),
+    Glyph::new(0x0058, 0x0CED, 19, 24, 20, -3, 0),
+    Glyph::new(0x0059, 0x0D3B, 19, 20, 20, 1, 0),
+    Glyph::new(0x005A, 0x0D7D, 18, 18, 21, -1, -1),
+    Glyph::new(0x005B, 0x0DC2, 10, 13, 27, -2, -5),
+    Glyph::new(0x005C, 0x0DFB, 15, 12, 23, 1, -2),
+    Glyph::new(0x005D, 0x0E24, 10, 13, 27, -2, -5),
+    Glyph::new(0x005E, 0x0E5C, 18, 15, 13, 1, 5),
+    Glyph::new(0x005F, 0x0E82, 14, 14, 4, 0, -5),
+    Glyph::new(0x0060, 0x0E8C, 18, 7, 8, 5, 16),
+    Glyph::new(0x0061, 0x0E97, 17, 17, 16, 0, -1),
+    Glyph::new(0x0062, 0x0ED0, 16, 15, 23, 0, -1),
+    Glyph::new(0x0063, 0x0F17, 13, 13, 16, 0, -1),
+    Glyph::new(0x0064, 0x0F3A, 17, 17, 23, 0, -1),
+    Glyph::new(0x0065, 0x0F80, 14, 13, 16, 0, -1),
+    Glyph::new(0x0066, 0x0FAD, 12, 22, 29, -6, -7),
+    Glyph::new(0x0067, 0x0FFB, 15, 19, 22, -2, -7),
+    Glyph::new(0x0068, 0x104B, 17, 16, 23, 0, -1),
+    Glyph::new(0x0069, 0x1091, 10, 9, 23, 1, -1),
+    Glyph::new(0x006A, 0x10BB, 9, 16, 29, -6, -7),
+    Glyph::new(0x006B, 0x10F7, 15, 15, 23, 0, -1),
+    Glyph::new(0x006C, 0x113E, 10, 9, 23, 0, -1),
+    Glyph::new(0x006D, 0x1169, 25, 24, 16, 0, -1),
+    Glyph::new(0x006E, 0x11BC, 18, 17, 16, 0, -1),
+    Glyph::new(0x006F, 0x11FA, 16, 15, 16, 0, -1),
+    Glyph::new(0x0070, 0x1229, 17, 19, 22, -3, -7),
+    Glyph::new(0x0071, 0x1271, 16, 16, 22, 0, -7),
+    Glyph::new(0x0072, 0x12B5, 14, 14, 15, 0, 0),
+    Glyph::new(0x0073, 0x12DC, 13, 13, 16, -1, -1),
+    Glyph::new(0x0074, 0x1304, 12, 12, 20, 0, -1),
+    Glyph::new(0x0075, 0x1331, 18, 17, 16, 0, -1),
+    Glyph::new(0x0076, 0x136B, 15, 15, 16, 0, -1),
+    Glyph::new(0x0077, 0x139C, 22, 21, 16, 0, -1),
+    Glyph::new(0x0078, 0x13E9, 17, 18, 16, -1, -1),
+    Glyph::new(0x0079, 0x141E, 15, 19, 22, -4, -7),
+    Glyph::new(0x007A, 0x1466, 14, 15, 16, -1, -1),
+    Glyph::new(0x007B, 0x1497, 12, 12, 28, 1, -5),
+    Glyph::new(0x007C, 0x14CC, 9, 10, 26, -1, -4),
+    Glyph::new(0x007D, 0x14F8, 12, 13, 28, -2, -5),
+    Glyph::new(0x007E, 0x1534, 18, 14, 6, 2, 6),
+    Glyph::new(0x00A1, 0x1546, 10, 10, 22, -1, -7),
+    Glyph::new(0x00A2, 0x156D, 18, 15, 28, 1, -6),
+    Glyph::new(0x00A3, 0x15B7, 18, 19, 21, -1, -1),
+    Glyph::new(0x00A4, 0x15F5, 18, 18, 15, 0, 2),
+    Glyph::new(0x00A5, 0x1625, 18, 19, 20, 1, 0),
+    Glyph::new(0x00A7, 0x1667, 15, 14, 23, -1, -3),
+    Glyph::new(0x00A9, 0x16AE, 22, 22, 21, 0, -1),
+    Glyph::new(0x00AA, 0x1717, 13, 12, 14, 1, 6),
+    Glyph::new(0x00AB, 0x1745, 17, 17, 12, 0, 1),
+    Glyph::new(0x00AE, 0x176E, 17, 16, 15, 0, 7),
+    Glyph::new(0x00B0, 0x17BD, 15, 11, 11, 2, 9),
+    Glyph::new(0x00B1, 0x17DD, 18, 13, 18, 2, -1),
+    Glyph::new(0x00B2, 0x1807, 13, 12, 14, 0, 10),
+    Glyph::new(0x00B3, 0x182D, 13, 10, 14, 1, 10),
+    Glyph::new(0x00B5, 0x184D, 18, 19, 22, -2, -7),
+    Glyph::new(0x00B6, 0x189A, 17, 19, 25, -1, -5),
+    Glyph::new(0x00B7, 0x18F3, 9, 5, 6, 2, 5),
+    Glyph::new(0x00B9, 0x18FA, 13, 9, 14, 1, 10),
+    Glyph::new(0x00BA, 0x1918, 13, 11, 14, 1, 6),
+    Glyph::new(0x00BB, 0x1942, 17, 17, 12, 0, 1),
+    Glyph::new(0x00BC, 0x196E, 31, 29, 23, 1, -2),
+    Glyph::new(0x00BD, 0x19DF, 31, 28, 23, 1, -2),
+    Glyph::new(0x00BE, 0x1A4A, 31, 29, 23, 1, -2),
+    Glyph::new(0x00BF, 0x1ABB, 12, 10, 21, 0, -6),
+    Glyph::new(0x00C0, 0x1AE8, 21, 22, 28, -2, 0),
+    Glyph::new(0x00C1, 0x1B3A, 21, 22, 28, -2, 0),
+    Glyph::new(0x00C2, 0x1B8D, 21, 22, 28, -2, 0),
+    Glyph::new(0x00C3, 0x1BE3, 21, 22, 27, -2, 0),
+    Glyph::new(0x00C4, 0x1C35, 21, 22, 26, -2, 0),
+    Glyph::new(0x00C5, 0x1C89, 21, 22, 28, -2, 0),
+    Glyph::new(0x00C6, 0x1CE0, 27, 30, 20, -3, 0),
+    Glyph::new(0x00C7, 0x1D41, 19, 19, 28, 0, -8),
+    Glyph::new(0x00C8, 0x1D8F, 18, 19, 28, -1, 0),
+    Glyph::new(0x00C9, 0x1DDF, 18, 19, 28, -1, 0),
+    Glyph::new(0x00CA, 0x1E2E, 18, 19, 28, -1, 0),
+    Glyph::new(0x00CB, 0x1E82, 18, 19, 26, -1, 0),
+    Glyph::new(0x00CC, 0x1ED4, 12, 14, 28, -1, 0),
+    Glyph::new(0x00CD, 0x1F10, 12, 14, 28, -1, 0),
+    Glyph::new(0x00CE, 0x1F4E, 12, 14, 28, -1, 0),
+    Glyph::new(0x00CF, 0x1F8F, 12, 14, 26, -1, 0),
+    Glyph::new(0x00D0, 0x1FCE, 21, 21, 21, -1, -1),
+    Glyph::new(0x00D1, 0x2023, 22, 25, 28, -1, -1),
+    Glyph::new(0x00D2, 0x2094, 21, 20, 29, 0, -1),
+    Glyph::new(0x00D3, 0x20EE, 21, 20, 29, 0, -1),
+    Glyph::new(0x00D4, 0x2148, 21, 20, 29, 0, -1),
+    Glyph::new(0x00D5, 0x21A6, 21, 20, 28, 0, -1),
+    Glyph::new(0x00D6, 0x2201, 21, 20, 27, 0, -1),
+    Glyph::new(0x00D7, 0x225C, 18, 13, 13, 2, 3),
+    Glyph::new(0x00D8, 0x2282, 21, 23, 22, -1, -1),
+    Glyph::new(0x00D9, 0x22E1, 22, 22, 29, 2, -1),
+    Glyph::new(0x00DA, 0x2344, 22, 22, 29, 2, -1),
+    Glyph::new(0x00DB, 0x23A7, 22, 22, 29, 2, -1),
+    Glyph::new(0x00DC, 0x240E, 22, 22, 27, 2, -1),
+    Glyph::new(0x00DE, 0x2471, 17, 18, 20, -1, 0),
+    Glyph::new(0x00DF, 0x24AD, 18, 24, 29, -6, -7),
+    Glyph::new(0x00E0, 0x2516, 17, 17, 25, 0, -1),
+    Glyph::new(0x00E1, 0x255F, 17, 17, 25, 0, -1),
+    Glyph::new(0x00E2, 0x25A8, 17, 17, 24, 0, -1),
+    Glyph::new(0x00E3, 0x25F4, 17, 17, 23, 0, -1),
+    Glyph::new(0x00E4, 0x263D, 17, 17, 23, 0, -1),
+    Glyph::new(0x00E5, 0x2689, 17, 17, 25, 0, -1),
+    Glyph::new(0x00E6, 0x26D9, 22, 22, 16, 0, -1),
+    Glyph::new(0x00E7, 0x2722, 13, 13, 23, 0, -8),
+    Glyph::new(0x00E8, 0x2755, 14, 13, 25, 0, -1),
+    Glyph::new(0x00E9, 0x2791, 14, 14, 25, 0, -1),
+    Glyph::new(0x00EA, 0x27CF, 14, 14, 24, 0, -1),
+    Glyph::new(0x00EB, 0x280D, 14, 14, 23, 0, -1),
+    Glyph::new(0x00EC, 0x284B, 10, 8, 25, 1, -1),
+    Glyph::new(0x00ED, 0x2877, 10, 11, 25, 1, -1),
+    Glyph::new(0x00EE, 0x28A3, 10, 10, 24, 1, -1),
+    Glyph::new(0x00EF, 0x28D6, 10, 11, 23, 1, -1),
+    Glyph::new(0x00F0, 0x2908, 16, 15, 24, 0, -1),
+    Glyph::new(0x00F1, 0x294A, 18, 17, 23, 0, -1),
+    Glyph::new(0x00F2, 0x2998, 16, 15, 25, 0, -1),
+    Glyph::new(0x00F3, 0x29D6, 16, 15, 25, 0, -1),
+    Glyph::new(0x00F4, 0x2A15, 16, 15, 24, 0, -1),
+    Glyph::new(0x00F5, 0x2A57, 16, 16, 23, 0, -1),
+    Glyph::new(0x00F6, 0x2A96, 16, 16, 23, 0, -1),
+    Glyph::new(0x00F7, 0x2AD6, 18, 13, 14, 2, 2),
+    Glyph::new(0x00F8, 0x2AF8, 16, 19, 17, -2, -1),
+    Glyph::new(0x00F9, 0x2B36, 18, 17, 25, 0, -1),
+    Glyph::new(0x00FA, 0x2B7F, 18, 17, 25, 0, -1),
+    Glyph::new(0x00FB, 0x2BC8, 18, 17, 24, 0, -1),
+    Glyph::new(0x00FC, 0x2C15, 18, 17, 23, 0, -1),
+    Glyph::new(0x00FE, 0x2C63, 16, 18, 29, -3, -7),
+    Glyph::new(0x00FF, 0x2CC0, 15, 19, 29, -4, -7),
+    Glyph::new(0x0104, 0x2D1C, 21, 22, 26, -2, -6),
+    Glyph::new(0x0105, 0x2D6F, 17, 17, 21, 0, -6),
+    Glyph::new(0x0106, 0x2DB4, 19, 19, 29, 0, -1),
+    Glyph::new(0x0107, 0x2E02, 13, 14, 25, 0, -1),
+    Glyph::new(0x010C, 0x2E38, 19, 19, 29, 0, -1),
+    Glyph::new(0x010D, 0x2E8C, 13, 15, 25, 0, -1),
+    Glyph::new(0x010E, 0x2ECA, 21, 21, 29, -1, -1),
+    Glyph::new(0x010F, 0x2F2F, 18, 22, 23, 0, -1),
+    Glyph::new(0x0118, 0x2F85, 18, 19, 26, -1, -6),
+    Glyph::new(0x0119, 0x2FD6, 14, 13, 21, 0, -6),
+    Glyph::new(0x011A, 0x300D, 18, 19, 28, -1, 0),
+    Glyph::new(0x011B, 0x3061, 14, 15, 25, 0, -1),
+    Glyph::new(0x0139, 0x30A5, 17, 17, 28, -1, 0),
+    Glyph::new(0x013A, 0x30E4, 10, 11, 30, 0, -1),
+    Glyph::new(0x013D, 0x311D, 17, 18, 22, -1, 0),
+    Glyph::new(0x013E, 0x3160, 10, 14, 23, 0, -1),
+    Glyph::new(0x0141, 0x319D, 17, 17, 20, -1, 0),
+    Glyph::new(0x0142, 0x31D5, 9, 11, 23, -1, -1),
+    Glyph::new(0x0143, 0x3204, 22, 25, 29, -1, -1),
+    Glyph::new(0x0144, 0x3274, 18, 17, 25, 0, -1),
+    Glyph::new(0x0147, 0x32C2, 22, 25, 29, -1, -1),
+    Glyph::new(0x0148, 0x3338, 18, 17, 25, 0, -1),
+    Glyph::new(0x0152, 0x338E, 28, 28, 21, 0, -1),
+    Glyph::new(0x0153, 0x33FA, 23, 23, 16, 0, -1),
+    Glyph::new(0x0158, 0x3444, 20, 20, 29, -1, -1),
+    Glyph::new(0x0159, 0x34A3, 14, 15, 24, 0, 0),
+    Glyph::new(0x015A, 0x34E3, 16, 16, 29, -1, -1),
+    Glyph::new(0x015B, 0x3535, 13, 14, 25, -1, -1),
+    Glyph::new(0x0160, 0x356F, 16, 17, 29, -1, -1),
+    Glyph::new(0x0161, 0x35C8, 13, 15, 25, -1, -1),
+    Glyph::new(0x0164, 0x3607, 19, 19, 28, 1, 0),
+    Glyph::new(0x0165, 0x365A, 12, 14, 24, 0, -1),
+    Glyph::new(0x016E, 0x3693, 22, 22, 29, 2, -1),
+    Glyph::new(0x016F, 0x36FF, 18, 17, 25, 0, -1),
+    Glyph::new(0x0170, 0x3753, 22, 22, 29, 2, -1),
+    Glyph::new(0x0171, 0x37C0, 18, 17, 25, 0, -1),
+    Glyph::new(0x0178, 0x3813, 19, 20, 26, 1, 0),
+    Glyph::new(0x0179, 0x3866, 18, 18, 29, -1, -1),
+    Glyph::new(0x017A, 0x38BA, 14, 15, 25, -1, -1),
+    Glyph::new(0x017B, 0x38FC, 18, 18, 28, -1, -1),
+    Glyph::new(0x017C, 0x394E, 14, 15, 23, -1, -1),
+    Glyph::new(0x017D, 0x398B, 18, 18, 29, -1, -1),
+    Glyph::new(0x017E, 0x39E5, 14, 15, 25, -1, -1),
+    Glyph::new(0x03C0, 0x3A2D, 18, 19, 16, 0, -1),
+    Glyph::new(0x1E9E, 0x3A6B, 20, 21, 21, -2, -1),
+    Glyph::new(0x2013, 0x3ABE, 14, 14, 4, 0, 5),
+    Glyph::new(0x2014, 0x3AC8, 28, 28, 4, 0, 5),
+    Glyph::new(0x2018, 0x3ADB, 9, 7, 9, 2, 12),
+    Glyph::new(0x2019, 0x3AEB, 9, 7, 9, 1, 12),
+    Glyph::new(0x201A, 0x3AFB, 9, 7, 10, 0, -6),
+    Glyph::new(0x201B, 0x3B0B, 9, 7, 10, 1, 11),
+    Glyph::new(0x201C, 0x3B1C, 15, 13, 9, 2, 12),
+    Glyph::new(0x201D, 0x3B3A, 15, 13, 10, 1, 11),
+    Glyph::new(0x201E, 0x3B58, 14, 12, 10, 0, -6),
+    Glyph::new(0x201F, 0x3B77, 14, 12, 10, 1, 11),
+    Glyph::new(0x2020, 0x3B97, 14, 13, 19, 1, 1),
+    Glyph::new(0x2021, 0x3BC6, 14, 15, 22, -1, -2),
+    Glyph::new(0x2022, 0x3C04, 9, 7, 7, 1, 4),
+    Glyph::new(0x2026, 0x3C11, 28, 24, 5, 2, -1),
+    Glyph::new(0x2039, 0x3C2C, 10, 10, 12, 0, 1),
+    Glyph::new(0x203A, 0x3C42, 10, 9, 12, 0, 1),
+    Glyph::new(0x2070, 0x3C59, 13, 12, 14, 0, 10),
+    Glyph::new(0x2074, 0x3C82, 13, 12, 14, 0, 10),
+    Glyph::new(0x2075, 0x3CA2, 13, 12, 13, 0, 10),
+    Glyph::new(0x2076, 0x3CC2, 13, 12, 14, 1, 10),
+    Glyph::new(0x2077, 0x3CE8, 13, 11, 13, 2, 10),
+    Glyph::new(0x2078, 0x3D09, 13, 11, 14, 1, 10),
+    Glyph::new(0x2079, 0x3D30, 13, 12, 14, 0, 10),
+    Glyph::new(0x2080, 0x3D55, 13, 12, 14, 0, -5),
+    Glyph::new(0x2081, 0x3D7D, 13, 9, 14, 1, -4),
+    Glyph::new(0x2082, 0x3D9C, 13, 12, 13, 0, -4),
+    Glyph::new(0x2083, 0x3DC2, 13, 10, 14, 1, -5),
+    Glyph::new(0x2084, 0x3DDF, 13, 12, 13, 0, -4),
+    Glyph::new(0x2085, 0x3DFF, 13, 12, 14, 0, -5),
+    Glyph::new(0x2086, 0x3E1F, 13, 12, 14, 1, -5),
+    Glyph::new(0x2087, 0x3E46, 13, 11, 14, 2, -5),
+    Glyph::new(0x2088, 0x3E67, 13, 11, 13, 1, -4),
+    Glyph::new(0x2089, 0x3E8D, 13, 12, 13, 0, -4),
+    Glyph::new(0x20AC, 0x3EB2, 18, 20, 21, -1, -1),
+    Glyph::new(0x2122, 0x3EF4, 22, 22, 10, 1, 10),
+    Glyph::new(0x2153, 0x3F3A, 31, 28, 23, 1, -2),
+    Glyph::new(0x2154, 0x3FA5, 31, 29, 23, 0, -2),
+    Glyph::new(0x215B, 0x4016, 31, 29, 23, 1, -2),
+    Glyph::new(0x215C, 0x4088, 31, 29, 23, 1, -2),
+    Glyph::new(0x215D, 0x40FE, 31, 30, 23, 0, -2),
+    Glyph::new(0x215E, 0x4174, 31, 28, 23, 2, -2),
+    Glyph::new(0x2190, 0x41E7, 28, 18, 13, 5, 3),
+    Glyph::new(0x2191, 0x4209, 28, 14, 19, 7, 0),
+    Glyph::new(0x2192, 0x423E, 28, 18, 13, 5, 3),
+    Glyph::new(0x2193, 0x425F, 28, 14, 19, 7, 0),
+    Glyph::new(0x2194, 0x4294, 28, 18, 13, 5, 3),
+    Glyph::new(0x2195, 0x42C3, 28, 12, 19, 8, 0),
+    Glyph::new(0x21D0, 0x42F8, 28, 18, 16, 5, 2),
+    Glyph::new(0x21D1, 0x432E, 28, 16, 18, 6, 1),
+    Glyph::new(0x21D2, 0x436D, 28, 18, 16, 5, 2),
+    Glyph::new(0x21D3, 0x43A4, 28, 16, 18, 6, 1),
+    Glyph::new(0x21D4, 0x43E0, 28, 18, 15, 5, 2),
+    Glyph::new(0x2202, 0x441F, 18, 15, 23, 1, -1),
+    Glyph::new(0x2206, 0x4464, 20, 19, 20, 0, 0),
+    Glyph::new(0x220F, 0x44A3, 24, 23, 25, 0, -5),
+    Glyph::new(0x2211, 0x450C, 19, 18, 25, 0, -5),
+    Glyph::new(0x221A, 0x455B, 18, 19, 27, -1, -4),
+    Glyph::new(0x221E, 0x45A4, 18, 18, 11, 0, 3),
+    Glyph::new(0x222B, 0x45D3, 18, 16, 29, 1, -7),
+    Glyph::new(0x2260, 0x4616, 18, 13, 15, 2, 2),
+    Glyph::new(0x2264, 0x463D, 18, 13, 17, 2, 0),
+    Glyph::new(0x2265, 0x4666, 18, 13, 18, 2, 0),
+    Glyph::new(0xFB01, 0x4690, 22, 28, 29, -6, -7),
+    Glyph::new(0xFB02, 0x4700, 22, 27, 29, -6, -7),
 ];
 
-const BITMAP_BW: &[u8; 12850] = include_bytes!("./bookerly_bold_italic_28.bw");
-const BITMAP_MSB: &[u8; 12850] = include_bytes!("./bookerly_bold_italic_28.msb");
-const BITMAP_LSB: &[u8; 12850] = include_bytes!("./bookerly_bold_italic_28.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (2, 2),
+    (3, 3), (4, 4), (0, 0), (0, 0), (5, 5), (6, 6), (7, 7), (8, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (9, 9), (10, 10), (0, 0), (0, 0), (0, 0), (11, 11),
+    (0, 0), (12, 12), (13, 13), (14, 14), (15, 15), (16, 16), (17, 16), (18, 14),
+    (19, 16), (20, 17), (21, 18), (22, 16), (23, 16), (24, 19), (25, 20), (26, 14),
+    (27, 13), (28, 14), (29, 21), (30, 22), (31, 23), (32, 24), (33, 25), (34, 26),
+    (35, 27), (36, 28), (37, 29), (38, 30), (0, 0), (39, 31), (0, 0), (0, 0),
+    (0, 0), (40, 32), (41, 33), (42, 32), (43, 32), (44, 32), (45, 34), (46, 35),
+    (47, 36), (48, 37), (49, 38), (50, 36), (51, 39), (47, 40), (52, 40), (53, 32),
+    (54, 41), (55, 32), (56, 40), (57, 42), (58, 43), (59, 44), (60, 45), (61, 46),
+    (62, 47), (63, 48), (64, 49), (65, 50), (0, 0), (66, 51), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (67, 52), (68, 53),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (59, 54), (0, 0), (0, 0),
+    (0, 0), (69, 55), (70, 56), (0, 0), (0, 0), (0, 0), (0, 0), (12, 12),
+    (12, 12), (12, 12), (12, 12), (12, 12), (12, 12), (71, 57), (72, 14), (16, 16),
+    (16, 16), (16, 16), (16, 16), (20, 17), (20, 17), (73, 58), (74, 58), (15, 0),
+    (25, 20), (26, 14), (26, 14), (26, 14), (26, 14), (26, 14), (0, 0), (75, 59),
+    (32, 24), (32, 24), (32, 24), (32, 24), (76, 16), (77, 60), (40, 61), (40, 32),
+    (40, 62), (40, 61), (40, 61), (40, 32), (78, 32), (79, 32), (44, 63), (80, 32),
+    (81, 64), (82, 63), (83, 65), (84, 66), (85, 67), (86, 68), (87, 61), (88, 69),
+    (53, 70), (89, 32), (90, 62), (91, 61), (91, 61), (0, 0), (92, 71), (59, 66),
+    (59, 44), (59, 44), (93, 66), (94, 36), (95, 72), (96, 12), (97, 32), (14, 14),
+    (98, 32), (14, 14), (98, 61), (15, 15), (99, 32), (100, 16), (101, 32), (16, 16),
+    (102, 61), (23, 16), (51, 39), (103, 16), (99, 39), (104, 73), (105, 74), (25, 20),
+    (52, 40), (25, 20), (52, 69), (106, 14), (78, 32), (29, 21), (107, 69), (30, 22),
+    (108, 42), (30, 22), (109, 75), (31, 23), (110, 43), (32, 24), (59, 44), (32, 24),
+    (93, 44), (36, 28), (37, 29), (111, 49), (37, 29), (64, 76), (37, 29), (111, 77),
+    (112, 78), (113, 79), (114, 80), (114, 80), (115, 81), (116, 82), (5, 83), (0, 0),
+    (115, 81), (117, 84), (118, 83), (0, 0), (0, 0), (0, 0), (0, 0), (119, 85),
+    (68, 53), (70, 56), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (48, 34), (51, 34),
+];
+
+const KERNING: [&[i8]; 120] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -2, -1, -2],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -2, -1, -1, -1, -2, -1, 0, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -2, 0, 0, -2, -2, -1, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -2, -2, -2, -2, -2, 0, -2, -1, 0, -1, -2, 0, -1, -2, -1, 0, -1, 0, -1, -2, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -2, -1, -2, -1, 0, -1, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, -2, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -2, -2, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, -1, -2, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -2, 0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -2, -2, 0, -1, -2, -2, -2, -1, -1, 0, -1, 0, 0, -1, -2, -2, -1, 0, 0, -1, -1, -1, -2, -2, -2, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, -2, -2, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, -1, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -2, -2, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -2, 0, -2],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -2, -1, -2],
+    &[0, 0, 0, -1, 0, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0],
+    &[0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, -2, 0, -2, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, -1, -2, -2, -1, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -2, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, -1, 0, -2, -2, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, -2, -2, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, -1, -1, -1, -2, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -2, -2, -2, -2, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -2, -1, -1, -2, -1, 0, -1, 0, -1, -2, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -2, -1, -1, -1, 0, -1, 0, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2],
+    &[0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -2, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, -2, -2, 0, -2, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -2, -2, -2, -2, -2, -1, -1, -1, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -2, 0, 0, -2, -2, -2, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -2, 0, -1, -2, -1, 0, -1, 0, -1, -2, -1, -1, 0, -1, 0, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, -2, -1, -1, -1, 0, -1, 0, -2],
+    &[0, -1, -1, 0, -1, -2, 0, -2, -1, -2, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -1, -1, 0, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -2, -1, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -2, -1, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -2, -1, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, -2, -2, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -2, -1, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, -2, -1, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1],
+    &[0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -2, -2, -2, -1, -1, -1, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, -1, 0, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, -2, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -2, -1, -1, -1, 0, -1, -2, -2, 0, -1, 0, -1, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -2, 0, -1, -1, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, -1, -2, -2, -1, -1, 0, -2, -1, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -2, 0, -1, -1, 0, -1, -1, -2, -1, -1, 0, 0, -1, 0, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, -1, -2, -2, -2, -2, -1, -1, -1, 0, 0, -1, -2, -2, 0, -1, 0, -2, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+];
+
+const BITMAP: &[u8; 18287] = include_bytes!("./bookerly_bold_italic_28.rle");
@@ -1,308 +1,531 @@
 // Auto-generated font file
 // Font: Bookerly Bold Italic
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 14753,
+    size: 20057,
     y_advance: 30,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 11, 10, 24, 1, -1),
-    Glyph::new(0x0022, 0x001E, 12, 12, 11, 1, 11),
-    Glyph::new(0x0023, 0x002F, 19, 19, 20, 0, -2),
-    Glyph::new(0x0024, 0x005F, 19, 17, 30, 1, -6),
-    Glyph::new(0x0025, 0x009F, 30, 27, 24, 1, -2),
-    Glyph::new(0x0026, 0x00F0, 27, 25, 24, 1, -2),
-    Glyph::new(0x0027, 0x013B, 7, 6, 11, 1, 11),
-    Glyph::new(0x0028, 0x0144, 13, 13, 30, 1, -6),
-    Glyph::new(0x0029, 0x0175, 13, 14, 30, -2, -6),
-    Glyph::new(0x002A, 0x01AA, 12, 12, 12, 1, 11),
-    Glyph::new(0x002B, 0x01BC, 19, 14, 14, 2, 3),
-    Glyph::new(0x002C, 0x01D5, 10, 9, 10, -2, -5),
-    Glyph::new(0x002D, 0x01E1, 12, 10, 4, 1, 6),
-    Glyph::new(0x002E, 0x01E6, 10, 6, 6, 1, -1),
-    Glyph::new(0x002F, 0x01EB, 16, 18, 24, -1, -2),
-    Glyph::new(0x0030, 0x0221, 19, 19, 22, 0, -1),
-    Glyph::new(0x0031, 0x0256, 19, 13, 22, 2, 0),
-    Glyph::new(0x0032, 0x027A, 19, 18, 21, 0, 0),
-    Glyph::new(0x0033, 0x02AA, 19, 17, 22, 0, -1),
-    Glyph::new(0x0034, 0x02D9, 19, 18, 21, 0, 0),
-    Glyph::new(0x0035, 0x0309, 19, 18, 22, 1, -1),
-    Glyph::new(0x0036, 0x033B, 19, 18, 22, 1, -1),
-    Glyph::new(0x0037, 0x036D, 19, 17, 22, 3, -1),
-    Glyph::new(0x0038, 0x039C, 19, 17, 22, 1, -1),
-    Glyph::new(0x0039, 0x03CB, 19, 19, 22, -1, -1),
-    Glyph::new(0x003A, 0x0400, 10, 9, 17, 1, -1),
-    Glyph::new(0x003B, 0x0414, 10, 12, 21, -2, -5),
-    Glyph::new(0x003C, 0x0434, 19, 14, 14, 2, 3),
-    Glyph::new(0x003D, 0x044D, 19, 14, 10, 2, 5),
-    Glyph::new(0x003E, 0x045F, 19, 14, 14, 2, 3),
-    Glyph::new(0x003F, 0x0478, 13, 10, 23, 2, -1),
-    Glyph::new(0x0040, 0x0495, 30, 28, 27, 1, -6),
-    Glyph::new(0x0041, 0x04F4, 23, 24, 22, -2, 0),
-    Glyph::new(0x0042, 0x0536, 19, 20, 23, -2, -1),
-    Glyph::new(0x0043, 0x0570, 20, 20, 23, 0, -1),
-    Glyph::new(0x0044, 0x05AA, 22, 24, 23, -2, -1),
-    Glyph::new(0x0045, 0x05EF, 19, 21, 21, -2, 0),
-    Glyph::new(0x0046, 0x0627, 18, 20, 21, -2, 0),
-    Glyph::new(0x0047, 0x065C, 22, 21, 23, 0, -1),
-    Glyph::new(0x0048, 0x0699, 25, 28, 21, -2, 0),
-    Glyph::new(0x0049, 0x06E3, 12, 16, 21, -2, 0),
-    Glyph::new(0x004A, 0x070D, 12, 20, 27, -6, -6),
-    Glyph::new(0x004B, 0x0751, 22, 25, 22, -2, -1),
-    Glyph::new(0x004C, 0x0796, 18, 19, 21, -2, 0),
-    Glyph::new(0x004D, 0x07C8, 27, 29, 21, -2, 0),
-    Glyph::new(0x004E, 0x0815, 24, 26, 22, -1, -1),
-    Glyph::new(0x004F, 0x085D, 23, 22, 23, 0, -1),
-    Glyph::new(0x0050, 0x089D, 19, 21, 22, -2, 0),
-    Glyph::new(0x0051, 0x08D7, 23, 26, 29, 0, -7),
-    Glyph::new(0x0052, 0x0936, 21, 22, 23, -2, -1),
-    Glyph::new(0x0053, 0x0976, 17, 18, 23, -1, -1),
-    Glyph::new(0x0054, 0x09AA, 20, 20, 21, 2, 0),
-    Glyph::new(0x0055, 0x09DF, 24, 23, 22, 2, -1),
-    Glyph::new(0x0056, 0x0A1F, 22, 23, 22, 1, -1),
-    Glyph::new(0x0057, 0x0A5F, 30, 30, 22, 2, -1),
-    Glyph::new(0x0058, 0x0AB2, 20, 25, 21, -3, 0),
-    Glyph::new(0x0059, 0x0AF4, 20, 21, 21, 1, 0),
-    Glyph::new(0x005A, 0x0B2C, 19, 20, 22, -1, -1),
-    Glyph::new(0x005B, 0x0B63, 11, 14, 29, -2, -5),
-    Glyph::new(0x005C, 0x0B96, 16, 13, 24, 1, -2),
-    Glyph::new(0x005D, 0x0BBD, 11, 14, 29, -2, -5),
-    Glyph::new(0x005E, 0x0BF0, 19, 15, 15, 2, 5),
-    Glyph::new(0x005F, 0x0C0D, 15, 15, 4, 0, -5),
-    Glyph::new(0x0060, 0x0C15, 19, 7, 9, 6, 17),
-    Glyph::new(0x0061, 0x0C1D, 18, 18, 18, 0, -1),
-    Glyph::new(0x0062, 0x0C46, 17, 16, 25, 0, -1),
-    Glyph::new(0x0063, 0x0C78, 14, 14, 18, 0, -1),
-    Glyph::new(0x0064, 0x0C98, 18, 18, 25, 0, -1),
-    Glyph::new(0x0065, 0x0CD1, 15, 14, 18, 0, -1),
-    Glyph::new(0x0066, 0x0CF1, 13, 23, 32, -6, -8),
-    Glyph::new(0x0067, 0x0D4D, 16, 21, 25, -3, -8),
-    Glyph::new(0x0068, 0x0D8F, 18, 18, 25, 0, -1),
-    Glyph::new(0x0069, 0x0DC8, 10, 9, 24, 1, -1),
-    Glyph::new(0x006A, 0x0DE3, 10, 17, 31, -6, -8),
-    Glyph::new(0x006B, 0x0E25, 17, 16, 25, 0, -1),
-    Glyph::new(0x006C, 0x0E57, 10, 9, 25, 1, -1),
-    Glyph::new(0x006D, 0x0E74, 27, 26, 18, 0, -1),
-    Glyph::new(0x006E, 0x0EAF, 19, 18, 18, 0, -1),
-    Glyph::new(0x006F, 0x0ED8, 17, 16, 18, 0, -1),
-    Glyph::new(0x0070, 0x0EFC, 18, 20, 24, -3, -7),
-    Glyph::new(0x0071, 0x0F38, 17, 17, 24, 0, -7),
-    Glyph::new(0x0072, 0x0F6B, 15, 15, 17, 0, 0),
-    Glyph::new(0x0073, 0x0F8B, 14, 14, 18, -1, -1),
-    Glyph::new(0x0074, 0x0FAB, 13, 13, 21, 0, -1),
-    Glyph::new(0x0075, 0x0FCE, 19, 18, 17, 0, -1),
-    Glyph::new(0x0076, 0x0FF5, 16, 16, 18, 0, -1),
-    Glyph::new(0x0077, 0x1019, 23, 23, 18, 0, -1),
-    Glyph::new(0x0078, 0x104D, 18, 19, 18, -1, -1),
-    Glyph::new(0x0079, 0x1078, 16, 21, 25, -5, -8),
-    Glyph::new(0x007A, 0x10BA, 15, 16, 18, -1, -1),
-    Glyph::new(0x007B, 0x10DE, 13, 13, 30, 1, -6),
-    Glyph::new(0x007C, 0x110F, 10, 10, 27, -1, -4),
-    Glyph::new(0x007D, 0x1131, 13, 13, 30, -2, -6),
-    Glyph::new(0x007E, 0x1162, 19, 15, 6, 2, 7),
-    Glyph::new(0x00A1, 0x116E, 11, 10, 23, -1, -7),
-    Glyph::new(0x00A2, 0x118B, 19, 16, 30, 1, -6),
-    Glyph::new(0x00A3, 0x11C7, 19, 20, 22, -1, -1),
-    Glyph::new(0x00A4, 0x11FE, 19, 19, 15, 0, 3),
-    Glyph::new(0x00A5, 0x1222, 19, 21, 21, 1, 0),
-    Glyph::new(0x00A7, 0x125A, 16, 15, 24, -1, -3),
-    Glyph::new(0x00A9, 0x1287, 24, 23, 23, 0, -1),
-    Glyph::new(0x00AA, 0x12CA, 14, 13, 16, 1, 6),
-    Glyph::new(0x00AB, 0x12E4, 19, 17, 12, 1, 2),
-    Glyph::new(0x00AE, 0x12FE, 18, 17, 17, 0, 7),
-    Glyph::new(0x00B0, 0x1323, 16, 12, 11, 2, 10),
-    Glyph::new(0x00B1, 0x1334, 19, 14, 19, 2, -1),
-    Glyph::new(0x00B2, 0x1356, 14, 13, 14, 0, 11),
-    Glyph::new(0x00B3, 0x136D, 14, 11, 15, 1, 10),
-    Glyph::new(0x00B5, 0x1382, 19, 21, 25, -2, -8),
-    Glyph::new(0x00B6, 0x13C4, 19, 20, 26, -1, -5),
-    Glyph::new(0x00B7, 0x1405, 10, 6, 5, 2, 6),
-    Glyph::new(0x00B9, 0x1409, 14, 10, 14, 1, 11),
-    Glyph::new(0x00BA, 0x141B, 14, 12, 16, 1, 6),
-    Glyph::new(0x00BB, 0x1433, 19, 18, 12, 0, 2),
-    Glyph::new(0x00BC, 0x144E, 33, 31, 24, 1, -2),
-    Glyph::new(0x00BD, 0x14AB, 33, 31, 24, 1, -2),
-    Glyph::new(0x00BE, 0x1508, 33, 31, 24, 1, -2),
-    Glyph::new(0x00BF, 0x1565, 13, 10, 23, 0, -7),
-    Glyph::new(0x00C0, 0x1582, 23, 24, 30, -2, 0),
-    Glyph::new(0x00C1, 0x15DC, 23, 24, 30, -2, 0),
-    Glyph::new(0x00C2, 0x1636, 23, 24, 29, -2, 0),
-    Glyph::new(0x00C3, 0x168D, 23, 24, 29, -2, 0),
-    Glyph::new(0x00C4, 0x16E4, 23, 24, 28, -2, 0),
-    Glyph::new(0x00C5, 0x1738, 23, 24, 30, -2, 0),
-    Glyph::new(0x00C6, 0x1792, 29, 32, 21, -3, 0),
-    Glyph::new(0x00C7, 0x17E6, 20, 20, 30, 0, -8),
-    Glyph::new(0x00C8, 0x1831, 19, 21, 30, -2, 0),
-    Glyph::new(0x00C9, 0x1880, 19, 21, 30, -2, 0),
-    Glyph::new(0x00CA, 0x18CF, 19, 21, 29, -2, 0),
-    Glyph::new(0x00CB, 0x191C, 19, 21, 28, -2, 0),
-    Glyph::new(0x00CC, 0x1966, 12, 16, 30, -2, 0),
-    Glyph::new(0x00CD, 0x19A2, 12, 16, 30, -2, 0),
-    Glyph::new(0x00CE, 0x19DE, 12, 16, 29, -2, 0),
-    Glyph::new(0x00CF, 0x1A18, 12, 16, 28, -2, 0),
-    Glyph::new(0x00D0, 0x1A50, 22, 24, 23, -2, -1),
-    Glyph::new(0x00D1, 0x1A95, 24, 26, 30, -1, -1),
-    Glyph::new(0x00D2, 0x1AF7, 23, 22, 31, 0, -1),
-    Glyph::new(0x00D3, 0x1B4D, 23, 22, 31, 0, -1),
-    Glyph::new(0x00D4, 0x1BA3, 23, 22, 30, 0, -1),
-    Glyph::new(0x00D5, 0x1BF6, 23, 22, 30, 0, -1),
-    Glyph::new(0x00D6, 0x1C49, 23, 22, 29, 0, -1),
-    Glyph::new(0x00D7, 0x1C99, 19, 13, 14, 3, 3),
-    Glyph::new(0x00D8, 0x1CB0, 23, 24, 23, -1, -1),
-    Glyph::new(0x00D9, 0x1CF5, 24, 23, 31, 2, -1),
-    Glyph::new(0x00DA, 0x1D4F, 24, 23, 31, 2, -1),
-    Glyph::new(0x00DB, 0x1DA9, 24, 23, 30, 2, -1),
-    Glyph::new(0x00DC, 0x1E00, 24, 23, 29, 2, -1),
-    Glyph::new(0x00DE, 0x1E54, 18, 20, 21, -2, 0),
-    Glyph::new(0x00DF, 0x1E89, 20, 25, 32, -6, -8),
-    Glyph::new(0x00E0, 0x1EED, 18, 18, 27, 0, -1),
-    Glyph::new(0x00E1, 0x1F2A, 18, 18, 27, 0, -1),
-    Glyph::new(0x00E2, 0x1F67, 18, 18, 26, 0, -1),
-    Glyph::new(0x00E3, 0x1FA2, 18, 18, 25, 0, -1),
-    Glyph::new(0x00E4, 0x1FDB, 18, 18, 24, 0, -1),
-    Glyph::new(0x00E5, 0x2011, 18, 18, 27, 0, -1),
-    Glyph::new(0x00E6, 0x204E, 24, 23, 18, 0, -1),
-    Glyph::new(0x00E7, 0x2082, 14, 14, 25, 0, -8),
-    Glyph::new(0x00E8, 0x20AE, 15, 14, 27, 0, -1),
-    Glyph::new(0x00E9, 0x20DE, 15, 15, 27, 0, -1),
-    Glyph::new(0x00EA, 0x2111, 15, 15, 26, 0, -1),
-    Glyph::new(0x00EB, 0x2142, 15, 15, 24, 0, -1),
-    Glyph::new(0x00EC, 0x216F, 10, 9, 27, 1, -1),
-    Glyph::new(0x00ED, 0x218E, 10, 12, 27, 1, -1),
-    Glyph::new(0x00EE, 0x21B7, 10, 11, 26, 1, -1),
-    Glyph::new(0x00EF, 0x21DB, 10, 12, 24, 1, -1),
-    Glyph::new(0x00F0, 0x21FF, 17, 16, 26, 0, -1),
-    Glyph::new(0x00F1, 0x2233, 19, 18, 25, 0, -1),
-    Glyph::new(0x00F2, 0x226C, 17, 16, 27, 0, -1),
-    Glyph::new(0x00F3, 0x22A2, 17, 16, 27, 0, -1),
-    Glyph::new(0x00F4, 0x22D8, 17, 16, 26, 0, -1),
-    Glyph::new(0x00F5, 0x230C, 17, 17, 25, 0, -1),
-    Glyph::new(0x00F6, 0x2342, 17, 17, 24, 0, -1),
-    Glyph::new(0x00F7, 0x2375, 19, 14, 14, 2, 3),
-    Glyph::new(0x00F8, 0x238E, 17, 20, 18, -2, -1),
-    Glyph::new(0x00F9, 0x23BB, 19, 18, 27, 0, -1),
-    Glyph::new(0x00FA, 0x23F8, 19, 18, 27, 0, -1),
-    Glyph::new(0x00FB, 0x2435, 19, 18, 26, 0, -1),
-    Glyph::new(0x00FC, 0x2470, 19, 18, 24, 0, -1),
-    Glyph::new(0x00FE, 0x24A6, 17, 19, 31, -3, -7),
-    Glyph::new(0x00FF, 0x24F0, 16, 21, 31, -5, -8),
-    Glyph::new(0x0104, 0x2542, 23, 24, 29, -2, -7),
-    Glyph::new(0x0105, 0x2599, 18, 18, 24, 0, -7),
-    Glyph::new(0x0106, 0x25CF, 20, 20, 31, 0, -1),
-    Glyph::new(0x0107, 0x261D, 14, 15, 27, 0, -1),
-    Glyph::new(0x010C, 0x2650, 20, 20, 31, 0, -1),
-    Glyph::new(0x010D, 0x269E, 14, 16, 27, 0, -1),
-    Glyph::new(0x010E, 0x26D4, 22, 24, 31, -2, -1),
-    Glyph::new(0x010F, 0x2731, 19, 23, 25, 0, -1),
-    Glyph::new(0x0118, 0x2779, 19, 21, 28, -2, -7),
-    Glyph::new(0x0119, 0x27C3, 15, 14, 24, 0, -7),
-    Glyph::new(0x011A, 0x27ED, 19, 21, 30, -2, 0),
-    Glyph::new(0x011B, 0x283C, 15, 16, 27, 0, -1),
-    Glyph::new(0x0139, 0x2872, 18, 19, 30, -2, 0),
-    Glyph::new(0x013A, 0x28BA, 10, 11, 32, 1, -1),
-    Glyph::new(0x013D, 0x28E6, 18, 20, 24, -2, 0),
-    Glyph::new(0x013E, 0x2922, 11, 14, 25, 1, -1),
-    Glyph::new(0x0141, 0x294E, 18, 19, 21, -2, 0),
-    Glyph::new(0x0142, 0x2980, 10, 12, 25, -1, -1),
-    Glyph::new(0x0143, 0x29A6, 24, 26, 31, -1, -1),
-    Glyph::new(0x0144, 0x2A0B, 19, 18, 27, 0, -1),
-    Glyph::new(0x0147, 0x2A48, 24, 26, 31, -1, -1),
-    Glyph::new(0x0148, 0x2AAD, 19, 18, 27, 0, -1),
-    Glyph::new(0x0152, 0x2AEA, 30, 30, 23, 0, -1),
-    Glyph::new(0x0153, 0x2B41, 25, 24, 18, 0, -1),
-    Glyph::new(0x0158, 0x2B77, 21, 22, 31, -2, -1),
-    Glyph::new(0x0159, 0x2BCD, 15, 16, 26, 0, 0),
-    Glyph::new(0x015A, 0x2C01, 17, 18, 31, -1, -1),
-    Glyph::new(0x015B, 0x2C47, 14, 15, 27, -1, -1),
-    Glyph::new(0x0160, 0x2C7A, 17, 18, 31, -1, -1),
-    Glyph::new(0x0161, 0x2CC0, 14, 16, 27, -1, -1),
-    Glyph::new(0x0164, 0x2CF6, 20, 20, 30, 2, 0),
-    Glyph::new(0x0165, 0x2D41, 13, 15, 25, 0, -1),
-    Glyph::new(0x016E, 0x2D70, 24, 23, 31, 2, -1),
-    Glyph::new(0x016F, 0x2DCA, 19, 18, 27, 0, -1),
-    Glyph::new(0x0170, 0x2E07, 24, 23, 31, 2, -1),
-    Glyph::new(0x0171, 0x2E61, 19, 18, 26, 0, -1),
-    Glyph::new(0x0178, 0x2E9C, 20, 21, 28, 1, 0),
-    Glyph::new(0x0179, 0x2EE6, 19, 20, 31, -1, -1),
-    Glyph::new(0x017A, 0x2F34, 15, 16, 27, -1, -1),
-    Glyph::new(0x017B, 0x2F6A, 19, 20, 30, -1, -1),
-    Glyph::new(0x017C, 0x2FB5, 15, 16, 25, -1, -1),
-    Glyph::new(0x017D, 0x2FE7, 19, 20, 31, -1, -1),
-    Glyph::new(0x017E, 0x3035, 15, 16, 27, -1, -1),
-    Glyph::new(0x03C0, 0x306B, 20, 20, 18, 0, -1),
-    Glyph::new(0x1E9E, 0x3098, 22, 22, 23, -2, -1),
-    Glyph::new(0x2013, 0x30D8, 15, 15, 4, 0, 6),
-    Glyph::new(0x2014, 0x30E0, 30, 30, 4, 0, 6),
-    Glyph::new(0x2018, 0x30EF, 9, 7, 11, 2, 12),
-    Glyph::new(0x2019, 0x30F9, 9, 7, 11, 2, 12),
-    Glyph::new(0x201A, 0x3103, 9, 7, 10, 0, -6),
-    Glyph::new(0x201B, 0x310C, 9, 7, 11, 1, 12),
-    Glyph::new(0x201C, 0x3116, 16, 14, 11, 2, 12),
-    Glyph::new(0x201D, 0x312A, 16, 13, 10, 2, 12),
-    Glyph::new(0x201E, 0x313B, 15, 13, 10, 0, -6),
-    Glyph::new(0x201F, 0x314C, 15, 13, 11, 1, 12),
-    Glyph::new(0x2020, 0x315E, 15, 14, 20, 1, 2),
-    Glyph::new(0x2021, 0x3181, 15, 16, 24, -1, -2),
-    Glyph::new(0x2022, 0x31B1, 9, 7, 8, 1, 4),
-    Glyph::new(0x2026, 0x31B8, 30, 26, 6, 2, -1),
-    Glyph::new(0x2039, 0x31CC, 11, 9, 12, 1, 2),
-    Glyph::new(0x203A, 0x31DA, 11, 10, 12, 0, 2),
-    Glyph::new(0x2070, 0x31E9, 14, 13, 15, 0, 10),
-    Glyph::new(0x2074, 0x3202, 14, 13, 14, 0, 11),
-    Glyph::new(0x2075, 0x3219, 14, 12, 15, 1, 10),
-    Glyph::new(0x2076, 0x3230, 14, 13, 15, 1, 10),
-    Glyph::new(0x2077, 0x3249, 14, 12, 15, 2, 10),
-    Glyph::new(0x2078, 0x3260, 14, 12, 15, 1, 10),
-    Glyph::new(0x2079, 0x3277, 14, 13, 15, 0, 10),
-    Glyph::new(0x2080, 0x3290, 14, 13, 15, 0, -5),
-    Glyph::new(0x2081, 0x32A9, 14, 10, 14, 1, -4),
-    Glyph::new(0x2082, 0x32BB, 14, 13, 14, 0, -4),
-    Glyph::new(0x2083, 0x32D2, 14, 11, 15, 1, -5),
-    Glyph::new(0x2084, 0x32E7, 14, 13, 15, 0, -5),
-    Glyph::new(0x2085, 0x3300, 14, 12, 15, 1, -5),
-    Glyph::new(0x2086, 0x3317, 14, 13, 15, 1, -5),
-    Glyph::new(0x2087, 0x3330, 14, 12, 15, 2, -5),
-    Glyph::new(0x2088, 0x3347, 14, 12, 15, 1, -5),
-    Glyph::new(0x2089, 0x335E, 14, 13, 15, 0, -5),
-    Glyph::new(0x20AC, 0x3377, 19, 21, 22, -1, -1),
-    Glyph::new(0x2122, 0x33B1, 24, 22, 11, 2, 10),
-    Glyph::new(0x2153, 0x33D0, 33, 30, 24, 1, -2),
-    Glyph::new(0x2154, 0x342A, 33, 31, 24, 0, -2),
-    Glyph::new(0x215B, 0x3487, 33, 31, 24, 1, -2),
-    Glyph::new(0x215C, 0x34E4, 33, 31, 24, 1, -2),
-    Glyph::new(0x215D, 0x3541, 33, 31, 24, 1, -2),
-    Glyph::new(0x215E, 0x359E, 33, 30, 25, 2, -2),
-    Glyph::new(0x2190, 0x35FC, 30, 20, 15, 5, 3),
-    Glyph::new(0x2191, 0x3622, 30, 14, 20, 8, 0),
-    Glyph::new(0x2192, 0x3645, 30, 20, 15, 5, 3),
-    Glyph::new(0x2193, 0x366B, 30, 14, 20, 8, 0),
-    Glyph::new(0x2194, 0x368E, 30, 20, 13, 5, 4),
-    Glyph::new(0x2195, 0x36AF, 30, 14, 21, 8, 0),
-    Glyph::new(0x21D0, 0x36D4, 30, 20, 17, 5, 2),
-    Glyph::new(0x21D1, 0x36FF, 30, 18, 19, 6, 1),
-    Glyph::new(0x21D2, 0x372A, 30, 20, 17, 5, 2),
-    Glyph::new(0x21D3, 0x3755, 30, 18, 19, 6, 1),
-    Glyph::new(0x21D4, 0x3780, 30, 20, 15, 5, 3),
-    Glyph::new(0x2202, 0x37A6, 19, 16, 25, 1, -1),
-    Glyph::new(0x2206, 0x37D8, 21, 20, 22, 0, 0),
-    Glyph::new(0x220F, 0x380F, 26, 24, 26, 1, -5),
-    Glyph::new(0x2211, 0x385D, 20, 19, 26, 1, -5),
-    Glyph::new(0x221A, 0x389B, 19, 20, 29, -1, -4),
-    Glyph::new(0x221E, 0x38E4, 19, 19, 11, 0, 4),
-    Glyph::new(0x222B, 0x38FF, 19, 17, 32, 1, -8),
-    Glyph::new(0x2260, 0x3943, 19, 14, 16, 2, 2),
-    Glyph::new(0x2264, 0x395F, 19, 14, 18, 2, 0),
-    Glyph::new(0x2265, 0x397F, 19, 14, 19, 2, 0),
+    Glyph::new(0x0022, 0x002E, 12, 12, 11, 1, 11),
+    Glyph::new(0x0023, 0x0051, 19, 19, 20, 0, -2),
+    Glyph::new(0x0024, 0x0096, 19, 17, 30, 1, -6),
+    Glyph::new(0x0025, 0x00F5, 30, 27, 24, 1, -2),
+    Glyph::new(0x0026, 0x0176, 27, 25, 24, 1, -2),
+    Glyph::new(0x0027, 0x01E3, 7, 6, 11, 1, 11),
+    Glyph::new(0x0028, 0x01F5, 13, 13, 30, 1, -6),
+    Glyph::new(0x0029, 0x0232, 13, 14, 30, -2, -6),
+    Glyph::new(0x002A, 0x0272, 12, 12, 12, 1, 11),
+    Glyph::new(0x002B, 0x0292, 19, 14, 14, 2, 3),
+    Glyph::new(0x002C, 0x02B8, 10, 9, 10, -2, -5),
+    Glyph::new(0x002D, 0x02CA, 12, 10, 4, 1, 6),
+    Glyph::new(0x002E, 0x02D4, 10, 6, 6, 1, -1),
+    Glyph::new(0x002F, 0x02DE, 16, 18, 24, -1, -2),
+    Glyph::new(0x0030, 0x0314, 19, 19, 22, 0, -1),
+    Glyph::new(0x0031, 0x035C, 19, 13, 22, 2, 0),
+    Glyph::new(0x0032, 0x038D, 19, 18, 21, 0, 0),
+    Glyph::new(0x0033, 0x03CD, 19, 17, 22, 0, -1),
+    Glyph::new(0x0034, 0x040A, 19, 18, 21, 0, 0),
+    Glyph::new(0x0035, 0x044A, 19, 18, 22, 1, -1),
+    Glyph::new(0x0036, 0x0484, 19, 18, 22, 1, -1),
+    Glyph::new(0x0037, 0x04C8, 19, 17, 22, 3, -1),
+    Glyph::new(0x0038, 0x0504, 19, 17, 22, 1, -1),
+    Glyph::new(0x0039, 0x054D, 19, 19, 22, -1, -1),
+    Glyph::new(0x003A, 0x0590, 10, 9, 17, 1, -1),
+    Glyph::new(0x003B, 0x05A7, 10, 12, 21, -2, -5),
+    Glyph::new(0x003C, 0x05C8, 19, 14, 14, 2, 3),
+    Glyph::new(0x003D, 0x05ED, 19, 14, 10, 2, 5),
+    Glyph::new(0x003E, 0x060D, 19, 14, 14, 2, 3),
+    Glyph::new(0x003F, 0x0631, 13, 10, 23, 2, -1),
+    Glyph::new(0x0040, 0x065F, 30, 28, 27, 1, -6),
+    Glyph::new(0x0041, 0x06EA, 23, 24, 22, -2, 0),
+    Glyph::new(0x0042, 0x0736, 19, 20, 23, -2, -1),
+    Glyph::new(0x0043, 0x0785, 20, 20, 23, 0, -1),
+    Glyph::new(0x0044, 0x07CC, 22, 24, 23, -2, -1),
+    Glyph::new(0x0045, 0x0821, 19, 21, 21, -2, 0),
+    Glyph::new(0x0046, 0x086A, 18, 20, 21, -2, 0),
+    Glyph::new(0x0047, 0x08AF, 22, 21, 23, 0, -1),
+    Glyph::new(0x0048, 0x08FC, 25, 28, 21, -2, 0),
+    Glyph::new(0x0049, 0x095C, 12, 16, 21, -2, 0),
+    Glyph::new(0x004A, 0x098F, 12, 20, 27, -6, -6),
+    Glyph::new(0x004B, 0x09D5, 22, 25, 22, -2, -1),
+    Glyph::new(0x004C, 0x0A32, 18, 19, 21, -2, 0),
+    Glyph::new(0x004D, 0x0A6E, 27, 29, 21, -2, 0),
+    Glyph::new(0x004E, 0x0AE7, 24, 26, 22, -1, -1),
+    Glyph::new(0x004F, 0x0B4C, 23, 22, 23, 0, -1),
+    Glyph::new(0x0050, 0x0BA1, 19, 21, 22, -2, 0),
+    Glyph::new(0x0051, 0x0BE9, 23, 26, 29, 0, -7),
+    Glyph::new(0x0052, 0x0C59, 21, 22, 23, -2, -1),
+    Glyph::new(0x0053, 0x0CAB, 17, 18, 23, -1, -1),
+    Glyph::new(0x0054, 0x0CF3, 20, 20, 21, 2, 0),
+    Glyph::new(0x0055, 0x0D34, 24, 23, 22, 2, -1),
+    Glyph::new(0x0056, 0x0D8E, 22, 23, 22, 1, -1),
+    Glyph::new(0x0057, 0x0DDE, 30, 30, 22, 2, -1),
+    Glyph::new(0x0058, 0x0E55, 20, 25, 21, -3, 0),
+    Glyph::new(0x0059, 0x0EA9, 20, 21, 21, 1, 0),
+    Glyph::new(0x005A, 0x0EF0, 19, 20, 22, -1, -1),
+    Glyph::new(0x005B, 0x0F3A, 11, 14, 29, -2, -5),
+    Glyph::new(0x005C, 0x0F7B, 16, 13, 24, 1, -2),
+    Glyph::new(0x005D, 0x0FAF, 11, 14, 29, -2, -5),
+    Glyph::new(0x005E, 0x0FF1, 19, 15, 15, 2, 5),
+    Glyph::new(0x005F, 0x101E, 15, 15, 4, 0, -5),
+    Glyph::new(0x0060, 0x102F, 19, 7, 9, 6, 17),
+    Glyph::new(0x0061, 0x103C, 18, 18, 18, 0, -1),
+    Glyph::new(0x0062, 0x107B, 17, 16, 25, 0, -1),
+    Glyph::new(0x0063, 0x10C0, 14, 14, 18, 0, -1),
+    Glyph::new(0x0064, 0x10EC, 18, 18, 25, 0, -1),
+    Glyph::new(0x0065, 0x1139, 15, 14, 18, 0, -1),
+    Glyph::new(0x0066, 0x116B, 13, 23, 32, -6, -8),
+    Glyph::new(0x0067, 0x11BB, 16, 21, 25, -3, -8),
+    Glyph::new(0x0068, 0x120E, 18, 18, 25, 0, -1),
+    Glyph::new(0x0069, 0x125E, 10, 9, 24, 1, -1),
+    Glyph::new(0x006A, 0x128B, 10, 17, 31, -6, -8),
+    Glyph::new(0x006B, 0x12C9, 17, 16, 25, 0, -1),
+    Glyph::new(0x006C, 0x1312, 10, 9, 25, 1, -1),
+    Glyph::new(0x006D, 0x133F, 27, 26, 18, 0, -1),
+    Glyph::new(0x006E, 0x13A0, 19, 18, 18, 0, -1),
+    Glyph::new(0x006F, 0x13E2, 17, 16, 18, 0, -1),
+    Glyph::new(0x0070, 0x1417, 18, 20, 24, -3, -7),
+    Glyph::new(0x0071, 0x1468, 17, 17, 24, 0, -7),
+    Glyph::new(0x0072, 0x14B2, 15, 15, 17, 0, 0),
+    Glyph::new(0x0073, 0x14DE, 14, 14, 18, -1, -1),
+    Glyph::new(0x0074, 0x150D, 13, 13, 21, 0, -1),
+    Glyph::new(0x0075, 0x153A, 19, 18, 17, 0, -1),
+    Glyph::new(0x0076, 0x157E, 16, 16, 18, 0, -1),
+    Glyph::new(0x0077, 0x15B0, 23, 23, 18, 0, -1),
+    Glyph::new(0x0078, 0x1603, 18, 19, 18, -1, -1),
+    Glyph::new(0x0079, 0x163D, 16, 21, 25, -5, -8),
+    Glyph::new(0x007A, 0x1686, 15, 16, 18, -1, -1),
+    Glyph::new(0x007B, 0x16BB, 13, 13, 30, 1, -6),
+    Glyph::new(0x007C, 0x16F9, 10, 10, 27, -1, -4),
+    Glyph::new(0x007D, 0x1729, 13, 13, 30, -2, -6),
+    Glyph::new(0x007E, 0x1766, 19, 15, 6, 2, 7),
+    Glyph::new(0x00A1, 0x177D, 11, 10, 23, -1, -7),
+    Glyph::new(0x00A2, 0x17A8, 19, 16, 30, 1, -6),
+    Glyph::new(0x00A3, 0x17F9, 19, 20, 22, -1, -1),
+    Glyph::new(0x00A4, 0x1842, 19, 19, 15, 0, 3),
+    Glyph::new(0x00A5, 0x187B, 19, 21, 21, 1, 0),
+    Glyph::new(0x00A7, 0x18CB, 16, 15, 24, -1, -3),
+    Glyph::new(0x00A9, 0x1914, 24, 23, 23, 0, -1),
+    Glyph::new(0x00AA, 0x1987, 14, 13, 16, 1, 6),
+    Glyph::new(0x00AB, 0x19B3, 19, 17, 12, 1, 2),
+    Glyph::new(0x00AE, 0x19DC, 18, 17, 17, 0, 7),
+    Glyph::new(0x00B0, 0x1A31, 16, 12, 11, 2, 10),
+    Glyph::new(0x00B1, 0x1A50, 19, 14, 19, 2, -1),
+    Glyph::new(0x00B2, 0x1A81, 14, 13, 14, 0, 11),
+    Glyph::new(0x00B3, 0x1AA5, 14, 11, 15, 1, 10),
+    Glyph::new(0x00B5, 0x1AC9, 19, 21, 25, -2, -8),
+    Glyph::new(0x00B6, 0x1B1D, 19, 20, 26, -1, -5),
+    Glyph::new(0x00B7, 0x1B7E, 10, 6, 5, 2, 6),
+    Glyph::new(0x00B9, 0x1B88, 14, 10, 14, 1, 11),
+    Glyph::new(0x00BA, 0x1BA3, 14, 12, 16, 1, 6),
+    Glyph::new(0x00BB, 0x1BCD, 19, 18, 12, 0, 2),
+    Glyph::new(0x00BC, 0x1BF9, 33, 31, 24, 1, -2),
+    Glyph::new(0x00BD, 0x1C74, 33, 31, 24, 1, -2),
+    Glyph::new(0x00BE, 0x1CED, 33, 31, 24, 1, -2),
+    Glyph::new(0x00BF, 0x1D6E, 13, 10, 23, 0, -7),
+    Glyph::new(0x00C0, 0x1D9F, 23, 24, 30, -2, 0),
+    Glyph::new(0x00C1, 0x1DFE, 23, 24, 30, -2, 0),
+    Glyph::new(0x00C2, 0x1E5C, 23, 24, 29, -2, 0),
+    Glyph::new(0x00C3, 0x1EBE, 23, 24, 29, -2, 0),
+    Glyph::new(0x00C4, 0x1F20, 23, 24, 28, -2, 0),
+    Glyph::new(0x00C5, 0x1F82, 23, 24, 30, -2, 0),
+    Glyph::new(0x00C6, 0x1FE7, 29, 32, 21, -3, 0),
+    Glyph::new(0x00C7, 0x204F, 20, 20, 30, 0, -8),
+    Glyph::new(0x00C8, 0x20A7, 19, 21, 30, -2, 0),
+    Glyph::new(0x00C9, 0x2101, 19, 21, 30, -2, 0),
+    Glyph::new(0x00CA, 0x215C, 19, 21, 29, -2, 0),
+    Glyph::new(0x00CB, 0x21B9, 19, 21, 28, -2, 0),
+    Glyph::new(0x00CC, 0x2216, 12, 16, 30, -2, 0),
+    Glyph::new(0x00CD, 0x2258, 12, 16, 30, -2, 0),
+    Glyph::new(0x00CE, 0x229B, 12, 16, 29, -2, 0),
+    Glyph::new(0x00CF, 0x22E1, 12, 16, 28, -2, 0),
+    Glyph::new(0x00D0, 0x2328, 22, 24, 23, -2, -1),
+    Glyph::new(0x00D1, 0x2385, 24, 26, 30, -1, -1),
+    Glyph::new(0x00D2, 0x2400, 23, 22, 31, 0, -1),
+    Glyph::new(0x00D3, 0x2468, 23, 22, 31, 0, -1),
+    Glyph::new(0x00D4, 0x24CF, 23, 22, 30, 0, -1),
+    Glyph::new(0x00D5, 0x2538, 23, 22, 30, 0, -1),
+    Glyph::new(0x00D6, 0x25A1, 23, 22, 29, 0, -1),
+    Glyph::new(0x00D7, 0x260B, 19, 13, 14, 3, 3),
+    Glyph::new(0x00D8, 0x2633, 23, 24, 23, -1, -1),
+    Glyph::new(0x00D9, 0x269B, 24, 23, 31, 2, -1),
+    Glyph::new(0x00DA, 0x2707, 24, 23, 31, 2, -1),
+    Glyph::new(0x00DB, 0x2775, 24, 23, 30, 2, -1),
+    Glyph::new(0x00DC, 0x27E4, 24, 23, 29, 2, -1),
+    Glyph::new(0x00DE, 0x2853, 18, 20, 21, -2, 0),
+    Glyph::new(0x00DF, 0x2899, 20, 25, 32, -6, -8),
+    Glyph::new(0x00E0, 0x290D, 18, 18, 27, 0, -1),
+    Glyph::new(0x00E1, 0x295D, 18, 18, 27, 0, -1),
+    Glyph::new(0x00E2, 0x29AE, 18, 18, 26, 0, -1),
+    Glyph::new(0x00E3, 0x2A03, 18, 18, 25, 0, -1),
+    Glyph::new(0x00E4, 0x2A54, 18, 18, 24, 0, -1),
+    Glyph::new(0x00E5, 0x2AA2, 18, 18, 27, 0, -1),
+    Glyph::new(0x00E6, 0x2AFC, 24, 23, 18, 0, -1),
+    Glyph::new(0x00E7, 0x2B4B, 14, 14, 25, 0, -8),
+    Glyph::new(0x00E8, 0x2B86, 15, 14, 27, 0, -1),
+    Glyph::new(0x00E9, 0x2BC7, 15, 15, 27, 0, -1),
+    Glyph::new(0x00EA, 0x2C08, 15, 15, 26, 0, -1),
+    Glyph::new(0x00EB, 0x2C4E, 15, 15, 24, 0, -1),
+    Glyph::new(0x00EC, 0x2C8F, 10, 9, 27, 1, -1),
+    Glyph::new(0x00ED, 0x2CC0, 10, 12, 27, 1, -1),
+    Glyph::new(0x00EE, 0x2CF6, 10, 11, 26, 1, -1),
+    Glyph::new(0x00EF, 0x2D2D, 10, 12, 24, 1, -1),
+    Glyph::new(0x00F0, 0x2D64, 17, 16, 26, 0, -1),
+    Glyph::new(0x00F1, 0x2DAE, 19, 18, 25, 0, -1),
+    Glyph::new(0x00F2, 0x2E02, 17, 16, 27, 0, -1),
+    Glyph::new(0x00F3, 0x2E46, 17, 16, 27, 0, -1),
+    Glyph::new(0x00F4, 0x2E89, 17, 16, 26, 0, -1),
+    Glyph::new(0x00F5, 0x2ED3, 17, 17, 25, 0, -1),
+    Glyph::new(0x00F6, 0x2F1C, 17, 17, 24, 0, -1),
+    Glyph::new(0x00F7, 0x2F62, 19, 14, 14, 2, 3),
+    Glyph::new(0x00F8, 0x2F83, 17, 20, 18, -2, -1),
+    Glyph::new(0x00F9, 0x2FC3, 19, 18, 27, 0, -1),
+    Glyph::new(0x00FA, 0x3017, 19, 18, 27, 0, -1),
+    Glyph::new(0x00FB, 0x306D, 19, 18, 26, 0, -1),
+    Glyph::new(0x00FC, 0x30C7, 19, 18, 24, 0, -1),
+    Glyph::new(0x00FE, 0x311A, 17, 19, 31, -3, -7),
+    Glyph::new(0x00FF, 0x317B, 16, 21, 31, -5, -8),
+    Glyph::new(0x0104, 0x31D4, 23, 24, 29, -2, -7),
+    Glyph::new(0x0105, 0x3231, 18, 18, 24, 0, -7),
+    Glyph::new(0x0106, 0x327C, 20, 20, 31, 0, -1),
+    Glyph::new(0x0107, 0x32D3, 14, 15, 27, 0, -1),
+    Glyph::new(0x010C, 0x330E, 20, 20, 31, 0, -1),
+    Glyph::new(0x010D, 0x336A, 14, 16, 27, 0, -1),
+    Glyph::new(0x010E, 0x33AE, 22, 24, 31, -2, -1),
+    Glyph::new(0x010F, 0x341A, 19, 23, 25, 0, -1),
+    Glyph::new(0x0118, 0x3476, 19, 21, 28, -2, -7),
+    Glyph::new(0x0119, 0x34D1, 15, 14, 24, 0, -7),
+    Glyph::new(0x011A, 0x3511, 19, 21, 30, -2, 0),
+    Glyph::new(0x011B, 0x3570, 15, 16, 27, 0, -1),
+    Glyph::new(0x0139, 0x35BA, 18, 19, 30, -2, 0),
+    Glyph::new(0x013A, 0x3607, 10, 11, 32, 1, -1),
+    Glyph::new(0x013D, 0x3641, 18, 20, 24, -2, 0),
+    Glyph::new(0x013E, 0x368A, 11, 14, 25, 1, -1),
+    Glyph::new(0x0141, 0x36C9, 18, 19, 21, -2, 0),
+    Glyph::new(0x0142, 0x3708, 10, 12, 25, -1, -1),
+    Glyph::new(0x0143, 0x373E, 24, 26, 31, -1, -1),
+    Glyph::new(0x0144, 0x37B8, 19, 18, 27, 0, -1),
+    Glyph::new(0x0147, 0x380B, 24, 26, 31, -1, -1),
+    Glyph::new(0x0148, 0x3889, 19, 18, 27, 0, -1),
+    Glyph::new(0x0152, 0x38E1, 30, 30, 23, 0, -1),
+    Glyph::new(0x0153, 0x394A, 25, 24, 18, 0, -1),
+    Glyph::new(0x0158, 0x399E, 21, 22, 31, -2, -1),
+    Glyph::new(0x0159, 0x3A06, 15, 16, 26, 0, 0),
+    Glyph::new(0x015A, 0x3A4A, 17, 18, 31, -1, -1),
+    Glyph::new(0x015B, 0x3AA1, 14, 15, 27, -1, -1),
+    Glyph::new(0x0160, 0x3AE3, 17, 18, 31, -1, -1),
+    Glyph::new(0x0161, 0x3B40, 14, 16, 27, -1, -1),
+    Glyph::new(0x0164, 0x3B88, 20, 20, 30, 2, 0),
+    Glyph::new(0x0165, 0x3BDF, 13, 15, 25, 0, -1),
+    Glyph::new(0x016E, 0x3C1F, 24, 23, 31, 2, -1),
+    Glyph::new(0x016F, 0x3C95, 19, 18, 27, 0, -1),
+    Glyph::new(0x0170, 0x3CF3, 24, 23, 31, 2, -1),
+    Glyph::new(0x0171, 0x3D6C, 19, 18, 26, 0, -1),
+    Glyph::new(0x0178, 0x3DCB, 20, 21, 28, 1, 0),
+    Glyph::new(0x0179, 0x3E26, 19, 20, 31, -1, -1),
+    Glyph::new(0x017A, 0x3E82, 15, 16, 27, -1, -1),
+    Glyph::new(0x017B, 0x3EC8, 19, 20, 30, -1, -1),
+    Glyph::new(0x017C, 0x3F1F, 15, 16, 25, -1, -1),
+    Glyph::new(0x017D, 0x3F5D, 19, 20, 31, -1, -1),
+    Glyph::new(0x017E, 0x3FBD, 15, 16, 27, -1, -1),
+    Glyph::new(0x03C0, 0x4009, 20, 20, 18, 0, -1),
+    Glyph::new(0x1E9E, 0x404C, 22, 22, 23, -2, -1),
+    Glyph::new(0x2013, 0x40A8, 15, 15, 4, 0, 6),
+    Glyph::new(0x2014, 0x40B9, 30, 30, 4, 0, 6),
+    Glyph::new(0x2018, 0x40DB, 9, 7, 11, 2, 12),
+    Glyph::new(0x2019, 0x40EC, 9, 7, 11, 2, 12),
+    Glyph::new(0x201A, 0x40FE, 9, 7, 10, 0, -6),
+    Glyph::new(0x201B, 0x4110, 9, 7, 11, 1, 12),
+    Glyph::new(0x201C, 0x4122, 16, 14, 11, 2, 12),
+    Glyph::new(0x201D, 0x4141, 16, 13, 10, 2, 12),
+    Glyph::new(0x201E, 0x4164, 15, 13, 10, 0, -6),
+    Glyph::new(0x201F, 0x4187, 15, 13, 11, 1, 12),
+    Glyph::new(0x2020, 0x41AA, 15, 14, 20, 1, 2),
+    Glyph::new(0x2021, 0x41DA, 15, 16, 24, -1, -2),
+    Glyph::new(0x2022, 0x4213, 9, 7, 8, 1, 4),
+    Glyph::new(0x2026, 0x421E, 30, 26, 6, 2, -1),
+    Glyph::new(0x2039, 0x4240, 11, 9, 12, 1, 2),
+    Glyph::new(0x203A, 0x4254, 11, 10, 12, 0, 2),
+    Glyph::new(0x2070, 0x426A, 14, 13, 15, 0, 10),
+    Glyph::new(0x2074, 0x4295, 14, 13, 14, 0, 11),
+    Glyph::new(0x2075, 0x42BA, 14, 12, 15, 1, 10),
+    Glyph::new(0x2076, 0x42DB, 14, 13, 15, 1, 10),
+    Glyph::new(0x2077, 0x4305, 14, 12, 15, 2, 10),
+    Glyph::new(0x2078, 0x4326, 14, 12, 15, 1, 10),
+    Glyph::new(0x2079, 0x434D, 14, 13, 15, 0, 10),
+    Glyph::new(0x2080, 0x4374, 14, 13, 15, 0, -5),
+    Glyph::new(0x2081, 0x43A0, 14, 10, 14, 1, -4),
+    Glyph::new(0x2082, 0x43BB, 14, 13, 14, 0, -4),
+    Glyph::new(0x2083, 0x43DC, 14, 11, 15, 1, -5),
+    Glyph::new(0x2084, 0x4403, 14, 13, 15, 0, -5),
+    Glyph::new(0x2085, 0x442C, 14, 12, 15, 1, -5),
+    Glyph::new(0x2086, 0x444D, 14, 13, 15, 1, -5),
+    Glyph::new(0x2087, 0x4477, 14, 12, 15, 2, -5),
+    Glyph::new(0x2088, 0x449A, 14, 12, 15, 1, -5),
+    Glyph::new(0x2089, 0x44C0, 14, 13, 15, 0, -5),
+    Glyph::new(0x20AC, 0x44E8, 19, 21, 22, -1, -1),
+    Glyph::new(0x2122, 0x4532, 24, 22, 11, 2, 10),
+    Glyph::new(0x2153, 0x4577, 33, 30, 24, 1, -2),
+    Glyph::new(0x2154, 0x45F0, 33, 31, 24, 0, -2),
+    Glyph::new(0x215B, 0x466F, 33, 31, 24, 1, -2),
+    Glyph::new(0x215C, 0x46EB, 33, 31, 24, 1, -2),
+    Glyph::new(0x215D, 0x476B, 33, 31, 24, 1, -2),
+    Glyph::new(0x215E, 0x47E8, 33, 30, 25, 2, -2),
+    Glyph::new(0x2190, 0x4865, 30, 20, 15, 5, 3),
+    Glyph::new(0x2191, 0x4889, 30, 14, 20, 8, 0),
+    Glyph::new(0x2192, 0x48BD, 30, 20, 15, 5, 3),
+    Glyph::new(0x2193, 0x48E2, 30, 14, 20, 8, 0),
+    Glyph::new(0x2194, 0x491C, 30, 20, 13, 5, 4),
+    Glyph::new(0x2195, 0x4948, 30, 14, 21, 8, 0),
+    Glyph::new(0x21D0, 0x4987, 30, 20, 17, 5, 2),
+    Glyph::new(0x21D1, 0x49BE, 30, 18, 19, 6, 1),
+    Glyph::new(0x21D2, 0x49FE, 30, 20, 17, 5, 2),
+    Glyph::new(0x21D3, 0x4A37, 30, 18, 19, 6, 1),
+    Glyph::new(0x21D4, 0x4A7D, 30, 20, 15, 5, 3),
+    Glyph::new(0x2202, 0x4ABC, 19, 16, 25, 1, -1),
+    Glyph::new(0x2206, 0x4B0A, 21, 20, 22, 0, 0),
+    Glyph::new(0x220F, 0x4B56, 26, 24, 26, 1, -5),
+    Glyph::new(0x2211, 0x4BCE, 20, 19, 26, 1, -5),
+    Glyph::new(0x221A, 0x4C22, 19, 20, 29, -1, -4),
+    Glyph::new(0x221E, 0x4C72, 19, 19, 11, 0, 4),
+    Glyph::new(0x222B, 0x4CA8, 19, 17, 32, 1, -8),
+    Glyph::new(0x2260, 0x4CEA, 19, 14, 16, 2, 2),
+    Glyph::new(0x2264, 0x4D14, 19, 14, 18, 2, 0),
+    Glyph::new(0x2265, 0x4D3F, 19, 14, 19, 2, 0),
+    Glyph::new(0xFB01, 0x4D6A, 23, 29, 32, -6, -8),
+    Glyph::new(0xFB02, 0x4DDD, 23, 29, 32, -6, -8),
 ];
 
-const BITMAP_BW: &[u8; 14753] = include_bytes!("./bookerly_bold_italic_30.bw");
-const BITMAP_MSB: &[u8; 14753] = include_bytes!("./bookerly_bold_italic_30.msb");
-const BITMAP_LSB: &[u8; 14753] = include_bytes!("./bookerly_bold_italic_30.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 15), (18, 15), (19, 16),
+    (20, 15), (21, 15), (22, 17), (23, 15), (24, 15), (25, 18), (26, 19), (27, 20),
+    (28, 13), (29, 20), (30, 13), (31, 21), (32, 22), (33, 23), (34, 24), (35, 25),
+    (36, 26), (37, 27), (38, 28), (39, 29), (0, 0), (40, 30), (0, 0), (0, 0),
+    (0, 0), (41, 31), (42, 32), (43, 31), (44, 31), (45, 31), (46, 33), (47, 34),
+    (48, 32), (49, 35), (50, 36), (51, 32), (52, 37), (53, 38), (48, 38), (54, 39),
+    (55, 40), (56, 31), (57, 41), (58, 42), (59, 43), (60, 44), (61, 45), (62, 45),
+    (63, 46), (64, 47), (65, 48), (66, 49), (0, 0), (67, 50), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (68, 51), (69, 52),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (70, 53), (0, 0), (0, 0),
+    (0, 0), (71, 54), (72, 55), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (73, 56), (74, 14), (17, 15),
+    (17, 15), (17, 15), (17, 15), (21, 15), (21, 15), (75, 57), (21, 15), (16, 58),
+    (26, 19), (27, 20), (27, 20), (27, 20), (27, 20), (27, 20), (0, 0), (76, 59),
+    (33, 23), (33, 23), (33, 23), (33, 23), (77, 15), (78, 60), (41, 61), (41, 31),
+    (41, 61), (41, 62), (41, 62), (41, 61), (79, 31), (80, 31), (81, 62), (82, 31),
+    (83, 63), (84, 64), (52, 65), (85, 44), (86, 66), (86, 67), (87, 61), (88, 68),
+    (54, 69), (89, 39), (90, 69), (91, 70), (91, 70), (0, 0), (92, 71), (60, 44),
+    (60, 44), (60, 44), (93, 72), (94, 73), (64, 74), (95, 12), (96, 31), (15, 14),
+    (97, 31), (15, 14), (98, 75), (16, 13), (99, 31), (100, 15), (101, 31), (17, 15),
+    (102, 75), (24, 15), (52, 37), (103, 15), (99, 37), (104, 76), (105, 77), (26, 19),
+    (48, 38), (26, 19), (48, 38), (106, 14), (79, 39), (30, 13), (107, 78), (31, 21),
+    (108, 42), (31, 21), (109, 79), (32, 22), (110, 43), (33, 23), (60, 44), (33, 23),
+    (93, 44), (37, 27), (38, 28), (111, 48), (38, 28), (65, 48), (38, 28), (111, 80),
+    (112, 81), (113, 82), (114, 83), (114, 83), (115, 84), (116, 85), (117, 86), (0, 0),
+    (118, 84), (119, 87), (117, 86), (0, 0), (0, 0), (0, 0), (0, 0), (120, 88),
+    (121, 52), (122, 55), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (49, 33), (52, 33),
+];
+
+const KERNING: [&[i8]; 123] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -2, -1, -1, -1, -2, -2, -2, -1, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -2, -1, -1, -2, -2, -1, -2, 0, -1, 0, -1, -2, -2, -2, -2, -2, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, -2, -1, -2],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, -2, -1, -1, -1, -2, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -2, 0, 0, -2, -2, -1, -2, 0, -1, -1, 0, -2, 0, -2, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -2, -2, 0, -2, -2, -2, -2, -2, -2, 0, -2, -2, 0, -1, -2, 0, -2, -2, -1, 0, 0, -1, 0, -2, -1, -2, -1, 0, 0, 0, -1, -2, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -1, -2, -1, 0, -1, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2],
+    &[0, -1, 0, -1, -2, -1, 0, -2, 0, -2, -1, -2, 0, 0, -1, 0, -2, 0, 0, 0, -1, -1, -2, -2, -2, -2, 0, -2, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, 0, -1, -1, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, -2, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -2, 0, -2, 0, -2, -2, -2, 0, 0, -1, 0, -2, 0, 0, 0, -1, -1, -2, -2, -2, -2, 0, -2, -1, 0, -2, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, -2, -1, -1, -2, 0, -2, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -2, -1, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -2, -1, -1, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -2, -1, -2, -2, 0, 0, -1, -2, -2, -2, -1, -1, 0, 0, 0, -1, -2, -2, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -2, -2, -2, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -2, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, -1, -2, -2, -1, -2, -2, -2, -2, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, -2, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -2, 0, -1, -1, -1, -2, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -2, -1, -2],
+    &[0, 0, -2, -1, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, -1, -2, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1],
+    &[0, -1, 0, -1, -1, -2, -1, -2, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -2, -2, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, -2, -1, -2],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, -1, -1, -2, -2, -2, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, -1, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, -2, -1, -2],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, 0, -2, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, -1, -1, -2, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, -1, -1, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1],
+    &[0, 0, -2, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1],
+    &[0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, -1, -1, 0, -2, -2, 0, -2, -2, -2, -2, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -2, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -2, -2, -1, -2, -2, -1, -1, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, -1, -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -2],
+    &[0, -1, -1, 0, 0, 0, 0, -2, -2, -2, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, -1, -2],
+    &[0, 0, -1, -1, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -2, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -2, -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, 0, -2, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, -1, 0, -2, -2, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -2, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, -1, 0, 0, -2, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -2, 0, -1, -2, -2, -2, -2, -1, -1, -1, -1, -2, 0, -2, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, 0, -2, -2, 0, -1, -2, -1, -2, -2, -1, 0, -1, -1, 0, -2, -1, -2, -1, 0, 0, 0, -1, -2, -1, -2, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -1, -1, -1, 0, -1, -1, -2],
+    &[0, -1, 0, 0, -1, -1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2],
+    &[0, 0, 0, 0, -2, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2],
+    &[0, 0, -1, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, -1, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -2, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2],
+    &[0, 0, 0, 0, -2, -2, -2, -2, -2, -1, -1, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -2, 0, -1, -2, -2, -2, -2, -1, -1, -2, -1, -2, 0, -2, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, -2, 0, -1, -2, -1, -1, -1, -1, 0, -2, -2, 0, -1, -2, -1, -2, -2, -1, 0, -1, -1, 0, -2, -1, -2, -1, 0, 0, 0, -1, -2, -1, -2, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, -2, -2, -1, 0, -1, -1, -2],
+    &[0, -2, -1, -1, -2, -2, -1, -2, -1, -2, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -2, -1, -1, -1, -1, -2, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, -1, -1, -1, -2, -2, -1, -2, -1, -2, -2, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, -2, -1, -2, -2, 0, -2, -1, -1, -2, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -2, -1, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -2, 0, -1, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -1, -1, -2, -2, -1, 0, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, -2, -2, -2, -2, -2],
+    &[0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -2, 0, -2, -2, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, -1, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -2, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, 0, -2, -1, 0, 0, -2, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -2, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0],
+    &[0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1],
+    &[0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, -2, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1],
+    &[0, 0, 0, 0, -1, -2, -2, -2, -2, -1, -1, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, -2, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, 0, -1, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, -2, -1, -2, -2],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, -2, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -2, -2, 0, 0, -1, -2, -2, -2, -2, -1, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, -2, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -1, 0, -1, -2, -1, 0, -2, -1, -1, -2, -2, -1, 0, -1, -2, -2, -2, -2, -2, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, -2, -1, 0, 0, -2, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -2, -2, -2, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -2, -1, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, -2, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, 0, -1, 0, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, 0, -1, -2, -2, -2, -2, -2, -1, -1, 0, -1, -2, -2, -2, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -2, -1, -1, 0, -1, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, 0, -1, -2, -2, -2, -2, -2, -1, 0, 0, -1, -2, -2, -2, -1, 0, -1, -2, -1, 0, -1, -2, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -2, -2, -2, -2, 0, -2, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, 0, -2, 0, -1, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, 0, -2, 0, 0, -2, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -2],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -2, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, -2, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 20057] = include_bytes!("./bookerly_bold_italic_30.rle");
@@ -1,308 +1,515 @@
 // Auto-generated font file
 // Font: Bookerly Italic
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 10452,
+    size: 16374,
     y_advance: 26,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 6, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 8, 8, 21, 1, -1),
-    Glyph::new(0x0022, 0x0015, 10, 9, 9, 1, 10),
-    Glyph::new(0x0023, 0x0020, 17, 16, 17, 0, -2),
-    Glyph::new(0x0024, 0x0042, 17, 15, 26, 0, -5),
-    Glyph::new(0x0025, 0x0073, 26, 23, 21, 1, -2),
-    Glyph::new(0x0026, 0x00B0, 24, 21, 21, 1, -2),
-    Glyph::new(0x0027, 0x00E8, 6, 5, 9, 1, 10),
-    Glyph::new(0x0028, 0x00EE, 11, 11, 27, 1, -6),
-    Glyph::new(0x0029, 0x0114, 11, 11, 27, -2, -6),
-    Glyph::new(0x002A, 0x013A, 10, 9, 9, 1, 10),
-    Glyph::new(0x002B, 0x0145, 17, 12, 12, 2, 3),
-    Glyph::new(0x002C, 0x0157, 8, 7, 9, -1, -5),
-    Glyph::new(0x002D, 0x015F, 10, 8, 3, 1, 5),
-    Glyph::new(0x002E, 0x0162, 8, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x0166, 13, 15, 21, -1, -2),
-    Glyph::new(0x0030, 0x018E, 17, 16, 20, 0, -1),
-    Glyph::new(0x0031, 0x01B6, 17, 10, 19, 2, 0),
-    Glyph::new(0x0032, 0x01CE, 17, 15, 19, 0, 0),
-    Glyph::new(0x0033, 0x01F2, 17, 15, 20, 0, -1),
-    Glyph::new(0x0034, 0x0218, 17, 15, 18, 0, 0),
-    Glyph::new(0x0035, 0x023A, 17, 14, 19, 1, -1),
-    Glyph::new(0x0036, 0x025C, 17, 15, 20, 1, -1),
-    Glyph::new(0x0037, 0x0282, 17, 14, 19, 3, -1),
-    Glyph::new(0x0038, 0x02A4, 17, 14, 20, 1, -1),
-    Glyph::new(0x0039, 0x02C7, 17, 15, 20, 0, -1),
-    Glyph::new(0x003A, 0x02ED, 8, 7, 15, 1, -1),
-    Glyph::new(0x003B, 0x02FB, 8, 9, 19, -1, -5),
-    Glyph::new(0x003C, 0x0311, 17, 12, 12, 2, 3),
-    Glyph::new(0x003D, 0x0323, 17, 12, 8, 2, 5),
-    Glyph::new(0x003E, 0x032F, 17, 12, 12, 2, 3),
-    Glyph::new(0x003F, 0x0341, 11, 9, 20, 2, -1),
-    Glyph::new(0x0040, 0x0358, 26, 24, 23, 1, -5),
-    Glyph::new(0x0041, 0x039D, 20, 20, 19, -2, 0),
-    Glyph::new(0x0042, 0x03CD, 17, 16, 20, -1, -1),
-    Glyph::new(0x0043, 0x03F5, 17, 16, 20, 1, -1),
-    Glyph::new(0x0044, 0x041D, 19, 19, 20, -1, -1),
-    Glyph::new(0x0045, 0x044D, 16, 17, 19, -1, 0),
-    Glyph::new(0x0046, 0x0476, 15, 16, 19, -1, 0),
-    Glyph::new(0x0047, 0x049C, 19, 17, 20, 1, -1),
-    Glyph::new(0x0048, 0x04C7, 21, 23, 19, -1, 0),
-    Glyph::new(0x0049, 0x04FE, 10, 12, 19, -1, 0),
-    Glyph::new(0x004A, 0x051B, 10, 16, 24, -5, -5),
-    Glyph::new(0x004B, 0x054B, 19, 20, 20, -1, -1),
-    Glyph::new(0x004C, 0x057D, 16, 15, 19, -1, 0),
-    Glyph::new(0x004D, 0x05A1, 24, 26, 19, -2, 0),
-    Glyph::new(0x004E, 0x05DF, 20, 22, 20, -1, -1),
-    Glyph::new(0x004F, 0x0616, 20, 18, 20, 1, -1),
-    Glyph::new(0x0050, 0x0643, 16, 16, 19, -1, 0),
-    Glyph::new(0x0051, 0x0669, 20, 22, 25, 1, -6),
-    Glyph::new(0x0052, 0x06AE, 17, 17, 20, -1, -1),
-    Glyph::new(0x0053, 0x06D9, 14, 14, 20, 0, -1),
-    Glyph::new(0x0054, 0x06FC, 17, 16, 19, 2, 0),
-    Glyph::new(0x0055, 0x0722, 20, 19, 20, 2, -1),
-    Glyph::new(0x0056, 0x0752, 19, 19, 20, 1, -1),
-    Glyph::new(0x0057, 0x0782, 28, 27, 20, 2, -1),
-    Glyph::new(0x0058, 0x07C6, 18, 22, 19, -3, 0),
-    Glyph::new(0x0059, 0x07FB, 17, 18, 19, 1, 0),
-    Glyph::new(0x005A, 0x0826, 16, 16, 20, -1, -1),
-    Glyph::new(0x005B, 0x084E, 9, 10, 26, -1, -5),
-    Glyph::new(0x005C, 0x086F, 13, 11, 21, 1, -2),
-    Glyph::new(0x005D, 0x088C, 9, 11, 26, -1, -5),
-    Glyph::new(0x005E, 0x08B0, 17, 12, 13, 2, 4),
-    Glyph::new(0x005F, 0x08C4, 13, 13, 3, 0, -4),
-    Glyph::new(0x0060, 0x08C9, 17, 6, 6, 5, 15),
-    Glyph::new(0x0061, 0x08CE, 16, 14, 15, 1, -1),
-    Glyph::new(0x0062, 0x08E9, 15, 14, 22, 0, -1),
-    Glyph::new(0x0063, 0x0910, 12, 10, 15, 1, -1),
-    Glyph::new(0x0064, 0x0923, 16, 14, 22, 1, -1),
-    Glyph::new(0x0065, 0x094A, 13, 11, 15, 1, -1),
-    Glyph::new(0x0066, 0x095F, 11, 19, 27, -5, -7),
-    Glyph::new(0x0067, 0x09A0, 13, 18, 21, -3, -7),
-    Glyph::new(0x0068, 0x09D0, 16, 15, 22, 0, -1),
-    Glyph::new(0x0069, 0x09FA, 9, 8, 21, 1, -1),
-    Glyph::new(0x006A, 0x0A0F, 8, 14, 27, -5, -7),
-    Glyph::new(0x006B, 0x0A3F, 14, 13, 22, 1, -1),
-    Glyph::new(0x006C, 0x0A63, 8, 7, 22, 1, -1),
-    Glyph::new(0x006D, 0x0A77, 24, 22, 15, 1, -1),
-    Glyph::new(0x006E, 0x0AA1, 17, 15, 15, 1, -1),
-    Glyph::new(0x006F, 0x0ABE, 15, 13, 15, 1, -1),
-    Glyph::new(0x0070, 0x0AD7, 15, 16, 20, -2, -6),
-    Glyph::new(0x0071, 0x0AFF, 15, 14, 20, 1, -6),
-    Glyph::new(0x0072, 0x0B22, 12, 11, 14, 1, 0),
-    Glyph::new(0x0073, 0x0B36, 11, 11, 15, 0, -1),
-    Glyph::new(0x0074, 0x0B4B, 11, 11, 18, 0, -1),
-    Glyph::new(0x0075, 0x0B64, 16, 15, 15, 1, -1),
-    Glyph::new(0x0076, 0x0B81, 14, 13, 15, 0, -1),
-    Glyph::new(0x0077, 0x0B9A, 21, 20, 15, 0, -1),
-    Glyph::new(0x0078, 0x0BC0, 15, 16, 15, -1, -1),
-    Glyph::new(0x0079, 0x0BDE, 14, 17, 21, -3, -7),
-    Glyph::new(0x007A, 0x0C0B, 13, 12, 15, 0, -1),
-    Glyph::new(0x007B, 0x0C22, 11, 10, 26, 1, -5),
-    Glyph::new(0x007C, 0x0C43, 8, 8, 24, 0, -4),
-    Glyph::new(0x007D, 0x0C5B, 11, 10, 26, -1, -5),
-    Glyph::new(0x007E, 0x0C7C, 17, 12, 5, 2, 6),
-    Glyph::new(0x00A1, 0x0C84, 8, 8, 20, -1, -6),
-    Glyph::new(0x00A2, 0x0C98, 17, 13, 25, 2, -5),
-    Glyph::new(0x00A3, 0x0CC1, 17, 17, 20, -1, -1),
-    Glyph::new(0x00A4, 0x0CEC, 17, 16, 13, 0, 2),
-    Glyph::new(0x00A5, 0x0D06, 17, 17, 18, 1, 0),
-    Glyph::new(0x00A7, 0x0D2D, 13, 12, 21, 0, -3),
-    Glyph::new(0x00A9, 0x0D4D, 21, 20, 20, 0, -1),
-    Glyph::new(0x00AA, 0x0D7F, 12, 10, 13, 1, 6),
-    Glyph::new(0x00AB, 0x0D90, 14, 13, 11, 0, 1),
-    Glyph::new(0x00AE, 0x0DA2, 16, 15, 15, 0, 6),
-    Glyph::new(0x00B0, 0x0DBF, 14, 10, 10, 2, 9),
-    Glyph::new(0x00B1, 0x0DCC, 17, 12, 16, 2, 0),
-    Glyph::new(0x00B2, 0x0DE4, 12, 11, 13, 0, 9),
-    Glyph::new(0x00B3, 0x0DF6, 12, 9, 13, 1, 9),
-    Glyph::new(0x00B5, 0x0E05, 16, 17, 21, -1, -7),
-    Glyph::new(0x00B6, 0x0E32, 16, 17, 23, -1, -4),
-    Glyph::new(0x00B7, 0x0E63, 8, 4, 4, 2, 5),
-    Glyph::new(0x00B9, 0x0E65, 12, 7, 13, 2, 9),
-    Glyph::new(0x00BA, 0x0E71, 12, 10, 13, 1, 6),
-    Glyph::new(0x00BB, 0x0E82, 14, 13, 11, 0, 1),
-    Glyph::new(0x00BC, 0x0E94, 28, 25, 21, 2, -2),
-    Glyph::new(0x00BD, 0x0ED6, 28, 25, 21, 2, -2),
-    Glyph::new(0x00BE, 0x0F18, 28, 26, 21, 1, -2),
-    Glyph::new(0x00BF, 0x0F5D, 11, 9, 20, 0, -6),
-    Glyph::new(0x00C0, 0x0F74, 20, 20, 25, -2, 0),
-    Glyph::new(0x00C1, 0x0FB3, 20, 20, 25, -2, 0),
-    Glyph::new(0x00C2, 0x0FF2, 20, 20, 25, -2, 0),
-    Glyph::new(0x00C3, 0x1031, 20, 20, 25, -2, 0),
-    Glyph::new(0x00C4, 0x1070, 20, 20, 24, -2, 0),
-    Glyph::new(0x00C5, 0x10AC, 20, 20, 26, -2, 0),
-    Glyph::new(0x00C6, 0x10ED, 24, 26, 19, -2, 0),
-    Glyph::new(0x00C7, 0x112B, 17, 16, 26, 1, -7),
-    Glyph::new(0x00C8, 0x115F, 16, 17, 25, -1, 0),
-    Glyph::new(0x00C9, 0x1195, 16, 17, 25, -1, 0),
-    Glyph::new(0x00CA, 0x11CB, 16, 17, 25, -1, 0),
-    Glyph::new(0x00CB, 0x1201, 16, 17, 24, -1, 0),
-    Glyph::new(0x00CC, 0x1234, 10, 12, 25, -1, 0),
-    Glyph::new(0x00CD, 0x125A, 10, 13, 25, -1, 0),
-    Glyph::new(0x00CE, 0x1283, 10, 13, 25, -1, 0),
-    Glyph::new(0x00CF, 0x12AC, 10, 13, 24, -1, 0),
-    Glyph::new(0x00D0, 0x12D3, 19, 19, 20, -1, -1),
-    Glyph::new(0x00D1, 0x1303, 20, 22, 26, -1, -1),
-    Glyph::new(0x00D2, 0x134B, 20, 18, 26, 1, -1),
-    Glyph::new(0x00D3, 0x1386, 20, 18, 26, 1, -1),
-    Glyph::new(0x00D4, 0x13C1, 20, 18, 26, 1, -1),
-    Glyph::new(0x00D5, 0x13FC, 20, 18, 26, 1, -1),
-    Glyph::new(0x00D6, 0x1437, 20, 18, 25, 1, -1),
-    Glyph::new(0x00D7, 0x1470, 17, 11, 11, 3, 3),
-    Glyph::new(0x00D8, 0x1480, 20, 21, 20, -1, -1),
-    Glyph::new(0x00D9, 0x14B5, 20, 19, 26, 2, -1),
-    Glyph::new(0x00DA, 0x14F3, 20, 19, 26, 2, -1),
-    Glyph::new(0x00DB, 0x1531, 20, 19, 26, 2, -1),
-    Glyph::new(0x00DC, 0x156F, 20, 19, 25, 2, -1),
-    Glyph::new(0x00DE, 0x15AB, 16, 16, 19, -1, 0),
-    Glyph::new(0x00DF, 0x15D1, 17, 20, 28, -4, -7),
-    Glyph::new(0x00E0, 0x1617, 16, 14, 22, 1, -1),
-    Glyph::new(0x00E1, 0x163E, 16, 14, 23, 1, -1),
-    Glyph::new(0x00E2, 0x1667, 16, 14, 22, 1, -1),
-    Glyph::new(0x00E3, 0x168E, 16, 14, 22, 1, -1),
-    Glyph::new(0x00E4, 0x16B5, 16, 14, 21, 1, -1),
-    Glyph::new(0x00E5, 0x16DA, 16, 14, 23, 1, -1),
-    Glyph::new(0x00E6, 0x1703, 21, 19, 15, 1, -1),
-    Glyph::new(0x00E7, 0x1727, 12, 10, 21, 1, -7),
-    Glyph::new(0x00E8, 0x1742, 13, 11, 22, 1, -1),
-    Glyph::new(0x00E9, 0x1761, 13, 11, 23, 1, -1),
-    Glyph::new(0x00EA, 0x1781, 13, 12, 22, 1, -1),
-    Glyph::new(0x00EB, 0x17A2, 13, 12, 21, 1, -1),
-    Glyph::new(0x00EC, 0x17C2, 9, 7, 22, 1, -1),
-    Glyph::new(0x00ED, 0x17D6, 9, 9, 23, 1, -1),
-    Glyph::new(0x00EE, 0x17F0, 9, 10, 22, 1, -1),
-    Glyph::new(0x00EF, 0x180C, 9, 10, 21, 1, -1),
-    Glyph::new(0x00F0, 0x1827, 15, 14, 22, 0, -1),
-    Glyph::new(0x00F1, 0x184E, 17, 15, 22, 1, -1),
-    Glyph::new(0x00F2, 0x1878, 15, 13, 22, 1, -1),
-    Glyph::new(0x00F3, 0x189C, 15, 13, 23, 1, -1),
-    Glyph::new(0x00F4, 0x18C2, 15, 13, 22, 1, -1),
-    Glyph::new(0x00F5, 0x18E6, 15, 13, 22, 1, -1),
-    Glyph::new(0x00F6, 0x190A, 15, 13, 21, 1, -1),
-    Glyph::new(0x00F7, 0x192D, 17, 12, 13, 2, 2),
-    Glyph::new(0x00F8, 0x1941, 15, 16, 15, -1, -1),
-    Glyph::new(0x00F9, 0x195F, 16, 15, 22, 1, -1),
-    Glyph::new(0x00FA, 0x1989, 16, 15, 23, 1, -1),
-    Glyph::new(0x00FB, 0x19B5, 16, 15, 22, 1, -1),
-    Glyph::new(0x00FC, 0x19DF, 16, 15, 21, 1, -1),
-    Glyph::new(0x00FE, 0x1A07, 15, 16, 27, -2, -6),
-    Glyph::new(0x00FF, 0x1A3D, 14, 17, 27, -3, -7),
-    Glyph::new(0x0104, 0x1A77, 20, 20, 25, -2, -6),
-    Glyph::new(0x0105, 0x1AB6, 16, 14, 20, 1, -6),
-    Glyph::new(0x0106, 0x1AD9, 17, 16, 26, 1, -1),
-    Glyph::new(0x0107, 0x1B0D, 12, 11, 23, 1, -1),
-    Glyph::new(0x010C, 0x1B2D, 17, 16, 27, 1, -1),
-    Glyph::new(0x010D, 0x1B63, 12, 13, 23, 1, -1),
-    Glyph::new(0x010E, 0x1B89, 19, 19, 27, -1, -1),
-    Glyph::new(0x010F, 0x1BCA, 16, 19, 24, 1, -1),
-    Glyph::new(0x0118, 0x1C03, 16, 17, 25, -1, -6),
-    Glyph::new(0x0119, 0x1C39, 13, 11, 20, 1, -6),
-    Glyph::new(0x011A, 0x1C55, 16, 17, 26, -1, 0),
-    Glyph::new(0x011B, 0x1C8D, 13, 13, 23, 1, -1),
-    Glyph::new(0x0139, 0x1CB3, 16, 15, 25, -1, 0),
-    Glyph::new(0x013A, 0x1CE2, 8, 9, 28, 1, -1),
-    Glyph::new(0x013D, 0x1D02, 16, 16, 21, -1, 0),
-    Glyph::new(0x013E, 0x1D2C, 9, 12, 24, 1, -1),
-    Glyph::new(0x0141, 0x1D50, 16, 15, 19, -1, 0),
-    Glyph::new(0x0142, 0x1D74, 8, 10, 22, -1, -1),
-    Glyph::new(0x0143, 0x1D90, 20, 22, 26, -1, -1),
-    Glyph::new(0x0144, 0x1DD8, 17, 15, 23, 1, -1),
-    Glyph::new(0x0147, 0x1E04, 20, 22, 27, -1, -1),
-    Glyph::new(0x0148, 0x1E4F, 17, 15, 23, 1, -1),
-    Glyph::new(0x0152, 0x1E7B, 26, 24, 20, 1, -1),
-    Glyph::new(0x0153, 0x1EB7, 22, 20, 15, 1, -1),
-    Glyph::new(0x0158, 0x1EDD, 17, 17, 27, -1, -1),
-    Glyph::new(0x0159, 0x1F17, 12, 12, 22, 1, 0),
-    Glyph::new(0x015A, 0x1F38, 14, 14, 26, 0, -1),
-    Glyph::new(0x015B, 0x1F66, 11, 12, 23, 0, -1),
-    Glyph::new(0x0160, 0x1F89, 14, 15, 27, 0, -1),
-    Glyph::new(0x0161, 0x1FBC, 11, 13, 23, 0, -1),
-    Glyph::new(0x0164, 0x1FE2, 17, 16, 26, 2, 0),
-    Glyph::new(0x0165, 0x2016, 11, 12, 22, 0, -1),
-    Glyph::new(0x016E, 0x2037, 20, 19, 27, 2, -1),
-    Glyph::new(0x016F, 0x2078, 16, 15, 23, 1, -1),
-    Glyph::new(0x0170, 0x20A4, 20, 19, 27, 2, -1),
-    Glyph::new(0x0171, 0x20E5, 16, 15, 23, 1, -1),
-    Glyph::new(0x0178, 0x2111, 17, 18, 24, 1, 0),
-    Glyph::new(0x0179, 0x2147, 16, 16, 26, -1, -1),
-    Glyph::new(0x017A, 0x217B, 13, 12, 23, 0, -1),
-    Glyph::new(0x017B, 0x219E, 16, 16, 26, -1, -1),
-    Glyph::new(0x017C, 0x21D2, 13, 12, 21, 0, -1),
-    Glyph::new(0x017D, 0x21F2, 16, 16, 27, -1, -1),
-    Glyph::new(0x017E, 0x2228, 13, 13, 23, 0, -1),
-    Glyph::new(0x03C0, 0x224E, 16, 16, 15, 0, -1),
-    Glyph::new(0x1E9E, 0x226C, 19, 19, 20, -2, -1),
-    Glyph::new(0x2013, 0x229C, 13, 13, 3, 0, 5),
-    Glyph::new(0x2014, 0x22A1, 26, 26, 3, 0, 5),
-    Glyph::new(0x2018, 0x22AB, 8, 6, 9, 2, 11),
-    Glyph::new(0x2019, 0x22B2, 8, 6, 9, 1, 11),
-    Glyph::new(0x201A, 0x22B9, 8, 6, 9, 0, -5),
-    Glyph::new(0x201B, 0x22C0, 7, 5, 9, 1, 11),
-    Glyph::new(0x201C, 0x22C6, 14, 11, 9, 2, 11),
-    Glyph::new(0x201D, 0x22D3, 14, 11, 9, 1, 11),
-    Glyph::new(0x201E, 0x22E0, 14, 12, 9, 0, -5),
-    Glyph::new(0x201F, 0x22EE, 12, 10, 9, 1, 11),
-    Glyph::new(0x2020, 0x22FA, 13, 11, 18, 1, 1),
-    Glyph::new(0x2021, 0x2313, 13, 12, 21, 0, -2),
-    Glyph::new(0x2022, 0x2333, 8, 6, 6, 1, 4),
-    Glyph::new(0x2026, 0x2338, 26, 22, 5, 2, -1),
-    Glyph::new(0x2039, 0x2346, 9, 8, 11, 0, 1),
-    Glyph::new(0x203A, 0x2351, 9, 8, 11, 0, 1),
-    Glyph::new(0x2070, 0x235C, 12, 10, 13, 1, 9),
-    Glyph::new(0x2074, 0x236D, 12, 11, 13, 0, 9),
-    Glyph::new(0x2075, 0x237F, 12, 10, 13, 1, 9),
-    Glyph::new(0x2076, 0x2390, 12, 11, 13, 1, 9),
-    Glyph::new(0x2077, 0x23A2, 12, 10, 13, 2, 9),
-    Glyph::new(0x2078, 0x23B3, 12, 10, 13, 1, 9),
-    Glyph::new(0x2079, 0x23C4, 12, 11, 13, 0, 9),
-    Glyph::new(0x2080, 0x23D6, 12, 10, 13, 1, -4),
-    Glyph::new(0x2081, 0x23E7, 12, 7, 13, 2, -4),
-    Glyph::new(0x2082, 0x23F3, 12, 11, 13, 0, -4),
-    Glyph::new(0x2083, 0x2405, 12, 9, 13, 1, -4),
-    Glyph::new(0x2084, 0x2414, 12, 11, 13, 0, -4),
-    Glyph::new(0x2085, 0x2426, 12, 10, 13, 1, -4),
-    Glyph::new(0x2086, 0x2437, 12, 11, 13, 1, -4),
-    Glyph::new(0x2087, 0x2449, 12, 10, 13, 2, -4),
-    Glyph::new(0x2088, 0x245A, 12, 10, 13, 1, -4),
-    Glyph::new(0x2089, 0x246B, 12, 11, 13, 0, -4),
-    Glyph::new(0x20AC, 0x247D, 17, 18, 20, -1, -1),
-    Glyph::new(0x2122, 0x24AA, 19, 18, 10, 2, 9),
-    Glyph::new(0x2153, 0x24C1, 28, 24, 21, 2, -2),
-    Glyph::new(0x2154, 0x2500, 28, 26, 21, 0, -2),
-    Glyph::new(0x215B, 0x2545, 28, 25, 21, 2, -2),
-    Glyph::new(0x215C, 0x2587, 28, 26, 21, 1, -2),
-    Glyph::new(0x215D, 0x25CC, 28, 26, 21, 1, -2),
-    Glyph::new(0x215E, 0x2611, 28, 25, 21, 2, -2),
-    Glyph::new(0x2190, 0x2653, 26, 16, 12, 5, 3),
-    Glyph::new(0x2191, 0x266B, 26, 12, 18, 7, 0),
-    Glyph::new(0x2192, 0x2686, 26, 16, 12, 5, 3),
-    Glyph::new(0x2193, 0x269E, 26, 12, 18, 7, 0),
-    Glyph::new(0x2194, 0x26B9, 26, 16, 12, 5, 3),
-    Glyph::new(0x2195, 0x26D1, 26, 12, 18, 7, 0),
-    Glyph::new(0x21D0, 0x26EC, 26, 16, 12, 5, 3),
-    Glyph::new(0x21D1, 0x2704, 26, 12, 16, 7, 1),
-    Glyph::new(0x21D2, 0x271C, 26, 16, 12, 5, 3),
-    Glyph::new(0x21D3, 0x2734, 26, 12, 16, 7, 1),
-    Glyph::new(0x21D4, 0x274C, 26, 16, 12, 5, 3),
-    Glyph::new(0x2202, 0x2764, 17, 13, 22, 2, -1),
-    Glyph::new(0x2206, 0x2788, 18, 17, 19, 0, 0),
-    Glyph::new(0x220F, 0x27B1, 22, 20, 24, 1, -5),
-    Glyph::new(0x2211, 0x27ED, 16, 16, 24, 0, -5),
-    Glyph::new(0x221A, 0x281D, 17, 17, 24, 0, -3),
-    Glyph::new(0x221E, 0x2850, 17, 16, 9, 0, 4),
-    Glyph::new(0x222B, 0x2862, 17, 14, 27, 1, -6),
-    Glyph::new(0x2260, 0x2892, 17, 12, 12, 2, 3),
-    Glyph::new(0x2264, 0x28A4, 17, 12, 16, 2, 0),
-    Glyph::new(0x2265, 0x28BC, 17, 12, 16, 2, 0),
+    Glyph::new(0x0022, 0x0025, 10, 9, 9, 1, 10),
+    Glyph::new(0x0023, 0x0040, 17, 16, 17, 0, -2),
+    Glyph::new(0x0024, 0x007D, 17, 15, 26, 0, -5),
+    Glyph::new(0x0025, 0x00CC, 26, 23, 21, 1, -2),
+    Glyph::new(0x0026, 0x013B, 24, 21, 21, 1, -2),
+    Glyph::new(0x0027, 0x0194, 6, 5, 9, 1, 10),
+    Glyph::new(0x0028, 0x01A1, 11, 11, 27, 1, -6),
+    Glyph::new(0x0029, 0x01D3, 11, 11, 27, -2, -6),
+    Glyph::new(0x002A, 0x0207, 10, 9, 9, 1, 10),
+    Glyph::new(0x002B, 0x0221, 17, 12, 12, 2, 3),
+    Glyph::new(0x002C, 0x023B, 8, 7, 9, -1, -5),
+    Glyph::new(0x002D, 0x0248, 10, 8, 3, 1, 5),
+    Glyph::new(0x002E, 0x0252, 8, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x0259, 13, 15, 21, -1, -2),
+    Glyph::new(0x0030, 0x027D, 17, 16, 20, 0, -1),
+    Glyph::new(0x0031, 0x02BF, 17, 10, 19, 2, 0),
+    Glyph::new(0x0032, 0x02E6, 17, 15, 19, 0, 0),
+    Glyph::new(0x0033, 0x031E, 17, 15, 20, 0, -1),
+    Glyph::new(0x0034, 0x034F, 17, 15, 18, 0, 0),
+    Glyph::new(0x0035, 0x0389, 17, 14, 19, 1, -1),
+    Glyph::new(0x0036, 0x03BA, 17, 15, 20, 1, -1),
+    Glyph::new(0x0037, 0x03F4, 17, 14, 19, 3, -1),
+    Glyph::new(0x0038, 0x0427, 17, 14, 20, 1, -1),
+    Glyph::new(0x0039, 0x0465, 17, 15, 20, 0, -1),
+    Glyph::new(0x003A, 0x04A1, 8, 7, 15, 1, -1),
+    Glyph::new(0x003B, 0x04B0, 8, 9, 19, -1, -5),
+    Glyph::new(0x003C, 0x04C7, 17, 12, 12, 2, 3),
+    Glyph::new(0x003D, 0x04E4, 17, 12, 8, 2, 5),
+    Glyph::new(0x003E, 0x04F8, 17, 12, 12, 2, 3),
+    Glyph::new(0x003F, 0x0512, 11, 9, 20, 2, -1),
+    Glyph::new(0x0040, 0x0538, 26, 24, 23, 1, -5),
+    Glyph::new(0x0041, 0x05B1, 20, 20, 19, -2, 0),
+    Glyph::new(0x0042, 0x05F6, 17, 16, 20, -1, -1),
+    Glyph::new(0x0043, 0x063D, 17, 16, 20, 1, -1),
+    Glyph::new(0x0044, 0x0670, 19, 19, 20, -1, -1),
+    Glyph::new(0x0045, 0x06B6, 16, 17, 19, -1, 0),
+    Glyph::new(0x0046, 0x06EC, 15, 16, 19, -1, 0),
+    Glyph::new(0x0047, 0x0719, 19, 17, 20, 1, -1),
+    Glyph::new(0x0048, 0x0759, 21, 23, 19, -1, 0),
+    Glyph::new(0x0049, 0x07A2, 10, 12, 19, -1, 0),
+    Glyph::new(0x004A, 0x07C9, 10, 16, 24, -5, -5),
+    Glyph::new(0x004B, 0x07FA, 19, 20, 20, -1, -1),
+    Glyph::new(0x004C, 0x0843, 16, 15, 19, -1, 0),
+    Glyph::new(0x004D, 0x086F, 24, 26, 19, -2, 0),
+    Glyph::new(0x004E, 0x08D6, 20, 22, 20, -1, -1),
+    Glyph::new(0x004F, 0x0926, 20, 18, 20, 1, -1),
+    Glyph::new(0x0050, 0x096B, 16, 16, 19, -1, 0),
+    Glyph::new(0x0051, 0x09A7, 20, 22, 25, 1, -6),
+    Glyph::new(0x0052, 0x0A04, 17, 17, 20, -1, -1),
+    Glyph::new(0x0053, 0x0A4B, 14, 14, 20, 0, -1),
+    Glyph::new(0x0054, 0x0A85, 17, 16, 19, 2, 0),
+    Glyph::new(0x0055, 0x0AB5, 20, 19, 20, 2, -1),
+    Glyph::new(0x0056, 0x0AFC, 19, 19, 20, 1, -1),
+    Glyph::new(0x0057, 0x0B3A, 28, 27, 20, 2, -1),
+    Glyph::new(0x0058, 0x0BA3, 18, 22, 19, -3, 0),
+    Glyph::new(0x0059, 0x0BE4, 17, 18, 19, 1, 0),
+    Glyph::new(0x005A, 0x0C1A, 16, 16, 20, -1, -1),
+    Glyph::new(0x005B, 0x0C4C, 9, 10, 26, -1, -5),
+    Glyph::new(0x005C, 0x0C83, 13, 11, 21, 1, -2),
+    Glyph::new(0x005D, 0x0CAB, 9, 11, 26, -1, -5),
+    Glyph::new(0x005E, 0x0CD8, 17, 12, 13, 2, 4),
+    Glyph::new(0x005F, 0x0CFB, 13, 13, 3, 0, -4),
+    Glyph::new(0x0060, 0x0D04, 17, 6, 6, 5, 15),
+    Glyph::new(0x0061, 0x0D0D, 16, 14, 15, 1, -1),
+    Glyph::new(0x0062, 0x0D46, 15, 14, 22, 0, -1),
+    Glyph::new(0x0063, 0x0D85, 12, 10, 15, 1, -1),
+    Glyph::new(0x0064, 0x0DA9, 16, 14, 22, 1, -1),
+    Glyph::new(0x0065, 0x0DEF, 13, 11, 15, 1, -1),
+    Glyph::new(0x0066, 0x0E18, 11, 19, 27, -5, -7),
+    Glyph::new(0x0067, 0x0E5A, 13, 18, 21, -3, -7),
+    Glyph::new(0x0068, 0x0E9F, 16, 15, 22, 0, -1),
+    Glyph::new(0x0069, 0x0EE6, 9, 8, 21, 1, -1),
+    Glyph::new(0x006A, 0x0F0E, 8, 14, 27, -5, -7),
+    Glyph::new(0x006B, 0x0F47, 14, 13, 22, 1, -1),
+    Glyph::new(0x006C, 0x0F86, 8, 7, 22, 1, -1),
+    Glyph::new(0x006D, 0x0FAC, 24, 22, 15, 1, -1),
+    Glyph::new(0x006E, 0x1000, 17, 15, 15, 1, -1),
+    Glyph::new(0x006F, 0x1039, 15, 13, 15, 1, -1),
+    Glyph::new(0x0070, 0x1067, 15, 16, 20, -2, -6),
+    Glyph::new(0x0071, 0x10B2, 15, 14, 20, 1, -6),
+    Glyph::new(0x0072, 0x10F3, 12, 11, 14, 1, 0),
+    Glyph::new(0x0073, 0x1115, 11, 11, 15, 0, -1),
+    Glyph::new(0x0074, 0x1136, 11, 11, 18, 0, -1),
+    Glyph::new(0x0075, 0x115D, 16, 15, 15, 1, -1),
+    Glyph::new(0x0076, 0x1195, 14, 13, 15, 0, -1),
+    Glyph::new(0x0077, 0x11C0, 21, 20, 15, 0, -1),
+    Glyph::new(0x0078, 0x120C, 15, 16, 15, -1, -1),
+    Glyph::new(0x0079, 0x123F, 14, 17, 21, -3, -7),
+    Glyph::new(0x007A, 0x127E, 13, 12, 15, 0, -1),
+    Glyph::new(0x007B, 0x12A7, 11, 10, 26, 1, -5),
+    Glyph::new(0x007C, 0x12DA, 8, 8, 24, 0, -4),
+    Glyph::new(0x007D, 0x1309, 11, 10, 26, -1, -5),
+    Glyph::new(0x007E, 0x1340, 17, 12, 5, 2, 6),
+    Glyph::new(0x00A1, 0x1350, 8, 8, 20, -1, -6),
+    Glyph::new(0x00A2, 0x1375, 17, 13, 25, 2, -5),
+    Glyph::new(0x00A3, 0x13BD, 17, 17, 20, -1, -1),
+    Glyph::new(0x00A4, 0x13F4, 17, 16, 13, 0, 2),
+    Glyph::new(0x00A5, 0x1420, 17, 17, 18, 1, 0),
+    Glyph::new(0x00A7, 0x1463, 13, 12, 21, 0, -3),
+    Glyph::new(0x00A9, 0x14A5, 21, 20, 20, 0, -1),
+    Glyph::new(0x00AA, 0x1507, 12, 10, 13, 1, 6),
+    Glyph::new(0x00AB, 0x152E, 14, 13, 11, 0, 1),
+    Glyph::new(0x00AE, 0x1553, 16, 15, 15, 0, 6),
+    Glyph::new(0x00B0, 0x1597, 14, 10, 10, 2, 9),
+    Glyph::new(0x00B1, 0x15AE, 17, 12, 16, 2, 0),
+    Glyph::new(0x00B2, 0x15CD, 12, 11, 13, 0, 9),
+    Glyph::new(0x00B3, 0x15EE, 12, 9, 13, 1, 9),
+    Glyph::new(0x00B5, 0x160D, 16, 17, 21, -1, -7),
+    Glyph::new(0x00B6, 0x1653, 16, 17, 23, -1, -4),
+    Glyph::new(0x00B7, 0x169D, 8, 4, 4, 2, 5),
+    Glyph::new(0x00B9, 0x16A4, 12, 7, 13, 2, 9),
+    Glyph::new(0x00BA, 0x16BD, 12, 10, 13, 1, 6),
+    Glyph::new(0x00BB, 0x16E1, 14, 13, 11, 0, 1),
+    Glyph::new(0x00BC, 0x1707, 28, 25, 21, 2, -2),
+    Glyph::new(0x00BD, 0x176E, 28, 25, 21, 2, -2),
+    Glyph::new(0x00BE, 0x17D1, 28, 26, 21, 1, -2),
+    Glyph::new(0x00BF, 0x183A, 11, 9, 20, 0, -6),
+    Glyph::new(0x00C0, 0x1860, 20, 20, 25, -2, 0),
+    Glyph::new(0x00C1, 0x18B2, 20, 20, 25, -2, 0),
+    Glyph::new(0x00C2, 0x1904, 20, 20, 25, -2, 0),
+    Glyph::new(0x00C3, 0x1958, 20, 20, 25, -2, 0),
+    Glyph::new(0x00C4, 0x19AE, 20, 20, 24, -2, 0),
+    Glyph::new(0x00C5, 0x1A02, 20, 20, 26, -2, 0),
+    Glyph::new(0x00C6, 0x1A5C, 24, 26, 19, -2, 0),
+    Glyph::new(0x00C7, 0x1AAF, 17, 16, 26, 1, -7),
+    Glyph::new(0x00C8, 0x1AF0, 16, 17, 25, -1, 0),
+    Glyph::new(0x00C9, 0x1B31, 16, 17, 25, -1, 0),
+    Glyph::new(0x00CA, 0x1B73, 16, 17, 25, -1, 0),
+    Glyph::new(0x00CB, 0x1BB9, 16, 17, 24, -1, 0),
+    Glyph::new(0x00CC, 0x1BFD, 10, 12, 25, -1, 0),
+    Glyph::new(0x00CD, 0x1C2F, 10, 13, 25, -1, 0),
+    Glyph::new(0x00CE, 0x1C64, 10, 13, 25, -1, 0),
+    Glyph::new(0x00CF, 0x1C9A, 10, 13, 24, -1, 0),
+    Glyph::new(0x00D0, 0x1CD3, 19, 19, 20, -1, -1),
+    Glyph::new(0x00D1, 0x1D1B, 20, 22, 26, -1, -1),
+    Glyph::new(0x00D2, 0x1D7C, 20, 18, 26, 1, -1),
+    Glyph::new(0x00D3, 0x1DCC, 20, 18, 26, 1, -1),
+    Glyph::new(0x00D4, 0x1E1D, 20, 18, 26, 1, -1),
+    Glyph::new(0x00D5, 0x1E70, 20, 18, 26, 1, -1),
+    Glyph::new(0x00D6, 0x1EC4, 20, 18, 25, 1, -1),
+    Glyph::new(0x00D7, 0x1F19, 17, 11, 11, 3, 3),
+    Glyph::new(0x00D8, 0x1F35, 20, 21, 20, -1, -1),
+    Glyph::new(0x00D9, 0x1F8C, 20, 19, 26, 2, -1),
+    Glyph::new(0x00DA, 0x1FDF, 20, 19, 26, 2, -1),
+    Glyph::new(0x00DB, 0x2032, 20, 19, 26, 2, -1),
+    Glyph::new(0x00DC, 0x2087, 20, 19, 25, 2, -1),
+    Glyph::new(0x00DE, 0x20DE, 16, 16, 19, -1, 0),
+    Glyph::new(0x00DF, 0x2118, 17, 20, 28, -4, -7),
+    Glyph::new(0x00E0, 0x217B, 16, 14, 22, 1, -1),
+    Glyph::new(0x00E1, 0x21BF, 16, 14, 23, 1, -1),
+    Glyph::new(0x00E2, 0x2205, 16, 14, 22, 1, -1),
+    Glyph::new(0x00E3, 0x2250, 16, 14, 22, 1, -1),
+    Glyph::new(0x00E4, 0x2299, 16, 14, 21, 1, -1),
+    Glyph::new(0x00E5, 0x22E0, 16, 14, 23, 1, -1),
+    Glyph::new(0x00E6, 0x232E, 21, 19, 15, 1, -1),
+    Glyph::new(0x00E7, 0x2376, 12, 10, 21, 1, -7),
+    Glyph::new(0x00E8, 0x23A6, 13, 11, 22, 1, -1),
+    Glyph::new(0x00E9, 0x23DC, 13, 11, 23, 1, -1),
+    Glyph::new(0x00EA, 0x2411, 13, 12, 22, 1, -1),
+    Glyph::new(0x00EB, 0x244D, 13, 12, 21, 1, -1),
+    Glyph::new(0x00EC, 0x2486, 9, 7, 22, 1, -1),
+    Glyph::new(0x00ED, 0x24AF, 9, 9, 23, 1, -1),
+    Glyph::new(0x00EE, 0x24D8, 9, 10, 22, 1, -1),
+    Glyph::new(0x00EF, 0x250A, 9, 10, 21, 1, -1),
+    Glyph::new(0x00F0, 0x2539, 15, 14, 22, 0, -1),
+    Glyph::new(0x00F1, 0x257A, 17, 15, 22, 1, -1),
+    Glyph::new(0x00F2, 0x25C2, 15, 13, 22, 1, -1),
+    Glyph::new(0x00F3, 0x25FD, 15, 13, 23, 1, -1),
+    Glyph::new(0x00F4, 0x2638, 15, 13, 22, 1, -1),
+    Glyph::new(0x00F5, 0x2677, 15, 13, 22, 1, -1),
+    Glyph::new(0x00F6, 0x26B6, 15, 13, 21, 1, -1),
+    Glyph::new(0x00F7, 0x26F2, 17, 12, 13, 2, 2),
+    Glyph::new(0x00F8, 0x270C, 15, 16, 15, -1, -1),
+    Glyph::new(0x00F9, 0x2744, 16, 15, 22, 1, -1),
+    Glyph::new(0x00FA, 0x2789, 16, 15, 23, 1, -1),
+    Glyph::new(0x00FB, 0x27CE, 16, 15, 22, 1, -1),
+    Glyph::new(0x00FC, 0x2816, 16, 15, 21, 1, -1),
+    Glyph::new(0x00FE, 0x285B, 15, 16, 27, -2, -6),
+    Glyph::new(0x00FF, 0x28AD, 14, 17, 27, -3, -7),
+    Glyph::new(0x0104, 0x28F9, 20, 20, 25, -2, -6),
+    Glyph::new(0x0105, 0x294E, 16, 14, 20, 1, -6),
+    Glyph::new(0x0106, 0x2991, 17, 16, 26, 1, -1),
+    Glyph::new(0x0107, 0x29D1, 12, 11, 23, 1, -1),
+    Glyph::new(0x010C, 0x29FE, 17, 16, 27, 1, -1),
+    Glyph::new(0x010D, 0x2A41, 12, 13, 23, 1, -1),
+    Glyph::new(0x010E, 0x2A78, 19, 19, 27, -1, -1),
+    Glyph::new(0x010F, 0x2ACF, 16, 19, 24, 1, -1),
+    Glyph::new(0x0118, 0x2B23, 16, 17, 25, -1, -6),
+    Glyph::new(0x0119, 0x2B67, 13, 11, 20, 1, -6),
+    Glyph::new(0x011A, 0x2B9C, 16, 17, 26, -1, 0),
+    Glyph::new(0x011B, 0x2BE2, 13, 13, 23, 1, -1),
+    Glyph::new(0x0139, 0x2C1D, 16, 15, 25, -1, 0),
+    Glyph::new(0x013A, 0x2C55, 8, 9, 28, 1, -1),
+    Glyph::new(0x013D, 0x2C87, 16, 16, 21, -1, 0),
+    Glyph::new(0x013E, 0x2CC0, 9, 12, 24, 1, -1),
+    Glyph::new(0x0141, 0x2CF7, 16, 15, 19, -1, 0),
+    Glyph::new(0x0142, 0x2D28, 8, 10, 22, -1, -1),
+    Glyph::new(0x0143, 0x2D57, 20, 22, 26, -1, -1),
+    Glyph::new(0x0144, 0x2DB5, 17, 15, 23, 1, -1),
+    Glyph::new(0x0147, 0x2DFA, 20, 22, 27, -1, -1),
+    Glyph::new(0x0148, 0x2E5C, 17, 15, 23, 1, -1),
+    Glyph::new(0x0152, 0x2EA6, 26, 24, 20, 1, -1),
+    Glyph::new(0x0153, 0x2EF7, 22, 20, 15, 1, -1),
+    Glyph::new(0x0158, 0x2F3F, 17, 17, 27, -1, -1),
+    Glyph::new(0x0159, 0x2F97, 12, 12, 22, 1, 0),
+    Glyph::new(0x015A, 0x2FCA, 14, 14, 26, 0, -1),
+    Glyph::new(0x015B, 0x3010, 11, 12, 23, 0, -1),
+    Glyph::new(0x0160, 0x3043, 14, 15, 27, 0, -1),
+    Glyph::new(0x0161, 0x308E, 11, 13, 23, 0, -1),
+    Glyph::new(0x0164, 0x30C6, 17, 16, 26, 2, 0),
+    Glyph::new(0x0165, 0x3107, 11, 12, 22, 0, -1),
+    Glyph::new(0x016E, 0x313E, 20, 19, 27, 2, -1),
+    Glyph::new(0x016F, 0x3199, 16, 15, 23, 1, -1),
+    Glyph::new(0x0170, 0x31E5, 20, 19, 27, 2, -1),
+    Glyph::new(0x0171, 0x3241, 16, 15, 23, 1, -1),
+    Glyph::new(0x0178, 0x328E, 17, 18, 24, 1, 0),
+    Glyph::new(0x0179, 0x32D3, 16, 16, 26, -1, -1),
+    Glyph::new(0x017A, 0x3311, 13, 12, 23, 0, -1),
+    Glyph::new(0x017B, 0x3345, 16, 16, 26, -1, -1),
+    Glyph::new(0x017C, 0x337E, 13, 12, 21, 0, -1),
+    Glyph::new(0x017D, 0x33B0, 16, 16, 27, -1, -1),
+    Glyph::new(0x017E, 0x33F4, 13, 13, 23, 0, -1),
+    Glyph::new(0x03C0, 0x3432, 16, 16, 15, 0, -1),
+    Glyph::new(0x1E9E, 0x346A, 19, 19, 20, -2, -1),
+    Glyph::new(0x2013, 0x34B7, 13, 13, 3, 0, 5),
+    Glyph::new(0x2014, 0x34C6, 26, 26, 3, 0, 5),
+    Glyph::new(0x2018, 0x34E2, 8, 6, 9, 2, 11),
+    Glyph::new(0x2019, 0x34F1, 8, 6, 9, 1, 11),
+    Glyph::new(0x201A, 0x3500, 8, 6, 9, 0, -5),
+    Glyph::new(0x201B, 0x350E, 7, 5, 9, 1, 11),
+    Glyph::new(0x201C, 0x351B, 14, 11, 9, 2, 11),
+    Glyph::new(0x201D, 0x3538, 14, 11, 9, 1, 11),
+    Glyph::new(0x201E, 0x3553, 14, 12, 9, 0, -5),
+    Glyph::new(0x201F, 0x356D, 12, 10, 9, 1, 11),
+    Glyph::new(0x2020, 0x3587, 13, 11, 18, 1, 1),
+    Glyph::new(0x2021, 0x35AD, 13, 12, 21, 0, -2),
+    Glyph::new(0x2022, 0x35E9, 8, 6, 6, 1, 4),
+    Glyph::new(0x2026, 0x35F3, 26, 22, 5, 2, -1),
+    Glyph::new(0x2039, 0x3609, 9, 8, 11, 0, 1),
+    Glyph::new(0x203A, 0x361C, 9, 8, 11, 0, 1),
+    Glyph::new(0x2070, 0x3630, 12, 10, 13, 1, 9),
+    Glyph::new(0x2074, 0x3657, 12, 11, 13, 0, 9),
+    Glyph::new(0x2075, 0x367A, 12, 10, 13, 1, 9),
+    Glyph::new(0x2076, 0x3696, 12, 11, 13, 1, 9),
+    Glyph::new(0x2077, 0x36BA, 12, 10, 13, 2, 9),
+    Glyph::new(0x2078, 0x36D6, 12, 10, 13, 1, 9),
+    Glyph::new(0x2079, 0x36FA, 12, 11, 13, 0, 9),
+    Glyph::new(0x2080, 0x371F, 12, 10, 13, 1, -4),
+    Glyph::new(0x2081, 0x3745, 12, 7, 13, 2, -4),
+    Glyph::new(0x2082, 0x375E, 12, 11, 13, 0, -4),
+    Glyph::new(0x2083, 0x377F, 12, 9, 13, 1, -4),
+    Glyph::new(0x2084, 0x379F, 12, 11, 13, 0, -4),
+    Glyph::new(0x2085, 0x37C1, 12, 10, 13, 1, -4),
+    Glyph::new(0x2086, 0x37DC, 12, 11, 13, 1, -4),
+    Glyph::new(0x2087, 0x3800, 12, 10, 13, 2, -4),
+    Glyph::new(0x2088, 0x381D, 12, 10, 13, 1, -4),
+    Glyph::new(0x2089, 0x3841, 12, 11, 13, 0, -4),
+    Glyph::new(0x20AC, 0x3865, 17, 18, 20, -1, -1),
+    Glyph::new(0x2122, 0x38A3, 19, 18, 10, 2, 9),
+    Glyph::new(0x2153, 0x38DF, 28, 24, 21, 2, -2),
+    Glyph::new(0x2154, 0x393F, 28, 26, 21, 0, -2),
+    Glyph::new(0x215B, 0x39A5, 28, 25, 21, 2, -2),
+    Glyph::new(0x215C, 0x3A0D, 28, 26, 21, 1, -2),
+    Glyph::new(0x215D, 0x3A7E, 28, 26, 21, 1, -2),
+    Glyph::new(0x215E, 0x3AED, 28, 25, 21, 2, -2),
+    Glyph::new(0x2190, 0x3B5D, 26, 16, 12, 5, 3),
+    Glyph::new(0x2191, 0x3B75, 26, 12, 18, 7, 0),
+    Glyph::new(0x2192, 0x3B95, 26, 16, 12, 5, 3),
+    Glyph::new(0x2193, 0x3BAD, 26, 12, 18, 7, 0),
+    Glyph::new(0x2194, 0x3BCE, 26, 16, 12, 5, 3),
+    Glyph::new(0x2195, 0x3BF4, 26, 12, 18, 7, 0),
+    Glyph::new(0x21D0, 0x3C26, 26, 16, 12, 5, 3),
+    Glyph::new(0x21D1, 0x3C4C, 26, 12, 16, 7, 1),
+    Glyph::new(0x21D2, 0x3C82, 26, 16, 12, 5, 3),
+    Glyph::new(0x21D3, 0x3CA8, 26, 12, 16, 7, 1),
+    Glyph::new(0x21D4, 0x3CDE, 26, 16, 12, 5, 3),
+    Glyph::new(0x2202, 0x3D0F, 17, 13, 22, 2, -1),
+    Glyph::new(0x2206, 0x3D50, 18, 17, 19, 0, 0),
+    Glyph::new(0x220F, 0x3D8A, 22, 20, 24, 1, -5),
+    Glyph::new(0x2211, 0x3DE4, 16, 16, 24, 0, -5),
+    Glyph::new(0x221A, 0x3E1E, 17, 17, 24, 0, -3),
+    Glyph::new(0x221E, 0x3E5F, 17, 16, 9, 0, 4),
+    Glyph::new(0x222B, 0x3E89, 17, 14, 27, 1, -6),
+    Glyph::new(0x2260, 0x3EC3, 17, 12, 12, 2, 3),
+    Glyph::new(0x2264, 0x3EE1, 17, 12, 16, 2, 0),
+    Glyph::new(0x2265, 0x3F00, 17, 12, 16, 2, 0),
+    Glyph::new(0xFB01, 0x3F21, 20, 25, 27, -5, -7),
+    Glyph::new(0xFB02, 0x3F87, 19, 24, 28, -5, -7),
 ];
 
-const BITMAP_BW: &[u8; 10452] = include_bytes!("./bookerly_italic_26.bw");
-const BITMAP_MSB: &[u8; 10452] = include_bytes!("./bookerly_italic_26.msb");
-const BITMAP_LSB: &[u8; 10452] = include_bytes!("./bookerly_italic_26.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 13), (18, 13), (19, 14),
+    (20, 13), (20, 13), (21, 15), (22, 13), (23, 13), (24, 16), (25, 17), (26, 18),
+    (27, 13), (28, 14), (29, 19), (30, 20), (31, 21), (32, 22), (33, 23), (34, 24),
+    (35, 25), (36, 26), (37, 27), (38, 28), (0, 0), (39, 29), (0, 0), (0, 0),
+    (0, 0), (40, 30), (41, 0), (42, 31), (43, 30), (44, 31), (45, 32), (0, 33),
+    (46, 0), (47, 34), (39, 35), (48, 36), (0, 0), (49, 37), (50, 37), (51, 31),
+    (52, 35), (53, 38), (54, 39), (44, 40), (55, 41), (56, 41), (57, 42), (58, 42),
+    (59, 43), (60, 44), (61, 45), (62, 46), (0, 0), (63, 47), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (64, 48), (65, 49),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (48, 50), (0, 0), (0, 0),
+    (0, 0), (66, 51), (67, 52), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (68, 53), (69, 14), (17, 13),
+    (17, 13), (17, 13), (17, 13), (20, 13), (20, 13), (70, 54), (71, 54), (16, 55),
+    (25, 17), (26, 18), (26, 18), (26, 56), (26, 18), (26, 18), (0, 0), (72, 57),
+    (32, 22), (32, 22), (32, 22), (32, 22), (73, 13), (74, 58), (40, 59), (40, 30),
+    (40, 60), (75, 59), (75, 61), (40, 59), (76, 30), (77, 31), (44, 62), (47, 63),
+    (47, 64), (74, 65), (78, 66), (74, 67), (74, 68), (74, 0), (79, 69), (80, 37),
+    (81, 70), (82, 31), (83, 71), (84, 71), (84, 72), (0, 0), (85, 73), (56, 41),
+    (56, 41), (56, 41), (86, 41), (41, 0), (87, 74), (88, 12), (89, 30), (15, 14),
+    (90, 63), (15, 14), (90, 62), (16, 13), (91, 30), (92, 13), (93, 31), (17, 13),
+    (74, 62), (23, 13), (0, 0), (94, 13), (91, 0), (23, 55), (0, 0), (25, 17),
+    (50, 37), (25, 17), (50, 37), (95, 75), (44, 31), (29, 19), (96, 76), (30, 20),
+    (74, 40), (30, 20), (74, 77), (31, 21), (97, 41), (32, 22), (56, 41), (32, 22),
+    (0, 41), (36, 26), (37, 27), (61, 45), (37, 27), (61, 45), (37, 27), (61, 78),
+    (98, 79), (99, 80), (100, 81), (100, 81), (3, 82), (101, 83), (102, 84), (0, 0),
+    (103, 82), (104, 85), (6, 84), (0, 0), (0, 0), (0, 0), (0, 0), (8, 86),
+    (105, 49), (106, 52), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (47, 32), (0, 32),
+];
+
+const KERNING: [&[i8]; 107] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, -2, 0, 0, -2, -2, -1, -2, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -2, 0, -1, -2, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -2, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -2, 0, 0, 0, -2, -1, -2, 0, 0, -1, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -1, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, 0, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0],
+    &[0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, -2, 0, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, -1, 0, -1, -2, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -2, -1, 0, 0, -1, 0, -1, -1, -1, -1, -2, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -2],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -2],
+    &[0, -1, 0, 0, -1, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, -1, 0, -2, -2, 0, -2, -1, -2, -2, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -2, 0, -2, -2, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -1, -2],
+    &[0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0],
+    &[0, -1, -1, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, -1, -2, -1, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, -2, 0, 0, -1, -1, -1, -2, -1, -1, -1, -2, -1, -1, 0, -1, 0, -2, -2, -2, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -2, -2, -1, -1, -1, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -1, -2, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -2, -2, -2, -2, 0, -1, 0, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -2, -1, -2, -1, -1, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, 0, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, -2, 0, -2, -2, -2],
+];
+
+const BITMAP: &[u8; 16374] = include_bytes!("./bookerly_italic_26.rle");
@@ -1,308 +1,533 @@
 // Auto-generated font file
 // Font: Bookerly Italic
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 11924,
+    size: 18360,
     y_advance: 28,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 9, 8, 22, 1, -1),
-    Glyph::new(0x0022, 0x0016, 11, 10, 10, 1, 11),
-    Glyph::new(0x0023, 0x0023, 18, 17, 18, 0, -2),
-    Glyph::new(0x0024, 0x004A, 18, 17, 29, 0, -6),
-    Glyph::new(0x0025, 0x0088, 28, 25, 23, 1, -2),
-    Glyph::new(0x0026, 0x00D0, 26, 23, 23, 1, -2),
-    Glyph::new(0x0027, 0x0113, 6, 5, 10, 1, 11),
-    Glyph::new(0x0028, 0x011A, 12, 12, 29, 1, -6),
-    Glyph::new(0x0029, 0x0146, 12, 12, 29, -2, -6),
-    Glyph::new(0x002A, 0x0172, 11, 10, 10, 1, 11),
-    Glyph::new(0x002B, 0x017F, 18, 13, 13, 2, 3),
-    Glyph::new(0x002C, 0x0195, 9, 7, 9, -1, -5),
-    Glyph::new(0x002D, 0x019D, 11, 9, 4, 1, 5),
-    Glyph::new(0x002E, 0x01A2, 9, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x01A6, 14, 16, 23, -1, -2),
-    Glyph::new(0x0030, 0x01D4, 18, 17, 21, 0, -1),
-    Glyph::new(0x0031, 0x0201, 18, 11, 20, 2, 0),
-    Glyph::new(0x0032, 0x021D, 18, 16, 20, 0, 0),
-    Glyph::new(0x0033, 0x0245, 18, 16, 21, 0, -1),
-    Glyph::new(0x0034, 0x026F, 18, 17, 20, 0, 0),
-    Glyph::new(0x0035, 0x029A, 18, 15, 21, 1, -1),
-    Glyph::new(0x0036, 0x02C2, 18, 17, 21, 1, -1),
-    Glyph::new(0x0037, 0x02EF, 18, 15, 21, 3, -1),
-    Glyph::new(0x0038, 0x0317, 18, 16, 21, 1, -1),
-    Glyph::new(0x0039, 0x0341, 18, 16, 21, 0, -1),
-    Glyph::new(0x003A, 0x036B, 9, 7, 16, 1, -1),
-    Glyph::new(0x003B, 0x0379, 9, 10, 20, -1, -5),
-    Glyph::new(0x003C, 0x0392, 18, 13, 13, 2, 3),
-    Glyph::new(0x003D, 0x03A8, 18, 13, 7, 2, 6),
-    Glyph::new(0x003E, 0x03B4, 18, 13, 13, 2, 3),
-    Glyph::new(0x003F, 0x03CA, 12, 10, 22, 2, -1),
-    Glyph::new(0x0040, 0x03E6, 28, 26, 26, 1, -6),
-    Glyph::new(0x0041, 0x043B, 21, 21, 20, -2, 0),
-    Glyph::new(0x0042, 0x0470, 18, 17, 21, -1, -1),
-    Glyph::new(0x0043, 0x049D, 19, 17, 21, 1, -1),
-    Glyph::new(0x0044, 0x04CA, 21, 21, 21, -1, -1),
-    Glyph::new(0x0045, 0x0502, 18, 18, 20, -1, 0),
-    Glyph::new(0x0046, 0x052F, 16, 17, 20, -1, 0),
-    Glyph::new(0x0047, 0x055A, 20, 18, 21, 1, -1),
-    Glyph::new(0x0048, 0x058A, 23, 25, 20, -1, 0),
-    Glyph::new(0x0049, 0x05C9, 11, 13, 20, -1, 0),
-    Glyph::new(0x004A, 0x05EA, 10, 17, 26, -5, -6),
-    Glyph::new(0x004B, 0x0622, 20, 22, 21, -1, -1),
-    Glyph::new(0x004C, 0x065C, 17, 16, 20, -1, 0),
-    Glyph::new(0x004D, 0x0684, 26, 27, 20, -2, 0),
-    Glyph::new(0x004E, 0x06C8, 22, 24, 21, -1, -1),
-    Glyph::new(0x004F, 0x0707, 21, 19, 21, 1, -1),
-    Glyph::new(0x0050, 0x0739, 17, 18, 20, -1, 0),
-    Glyph::new(0x0051, 0x0766, 21, 23, 27, 1, -7),
-    Glyph::new(0x0052, 0x07B4, 19, 19, 21, -1, -1),
-    Glyph::new(0x0053, 0x07E6, 15, 15, 21, 0, -1),
-    Glyph::new(0x0054, 0x080E, 18, 17, 20, 2, 0),
-    Glyph::new(0x0055, 0x0839, 22, 21, 21, 2, -1),
-    Glyph::new(0x0056, 0x0871, 20, 20, 21, 2, -1),
-    Glyph::new(0x0057, 0x08A6, 30, 29, 21, 2, -1),
-    Glyph::new(0x0058, 0x08F3, 19, 23, 20, -3, 0),
-    Glyph::new(0x0059, 0x092D, 19, 19, 20, 1, 0),
-    Glyph::new(0x005A, 0x095D, 17, 17, 21, -1, -1),
-    Glyph::new(0x005B, 0x098A, 9, 11, 27, -1, -5),
-    Glyph::new(0x005C, 0x09B0, 14, 12, 23, 1, -2),
-    Glyph::new(0x005D, 0x09D3, 9, 11, 27, -1, -5),
-    Glyph::new(0x005E, 0x09F9, 18, 14, 13, 2, 5),
-    Glyph::new(0x005F, 0x0A10, 14, 14, 3, 0, -4),
-    Glyph::new(0x0060, 0x0A16, 18, 6, 7, 6, 16),
-    Glyph::new(0x0061, 0x0A1C, 17, 15, 16, 1, -1),
-    Glyph::new(0x0062, 0x0A3A, 16, 15, 23, 0, -1),
-    Glyph::new(0x0063, 0x0A66, 13, 11, 16, 1, -1),
-    Glyph::new(0x0064, 0x0A7C, 17, 15, 23, 1, -1),
-    Glyph::new(0x0065, 0x0AA8, 14, 12, 16, 1, -1),
-    Glyph::new(0x0066, 0x0AC0, 12, 20, 29, -5, -7),
-    Glyph::new(0x0067, 0x0B09, 14, 19, 22, -3, -7),
-    Glyph::new(0x0068, 0x0B3E, 17, 16, 23, 0, -1),
-    Glyph::new(0x0069, 0x0B6C, 10, 8, 23, 1, -1),
-    Glyph::new(0x006A, 0x0B83, 9, 14, 29, -5, -7),
-    Glyph::new(0x006B, 0x0BB6, 15, 14, 23, 1, -1),
-    Glyph::new(0x006C, 0x0BDF, 9, 8, 23, 1, -1),
-    Glyph::new(0x006D, 0x0BF6, 25, 23, 16, 1, -1),
-    Glyph::new(0x006E, 0x0C24, 18, 16, 16, 1, -1),
-    Glyph::new(0x006F, 0x0C44, 16, 14, 16, 1, -1),
-    Glyph::new(0x0070, 0x0C60, 17, 17, 22, -2, -7),
-    Glyph::new(0x0071, 0x0C8F, 16, 15, 22, 1, -7),
-    Glyph::new(0x0072, 0x0CB9, 12, 12, 15, 1, 0),
-    Glyph::new(0x0073, 0x0CD0, 12, 11, 16, 0, -1),
-    Glyph::new(0x0074, 0x0CE6, 11, 12, 20, 0, -1),
-    Glyph::new(0x0075, 0x0D04, 18, 16, 16, 1, -1),
-    Glyph::new(0x0076, 0x0D24, 15, 14, 16, 0, -1),
-    Glyph::new(0x0077, 0x0D40, 22, 21, 16, 0, -1),
-    Glyph::new(0x0078, 0x0D6A, 16, 17, 16, -1, -1),
-    Glyph::new(0x0079, 0x0D8C, 15, 18, 22, -3, -7),
-    Glyph::new(0x007A, 0x0DBE, 14, 13, 16, 0, -1),
-    Glyph::new(0x007B, 0x0DD8, 12, 11, 28, 1, -5),
-    Glyph::new(0x007C, 0x0DFF, 9, 8, 26, 0, -4),
-    Glyph::new(0x007D, 0x0E19, 12, 11, 28, -1, -5),
-    Glyph::new(0x007E, 0x0E40, 18, 14, 5, 2, 7),
-    Glyph::new(0x00A1, 0x0E49, 9, 8, 22, -1, -7),
-    Glyph::new(0x00A2, 0x0E5F, 18, 14, 28, 2, -6),
-    Glyph::new(0x00A3, 0x0E90, 18, 18, 21, -1, -1),
-    Glyph::new(0x00A4, 0x0EC0, 18, 18, 13, 0, 3),
-    Glyph::new(0x00A5, 0x0EDE, 18, 19, 20, 1, 0),
-    Glyph::new(0x00A7, 0x0F0E, 14, 13, 23, 0, -3),
-    Glyph::new(0x00A9, 0x0F34, 22, 22, 21, 0, -1),
-    Glyph::new(0x00AA, 0x0F6E, 13, 11, 14, 1, 6),
-    Glyph::new(0x00AB, 0x0F82, 15, 14, 11, 0, 2),
-    Glyph::new(0x00AE, 0x0F96, 17, 16, 15, 0, 7),
-    Glyph::new(0x00B0, 0x0FB4, 15, 10, 10, 2, 10),
-    Glyph::new(0x00B1, 0x0FC1, 18, 13, 17, 2, 0),
-    Glyph::new(0x00B2, 0x0FDD, 13, 11, 14, 1, 10),
-    Glyph::new(0x00B3, 0x0FF1, 13, 10, 14, 1, 10),
-    Glyph::new(0x00B5, 0x1003, 17, 18, 22, -1, -7),
-    Glyph::new(0x00B6, 0x1035, 17, 18, 24, -1, -4),
-    Glyph::new(0x00B7, 0x106B, 9, 5, 5, 2, 5),
-    Glyph::new(0x00B9, 0x106F, 13, 8, 14, 2, 10),
-    Glyph::new(0x00BA, 0x107D, 13, 11, 14, 1, 6),
-    Glyph::new(0x00BB, 0x1091, 15, 14, 11, 0, 2),
-    Glyph::new(0x00BC, 0x10A5, 31, 27, 23, 2, -2),
-    Glyph::new(0x00BD, 0x10F3, 31, 27, 23, 2, -2),
-    Glyph::new(0x00BE, 0x1141, 31, 28, 23, 1, -2),
-    Glyph::new(0x00BF, 0x1192, 12, 10, 21, 0, -6),
-    Glyph::new(0x00C0, 0x11AD, 21, 21, 27, -2, 0),
-    Glyph::new(0x00C1, 0x11F4, 21, 21, 27, -2, 0),
-    Glyph::new(0x00C2, 0x123B, 21, 21, 27, -2, 0),
-    Glyph::new(0x00C3, 0x1282, 21, 21, 27, -2, 0),
-    Glyph::new(0x00C4, 0x12C9, 21, 21, 26, -2, 0),
-    Glyph::new(0x00C5, 0x130E, 21, 21, 28, -2, 0),
-    Glyph::new(0x00C6, 0x1358, 26, 27, 20, -2, 0),
-    Glyph::new(0x00C7, 0x139C, 19, 17, 28, 1, -8),
-    Glyph::new(0x00C8, 0x13D8, 18, 18, 27, -1, 0),
-    Glyph::new(0x00C9, 0x1415, 18, 18, 27, -1, 0),
-    Glyph::new(0x00CA, 0x1452, 18, 18, 27, -1, 0),
-    Glyph::new(0x00CB, 0x148F, 18, 18, 26, -1, 0),
-    Glyph::new(0x00CC, 0x14CA, 11, 13, 27, -1, 0),
-    Glyph::new(0x00CD, 0x14F6, 11, 14, 27, -1, 0),
-    Glyph::new(0x00CE, 0x1526, 11, 14, 27, -1, 0),
-    Glyph::new(0x00CF, 0x1556, 11, 14, 26, -1, 0),
-    Glyph::new(0x00D0, 0x1584, 21, 21, 21, -1, -1),
-    Glyph::new(0x00D1, 0x15BC, 22, 24, 28, -1, -1),
-    Glyph::new(0x00D2, 0x1610, 21, 19, 28, 1, -1),
-    Glyph::new(0x00D3, 0x1653, 21, 19, 28, 1, -1),
-    Glyph::new(0x00D4, 0x1696, 21, 19, 28, 1, -1),
-    Glyph::new(0x00D5, 0x16D9, 21, 19, 28, 1, -1),
-    Glyph::new(0x00D6, 0x171C, 21, 19, 27, 1, -1),
-    Glyph::new(0x00D7, 0x175D, 18, 12, 11, 3, 4),
-    Glyph::new(0x00D8, 0x176E, 21, 22, 21, -1, -1),
-    Glyph::new(0x00D9, 0x17A8, 22, 21, 28, 2, -1),
-    Glyph::new(0x00DA, 0x17F2, 22, 21, 28, 2, -1),
-    Glyph::new(0x00DB, 0x183C, 22, 21, 28, 2, -1),
-    Glyph::new(0x00DC, 0x1886, 22, 21, 27, 2, -1),
-    Glyph::new(0x00DE, 0x18CD, 17, 17, 20, -1, 0),
-    Glyph::new(0x00DF, 0x18F8, 18, 22, 29, -5, -7),
-    Glyph::new(0x00E0, 0x1948, 17, 15, 24, 1, -1),
-    Glyph::new(0x00E1, 0x1975, 17, 15, 24, 1, -1),
-    Glyph::new(0x00E2, 0x19A2, 17, 15, 24, 1, -1),
-    Glyph::new(0x00E3, 0x19CF, 17, 15, 23, 1, -1),
-    Glyph::new(0x00E4, 0x19FB, 17, 15, 22, 1, -1),
-    Glyph::new(0x00E5, 0x1A25, 17, 15, 25, 1, -1),
-    Glyph::new(0x00E6, 0x1A54, 22, 20, 16, 1, -1),
-    Glyph::new(0x00E7, 0x1A7C, 13, 11, 23, 1, -8),
-    Glyph::new(0x00E8, 0x1A9C, 14, 12, 24, 1, -1),
-    Glyph::new(0x00E9, 0x1AC0, 14, 12, 24, 1, -1),
-    Glyph::new(0x00EA, 0x1AE4, 14, 13, 24, 1, -1),
-    Glyph::new(0x00EB, 0x1B0B, 14, 13, 22, 1, -1),
-    Glyph::new(0x00EC, 0x1B2F, 10, 8, 24, 1, -1),
-    Glyph::new(0x00ED, 0x1B47, 10, 10, 24, 1, -1),
-    Glyph::new(0x00EE, 0x1B65, 10, 10, 24, 1, -1),
-    Glyph::new(0x00EF, 0x1B83, 10, 11, 22, 1, -1),
-    Glyph::new(0x00F0, 0x1BA2, 16, 15, 24, 0, -1),
-    Glyph::new(0x00F1, 0x1BCF, 18, 16, 23, 1, -1),
-    Glyph::new(0x00F2, 0x1BFD, 16, 14, 24, 1, -1),
-    Glyph::new(0x00F3, 0x1C27, 16, 14, 24, 1, -1),
-    Glyph::new(0x00F4, 0x1C51, 16, 14, 24, 1, -1),
-    Glyph::new(0x00F5, 0x1C7B, 16, 14, 23, 1, -1),
-    Glyph::new(0x00F6, 0x1CA4, 16, 14, 22, 1, -1),
-    Glyph::new(0x00F7, 0x1CCB, 18, 13, 13, 2, 3),
-    Glyph::new(0x00F8, 0x1CE1, 16, 18, 16, -2, -1),
-    Glyph::new(0x00F9, 0x1D05, 18, 16, 24, 1, -1),
-    Glyph::new(0x00FA, 0x1D35, 18, 16, 24, 1, -1),
-    Glyph::new(0x00FB, 0x1D65, 18, 16, 24, 1, -1),
-    Glyph::new(0x00FC, 0x1D95, 18, 16, 22, 1, -1),
-    Glyph::new(0x00FE, 0x1DC1, 16, 18, 29, -3, -7),
-    Glyph::new(0x00FF, 0x1E03, 15, 18, 28, -3, -7),
-    Glyph::new(0x0104, 0x1E42, 21, 21, 26, -2, -6),
-    Glyph::new(0x0105, 0x1E87, 17, 15, 21, 1, -6),
-    Glyph::new(0x0106, 0x1EAF, 19, 17, 28, 1, -1),
-    Glyph::new(0x0107, 0x1EEB, 13, 12, 24, 1, -1),
-    Glyph::new(0x010C, 0x1F0F, 19, 18, 29, 1, -1),
-    Glyph::new(0x010D, 0x1F51, 13, 14, 24, 1, -1),
-    Glyph::new(0x010E, 0x1F7B, 21, 21, 29, -1, -1),
-    Glyph::new(0x010F, 0x1FC8, 18, 20, 26, 1, -1),
-    Glyph::new(0x0118, 0x2009, 18, 18, 26, -1, -6),
-    Glyph::new(0x0119, 0x2044, 14, 12, 21, 1, -6),
-    Glyph::new(0x011A, 0x2064, 18, 19, 28, -1, 0),
-    Glyph::new(0x011B, 0x20A7, 14, 14, 24, 1, -1),
-    Glyph::new(0x0139, 0x20D1, 17, 16, 27, -1, 0),
-    Glyph::new(0x013A, 0x2107, 9, 10, 30, 1, -1),
-    Glyph::new(0x013D, 0x212D, 17, 17, 22, -1, 0),
-    Glyph::new(0x013E, 0x215C, 10, 13, 26, 1, -1),
-    Glyph::new(0x0141, 0x2187, 17, 16, 20, -1, 0),
-    Glyph::new(0x0142, 0x21AF, 9, 11, 23, -1, -1),
-    Glyph::new(0x0143, 0x21CF, 22, 24, 28, -1, -1),
-    Glyph::new(0x0144, 0x2223, 18, 16, 24, 1, -1),
-    Glyph::new(0x0147, 0x2253, 22, 24, 29, -1, -1),
-    Glyph::new(0x0148, 0x22AA, 18, 16, 24, 1, -1),
-    Glyph::new(0x0152, 0x22DA, 28, 26, 21, 1, -1),
-    Glyph::new(0x0153, 0x231F, 23, 22, 16, 1, -1),
-    Glyph::new(0x0158, 0x234B, 19, 19, 29, -1, -1),
-    Glyph::new(0x0159, 0x2390, 12, 13, 23, 1, 0),
-    Glyph::new(0x015A, 0x23B6, 15, 15, 28, 0, -1),
-    Glyph::new(0x015B, 0x23EB, 12, 12, 24, 0, -1),
-    Glyph::new(0x0160, 0x240F, 15, 16, 29, 0, -1),
-    Glyph::new(0x0161, 0x2449, 12, 14, 24, 0, -1),
-    Glyph::new(0x0164, 0x2473, 18, 17, 28, 2, 0),
-    Glyph::new(0x0165, 0x24AF, 11, 13, 24, 0, -1),
-    Glyph::new(0x016E, 0x24D6, 22, 21, 29, 2, -1),
-    Glyph::new(0x016F, 0x2523, 18, 16, 25, 1, -1),
-    Glyph::new(0x0170, 0x2555, 22, 21, 29, 2, -1),
-    Glyph::new(0x0171, 0x25A2, 18, 16, 24, 1, -1),
-    Glyph::new(0x0178, 0x25D2, 19, 19, 26, 1, 0),
-    Glyph::new(0x0179, 0x2610, 17, 17, 28, -1, -1),
-    Glyph::new(0x017A, 0x264C, 14, 13, 24, 0, -1),
-    Glyph::new(0x017B, 0x2673, 17, 17, 28, -1, -1),
-    Glyph::new(0x017C, 0x26AF, 14, 13, 23, 0, -1),
-    Glyph::new(0x017D, 0x26D5, 17, 17, 29, -1, -1),
-    Glyph::new(0x017E, 0x2713, 14, 14, 24, 0, -1),
-    Glyph::new(0x03C0, 0x273D, 17, 17, 16, 0, -1),
-    Glyph::new(0x1E9E, 0x275F, 20, 20, 21, -2, -1),
-    Glyph::new(0x2013, 0x2794, 14, 14, 3, 0, 6),
-    Glyph::new(0x2014, 0x279A, 28, 28, 3, 0, 6),
-    Glyph::new(0x2018, 0x27A5, 9, 6, 9, 2, 12),
-    Glyph::new(0x2019, 0x27AC, 9, 7, 10, 1, 12),
-    Glyph::new(0x201A, 0x27B5, 9, 6, 9, 1, -5),
-    Glyph::new(0x201B, 0x27BC, 7, 5, 9, 1, 12),
-    Glyph::new(0x201C, 0x27C2, 15, 12, 9, 2, 12),
-    Glyph::new(0x201D, 0x27D0, 15, 12, 9, 1, 12),
-    Glyph::new(0x201E, 0x27DE, 15, 11, 9, 1, -5),
-    Glyph::new(0x201F, 0x27EB, 13, 11, 9, 1, 12),
-    Glyph::new(0x2020, 0x27F8, 14, 12, 19, 1, 1),
-    Glyph::new(0x2021, 0x2815, 14, 13, 22, 0, -2),
-    Glyph::new(0x2022, 0x2839, 9, 6, 6, 1, 4),
-    Glyph::new(0x2026, 0x283E, 28, 24, 5, 2, -1),
-    Glyph::new(0x2039, 0x284D, 9, 9, 11, 0, 2),
-    Glyph::new(0x203A, 0x285A, 9, 8, 11, 0, 2),
-    Glyph::new(0x2070, 0x2865, 13, 11, 14, 1, 10),
-    Glyph::new(0x2074, 0x2879, 13, 12, 14, 0, 10),
-    Glyph::new(0x2075, 0x288E, 13, 11, 13, 1, 10),
-    Glyph::new(0x2076, 0x28A0, 13, 12, 14, 1, 10),
-    Glyph::new(0x2077, 0x28B5, 13, 10, 13, 3, 10),
-    Glyph::new(0x2078, 0x28C6, 13, 11, 14, 1, 10),
-    Glyph::new(0x2079, 0x28DA, 13, 12, 14, 0, 10),
-    Glyph::new(0x2080, 0x28EF, 13, 11, 14, 1, -5),
-    Glyph::new(0x2081, 0x2903, 13, 8, 14, 2, -4),
-    Glyph::new(0x2082, 0x2911, 13, 11, 13, 1, -4),
-    Glyph::new(0x2083, 0x2923, 13, 10, 14, 1, -5),
-    Glyph::new(0x2084, 0x2935, 13, 12, 13, 0, -4),
-    Glyph::new(0x2085, 0x2949, 13, 11, 13, 1, -4),
-    Glyph::new(0x2086, 0x295B, 13, 12, 13, 1, -4),
-    Glyph::new(0x2087, 0x296F, 13, 10, 13, 3, -4),
-    Glyph::new(0x2088, 0x2980, 13, 11, 13, 1, -4),
-    Glyph::new(0x2089, 0x2992, 13, 12, 13, 0, -4),
-    Glyph::new(0x20AC, 0x29A6, 18, 19, 21, -1, -1),
-    Glyph::new(0x2122, 0x29D8, 21, 20, 10, 2, 10),
-    Glyph::new(0x2153, 0x29F1, 31, 26, 23, 2, -2),
-    Glyph::new(0x2154, 0x2A3C, 31, 27, 23, 1, -2),
-    Glyph::new(0x215B, 0x2A8A, 31, 27, 23, 2, -2),
-    Glyph::new(0x215C, 0x2AD8, 31, 28, 23, 1, -2),
-    Glyph::new(0x215D, 0x2B29, 31, 28, 23, 1, -2),
-    Glyph::new(0x215E, 0x2B7A, 31, 26, 23, 3, -2),
-    Glyph::new(0x2190, 0x2BC5, 28, 16, 12, 6, 4),
-    Glyph::new(0x2191, 0x2BDD, 28, 12, 19, 8, 0),
-    Glyph::new(0x2192, 0x2BFA, 28, 16, 12, 6, 4),
-    Glyph::new(0x2193, 0x2C12, 28, 12, 19, 8, 0),
-    Glyph::new(0x2194, 0x2C2F, 28, 18, 12, 5, 4),
-    Glyph::new(0x2195, 0x2C4A, 28, 12, 19, 8, 0),
-    Glyph::new(0x21D0, 0x2C67, 28, 16, 13, 6, 3),
-    Glyph::new(0x21D1, 0x2C81, 28, 12, 17, 8, 1),
-    Glyph::new(0x21D2, 0x2C9B, 28, 16, 13, 6, 3),
-    Glyph::new(0x21D3, 0x2CB5, 28, 12, 17, 8, 1),
-    Glyph::new(0x21D4, 0x2CCF, 28, 18, 13, 5, 3),
-    Glyph::new(0x2202, 0x2CED, 18, 14, 23, 2, -1),
-    Glyph::new(0x2206, 0x2D16, 19, 18, 20, 0, 0),
-    Glyph::new(0x220F, 0x2D43, 23, 21, 25, 1, -5),
-    Glyph::new(0x2211, 0x2D85, 18, 17, 25, 0, -5),
-    Glyph::new(0x221A, 0x2DBB, 18, 18, 27, 0, -4),
-    Glyph::new(0x221E, 0x2DF8, 18, 18, 10, 0, 4),
-    Glyph::new(0x222B, 0x2E0F, 18, 15, 29, 1, -7),
-    Glyph::new(0x2260, 0x2E46, 18, 13, 13, 2, 3),
-    Glyph::new(0x2264, 0x2E5C, 18, 13, 17, 2, 0),
-    Glyph::new(0x2265, 0x2E78, 18, 13, 17, 2, 0),
+    Glyph::new(0x0022, 0x0027, 11, 10, 10, 1, 11),
+    Glyph::new(0x0023, 0x0041, 18, 17, 18, 0, -2),
+    Glyph::new(0x0024, 0x0086, 18, 17, 29, 0, -6),
+    Glyph::new(0x0025, 0x00E0, 28, 25, 23, 1, -2),
+    Glyph::new(0x0026, 0x0159, 26, 23, 23, 1, -2),
+    Glyph::new(0x0027, 0x01BC, 6, 5, 10, 1, 11),
+    Glyph::new(0x0028, 0x01CB, 12, 12, 29, 1, -6),
+    Glyph::new(0x0029, 0x0204, 12, 12, 29, -2, -6),
+    Glyph::new(0x002A, 0x0240, 11, 10, 10, 1, 11),
+    Glyph::new(0x002B, 0x0259, 18, 13, 13, 2, 3),
+    Glyph::new(0x002C, 0x027C, 9, 7, 9, -1, -5),
+    Glyph::new(0x002D, 0x028C, 11, 9, 4, 1, 5),
+    Glyph::new(0x002E, 0x0295, 9, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x029D, 14, 16, 23, -1, -2),
+    Glyph::new(0x0030, 0x02C9, 18, 17, 21, 0, -1),
+    Glyph::new(0x0031, 0x030A, 18, 11, 20, 2, 0),
+    Glyph::new(0x0032, 0x0332, 18, 16, 20, 0, 0),
+    Glyph::new(0x0033, 0x036C, 18, 16, 21, 0, -1),
+    Glyph::new(0x0034, 0x03A2, 18, 17, 20, 0, 0),
+    Glyph::new(0x0035, 0x03DF, 18, 15, 21, 1, -1),
+    Glyph::new(0x0036, 0x040F, 18, 17, 21, 1, -1),
+    Glyph::new(0x0037, 0x044F, 18, 15, 21, 3, -1),
+    Glyph::new(0x0038, 0x0482, 18, 16, 21, 1, -1),
+    Glyph::new(0x0039, 0x04C4, 18, 16, 21, 0, -1),
+    Glyph::new(0x003A, 0x0506, 9, 7, 16, 1, -1),
+    Glyph::new(0x003B, 0x0518, 9, 10, 20, -1, -5),
+    Glyph::new(0x003C, 0x0534, 18, 13, 13, 2, 3),
+    Glyph::new(0x003D, 0x0553, 18, 13, 7, 2, 6),
+    Glyph::new(0x003E, 0x055D, 18, 13, 13, 2, 3),
+    Glyph::new(0x003F, 0x057E, 12, 10, 22, 2, -1),
+    Glyph::new(0x0040, 0x05A6, 28, 26, 26, 1, -6),
+    Glyph::new(0x0041, 0x0628, 21, 21, 20, -2, 0),
+    Glyph::new(0x0042, 0x0671, 18, 17, 21, -1, -1),
+    Glyph::new(0x0043, 0x06BC, 19, 17, 21, 1, -1),
+    Glyph::new(0x0044, 0x06F9, 21, 21, 21, -1, -1),
+    Glyph::new(0x0045, 0x0746, 18, 18, 20, -1, 0),
+    Glyph::new(0x0046, 0x0788, 16, 17, 20, -1, 0),
+    Glyph::new(0x0047, 0x07C6, 20, 18, 21, 1, -1),
+    Glyph::new(0x0048, 0x080E, 23, 25, 20, -1, 0),
+    Glyph::new(0x0049, 0x0866, 11, 13, 20, -1, 0),
+    Glyph::new(0x004A, 0x0895, 10, 17, 26, -5, -6),
+    Glyph::new(0x004B, 0x08D3, 20, 22, 21, -1, -1),
+    Glyph::new(0x004C, 0x0928, 17, 16, 20, -1, 0),
+    Glyph::new(0x004D, 0x095D, 26, 27, 20, -2, 0),
+    Glyph::new(0x004E, 0x09D3, 22, 24, 21, -1, -1),
+    Glyph::new(0x004F, 0x0A37, 21, 19, 21, 1, -1),
+    Glyph::new(0x0050, 0x0A80, 17, 18, 20, -1, 0),
+    Glyph::new(0x0051, 0x0AC4, 21, 23, 27, 1, -7),
+    Glyph::new(0x0052, 0x0B24, 19, 19, 21, -1, -1),
+    Glyph::new(0x0053, 0x0B72, 15, 15, 21, 0, -1),
+    Glyph::new(0x0054, 0x0BB3, 18, 17, 20, 2, 0),
+    Glyph::new(0x0055, 0x0BF3, 22, 21, 21, 2, -1),
+    Glyph::new(0x0056, 0x0C46, 20, 20, 21, 2, -1),
+    Glyph::new(0x0057, 0x0C91, 30, 29, 21, 2, -1),
+    Glyph::new(0x0058, 0x0D0D, 19, 23, 20, -3, 0),
+    Glyph::new(0x0059, 0x0D5C, 19, 19, 20, 1, 0),
+    Glyph::new(0x005A, 0x0D9D, 17, 17, 21, -1, -1),
+    Glyph::new(0x005B, 0x0DDB, 9, 11, 27, -1, -5),
+    Glyph::new(0x005C, 0x0E0C, 14, 12, 23, 1, -2),
+    Glyph::new(0x005D, 0x0E3B, 9, 11, 27, -1, -5),
+    Glyph::new(0x005E, 0x0E6B, 18, 14, 13, 2, 5),
+    Glyph::new(0x005F, 0x0E98, 14, 14, 3, 0, -4),
+    Glyph::new(0x0060, 0x0EA7, 18, 6, 7, 6, 16),
+    Glyph::new(0x0061, 0x0EB3, 17, 15, 16, 1, -1),
+    Glyph::new(0x0062, 0x0EF0, 16, 15, 23, 0, -1),
+    Glyph::new(0x0063, 0x0F39, 13, 11, 16, 1, -1),
+    Glyph::new(0x0064, 0x0F5E, 17, 15, 23, 1, -1),
+    Glyph::new(0x0065, 0x0FAA, 14, 12, 16, 1, -1),
+    Glyph::new(0x0066, 0x0FDB, 12, 20, 29, -5, -7),
+    Glyph::new(0x0067, 0x102B, 14, 19, 22, -3, -7),
+    Glyph::new(0x0068, 0x107D, 17, 16, 23, 0, -1),
+    Glyph::new(0x0069, 0x10CC, 10, 8, 23, 1, -1),
+    Glyph::new(0x006A, 0x10FA, 9, 14, 29, -5, -7),
+    Glyph::new(0x006B, 0x1136, 15, 14, 23, 1, -1),
+    Glyph::new(0x006C, 0x117F, 9, 8, 23, 1, -1),
+    Glyph::new(0x006D, 0x11B0, 25, 23, 16, 1, -1),
+    Glyph::new(0x006E, 0x120E, 18, 16, 16, 1, -1),
+    Glyph::new(0x006F, 0x124F, 16, 14, 16, 1, -1),
+    Glyph::new(0x0070, 0x1282, 17, 17, 22, -2, -7),
+    Glyph::new(0x0071, 0x12CF, 16, 15, 22, 1, -7),
+    Glyph::new(0x0072, 0x1316, 12, 12, 15, 1, 0),
+    Glyph::new(0x0073, 0x133B, 12, 11, 16, 0, -1),
+    Glyph::new(0x0074, 0x1362, 11, 12, 20, 0, -1),
+    Glyph::new(0x0075, 0x1391, 18, 16, 16, 1, -1),
+    Glyph::new(0x0076, 0x13D1, 15, 14, 16, 0, -1),
+    Glyph::new(0x0077, 0x1408, 22, 21, 16, 0, -1),
+    Glyph::new(0x0078, 0x1457, 16, 17, 16, -1, -1),
+    Glyph::new(0x0079, 0x148D, 15, 18, 22, -3, -7),
+    Glyph::new(0x007A, 0x14D4, 14, 13, 16, 0, -1),
+    Glyph::new(0x007B, 0x1507, 12, 11, 28, 1, -5),
+    Glyph::new(0x007C, 0x153B, 9, 8, 26, 0, -4),
+    Glyph::new(0x007D, 0x1570, 12, 11, 28, -1, -5),
+    Glyph::new(0x007E, 0x15A6, 18, 14, 5, 2, 7),
+    Glyph::new(0x00A1, 0x15BA, 9, 8, 22, -1, -7),
+    Glyph::new(0x00A2, 0x15E4, 18, 14, 28, 2, -6),
+    Glyph::new(0x00A3, 0x1631, 18, 18, 21, -1, -1),
+    Glyph::new(0x00A4, 0x1672, 18, 18, 13, 0, 3),
+    Glyph::new(0x00A5, 0x16AA, 18, 19, 20, 1, 0),
+    Glyph::new(0x00A7, 0x16ED, 14, 13, 23, 0, -3),
+    Glyph::new(0x00A9, 0x1735, 22, 22, 21, 0, -1),
+    Glyph::new(0x00AA, 0x179C, 13, 11, 14, 1, 6),
+    Glyph::new(0x00AB, 0x17C5, 15, 14, 11, 0, 2),
+    Glyph::new(0x00AE, 0x17EA, 17, 16, 15, 0, 7),
+    Glyph::new(0x00B0, 0x1838, 15, 10, 10, 2, 10),
+    Glyph::new(0x00B1, 0x1856, 18, 13, 17, 2, 0),
+    Glyph::new(0x00B2, 0x187D, 13, 11, 14, 1, 10),
+    Glyph::new(0x00B3, 0x18A0, 13, 10, 14, 1, 10),
+    Glyph::new(0x00B5, 0x18C1, 17, 18, 22, -1, -7),
+    Glyph::new(0x00B6, 0x190C, 17, 18, 24, -1, -4),
+    Glyph::new(0x00B7, 0x1961, 9, 5, 5, 2, 5),
+    Glyph::new(0x00B9, 0x1969, 13, 8, 14, 2, 10),
+    Glyph::new(0x00BA, 0x1986, 13, 11, 14, 1, 6),
+    Glyph::new(0x00BB, 0x19A9, 15, 14, 11, 0, 2),
+    Glyph::new(0x00BC, 0x19CF, 31, 27, 23, 2, -2),
+    Glyph::new(0x00BD, 0x1A3C, 31, 27, 23, 2, -2),
+    Glyph::new(0x00BE, 0x1AA0, 31, 28, 23, 1, -2),
+    Glyph::new(0x00BF, 0x1B13, 12, 10, 21, 0, -6),
+    Glyph::new(0x00C0, 0x1B40, 21, 21, 27, -2, 0),
+    Glyph::new(0x00C1, 0x1B97, 21, 21, 27, -2, 0),
+    Glyph::new(0x00C2, 0x1BF0, 21, 21, 27, -2, 0),
+    Glyph::new(0x00C3, 0x1C4B, 21, 21, 27, -2, 0),
+    Glyph::new(0x00C4, 0x1CA5, 21, 21, 26, -2, 0),
+    Glyph::new(0x00C5, 0x1CFD, 21, 21, 28, -2, 0),
+    Glyph::new(0x00C6, 0x1D5D, 26, 27, 20, -2, 0),
+    Glyph::new(0x00C7, 0x1DBD, 19, 17, 28, 1, -8),
+    Glyph::new(0x00C8, 0x1E09, 18, 18, 27, -1, 0),
+    Glyph::new(0x00C9, 0x1E58, 18, 18, 27, -1, 0),
+    Glyph::new(0x00CA, 0x1EA8, 18, 18, 27, -1, 0),
+    Glyph::new(0x00CB, 0x1EFC, 18, 18, 26, -1, 0),
+    Glyph::new(0x00CC, 0x1F4E, 11, 13, 27, -1, 0),
+    Glyph::new(0x00CD, 0x1F88, 11, 14, 27, -1, 0),
+    Glyph::new(0x00CE, 0x1FC3, 11, 14, 27, -1, 0),
+    Glyph::new(0x00CF, 0x2004, 11, 14, 26, -1, 0),
+    Glyph::new(0x00D0, 0x2044, 21, 21, 21, -1, -1),
+    Glyph::new(0x00D1, 0x2094, 22, 24, 28, -1, -1),
+    Glyph::new(0x00D2, 0x210C, 21, 19, 28, 1, -1),
+    Glyph::new(0x00D3, 0x2164, 21, 19, 28, 1, -1),
+    Glyph::new(0x00D4, 0x21BB, 21, 19, 28, 1, -1),
+    Glyph::new(0x00D5, 0x2217, 21, 19, 28, 1, -1),
+    Glyph::new(0x00D6, 0x2273, 21, 19, 27, 1, -1),
+    Glyph::new(0x00D7, 0x22CD, 18, 12, 11, 3, 4),
+    Glyph::new(0x00D8, 0x22EC, 21, 22, 21, -1, -1),
+    Glyph::new(0x00D9, 0x234A, 22, 21, 28, 2, -1),
+    Glyph::new(0x00DA, 0x23AC, 22, 21, 28, 2, -1),
+    Glyph::new(0x00DB, 0x240E, 22, 21, 28, 2, -1),
+    Glyph::new(0x00DC, 0x2474, 22, 21, 27, 2, -1),
+    Glyph::new(0x00DE, 0x24D7, 17, 17, 20, -1, 0),
+    Glyph::new(0x00DF, 0x251A, 18, 22, 29, -5, -7),
+    Glyph::new(0x00E0, 0x2584, 17, 15, 24, 1, -1),
+    Glyph::new(0x00E1, 0x25CE, 17, 15, 24, 1, -1),
+    Glyph::new(0x00E2, 0x2619, 17, 15, 24, 1, -1),
+    Glyph::new(0x00E3, 0x266B, 17, 15, 23, 1, -1),
+    Glyph::new(0x00E4, 0x26B9, 17, 15, 22, 1, -1),
+    Glyph::new(0x00E5, 0x2704, 17, 15, 25, 1, -1),
+    Glyph::new(0x00E6, 0x2756, 22, 20, 16, 1, -1),
+    Glyph::new(0x00E7, 0x27A8, 13, 11, 23, 1, -8),
+    Glyph::new(0x00E8, 0x27DA, 14, 12, 24, 1, -1),
+    Glyph::new(0x00E9, 0x2818, 14, 12, 24, 1, -1),
+    Glyph::new(0x00EA, 0x2856, 14, 13, 24, 1, -1),
+    Glyph::new(0x00EB, 0x289A, 14, 13, 22, 1, -1),
+    Glyph::new(0x00EC, 0x28D9, 10, 8, 24, 1, -1),
+    Glyph::new(0x00ED, 0x2909, 10, 10, 24, 1, -1),
+    Glyph::new(0x00EE, 0x2939, 10, 10, 24, 1, -1),
+    Glyph::new(0x00EF, 0x2971, 10, 11, 22, 1, -1),
+    Glyph::new(0x00F0, 0x29A0, 16, 15, 24, 0, -1),
+    Glyph::new(0x00F1, 0x29EB, 18, 16, 23, 1, -1),
+    Glyph::new(0x00F2, 0x2A3E, 16, 14, 24, 1, -1),
+    Glyph::new(0x00F3, 0x2A7E, 16, 14, 24, 1, -1),
+    Glyph::new(0x00F4, 0x2ABF, 16, 14, 24, 1, -1),
+    Glyph::new(0x00F5, 0x2B06, 16, 14, 23, 1, -1),
+    Glyph::new(0x00F6, 0x2B4A, 16, 14, 22, 1, -1),
+    Glyph::new(0x00F7, 0x2B8C, 18, 13, 13, 2, 3),
+    Glyph::new(0x00F8, 0x2BAF, 16, 18, 16, -2, -1),
+    Glyph::new(0x00F9, 0x2BEF, 18, 16, 24, 1, -1),
+    Glyph::new(0x00FA, 0x2C3F, 18, 16, 24, 1, -1),
+    Glyph::new(0x00FB, 0x2C8C, 18, 16, 24, 1, -1),
+    Glyph::new(0x00FC, 0x2CE2, 18, 16, 22, 1, -1),
+    Glyph::new(0x00FE, 0x2D31, 16, 18, 29, -3, -7),
+    Glyph::new(0x00FF, 0x2D8F, 15, 18, 28, -3, -7),
+    Glyph::new(0x0104, 0x2DE5, 21, 21, 26, -2, -6),
+    Glyph::new(0x0105, 0x2E3F, 17, 15, 21, 1, -6),
+    Glyph::new(0x0106, 0x2E86, 19, 17, 28, 1, -1),
+    Glyph::new(0x0107, 0x2ED1, 13, 12, 24, 1, -1),
+    Glyph::new(0x010C, 0x2F06, 19, 18, 29, 1, -1),
+    Glyph::new(0x010D, 0x2F5A, 13, 14, 24, 1, -1),
+    Glyph::new(0x010E, 0x2F99, 21, 21, 29, -1, -1),
+    Glyph::new(0x010F, 0x2FFB, 18, 20, 26, 1, -1),
+    Glyph::new(0x0118, 0x305A, 18, 18, 26, -1, -6),
+    Glyph::new(0x0119, 0x30AA, 14, 12, 21, 1, -6),
+    Glyph::new(0x011A, 0x30E6, 18, 19, 28, -1, 0),
+    Glyph::new(0x011B, 0x313E, 14, 14, 24, 1, -1),
+    Glyph::new(0x0139, 0x3185, 17, 16, 27, -1, 0),
+    Glyph::new(0x013A, 0x31C6, 9, 10, 30, 1, -1),
+    Glyph::new(0x013D, 0x3204, 17, 17, 22, -1, 0),
+    Glyph::new(0x013E, 0x3246, 10, 13, 26, 1, -1),
+    Glyph::new(0x0141, 0x3285, 17, 16, 20, -1, 0),
+    Glyph::new(0x0142, 0x32C1, 9, 11, 23, -1, -1),
+    Glyph::new(0x0143, 0x32F6, 22, 24, 28, -1, -1),
+    Glyph::new(0x0144, 0x336A, 18, 16, 24, 1, -1),
+    Glyph::new(0x0147, 0x33B8, 22, 24, 29, -1, -1),
+    Glyph::new(0x0148, 0x3433, 18, 16, 24, 1, -1),
+    Glyph::new(0x0152, 0x3488, 28, 26, 21, 1, -1),
+    Glyph::new(0x0153, 0x34F1, 23, 22, 16, 1, -1),
+    Glyph::new(0x0158, 0x3543, 19, 19, 29, -1, -1),
+    Glyph::new(0x0159, 0x35A5, 12, 13, 23, 1, 0),
+    Glyph::new(0x015A, 0x35E0, 15, 15, 28, 0, -1),
+    Glyph::new(0x015B, 0x362E, 12, 12, 24, 0, -1),
+    Glyph::new(0x0160, 0x3661, 15, 16, 29, 0, -1),
+    Glyph::new(0x0161, 0x36B6, 12, 14, 24, 0, -1),
+    Glyph::new(0x0164, 0x36F4, 18, 17, 28, 2, 0),
+    Glyph::new(0x0165, 0x3748, 11, 13, 24, 0, -1),
+    Glyph::new(0x016E, 0x3783, 22, 21, 29, 2, -1),
+    Glyph::new(0x016F, 0x37EE, 18, 16, 25, 1, -1),
+    Glyph::new(0x0170, 0x3845, 22, 21, 29, 2, -1),
+    Glyph::new(0x0171, 0x38B1, 18, 16, 24, 1, -1),
+    Glyph::new(0x0178, 0x3908, 19, 19, 26, 1, 0),
+    Glyph::new(0x0179, 0x395B, 17, 17, 28, -1, -1),
+    Glyph::new(0x017A, 0x39A6, 14, 13, 24, 0, -1),
+    Glyph::new(0x017B, 0x39E7, 17, 17, 28, -1, -1),
+    Glyph::new(0x017C, 0x3A30, 14, 13, 23, 0, -1),
+    Glyph::new(0x017D, 0x3A6D, 17, 17, 29, -1, -1),
+    Glyph::new(0x017E, 0x3ABF, 14, 14, 24, 0, -1),
+    Glyph::new(0x03C0, 0x3B07, 17, 17, 16, 0, -1),
+    Glyph::new(0x1E9E, 0x3B48, 20, 20, 21, -2, -1),
+    Glyph::new(0x2013, 0x3B9E, 14, 14, 3, 0, 6),
+    Glyph::new(0x2014, 0x3BA7, 28, 28, 3, 0, 6),
+    Glyph::new(0x2018, 0x3BB9, 9, 6, 9, 2, 12),
+    Glyph::new(0x2019, 0x3BC9, 9, 7, 10, 1, 12),
+    Glyph::new(0x201A, 0x3BD6, 9, 6, 9, 1, -5),
+    Glyph::new(0x201B, 0x3BE5, 7, 5, 9, 1, 12),
+    Glyph::new(0x201C, 0x3BF5, 15, 12, 9, 2, 12),
+    Glyph::new(0x201D, 0x3C13, 15, 12, 9, 1, 12),
+    Glyph::new(0x201E, 0x3C30, 15, 11, 9, 1, -5),
+    Glyph::new(0x201F, 0x3C4E, 13, 11, 9, 1, 12),
+    Glyph::new(0x2020, 0x3C6C, 14, 12, 19, 1, 1),
+    Glyph::new(0x2021, 0x3C9A, 14, 13, 22, 0, -2),
+    Glyph::new(0x2022, 0x3CD4, 9, 6, 6, 1, 4),
+    Glyph::new(0x2026, 0x3CDF, 28, 24, 5, 2, -1),
+    Glyph::new(0x2039, 0x3CF8, 9, 9, 11, 0, 2),
+    Glyph::new(0x203A, 0x3D0C, 9, 8, 11, 0, 2),
+    Glyph::new(0x2070, 0x3D22, 13, 11, 14, 1, 10),
+    Glyph::new(0x2074, 0x3D4A, 13, 12, 14, 0, 10),
+    Glyph::new(0x2075, 0x3D71, 13, 11, 13, 1, 10),
+    Glyph::new(0x2076, 0x3D90, 13, 12, 14, 1, 10),
+    Glyph::new(0x2077, 0x3DB5, 13, 10, 13, 3, 10),
+    Glyph::new(0x2078, 0x3DD5, 13, 11, 14, 1, 10),
+    Glyph::new(0x2079, 0x3DFC, 13, 12, 14, 0, 10),
+    Glyph::new(0x2080, 0x3E23, 13, 11, 14, 1, -5),
+    Glyph::new(0x2081, 0x3E4C, 13, 8, 14, 2, -4),
+    Glyph::new(0x2082, 0x3E69, 13, 11, 13, 1, -4),
+    Glyph::new(0x2083, 0x3E8B, 13, 10, 14, 1, -5),
+    Glyph::new(0x2084, 0x3EAC, 13, 12, 13, 0, -4),
+    Glyph::new(0x2085, 0x3ED5, 13, 11, 13, 1, -4),
+    Glyph::new(0x2086, 0x3EF4, 13, 12, 13, 1, -4),
+    Glyph::new(0x2087, 0x3F16, 13, 10, 13, 3, -4),
+    Glyph::new(0x2088, 0x3F38, 13, 11, 13, 1, -4),
+    Glyph::new(0x2089, 0x3F60, 13, 12, 13, 0, -4),
+    Glyph::new(0x20AC, 0x3F84, 18, 19, 21, -1, -1),
+    Glyph::new(0x2122, 0x3FC2, 21, 20, 10, 2, 10),
+    Glyph::new(0x2153, 0x4009, 31, 26, 23, 2, -2),
+    Glyph::new(0x2154, 0x4071, 31, 27, 23, 1, -2),
+    Glyph::new(0x215B, 0x40E0, 31, 27, 23, 2, -2),
+    Glyph::new(0x215C, 0x414F, 31, 28, 23, 1, -2),
+    Glyph::new(0x215D, 0x41C6, 31, 28, 23, 1, -2),
+    Glyph::new(0x215E, 0x4236, 31, 26, 23, 3, -2),
+    Glyph::new(0x2190, 0x42A9, 28, 16, 12, 6, 4),
+    Glyph::new(0x2191, 0x42CA, 28, 12, 19, 8, 0),
+    Glyph::new(0x2192, 0x42F2, 28, 16, 12, 6, 4),
+    Glyph::new(0x2193, 0x4313, 28, 12, 19, 8, 0),
+    Glyph::new(0x2194, 0x4338, 28, 18, 12, 5, 4),
+    Glyph::new(0x2195, 0x4363, 28, 12, 19, 8, 0),
+    Glyph::new(0x21D0, 0x4393, 28, 16, 13, 6, 3),
+    Glyph::new(0x21D1, 0x43C1, 28, 12, 17, 8, 1),
+    Glyph::new(0x21D2, 0x43F0, 28, 16, 13, 6, 3),
+    Glyph::new(0x21D3, 0x441E, 28, 12, 17, 8, 1),
+    Glyph::new(0x21D4, 0x4447, 28, 18, 13, 5, 3),
+    Glyph::new(0x2202, 0x447C, 18, 14, 23, 2, -1),
+    Glyph::new(0x2206, 0x44C3, 19, 18, 20, 0, 0),
+    Glyph::new(0x220F, 0x4500, 23, 21, 25, 1, -5),
+    Glyph::new(0x2211, 0x4572, 18, 17, 25, 0, -5),
+    Glyph::new(0x221A, 0x45C5, 18, 18, 27, 0, -4),
+    Glyph::new(0x221E, 0x460D, 18, 18, 10, 0, 4),
+    Glyph::new(0x222B, 0x463E, 18, 15, 29, 1, -7),
+    Glyph::new(0x2260, 0x4678, 18, 13, 13, 2, 3),
+    Glyph::new(0x2264, 0x4691, 18, 13, 17, 2, 0),
+    Glyph::new(0x2265, 0x46B5, 18, 13, 17, 2, 0),
+    Glyph::new(0xFB01, 0x46D8, 22, 26, 29, -5, -7),
+    Glyph::new(0xFB02, 0x4746, 21, 26, 29, -5, -7),
 ];
 
-const BITMAP_BW: &[u8; 11924] = include_bytes!("./bookerly_italic_28.bw");
-const BITMAP_MSB: &[u8; 11924] = include_bytes!("./bookerly_italic_28.msb");
-const BITMAP_LSB: &[u8; 11924] = include_bytes!("./bookerly_italic_28.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 15), (18, 15), (19, 16),
+    (20, 15), (20, 15), (21, 17), (22, 15), (23, 15), (24, 18), (25, 15), (26, 19),
+    (27, 13), (28, 16), (29, 13), (30, 20), (31, 21), (32, 22), (33, 23), (34, 24),
+    (35, 25), (36, 26), (37, 27), (38, 28), (0, 0), (39, 29), (0, 0), (0, 0),
+    (0, 0), (40, 30), (41, 31), (42, 32), (43, 30), (44, 32), (45, 33), (46, 34),
+    (47, 35), (48, 36), (49, 37), (50, 38), (51, 31), (52, 39), (53, 39), (54, 32),
+    (55, 40), (56, 41), (57, 42), (58, 43), (59, 44), (53, 45), (60, 46), (61, 46),
+    (62, 47), (63, 48), (64, 49), (65, 50), (0, 0), (66, 51), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (67, 52), (68, 53),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (69, 54), (0, 0), (0, 0),
+    (0, 0), (70, 55), (71, 56), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (17, 57), (72, 14), (17, 15),
+    (17, 15), (17, 15), (17, 15), (20, 15), (20, 15), (73, 58), (74, 58), (16, 59),
+    (25, 15), (26, 19), (26, 19), (26, 19), (26, 19), (26, 19), (0, 0), (75, 60),
+    (32, 22), (32, 22), (32, 22), (32, 22), (76, 15), (77, 61), (40, 62), (78, 30),
+    (78, 63), (79, 64), (79, 64), (78, 62), (80, 30), (81, 32), (44, 65), (82, 32),
+    (83, 66), (84, 67), (85, 68), (86, 36), (87, 69), (88, 70), (89, 71), (90, 72),
+    (91, 73), (92, 32), (93, 74), (94, 75), (94, 75), (0, 0), (95, 76), (53, 77),
+    (53, 45), (96, 45), (90, 77), (41, 78), (97, 79), (98, 12), (99, 30), (15, 14),
+    (100, 32), (15, 14), (101, 80), (16, 13), (102, 30), (103, 15), (104, 32), (17, 15),
+    (105, 80), (23, 15), (51, 31), (106, 15), (107, 31), (23, 81), (51, 82), (25, 15),
+    (53, 39), (25, 15), (53, 72), (108, 19), (80, 32), (29, 13), (109, 83), (30, 20),
+    (110, 84), (30, 20), (111, 85), (31, 21), (112, 44), (32, 22), (96, 77), (32, 22),
+    (90, 45), (36, 26), (37, 27), (64, 49), (37, 27), (64, 49), (37, 27), (113, 86),
+    (114, 87), (115, 88), (116, 89), (116, 89), (117, 90), (118, 91), (119, 92), (0, 0),
+    (120, 90), (121, 93), (122, 92), (0, 0), (0, 0), (0, 0), (0, 0), (123, 94),
+    (68, 53), (124, 56), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (48, 33), (51, 33),
+];
+
+const KERNING: [&[i8]; 125] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, 0, -2, -2, -2, -2, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, -1, 0, -1, -2, 0, 0, 0, -2, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -2, 0, 0, -2, -2, -1, -2, 0, 0, -1, 0, -2, 0, -2, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, -2, -2, -2, -2, -2, -2, -1, 0, -1, -1, 0, -1, -2, 0, -1, -2, 0, 0, 0, -1, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, -1, -2, -1, 0, -1, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -2, 0, -2, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -2, 0, -1, -1, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, -2, -2, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, -2, 0, -2, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -2, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -2, -1, -2, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, -2],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -2, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -2, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, -2, -2, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -2, 0, -1, -1, 0, 0, 0, -2, 0, -2, 0, -1, 0, -1, 0, -1, -1, 0, 0, -2, -2, 0, -2, -2, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, -2, 0, -2, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -2, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -2, -2, 0, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -2, -1, -2, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, -2, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -2],
+    &[0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, -1, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2],
+    &[0, 0, 0, 0, -1, -2, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -2, 0, -1, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -2, -1, -2, -1, -1, -1, -1, 0, -1, -2, 0, -1, -2, -1, -2, -2, -1, 0, -1, -1, 0, -2, -2, -2, -1, -2, -1, 0, -1, 0, -2, -1, -2, -2, -2, -1, -1, 0, 0, -1, -1, 0, -1, -2, 0, 0, -1, -1, -1, -1, 0, -1, -1, -2],
+    &[0, -1, -1, 0, -1, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -2, -1, 0, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -2, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -1, -1, -2, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -2, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -2, 0, -2, -2, -2],
+    &[0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, -2],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -2, 0, -2, -1, -2, 0, -1, -1, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -2, -2, -1, -1, -1, -2, -2, -2, -2, -1, -2, -1, 0, 0, 0, -2, 0, -2, -2, -2, -2, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -2, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -2, -2, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -1, 0, -2, -1, 0, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, 0, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, -2, -1, -1, -1, -2, -1, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -2, -1, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -2, -2, -1, -2, -1, -2, -1, -1, -1, -1, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -1, -2, -1, -1, -2, -1, -1, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, -2, 0, -2, -2, -2, -2, -1, 0, 0, -2, -1, -1, 0, -1, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -2, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -2, -2, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -1, -2, -2, -1, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, 0, 0, -2, -1, -2, -2, -2, -2, -1, 0, -1, -2, -1, -1, -1, -2, -2, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -2, 0, -2, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, -1, 0, -2, -2, 0, -2, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -1, -2],
+];
+
+const BITMAP: &[u8; 18360] = include_bytes!("./bookerly_italic_28.rle");
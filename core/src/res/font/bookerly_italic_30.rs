@@ -1,308 +1,533 @@
 // Auto-generated font file
 // Font: Bookerly Italic
 
-use crate::res::font::{FontDefinition, Glyph};
+use crate::res::font::{FontDefinition, Glyph, GlyphBlock};
 
 pub const FONT: FontDefinition = FontDefinition {
-    size: 13573,
+    size: 19902,
     y_advance: 30,
     glyphs: &GLYPHS,
-    bitmap_bw: BITMAP_BW,
-    bitmap_msb: BITMAP_MSB,
-    bitmap_lsb: BITMAP_LSB,
+    glyph_pages: &GLYPH_PAGES,
+    glyph_blocks: &GLYPH_BLOCKS,
+    kerning_classes: &KERNING_CLASSES,
+    kerning: &KERNING,
+    bitmap: BITMAP,
+    pages: None,
 };
 
-const GLYPHS: [Glyph; 288] = [
+const GLYPHS: [Glyph; 290] = [
     Glyph::new(0x0020, 0x0000, 7, 0, 0, 0, 0),
     Glyph::new(0x0021, 0x0000, 10, 9, 24, 1, -1),
-    Glyph::new(0x0022, 0x001B, 12, 11, 10, 1, 12),
-    Glyph::new(0x0023, 0x0029, 19, 19, 19, 0, -2),
-    Glyph::new(0x0024, 0x0057, 19, 17, 30, 1, -6),
-    Glyph::new(0x0025, 0x0097, 30, 25, 24, 2, -2),
-    Glyph::new(0x0026, 0x00E2, 28, 24, 24, 2, -2),
-    Glyph::new(0x0027, 0x012A, 7, 5, 10, 1, 12),
-    Glyph::new(0x0028, 0x0131, 12, 13, 30, 1, -6),
-    Glyph::new(0x0029, 0x0162, 12, 13, 30, -2, -6),
-    Glyph::new(0x002A, 0x0193, 12, 11, 10, 1, 12),
-    Glyph::new(0x002B, 0x01A1, 19, 13, 14, 3, 3),
-    Glyph::new(0x002C, 0x01B8, 10, 7, 9, -1, -5),
-    Glyph::new(0x002D, 0x01C0, 12, 10, 3, 1, 6),
-    Glyph::new(0x002E, 0x01C4, 10, 5, 5, 1, -1),
-    Glyph::new(0x002F, 0x01C8, 15, 17, 24, -1, -2),
-    Glyph::new(0x0030, 0x01FB, 19, 18, 22, 0, -1),
-    Glyph::new(0x0031, 0x022D, 19, 12, 21, 2, 0),
-    Glyph::new(0x0032, 0x024D, 19, 17, 21, 0, 0),
-    Glyph::new(0x0033, 0x027A, 19, 17, 22, 0, -1),
-    Glyph::new(0x0034, 0x02A9, 19, 18, 21, 0, 0),
-    Glyph::new(0x0035, 0x02D9, 19, 17, 22, 1, -1),
-    Glyph::new(0x0036, 0x0308, 19, 18, 22, 1, -1),
-    Glyph::new(0x0037, 0x033A, 19, 15, 22, 4, -1),
-    Glyph::new(0x0038, 0x0364, 19, 17, 22, 1, -1),
-    Glyph::new(0x0039, 0x0393, 19, 17, 22, 0, -1),
-    Glyph::new(0x003A, 0x03C2, 10, 8, 17, 1, -1),
-    Glyph::new(0x003B, 0x03D3, 10, 10, 21, -1, -5),
-    Glyph::new(0x003C, 0x03EE, 19, 13, 14, 3, 3),
-    Glyph::new(0x003D, 0x0405, 19, 13, 8, 3, 6),
-    Glyph::new(0x003E, 0x0412, 19, 13, 14, 3, 3),
-    Glyph::new(0x003F, 0x0429, 13, 10, 23, 2, -1),
-    Glyph::new(0x0040, 0x0446, 30, 27, 27, 1, -6),
-    Glyph::new(0x0041, 0x04A2, 22, 23, 22, -2, 0),
-    Glyph::new(0x0042, 0x04E2, 19, 18, 23, -1, -1),
-    Glyph::new(0x0043, 0x0516, 20, 18, 23, 1, -1),
-    Glyph::new(0x0044, 0x054A, 22, 22, 23, -1, -1),
-    Glyph::new(0x0045, 0x058A, 19, 20, 21, -1, 0),
-    Glyph::new(0x0046, 0x05BF, 17, 19, 21, -1, 0),
-    Glyph::new(0x0047, 0x05F1, 22, 19, 23, 1, -1),
-    Glyph::new(0x0048, 0x0628, 25, 26, 21, -1, 0),
-    Glyph::new(0x0049, 0x066D, 12, 13, 21, -1, 0),
-    Glyph::new(0x004A, 0x0690, 11, 18, 27, -5, -6),
-    Glyph::new(0x004B, 0x06CD, 21, 23, 22, -1, -1),
-    Glyph::new(0x004C, 0x070D, 18, 18, 21, -1, 0),
-    Glyph::new(0x004D, 0x073D, 28, 29, 21, -2, 0),
-    Glyph::new(0x004E, 0x078A, 23, 25, 22, -1, -1),
-    Glyph::new(0x004F, 0x07CF, 23, 20, 23, 1, -1),
-    Glyph::new(0x0050, 0x0809, 18, 19, 22, -1, 0),
-    Glyph::new(0x0051, 0x083E, 23, 25, 29, 1, -7),
-    Glyph::new(0x0052, 0x0899, 20, 20, 23, -1, -1),
-    Glyph::new(0x0053, 0x08D3, 16, 16, 23, 0, -1),
-    Glyph::new(0x0054, 0x0901, 20, 18, 21, 2, 0),
-    Glyph::new(0x0055, 0x0931, 24, 22, 22, 2, -1),
-    Glyph::new(0x0056, 0x096E, 22, 21, 22, 2, -1),
-    Glyph::new(0x0057, 0x09A8, 32, 31, 22, 2, -1),
-    Glyph::new(0x0058, 0x09FE, 21, 25, 21, -3, 0),
-    Glyph::new(0x0059, 0x0A40, 20, 21, 21, 1, 0),
-    Glyph::new(0x005A, 0x0A78, 18, 19, 22, -1, -1),
-    Glyph::new(0x005B, 0x0AAD, 10, 13, 29, -2, -5),
-    Glyph::new(0x005C, 0x0ADD, 15, 11, 24, 2, -2),
-    Glyph::new(0x005D, 0x0AFE, 10, 12, 29, -1, -5),
-    Glyph::new(0x005E, 0x0B2A, 19, 15, 15, 2, 5),
-    Glyph::new(0x005F, 0x0B47, 15, 15, 3, 0, -4),
-    Glyph::new(0x0060, 0x0B4D, 19, 6, 8, 6, 17),
-    Glyph::new(0x0061, 0x0B53, 18, 16, 17, 1, -1),
-    Glyph::new(0x0062, 0x0B75, 17, 16, 25, 0, -1),
-    Glyph::new(0x0063, 0x0BA7, 14, 12, 17, 1, -1),
-    Glyph::new(0x0064, 0x0BC1, 18, 16, 25, 1, -1),
-    Glyph::new(0x0065, 0x0BF3, 15, 13, 17, 1, -1),
-    Glyph::new(0x0066, 0x0C0F, 13, 21, 32, -5, -8),
-    Glyph::new(0x0067, 0x0C63, 15, 20, 24, -3, -8),
-    Glyph::new(0x0068, 0x0C9F, 18, 17, 25, 0, -1),
-    Glyph::new(0x0069, 0x0CD5, 10, 9, 25, 1, -1),
-    Glyph::new(0x006A, 0x0CF2, 9, 16, 32, -6, -8),
-    Glyph::new(0x006B, 0x0D32, 16, 15, 25, 1, -1),
-    Glyph::new(0x006C, 0x0D61, 10, 8, 25, 1, -1),
-    Glyph::new(0x006D, 0x0D7A, 27, 25, 17, 1, -1),
-    Glyph::new(0x006E, 0x0DB0, 19, 17, 17, 1, -1),
-    Glyph::new(0x006F, 0x0DD5, 17, 15, 17, 1, -1),
-    Glyph::new(0x0070, 0x0DF5, 18, 18, 23, -2, -7),
-    Glyph::new(0x0071, 0x0E29, 17, 16, 23, 1, -7),
-    Glyph::new(0x0072, 0x0E57, 13, 13, 16, 1, 0),
-    Glyph::new(0x0073, 0x0E71, 13, 12, 17, 0, -1),
-    Glyph::new(0x0074, 0x0E8B, 12, 12, 21, 0, -1),
-    Glyph::new(0x0075, 0x0EAB, 19, 17, 17, 1, -1),
-    Glyph::new(0x0076, 0x0ED0, 16, 15, 17, 0, -1),
-    Glyph::new(0x0077, 0x0EF0, 24, 23, 17, 0, -1),
-    Glyph::new(0x0078, 0x0F21, 17, 18, 17, -1, -1),
-    Glyph::new(0x0079, 0x0F48, 17, 19, 24, -3, -8),
-    Glyph::new(0x007A, 0x0F81, 15, 14, 17, 0, -1),
-    Glyph::new(0x007B, 0x0F9F, 12, 12, 30, 1, -6),
-    Glyph::new(0x007C, 0x0FCC, 9, 9, 27, 0, -4),
-    Glyph::new(0x007D, 0x0FEB, 12, 12, 30, -1, -6),
-    Glyph::new(0x007E, 0x1018, 19, 15, 6, 2, 7),
-    Glyph::new(0x00A1, 0x1024, 10, 9, 23, -1, -7),
-    Glyph::new(0x00A2, 0x103E, 19, 15, 30, 2, -6),
-    Glyph::new(0x00A3, 0x1077, 19, 20, 22, -1, -1),
-    Glyph::new(0x00A4, 0x10AE, 19, 19, 15, 0, 3),
-    Glyph::new(0x00A5, 0x10D2, 19, 20, 21, 1, 0),
-    Glyph::new(0x00A7, 0x1107, 15, 14, 24, 0, -3),
-    Glyph::new(0x00A9, 0x1131, 24, 23, 23, 0, -1),
-    Glyph::new(0x00AA, 0x1174, 13, 12, 15, 1, 7),
-    Glyph::new(0x00AB, 0x118B, 16, 14, 12, 1, 2),
-    Glyph::new(0x00AE, 0x11A0, 18, 17, 17, 0, 7),
-    Glyph::new(0x00B0, 0x11C5, 16, 10, 10, 3, 11),
-    Glyph::new(0x00B1, 0x11D2, 19, 13, 18, 3, 0),
-    Glyph::new(0x00B2, 0x11F0, 14, 11, 14, 1, 11),
-    Glyph::new(0x00B3, 0x1204, 14, 11, 15, 1, 10),
-    Glyph::new(0x00B5, 0x1219, 18, 19, 24, -1, -8),
-    Glyph::new(0x00B6, 0x1252, 18, 19, 26, -1, -5),
-    Glyph::new(0x00B7, 0x1290, 10, 5, 5, 2, 6),
-    Glyph::new(0x00B9, 0x1294, 14, 9, 14, 2, 11),
-    Glyph::new(0x00BA, 0x12A4, 14, 12, 15, 1, 7),
-    Glyph::new(0x00BB, 0x12BB, 16, 15, 12, 0, 2),
-    Glyph::new(0x00BC, 0x12D2, 33, 29, 24, 2, -2),
-    Glyph::new(0x00BD, 0x1329, 33, 29, 24, 2, -2),
-    Glyph::new(0x00BE, 0x1380, 33, 30, 24, 1, -2),
-    Glyph::new(0x00BF, 0x13DA, 13, 10, 23, 0, -7),
-    Glyph::new(0x00C0, 0x13F7, 22, 23, 29, -2, 0),
-    Glyph::new(0x00C1, 0x144B, 22, 23, 29, -2, 0),
-    Glyph::new(0x00C2, 0x149F, 22, 23, 29, -2, 0),
-    Glyph::new(0x00C3, 0x14F3, 22, 23, 29, -2, 0),
-    Glyph::new(0x00C4, 0x1547, 22, 23, 28, -2, 0),
-    Glyph::new(0x00C5, 0x1598, 22, 23, 30, -2, 0),
-    Glyph::new(0x00C6, 0x15EF, 27, 30, 21, -3, 0),
-    Glyph::new(0x00C7, 0x163E, 20, 18, 30, 1, -8),
-    Glyph::new(0x00C8, 0x1682, 19, 20, 29, -1, 0),
-    Glyph::new(0x00C9, 0x16CB, 19, 20, 29, -1, 0),
-    Glyph::new(0x00CA, 0x1714, 19, 20, 29, -1, 0),
-    Glyph::new(0x00CB, 0x175D, 19, 20, 28, -1, 0),
-    Glyph::new(0x00CC, 0x17A3, 12, 13, 29, -1, 0),
-    Glyph::new(0x00CD, 0x17D3, 12, 15, 29, -1, 0),
-    Glyph::new(0x00CE, 0x180A, 12, 15, 29, -1, 0),
-    Glyph::new(0x00CF, 0x1841, 12, 15, 28, -1, 0),
-    Glyph::new(0x00D0, 0x1876, 22, 22, 23, -1, -1),
-    Glyph::new(0x00D1, 0x18B6, 23, 25, 30, -1, -1),
-    Glyph::new(0x00D2, 0x1914, 23, 20, 30, 1, -1),
-    Glyph::new(0x00D3, 0x195F, 23, 20, 30, 1, -1),
-    Glyph::new(0x00D4, 0x19AA, 23, 20, 30, 1, -1),
-    Glyph::new(0x00D5, 0x19F5, 23, 20, 30, 1, -1),
-    Glyph::new(0x00D6, 0x1A40, 23, 20, 29, 1, -1),
-    Glyph::new(0x00D7, 0x1A89, 19, 13, 13, 3, 4),
-    Glyph::new(0x00D8, 0x1A9F, 23, 24, 23, -1, -1),
-    Glyph::new(0x00D9, 0x1AE4, 24, 22, 30, 2, -1),
-    Glyph::new(0x00DA, 0x1B37, 24, 22, 30, 2, -1),
-    Glyph::new(0x00DB, 0x1B8A, 24, 22, 30, 2, -1),
-    Glyph::new(0x00DC, 0x1BDD, 24, 22, 29, 2, -1),
-    Glyph::new(0x00DE, 0x1C2D, 18, 18, 21, -1, 0),
-    Glyph::new(0x00DF, 0x1C5D, 20, 24, 32, -5, -8),
-    Glyph::new(0x00E0, 0x1CBD, 18, 16, 26, 1, -1),
-    Glyph::new(0x00E1, 0x1CF1, 18, 16, 26, 1, -1),
-    Glyph::new(0x00E2, 0x1D25, 18, 16, 26, 1, -1),
-    Glyph::new(0x00E3, 0x1D59, 18, 16, 25, 1, -1),
-    Glyph::new(0x00E4, 0x1D8B, 18, 16, 24, 1, -1),
-    Glyph::new(0x00E5, 0x1DBB, 18, 16, 26, 1, -1),
-    Glyph::new(0x00E6, 0x1DEF, 24, 22, 17, 1, -1),
-    Glyph::new(0x00E7, 0x1E1E, 14, 12, 24, 1, -8),
-    Glyph::new(0x00E8, 0x1E42, 15, 13, 26, 1, -1),
-    Glyph::new(0x00E9, 0x1E6D, 15, 13, 26, 1, -1),
-    Glyph::new(0x00EA, 0x1E98, 15, 13, 26, 1, -1),
-    Glyph::new(0x00EB, 0x1EC3, 15, 14, 24, 1, -1),
-    Glyph::new(0x00EC, 0x1EED, 10, 8, 26, 1, -1),
-    Glyph::new(0x00ED, 0x1F07, 10, 11, 26, 1, -1),
-    Glyph::new(0x00EE, 0x1F2B, 10, 11, 26, 1, -1),
-    Glyph::new(0x00EF, 0x1F4F, 10, 12, 24, 1, -1),
-    Glyph::new(0x00F0, 0x1F73, 17, 15, 25, 1, -1),
-    Glyph::new(0x00F1, 0x1FA2, 19, 17, 25, 1, -1),
-    Glyph::new(0x00F2, 0x1FD8, 17, 15, 26, 1, -1),
-    Glyph::new(0x00F3, 0x2009, 17, 15, 26, 1, -1),
-    Glyph::new(0x00F4, 0x203A, 17, 15, 26, 1, -1),
-    Glyph::new(0x00F5, 0x206B, 17, 15, 25, 1, -1),
-    Glyph::new(0x00F6, 0x209A, 17, 15, 24, 1, -1),
-    Glyph::new(0x00F7, 0x20C7, 19, 13, 14, 3, 3),
-    Glyph::new(0x00F8, 0x20DE, 17, 20, 17, -2, -1),
-    Glyph::new(0x00F9, 0x2109, 19, 17, 26, 1, -1),
-    Glyph::new(0x00FA, 0x2141, 19, 17, 26, 1, -1),
-    Glyph::new(0x00FB, 0x2179, 19, 17, 26, 1, -1),
-    Glyph::new(0x00FC, 0x21B1, 19, 17, 24, 1, -1),
-    Glyph::new(0x00FE, 0x21E4, 17, 19, 31, -3, -7),
-    Glyph::new(0x00FF, 0x222E, 17, 19, 31, -3, -8),
-    Glyph::new(0x0104, 0x2278, 22, 23, 29, -2, -7),
-    Glyph::new(0x0105, 0x22CC, 18, 16, 23, 1, -7),
-    Glyph::new(0x0106, 0x22FA, 20, 18, 30, 1, -1),
-    Glyph::new(0x0107, 0x233E, 14, 13, 26, 1, -1),
-    Glyph::new(0x010C, 0x2369, 20, 19, 30, 1, -1),
-    Glyph::new(0x010D, 0x23B1, 14, 15, 26, 1, -1),
-    Glyph::new(0x010E, 0x23E2, 22, 22, 30, -1, -1),
-    Glyph::new(0x010F, 0x2435, 19, 22, 27, 1, -1),
-    Glyph::new(0x0118, 0x2480, 19, 20, 28, -1, -7),
-    Glyph::new(0x0119, 0x24C6, 15, 13, 23, 1, -7),
-    Glyph::new(0x011A, 0x24EC, 19, 20, 29, -1, 0),
-    Glyph::new(0x011B, 0x2535, 15, 15, 26, 1, -1),
-    Glyph::new(0x0139, 0x2566, 18, 18, 29, -1, 0),
-    Glyph::new(0x013A, 0x25A8, 10, 11, 32, 1, -1),
-    Glyph::new(0x013D, 0x25D4, 18, 18, 24, -1, 0),
-    Glyph::new(0x013E, 0x260A, 11, 13, 27, 1, -1),
-    Glyph::new(0x0141, 0x2636, 18, 18, 21, -1, 0),
-    Glyph::new(0x0142, 0x2666, 10, 12, 25, -1, -1),
-    Glyph::new(0x0143, 0x268C, 23, 25, 30, -1, -1),
-    Glyph::new(0x0144, 0x26EA, 19, 17, 26, 1, -1),
-    Glyph::new(0x0147, 0x2722, 23, 25, 30, -1, -1),
-    Glyph::new(0x0148, 0x2780, 19, 17, 26, 1, -1),
-    Glyph::new(0x0152, 0x27B8, 29, 28, 22, 1, -1),
-    Glyph::new(0x0153, 0x2805, 25, 23, 17, 1, -1),
-    Glyph::new(0x0158, 0x2836, 20, 20, 30, -1, -1),
-    Glyph::new(0x0159, 0x2881, 13, 14, 25, 1, 0),
-    Glyph::new(0x015A, 0x28AD, 16, 16, 30, 0, -1),
-    Glyph::new(0x015B, 0x28E9, 13, 13, 26, 0, -1),
-    Glyph::new(0x0160, 0x2914, 16, 17, 30, 0, -1),
-    Glyph::new(0x0161, 0x2954, 13, 15, 26, 0, -1),
-    Glyph::new(0x0164, 0x2985, 20, 18, 29, 2, 0),
-    Glyph::new(0x0165, 0x29C7, 12, 13, 25, 0, -1),
-    Glyph::new(0x016E, 0x29F0, 24, 22, 31, 2, -1),
-    Glyph::new(0x016F, 0x2A46, 19, 17, 26, 1, -1),
-    Glyph::new(0x0170, 0x2A7E, 24, 22, 31, 2, -1),
-    Glyph::new(0x0171, 0x2AD4, 19, 17, 26, 1, -1),
-    Glyph::new(0x0178, 0x2B0C, 20, 21, 28, 1, 0),
-    Glyph::new(0x0179, 0x2B56, 18, 19, 30, -1, -1),
-    Glyph::new(0x017A, 0x2B9E, 15, 14, 26, 0, -1),
-    Glyph::new(0x017B, 0x2BCC, 18, 19, 29, -1, -1),
-    Glyph::new(0x017C, 0x2C11, 15, 14, 24, 0, -1),
-    Glyph::new(0x017D, 0x2C3B, 18, 19, 30, -1, -1),
-    Glyph::new(0x017E, 0x2C83, 15, 15, 26, 0, -1),
-    Glyph::new(0x03C0, 0x2CB4, 18, 18, 17, 0, -1),
-    Glyph::new(0x1E9E, 0x2CDB, 22, 22, 23, -2, -1),
-    Glyph::new(0x2013, 0x2D1B, 15, 15, 3, 0, 6),
-    Glyph::new(0x2014, 0x2D21, 30, 30, 3, 0, 6),
-    Glyph::new(0x2018, 0x2D2D, 10, 7, 10, 2, 13),
-    Glyph::new(0x2019, 0x2D36, 10, 6, 10, 2, 13),
-    Glyph::new(0x201A, 0x2D3E, 10, 6, 10, 1, -6),
-    Glyph::new(0x201B, 0x2D46, 8, 6, 10, 1, 13),
-    Glyph::new(0x201C, 0x2D4E, 16, 13, 10, 2, 13),
-    Glyph::new(0x201D, 0x2D5F, 16, 12, 10, 2, 13),
-    Glyph::new(0x201E, 0x2D6E, 16, 12, 10, 1, -6),
-    Glyph::new(0x201F, 0x2D7D, 14, 12, 10, 1, 13),
-    Glyph::new(0x2020, 0x2D8C, 15, 13, 20, 1, 2),
-    Glyph::new(0x2021, 0x2DAD, 15, 14, 24, 0, -2),
-    Glyph::new(0x2022, 0x2DD7, 9, 7, 7, 1, 4),
-    Glyph::new(0x2026, 0x2DDE, 30, 25, 5, 2, -1),
-    Glyph::new(0x2039, 0x2DEE, 10, 8, 12, 1, 2),
-    Glyph::new(0x203A, 0x2DFA, 10, 9, 12, 0, 2),
-    Glyph::new(0x2070, 0x2E08, 14, 12, 15, 1, 10),
-    Glyph::new(0x2074, 0x2E1F, 14, 13, 14, 0, 11),
-    Glyph::new(0x2075, 0x2E36, 14, 12, 15, 1, 10),
-    Glyph::new(0x2076, 0x2E4D, 14, 11, 15, 2, 10),
-    Glyph::new(0x2077, 0x2E62, 14, 10, 15, 3, 10),
-    Glyph::new(0x2078, 0x2E75, 14, 11, 15, 1, 10),
-    Glyph::new(0x2079, 0x2E8A, 14, 12, 15, 0, 10),
-    Glyph::new(0x2080, 0x2EA1, 14, 12, 15, 1, -5),
-    Glyph::new(0x2081, 0x2EB8, 14, 9, 14, 2, -4),
-    Glyph::new(0x2082, 0x2EC8, 14, 11, 14, 1, -4),
-    Glyph::new(0x2083, 0x2EDC, 14, 11, 15, 1, -5),
-    Glyph::new(0x2084, 0x2EF1, 14, 13, 14, 0, -4),
-    Glyph::new(0x2085, 0x2F08, 14, 12, 15, 1, -5),
-    Glyph::new(0x2086, 0x2F1F, 14, 11, 15, 2, -5),
-    Glyph::new(0x2087, 0x2F34, 14, 10, 15, 3, -5),
-    Glyph::new(0x2088, 0x2F47, 14, 11, 15, 1, -5),
-    Glyph::new(0x2089, 0x2F5C, 14, 12, 15, 0, -5),
-    Glyph::new(0x20AC, 0x2F73, 19, 21, 22, -1, -1),
-    Glyph::new(0x2122, 0x2FAD, 22, 21, 11, 2, 10),
-    Glyph::new(0x2153, 0x2FCA, 33, 28, 24, 2, -2),
-    Glyph::new(0x2154, 0x301E, 33, 29, 24, 1, -2),
-    Glyph::new(0x215B, 0x3075, 33, 29, 24, 2, -2),
-    Glyph::new(0x215C, 0x30CC, 33, 30, 24, 1, -2),
-    Glyph::new(0x215D, 0x3126, 33, 30, 24, 1, -2),
-    Glyph::new(0x215E, 0x3180, 33, 28, 24, 3, -2),
-    Glyph::new(0x2190, 0x31D4, 30, 18, 13, 6, 4),
-    Glyph::new(0x2191, 0x31F2, 30, 12, 20, 9, 0),
-    Glyph::new(0x2192, 0x3210, 30, 18, 13, 6, 4),
-    Glyph::new(0x2193, 0x322E, 30, 12, 20, 9, 0),
-    Glyph::new(0x2194, 0x324C, 30, 18, 13, 6, 4),
-    Glyph::new(0x2195, 0x326A, 30, 12, 21, 9, 0),
-    Glyph::new(0x21D0, 0x328A, 30, 18, 14, 6, 3),
-    Glyph::new(0x21D1, 0x32AA, 30, 14, 18, 8, 1),
-    Glyph::new(0x21D2, 0x32CA, 30, 18, 14, 6, 3),
-    Glyph::new(0x21D3, 0x32EA, 30, 14, 18, 8, 1),
-    Glyph::new(0x21D4, 0x330A, 30, 18, 14, 6, 3),
-    Glyph::new(0x2202, 0x332A, 19, 15, 25, 2, -1),
-    Glyph::new(0x2206, 0x3359, 20, 19, 22, 0, 0),
-    Glyph::new(0x220F, 0x338E, 25, 23, 26, 1, -5),
-    Glyph::new(0x2211, 0x33D9, 19, 18, 26, 0, -5),
-    Glyph::new(0x221A, 0x3414, 19, 19, 29, 0, -4),
-    Glyph::new(0x221E, 0x3459, 19, 19, 11, 0, 4),
-    Glyph::new(0x222B, 0x3474, 19, 16, 31, 1, -7),
-    Glyph::new(0x2260, 0x34B2, 19, 13, 14, 3, 3),
-    Glyph::new(0x2264, 0x34C9, 19, 13, 18, 3, 0),
-    Glyph::new(0x2265, 0x34E7, 19, 13, 18, 3, 0),
+    Glyph::new(0x0022, 0x002B, 12, 11, 10, 1, 12),
+    Glyph::new(0x0023, 0x004A, 19, 19, 19, 0, -2),
+    Glyph::new(0x0024, 0x0099, 19, 17, 30, 1, -6),
+    Glyph::new(0x0025, 0x00F9, 30, 25, 24, 2, -2),
+    Glyph::new(0x0026, 0x017A, 28, 24, 24, 2, -2),
+    Glyph::new(0x0027, 0x01EC, 7, 5, 10, 1, 12),
+    Glyph::new(0x0028, 0x01FC, 12, 13, 30, 1, -6),
+    Glyph::new(0x0029, 0x023B, 12, 13, 30, -2, -6),
+    Glyph::new(0x002A, 0x027C, 12, 11, 10, 1, 12),
+    Glyph::new(0x002B, 0x029B, 19, 13, 14, 3, 3),
+    Glyph::new(0x002C, 0x02B8, 10, 7, 9, -1, -5),
+    Glyph::new(0x002D, 0x02C8, 12, 10, 3, 1, 6),
+    Glyph::new(0x002E, 0x02D1, 10, 5, 5, 1, -1),
+    Glyph::new(0x002F, 0x02D9, 15, 17, 24, -1, -2),
+    Glyph::new(0x0030, 0x030D, 19, 18, 22, 0, -1),
+    Glyph::new(0x0031, 0x035A, 19, 12, 21, 2, 0),
+    Glyph::new(0x0032, 0x0384, 19, 17, 21, 0, 0),
+    Glyph::new(0x0033, 0x03BB, 19, 17, 22, 0, -1),
+    Glyph::new(0x0034, 0x03F6, 19, 18, 21, 0, 0),
+    Glyph::new(0x0035, 0x0434, 19, 17, 22, 1, -1),
+    Glyph::new(0x0036, 0x046B, 19, 18, 22, 1, -1),
+    Glyph::new(0x0037, 0x04B1, 19, 15, 22, 4, -1),
+    Glyph::new(0x0038, 0x04EB, 19, 17, 22, 1, -1),
+    Glyph::new(0x0039, 0x0538, 19, 17, 22, 0, -1),
+    Glyph::new(0x003A, 0x0580, 10, 8, 17, 1, -1),
+    Glyph::new(0x003B, 0x0592, 10, 10, 21, -1, -5),
+    Glyph::new(0x003C, 0x05AE, 19, 13, 14, 3, 3),
+    Glyph::new(0x003D, 0x05CE, 19, 13, 8, 3, 6),
+    Glyph::new(0x003E, 0x05E8, 19, 13, 14, 3, 3),
+    Glyph::new(0x003F, 0x0609, 13, 10, 23, 2, -1),
+    Glyph::new(0x0040, 0x063B, 30, 27, 27, 1, -6),
+    Glyph::new(0x0041, 0x06CC, 22, 23, 22, -2, 0),
+    Glyph::new(0x0042, 0x071E, 19, 18, 23, -1, -1),
+    Glyph::new(0x0043, 0x076A, 20, 18, 23, 1, -1),
+    Glyph::new(0x0044, 0x07AD, 22, 22, 23, -1, -1),
+    Glyph::new(0x0045, 0x0802, 19, 20, 21, -1, 0),
+    Glyph::new(0x0046, 0x0850, 17, 19, 21, -1, 0),
+    Glyph::new(0x0047, 0x0893, 22, 19, 23, 1, -1),
+    Glyph::new(0x0048, 0x08E2, 25, 26, 21, -1, 0),
+    Glyph::new(0x0049, 0x0949, 12, 13, 21, -1, 0),
+    Glyph::new(0x004A, 0x097A, 11, 18, 27, -5, -6),
+    Glyph::new(0x004B, 0x09BB, 21, 23, 22, -1, -1),
+    Glyph::new(0x004C, 0x0A12, 18, 18, 21, -1, 0),
+    Glyph::new(0x004D, 0x0A4D, 28, 29, 21, -2, 0),
+    Glyph::new(0x004E, 0x0AC8, 23, 25, 22, -1, -1),
+    Glyph::new(0x004F, 0x0B34, 23, 20, 23, 1, -1),
+    Glyph::new(0x0050, 0x0B83, 18, 19, 22, -1, 0),
+    Glyph::new(0x0051, 0x0BC5, 23, 25, 29, 1, -7),
+    Glyph::new(0x0052, 0x0C32, 20, 20, 23, -1, -1),
+    Glyph::new(0x0053, 0x0C84, 16, 16, 23, 0, -1),
+    Glyph::new(0x0054, 0x0CC5, 20, 18, 21, 2, 0),
+    Glyph::new(0x0055, 0x0D09, 24, 22, 22, 2, -1),
+    Glyph::new(0x0056, 0x0D63, 22, 21, 22, 2, -1),
+    Glyph::new(0x0057, 0x0DB0, 32, 31, 22, 2, -1),
+    Glyph::new(0x0058, 0x0E2F, 21, 25, 21, -3, 0),
+    Glyph::new(0x0059, 0x0E81, 20, 21, 21, 1, 0),
+    Glyph::new(0x005A, 0x0EC8, 18, 19, 22, -1, -1),
+    Glyph::new(0x005B, 0x0F11, 10, 13, 29, -2, -5),
+    Glyph::new(0x005C, 0x0F54, 15, 11, 24, 2, -2),
+    Glyph::new(0x005D, 0x0F80, 10, 12, 29, -1, -5),
+    Glyph::new(0x005E, 0x0FBF, 19, 15, 15, 2, 5),
+    Glyph::new(0x005F, 0x0FED, 15, 15, 3, 0, -4),
+    Glyph::new(0x0060, 0x0FFE, 19, 6, 8, 6, 17),
+    Glyph::new(0x0061, 0x100A, 18, 16, 17, 1, -1),
+    Glyph::new(0x0062, 0x1048, 17, 16, 25, 0, -1),
+    Glyph::new(0x0063, 0x1095, 14, 12, 17, 1, -1),
+    Glyph::new(0x0064, 0x10BD, 18, 16, 25, 1, -1),
+    Glyph::new(0x0065, 0x110A, 15, 13, 17, 1, -1),
+    Glyph::new(0x0066, 0x113D, 13, 21, 32, -5, -8),
+    Glyph::new(0x0067, 0x1190, 15, 20, 24, -3, -8),
+    Glyph::new(0x0068, 0x11E5, 18, 17, 25, 0, -1),
+    Glyph::new(0x0069, 0x123A, 10, 9, 25, 1, -1),
+    Glyph::new(0x006A, 0x1268, 9, 16, 32, -6, -8),
+    Glyph::new(0x006B, 0x12A5, 16, 15, 25, 1, -1),
+    Glyph::new(0x006C, 0x12ED, 10, 8, 25, 1, -1),
+    Glyph::new(0x006D, 0x131F, 27, 25, 17, 1, -1),
+    Glyph::new(0x006E, 0x1387, 19, 17, 17, 1, -1),
+    Glyph::new(0x006F, 0x13CB, 17, 15, 17, 1, -1),
+    Glyph::new(0x0070, 0x1403, 18, 18, 23, -2, -7),
+    Glyph::new(0x0071, 0x1455, 17, 16, 23, 1, -7),
+    Glyph::new(0x0072, 0x14A1, 13, 13, 16, 1, 0),
+    Glyph::new(0x0073, 0x14CD, 13, 12, 17, 0, -1),
+    Glyph::new(0x0074, 0x14F8, 12, 12, 21, 0, -1),
+    Glyph::new(0x0075, 0x1528, 19, 17, 17, 1, -1),
+    Glyph::new(0x0076, 0x1570, 16, 15, 17, 0, -1),
+    Glyph::new(0x0077, 0x15A6, 24, 23, 17, 0, -1),
+    Glyph::new(0x0078, 0x1600, 17, 18, 17, -1, -1),
+    Glyph::new(0x0079, 0x163A, 17, 19, 24, -3, -8),
+    Glyph::new(0x007A, 0x1689, 15, 14, 17, 0, -1),
+    Glyph::new(0x007B, 0x16BF, 12, 12, 30, 1, -6),
+    Glyph::new(0x007C, 0x16FB, 9, 9, 27, 0, -4),
+    Glyph::new(0x007D, 0x1728, 12, 12, 30, -1, -6),
+    Glyph::new(0x007E, 0x1764, 19, 15, 6, 2, 7),
+    Glyph::new(0x00A1, 0x1777, 10, 9, 23, -1, -7),
+    Glyph::new(0x00A2, 0x179E, 19, 15, 30, 2, -6),
+    Glyph::new(0x00A3, 0x17EE, 19, 20, 22, -1, -1),
+    Glyph::new(0x00A4, 0x1833, 19, 19, 15, 0, 3),
+    Glyph::new(0x00A5, 0x186D, 19, 20, 21, 1, 0),
+    Glyph::new(0x00A7, 0x18BC, 15, 14, 24, 0, -3),
+    Glyph::new(0x00A9, 0x190C, 24, 23, 23, 0, -1),
+    Glyph::new(0x00AA, 0x1982, 13, 12, 15, 1, 7),
+    Glyph::new(0x00AB, 0x19B0, 16, 14, 12, 1, 2),
+    Glyph::new(0x00AE, 0x19D8, 18, 17, 17, 0, 7),
+    Glyph::new(0x00B0, 0x1A30, 16, 10, 10, 3, 11),
+    Glyph::new(0x00B1, 0x1A50, 19, 13, 18, 3, 0),
+    Glyph::new(0x00B2, 0x1A71, 14, 11, 14, 1, 11),
+    Glyph::new(0x00B3, 0x1A98, 14, 11, 15, 1, 10),
+    Glyph::new(0x00B5, 0x1ABC, 18, 19, 24, -1, -8),
+    Glyph::new(0x00B6, 0x1B0D, 18, 19, 26, -1, -5),
+    Glyph::new(0x00B7, 0x1B6F, 10, 5, 5, 2, 6),
+    Glyph::new(0x00B9, 0x1B77, 14, 9, 14, 2, 11),
+    Glyph::new(0x00BA, 0x1B91, 14, 12, 15, 1, 7),
+    Glyph::new(0x00BB, 0x1BB7, 16, 15, 12, 0, 2),
+    Glyph::new(0x00BC, 0x1BE0, 33, 29, 24, 2, -2),
+    Glyph::new(0x00BD, 0x1C53, 33, 29, 24, 2, -2),
+    Glyph::new(0x00BE, 0x1CC4, 33, 30, 24, 1, -2),
+    Glyph::new(0x00BF, 0x1D3C, 13, 10, 23, 0, -7),
+    Glyph::new(0x00C0, 0x1D69, 22, 23, 29, -2, 0),
+    Glyph::new(0x00C1, 0x1DCA, 22, 23, 29, -2, 0),
+    Glyph::new(0x00C2, 0x1E2D, 22, 23, 29, -2, 0),
+    Glyph::new(0x00C3, 0x1E93, 22, 23, 29, -2, 0),
+    Glyph::new(0x00C4, 0x1EF8, 22, 23, 28, -2, 0),
+    Glyph::new(0x00C5, 0x1F5B, 22, 23, 30, -2, 0),
+    Glyph::new(0x00C6, 0x1FC7, 27, 30, 21, -3, 0),
+    Glyph::new(0x00C7, 0x2034, 20, 18, 30, 1, -8),
+    Glyph::new(0x00C8, 0x2088, 19, 20, 29, -1, 0),
+    Glyph::new(0x00C9, 0x20E4, 19, 20, 29, -1, 0),
+    Glyph::new(0x00CA, 0x2142, 19, 20, 29, -1, 0),
+    Glyph::new(0x00CB, 0x21A5, 19, 20, 28, -1, 0),
+    Glyph::new(0x00CC, 0x2207, 12, 13, 29, -1, 0),
+    Glyph::new(0x00CD, 0x2245, 12, 15, 29, -1, 0),
+    Glyph::new(0x00CE, 0x2282, 12, 15, 29, -1, 0),
+    Glyph::new(0x00CF, 0x22C3, 12, 15, 28, -1, 0),
+    Glyph::new(0x00D0, 0x2303, 22, 22, 23, -1, -1),
+    Glyph::new(0x00D1, 0x235F, 23, 25, 30, -1, -1),
+    Glyph::new(0x00D2, 0x23DF, 23, 20, 30, 1, -1),
+    Glyph::new(0x00D3, 0x243D, 23, 20, 30, 1, -1),
+    Glyph::new(0x00D4, 0x249B, 23, 20, 30, 1, -1),
+    Glyph::new(0x00D5, 0x24FE, 23, 20, 30, 1, -1),
+    Glyph::new(0x00D6, 0x2561, 23, 20, 29, 1, -1),
+    Glyph::new(0x00D7, 0x25C3, 19, 13, 13, 3, 4),
+    Glyph::new(0x00D8, 0x25EA, 23, 24, 23, -1, -1),
+    Glyph::new(0x00D9, 0x2655, 24, 22, 30, 2, -1),
+    Glyph::new(0x00DA, 0x26BF, 24, 22, 30, 2, -1),
+    Glyph::new(0x00DB, 0x272A, 24, 22, 30, 2, -1),
+    Glyph::new(0x00DC, 0x2799, 24, 22, 29, 2, -1),
+    Glyph::new(0x00DE, 0x2807, 18, 18, 21, -1, 0),
+    Glyph::new(0x00DF, 0x284E, 20, 24, 32, -5, -8),
+    Glyph::new(0x00E0, 0x28C5, 18, 16, 26, 1, -1),
+    Glyph::new(0x00E1, 0x2913, 18, 16, 26, 1, -1),
+    Glyph::new(0x00E2, 0x2960, 18, 16, 26, 1, -1),
+    Glyph::new(0x00E3, 0x29B2, 18, 16, 25, 1, -1),
+    Glyph::new(0x00E4, 0x2A03, 18, 16, 24, 1, -1),
+    Glyph::new(0x00E5, 0x2A50, 18, 16, 26, 1, -1),
+    Glyph::new(0x00E6, 0x2AA8, 24, 22, 17, 1, -1),
+    Glyph::new(0x00E7, 0x2B01, 14, 12, 24, 1, -8),
+    Glyph::new(0x00E8, 0x2B37, 15, 13, 26, 1, -1),
+    Glyph::new(0x00E9, 0x2B77, 15, 13, 26, 1, -1),
+    Glyph::new(0x00EA, 0x2BB8, 15, 13, 26, 1, -1),
+    Glyph::new(0x00EB, 0x2BFD, 15, 14, 24, 1, -1),
+    Glyph::new(0x00EC, 0x2C42, 10, 8, 26, 1, -1),
+    Glyph::new(0x00ED, 0x2C73, 10, 11, 26, 1, -1),
+    Glyph::new(0x00EE, 0x2CA4, 10, 11, 26, 1, -1),
+    Glyph::new(0x00EF, 0x2CDB, 10, 12, 24, 1, -1),
+    Glyph::new(0x00F0, 0x2D0C, 17, 15, 25, 1, -1),
+    Glyph::new(0x00F1, 0x2D5B, 19, 17, 25, 1, -1),
+    Glyph::new(0x00F2, 0x2DB3, 17, 15, 26, 1, -1),
+    Glyph::new(0x00F3, 0x2DF8, 17, 15, 26, 1, -1),
+    Glyph::new(0x00F4, 0x2E3E, 17, 15, 26, 1, -1),
+    Glyph::new(0x00F5, 0x2E8A, 17, 15, 25, 1, -1),
+    Glyph::new(0x00F6, 0x2ED6, 17, 15, 24, 1, -1),
+    Glyph::new(0x00F7, 0x2F1E, 19, 13, 14, 3, 3),
+    Glyph::new(0x00F8, 0x2F3C, 17, 20, 17, -2, -1),
+    Glyph::new(0x00F9, 0x2F83, 19, 17, 26, 1, -1),
+    Glyph::new(0x00FA, 0x2FDB, 19, 17, 26, 1, -1),
+    Glyph::new(0x00FB, 0x3032, 19, 17, 26, 1, -1),
+    Glyph::new(0x00FC, 0x3090, 19, 17, 24, 1, -1),
+    Glyph::new(0x00FE, 0x30E8, 17, 19, 31, -3, -7),
+    Glyph::new(0x00FF, 0x3148, 17, 19, 31, -3, -8),
+    Glyph::new(0x0104, 0x31A7, 22, 23, 29, -2, -7),
+    Glyph::new(0x0105, 0x320A, 18, 16, 23, 1, -7),
+    Glyph::new(0x0106, 0x3256, 20, 18, 30, 1, -1),
+    Glyph::new(0x0107, 0x32A6, 14, 13, 26, 1, -1),
+    Glyph::new(0x010C, 0x32E0, 20, 19, 30, 1, -1),
+    Glyph::new(0x010D, 0x3338, 14, 15, 26, 1, -1),
+    Glyph::new(0x010E, 0x3377, 22, 22, 30, -1, -1),
+    Glyph::new(0x010F, 0x33E0, 19, 22, 27, 1, -1),
+    Glyph::new(0x0118, 0x3444, 19, 20, 28, -1, -7),
+    Glyph::new(0x0119, 0x34A3, 15, 13, 23, 1, -7),
+    Glyph::new(0x011A, 0x34E3, 19, 20, 29, -1, 0),
+    Glyph::new(0x011B, 0x3547, 15, 15, 26, 1, -1),
+    Glyph::new(0x0139, 0x358F, 18, 18, 29, -1, 0),
+    Glyph::new(0x013A, 0x35D8, 10, 11, 32, 1, -1),
+    Glyph::new(0x013D, 0x3615, 18, 18, 24, -1, 0),
+    Glyph::new(0x013E, 0x365C, 11, 13, 27, 1, -1),
+    Glyph::new(0x0141, 0x369F, 18, 18, 21, -1, 0),
+    Glyph::new(0x0142, 0x36E2, 10, 12, 25, -1, -1),
+    Glyph::new(0x0143, 0x3718, 23, 25, 30, -1, -1),
+    Glyph::new(0x0144, 0x3796, 19, 17, 26, 1, -1),
+    Glyph::new(0x0147, 0x37E9, 23, 25, 30, -1, -1),
+    Glyph::new(0x0148, 0x386B, 19, 17, 26, 1, -1),
+    Glyph::new(0x0152, 0x38C3, 29, 28, 22, 1, -1),
+    Glyph::new(0x0153, 0x3938, 25, 23, 17, 1, -1),
+    Glyph::new(0x0158, 0x398D, 20, 20, 30, -1, -1),
+    Glyph::new(0x0159, 0x39F3, 13, 14, 25, 1, 0),
+    Glyph::new(0x015A, 0x3A36, 16, 16, 30, 0, -1),
+    Glyph::new(0x015B, 0x3A85, 13, 13, 26, 0, -1),
+    Glyph::new(0x0160, 0x3AC1, 16, 17, 30, 0, -1),
+    Glyph::new(0x0161, 0x3B18, 13, 15, 26, 0, -1),
+    Glyph::new(0x0164, 0x3B59, 20, 18, 29, 2, 0),
+    Glyph::new(0x0165, 0x3BB1, 12, 13, 25, 0, -1),
+    Glyph::new(0x016E, 0x3BF3, 24, 22, 31, 2, -1),
+    Glyph::new(0x016F, 0x3C66, 19, 17, 26, 1, -1),
+    Glyph::new(0x0170, 0x3CC7, 24, 22, 31, 2, -1),
+    Glyph::new(0x0171, 0x3D3D, 19, 17, 26, 1, -1),
+    Glyph::new(0x0178, 0x3D9E, 20, 21, 28, 1, 0),
+    Glyph::new(0x0179, 0x3DF7, 18, 19, 30, -1, -1),
+    Glyph::new(0x017A, 0x3E4F, 15, 14, 26, 0, -1),
+    Glyph::new(0x017B, 0x3E93, 18, 19, 29, -1, -1),
+    Glyph::new(0x017C, 0x3EE8, 15, 14, 24, 0, -1),
+    Glyph::new(0x017D, 0x3F29, 18, 19, 30, -1, -1),
+    Glyph::new(0x017E, 0x3F87, 15, 15, 26, 0, -1),
+    Glyph::new(0x03C0, 0x3FD1, 18, 18, 17, 0, -1),
+    Glyph::new(0x1E9E, 0x4014, 22, 22, 23, -2, -1),
+    Glyph::new(0x2013, 0x4070, 15, 15, 3, 0, 6),
+    Glyph::new(0x2014, 0x4081, 30, 30, 3, 0, 6),
+    Glyph::new(0x2018, 0x40A1, 10, 7, 10, 2, 13),
+    Glyph::new(0x2019, 0x40B1, 10, 6, 10, 2, 13),
+    Glyph::new(0x201A, 0x40C3, 10, 6, 10, 1, -6),
+    Glyph::new(0x201B, 0x40D3, 8, 6, 10, 1, 13),
+    Glyph::new(0x201C, 0x40E5, 16, 13, 10, 2, 13),
+    Glyph::new(0x201D, 0x4105, 16, 12, 10, 2, 13),
+    Glyph::new(0x201E, 0x4124, 16, 12, 10, 1, -6),
+    Glyph::new(0x201F, 0x4143, 14, 12, 10, 1, 13),
+    Glyph::new(0x2020, 0x4165, 15, 13, 20, 1, 2),
+    Glyph::new(0x2021, 0x4196, 15, 14, 24, 0, -2),
+    Glyph::new(0x2022, 0x41D7, 9, 7, 7, 1, 4),
+    Glyph::new(0x2026, 0x41E4, 30, 25, 5, 2, -1),
+    Glyph::new(0x2039, 0x41FE, 10, 8, 12, 1, 2),
+    Glyph::new(0x203A, 0x4213, 10, 9, 12, 0, 2),
+    Glyph::new(0x2070, 0x4229, 14, 12, 15, 1, 10),
+    Glyph::new(0x2074, 0x4255, 14, 13, 14, 0, 11),
+    Glyph::new(0x2075, 0x427C, 14, 12, 15, 1, 10),
+    Glyph::new(0x2076, 0x42A1, 14, 11, 15, 2, 10),
+    Glyph::new(0x2077, 0x42C9, 14, 10, 15, 3, 10),
+    Glyph::new(0x2078, 0x42EB, 14, 11, 15, 1, 10),
+    Glyph::new(0x2079, 0x4317, 14, 12, 15, 0, 10),
+    Glyph::new(0x2080, 0x4341, 14, 12, 15, 1, -5),
+    Glyph::new(0x2081, 0x436D, 14, 9, 14, 2, -4),
+    Glyph::new(0x2082, 0x4388, 14, 11, 14, 1, -4),
+    Glyph::new(0x2083, 0x43AB, 14, 11, 15, 1, -5),
+    Glyph::new(0x2084, 0x43D4, 14, 13, 14, 0, -4),
+    Glyph::new(0x2085, 0x43FB, 14, 12, 15, 1, -5),
+    Glyph::new(0x2086, 0x441D, 14, 11, 15, 2, -5),
+    Glyph::new(0x2087, 0x4446, 14, 10, 15, 3, -5),
+    Glyph::new(0x2088, 0x4468, 14, 11, 15, 1, -5),
+    Glyph::new(0x2089, 0x4493, 14, 12, 15, 0, -5),
+    Glyph::new(0x20AC, 0x44BB, 19, 21, 22, -1, -1),
+    Glyph::new(0x2122, 0x4504, 22, 21, 11, 2, 10),
+    Glyph::new(0x2153, 0x454D, 33, 28, 24, 2, -2),
+    Glyph::new(0x2154, 0x45C2, 33, 29, 24, 1, -2),
+    Glyph::new(0x215B, 0x463F, 33, 29, 24, 2, -2),
+    Glyph::new(0x215C, 0x46BA, 33, 30, 24, 1, -2),
+    Glyph::new(0x215D, 0x473B, 33, 30, 24, 1, -2),
+    Glyph::new(0x215E, 0x47BB, 33, 28, 24, 3, -2),
+    Glyph::new(0x2190, 0x483C, 30, 18, 13, 6, 4),
+    Glyph::new(0x2191, 0x4863, 30, 12, 20, 9, 0),
+    Glyph::new(0x2192, 0x488D, 30, 18, 13, 6, 4),
+    Glyph::new(0x2193, 0x48B4, 30, 12, 20, 9, 0),
+    Glyph::new(0x2194, 0x48DC, 30, 18, 13, 6, 4),
+    Glyph::new(0x2195, 0x4911, 30, 12, 21, 9, 0),
+    Glyph::new(0x21D0, 0x4947, 30, 18, 14, 6, 3),
+    Glyph::new(0x21D1, 0x497D, 30, 14, 18, 8, 1),
+    Glyph::new(0x21D2, 0x49A7, 30, 18, 14, 6, 3),
+    Glyph::new(0x21D3, 0x49DD, 30, 14, 18, 8, 1),
+    Glyph::new(0x21D4, 0x4A08, 30, 18, 14, 6, 3),
+    Glyph::new(0x2202, 0x4A46, 19, 15, 25, 2, -1),
+    Glyph::new(0x2206, 0x4A91, 20, 19, 22, 0, 0),
+    Glyph::new(0x220F, 0x4ADB, 25, 23, 26, 1, -5),
+    Glyph::new(0x2211, 0x4B41, 19, 18, 26, 0, -5),
+    Glyph::new(0x221A, 0x4B96, 19, 19, 29, 0, -4),
+    Glyph::new(0x221E, 0x4BE4, 19, 19, 11, 0, 4),
+    Glyph::new(0x222B, 0x4C1A, 19, 16, 31, 1, -7),
+    Glyph::new(0x2260, 0x4C58, 19, 13, 14, 3, 3),
+    Glyph::new(0x2264, 0x4C7E, 19, 13, 18, 3, 0),
+    Glyph::new(0x2265, 0x4CA6, 19, 13, 18, 3, 0),
+    Glyph::new(0xFB01, 0x4CCC, 23, 28, 32, -5, -8),
+    Glyph::new(0xFB02, 0x4D44, 23, 27, 32, -5, -8),
 ];
 
-const BITMAP_BW: &[u8; 13573] = include_bytes!("./bookerly_italic_30.bw");
-const BITMAP_MSB: &[u8; 13573] = include_bytes!("./bookerly_italic_30.msb");
-const BITMAP_LSB: &[u8; 13573] = include_bytes!("./bookerly_italic_30.lsb");
+const GLYPH_PAGES: [u16; 252] = [
+    0, 1, u16::MAX, 2, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 3, u16::MAX,
+    4, 5, 6, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX,
+    u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, u16::MAX, 7,
+];
+
+const GLYPH_BLOCKS: [GlyphBlock; 32] = [
+    GlyphBlock::new(0, 0xFFFFFFFF00000000),
+    GlyphBlock::new(32, 0x7FFFFFFFFFFFFFFF),
+    GlyphBlock::new(95, 0xFEEF4EBE00000000),
+    GlyphBlock::new(119, 0xDFFFFFFFDFFFFFFF),
+    GlyphBlock::new(181, 0x660000000F00F0F0),
+    GlyphBlock::new(197, 0x7F03C0330F0C019E),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(224, 0x0000000000000001),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(225, 0x0000000040000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(226, 0x06000047FF180000),
+    GlyphBlock::new(242, 0x03F1000000000000),
+    GlyphBlock::new(249, 0x00001000000003FF),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(260, 0x0000000400000000),
+    GlyphBlock::new(261, 0x0000000078180000),
+    GlyphBlock::new(267, 0x00000000003F0000),
+    GlyphBlock::new(273, 0x00000000001F0000),
+    GlyphBlock::new(278, 0x0000080044028044),
+    GlyphBlock::new(285, 0x0000003100000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(288, 0x0000000000000006),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+    GlyphBlock::new(0, 0x0000000000000000),
+];
+
+const KERNING_CLASSES: [(u8, u8); 290] = [
+    (0, 0), (1, 1), (2, 2), (0, 0), (0, 0), (0, 0), (0, 0), (3, 2),
+    (4, 3), (5, 4), (0, 0), (0, 0), (6, 5), (7, 6), (8, 7), (9, 8),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (10, 9), (11, 10), (0, 0), (0, 0), (0, 0), (12, 11),
+    (0, 0), (13, 12), (14, 13), (15, 14), (16, 13), (17, 15), (18, 15), (19, 14),
+    (20, 15), (20, 15), (21, 16), (22, 15), (23, 15), (24, 15), (25, 17), (26, 14),
+    (27, 13), (28, 14), (29, 13), (30, 18), (31, 19), (32, 20), (33, 21), (34, 22),
+    (35, 23), (36, 24), (37, 25), (38, 26), (0, 0), (39, 27), (0, 0), (0, 0),
+    (0, 0), (40, 28), (41, 29), (42, 30), (43, 28), (44, 31), (45, 32), (46, 33),
+    (47, 29), (48, 34), (49, 35), (50, 36), (51, 37), (52, 38), (53, 38), (54, 30),
+    (55, 39), (56, 28), (57, 38), (58, 40), (59, 41), (53, 38), (60, 42), (61, 42),
+    (62, 43), (63, 44), (64, 45), (65, 46), (0, 0), (66, 47), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (67, 48), (68, 49),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (69, 50), (0, 0), (0, 0),
+    (0, 0), (70, 51), (71, 52), (0, 0), (0, 0), (0, 0), (0, 0), (13, 12),
+    (13, 12), (13, 12), (13, 12), (13, 12), (13, 12), (72, 12), (73, 14), (17, 15),
+    (17, 15), (17, 15), (17, 15), (20, 15), (74, 15), (75, 53), (76, 53), (16, 25),
+    (25, 17), (26, 14), (26, 14), (26, 54), (26, 14), (26, 14), (0, 0), (77, 55),
+    (32, 20), (32, 20), (32, 20), (32, 20), (78, 13), (79, 56), (40, 57), (40, 28),
+    (80, 58), (81, 59), (82, 59), (80, 57), (44, 28), (83, 30), (84, 60), (85, 31),
+    (86, 61), (87, 62), (88, 63), (89, 64), (90, 65), (90, 66), (91, 67), (92, 64),
+    (54, 68), (93, 30), (94, 69), (95, 68), (95, 70), (0, 0), (96, 71), (53, 64),
+    (53, 38), (97, 38), (92, 64), (41, 72), (98, 73), (99, 12), (100, 28), (15, 14),
+    (101, 30), (15, 14), (102, 74), (16, 13), (103, 28), (104, 15), (105, 31), (17, 15),
+    (85, 60), (23, 15), (51, 37), (106, 15), (107, 37), (23, 75), (108, 76), (25, 17),
+    (53, 38), (25, 17), (109, 64), (72, 14), (110, 30), (29, 13), (111, 77), (30, 18),
+    (112, 78), (30, 18), (113, 79), (31, 19), (114, 41), (32, 20), (97, 80), (32, 20),
+    (115, 80), (36, 24), (37, 25), (64, 45), (37, 25), (64, 45), (37, 25), (116, 81),
+    (117, 82), (118, 83), (119, 84), (119, 84), (120, 85), (121, 86), (122, 87), (0, 0),
+    (120, 85), (123, 88), (122, 87), (0, 0), (0, 0), (0, 0), (0, 0), (124, 89),
+    (68, 49), (71, 52), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0), (0, 0),
+    (48, 32), (51, 32),
+];
+
+const KERNING: [&[i8]; 125] = [
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, -1, 0, 0, 0, 0, -2, -2, -2, 0, -2, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, -2, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -1, -1, 0, 0, 0, 0, -1, -2, -2, -2, -2, 0, 0, -2, -1, 0, 0, -1, -1, 0, 0, -1, -2, 0, -1, 0, 0, -1, 0],
+    &[0, -1, 0, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, -2, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -1, -1, -1, 0, 0, -1, -2, -2, -2, -2, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, -2, 0, 0, -2, -2, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, -2, -1, -1, -1, 0, -1, -1, 0, -1, -2, 0, -1, -2, 0, -1, -1, 0, -1, -2, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, -1, -2, 0, 0, 0, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, 0, 0, 0, 0, -2, -2, -2, -2, 0, -2, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, -2, 0, -1, 0, -1, -1, 0, -2, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, -1, 0, -2, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -2, -2, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, 0, -1, -1, -2, 0, 0, -1, 0, -1, 0, 0, -2, -2, -2, -2, 0, -2, 0, 0, -2, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, -2, 0, -2, 0, -1, -2, 0, -2, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -2, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, -1, -1, 0, 0, -1, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, -2, -2, 0, -2, 0, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, -1, 0, 0, -2, -2, -2, -1, -2, 0, 0, -1, 0, 0, -1, -2, -1, -1, -1, -1, -2, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -2, -1, -2, -2, -1, -2, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, 0, -1, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -2, 0, -2],
+    &[0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -2, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, -1, -1],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -2, -1, -2],
+    &[0, -1, 0, 0, 0, -2, -1, -2, -2, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -2, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, -1, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -1, -2, -1],
+    &[0, -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1],
+    &[0, 0, 0, -1, 0, -2, -1, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -1, -1, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -2, -1, -1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -2, -1, -2, -2, -1, -1, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, -2, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -2, -2, -2, -2, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, 0, -2, 0, 0, 0, -1, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -2, -1, -1, -2, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -2, -1, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, 0, -1, -2, -1, -2, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1, -2, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, 0, 0, -1, 0, -1, -1, -1, 0, -2, -2, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -2, -2, 0, 0, -2, 0, -2],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, -2, -1, -1, -1, -2, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -2, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, -1, 0, -2, -2, -2, -2, -2, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -2, -1, -2, 0, 0, 0, 0, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, 0, -2, -2, 0, -2, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -2, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, -2, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -1],
+    &[0, -1, -1, -1, 0, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -2, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -2, -1, -1, -1, -1, -1, -2, 0, -1, -1, 0, -2, -2, -2, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -2, -2, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0],
+    &[0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -2, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2],
+    &[0, 0, 0, 0, -2, -2, -1, -2, -2, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, -1, -2, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -2, -2, -1, -2, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -2, 0, -2, -2, -1, -2, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, -2, -2, -1, -2, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, -1, -1, 0, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, 0, -1, -2, 0, -1, -1, -1, -2, -2, 0, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, -1, 0, -2],
+    &[0, -1, 0, 0, -1, -2, 0, -2, -1, -2, -2, -1, 0, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -2, -1, -2],
+    &[0, -1, 0, 0, -1, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -2, -1, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, -1, 0, 0, -2, 0, 0, 0, -2, -2, -2, -1, -2, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -2, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -1, -1, -1, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0],
+    &[0, -1, -2, 0, -2, -2, 0, -2, -1, -2, -2, -1, -1, -1, 0, -1, -1, -1, 0, -2, -1, -2, -2, -1, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -2, 0, -2, -2, -2],
+    &[0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, -1, -1],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -2, 0, -2, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -2, 0, -2, -2, -1, -1, -1, -1, -1, 0, -1, -1, -1, 0, -1, 0, -1, -1, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2],
+    &[0, 0, 0, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2],
+    &[0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, -1, 0, 0, -1, -2, 0, -2, -2, -1, -2, -1, -1, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -2, 0, -2],
+    &[0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1],
+    &[0, 0, 0, -1, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, -2, -1, -2, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0],
+    &[0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1],
+    &[0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1],
+    &[0, -1, -1, 0, -2, -1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0, -1, -2, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -2, -1, -2, -1],
+    &[0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0],
+    &[0, -2, -1, -1, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -2, -2, -1, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, 0, 0, -1, 0, -1, -2, -2, -1, -2, -2, -1, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -2, -2, -2, -2, -2, 0, 0, -2, -1, -1, -1, -2, -2, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -2, -1, -2, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -2, -2, -1, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -2, -2, -1, 0, -2, -1, 0, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, -1, -2, -2, -2, -2, -2, 0, -1, -2, -1, -1, -1, -2, -2, -1, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+    &[0, -2, -1, -2, -1, 0, 0, 0, -2, -2, -2, -1, -2, -1, -2, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, -1, -1, -2, -2, -1, -2, -2, -1, -2, -1, -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -2, -2, -1, -2, -2, -1, -2, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, 0, -1, -2, -2, -2, -2, -2, 0, -1, -2, -1, -1, -1, -2, -2, -1, -1, -2, -2, 0, -1, -1, 0, -1, 0],
+    &[0, -1, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, -2, 0, -2, 0, -1, -2, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1],
+];
+
+const BITMAP: &[u8; 19902] = include_bytes!("./bookerly_italic_30.rle");
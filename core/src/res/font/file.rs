@@ -0,0 +1,561 @@
+//! Fonts installed on the SD card.
+//!
+//! `fontgen --sd-card` writes each size and style of a family in this
+//! format, and [`install`] loads the files of a directory at startup. The
+//! glyph and kerning tables are read into RAM once, bitmaps stay on the
+//! card and are paged in through a small LRU as glyphs are drawn, so large
+//! glyph sets don't have to be compiled into the firmware.
+
+use alloc::{boxed::Box, collections::BTreeMap, string::String, vec::Vec};
+use core::cell::RefCell;
+use core::ptr;
+use core::sync::atomic::{AtomicPtr, Ordering};
+use embedded_io::SeekFrom;
+use log::{info, warn};
+
+use super::{FontDefinition, FontFamily, FontSize, FontStyle, Glyph, GlyphBlock, GlyphId, build_glyph_index};
+use crate::fs::{DirEntry, Directory, File, Filesystem, Mode};
+
+const FONT_FILE_MAGIC: &[u8; 4] = b"TFN1";
+const GLYPH_SIZE: usize = 12;
+const COUNTS_SIZE: usize = 20;
+
+/// Bytes per bitmap page.
+pub const PAGE_SIZE: usize = 512;
+
+/// Bitmap pages each installed font keeps in RAM.
+const CACHED_PAGES: usize = 4;
+
+/// Families that can be installed at once.
+const MAX_FAMILIES: usize = 4;
+
+/// Extension of font files, matched without case.
+const EXTENSION: &str = ".tfn";
+
+/// Where a font's bitmap is read from when it isn't resident.
+pub trait BitmapPages {
+    /// Fill `buf` from `offset` in the bitmap.
+    fn read(&self, offset: u32, buf: &mut [u8]) -> Option<()>;
+}
+
+impl FontDefinition<'_> {
+    /// Write as `style` of `family` at `size` pixels, in the format read by
+    /// [`FontFile`].
+    ///
+    /// Layout, little endian:
+    /// - magic, style, size and y advance (u8 each)
+    /// - family name as length (u8) and UTF-8
+    /// - glyph count, kerning class count, left classes, right classes and
+    ///   bitmap size (u32 each)
+    /// - glyphs: codepoint, bitmap index and metrics blob (u32 each)
+    /// - kerning classes as left and right (u8 each)
+    /// - kerning table by left class, then right class (i8 each)
+    /// - bitmap
+    pub fn to_file(&self, family: &str, style: FontStyle, size: u8, writer: &mut impl embedded_io::Write) -> Option<()> {
+        let name_len = u8::try_from(family.len()).ok()?;
+        let right_classes = self.kerning.first().map_or(0, |row| row.len());
+        if self.kerning.iter().any(|row| row.len() != right_classes) {
+            return None;
+        }
+        writer.write_all(FONT_FILE_MAGIC).ok()?;
+        writer.write_all(&[style as u8, size, self.y_advance, name_len]).ok()?;
+        writer.write_all(family.as_bytes()).ok()?;
+        let counts = [
+            self.glyphs.len(),
+            self.kerning_classes.len(),
+            self.kerning.len(),
+            right_classes,
+            self.bitmap.len(),
+        ];
+        for count in counts {
+            writer.write_all(&(count as u32).to_le_bytes()).ok()?;
+        }
+        for glyph in self.glyphs {
+            writer.write_all(&glyph.codepoint.to_le_bytes()).ok()?;
+            writer.write_all(&glyph.bitmap_index.to_le_bytes()).ok()?;
+            writer.write_all(&glyph.blob.to_le_bytes()).ok()?;
+        }
+        for &(left, right) in self.kerning_classes {
+            writer.write_all(&[left, right]).ok()?;
+        }
+        for row in self.kerning {
+            for &adjust in *row {
+                writer.write_all(&adjust.to_le_bytes()).ok()?;
+            }
+        }
+        writer.write_all(self.bitmap).ok()?;
+
+        Some(())
+    }
+}
+
+/// A font file whose header has been read.
+pub struct FontFile<F> {
+    pub family: String,
+    pub style: FontStyle,
+    pub size: FontSize,
+    y_advance: u8,
+    file: F,
+}
+
+/// The tables of a font file, read but not yet installed.
+struct Tables {
+    glyphs: Vec<Glyph>,
+    glyph_pages: Vec<u16>,
+    glyph_blocks: Vec<GlyphBlock>,
+    kerning_classes: Vec<(u8, u8)>,
+    kerning: Vec<i8>,
+    right_classes: usize,
+    bitmap_size: u32,
+    /// Offset of the bitmap in the file.
+    base: u32,
+}
+
+impl<F: File> FontFile<F> {
+    /// Read the header of `file`. Fails for other files and sizes the
+    /// reader can't use.
+    pub fn open(mut file: F) -> Option<Self> {
+        let mut head = [0u8; 8];
+        file.read_exact(&mut head).ok()?;
+        if head[..4] != FONT_FILE_MAGIC[..] {
+            return None;
+        }
+        let style = match head[4] {
+            0 => FontStyle::Regular,
+            1 => FontStyle::Bold,
+            2 => FontStyle::Italic,
+            3 => FontStyle::BoldItalic,
+            _ => return None,
+        };
+        let size = FontSize::from_px(head[5] as u32)?;
+        let mut name = alloc::vec![0u8; head[7] as usize];
+        file.read_exact(&mut name).ok()?;
+        let family = String::from_utf8(name).ok()?;
+        Some(Self { family, style, size, y_advance: head[6], file })
+    }
+
+    fn read_tables(&mut self) -> Option<Tables> {
+        let mut counts = [0u8; COUNTS_SIZE];
+        self.file.read_exact(&mut counts).ok()?;
+        let count = |at: usize| u32::from_le_bytes([counts[at], counts[at + 1], counts[at + 2], counts[at + 3]]) as usize;
+        let (glyph_count, class_count, left_classes, right_classes, bitmap_size) =
+            (count(0), count(4), count(8), count(12), count(16));
+        if glyph_count >= GlyphId::JOINED.0 as usize
+            || (class_count != 0 && class_count != glyph_count)
+            || left_classes > u8::MAX as usize + 1
+            || right_classes > u8::MAX as usize + 1
+        {
+            return None;
+        }
+        let base = 8 + self.family.len() + COUNTS_SIZE;
+        let tables = glyph_count * GLYPH_SIZE + class_count * 2 + left_classes * right_classes;
+        if base + tables + bitmap_size > self.file.size() {
+            return None;
+        }
+
+        let mut data = alloc::vec![0u8; tables];
+        self.file.read_exact(&mut data).ok()?;
+        let (glyph_data, rest) = data.split_at(glyph_count * GLYPH_SIZE);
+        let (class_data, kerning_data) = rest.split_at(class_count * 2);
+        let word = |bytes: &[u8], at: usize| u32::from_le_bytes([bytes[at], bytes[at + 1], bytes[at + 2], bytes[at + 3]]);
+        let glyphs: Vec<Glyph> = glyph_data
+            .chunks_exact(GLYPH_SIZE)
+            .map(|glyph| Glyph {
+                codepoint: word(glyph, 0),
+                bitmap_index: word(glyph, 4),
+                blob: word(glyph, 8),
+            })
+            .collect();
+        if glyphs.iter().any(|glyph| glyph.bitmap_index as usize > bitmap_size) {
+            return None;
+        }
+        let (glyph_pages, glyph_blocks) = build_glyph_index(&glyphs)?;
+
+        Some(Tables {
+            glyphs,
+            glyph_pages,
+            glyph_blocks,
+            kerning_classes: class_data.chunks_exact(2).map(|class| (class[0], class[1])).collect(),
+            kerning: kerning_data.iter().map(|&adjust| adjust as i8).collect(),
+            right_classes,
+            bitmap_size: bitmap_size as u32,
+            base: (base + tables) as u32,
+        })
+    }
+}
+
+impl<F: File + 'static> FontFile<F> {
+    /// Keep the tables for good and page the bitmap in from the file.
+    fn install(self, tables: Tables) -> &'static FontDefinition<'static> {
+        let kerning: &'static [i8] = Box::leak(tables.kerning.into_boxed_slice());
+        let rows: Vec<&'static [i8]> = match tables.right_classes {
+            0 => Vec::new(),
+            right => kerning.chunks_exact(right).collect(),
+        };
+        let pages = PagedBitmap(RefCell::new(PageCache::new(self.file, tables.base, CACHED_PAGES)));
+        Box::leak(Box::new(FontDefinition {
+            size: tables.bitmap_size,
+            y_advance: self.y_advance,
+            glyphs: Box::leak(tables.glyphs.into_boxed_slice()),
+            glyph_pages: Box::leak(tables.glyph_pages.into_boxed_slice()),
+            glyph_blocks: Box::leak(tables.glyph_blocks.into_boxed_slice()),
+            kerning_classes: Box::leak(tables.kerning_classes.into_boxed_slice()),
+            kerning: Box::leak(rows.into_boxed_slice()),
+            bitmap: &[],
+            pages: Some(Box::leak(Box::new(pages))),
+        }))
+    }
+}
+
+/// A family loaded from font files.
+pub struct InstalledFamily {
+    pub name: &'static str,
+    /// By size, then style. Styles without files use the regular font.
+    fonts: [[&'static FontDefinition<'static>; 4]; 3],
+}
+
+impl InstalledFamily {
+    pub fn definition(&self, size: FontSize, style: FontStyle) -> &'static FontDefinition<'static> {
+        self.fonts[size.index()][style as usize]
+    }
+}
+
+/// Installed families are never removed, so lookups can hand out static
+/// references. Only installed from the main task.
+static INSTALLED: [AtomicPtr<InstalledFamily>; MAX_FAMILIES] = [const { AtomicPtr::new(ptr::null_mut()) }; MAX_FAMILIES];
+
+/// The family installed in `slot`.
+pub fn installed(slot: u8) -> Option<&'static InstalledFamily> {
+    let family = INSTALLED.get(slot as usize)?.load(Ordering::Acquire);
+    unsafe { family.as_ref() }
+}
+
+/// Families installed so far, in the order they were installed.
+pub fn installed_families() -> impl Iterator<Item = FontFamily> {
+    (0..MAX_FAMILIES as u8).filter(|&slot| installed(slot).is_some()).map(FontFamily::Installed)
+}
+
+/// Install the font files in `path`, returning how many families were
+/// added. Families already installed are skipped.
+pub fn install<Fs>(filesystem: &Fs, path: &str) -> usize
+where
+    Fs: Filesystem,
+    Fs::File: 'static,
+{
+    let Ok(dir) = filesystem.open_directory(path) else {
+        return 0;
+    };
+    let Ok(entries) = dir.list() else {
+        return 0;
+    };
+    let mut families: BTreeMap<String, Vec<FontFile<Fs::File>>> = BTreeMap::new();
+    for entry in &entries {
+        let name = entry.name();
+        let is_font = name.len() > EXTENSION.len()
+            && name.get(name.len() - EXTENSION.len()..).is_some_and(|ext| ext.eq_ignore_ascii_case(EXTENSION));
+        if entry.is_directory() || !is_font {
+            continue;
+        }
+        let Some(font) = filesystem
+            .open_file_entry(&dir, entry, Mode::Read)
+            .ok()
+            .and_then(FontFile::open)
+        else {
+            warn!("Not a usable font file: {}", name);
+            continue;
+        };
+        families.entry(font.family.clone()).or_default().push(font);
+    }
+
+    let mut added = 0;
+    for (name, files) in families {
+        if installed_families().any(|family| family.repr() == name) {
+            continue;
+        }
+        if install_family(files).is_some() {
+            added += 1;
+        }
+    }
+    added
+}
+
+/// Install the fonts of one family.
+///
+/// Glyphs are resolved once per chapter and laid out at every size of the
+/// style, so a style is only installed with all sizes and the same glyph
+/// set in each. The regular style is required, and needs the space and
+/// hyphen layout measures with.
+pub fn install_family<F: File + 'static>(files: Vec<FontFile<F>>) -> Option<FontFamily> {
+    let name = files.first()?.family.clone();
+    let Some(slot) = INSTALLED.iter().position(|slot| slot.load(Ordering::Relaxed).is_null()) else {
+        warn!("No room to install font family {}", name);
+        return None;
+    };
+
+    let mut grid: [[Option<(FontFile<F>, Tables)>; 4]; 3] = Default::default();
+    for mut file in files {
+        let cell = &mut grid[file.size.index()][file.style as usize];
+        if file.family != name || cell.is_some() {
+            continue;
+        }
+        match file.read_tables() {
+            Some(tables) => *cell = Some((file, tables)),
+            None => warn!("Damaged font file for {} {:?} {}", name, file.style, file.size.repr()),
+        }
+    }
+
+    let mut complete = [false; 4];
+    for style in [FontStyle::Regular, FontStyle::Bold, FontStyle::Italic, FontStyle::BoldItalic] {
+        let sizes: Option<Vec<&Tables>> = grid
+            .iter()
+            .map(|styles| styles[style as usize].as_ref().map(|(_, tables)| tables))
+            .collect();
+        let Some(sizes) = sizes else {
+            continue;
+        };
+        let same_glyphs = sizes.windows(2).all(|pair| {
+            pair[0].glyphs.len() == pair[1].glyphs.len()
+                && pair[0].glyphs.iter().zip(&pair[1].glyphs).all(|(a, b)| a.codepoint == b.codepoint)
+        });
+        let measurable = style != FontStyle::Regular
+            || sizes.iter().all(|tables| {
+                [' ', '-'].iter().all(|&ch| tables.glyphs.iter().any(|glyph| glyph.codepoint == ch as u32))
+            });
+        complete[style as usize] = same_glyphs && measurable;
+        if !complete[style as usize] {
+            warn!("Glyphs of {} {:?} differ between sizes", name, style);
+        }
+    }
+    if !complete[FontStyle::Regular as usize] {
+        warn!("Font family {} has no complete regular style", name);
+        return None;
+    }
+
+    let fonts = grid.map(|styles| {
+        let mut fonts = styles
+            .into_iter()
+            .enumerate()
+            .map(|(style, font)| font.filter(|_| complete[style]).map(|(file, tables)| file.install(tables)));
+        let regular = fonts.next().flatten().unwrap();
+        let mut row = [regular; 4];
+        for (style, font) in fonts.enumerate() {
+            row[style + 1] = font.unwrap_or(regular);
+        }
+        row
+    });
+    let name: &'static str = Box::leak(name.into_boxed_str());
+    info!("Installed font family {}", name);
+    INSTALLED[slot].store(Box::leak(Box::new(InstalledFamily { name, fonts })), Ordering::Release);
+    Some(FontFamily::Installed(slot as u8))
+}
+
+/// The page cache of an installed font. Fonts are only drawn from the main
+/// task.
+struct PagedBitmap<F>(RefCell<PageCache<F>>);
+
+impl<F: File> BitmapPages for PagedBitmap<F> {
+    fn read(&self, offset: u32, buf: &mut [u8]) -> Option<()> {
+        self.0.try_borrow_mut().ok()?.read(offset, buf)
+    }
+}
+
+/// Least recently used cache of fixed size pages of a file region.
+struct PageCache<F> {
+    file: F,
+    base: u32,
+    capacity: usize,
+    clock: u32,
+    pages: Vec<Page>,
+}
+
+struct Page {
+    index: u32,
+    last_used: u32,
+    data: Box<[u8; PAGE_SIZE]>,
+}
+
+impl<F: File> PageCache<F> {
+    fn new(file: F, base: u32, capacity: usize) -> Self {
+        Self {
+            file,
+            base,
+            capacity: capacity.max(1),
+            clock: 0,
+            pages: Vec::new(),
+        }
+    }
+
+    /// Fill `buf` from `offset` in the region.
+    fn read(&mut self, offset: u32, buf: &mut [u8]) -> Option<()> {
+        let mut done = 0;
+        while done < buf.len() {
+            let position = offset as usize + done;
+            let start = position % PAGE_SIZE;
+            let len = (PAGE_SIZE - start).min(buf.len() - done);
+            let page = self.page((position / PAGE_SIZE) as u32)?;
+            buf[done..done + len].copy_from_slice(&page[start..start + len]);
+            done += len;
+        }
+        Some(())
+    }
+
+    fn page(&mut self, index: u32) -> Option<&[u8; PAGE_SIZE]> {
+        self.clock = self.clock.wrapping_add(1);
+        let slot = match self.pages.iter().position(|page| page.index == index) {
+            Some(slot) => slot,
+            None => {
+                let slot = if self.pages.len() < self.capacity {
+                    self.pages.push(Page {
+                        index,
+                        last_used: 0,
+                        data: Box::new([0u8; PAGE_SIZE]),
+                    });
+                    self.pages.len() - 1
+                } else {
+                    self.pages
+                        .iter()
+                        .enumerate()
+                        .min_by_key(|(_, page)| page.last_used)
+                        .map(|(slot, _)| slot)?
+                };
+                let page = &mut self.pages[slot];
+                page.index = u32::MAX;
+                self.file
+                    .seek(SeekFrom::Start(self.base as u64 + index as u64 * PAGE_SIZE as u64))
+                    .ok()?;
+                // The last page may be short
+                let mut filled = 0;
+                while filled < PAGE_SIZE {
+                    match self.file.read(&mut page.data[filled..]) {
+                        Ok(0) => break,
+                        Ok(n) => filled += n,
+                        Err(_) => return None,
+                    }
+                }
+                page.data[filled..].fill(0);
+                page.index = index;
+                slot
+            }
+        };
+        let page = &mut self.pages[slot];
+        page.last_used = self.clock;
+        Some(&page.data)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use alloc::{boxed::Box, rc::Rc, string::ToString, vec::Vec};
+    use core::cell::Cell;
+    use embedded_io::{ErrorType, Read, Seek, SeekFrom, Write};
+
+    use super::*;
+    use crate::framebuffer::DisplayBuffers;
+    use crate::res::font::{Font, Glyphs, Mode, Palette, Resolved, draw_shaped};
+
+    struct MemFile {
+        data: Rc<Vec<u8>>,
+        position: usize,
+        reads: Rc<Cell<usize>>,
+    }
+
+    impl ErrorType for MemFile {
+        type Error = embedded_io::ErrorKind;
+    }
+    impl Read for MemFile {
+        fn read(&mut self, buf: &mut [u8]) -> Result<usize, Self::Error> {
+            self.reads.set(self.reads.get() + 1);
+            let n = buf.len().min(self.data.len().saturating_sub(self.position));
+            buf[..n].copy_from_slice(&self.data[self.position..self.position + n]);
+            self.position += n;
+            Ok(n)
+        }
+    }
+    impl Write for MemFile {
+        fn write(&mut self, _: &[u8]) -> Result<usize, Self::Error> {
+            Err(embedded_io::ErrorKind::Unsupported)
+        }
+    }
+    impl Seek for MemFile {
+        fn seek(&mut self, pos: SeekFrom) -> Result<u64, Self::Error> {
+            let SeekFrom::Start(pos) = pos else { return Err(embedded_io::ErrorKind::Unsupported); };
+            self.position = pos as usize;
+            Ok(pos)
+        }
+    }
+    impl crate::fs::File for MemFile {
+        fn size(&self) -> usize {
+            self.data.len()
+        }
+    }
+
+    /// Bookerly's `styles` in all sizes, written as font files of `family`.
+    fn font_files(family: &str, styles: &[FontStyle], reads: &Rc<Cell<usize>>) -> Vec<FontFile<MemFile>> {
+        let mut files = Vec::new();
+        for size in FontSize::ALL {
+            for &style in styles {
+                let mut data = Vec::new();
+                Font::bookerly(size).definition(style).to_file(family, style, size.px() as u8, &mut data).unwrap();
+                let file = MemFile { data: Rc::new(data), position: 0, reads: reads.clone() };
+                files.push(FontFile::open(file).unwrap());
+            }
+        }
+        files
+    }
+
+    #[test]
+    fn installed_font_draws_like_builtin() {
+        let reads = Rc::new(Cell::new(0));
+        let files = font_files("Testerly", &[FontStyle::Regular, FontStyle::Italic], &reads);
+        let family = install_family(files).unwrap();
+        assert_eq!(family.repr(), "Testerly");
+        assert!(installed_families().any(|installed| installed == family));
+
+        let text = "Trusty office fjord, caf\u{e9} \u{2014} \u{263A}";
+        for style in [FontStyle::Regular, FontStyle::Italic, FontStyle::Bold] {
+            let builtin = Font::bookerly(FontSize::Size28);
+            let font = Font::new(family, FontSize::Size28);
+            // Bold isn't installed and falls back to regular
+            let reference = if style == FontStyle::Bold { FontStyle::Regular } else { style };
+            let (mut palette, mut reference_palette) = (Palette::default(), Palette::default());
+            let (Resolved::Palette(glyphs), Resolved::Palette(reference_glyphs)) = (
+                palette.resolve(font, style, text.to_string(), |_| false),
+                reference_palette.resolve(builtin, reference, text.to_string(), |_| false),
+            ) else {
+                panic!("Palette overflow");
+            };
+            let (glyphs, reference_glyphs) = (Glyphs::Palette(&glyphs), Glyphs::Palette(&reference_glyphs));
+            assert_eq!(
+                font.width(style, glyphs, &palette),
+                builtin.width(reference, reference_glyphs, &reference_palette)
+            );
+
+            let mut expected = Box::new(DisplayBuffers::default());
+            let mut actual = Box::new(DisplayBuffers::default());
+            for mode in [Mode::Bw, Mode::Msb, Mode::Lsb] {
+                let placed = font.place(style, glyphs, &palette);
+                for (a, b) in builtin.place(reference, reference_glyphs, &reference_palette).zip(placed) {
+                    assert_eq!((a.codepoint, a.x), (b.codepoint, b.x));
+                    let x = 40 + a.x as isize;
+                    assert_eq!(draw_shaped(&a, &mut expected, x, 60, mode), draw_shaped(&b, &mut actual, x, 60, mode));
+                }
+            }
+            assert!(expected.get_active_buffer() == actual.get_active_buffer());
+
+            // Drawing glyphs again is served from the cache
+            for glyph in font.place(style, glyphs, &palette).take(2) {
+                draw_shaped(&glyph, &mut actual, 40, 60, Mode::Bw);
+            }
+            let warm = reads.get();
+            for glyph in font.place(style, glyphs, &palette).take(2) {
+                draw_shaped(&glyph, &mut actual, 40, 60, Mode::Bw);
+            }
+            assert_eq!(reads.get(), warm);
+        }
+
+        // A family without all regular sizes isn't installed
+        let mut files = font_files("Halferly", &[FontStyle::Regular], &reads);
+        files.pop();
+        assert!(install_family(files).is_none());
+    }
+}
@@ -1,3 +1,4 @@
+use alloc::{string::String, vec::Vec};
 use embedded_graphics::{pixelcolor::BinaryColor, prelude::OriginDimensions};
 use log::{trace, warn};
 
@@ -10,6 +11,8 @@ pub enum FontSize {
     Size30,
 }
 impl FontSize {
+    pub const ALL: [FontSize; 3] = [FontSize::Size26, FontSize::Size28, FontSize::Size30];
+
     pub fn repr(self) -> &'static str {
         match self {
             FontSize::Size26 => "26",
@@ -17,9 +20,35 @@ impl FontSize {
             FontSize::Size30 => "30",
         }
     }
+
+    fn px(self) -> u32 {
+        match self {
+            FontSize::Size26 => 26,
+            FontSize::Size28 => 28,
+            FontSize::Size30 => 30,
+        }
+    }
+
+    fn from_px(px: u32) -> Option<Self> {
+        Self::ALL.into_iter().find(|size| size.px() == px)
+    }
+
+    fn index(self) -> usize {
+        self as usize
+    }
+
+    /// The available size closest to `percent` of this one.
+    pub fn scaled(self, percent: u8) -> Self {
+        let target = self.px() * percent as u32 / 100;
+        Self::ALL
+            .into_iter()
+            .min_by_key(|size| size.px().abs_diff(target))
+            .unwrap()
+    }
 }
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(u8)]
 pub enum FontStyle {
     Regular,
     Bold,
@@ -30,15 +59,25 @@ pub enum FontStyle {
 #[derive(Clone, Copy, PartialEq, Eq)]
 pub enum FontFamily {
     Bookerly,
+    /// A family installed from the SD card, by its slot in [`file`].
+    Installed(u8),
 }
 impl FontFamily {
     pub fn repr(self) -> &'static str {
         match self {
             FontFamily::Bookerly => "Bookerly",
+            FontFamily::Installed(slot) => file::installed(slot).map_or("?", |family| family.name),
         }
     }
+
+    /// The built-in family followed by the installed ones.
+    pub fn all() -> impl Iterator<Item = FontFamily> {
+        core::iter::once(FontFamily::Bookerly).chain(file::installed_families())
+    }
 }
 
+pub mod file;
+
 pub mod bookerly_26;
 pub mod bookerly_28;
 pub mod bookerly_30;
@@ -64,10 +103,12 @@ impl Font {
     }
 
     pub fn y_advance(&self) -> u16 {
-        match self.size {
-            FontSize::Size26 => 30,
-            FontSize::Size28 => 32,
-            FontSize::Size30 => 34,
+        match (self.family, self.size) {
+            (FontFamily::Bookerly, FontSize::Size26) => 30,
+            (FontFamily::Bookerly, FontSize::Size28) => 32,
+            (FontFamily::Bookerly, FontSize::Size30) => 34,
+            // With the leading the built-in sizes get
+            (FontFamily::Installed(_), _) => self.definition(FontStyle::Regular).y_advance as u16 + 4,
         }
     }
 
@@ -78,73 +119,569 @@ impl Font {
 
 impl Font {
     pub fn definition(&self, style: FontStyle) -> &'static FontDefinition<'static> {
-        use FontFamily::*;
         use FontSize::*;
         use FontStyle::*;
-        match (&self.family, &self.size, &style) {
-            (Bookerly, Size26, Regular) => &bookerly_26::FONT,
-            (Bookerly, Size28, Regular) => &bookerly_28::FONT,
-            (Bookerly, Size30, Regular) => &bookerly_30::FONT,
-            (Bookerly, Size26, Bold) => &bookerly_bold_26::FONT,
-            (Bookerly, Size28, Bold) => &bookerly_bold_28::FONT,
-            (Bookerly, Size30, Bold) => &bookerly_bold_30::FONT,
-            (Bookerly, Size26, BoldItalic) => &bookerly_bold_italic_26::FONT,
-            (Bookerly, Size28, BoldItalic) => &bookerly_bold_italic_28::FONT,
-            (Bookerly, Size30, BoldItalic) => &bookerly_bold_italic_30::FONT,
-            (Bookerly, Size26, Italic) => &bookerly_italic_26::FONT,
-            (Bookerly, Size28, Italic) => &bookerly_italic_28::FONT,
-            (Bookerly, Size30, Italic) => &bookerly_italic_30::FONT,
+        if let FontFamily::Installed(slot) = self.family {
+            // Slots are never emptied, so this only misses for a made up slot
+            return match file::installed(slot) {
+                Some(family) => family.definition(self.size, style),
+                None => Font::bookerly(self.size).definition(style),
+            };
+        }
+        match (&self.size, &style) {
+            (Size26, Regular) => &bookerly_26::FONT,
+            (Size28, Regular) => &bookerly_28::FONT,
+            (Size30, Regular) => &bookerly_30::FONT,
+            (Size26, Bold) => &bookerly_bold_26::FONT,
+            (Size28, Bold) => &bookerly_bold_28::FONT,
+            (Size30, Bold) => &bookerly_bold_30::FONT,
+            (Size26, BoldItalic) => &bookerly_bold_italic_26::FONT,
+            (Size28, BoldItalic) => &bookerly_bold_italic_28::FONT,
+            (Size30, BoldItalic) => &bookerly_bold_italic_30::FONT,
+            (Size26, Italic) => &bookerly_italic_26::FONT,
+            (Size28, Italic) => &bookerly_italic_28::FONT,
+            (Size30, Italic) => &bookerly_italic_30::FONT,
+        }
+    }
+
+    /// Definitions searched in order for glyphs `style` doesn't have.
+    fn fallbacks(&self, style: FontStyle) -> impl Iterator<Item = &'static FontDefinition<'static>> {
+        (style != FontStyle::Regular)
+            .then(|| self.definition(FontStyle::Regular))
+            .into_iter()
+    }
+
+    /// The glyphs of a prepared run in `style`, with kerning applied.
+    pub fn place<'a>(&self, style: FontStyle, glyphs: Glyphs<'a>, palette: &'a Palette) -> Placed<'a> {
+        Placed {
+            primary: self.definition(style),
+            fallback: self.fallbacks(style).next(),
+            ids: palette.ids(style),
+            glyphs,
+            next: 0,
+            prev: None,
+            x: 0,
+        }
+    }
+
+    pub fn width(&self, style: FontStyle, glyphs: Glyphs<'_>, palette: &Palette) -> u16 {
+        self.place(style, glyphs, palette)
+            .last()
+            .map_or(0, |glyph| (glyph.x + glyph.x_advance as i16).max(0) as u16)
+    }
+
+    /// The codepoint drawn for `glyph`, `None` for [`GlyphId::NONE`] and
+    /// [`GlyphId::JOINED`].
+    pub fn codepoint(&self, style: FontStyle, glyph: GlyphId) -> Option<u32> {
+        let (font, index) = glyph.get(self.definition(style), self.fallbacks(style).next())?;
+        Some(font.glyphs[index].codepoint)
+    }
+}
+
+/// A character resolved to a glyph of its style's fallback chain.
+///
+/// Resolved once when a chapter is prepared, so laying out and drawing
+/// index the glyph tables instead of decoding text and searching fonts.
+/// Fontgen renders all sizes of a family from the same character set, so
+/// an id is valid for every size.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct GlyphId(u16);
+
+impl GlyphId {
+    /// The glyph is in the first fallback instead of the style's font.
+    const FALLBACK: u16 = 1 << 15;
+    /// The character is whitespace, where lines break.
+    const SPACE: u16 = 1 << 14;
+    const INDEX: u16 = Self::SPACE - 1;
+
+    /// A character without a glyph, drawn as nothing.
+    pub const NONE: Self = Self(Self::INDEX);
+    /// The second character of a ligature, drawn by the glyph before it.
+    pub const JOINED: Self = Self(Self::INDEX - 1);
+
+    fn new(index: usize, flags: u16) -> Self {
+        debug_assert!(index < Self::JOINED.0 as usize);
+        Self(index as u16 | flags)
+    }
+
+    pub fn is_space(self) -> bool {
+        self.0 & Self::SPACE != 0
+    }
+
+    /// The font and index of the glyph.
+    fn get<'a>(
+        self,
+        primary: &'a FontDefinition<'a>,
+        fallback: Option<&'a FontDefinition<'a>>,
+    ) -> Option<(&'a FontDefinition<'a>, usize)> {
+        let index = self.0 & Self::INDEX;
+        if index >= Self::JOINED.0 {
+            return None;
         }
+        let font = match fallback {
+            Some(fallback) if self.0 & Self::FALLBACK != 0 => fallback,
+            _ => primary,
+        };
+        Some((font, index as usize))
     }
 }
 
+/// The glyphs a chapter uses, per style.
+///
+/// Prepared runs store each character as a byte indexing their style's
+/// list, so they take no more room than their UTF-8 text. Once a style has
+/// used up all 256 entries, further runs keep their [`GlyphId`]s instead,
+/// see [`Resolved`].
+#[derive(Default)]
+pub struct Palette([Entries; 4]);
+
+#[derive(Default)]
+struct Entries {
+    ids: Vec<GlyphId>,
+    /// Positions in `ids` ordered by id, to find entries while resolving.
+    /// Dropped by [`Palette::finish`] and rebuilt if needed again.
+    sorted: Vec<u8>,
+}
+
+/// The glyphs of a run resolved by [`Palette::resolve`].
+pub enum Resolved {
+    /// One palette entry per character.
+    Palette(Vec<u8>),
+    /// The ids themselves, for a run with glyphs its style's full list
+    /// doesn't have.
+    Ids(Vec<GlyphId>),
+}
+
+impl Palette {
+    /// Entries every list starts with.
+    const SEED: [GlyphId; 3] = [GlyphId::NONE, GlyphId::JOINED, GlyphId(GlyphId::NONE.0 | GlyphId::SPACE)];
+
+    fn ids(&self, style: FontStyle) -> &[GlyphId] {
+        &self.0[style as usize].ids
+    }
+
+    pub fn get(&self, style: FontStyle, glyph: u8) -> GlyphId {
+        self.ids(style).get(glyph as usize).copied().unwrap_or(GlyphId::NONE)
+    }
+
+    /// Bytes allocated for the lists.
+    pub fn heap_size(&self) -> usize {
+        self.0
+            .iter()
+            .map(|entries| entries.ids.capacity() * core::mem::size_of::<GlyphId>() + entries.sorted.capacity())
+            .sum()
+    }
+
+    /// Frees what is only needed while resolving, once a chapter is prepared.
+    pub fn finish(&mut self) {
+        for entries in &mut self.0 {
+            entries.sorted = Vec::new();
+        }
+    }
+
+    /// The entry of `glyph` in the list of `style`, `None` if it has to be
+    /// added to a full list.
+    fn add(&mut self, style: FontStyle, glyph: GlyphId) -> Option<u8> {
+        let Entries { ids, sorted } = &mut self.0[style as usize];
+        if ids.is_empty() {
+            ids.extend_from_slice(&Self::SEED);
+        }
+        if sorted.len() != ids.len() {
+            *sorted = (0..ids.len()).map(|entry| entry as u8).collect();
+            sorted.sort_unstable_by_key(|&entry| ids[entry as usize].0);
+        }
+        match sorted.binary_search_by_key(&glyph.0, |&entry| ids[entry as usize].0) {
+            Ok(at) => Some(sorted[at]),
+            Err(_) if ids.len() > u8::MAX as usize => None,
+            Err(at) => {
+                let entry = ids.len() as u8;
+                ids.push(glyph);
+                sorted.insert(at, entry);
+                Some(entry)
+            }
+        }
+    }
+
+    /// Resolve each character of `text` in `style` of `font`, taking
+    /// missing glyphs from the fallback chain. `f` and the character after
+    /// it become a ligature unless `breaks` allows a line break before that
+    /// character.
+    ///
+    /// Every character takes at least one byte, so the entries overwrite
+    /// the text as it is read and the run keeps its allocation. A run that
+    /// needs an entry its style's full list can't take is returned as ids.
+    pub fn resolve(&mut self, font: Font, style: FontStyle, text: String, breaks: impl Fn(usize) -> bool) -> Resolved {
+        let primary = font.definition(style);
+        let fallback = font.fallbacks(style).next();
+        let mut bytes = text.into_bytes();
+        let (mut read, mut count) = (0, 0);
+        let mut wide: Option<Vec<GlyphId>> = None;
+        while let Some(ch) = char_at(&bytes, read) {
+            read += ch.len_utf8();
+            let mut joined = false;
+            let glyph = if ch == 'f'
+                && !breaks(count + 1)
+                && let Some(next) = char_at(&bytes, read)
+                && let Some((_, ligature)) = LIGATURES.iter().find(|(c, _)| *c == next)
+                && let Some(index) = primary.glyph_index(*ligature)
+            {
+                read += next.len_utf8();
+                joined = true;
+                GlyphId::new(index, 0)
+            } else {
+                let space = if ch.is_whitespace() { GlyphId::SPACE } else { 0 };
+                let codepoint = ch as u32;
+                if let Some(index) = primary.glyph_index(codepoint) {
+                    GlyphId::new(index, space)
+                } else if let Some(index) = fallback.and_then(|fallback| fallback.glyph_index(codepoint)) {
+                    GlyphId::new(index, space | GlyphId::FALLBACK)
+                } else if space != 0 {
+                    GlyphId(GlyphId::NONE.0 | space)
+                } else {
+                    trace!("No glyph for U+{:04X} in {}", codepoint, font.family.repr());
+                    REPLACEMENT_CHARACTERS
+                        .iter()
+                        .find_map(|&replacement| primary.glyph_index(replacement))
+                        .map_or(GlyphId::NONE, |index| GlyphId::new(index, 0))
+                }
+            };
+            for glyph in core::iter::once(glyph).chain(joined.then_some(GlyphId::JOINED)) {
+                if let Some(ids) = &mut wide {
+                    ids.push(glyph);
+                } else if let Some(entry) = self.add(style, glyph) {
+                    bytes[count] = entry;
+                } else {
+                    // At most one glyph per remaining byte follows
+                    let mut ids = Vec::with_capacity(count + 2 + bytes.len() - read);
+                    ids.extend(bytes[..count].iter().map(|&entry| self.get(style, entry)));
+                    ids.push(glyph);
+                    wide = Some(ids);
+                }
+                count += 1;
+            }
+        }
+        match wide {
+            Some(mut ids) => {
+                ids.shrink_to_fit();
+                Resolved::Ids(ids)
+            }
+            None => {
+                bytes.truncate(count);
+                Resolved::Palette(bytes)
+            }
+        }
+    }
+}
+
+/// The prepared glyphs of a run or part of one.
+#[derive(Clone, Copy, Debug)]
+pub enum Glyphs<'a> {
+    /// Entries of the chapter's [`Palette`].
+    Palette(&'a [u8]),
+    Ids(&'a [GlyphId]),
+}
+
+impl Glyphs<'_> {
+    pub fn len(&self) -> usize {
+        match self {
+            Glyphs::Palette(glyphs) => glyphs.len(),
+            Glyphs::Ids(glyphs) => glyphs.len(),
+        }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    fn get(&self, at: usize, ids: &[GlyphId]) -> Option<GlyphId> {
+        match self {
+            Glyphs::Palette(glyphs) => glyphs.get(at).map(|&glyph| ids.get(glyph as usize).copied().unwrap_or(GlyphId::NONE)),
+            Glyphs::Ids(glyphs) => glyphs.get(at).copied(),
+        }
+    }
+}
+
+/// An element of a prepared run, so layout can work on either kind.
+pub trait PreparedGlyph: Copy {
+    fn id(self, palette: &Palette, style: FontStyle) -> GlyphId;
+    fn slice(glyphs: &[Self]) -> Glyphs<'_>;
+}
+
+impl PreparedGlyph for u8 {
+    fn id(self, palette: &Palette, style: FontStyle) -> GlyphId {
+        palette.get(style, self)
+    }
+
+    fn slice(glyphs: &[Self]) -> Glyphs<'_> {
+        Glyphs::Palette(glyphs)
+    }
+}
+
+impl PreparedGlyph for GlyphId {
+    fn id(self, _: &Palette, _: FontStyle) -> GlyphId {
+        self
+    }
+
+    fn slice(glyphs: &[Self]) -> Glyphs<'_> {
+        Glyphs::Ids(glyphs)
+    }
+}
+
+/// The character starting at `bytes[at]`, which must be valid UTF-8 from
+/// there on.
+fn char_at(bytes: &[u8], at: usize) -> Option<char> {
+    let width = match *bytes.get(at)? {
+        0x00..0x80 => 1,
+        0x80..0xE0 => 2,
+        0xE0..0xF0 => 3,
+        _ => 4,
+    };
+    core::str::from_utf8(bytes.get(at..at + width)?).ok()?.chars().next()
+}
+
 #[repr(C)]
 pub struct FontDefinition<'a> {
     pub size: u32,
     pub y_advance: u8,
+    /// Sorted by codepoint.
     pub glyphs: &'a [Glyph],
-    pub bitmap_bw: &'a [u8],
-    pub bitmap_msb: &'a [u8],
-    pub bitmap_lsb: &'a [u8],
+    /// First level of the codepoint index, see [`build_glyph_index`].
+    pub glyph_pages: &'a [u16],
+    /// Second level of the codepoint index.
+    pub glyph_blocks: &'a [GlyphBlock],
+    /// Each glyph's kerning class as `(left, right)`, by glyph index.
+    /// Class 0 never kerns. Empty if the font has no kerning.
+    pub kerning_classes: &'a [(u8, u8)],
+    /// Adjustment by left class, then right class.
+    pub kerning: &'a [&'a [i8]],
+    /// Glyph coverage as [`BITMAP_CODES`], two codes per byte, each glyph
+    /// starting on a byte boundary at its `bitmap_index`. Empty if the
+    /// font isn't resident.
+    pub bitmap: &'a [u8],
+    /// Where the bitmap is paged in from for fonts installed from the SD
+    /// card, `None` for fonts compiled in.
+    pub pages: Option<&'a dyn file::BitmapPages>,
 }
 
 impl FontDefinition<'_> {
-    pub fn get_glyph(&self, codepoint: u16) -> Option<&Glyph> {
-        match self
-            .glyphs
-            .binary_search_by(|glyph| glyph.codepoint.cmp(&codepoint))
-        {
-            Ok(index) => Some(&self.glyphs[index]),
-            Err(_) => None,
-        }
+    pub fn glyph_index(&self, codepoint: u32) -> Option<usize> {
+        let page = *self.glyph_pages.get((codepoint >> GLYPH_PAGE_BITS) as usize)?;
+        let block = (codepoint >> GLYPH_BLOCK_BITS) as usize % BLOCKS_PER_PAGE;
+        let block = self.glyph_blocks.get(page as usize * BLOCKS_PER_PAGE + block)?;
+        block.index(codepoint)
+    }
+
+    pub fn get_glyph(&self, codepoint: u32) -> Option<&Glyph> {
+        self.glyph_index(codepoint).map(|index| &self.glyphs[index])
     }
 
-    pub fn codepoint_width(&self, codepoint: u16) -> Option<u8> {
+    /// Pair adjustment between the glyphs at `left` and `right`.
+    pub fn kerning(&self, left: usize, right: usize) -> i8 {
+        let (Some(&(left, _)), Some(&(_, right))) = (self.kerning_classes.get(left), self.kerning_classes.get(right))
+        else {
+            return 0;
+        };
+        self.kerning
+            .get(left as usize)
+            .and_then(|row| row.get(right as usize))
+            .copied()
+            .unwrap_or(0)
+    }
+
+    pub fn codepoint_width(&self, codepoint: u32) -> Option<u8> {
         self.get_glyph(codepoint).map(|glyph| glyph.x_advance())
     }
 
     pub fn char_width(&self, ch: char) -> Option<u8> {
-        self.codepoint_width(ch as u16)
+        self.codepoint_width(ch as u32)
+    }
+}
+
+const GLYPH_PAGE_BITS: u32 = 8;
+const GLYPH_BLOCK_BITS: u32 = 6;
+const BLOCKS_PER_PAGE: usize = 1 << (GLYPH_PAGE_BITS - GLYPH_BLOCK_BITS);
+
+/// 64 consecutive codepoints of the glyph index.
+#[repr(C)]
+pub struct GlyphBlock {
+    /// Index of the block's first glyph in the glyph table.
+    pub first: u16,
+    /// Bit `n` is set if the font has a glyph for the `n`th codepoint.
+    pub present: u64,
+}
+
+impl GlyphBlock {
+    pub const EMPTY: Self = Self::new(0, 0);
+
+    pub const fn new(first: u16, present: u64) -> Self {
+        Self { first, present }
+    }
+
+    fn index(&self, codepoint: u32) -> Option<usize> {
+        let bit = 1u64 << (codepoint % 64);
+        if self.present & bit == 0 {
+            return None;
+        }
+        Some(self.first as usize + (self.present & (bit - 1)).count_ones() as usize)
+    }
+}
+
+/// Build the two-level codepoint index over `glyphs`.
+///
+/// `codepoint >> 8` selects an entry in the page table, which is either
+/// [`u16::MAX`] or the number of the page's four blocks in the block table.
+/// The glyph's index is the block's first glyph plus the number of present
+/// codepoints before it, so lookups don't depend on the size of the glyph
+/// set and pages without glyphs cost two bytes.
+///
+/// Returns `None` if the glyphs aren't sorted by codepoint.
+pub fn build_glyph_index(glyphs: &[Glyph]) -> Option<(Vec<u16>, Vec<GlyphBlock>)> {
+    let mut pages = Vec::new();
+    let mut blocks: Vec<GlyphBlock> = Vec::new();
+    let mut previous = None;
+    for (index, glyph) in glyphs.iter().enumerate() {
+        if previous.is_some_and(|previous| previous >= glyph.codepoint) {
+            return None;
+        }
+        previous = Some(glyph.codepoint);
+
+        let page = (glyph.codepoint >> GLYPH_PAGE_BITS) as usize;
+        if pages.len() <= page {
+            pages.resize(page + 1, u16::MAX);
+        }
+        if pages[page] == u16::MAX {
+            pages[page] = u16::try_from(blocks.len() / BLOCKS_PER_PAGE).ok()?;
+            blocks.extend((0..BLOCKS_PER_PAGE).map(|_| GlyphBlock::EMPTY));
+        }
+        let block = pages[page] as usize * BLOCKS_PER_PAGE
+            + (glyph.codepoint >> GLYPH_BLOCK_BITS) as usize % BLOCKS_PER_PAGE;
+        let block = &mut blocks[block];
+        if block.present == 0 {
+            block.first = u16::try_from(index).ok()?;
+        }
+        block.present |= 1 << (glyph.codepoint % 64);
+    }
+    Some((pages, blocks))
+}
+
+/// Ligature substitutes for `f` followed by the given character.
+const LIGATURES: [(char, u32); 2] = [('i', 0xFB01), ('l', 0xFB02)];
+
+/// Drawn for characters no font of the chain has, in order of preference.
+const REPLACEMENT_CHARACTERS: [u32; 2] = [0xFFFD, '?' as u32];
+
+#[derive(Clone, Copy)]
+pub struct ShapedGlyph<'a> {
+    pub codepoint: u32,
+    /// Pen position relative to the start of the text.
+    pub x: i16,
+    pub x_advance: u8,
+    /// The font of the chain supplying the glyph.
+    pub font: &'a FontDefinition<'a>,
+    /// Index of the glyph in `font`.
+    pub index: usize,
+}
+
+/// Iterator returned by [`Font::place`].
+pub struct Placed<'a> {
+    primary: &'static FontDefinition<'static>,
+    fallback: Option<&'static FontDefinition<'static>>,
+    ids: &'a [GlyphId],
+    glyphs: Glyphs<'a>,
+    next: usize,
+    prev: Option<(&'static FontDefinition<'static>, usize)>,
+    x: i16,
+}
+
+impl Iterator for Placed<'_> {
+    type Item = ShapedGlyph<'static>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        loop {
+            let glyph = self.glyphs.get(self.next, self.ids)?;
+            self.next += 1;
+            if glyph == GlyphId::JOINED {
+                continue;
+            }
+            let Some((font, index)) = glyph.get(self.primary, self.fallback) else {
+                self.prev = None;
+                continue;
+            };
+            let codepoint = font.glyphs[index].codepoint;
+
+            // Pairs are only kerned within one font
+            if let Some((prev_font, prev)) = self.prev
+                && core::ptr::eq(prev_font, font)
+            {
+                self.x += font.kerning(prev, index) as i16;
+            }
+            self.prev = Some((font, index));
+
+            let x_advance = font.glyphs[index].x_advance();
+            let x = self.x;
+            self.x += x_advance as i16;
+            return Some(ShapedGlyph { codepoint, x, x_advance, font, index });
+        }
     }
+}
+
+/// The 4-bit codes of the glyph bitmap stream as `(level, run length)`, with
+/// levels from 0 (no ink) to 4 (full ink).
+/// Antialiased edges are mostly single gray pixels between runs of no ink
+/// and full ink, which this packs at about half the size of the three
+/// display planes.
+pub const BITMAP_CODES: [(u8, u8); 16] = [
+    (0, 1), (0, 2), (0, 3), (0, 4), (0, 6), (0, 8), (0, 12),
+    (4, 1), (4, 2), (4, 3), (4, 4), (4, 6), (4, 8),
+    (1, 1), (2, 1), (3, 1),
+];
+
+/// Iterator over the `(level, run length)` pairs of one glyph.
+struct GlyphRuns<'a> {
+    bitmap: &'a [u8],
+    nibble: usize,
+    remaining: usize,
+}
+
+impl<'a> GlyphRuns<'a> {
+    /// `bitmap` starts at the glyph's first code.
+    fn new(bitmap: &'a [u8], glyph: &Glyph) -> Self {
+        Self {
+            bitmap,
+            nibble: 0,
+            remaining: glyph.pixels(),
+        }
+    }
+}
+
+impl Iterator for GlyphRuns<'_> {
+    type Item = (u8, usize);
 
-    pub fn word_width(&self, word: &str) -> u16 {
-        word.chars().fold(0u16, |acc, codepoint| {
-            acc + self.char_width(codepoint).unwrap_or(0) as u16
-        })
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.remaining == 0 {
+            return None;
+        }
+        let byte = *self.bitmap.get(self.nibble / 2)?;
+        let code = if self.nibble % 2 == 0 { byte >> 4 } else { byte & 0xF };
+        self.nibble += 1;
+        let (level, length) = BITMAP_CODES[code as usize];
+        let length = (length as usize).min(self.remaining);
+        self.remaining -= length;
+        Some((level, length))
     }
 }
 
 #[repr(C)]
 pub struct Glyph {
-    pub codepoint: u16,
-    pub bitmap_index: u16,
+    pub codepoint: u32,
+    pub bitmap_index: u32,
     pub blob: u32,
 }
 
 impl Glyph {
     pub const fn new(
-        codepoint: u16,
-        bitmap_index: u16,
+        codepoint: u32,
+        bitmap_index: u32,
         x_advance: u8,
         width: u8,
         height: u8,
@@ -181,6 +718,10 @@ impl Glyph {
     pub fn ymin(&self) -> i8 {
         ((self.blob >> 0x00) & Self::MASK) as i8 - 32
     }
+    /// Number of pixels in the glyph's bitmap.
+    pub fn pixels(&self) -> usize {
+        self.width() as usize * self.height() as usize
+    }
 }
 
 #[derive(Clone, Copy, PartialEq, Eq)]
@@ -192,22 +733,63 @@ pub enum Mode {
 
 pub fn draw_glyph(
     font: &FontDefinition,
-    codepoint: u16,
+    codepoint: u32,
     display_buffers: &mut DisplayBuffers,
     x_offset: isize,
     y_offset: isize,
     mode: Mode,
-) -> Result<u8, usize> {
-    let glyph = font
-        .glyphs
-        .binary_search_by(|glyph| glyph.codepoint.cmp(&codepoint))?;
-    let glyph = &font.glyphs[glyph];
-
-    let bitmap = match mode {
-        Mode::Bw => font.bitmap_bw,
-        Mode::Msb => font.bitmap_msb,
-        Mode::Lsb => font.bitmap_lsb,
+) -> Option<u8> {
+    let glyph = font.get_glyph(codepoint)?;
+    Some(with_bitmap(font, glyph, |bitmap| {
+        draw_glyph_bitmap(glyph, bitmap, display_buffers, x_offset, y_offset, mode)
+    }))
+}
+
+/// [`draw_glyph`] for a glyph that has already been looked up.
+pub fn draw_shaped(
+    glyph: &ShapedGlyph,
+    display_buffers: &mut DisplayBuffers,
+    x_offset: isize,
+    y_offset: isize,
+    mode: Mode,
+) -> u8 {
+    let font = glyph.font;
+    let definition = &font.glyphs[glyph.index];
+    with_bitmap(font, definition, |bitmap| {
+        draw_glyph_bitmap(definition, bitmap, display_buffers, x_offset, y_offset, mode)
+    })
+}
+
+/// Codes of the largest glyph. Each covers at least one pixel.
+const MAX_GLYPH_CODES: usize = (Glyph::MASK * Glyph::MASK).div_ceil(2) as usize;
+
+/// Run `draw` on the coverage codes of `glyph`, paging them in first if
+/// the font isn't resident.
+fn with_bitmap<R>(font: &FontDefinition, glyph: &Glyph, draw: impl FnOnce(&[u8]) -> R) -> R {
+    let Some(pages) = font.pages else {
+        return draw(&font.bitmap[glyph.bitmap_index as usize..]);
     };
+    // Runs usually take fewer codes than pixels, don't read past the bitmap
+    let length = glyph.pixels().div_ceil(2).min(font.size.saturating_sub(glyph.bitmap_index) as usize);
+    let mut codes = [0u8; MAX_GLYPH_CODES];
+    let codes = &mut codes[..length];
+    if pages.read(glyph.bitmap_index, codes).is_none() {
+        warn!("Failed to read bitmap of U+{:04X}", glyph.codepoint);
+        return draw(&[]);
+    }
+    draw(codes)
+}
+
+/// Draw `glyph` from its coverage codes in `bitmap`, returning its advance.
+fn draw_glyph_bitmap(
+    glyph: &Glyph,
+    bitmap: &[u8],
+    display_buffers: &mut DisplayBuffers,
+    x_offset: isize,
+    y_offset: isize,
+    mode: Mode,
+) -> u8 {
+    let codepoint = glyph.codepoint;
     let width = glyph.width();
     let height = glyph.height();
     let x_advance = glyph.x_advance();
@@ -218,7 +800,7 @@ pub fn draw_glyph(
     if x_offset > size.width as _ ||
        y_offset > size.height as _{
         warn!("Glyph not placed on screen");
-        return Ok(x_advance);
+        return x_advance;
     }
 
     trace!(
@@ -228,33 +810,207 @@ pub fn draw_glyph(
 
     let x_offset = x_offset + xmin as isize;
     let y_offset = y_offset - height as isize - ymin as isize;
-    for y in 0..height as isize {
-        for x in 0..width as isize {
-            let fb_x = x_offset + x;
-            let fb_y = y_offset + y;
+    let mut pixel = 0usize;
+    for (level, length) in GlyphRuns::new(bitmap, glyph) {
+        let start = pixel;
+        pixel += length;
+
+        // The BW plane has ink from the middle gray on, the gray planes
+        // together encode the three gray levels.
+        let ink = match mode {
+            Mode::Bw => level >= 2,
+            Mode::Msb => level == 2 || level == 3,
+            Mode::Lsb => level == 1 || level == 3,
+        };
+        if !ink {
+            continue;
+        }
+
+        for index in start..pixel {
+            let fb_x = x_offset + (index % width as usize) as isize;
+            let fb_y = y_offset + (index / width as usize) as isize;
             if fb_x < 0 || fb_x >= size.width as isize || fb_y < 0 || fb_y >= size.height as isize {
                 warn!("Pixel out of bounds: fb_x={}, fb_y={}", fb_x, fb_y);
                 continue;
             }
 
-            let bitmap_index =
-                glyph.bitmap_index as usize + (y as usize * width as usize + x as usize) / 8;
-            let bitmap_bit = 7 - ((y as usize * width as usize + x as usize) % 8);
-
-            let byte = bitmap[bitmap_index];
-            let pixel_on = (byte >> bitmap_bit) & 1;
-
             if mode == Mode::Bw {
-                if pixel_on == 0 {
-                    display_buffers.set_pixel(fb_x as _, fb_y as _, BinaryColor::Off);
-                }
+                display_buffers.set_pixel(fb_x as _, fb_y as _, BinaryColor::Off);
             } else {
-                if pixel_on != 0 {
-                    display_buffers.set_pixel(fb_x as _, fb_y as _, BinaryColor::On);
+                display_buffers.set_pixel(fb_x as _, fb_y as _, BinaryColor::On);
+            }
+        }
+    }
+
+    x_advance
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// `(codepoint, x)` of the glyphs of `text` in the regular style.
+    fn placed(font: Font, text: &str) -> alloc::vec::Vec<(u32, i16)> {
+        let mut palette = Palette::default();
+        let glyphs = match palette.resolve(font, FontStyle::Regular, text.into(), |_| false) {
+            Resolved::Palette(glyphs) => glyphs,
+            Resolved::Ids(_) => panic!("Expected palette entries"),
+        };
+        font
+            .place(FontStyle::Regular, Glyphs::Palette(&glyphs), &palette)
+            .map(|glyph| (glyph.codepoint, glyph.x))
+            .collect()
+    }
+
+    #[test]
+    fn shaping() {
+        let font = Font::bookerly(FontSize::Size26);
+        let regular = font.definition(FontStyle::Regular);
+        let index = |codepoint: u32| regular.glyph_index(codepoint).unwrap();
+        let advance = |codepoint: u32| regular.glyphs[index(codepoint)].x_advance() as i16;
+        let kerning = |left: u32, right: u32| regular.kerning(index(left), index(right)) as i16;
+        let (a, v) = ('A' as u32, 'V' as u32);
+
+        let av = advance(a) + kerning(a, v);
+        let ava = av + advance(v) + kerning(v, a);
+        assert_eq!(placed(font, "AVA"), [(a, 0), (v, av), (a, ava)]);
+        assert!(ava < advance(a) + advance(v));
+
+        // The ligature kerns with what follows it
+        let f = 'f' as u32;
+        assert_eq!(placed(font, "fif"), [(0xFB01, 0), (f, advance(0xFB01) + kerning(0xFB01, f))]);
+    }
+
+    #[test]
+    fn fallbacks() {
+        let font = Font::bookerly(FontSize::Size28);
+        let regular = font.definition(FontStyle::Regular);
+        let mut palette = Palette::default();
+        let entries = |resolved| match resolved {
+            Resolved::Palette(glyphs) => glyphs,
+            Resolved::Ids(_) => panic!("Expected palette entries"),
+        };
+        let glyphs = entries(palette.resolve(font, FontStyle::Italic, "a \u{0416}b".into(), |_| false));
+        let ids: alloc::vec::Vec<_> = glyphs.iter().map(|&glyph| palette.get(FontStyle::Italic, glyph)).collect();
+        assert_eq!(ids.len(), 4);
+        assert!(ids[1].is_space());
+        assert_eq!(font.codepoint(FontStyle::Italic, ids[0]), Some('a' as u32));
+        assert_eq!(font.codepoint(FontStyle::Italic, ids[2]), Some('?' as u32));
+
+        // Layout and drawing see the same glyphs
+        let glyphs = entries(palette.resolve(font, FontStyle::Regular, "a\u{0416}".into(), |_| false));
+        let placed: alloc::vec::Vec<_> = font
+            .place(FontStyle::Regular, Glyphs::Palette(&glyphs), &palette)
+            .map(|glyph| (glyph.codepoint, glyph.x))
+            .collect();
+        let (a, question) = (regular.glyph_index('a' as u32).unwrap(), regular.glyph_index('?' as u32).unwrap());
+        let x = regular.glyphs[a].x_advance() as i16 + regular.kerning(a, question) as i16;
+        assert_eq!(placed, [('a' as u32, 0), ('?' as u32, x)]);
+        assert_eq!(
+            font.width(FontStyle::Regular, Glyphs::Palette(&glyphs), &palette),
+            (x + regular.glyphs[question].x_advance() as i16) as u16
+        );
+    }
+
+    #[test]
+    fn full_palette() {
+        let font = Font::bookerly(FontSize::Size28);
+        let regular = font.definition(FontStyle::Regular);
+        let codepoints: alloc::vec::Vec<_> = regular
+            .glyphs
+            .iter()
+            .map(|glyph| glyph.codepoint)
+            .filter(|&codepoint| char::from_u32(codepoint).is_some_and(|ch| !ch.is_whitespace()))
+            .collect();
+        assert!(codepoints.len() > 256);
+        let text = |codepoints: &[u32]| codepoints.iter().filter_map(|&codepoint| char::from_u32(codepoint)).collect();
+
+        // The first run fills the list, the next one keeps its ids
+        let mut palette = Palette::default();
+        let Resolved::Palette(first) = palette.resolve(font, FontStyle::Regular, text(&codepoints[..200]), |_| true) else {
+            panic!("Expected palette entries");
+        };
+        let Resolved::Ids(rest) = palette.resolve(font, FontStyle::Regular, text(&codepoints[200..]), |_| true) else {
+            panic!("Expected ids once the list is full");
+        };
+        assert_eq!(palette.ids(FontStyle::Regular).len(), 256);
+        let drawn: alloc::vec::Vec<_> = font
+            .place(FontStyle::Regular, Glyphs::Palette(&first), &palette)
+            .chain(font.place(FontStyle::Regular, Glyphs::Ids(&rest), &palette))
+            .map(|glyph| glyph.codepoint)
+            .collect();
+        assert_eq!(drawn, codepoints);
+
+        // Glyphs already in the list still resolve to entries
+        palette.finish();
+        let Resolved::Palette(again) = palette.resolve(font, FontStyle::Regular, text(&codepoints[..10]), |_| true) else {
+            panic!("Expected palette entries");
+        };
+        assert_eq!(again[..], first[..10]);
+    }
+
+    #[test]
+    fn glyph_index() {
+        let glyphs = [
+            Glyph::new(0x0041, 0, 0, 0, 0, 0, 0),
+            Glyph::new(0x0042, 0, 0, 0, 0, 0, 0),
+            Glyph::new(0x0416, 0, 0, 0, 0, 0, 0),
+            Glyph::new(0x4E2D, 0, 0, 0, 0, 0, 0),
+            Glyph::new(0x1F600, 0, 0, 0, 0, 0, 0),
+        ];
+        let (pages, blocks) = build_glyph_index(&glyphs).unwrap();
+        let font = FontDefinition {
+            size: 0,
+            y_advance: 0,
+            glyphs: &glyphs,
+            glyph_pages: &pages,
+            glyph_blocks: &blocks,
+            kerning_classes: &[],
+            kerning: &[],
+            bitmap: &[],
+            pages: None,
+        };
+        for (index, glyph) in glyphs.iter().enumerate() {
+            assert_eq!(font.glyph_index(glyph.codepoint), Some(index));
+        }
+        // Outside the BMP doesn't alias into it
+        assert_eq!(font.glyph_index(0xF600), None);
+        assert_eq!(font.glyph_index(0x0043), None);
+        assert_eq!(font.glyph_index(0x10FFFF), None);
+        assert!(build_glyph_index(&[Glyph::new(0x42, 0, 0, 0, 0, 0, 0), Glyph::new(0x41, 0, 0, 0, 0, 0, 0)]).is_none());
+
+        // The generated tables match the glyphs
+        for size in [FontSize::Size26, FontSize::Size28, FontSize::Size30] {
+            for style in [FontStyle::Regular, FontStyle::Bold, FontStyle::Italic, FontStyle::BoldItalic] {
+                let font = Font::bookerly(size).definition(style);
+                for (index, glyph) in font.glyphs.iter().enumerate() {
+                    assert_eq!(font.glyph_index(glyph.codepoint), Some(index));
                 }
             }
         }
     }
 
-    Ok(x_advance)
+    #[test]
+    fn shipped_kerning() {
+        for size in FontSize::ALL {
+            for style in [FontStyle::Regular, FontStyle::Bold, FontStyle::Italic, FontStyle::BoldItalic] {
+                let font = Font::bookerly(size).definition(style);
+                let index = |ch: char| font.glyph_index(ch as u32).unwrap();
+                assert!(font.kerning(index('A'), index('V')) < 0);
+                assert!(font.kerning(index('T'), index('o')) < 0);
+                // Straight and round pairs keep the designed spacing
+                assert_eq!(font.kerning(index('n'), index('n')), 0);
+                assert_eq!(font.kerning(index('o'), index('o')), 0);
+                assert!(font.glyph_index(0xFB01).is_some() && font.glyph_index(0xFB02).is_some());
+            }
+        }
+    }
+
+    #[test]
+    fn bitmap_runs() {
+        let glyph = Glyph::new(0x0041, 0, 8, 5, 4, 0, 0);
+        let runs: alloc::vec::Vec<_> = GlyphRuns::new(&[0x09, 0xDF, 0x62], &glyph).collect();
+        // The last run is cut to the glyph size
+        assert_eq!(runs, [(0, 1), (4, 3), (1, 1), (3, 1), (0, 12), (0, 2)]);
+    }
 }
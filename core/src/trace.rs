@@ -0,0 +1,204 @@
+//! Span recorder for on-device profiling.
+//!
+//! Every finished span is written into a fixed ring buffer as a
+//! [`Record`] of its id, when it ended and how long it took. Recording a
+//! span is a handful of stores, cheap enough for hot paths where logging
+//! isn't. The heap high-water mark costs more to read, so it is only
+//! sampled when an [`Span::Update`] or [`Span::Draw`] ends.
+//!
+//! Durations are measured with a fast tick counter that may wrap, every
+//! 27 seconds for the X4's cycle counter. Spans are placed on the
+//! timeline by a 64-bit microsecond timestamp instead, so idle time
+//! between them never aliases.
+//!
+//! The platform provides the clocks and the heap probe by defining
+//! `_trusty_trace_clock`, `_trusty_trace_micros` and
+//! `_trusty_trace_heap`, the same way it provides
+//! `_esp_println_timestamp`. Without the `trace` feature [`span`] does
+//! nothing and the recorder compiles out entirely.
+
+/// The operations that can be traced.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+#[repr(u8)]
+pub enum Span {
+    /// Handling one input event in the application.
+    Update,
+    /// Drawing an activity, including the display refresh.
+    Draw,
+    /// Parsing a chapter and precomputing hyphenation and glyphs.
+    LoadChapter,
+    /// Breaking one paragraph into lines.
+    LayoutText,
+    /// Copying an image into the framebuffer.
+    Blit,
+    /// Writing one framebuffer into display RAM.
+    WriteRam,
+    /// Waiting for the display controller to finish.
+    WaitBusy,
+}
+
+impl Span {
+    const ALL: [Span; 7] = [
+        Span::Update,
+        Span::Draw,
+        Span::LoadChapter,
+        Span::LayoutText,
+        Span::Blit,
+        Span::WriteRam,
+        Span::WaitBusy,
+    ];
+
+    pub fn name(self) -> &'static str {
+        match self {
+            Span::Update => "update",
+            Span::Draw => "draw",
+            Span::LoadChapter => "load_chapter",
+            Span::LayoutText => "layout_text",
+            Span::Blit => "blit",
+            Span::WriteRam => "write_ram",
+            Span::WaitBusy => "wait_busy",
+        }
+    }
+
+    /// Whether the heap is sampled when this span ends. Only the outer
+    /// spans of the main loop are, once per update and draw.
+    pub fn samples_heap(self) -> bool {
+        matches!(self, Span::Update | Span::Draw)
+    }
+
+    pub fn from_u8(value: u8) -> Option<Self> {
+        Self::ALL.get(value as usize).copied()
+    }
+}
+
+/// One finished span.
+#[derive(Clone, Copy, Debug)]
+pub struct Record {
+    pub span: Span,
+    /// When the span ended, in microseconds since boot.
+    pub end: u64,
+    /// How long it took in clock ticks, CPU cycles on the X4.
+    pub ticks: u32,
+    /// The heap high-water mark when it ended, or 0 if the span doesn't
+    /// [sample](Span::samples_heap) it.
+    pub heap: u32,
+}
+
+/// Formats as `span <name> <end> <ticks> <heap>`, the line format
+/// `trace2json` reads.
+impl core::fmt::Display for Record {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "span {} {} {} {}", self.span.name(), self.end, self.ticks, self.heap)
+    }
+}
+
+/// Records a span when dropped.
+#[must_use = "the span ends when the guard is dropped"]
+pub struct Guard {
+    #[cfg(feature = "trace")]
+    span: Span,
+    #[cfg(feature = "trace")]
+    start: u32,
+}
+
+/// Start timing `span` until the returned guard goes out of scope.
+#[inline(always)]
+pub fn span(#[allow(unused_variables)] span: Span) -> Guard {
+    Guard {
+        #[cfg(feature = "trace")]
+        span,
+        #[cfg(feature = "trace")]
+        start: recorder::clock(),
+    }
+}
+
+#[cfg(feature = "trace")]
+impl Drop for Guard {
+    fn drop(&mut self) {
+        recorder::push(self.span, self.start);
+    }
+}
+
+#[cfg(feature = "trace")]
+pub use recorder::{clear, records};
+
+#[cfg(feature = "trace")]
+mod recorder {
+    use core::sync::atomic::{AtomicU32, AtomicUsize, Ordering};
+
+    use super::{Record, Span};
+
+    unsafe extern "Rust" {
+        fn _trusty_trace_clock() -> u32;
+        fn _trusty_trace_micros() -> u64;
+        fn _trusty_trace_heap() -> u32;
+    }
+
+    pub(super) fn clock() -> u32 {
+        unsafe { _trusty_trace_clock() }
+    }
+
+    /// Number of records kept, 20 bytes each.
+    const CAPACITY: usize = 512;
+
+    /// Fields are separate atomics so a dump racing the writer reads a
+    /// mixed record instead of undefined behavior. Only loads and stores
+    /// are used, the ESP32-C3 has no atomic read-modify-write
+    /// and no 64-bit atomics.
+    struct Slot {
+        span: AtomicU32,
+        end_low: AtomicU32,
+        end_high: AtomicU32,
+        ticks: AtomicU32,
+        heap: AtomicU32,
+    }
+
+    impl Slot {
+        const fn new() -> Self {
+            Self {
+                span: AtomicU32::new(0),
+                end_low: AtomicU32::new(0),
+                end_high: AtomicU32::new(0),
+                ticks: AtomicU32::new(0),
+                heap: AtomicU32::new(0),
+            }
+        }
+    }
+
+    static SLOTS: [Slot; CAPACITY] = [const { Slot::new() }; CAPACITY];
+    /// Total records written since the last clear. Spans are only
+    /// recorded from the main task, so there is a single writer.
+    static WRITTEN: AtomicUsize = AtomicUsize::new(0);
+
+    pub(super) fn push(span: Span, start: u32) {
+        let ticks = clock().wrapping_sub(start);
+        let end = unsafe { _trusty_trace_micros() };
+        let heap = if span.samples_heap() { unsafe { _trusty_trace_heap() } } else { 0 };
+        let written = WRITTEN.load(Ordering::Relaxed);
+        let slot = &SLOTS[written % CAPACITY];
+        slot.span.store(span as u32, Ordering::Relaxed);
+        slot.end_low.store(end as u32, Ordering::Relaxed);
+        slot.end_high.store((end >> 32) as u32, Ordering::Relaxed);
+        slot.ticks.store(ticks, Ordering::Relaxed);
+        slot.heap.store(heap, Ordering::Relaxed);
+        WRITTEN.store(written + 1, Ordering::Release);
+    }
+
+    /// The recorded spans, oldest first, in the order they ended.
+    pub fn records() -> impl Iterator<Item = Record> {
+        let written = WRITTEN.load(Ordering::Acquire);
+        (written.saturating_sub(CAPACITY)..written).filter_map(|idx| {
+            let slot = &SLOTS[idx % CAPACITY];
+            Some(Record {
+                span: Span::from_u8(slot.span.load(Ordering::Relaxed) as u8)?,
+                end: (slot.end_high.load(Ordering::Relaxed) as u64) << 32 | slot.end_low.load(Ordering::Relaxed) as u64,
+                ticks: slot.ticks.load(Ordering::Relaxed),
+                heap: slot.heap.load(Ordering::Relaxed),
+            })
+        })
+    }
+
+    pub fn clear() {
+        WRITTEN.store(0, Ordering::Release);
+    }
+}
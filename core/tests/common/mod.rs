@@ -0,0 +1,220 @@
+//! Reading chapters on an emulated device heap.
+//!
+//! Each test binary registers a [`Device`] as its global allocator, so
+//! its heap and the scratch buffers of [`trusty_core::pool`] are never
+//! shared with another run.
+
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::cell::Cell;
+use std::fmt::Write;
+use std::sync::Mutex;
+use std::sync::atomic::{AtomicUsize, Ordering};
+
+use trusty_core::container::{book, epub::spine};
+use trusty_core::framebuffer::BUFFER_SIZE;
+use trusty_core::{layout, pool, res::font};
+
+/// The X4's heap: the reclaimed 64KB region plus the main one.
+pub const DEVICE_HEAP: usize = 0x10000 + 270000;
+
+/// First-fit allocator over a fixed region, standing in for esp-alloc.
+/// Its bookkeeping must not allocate itself.
+struct Arena {
+    size: usize,
+    base: AtomicUsize,
+    free: Mutex<FreeList>,
+}
+
+/// Free ranges as (start, len), sorted and coalesced.
+struct FreeList {
+    ranges: [(usize, usize); 512],
+    len: usize,
+}
+
+impl FreeList {
+    fn insert(&mut self, idx: usize, range: (usize, usize)) {
+        self.ranges.copy_within(idx..self.len, idx + 1);
+        self.ranges[idx] = range;
+        self.len += 1;
+    }
+
+    fn remove(&mut self, idx: usize) -> (usize, usize) {
+        let range = self.ranges[idx];
+        self.ranges.copy_within(idx + 1..self.len, idx);
+        self.len -= 1;
+        range
+    }
+}
+
+impl Arena {
+    const fn new(size: usize) -> Self {
+        Self {
+            size,
+            base: AtomicUsize::new(0),
+            free: Mutex::new(FreeList { ranges: [(0, 0); 512], len: 0 }),
+        }
+    }
+
+    fn contains(&self, ptr: *mut u8) -> bool {
+        let base = self.base.load(Ordering::Relaxed);
+        base != 0 && (base..base + self.size).contains(&(ptr as usize))
+    }
+}
+
+unsafe impl GlobalAlloc for Arena {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        let mut free = self.free.lock().unwrap();
+        if self.base.load(Ordering::Relaxed) == 0 {
+            let base = unsafe { System.alloc(Layout::from_size_align(self.size, 4096).unwrap()) } as usize;
+            self.base.store(base, Ordering::Relaxed);
+            free.insert(0, (base, self.size));
+        }
+        for idx in 0..free.len {
+            let (start, len) = free.ranges[idx];
+            let aligned = start.next_multiple_of(layout.align());
+            if aligned + layout.size() > start + len {
+                continue;
+            }
+            let tail = (aligned + layout.size(), start + len - aligned - layout.size());
+            match (aligned > start, tail.1 > 0) {
+                (false, false) => drop(free.remove(idx)),
+                (false, true) => free.ranges[idx] = tail,
+                (true, false) => free.ranges[idx].1 = aligned - start,
+                (true, true) => {
+                    free.ranges[idx].1 = aligned - start;
+                    free.insert(idx + 1, tail);
+                }
+            }
+            return aligned as *mut u8;
+        }
+        std::ptr::null_mut()
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        let mut free = self.free.lock().unwrap();
+        let (start, len) = (ptr as usize, layout.size());
+        let idx = free.ranges[..free.len].partition_point(|&(other, _)| other < start);
+        free.insert(idx, (start, len));
+        if idx + 1 < free.len && start + len == free.ranges[idx + 1].0 {
+            free.ranges[idx].1 += free.remove(idx + 1).1;
+        }
+        if idx > 0 && free.ranges[idx - 1].0 + free.ranges[idx - 1].1 == start {
+            free.ranges[idx - 1].1 += free.remove(idx).1;
+        }
+    }
+}
+
+thread_local! {
+    /// Set while the test thread runs the reader workload.
+    static ON_DEVICE: Cell<bool> = const { Cell::new(false) };
+}
+
+/// Sends the workload's allocations to a heap of the given size and
+/// everything else, including the test harness, to the system.
+/// Allocations that don't fit are counted and fall back to the system.
+pub struct Device {
+    heap: Arena,
+    failures: AtomicUsize,
+}
+
+impl Device {
+    pub const fn new(size: usize) -> Self {
+        Self { heap: Arena::new(size), failures: AtomicUsize::new(0) }
+    }
+}
+
+unsafe impl GlobalAlloc for Device {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        if ON_DEVICE.try_with(Cell::get).unwrap_or(false) {
+            let ptr = unsafe { self.heap.alloc(layout) };
+            if !ptr.is_null() {
+                return ptr;
+            }
+            self.failures.fetch_add(1, Ordering::Relaxed);
+        }
+        unsafe { System.alloc(layout) }
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        if self.heap.contains(ptr) {
+            unsafe { self.heap.dealloc(ptr, layout) }
+        } else {
+            unsafe { System.dealloc(ptr, layout) }
+        }
+    }
+}
+
+/// A chapter of `paragraphs` paragraphs with varied word lengths.
+fn chapter_xhtml(seed: usize, paragraphs: usize) -> String {
+    const WORDS: [&str; 12] = [
+        "the", "reader", "turned", "another", "page", "of", "an", "unexpectedly",
+        "long", "chapter", "about", "fragmentation",
+    ];
+    let mut state = (seed as u32).wrapping_mul(2654435761) | 1;
+    let mut xhtml = String::from("<?xml version=\"1.0\"?><html><body>");
+    for _ in 0..paragraphs {
+        xhtml.push_str("<p>");
+        state = state.wrapping_mul(1103515245).wrapping_add(12345);
+        for word in 0..20 + (state >> 16) as usize % 60 {
+            state = state.wrapping_mul(1103515245).wrapping_add(12345);
+            if word % 9 == 8 {
+                write!(xhtml, "<i>{}</i> ", WORDS[(state >> 16) as usize % WORDS.len()]).unwrap();
+            } else {
+                write!(xhtml, "{} ", WORDS[(state >> 16) as usize % WORDS.len()]).unwrap();
+            }
+        }
+        xhtml.push_str("</p>");
+    }
+    xhtml.push_str("</body></html>");
+    xhtml
+}
+
+/// Read 100 chapters in a row on `device`, the way the reader does, and
+/// count the allocations that didn't fit. Boot leaves the framebuffers,
+/// the zip reader's retained inflate state and the scratch buffers at
+/// the bottom of the heap. Then for each chapter the new one is parsed
+/// while the previous one is still alive, the first page is laid out and
+/// an image is decoded into a bitmap of varying size.
+pub fn hundred_chapters(device: &Device) -> usize {
+    ON_DEVICE.set(true);
+    let framebuffers: Vec<u8> = vec![0u8; 2 * BUFFER_SIZE];
+    let inflater: Vec<u8> = vec![0u8; 43_296];
+    // What the firmware sets aside at boot
+    assert!(pool::reserve(8096) && pool::reserve(32768));
+
+    let options = layout::Options::new(460, hypher::Lang::English, font::Font::bookerly(font::FontSize::Size26));
+    let mut current: Option<book::Chapter> = None;
+    for idx in 0..100 {
+        // On the device the XHTML streams from the card
+        ON_DEVICE.set(false);
+        let xhtml = chapter_xhtml(idx, 8 + idx % 7 * 3);
+        ON_DEVICE.set(true);
+
+        let mut chapter = spine::parse(None, xhtml.as_bytes(), xhtml.len(), None, None).unwrap();
+        chapter.prepare(options.font, options.language);
+        current = Some(chapter);
+        let chapter = current.as_ref().unwrap();
+
+        let lines: Vec<_> = chapter
+            .paragraphs
+            .iter()
+            .take(8)
+            .filter_map(|paragraph| match paragraph {
+                book::Paragraph::Text(text) => Some(text),
+                _ => None,
+            })
+            .map(|text| layout::layout_text(options, layout::Alignment::Justify, 10, &text.runs, &chapter.palette))
+            .collect();
+
+        let header = pool::buffer(32768);
+        let mut bitmap = Vec::<u8>::new();
+        bitmap.try_reserve_exact(16_000 + idx * 7919 % 32_000).unwrap();
+        drop(header);
+        drop((lines, bitmap));
+    }
+    drop(current);
+    drop((framebuffers, inflater));
+    ON_DEVICE.set(false);
+
+    device.failures.load(Ordering::Relaxed)
+}
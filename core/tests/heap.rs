@@ -0,0 +1,13 @@
+//! A long reading session on a heap the size of the X4's.
+
+mod common;
+
+use common::{DEVICE_HEAP, Device};
+
+#[global_allocator]
+static DEVICE: Device = Device::new(DEVICE_HEAP);
+
+#[test]
+fn hundred_chapters() {
+    assert_eq!(common::hundred_chapters(&DEVICE), 0);
+}
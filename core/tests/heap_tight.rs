@@ -0,0 +1,14 @@
+//! The session of `heap` with 40KB less heap. It must run out, or the
+//! workload has so much room that `heap` would miss a regression.
+
+mod common;
+
+use common::{DEVICE_HEAP, Device};
+
+#[global_allocator]
+static DEVICE: Device = Device::new(DEVICE_HEAP - 40 * 1024);
+
+#[test]
+fn hundred_chapters() {
+    assert!(common::hundred_chapters(&DEVICE) > 0);
+}
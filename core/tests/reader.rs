@@ -0,0 +1,253 @@
+//! The reader on an in-memory card, driven through the application the way
+//! the main loop does.
+
+use std::cell::RefCell;
+use std::collections::BTreeMap;
+use std::rc::Rc;
+
+use embedded_io::{ErrorKind, ErrorType, SeekFrom};
+use trusty_core::activities::ActivityType;
+use trusty_core::application::Application;
+use trusty_core::battery::ChargeState;
+use trusty_core::framebuffer::DisplayBuffers;
+use trusty_core::fs::{DirEntry, Directory, File, Filesystem, Mode};
+use trusty_core::input::{ButtonState, Buttons};
+use trusty_core::res::font::{Font, FontFamily, FontSize, FontStyle};
+
+const BOOK: &str = "book.md";
+
+/// Files by path. Directories only exist as path prefixes.
+#[derive(Clone, Default)]
+struct Card(Rc<RefCell<BTreeMap<String, Vec<u8>>>>);
+
+impl Card {
+    fn with_book() -> Self {
+        let card = Self::default();
+        let text = "# Title\n\nThe first paragraph.\n\nThe second paragraph.\n\nThe third paragraph.\n";
+        card.0.borrow_mut().insert(BOOK.into(), text.into());
+        card
+    }
+
+    /// The stored reading position of the book.
+    fn progress(&self) -> Option<Vec<u8>> {
+        let files = self.0.borrow();
+        files.iter().find(|(path, _)| path.ends_with("/progress.pod")).map(|(_, data)| data.clone())
+    }
+
+    fn set_progress(&self, data: &[u8]) {
+        let mut files = self.0.borrow_mut();
+        let (_, progress) = files.iter_mut().find(|(path, _)| path.ends_with("/progress.pod")).unwrap();
+        *progress = data.to_vec();
+    }
+}
+
+impl ErrorType for Card {
+    type Error = ErrorKind;
+}
+
+impl Filesystem for Card {
+    type File = CardFile;
+    type Directory = CardDirectory;
+
+    fn open_file(&self, path: &str, mode: Mode) -> Result<CardFile, ErrorKind> {
+        let mut files = self.0.borrow_mut();
+        match mode {
+            Mode::Read if !files.contains_key(path) => return Err(ErrorKind::NotFound),
+            Mode::Read => {}
+            Mode::Write => drop(files.insert(path.into(), Vec::new())),
+            Mode::ReadWrite => drop(files.entry(path.into()).or_default()),
+        }
+        Ok(CardFile { card: self.clone(), path: path.into(), position: 0 })
+    }
+
+    fn open_file_entry(&self, dir: &CardDirectory, entry: &CardEntry, mode: Mode) -> Result<CardFile, ErrorKind> {
+        let separator = if dir.path.is_empty() { "" } else { "/" };
+        self.open_file(&format!("{}{separator}{}", dir.path, entry.name), mode)
+    }
+
+    fn open_directory(&self, path: &str) -> Result<CardDirectory, ErrorKind> {
+        Ok(CardDirectory { card: self.clone(), path: path.into() })
+    }
+
+    fn exists(&self, path: &str) -> Result<bool, ErrorKind> {
+        Ok(self.0.borrow().contains_key(path))
+    }
+
+    fn create_dir_all(&self, _path: &str) -> Result<(), ErrorKind> {
+        Ok(())
+    }
+}
+
+struct CardFile {
+    card: Card,
+    path: String,
+    position: usize,
+}
+
+impl ErrorType for CardFile {
+    type Error = ErrorKind;
+}
+
+impl embedded_io::Read for CardFile {
+    fn read(&mut self, buf: &mut [u8]) -> Result<usize, ErrorKind> {
+        let files = self.card.0.borrow();
+        let data = files[&self.path].get(self.position..).unwrap_or_default();
+        let len = data.len().min(buf.len());
+        buf[..len].copy_from_slice(&data[..len]);
+        self.position += len;
+        Ok(len)
+    }
+}
+
+impl embedded_io::Write for CardFile {
+    fn write(&mut self, buf: &[u8]) -> Result<usize, ErrorKind> {
+        let mut files = self.card.0.borrow_mut();
+        let data = files.get_mut(&self.path).unwrap();
+        data.resize(data.len().max(self.position + buf.len()), 0);
+        data[self.position..self.position + buf.len()].copy_from_slice(buf);
+        self.position += buf.len();
+        Ok(buf.len())
+    }
+
+    fn flush(&mut self) -> Result<(), ErrorKind> {
+        Ok(())
+    }
+}
+
+impl embedded_io::Seek for CardFile {
+    fn seek(&mut self, pos: SeekFrom) -> Result<u64, ErrorKind> {
+        let position = match pos {
+            SeekFrom::Start(offset) => offset as i64,
+            SeekFrom::End(offset) => self.size() as i64 + offset,
+            SeekFrom::Current(offset) => self.position as i64 + offset,
+        };
+        self.position = usize::try_from(position).map_err(|_| ErrorKind::InvalidInput)?;
+        Ok(self.position as u64)
+    }
+}
+
+impl File for CardFile {
+    fn size(&self) -> usize {
+        self.card.0.borrow()[&self.path].len()
+    }
+}
+
+struct CardDirectory {
+    card: Card,
+    path: String,
+}
+
+impl ErrorType for CardDirectory {
+    type Error = ErrorKind;
+}
+
+impl Directory for CardDirectory {
+    type Entry = CardEntry;
+
+    /// The files directly in the directory.
+    fn list(&self) -> Result<Vec<CardEntry>, ErrorKind> {
+        let prefix = if self.path.is_empty() { String::new() } else { format!("{}/", self.path) };
+        let files = self.card.0.borrow();
+        let entries = files
+            .iter()
+            .filter_map(|(path, data)| {
+                let name = path.strip_prefix(&prefix)?;
+                (!name.contains('/')).then(|| CardEntry { name: name.into(), size: data.len() })
+            })
+            .collect();
+        Ok(entries)
+    }
+}
+
+struct CardEntry {
+    name: String,
+    size: usize,
+}
+
+impl DirEntry for CardEntry {
+    fn name(&self) -> &str {
+        &self.name
+    }
+
+    fn is_directory(&self) -> bool {
+        false
+    }
+
+    fn size(&self) -> usize {
+        self.size
+    }
+}
+
+/// Press and release `button`.
+fn press(app: &mut Application<'_, Card>, button: Buttons) {
+    let mut buttons = ButtonState::default();
+    buttons.update(1 << button as u8);
+    app.update(&buttons, ChargeState::default());
+    buttons.update(0);
+    app.update(&buttons, ChargeState::default());
+}
+
+/// Run the current activity's work until it is done.
+fn finish(app: &mut Application<'_, Card>) {
+    while app.work() {}
+}
+
+#[test]
+fn cancelled_load_keeps_progress() {
+    let card = Card::with_book();
+    let mut buffers = Box::new(DisplayBuffers::default());
+    let mut app = Application::with_intent(&mut buffers, card.clone(), ActivityType::reader(BOOK));
+    finish(&mut app);
+    press(&mut app, Buttons::Back);
+    drop(app);
+
+    // Reading had got to the third paragraph
+    let stored = [0u8, 0, 3, 0, 0, 0];
+    card.set_progress(&stored);
+
+    // Back after the book is opened, before its first chapter is shown
+    let mut app = Application::with_intent(&mut buffers, card.clone(), ActivityType::reader(BOOK));
+    assert!(app.work());
+    press(&mut app, Buttons::Back);
+    drop(app);
+    assert_eq!(card.progress().as_deref(), Some(&stored[..]));
+}
+
+#[test]
+fn cancelled_load_is_not_parked() {
+    let card = Card::with_book();
+    let mut buffers = Box::new(DisplayBuffers::default());
+    let mut app = Application::with_intent(&mut buffers, card, ActivityType::file_browser());
+
+    // Leaving a loaded book parks it, and going back resumes it as it was
+    press(&mut app, Buttons::Confirm);
+    finish(&mut app);
+    press(&mut app, Buttons::Back);
+    press(&mut app, Buttons::Confirm);
+    assert!(!app.work());
+
+    // A book left while opening loads again instead
+    press(&mut app, Buttons::Back);
+    app.reclaim();
+    press(&mut app, Buttons::Confirm);
+    assert!(app.work());
+    press(&mut app, Buttons::Back);
+    press(&mut app, Buttons::Confirm);
+    assert!(app.work());
+}
+
+#[test]
+fn fonts_on_card_are_installed() {
+    let card = Card::with_book();
+    for size in FontSize::ALL {
+        let mut data = Vec::new();
+        let px = size.repr().parse().unwrap();
+        Font::bookerly(size).definition(FontStyle::Regular).to_file("Cardly", FontStyle::Regular, px, &mut data).unwrap();
+        card.0.borrow_mut().insert(format!("fonts/cardly_{px}.tfn"), data);
+    }
+    card.0.borrow_mut().insert("fonts/readme.txt".into(), b"Not a font".to_vec());
+
+    let mut buffers = Box::new(DisplayBuffers::default());
+    let _app = Application::with_intent(&mut buffers, card, ActivityType::file_browser());
+    assert!(FontFamily::all().any(|family| family.repr() == "Cardly"));
+}
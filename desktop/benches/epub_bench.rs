@@ -1,15 +1,24 @@
-use std::path::PathBuf;
+use std::alloc::System;
+use std::path::{Path, PathBuf};
 
 use criterion::{BenchmarkId, Criterion, black_box, criterion_group, criterion_main};
-use trusty_core::container::epub;
+use trusty_core::container::{book, epub};
 use trusty_core::container::image::Format;
+use trusty_core::framebuffer::DisplayBuffers;
+use trusty_core::heap::{self, TaggingAllocator};
+use trusty_core::layout;
+use trusty_core::res::font;
 use trusty_core::fs::Filesystem;
+use trusty_desktop::corpus;
 use trusty_desktop::std_fs::StdFilesystem;
 
-/// Resolve the `sd/books` directory relative to the workspace root.
+/// Attributes allocations to the scopes in core for [`report_heap`].
+#[global_allocator]
+static ALLOCATOR: TaggingAllocator<System> = TaggingAllocator::new(System);
+
+/// The generated corpus, or the books in `TRUSTY_BENCH_BOOKS`.
 fn books_dir() -> PathBuf {
-    let manifest = PathBuf::from(env!("CARGO_MANIFEST_DIR"));
-    manifest.parent().unwrap().join("sd").join("books")
+    corpus::bench_books(Path::new(env!("CARGO_TARGET_TMPDIR")))
 }
 
 fn fs() -> StdFilesystem {
@@ -24,7 +33,7 @@ fn fs() -> StdFilesystem {
 fn epub_files() -> Vec<String> {
     let dir = books_dir();
     let mut names: Vec<String> = std::fs::read_dir(&dir)
-        .expect("could not read sd/books – is the directory present?")
+        .expect("could not read the books directory")
         .filter_map(|e| e.ok())
         .filter(|e| {
             e.path()
@@ -42,6 +51,39 @@ fn epub_files() -> Vec<String> {
 // Benchmarks
 // ---------------------------------------------------------------------------
 
+/// Parse every book with all its chapters and images, printing the peak
+/// and leftover bytes and the allocation count of each subsystem.
+fn report_heap(_: &mut Criterion) {
+    let filesystem = fs();
+    let max = (800u16, 480u16);
+    // Images decode in the inactive framebuffer like on the device
+    let mut buffers = DisplayBuffers::default();
+
+    println!("{:<40} {:<16} {:>10} {:>10} {:>10}", "book", "scope", "peak", "live", "allocs");
+    for name in epub_files() {
+        heap::reset();
+        {
+            let mut file = filesystem.open_file(&name, trusty_core::fs::Mode::Read).unwrap();
+            let book = epub::parse(&mut file).unwrap();
+            for i in 0..book.spine.len() {
+                let _ = black_box(epub::parse_chapter(&book, i, &mut file));
+            }
+            let entries = book.file_resolver.entries();
+            for idx in 0..entries.len() {
+                if Format::guess_from_filename(&entries[idx].name).is_some() {
+                    let _ = black_box(epub::parse_image(&book, idx as u16, max, &mut file, &mut buffers.scratch()));
+                }
+            }
+        }
+        for (tag, stats) in heap::stats() {
+            if stats.count == 0 {
+                continue;
+            }
+            println!("{:<40} {:<16} {:>10} {:>10} {:>10}", name, tag.name(), stats.peak, stats.live, stats.count);
+        }
+    }
+}
+
 /// Benchmark parsing the EPUB container (ZIP + OPF + TOC).
 fn bench_epub_parse(c: &mut Criterion) {
     let filesystem = fs();
@@ -122,6 +164,8 @@ fn bench_epub_parse_images_landscape(c: &mut Criterion) {
     let filesystem = fs();
     let files = epub_files();
     let max = (800u16, 480u16);
+    // Images decode in the inactive framebuffer like on the device
+    let mut buffers = DisplayBuffers::default();
 
     let mut group = c.benchmark_group("epub_parse_images_landscape");
     group.sample_size(10);
@@ -152,7 +196,7 @@ fn bench_epub_parse_images_landscape(c: &mut Criterion) {
                     let mut file =
                         filesystem.open_file(name, trusty_core::fs::Mode::Read).unwrap();
                     for &idx in indices {
-                        let img = epub::parse_image(book, idx, max, &mut file);
+                        let img = epub::parse_image(book, idx, max, &mut file, &mut buffers.scratch());
                         black_box(&img);
                     }
                 });
@@ -167,6 +211,8 @@ fn bench_epub_parse_images_portrait(c: &mut Criterion) {
     let filesystem = fs();
     let files = epub_files();
     let max = (480u16, 800u16);
+    // Images decode in the inactive framebuffer like on the device
+    let mut buffers = DisplayBuffers::default();
 
     let mut group = c.benchmark_group("epub_parse_images_portrait");
     group.sample_size(10);
@@ -197,7 +243,7 @@ fn bench_epub_parse_images_portrait(c: &mut Criterion) {
                     let mut file =
                         filesystem.open_file(name, trusty_core::fs::Mode::Read).unwrap();
                     for &idx in indices {
-                        let img = epub::parse_image(book, idx, max, &mut file);
+                        let img = epub::parse_image(book, idx, max, &mut file, &mut buffers.scratch());
                         black_box(&img);
                     }
                 });
@@ -212,6 +258,8 @@ fn bench_epub_parse_single_image(c: &mut Criterion) {
     let filesystem = fs();
     let files = epub_files();
     let max = (800u16, 480u16);
+    // Images decode in the inactive framebuffer like on the device
+    let mut buffers = DisplayBuffers::default();
 
     let mut group = c.benchmark_group("epub_parse_single_image");
 
@@ -240,7 +288,7 @@ fn bench_epub_parse_single_image(c: &mut Criterion) {
                 b.iter(|| {
                     let mut file =
                         filesystem.open_file(name, trusty_core::fs::Mode::Read).unwrap();
-                    let img = epub::parse_image(book, *idx, max, &mut file);
+                    let img = epub::parse_image(book, *idx, max, &mut file, &mut buffers.scratch());
                     black_box(img)
                 });
             },
@@ -249,11 +297,55 @@ fn bench_epub_parse_single_image(c: &mut Criterion) {
     group.finish();
 }
 
+/// Benchmark laying out every paragraph of each book's chapters at the
+/// reader's default settings, kerning and ligatures included.
+fn bench_layout_chapters(c: &mut Criterion) {
+    let filesystem = fs();
+    let files = epub_files();
+    let options = layout::Options::new(
+        460,
+        hypher::Lang::English,
+        font::Font::bookerly(font::FontSize::Size26),
+    );
+
+    let mut group = c.benchmark_group("layout_chapters");
+    group.sample_size(10);
+
+    for name in &files {
+        let mut file = filesystem.open_file(name, trusty_core::fs::Mode::Read).unwrap();
+        let book = epub::parse(&mut file).unwrap();
+        let chapters: Vec<_> = (0..book.spine.len())
+            .filter_map(|i| epub::parse_chapter(&book, i, &mut file).ok())
+            .map(|mut chapter| {
+                chapter.prepare(options.font, options.language);
+                chapter
+            })
+            .collect();
+
+        group.bench_with_input(BenchmarkId::from_parameter(name), &chapters, |b, chapters| {
+            b.iter(|| {
+                for chapter in chapters {
+                    for paragraph in &chapter.paragraphs {
+                        if let book::Paragraph::Text(text) = paragraph {
+                            let alignment = text.alignment.unwrap_or(layout::Alignment::Justify);
+                            let indent = text.indent.unwrap_or(10);
+                            black_box(layout::layout_text(options, alignment, indent, &text.runs, &chapter.palette));
+                        }
+                    }
+                }
+            });
+        });
+    }
+    group.finish();
+}
+
 /// Full end-to-end benchmark: parse + all chapters + all images (mirrors bench.rs).
 fn bench_epub_full(c: &mut Criterion) {
     let filesystem = fs();
     let files = epub_files();
     let max = (800u16, 480u16);
+    // Images decode in the inactive framebuffer like on the device
+    let mut buffers = DisplayBuffers::default();
 
     let mut group = c.benchmark_group("epub_full");
     group.sample_size(10);
@@ -279,6 +371,7 @@ fn bench_epub_full(c: &mut Criterion) {
                             idx as u16,
                             max,
                             &mut file,
+                            &mut buffers.scratch(),
                         ));
                     }
                 }
@@ -290,12 +383,14 @@ fn bench_epub_full(c: &mut Criterion) {
 
 criterion_group!(
     benches,
+    report_heap,
     bench_epub_parse,
     bench_epub_parse_single_chapter,
     bench_epub_parse_chapters,
     bench_epub_parse_single_image,
     bench_epub_parse_images_landscape,
     bench_epub_parse_images_portrait,
+    bench_layout_chapters,
     bench_epub_full,
 );
 criterion_main!(benches);
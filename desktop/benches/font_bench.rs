@@ -0,0 +1,37 @@
+use criterion::{BenchmarkId, Criterion, black_box, criterion_group, criterion_main};
+use trusty_core::framebuffer::DisplayBuffers;
+use trusty_core::res::font::{self, Font, FontSize, FontStyle, Mode};
+
+/// Benchmark drawing every glyph of each font in all three render passes,
+/// decoding the compressed bitmaps on the fly.
+fn bench_render_glyphs(c: &mut Criterion) {
+    let mut buffers = Box::new(DisplayBuffers::default());
+
+    let mut group = c.benchmark_group("render_glyphs");
+    for size in [FontSize::Size26, FontSize::Size28, FontSize::Size30] {
+        for style in [FontStyle::Regular, FontStyle::Bold, FontStyle::Italic, FontStyle::BoldItalic] {
+            let definition = Font::bookerly(size).definition(style);
+            let id = format!("{}/{:?}", size.repr(), style);
+            group.bench_with_input(BenchmarkId::from_parameter(id), definition, |b, definition| {
+                b.iter(|| {
+                    for mode in [Mode::Bw, Mode::Msb, Mode::Lsb] {
+                        for glyph in definition.glyphs {
+                            let _ = black_box(font::draw_glyph(
+                                definition,
+                                glyph.codepoint,
+                                &mut buffers,
+                                100,
+                                100,
+                                mode,
+                            ));
+                        }
+                    }
+                });
+            });
+        }
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_render_glyphs);
+criterion_main!(benches);
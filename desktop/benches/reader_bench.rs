@@ -0,0 +1,259 @@
+use std::alloc::System;
+use std::path::{Path, PathBuf};
+use std::time::{Duration, Instant};
+
+use criterion::{BenchmarkId, Criterion, criterion_group, criterion_main};
+use trusty_core::activities::{Activity, ApplicationState, Work, reader::ReaderActivity};
+use trusty_core::battery::ChargeState;
+use trusty_core::display::{Display, GrayscaleMode, RefreshMode};
+use trusty_core::framebuffer::{BUFFER_SIZE, DisplayBuffers, Rotation};
+use trusty_core::heap::{self, TaggingAllocator};
+use trusty_core::input::{ButtonState, Buttons};
+use trusty_desktop::corpus;
+use trusty_desktop::std_fs::StdFilesystem;
+
+/// Counts heap allocations, so page turns can report how many they make.
+#[global_allocator]
+static ALLOCATOR: TaggingAllocator<System> = TaggingAllocator::new(System);
+
+/// Accepts everything the reader sends without touching a screen.
+struct NullDisplay;
+
+impl Display for NullDisplay {
+    fn display(&mut self, _: &mut DisplayBuffers, _: RefreshMode) {}
+    fn copy_to_lsb(&mut self, _: &[u8; BUFFER_SIZE]) {}
+    fn copy_to_msb(&mut self, _: &[u8; BUFFER_SIZE]) {}
+    fn copy_grayscale_buffers(&mut self, _: &[u8; BUFFER_SIZE], _: &[u8; BUFFER_SIZE]) {}
+    fn display_differential_grayscale(&mut self, _: bool) {}
+    fn display_absolute_grayscale(&mut self, _: GrayscaleMode) {}
+}
+
+/// The generated corpus, or the books in `TRUSTY_BENCH_BOOKS`.
+fn books_dir() -> PathBuf {
+    corpus::bench_books(Path::new(env!("CARGO_TARGET_TMPDIR")))
+}
+
+/// List all `.epub` files in the books directory.
+fn epub_files() -> Vec<String> {
+    let mut names: Vec<String> = std::fs::read_dir(books_dir())
+        .expect("could not read the books directory")
+        .filter_map(|e| e.ok())
+        .filter(|e| e.path().extension().is_some_and(|ext| ext == "epub"))
+        .map(|e| e.file_name().to_string_lossy().into_owned())
+        .collect();
+    names.sort();
+    names
+}
+
+/// A reader driven like the firmware drives it: one update, its loading
+/// work and one draw per button press.
+struct Session {
+    reader: ReaderActivity<StdFilesystem>,
+    display: NullDisplay,
+    buffers: Box<DisplayBuffers>,
+}
+
+const ROTATION: Rotation = Rotation::Rotate90;
+
+impl Session {
+    fn open(name: &str) -> Self {
+        let mut reader = ReaderActivity::new(StdFilesystem::new_with_base_path(books_dir()), name);
+        reader.start();
+        while let Work::Pending = reader.work() {}
+        let mut session = Self {
+            reader,
+            display: NullDisplay,
+            buffers: Box::new(DisplayBuffers::with_rotation(ROTATION)),
+        };
+        session.reader.draw(&mut session.display, &mut session.buffers);
+        session
+    }
+
+    /// Press `button` and draw the result.
+    fn press(&mut self, button: Buttons) {
+        let mut input = ButtonState::default();
+        input.update(1 << button as u8);
+        let state = ApplicationState {
+            input,
+            charge: ChargeState { level: 75, charging: false },
+            rotation: ROTATION,
+        };
+        self.reader.update(&state);
+        while let Work::Pending = self.reader.work() {}
+        self.reader.draw(&mut self.display, &mut self.buffers);
+    }
+
+    /// Let background work like prefetching finish, as it does on the
+    /// device while the reader looks at a page.
+    fn idle(&mut self) {
+        while let Work::Pending = self.reader.work() {}
+    }
+
+    /// Cycle the font size through the settings menu, returning the time
+    /// and allocations spent relayouting for the new size.
+    fn change_font_size(&mut self) -> (Duration, usize) {
+        self.press(Buttons::Confirm);
+        let allocations = heap::allocations();
+        let start = Instant::now();
+        self.press(Buttons::Confirm);
+        let elapsed = start.elapsed();
+        let allocations = heap::allocations() - allocations;
+        self.press(Buttons::Back);
+        (elapsed, allocations)
+    }
+}
+
+#[derive(Clone, Copy, PartialEq, Eq)]
+enum Operation {
+    NextPage,
+    PrevPage,
+    ChapterCrossing,
+    FontSize,
+}
+
+impl Operation {
+    const ALL: [Operation; 4] = [
+        Operation::NextPage,
+        Operation::PrevPage,
+        Operation::ChapterCrossing,
+        Operation::FontSize,
+    ];
+
+    fn name(self) -> &'static str {
+        match self {
+            Operation::NextPage => "next_page",
+            Operation::PrevPage => "prev_page",
+            Operation::ChapterCrossing => "chapter_crossing",
+            Operation::FontSize => "font_size",
+        }
+    }
+}
+
+/// Latencies and allocation counts of one operation type.
+#[derive(Default)]
+struct Samples {
+    times: Vec<Duration>,
+    allocations: Vec<usize>,
+}
+
+impl Samples {
+    fn record(&mut self, time: Duration, allocations: usize) {
+        self.times.push(time);
+        self.allocations.push(allocations);
+    }
+
+    fn percentile(&self, percent: usize) -> Duration {
+        let mut times = self.times.clone();
+        times.sort_unstable();
+        times[(times.len() - 1) * percent / 100]
+    }
+
+    fn mean_allocations(&self) -> f64 {
+        self.allocations.iter().sum::<usize>() as f64 / self.allocations.len() as f64
+    }
+}
+
+/// Stop walking a book after this many turns in each direction.
+const MAX_TURNS: usize = 500;
+
+/// Turn `button`'s way through the book until it stops moving, classifying
+/// each turn by whether it crossed into another chapter.
+fn walk(session: &mut Session, button: Buttons, page: Operation, samples: &mut [Samples; 4]) {
+    for _ in 0..MAX_TURNS {
+        session.idle();
+        let before = session.reader.position();
+        let allocations = heap::allocations();
+        let start = Instant::now();
+        session.press(button);
+        let elapsed = start.elapsed();
+        let allocations = heap::allocations() - allocations;
+
+        let after = session.reader.position();
+        if after == before {
+            break;
+        }
+        let operation = if after.chapter != before.chapter { Operation::ChapterCrossing } else { page };
+        samples[operation as usize].record(elapsed, allocations);
+    }
+}
+
+/// Walk every book forward and back and change the font size along the
+/// way, printing p50/p99 latency and allocations per operation type.
+fn report_page_turns(_: &mut Criterion) {
+    println!("{:<40} {:<18} {:>6} {:>10} {:>10} {:>12}", "book", "operation", "count", "p50", "p99", "allocs/turn");
+    for name in epub_files() {
+        let mut session = Session::open(&name);
+        let mut samples: [Samples; 4] = Default::default();
+
+        walk(&mut session, Buttons::Down, Operation::NextPage, &mut samples);
+        for _ in 0..6 {
+            let (elapsed, allocations) = session.change_font_size();
+            samples[Operation::FontSize as usize].record(elapsed, allocations);
+        }
+        walk(&mut session, Buttons::Up, Operation::PrevPage, &mut samples);
+
+        for operation in Operation::ALL {
+            let samples = &samples[operation as usize];
+            if samples.times.is_empty() {
+                continue;
+            }
+            println!(
+                "{:<40} {:<18} {:>6} {:>10.2?} {:>10.2?} {:>12.1}",
+                name,
+                operation.name(),
+                samples.times.len(),
+                samples.percentile(50),
+                samples.percentile(99),
+                samples.mean_allocations(),
+            );
+        }
+    }
+}
+
+/// Benchmark single page turns, stepping back 20 pages whenever the walk
+/// hits either end of the book.
+fn bench_page_turns(c: &mut Criterion) {
+    let mut group = c.benchmark_group("reader_page_turn");
+    group.sample_size(20);
+
+    for name in epub_files() {
+        for (operation, forward, back) in [
+            (Operation::NextPage, Buttons::Down, Buttons::Up),
+            (Operation::PrevPage, Buttons::Up, Buttons::Down),
+        ] {
+            group.bench_function(BenchmarkId::new(operation.name(), &name), |b| {
+                let mut session = Session::open(&name);
+                // Start the backwards walk a few pages in
+                if operation == Operation::PrevPage {
+                    for _ in 0..20 {
+                        session.press(back);
+                    }
+                }
+                b.iter_custom(|iters| {
+                    let mut total = Duration::ZERO;
+                    for _ in 0..iters {
+                        let before = session.reader.position();
+                        let start = Instant::now();
+                        session.press(forward);
+                        total += start.elapsed();
+                        if session.reader.position() == before {
+                            for _ in 0..20 {
+                                session.press(back);
+                            }
+                        }
+                    }
+                    total
+                });
+            });
+        }
+
+        group.bench_function(BenchmarkId::new(Operation::FontSize.name(), &name), |b| {
+            let mut session = Session::open(&name);
+            b.iter_custom(|iters| (0..iters).map(|_| session.change_font_size().0).sum());
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, report_page_turns, bench_page_turns);
+criterion_main!(benches);
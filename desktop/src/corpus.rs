@@ -0,0 +1,510 @@
+//! Synthetic EPUBs for benchmarking.
+//!
+//! Every book is generated from a [`BookSpec`] with a seeded generator, so
+//! the same spec always produces the same bytes and benchmark results can be
+//! compared across machines and over time.
+
+use std::io;
+use std::path::{Path, PathBuf};
+use std::sync::OnceLock;
+
+use image::ImageEncoder;
+use image::codecs::png::{CompressionType, FilterType, PngEncoder};
+
+/// How the entries of a book are stored in the ZIP container.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Compression {
+    Deflate,
+    Stored,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum PngFilter {
+    None,
+    Sub,
+    Up,
+    Avg,
+    Paeth,
+    Adaptive,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ImageKind {
+    BaselineJpeg,
+    ProgressiveJpeg,
+    Png(PngFilter),
+}
+
+impl ImageKind {
+    fn extension(self) -> &'static str {
+        match self {
+            ImageKind::BaselineJpeg | ImageKind::ProgressiveJpeg => "jpg",
+            ImageKind::Png(_) => "png",
+        }
+    }
+
+    fn media_type(self) -> &'static str {
+        match self {
+            ImageKind::BaselineJpeg | ImageKind::ProgressiveJpeg => "image/jpeg",
+            ImageKind::Png(_) => "image/png",
+        }
+    }
+}
+
+/// Properties of a generated book.
+#[derive(Debug, Clone)]
+pub struct BookSpec {
+    /// File name without the `.epub` extension.
+    pub name: String,
+    pub chapters: usize,
+    /// Paragraphs per chapter.
+    pub paragraphs: usize,
+    /// Class rules in the stylesheet, cycled through by the paragraphs.
+    pub css_rules: usize,
+    /// Elements each paragraph is wrapped in.
+    pub nesting: usize,
+    /// Images, spread over the chapters in order.
+    pub images: Vec<ImageKind>,
+    /// Size of every image in pixels.
+    pub image_size: (u32, u32),
+    pub compression: Compression,
+    pub seed: u64,
+}
+
+impl BookSpec {
+    pub fn new(name: &str) -> Self {
+        Self {
+            name: name.to_string(),
+            chapters: 4,
+            paragraphs: 30,
+            css_rules: 8,
+            nesting: 0,
+            images: Vec::new(),
+            image_size: (600, 800),
+            compression: Compression::Deflate,
+            seed: 1,
+        }
+    }
+}
+
+/// The corpus the benchmarks run against.
+pub fn default_corpus() -> Vec<BookSpec> {
+    use ImageKind::*;
+    vec![
+        BookSpec::new("text_small"),
+        BookSpec {
+            chapters: 3,
+            paragraphs: 1500,
+            seed: 2,
+            ..BookSpec::new("text_large_chapters")
+        },
+        BookSpec {
+            chapters: 150,
+            paragraphs: 8,
+            seed: 3,
+            ..BookSpec::new("text_many_chapters")
+        },
+        BookSpec {
+            chapters: 10,
+            paragraphs: 50,
+            css_rules: 2000,
+            seed: 4,
+            ..BookSpec::new("css_heavy")
+        },
+        BookSpec {
+            chapters: 10,
+            paragraphs: 50,
+            compression: Compression::Stored,
+            seed: 5,
+            ..BookSpec::new("stored")
+        },
+        BookSpec {
+            chapters: 5,
+            paragraphs: 40,
+            nesting: 48,
+            seed: 6,
+            ..BookSpec::new("deeply_nested")
+        },
+        BookSpec {
+            chapters: 2,
+            paragraphs: 10,
+            images: vec![BaselineJpeg, BaselineJpeg, ProgressiveJpeg, ProgressiveJpeg],
+            seed: 7,
+            ..BookSpec::new("images_jpeg")
+        },
+        BookSpec {
+            chapters: 2,
+            paragraphs: 10,
+            images: [PngFilter::None, PngFilter::Sub, PngFilter::Up, PngFilter::Avg, PngFilter::Paeth, PngFilter::Adaptive]
+                .into_iter()
+                .map(Png)
+                .collect(),
+            seed: 8,
+            ..BookSpec::new("images_png")
+        },
+    ]
+}
+
+/// Write the [`default_corpus`] to `dir`, returning the paths of the books.
+pub fn generate(dir: &Path) -> io::Result<Vec<PathBuf>> {
+    std::fs::create_dir_all(dir)?;
+    default_corpus()
+        .iter()
+        .map(|spec| {
+            let path = dir.join(&spec.name).with_extension("epub");
+            std::fs::write(&path, build_book(spec))?;
+            Ok(path)
+        })
+        .collect()
+}
+
+/// The books benchmarks run against: the directory in `TRUSTY_BENCH_BOOKS`
+/// if set, such as `sd/books`, otherwise the default corpus, generated into
+/// `tmp_dir` once per process.
+pub fn bench_books(tmp_dir: &Path) -> PathBuf {
+    static BOOKS: OnceLock<PathBuf> = OnceLock::new();
+    BOOKS
+        .get_or_init(|| {
+            if let Some(dir) = std::env::var_os("TRUSTY_BENCH_BOOKS") {
+                return dir.into();
+            }
+            let dir = tmp_dir.join("corpus");
+            generate(&dir).expect("could not generate the benchmark corpus");
+            dir
+        })
+        .clone()
+}
+
+/// Generate the EPUB described by `spec`.
+pub fn build_book(spec: &BookSpec) -> Vec<u8> {
+    let mut rng = Rng::new(spec.seed);
+    let mut zip = ZipWriter::default();
+
+    // The mimetype has to come first and uncompressed
+    zip.add("mimetype", b"application/epub+zip", Compression::Stored);
+    zip.add("META-INF/container.xml", CONTAINER_XML.as_bytes(), spec.compression);
+
+    let images: Vec<String> = spec
+        .images
+        .iter()
+        .enumerate()
+        .map(|(idx, kind)| format!("images/image{idx}.{}", kind.extension()))
+        .collect();
+
+    zip.add("OEBPS/content.opf", build_opf(spec, &images).as_bytes(), spec.compression);
+    zip.add("OEBPS/toc.ncx", build_ncx(spec).as_bytes(), spec.compression);
+    zip.add("OEBPS/style.css", build_css(spec, &mut rng).as_bytes(), spec.compression);
+    for chapter in 0..spec.chapters {
+        let chapter_images: Vec<&str> = images
+            .iter()
+            .skip(chapter)
+            .step_by(spec.chapters.max(1))
+            .map(String::as_str)
+            .collect();
+        let xhtml = build_chapter(spec, chapter, &chapter_images, &mut rng);
+        zip.add(&format!("OEBPS/chapter{chapter}.xhtml"), xhtml.as_bytes(), spec.compression);
+    }
+    for (kind, name) in spec.images.iter().zip(&images) {
+        let data = build_image(*kind, spec.image_size, &mut rng);
+        // Compressed image formats gain nothing from deflate
+        zip.add(&format!("OEBPS/{name}"), &data, Compression::Stored);
+    }
+
+    zip.finish()
+}
+
+const CONTAINER_XML: &str = r#"<?xml version="1.0" encoding="UTF-8"?>
+<container version="1.0" xmlns="urn:oasis:names:tc:opendocument:xmlns:container">
+  <rootfiles>
+    <rootfile full-path="OEBPS/content.opf" media-type="application/oebps-package+xml"/>
+  </rootfiles>
+</container>
+"#;
+
+fn build_opf(spec: &BookSpec, images: &[String]) -> String {
+    let mut manifest = String::new();
+    let mut spine = String::new();
+    for chapter in 0..spec.chapters {
+        manifest.push_str(&format!(
+            "    <item id=\"chapter{chapter}\" href=\"chapter{chapter}.xhtml\" media-type=\"application/xhtml+xml\"/>\n"
+        ));
+        spine.push_str(&format!("    <itemref idref=\"chapter{chapter}\"/>\n"));
+    }
+    for (idx, (kind, name)) in spec.images.iter().zip(images).enumerate() {
+        manifest.push_str(&format!(
+            "    <item id=\"image{idx}\" href=\"{name}\" media-type=\"{}\"/>\n",
+            kind.media_type()
+        ));
+    }
+
+    format!(
+        r#"<?xml version="1.0" encoding="UTF-8"?>
+<package xmlns="http://www.idpf.org/2007/opf" version="2.0" unique-identifier="bookid">
+  <metadata xmlns:dc="http://purl.org/dc/elements/1.1/">
+    <dc:title>{name}</dc:title>
+    <dc:creator>Trusty Corpus</dc:creator>
+    <dc:language>en</dc:language>
+    <dc:identifier id="bookid">trusty-corpus-{name}-{seed}</dc:identifier>
+  </metadata>
+  <manifest>
+    <item id="ncx" href="toc.ncx" media-type="application/x-dtbncx+xml"/>
+    <item id="style" href="style.css" media-type="text/css"/>
+{manifest}  </manifest>
+  <spine toc="ncx">
+{spine}  </spine>
+</package>
+"#,
+        name = spec.name,
+        seed = spec.seed,
+    )
+}
+
+fn build_ncx(spec: &BookSpec) -> String {
+    let mut nav = String::new();
+    for chapter in 0..spec.chapters {
+        nav.push_str(&format!(
+            "    <navPoint id=\"nav{chapter}\" playOrder=\"{}\">\n      <navLabel><text>Chapter {}</text></navLabel>\n      <content src=\"chapter{chapter}.xhtml\"/>\n    </navPoint>\n",
+            chapter + 1,
+            chapter + 1,
+        ));
+    }
+    format!(
+        r#"<?xml version="1.0" encoding="UTF-8"?>
+<ncx xmlns="http://www.daisy.org/z3986/2005/ncx/" version="2005-1">
+  <head/>
+  <docTitle><text>{}</text></docTitle>
+  <navMap>
+{nav}  </navMap>
+</ncx>
+"#,
+        spec.name
+    )
+}
+
+fn build_css(spec: &BookSpec, rng: &mut Rng) -> String {
+    const ALIGNMENTS: [&str; 4] = ["left", "center", "right", "justify"];
+    const WEIGHTS: [&str; 2] = ["normal", "bold"];
+    const STYLES: [&str; 2] = ["normal", "italic"];
+
+    let mut css = String::from("body { margin: 0; }\np { text-indent: 1.5em; margin: 0; }\nh1 { font-size: 1.4em; text-align: center; }\n");
+    for rule in 0..spec.css_rules {
+        css.push_str(&format!(
+            ".c{rule} {{ text-align: {}; text-indent: {}em; margin-top: {}em; font-weight: {}; font-style: {}; }}\n",
+            ALIGNMENTS[rng.below(ALIGNMENTS.len())],
+            rng.below(3),
+            rng.below(2),
+            WEIGHTS[rng.below(WEIGHTS.len())],
+            STYLES[rng.below(STYLES.len())],
+        ));
+    }
+    css
+}
+
+const WORDS: [&str; 48] = [
+    "the", "of", "and", "a", "to", "in", "is", "was", "that", "for", "it", "with", "as", "his", "on", "be", "at", "by",
+    "had", "not", "river", "morning", "lantern", "quietly", "remembered", "northern", "harbour", "letters", "window",
+    "afterwards", "impossible", "conversation", "understanding", "extraordinary", "circumstances", "neighbourhood",
+    "carriage", "whispered", "mountains", "silver", "beneath", "travelled", "unfortunately", "philosophical",
+    "characteristically", "garden", "evening", "stranger",
+];
+
+fn build_chapter(spec: &BookSpec, chapter: usize, images: &[&str], rng: &mut Rng) -> String {
+    let mut body = format!("<h1>Chapter {}</h1>\n", chapter + 1);
+    let image_every = spec.paragraphs / (images.len() + 1);
+    let mut images = images.iter();
+
+    for paragraph in 0..spec.paragraphs {
+        if image_every > 0 && paragraph > 0 && paragraph % image_every == 0 {
+            if let Some(image) = images.next() {
+                body.push_str(&format!("<div class=\"figure\"><img src=\"{image}\" alt=\"\"/></div>\n"));
+            }
+        }
+
+        for depth in 0..spec.nesting {
+            body.push_str(&format!("<div class=\"d{depth}\">"));
+        }
+        if spec.css_rules > 0 {
+            body.push_str(&format!("<p class=\"c{}\">", paragraph % spec.css_rules));
+        } else {
+            body.push_str("<p>");
+        }
+        let words = 40 + rng.below(80);
+        for word in 0..words {
+            if word > 0 {
+                body.push(' ');
+            }
+            let text = WORDS[rng.below(WORDS.len())];
+            match rng.below(24) {
+                0 => body.push_str(&format!("<em>{text}</em>")),
+                1 => body.push_str(&format!("<strong>{text}</strong>")),
+                2 => body.push_str(&format!("{text}&#8217;s")),
+                _ => body.push_str(text),
+            }
+        }
+        body.push_str(".</p>");
+        for _ in 0..spec.nesting {
+            body.push_str("</div>");
+        }
+        body.push('\n');
+    }
+    // Images that didn't fit between paragraphs
+    for image in images {
+        body.push_str(&format!("<div class=\"figure\"><img src=\"{image}\" alt=\"\"/></div>\n"));
+    }
+
+    format!(
+        r#"<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE html>
+<html xmlns="http://www.w3.org/1999/xhtml">
+<head>
+  <title>Chapter {}</title>
+  <link rel="stylesheet" type="text/css" href="style.css"/>
+</head>
+<body>
+{body}</body>
+</html>
+"#,
+        chapter + 1
+    )
+}
+
+/// Encode a gradient with some noise, so the encoders can't collapse it.
+fn build_image(kind: ImageKind, (width, height): (u32, u32), rng: &mut Rng) -> Vec<u8> {
+    let mut rgb = Vec::with_capacity(width as usize * height as usize * 3);
+    for y in 0..height {
+        for x in 0..width {
+            let noise = rng.below(32) as u32;
+            rgb.push(((x * 255 / width + noise) % 256) as u8);
+            rgb.push(((y * 255 / height + noise) % 256) as u8);
+            rgb.push((((x + y) * 128 / (width + height)) + noise) as u8);
+        }
+    }
+
+    let mut out = Vec::new();
+    match kind {
+        ImageKind::BaselineJpeg | ImageKind::ProgressiveJpeg => {
+            let mut encoder = jpeg_encoder::Encoder::new(&mut out, 85);
+            encoder.set_progressive(kind == ImageKind::ProgressiveJpeg);
+            encoder
+                .encode(&rgb, width as u16, height as u16, jpeg_encoder::ColorType::Rgb)
+                .expect("Failed to encode JPEG");
+        }
+        ImageKind::Png(filter) => {
+            let filter = match filter {
+                PngFilter::None => FilterType::NoFilter,
+                PngFilter::Sub => FilterType::Sub,
+                PngFilter::Up => FilterType::Up,
+                PngFilter::Avg => FilterType::Avg,
+                PngFilter::Paeth => FilterType::Paeth,
+                PngFilter::Adaptive => FilterType::Adaptive,
+            };
+            PngEncoder::new_with_quality(&mut out, CompressionType::Default, filter)
+                .write_image(&rgb, width, height, image::ExtendedColorType::Rgb8)
+                .expect("Failed to encode PNG");
+        }
+    }
+    out
+}
+
+/// xorshift64*, enough to vary the text without pulling in `rand`.
+struct Rng(u64);
+
+impl Rng {
+    fn new(seed: u64) -> Self {
+        Self(seed.wrapping_mul(0x9E37_79B9_7F4A_7C15) | 1)
+    }
+
+    fn next(&mut self) -> u64 {
+        self.0 ^= self.0 >> 12;
+        self.0 ^= self.0 << 25;
+        self.0 ^= self.0 >> 27;
+        self.0.wrapping_mul(0x2545_F491_4F6C_DD1D)
+    }
+
+    fn below(&mut self, bound: usize) -> usize {
+        (self.next() >> 32) as usize % bound
+    }
+}
+
+/// Minimal ZIP writer, without timestamps so the output only depends on the
+/// entries.
+#[derive(Default)]
+struct ZipWriter {
+    out: Vec<u8>,
+    central_directory: Vec<u8>,
+    entries: u16,
+}
+
+impl ZipWriter {
+    const DOS_DATE: u16 = (1 << 5) | 1; // 1980-01-01
+
+    fn add(&mut self, name: &str, data: &[u8], compression: Compression) {
+        let crc = crc32(data);
+        let (method, stored) = match compression {
+            Compression::Stored => (0u16, data.to_vec()),
+            Compression::Deflate => (8u16, miniz_oxide::deflate::compress_to_vec(data, 6)),
+        };
+        let offset = self.out.len() as u32;
+
+        let out = &mut self.out;
+        out.extend_from_slice(&0x0403_4b50u32.to_le_bytes());
+        out.extend_from_slice(&20u16.to_le_bytes()); // version needed
+        out.extend_from_slice(&0u16.to_le_bytes()); // flags
+        out.extend_from_slice(&method.to_le_bytes());
+        out.extend_from_slice(&0u16.to_le_bytes()); // time
+        out.extend_from_slice(&Self::DOS_DATE.to_le_bytes());
+        out.extend_from_slice(&crc.to_le_bytes());
+        out.extend_from_slice(&(stored.len() as u32).to_le_bytes());
+        out.extend_from_slice(&(data.len() as u32).to_le_bytes());
+        out.extend_from_slice(&(name.len() as u16).to_le_bytes());
+        out.extend_from_slice(&0u16.to_le_bytes()); // extra length
+        out.extend_from_slice(name.as_bytes());
+        out.extend_from_slice(&stored);
+
+        let cd = &mut self.central_directory;
+        cd.extend_from_slice(&0x0201_4b50u32.to_le_bytes());
+        cd.extend_from_slice(&20u16.to_le_bytes()); // version made by
+        cd.extend_from_slice(&20u16.to_le_bytes()); // version needed
+        cd.extend_from_slice(&0u16.to_le_bytes()); // flags
+        cd.extend_from_slice(&method.to_le_bytes());
+        cd.extend_from_slice(&0u16.to_le_bytes()); // time
+        cd.extend_from_slice(&Self::DOS_DATE.to_le_bytes());
+        cd.extend_from_slice(&crc.to_le_bytes());
+        cd.extend_from_slice(&(stored.len() as u32).to_le_bytes());
+        cd.extend_from_slice(&(data.len() as u32).to_le_bytes());
+        cd.extend_from_slice(&(name.len() as u16).to_le_bytes());
+        cd.extend_from_slice(&[0; 12]); // extra, comment, disk, attributes
+        cd.extend_from_slice(&offset.to_le_bytes());
+        cd.extend_from_slice(name.as_bytes());
+
+        self.entries += 1;
+    }
+
+    fn finish(mut self) -> Vec<u8> {
+        let offset = self.out.len() as u32;
+        let size = self.central_directory.len() as u32;
+        self.out.append(&mut self.central_directory);
+
+        let out = &mut self.out;
+        out.extend_from_slice(&0x0605_4b50u32.to_le_bytes());
+        out.extend_from_slice(&[0; 4]); // disk numbers
+        out.extend_from_slice(&self.entries.to_le_bytes());
+        out.extend_from_slice(&self.entries.to_le_bytes());
+        out.extend_from_slice(&size.to_le_bytes());
+        out.extend_from_slice(&offset.to_le_bytes());
+        out.extend_from_slice(&0u16.to_le_bytes()); // comment length
+        self.out
+    }
+}
+
+fn crc32(data: &[u8]) -> u32 {
+    let mut crc = !0u32;
+    for &byte in data {
+        crc ^= byte as u32;
+        for _ in 0..8 {
+            crc = (crc >> 1) ^ (0xEDB8_8320 & (crc & 1).wrapping_neg());
+        }
+    }
+    !crc
+}
+
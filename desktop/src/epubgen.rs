@@ -0,0 +1,93 @@
+use log::info;
+use trusty_desktop::corpus::{self, BookSpec, Compression};
+
+/// Generate synthetic EPUBs for benchmarking. Without options the default
+/// corpus is written.
+#[derive(argh::FromArgs)]
+struct Args {
+    /// output directory
+    #[argh(positional)]
+    output: String,
+
+    /// generate a single book with this name instead of the default corpus
+    #[argh(option)]
+    name: Option<String>,
+
+    /// number of chapters
+    #[argh(option, default = "4")]
+    chapters: usize,
+
+    /// paragraphs per chapter
+    #[argh(option, default = "30")]
+    paragraphs: usize,
+
+    /// class rules in the stylesheet
+    #[argh(option, default = "8")]
+    css_rules: usize,
+
+    /// elements wrapped around each paragraph
+    #[argh(option, default = "0")]
+    nesting: usize,
+
+    /// number of baseline JPEG images
+    #[argh(option, default = "0")]
+    jpegs: usize,
+
+    /// number of progressive JPEG images
+    #[argh(option, default = "0")]
+    progressive_jpegs: usize,
+
+    /// number of PNG images, cycling through the filter types
+    #[argh(option, default = "0")]
+    pngs: usize,
+
+    /// store entries instead of deflating them
+    #[argh(switch)]
+    stored: bool,
+
+    /// seed for the generated content
+    #[argh(option, default = "1")]
+    seed: u64,
+}
+
+fn main() {
+    env_logger::Builder::from_env(env_logger::Env::default().default_filter_or("info")).init();
+
+    let args: Args = argh::from_env();
+    let output = std::path::Path::new(&args.output);
+
+    let Some(name) = &args.name else {
+        for path in corpus::generate(output).expect("Failed to write corpus") {
+            info!("Wrote {}", path.display());
+        }
+        return;
+    };
+
+    use corpus::{ImageKind, PngFilter};
+    const FILTERS: [PngFilter; 6] = [
+        PngFilter::None,
+        PngFilter::Sub,
+        PngFilter::Up,
+        PngFilter::Avg,
+        PngFilter::Paeth,
+        PngFilter::Adaptive,
+    ];
+    let mut images = vec![ImageKind::BaselineJpeg; args.jpegs];
+    images.extend(std::iter::repeat_n(ImageKind::ProgressiveJpeg, args.progressive_jpegs));
+    images.extend((0..args.pngs).map(|idx| ImageKind::Png(FILTERS[idx % FILTERS.len()])));
+
+    let spec = BookSpec {
+        chapters: args.chapters,
+        paragraphs: args.paragraphs,
+        css_rules: args.css_rules,
+        nesting: args.nesting,
+        images,
+        compression: if args.stored { Compression::Stored } else { Compression::Deflate },
+        seed: args.seed,
+        ..BookSpec::new(name)
+    };
+    std::fs::create_dir_all(output).expect("Failed to create output directory");
+    let path = output.join(name).with_extension("epub");
+    std::fs::write(&path, corpus::build_book(&spec)).expect("Failed to write book");
+    info!("Wrote {}", path.display());
+}
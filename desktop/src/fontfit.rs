@@ -0,0 +1,58 @@
+use log::info;
+use trusty_core::res::font::{Font, FontDefinition, FontSize, FontStyle};
+use trusty_desktop::{fontsrc, optical};
+
+/// Fit kerning and the fi and fl ligatures to the compiled-in fonts from
+/// their glyph bitmaps, for when the font files fontgen needs aren't at
+/// hand. Rewrites the sources in the font directory.
+#[derive(argh::FromArgs)]
+struct Args {
+    /// font source directory
+    #[argh(positional)]
+    output: String,
+}
+
+const STYLES: [(FontStyle, &str); 4] = [
+    (FontStyle::Regular, "Bookerly"),
+    (FontStyle::Bold, "Bookerly Bold"),
+    (FontStyle::Italic, "Bookerly Italic"),
+    (FontStyle::BoldItalic, "Bookerly Bold Italic"),
+];
+
+fn main() {
+    env_logger::Builder::from_env(env_logger::Env::default().default_filter_or("info")).init();
+
+    let args: Args = argh::from_env();
+
+    for (style, name) in STYLES {
+        for size in FontSize::ALL {
+            let px: u8 = size.repr().parse().unwrap();
+            let font = Font::bookerly(size).definition(style);
+            let fitted = optical::fit(font, px as u32);
+            let kerning: Vec<&[i8]> = fitted.kerning.iter().map(Vec::as_slice).collect();
+            let fitted_font = FontDefinition {
+                size: fitted.bitmap.len() as u32,
+                y_advance: font.y_advance,
+                glyphs: &fitted.glyphs,
+                glyph_pages: &fitted.glyph_pages,
+                glyph_blocks: &fitted.glyph_blocks,
+                kerning_classes: &fitted.kerning_classes,
+                kerning: &kerning,
+                bitmap: &fitted.bitmap,
+                pages: None,
+            };
+
+            let file_name = fontsrc::file_name(name, px);
+            info!(
+                "{file_name}: {} glyphs, kerning classes {} left, {} right",
+                fitted.glyphs.len(),
+                kerning.len(),
+                kerning.first().map_or(0, |row| row.len())
+            );
+            let base_path = std::path::Path::new(&args.output).join(&file_name);
+            std::fs::write(base_path.with_extension("rle"), &fitted.bitmap).expect("Failed to write font bitmap file");
+            std::fs::write(base_path.with_extension("rs"), fontsrc::rust_source(name, &file_name, &fitted_font))
+                .expect("Failed to write Rust font file");
+        }
+    }
+}
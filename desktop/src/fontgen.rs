@@ -2,8 +2,9 @@ use embedded_graphics::prelude::OriginDimensions;
 use log::{info, trace, warn};
 use trusty_core::{
     framebuffer::{DisplayBuffers, HEIGHT, WIDTH},
-    res::font::{FontDefinition, Glyph, Mode, draw_glyph},
+    res::font::{FontDefinition, FontStyle, Glyph, Mode, build_glyph_index, draw_glyph},
 };
+use trusty_desktop::fontsrc::{class_kerning, encode_bitmap, file_name, rust_source};
 
 /// CLI Arguments
 #[derive(argh::FromArgs)]
@@ -23,6 +24,14 @@ struct Args {
     /// font size
     #[argh(option, default = "vec![26.0]", short = 's')]
     font_size: Vec<f32>,
+
+    /// include the fi and fl ligatures
+    #[argh(switch)]
+    ligatures: bool,
+
+    /// also write font files to install in the fonts directory of the SD card
+    #[argh(switch)]
+    sd_card: bool,
 }
 
 fn main() {
@@ -30,30 +39,33 @@ fn main() {
 
     let args: Args = argh::from_env();
 
-    let characters = load_chars(args.character_file.as_deref());
+    let mut characters = load_chars(args.character_file.as_deref());
+    if args.ligatures {
+        characters.extend(LIGATURES);
+        characters.sort_unstable();
+        characters.dedup();
+    }
 
     for input in &args.input {
-        generate_font(input, &args.font_size, &characters, &args.output);
+        generate_font(input, &args.font_size, &characters, &args.output, args.sd_card);
     }
 }
 
-fn generate_font(font_path: &str, sizes: &[f32], characters: &[char], out_path: &str) {
+fn generate_font(font_path: &str, sizes: &[f32], characters: &[char], out_path: &str, sd_card: bool) {
     let font_file = std::fs::read(font_path).expect("Failed to read input font file");
     let font = fontdue::Font::from_bytes(font_file.as_slice(), fontdue::FontSettings::default())
         .expect("Failed to parse font file");
 
     for &size in sizes {
-        generate_font_size(&font, size, characters, out_path);
+        generate_font_size(&font, size, characters, out_path, sd_card);
         analyze_font_metrics(&font, size);
     }
 }
 
-fn generate_font_size(font: &fontdue::Font, font_size: f32, characters: &[char], out_path: &str) {
+fn generate_font_size(font: &fontdue::Font, font_size: f32, characters: &[char], out_path: &str, sd_card: bool) {
     let mut glyphs = Vec::new();
-    let mut bw_buffer: Vec<u8> = Vec::new();
-    let mut msb_buffer: Vec<u8> = Vec::new();
-    let mut lsb_buffer: Vec<u8> = Vec::new();
-    let mut bitmap_index = 0u16;
+    let mut bitmap_buffer: Vec<u8> = Vec::new();
+    let mut glyph_chars = Vec::new();
 
     for &ch in characters {
         if !font.has_glyph(ch) {
@@ -66,8 +78,8 @@ fn generate_font_size(font: &fontdue::Font, font_size: f32, characters: &[char],
             ch, metrics.width, metrics.height, metrics.advance_width, metrics.xmin, metrics.ymin
         );
         let glyph = Glyph::new(
-            ch as u16,
-            bitmap_index,
+            ch as u32,
+            bitmap_buffer.len() as u32,
             metrics.advance_width.ceil() as u8,
             metrics.width as u8,
             metrics.height as u8,
@@ -75,112 +87,98 @@ fn generate_font_size(font: &fontdue::Font, font_size: f32, characters: &[char],
             metrics.ymin as i8,
         );
         glyphs.push(glyph);
-        let new_size = bitmap_index as usize + bitmap.len().div_ceil(8);
-        bw_buffer.resize(new_size, 0u8);
-        msb_buffer.resize(new_size, 0u8);
-        lsb_buffer.resize(new_size, 0u8);
-        for (idx, &byte) in bitmap.iter().enumerate() {
-            let byte = 255 - byte;
-            let (bw, msb, lsb) = if byte >= 205 {
-                (1u8, 0u8, 0u8)
-            } else if byte >= 154 {
-                (1u8, 0u8, 1u8)
-            } else if byte >= 103 {
-                (0u8, 1u8, 0u8)
-            } else if byte >= 52 {
-                (0u8, 1u8, 1u8)
-            } else {
-                (0u8, 0u8, 0u8)
-            };
-            let byte_idx = bitmap_index as usize + idx / 8;
-            let bit_idx = 7 - (idx % 8);
-            bw_buffer.get_mut(byte_idx).map(|b| *b |= bw << bit_idx);
-            msb_buffer.get_mut(byte_idx).map(|b| *b |= msb << bit_idx);
-            lsb_buffer.get_mut(byte_idx).map(|b| *b |= lsb << bit_idx);
-        }
-        let bytes = bitmap.len().div_ceil(8);
-        bitmap_index += bytes as u16;
+        glyph_chars.push(ch);
+        let levels: Vec<u8> = bitmap
+            .iter()
+            .map(|&coverage| match 255 - coverage {
+                205.. => 0,
+                154.. => 1,
+                103.. => 2,
+                52.. => 3,
+                _ => 4,
+            })
+            .collect();
+        encode_bitmap(&levels, &mut bitmap_buffer);
     }
     info!("Glyphs: {}", glyphs.len());
-    info!("Bitmap size (bytes): {}", bw_buffer.len());
-    assert!(bw_buffer.len() == msb_buffer.len() && bw_buffer.len() == lsb_buffer.len());
+    info!("Bitmap size (bytes): {}", bitmap_buffer.len());
+
+    let (glyph_pages, glyph_blocks) = build_glyph_index(&glyphs).expect("Glyphs must be sorted by codepoint");
+    info!("Glyph index: {} pages, {} blocks", glyph_pages.len(), glyph_blocks.len());
+
+    let (kerning_classes, kerning) = generate_kerning(font, font_size, &glyph_chars);
+    let kerning_rows: Vec<&[i8]> = kerning.iter().map(Vec::as_slice).collect();
+    info!("Kerning classes: {} left, {} right", kerning.len(), kerning.first().map_or(0, Vec::len));
 
     let my_font = FontDefinition {
-        size: bw_buffer.len() as u32,
+        size: bitmap_buffer.len() as u32,
         y_advance: font
             .vertical_line_metrics(font_size)
             .map(|m| m.new_line_size.ceil() as usize)
             .unwrap_or(font_size.ceil() as usize) as u8,
         glyphs: &glyphs,
-        bitmap_bw: &bw_buffer,
-        bitmap_msb: &msb_buffer,
-        bitmap_lsb: &lsb_buffer,
+        glyph_pages: &glyph_pages,
+        glyph_blocks: &glyph_blocks,
+        kerning_classes: &kerning_classes,
+        kerning: &kerning_rows,
+        bitmap: &bitmap_buffer,
+        pages: None,
     };
 
     let name = font.name().expect("Failed to get font name");
-    let file_name = format!(
-        "{}_{}",
-        name.to_ascii_lowercase().replace(" ", "_"),
-        font_size as u8
-    );
+    let file_name = file_name(name, font_size as u8);
     info!("Generating font: {name} as {file_name} at size {font_size}");
     let base_path = std::path::Path::new(&out_path).join(&file_name);
-    std::fs::write(base_path.with_extension("bw"), &bw_buffer)
-        .expect("Failed to write BW font file");
-    std::fs::write(base_path.with_extension("msb"), &msb_buffer)
-        .expect("Failed to write MSB font file");
-    std::fs::write(base_path.with_extension("lsb"), &lsb_buffer)
-        .expect("Failed to write LSB font file");
+    std::fs::write(base_path.with_extension("rle"), &bitmap_buffer)
+        .expect("Failed to write font bitmap file");
+    if sd_card {
+        let (family, style) = family_and_style(name);
+        let mut font_file = Vec::new();
+        my_font
+            .to_file(family, style, font_size as u8, &mut font_file)
+            .expect("Failed to encode font file");
+        std::fs::write(base_path.with_extension("tfn"), &font_file).expect("Failed to write SD card font file");
+    }
 
     let rust_file = base_path.with_extension("rs");
-    let mut rust_code = String::new();
-    rust_code.push_str("// Auto-generated font file\n");
-    rust_code.push_str(&format!("// Font: {}\n\n", name));
-    rust_code.push_str("use crate::res::font::{FontDefinition, Glyph};\n\n");
-    rust_code.push_str(&format!(
-        "pub const FONT: FontDefinition = FontDefinition {{\n"
-    ));
-    rust_code.push_str(&format!("    size: {},\n", my_font.size));
-    rust_code.push_str(&format!("    y_advance: {},\n", my_font.y_advance));
-    rust_code.push_str(&format!("    glyphs: &GLYPHS,\n"));
-    rust_code.push_str(&format!("    bitmap_bw: BITMAP_BW,\n"));
-    rust_code.push_str(&format!("    bitmap_msb: BITMAP_MSB,\n"));
-    rust_code.push_str(&format!("    bitmap_lsb: BITMAP_LSB,\n"));
-    rust_code.push_str("};\n\n");
-    rust_code.push_str(&format!("const GLYPHS: [Glyph; {}] = [\n", glyphs.len()));
-    for glyph in &glyphs {
-        rust_code.push_str(&format!(
-            "    Glyph::new(0x{:04X}, 0x{:04X}, {}, {}, {}, {}, {}),\n",
-            glyph.codepoint,
-            glyph.bitmap_index,
-            glyph.x_advance(),
-            glyph.width(),
-            glyph.height(),
-            glyph.xmin(),
-            glyph.ymin()
-        ));
-    }
-    rust_code.push_str("];\n\n");
-    rust_code.push_str(&format!(
-        "const BITMAP_BW: &[u8; {}] = include_bytes!(\"./{}.bw\");\n",
-        bw_buffer.len(),
-        file_name
-    ));
-    rust_code.push_str(&format!(
-        "const BITMAP_MSB: &[u8; {}] = include_bytes!(\"./{}.msb\");\n",
-        msb_buffer.len(),
-        file_name
-    ));
-    rust_code.push_str(&format!(
-        "const BITMAP_LSB: &[u8; {}] = include_bytes!(\"./{}.lsb\");\n",
-        lsb_buffer.len(),
-        file_name
-    ));
+    let rust_code = rust_source(name, &file_name, &my_font);
     std::fs::write(&rust_file, rust_code).expect("Failed to write Rust font file");
 
     test_font_drawing(&my_font);
 }
 
+/// Family and style of a full font name like "Bookerly Bold Italic".
+fn family_and_style(name: &str) -> (&str, FontStyle) {
+    let styles = [
+        (" Bold Italic", FontStyle::BoldItalic),
+        (" Bold", FontStyle::Bold),
+        (" Italic", FontStyle::Italic),
+        (" Regular", FontStyle::Regular),
+    ];
+    styles
+        .iter()
+        .find_map(|&(suffix, style)| Some((name.strip_suffix(suffix)?, style)))
+        .unwrap_or((name, FontStyle::Regular))
+}
+
+/// The class kerning table of the font's pair adjustments at `font_size`,
+/// rounded to whole pixels, see [`class_kerning`].
+fn generate_kerning(font: &fontdue::Font, font_size: f32, chars: &[char]) -> (Vec<(u8, u8)>, Vec<Vec<i8>>) {
+    let pairs: Vec<Vec<i8>> = chars
+        .iter()
+        .map(|&left| {
+            chars
+                .iter()
+                .map(|&right| {
+                    let kern = font.horizontal_kern(left, right, font_size).unwrap_or(0.0).round();
+                    kern.clamp(i8::MIN as f32, i8::MAX as f32) as i8
+                })
+                .collect()
+        })
+        .collect();
+    class_kerning(&pairs)
+}
+
 fn test_font_drawing(font: &FontDefinition) {
     info!("testing font draw");
     let mut fb_bw = Box::new(DisplayBuffers::default());
@@ -331,6 +329,8 @@ fn analyze_font_metrics(font: &fontdue::Font, font_size: f32) {
     info!("Ymin Range: {} to {}", min_ymin, max_ymin);
 }
 
+const LIGATURES: [char; 2] = ['\u{FB01}', '\u{FB02}'];
+
 const DEFAULT_CHARACTERS: &str = r##" !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~¡¢£¤¥§©ª«®°±²³µ¶·¹º»¼½¾¿ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÞßàáâãäåæçèéêëìíîïðñòóôõö÷øùúûüþÿĄąĆćČčĎďĘęĚěĹĺĽľŁłŃńŇňŒœŘřŚśŠšŤťŮůŰűŸŹźŻżŽžπẞ–—’†‡•…‹›⁰⁴⁵⁶⁷⁸⁹₀₁₂₃₄₅₆₇₈₉₩₪€₴₹₽™⅓⅔⅛⅜⅝⅞←↑→↓↔↕⇐⇑⇒⇓⇔∂∆∏∑√∞∫≠≤≥─│┌┐└┘├┤┬┴┼═║╔╗╚╝╠╣╦╩╬‘’‚‛“”„‟"##;
 
 fn load_chars(path: Option<&str>) -> Vec<char> {
@@ -0,0 +1,174 @@
+//! The Rust sources of compiled-in fonts, as written by `fontgen` and
+//! `fontfit`.
+
+use trusty_core::res::font::{BITMAP_CODES, FontDefinition, Glyph};
+
+/// Append the coverage `levels` of one glyph as [`BITMAP_CODES`], greedily
+/// taking the longest run that fits. Each glyph starts on a byte boundary.
+pub fn encode_bitmap(levels: &[u8], out: &mut Vec<u8>) {
+    let mut codes = Vec::new();
+    let mut rest = levels;
+    while let Some(&level) = rest.first() {
+        let run = rest.iter().take_while(|&&l| l == level).count();
+        let (code, (_, length)) = BITMAP_CODES
+            .iter()
+            .enumerate()
+            .filter(|(_, (l, length))| *l == level && *length as usize <= run)
+            .max_by_key(|(_, (_, length))| *length)
+            .expect("Every level has a single pixel code");
+        codes.push(code as u8);
+        rest = &rest[*length as usize..];
+    }
+    for pair in codes.chunks(2) {
+        out.push(pair[0] << 4 | pair.get(1).copied().unwrap_or(0));
+    }
+}
+
+/// The coverage level of each pixel of `glyph`, row by row.
+pub fn decode_bitmap(font: &FontDefinition, glyph: &Glyph) -> Vec<u8> {
+    let mut levels = Vec::with_capacity(glyph.pixels());
+    let codes = font.bitmap[glyph.bitmap_index as usize..]
+        .iter()
+        .flat_map(|byte| [byte >> 4, byte & 0xF]);
+    for code in codes {
+        if levels.len() >= glyph.pixels() {
+            break;
+        }
+        let (level, length) = BITMAP_CODES[code as usize];
+        let length = (length as usize).min(glyph.pixels() - levels.len());
+        levels.extend(std::iter::repeat_n(level, length));
+    }
+    levels
+}
+
+/// Build the class kerning table from the adjustment of every glyph pair,
+/// by left glyph, then right glyph. Glyphs with the same adjustments
+/// against every other glyph share a class on that side, so a lookup is
+/// two class loads and one table entry.
+pub fn class_kerning(pairs: &[Vec<i8>]) -> (Vec<(u8, u8)>, Vec<Vec<i8>>) {
+    let columns: Vec<Vec<i8>> = (0..pairs.len()).map(|right| pairs.iter().map(|row| row[right]).collect()).collect();
+    let (left_classes, left_members) = classify(pairs);
+    let (right_classes, right_members) = classify(&columns);
+    if left_members.len() == 1 {
+        return (Vec::new(), Vec::new());
+    }
+
+    let table = left_members
+        .iter()
+        .map(|left| {
+            right_members
+                .iter()
+                .map(|right| match (left, right) {
+                    (Some(left), Some(right)) => pairs[*left][*right],
+                    _ => 0,
+                })
+                .collect()
+        })
+        .collect();
+    (left_classes.into_iter().zip(right_classes).collect(), table)
+}
+
+/// Number the distinct `adjustments`, with class 0 for glyphs that never
+/// kern. Returns each glyph's class and a member of each class.
+fn classify(adjustments: &[Vec<i8>]) -> (Vec<u8>, Vec<Option<usize>>) {
+    let mut members = vec![None];
+    let classes = adjustments
+        .iter()
+        .enumerate()
+        .map(|(glyph, row)| {
+            if row.iter().all(|&adjust| adjust == 0) {
+                return 0;
+            }
+            let class = members
+                .iter()
+                .position(|member| member.is_some_and(|member| adjustments[member] == *row))
+                .unwrap_or_else(|| {
+                    members.push(Some(glyph));
+                    members.len() - 1
+                });
+            u8::try_from(class).expect("Too many kerning classes")
+        })
+        .collect();
+    (classes, members)
+}
+
+/// The file name of `name` at `size`, like `bookerly_bold_26`.
+pub fn file_name(name: &str, size: u8) -> String {
+    format!("{}_{}", name.to_ascii_lowercase().replace(" ", "_"), size)
+}
+
+/// The Rust source of `font`, with its bitmap included from
+/// `<file_name>.rle`.
+pub fn rust_source(name: &str, file_name: &str, font: &FontDefinition) -> String {
+    let mut rust_code = String::new();
+    rust_code.push_str("// Auto-generated font file\n");
+    rust_code.push_str(&format!("// Font: {}\n\n", name));
+    rust_code.push_str("use crate::res::font::{FontDefinition, Glyph, GlyphBlock};\n\n");
+    rust_code.push_str(&format!(
+        "pub const FONT: FontDefinition = FontDefinition {{\n"
+    ));
+    rust_code.push_str(&format!("    size: {},\n", font.size));
+    rust_code.push_str(&format!("    y_advance: {},\n", font.y_advance));
+    rust_code.push_str(&format!("    glyphs: &GLYPHS,\n"));
+    rust_code.push_str(&format!("    glyph_pages: &GLYPH_PAGES,\n"));
+    rust_code.push_str(&format!("    glyph_blocks: &GLYPH_BLOCKS,\n"));
+    rust_code.push_str(&format!("    kerning_classes: &KERNING_CLASSES,\n"));
+    rust_code.push_str(&format!("    kerning: &KERNING,\n"));
+    rust_code.push_str(&format!("    bitmap: BITMAP,\n"));
+    rust_code.push_str(&format!("    pages: None,\n"));
+    rust_code.push_str("};\n\n");
+    rust_code.push_str(&format!("const GLYPHS: [Glyph; {}] = [\n", font.glyphs.len()));
+    for glyph in font.glyphs {
+        rust_code.push_str(&format!(
+            "    Glyph::new(0x{:04X}, 0x{:04X}, {}, {}, {}, {}, {}),\n",
+            glyph.codepoint,
+            glyph.bitmap_index,
+            glyph.x_advance(),
+            glyph.width(),
+            glyph.height(),
+            glyph.xmin(),
+            glyph.ymin()
+        ));
+    }
+    rust_code.push_str("];\n\n");
+    rust_code.push_str(&format!("const GLYPH_PAGES: [u16; {}] = [\n", font.glyph_pages.len()));
+    for chunk in font.glyph_pages.chunks(16) {
+        let row: Vec<String> = chunk
+            .iter()
+            .map(|&page| if page == u16::MAX { "u16::MAX".to_string() } else { page.to_string() })
+            .collect();
+        rust_code.push_str(&format!("    {},\n", row.join(", ")));
+    }
+    rust_code.push_str("];\n\n");
+    rust_code.push_str(&format!("const GLYPH_BLOCKS: [GlyphBlock; {}] = [\n", font.glyph_blocks.len()));
+    for block in font.glyph_blocks {
+        rust_code.push_str(&format!("    GlyphBlock::new({}, 0x{:016X}),\n", block.first, block.present));
+    }
+    rust_code.push_str("];\n\n");
+    if font.kerning_classes.is_empty() {
+        rust_code.push_str("const KERNING_CLASSES: [(u8, u8); 0] = [];\n\n");
+    } else {
+        rust_code.push_str(&format!("const KERNING_CLASSES: [(u8, u8); {}] = [\n", font.kerning_classes.len()));
+        for chunk in font.kerning_classes.chunks(8) {
+            let row: Vec<String> = chunk.iter().map(|(left, right)| format!("({left}, {right})")).collect();
+            rust_code.push_str(&format!("    {},\n", row.join(", ")));
+        }
+        rust_code.push_str("];\n\n");
+    }
+    if font.kerning.is_empty() {
+        rust_code.push_str("const KERNING: [&[i8]; 0] = [];\n\n");
+    } else {
+        rust_code.push_str(&format!("const KERNING: [&[i8]; {}] = [\n", font.kerning.len()));
+        for row in font.kerning {
+            let row: Vec<String> = row.iter().map(|adjust| adjust.to_string()).collect();
+            rust_code.push_str(&format!("    &[{}],\n", row.join(", ")));
+        }
+        rust_code.push_str("];\n\n");
+    }
+    rust_code.push_str(&format!(
+        "const BITMAP: &[u8; {}] = include_bytes!(\"./{}.rle\");\n",
+        font.bitmap.len(),
+        file_name
+    ));
+    rust_code
+}
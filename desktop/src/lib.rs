@@ -1 +1,4 @@
+pub mod corpus;
+pub mod fontsrc;
+pub mod optical;
 pub mod std_fs;
@@ -65,6 +65,7 @@ fn main() {
     while display.is_open() {
         display.update();
         application.update(&display.get_buttons(), charge);
+        application.work();
         application.draw(&mut display);
     }
 }
@@ -294,7 +294,11 @@ impl MinifbDisplay {
 }
 
 impl trusty_core::display::Display for MinifbDisplay {
-    fn display(&mut self, buffers: &mut DisplayBuffers, mode: RefreshMode) {
+    fn display(&mut self, buffers: &mut DisplayBuffers, mut mode: RefreshMode) {
+        if mode == RefreshMode::Fast && !buffers.has_previous() {
+            // The previous frame was overwritten as scratch memory
+            mode = RefreshMode::Half;
+        }
         // revert grayscale first
         if self.is_grayscale {
             self.blit_internal(BlitMode::GrayscaleRevert);
@@ -0,0 +1,243 @@
+//! Kerning and ligatures fitted to rendered glyphs, for fonts whose source
+//! files aren't at hand.
+//!
+//! Kerning is optical: a pair is tightened by about half of how much the closest
+//! ink of the two glyphs is further apart than between straight stems, as
+//! for `AV` or `To`. Pairs are never loosened, the spacing the font was
+//! designed with stays the minimum. The fi and fl ligatures are composed
+//! from the glyphs of `f` and a dotless `i` or `l` set at their kerned
+//! distance.
+
+use trusty_core::res::font::{FontDefinition, Glyph, GlyphBlock, build_glyph_index};
+
+use crate::fontsrc::{class_kerning, decode_bitmap, encode_bitmap};
+
+/// Glyphs whose gap between straight stems is the reference.
+const STEMS: &str = "HIMNhilmnu";
+
+/// Punctuation that is kerned besides letters.
+const PUNCTUATION: &str = ".,;:!?'\"()[]{}-/\u{2013}\u{2014}\u{2018}\u{2019}\u{201A}\u{201C}\u{201D}\u{201E}\u{2026}\u{AB}\u{BB}\u{2039}\u{203A}";
+
+/// Ligatures as `(codepoint, second character, drop the dot of the second)`.
+const LIGATURES: [(u32, char, bool); 2] = [(0xFB01, 'i', true), (0xFB02, 'l', false)];
+
+/// Rows above and below that count as the same height when looking for the
+/// closest ink.
+const BAND: i32 = 1;
+
+/// Coverage level from which a pixel counts as ink.
+const INK: u8 = 2;
+
+/// Extra gap in pixels below which pairs aren't kerned. Pairs with more
+/// are tightened by half of it, rounded down.
+const THRESHOLD: i32 = 2;
+
+/// A font with fitted kerning and ligatures.
+pub struct Fitted {
+    pub glyphs: Vec<Glyph>,
+    pub glyph_pages: Vec<u16>,
+    pub glyph_blocks: Vec<GlyphBlock>,
+    pub kerning_classes: Vec<(u8, u8)>,
+    pub kerning: Vec<Vec<i8>>,
+    pub bitmap: Vec<u8>,
+}
+
+/// The coverage of one glyph in pen coordinates.
+struct Raster {
+    /// Relative to the pen position.
+    left: i32,
+    /// Relative to the baseline, negative above it.
+    top: i32,
+    width: i32,
+    levels: Vec<u8>,
+}
+
+impl Raster {
+    fn new(font: &FontDefinition, glyph: &Glyph) -> Self {
+        Self {
+            left: glyph.xmin() as i32,
+            top: -(glyph.height() as i32 + glyph.ymin() as i32),
+            width: glyph.width() as i32,
+            levels: decode_bitmap(font, glyph),
+        }
+    }
+
+    fn height(&self) -> i32 {
+        if self.width == 0 { 0 } else { self.levels.len() as i32 / self.width }
+    }
+
+    fn level(&self, x: i32, y: i32) -> u8 {
+        let (col, row) = (x - self.left, y - self.top);
+        if col < 0 || col >= self.width || row < 0 || row >= self.height() {
+            return 0;
+        }
+        self.levels[(row * self.width + col) as usize]
+    }
+
+    /// The leftmost and rightmost ink of each row, by baseline-relative y.
+    fn profile(&self) -> Profile {
+        let rows = (0..self.height())
+            .map(|row| {
+                let ink = |col: &i32| self.levels[(row * self.width + col) as usize] >= INK;
+                let first = (0..self.width).find(ink)?;
+                let last = (0..self.width).rev().find(ink)?;
+                Some((self.left + first, self.left + last + 1))
+            })
+            .collect();
+        Profile { top: self.top, rows }
+    }
+
+    /// Without its top part if that is separated from the rest by a blank
+    /// row, like the dot of an `i`.
+    fn without_dot(mut self) -> Self {
+        let blank = |row: i32| (0..self.width).all(|col| self.levels[(row * self.width + col) as usize] == 0);
+        let Some(first) = (0..self.height()).find(|&row| !blank(row)) else {
+            return self;
+        };
+        let Some(gap) = (first..self.height()).find(|&row| blank(row)) else {
+            return self;
+        };
+        let Some(stem) = (gap..self.height()).find(|&row| !blank(row)) else {
+            return self;
+        };
+        self.levels.drain(..(stem * self.width) as usize);
+        self.top += stem;
+        self
+    }
+}
+
+struct Profile {
+    top: i32,
+    rows: Vec<Option<(i32, i32)>>,
+}
+
+impl Profile {
+    fn row(&self, y: i32) -> Option<(i32, i32)> {
+        *self.rows.get(usize::try_from(y - self.top).ok()?)?
+    }
+
+    /// The smallest horizontal distance between the ink of this glyph and
+    /// of `right` set `advance` after it, `None` if they share no rows.
+    fn gap(&self, advance: i32, right: &Profile) -> Option<i32> {
+        let mut gap: Option<i32> = None;
+        for (row, extent) in self.rows.iter().enumerate() {
+            let Some((_, end)) = extent else {
+                continue;
+            };
+            let y = self.top + row as i32;
+            for y in y - BAND..=y + BAND {
+                if let Some((start, _)) = right.row(y) {
+                    let distance = advance + start - end;
+                    gap = Some(gap.map_or(distance, |gap| gap.min(distance)));
+                }
+            }
+        }
+        gap
+    }
+}
+
+fn kerned(codepoint: u32) -> bool {
+    char::from_u32(codepoint).is_some_and(|ch| ch.is_alphabetic() || PUNCTUATION.contains(ch))
+        && !LIGATURES.iter().any(|&(ligature, ..)| ligature == codepoint)
+}
+
+/// Fit kerning to `font`, which is `px` pixels high, and add the ligatures
+/// it doesn't have.
+pub fn fit(font: &FontDefinition, px: u32) -> Fitted {
+    let mut glyphs: Vec<Glyph> = font
+        .glyphs
+        .iter()
+        .map(|glyph| Glyph { codepoint: glyph.codepoint, bitmap_index: glyph.bitmap_index, blob: glyph.blob })
+        .collect();
+    let mut bitmap = font.bitmap.to_vec();
+    let index = |glyphs: &[Glyph], ch: char| glyphs.iter().position(|glyph| glyph.codepoint == ch as u32);
+
+    let profiles: Vec<Profile> = glyphs.iter().map(|glyph| Raster::new(font, glyph).profile()).collect();
+    let gap = |left: usize, right: usize| profiles[left].gap(glyphs[left].x_advance() as i32, &profiles[right]);
+
+    let stems: Vec<usize> = STEMS.chars().filter_map(|ch| index(&glyphs, ch)).collect();
+    let mut reference: Vec<i32> = stems
+        .iter()
+        .flat_map(|&left| stems.iter().filter_map(move |&right| gap(left, right)))
+        .collect();
+    reference.sort_unstable();
+    let reference = reference.get(reference.len() / 2).copied().unwrap_or(0);
+    let limit = (px / 12) as i32;
+
+    let mut pairs: Vec<Vec<i8>> = (0..glyphs.len())
+        .map(|left| {
+            (0..glyphs.len())
+                .map(|right| {
+                    if !kerned(glyphs[left].codepoint) || !kerned(glyphs[right].codepoint) {
+                        return 0;
+                    }
+                    let extra = gap(left, right).map_or(0, |gap| gap - reference);
+                    if extra < THRESHOLD {
+                        return 0;
+                    }
+                    -(extra / 2).min(limit) as i8
+                })
+                .collect()
+        })
+        .collect();
+
+    for (codepoint, next, dotless) in LIGATURES {
+        let (Some(f), Some(second)) = (index(&glyphs, 'f'), index(&glyphs, next)) else {
+            continue;
+        };
+        let ligature = match glyphs.iter().position(|glyph| glyph.codepoint == codepoint) {
+            Some(ligature) => ligature,
+            None => {
+                let offset = glyphs[f].x_advance() as i32 + pairs[f][second] as i32;
+                let first = Raster::new(font, &glyphs[f]);
+                let second_raster = Raster::new(font, &glyphs[second]);
+                let second_raster = if dotless { second_raster.without_dot() } else { second_raster };
+                let advance = (offset + glyphs[second].x_advance() as i32) as u8;
+                let glyph = compose(codepoint, advance, &first, &second_raster, offset, &mut bitmap);
+                let at = glyphs.partition_point(|glyph| glyph.codepoint < codepoint);
+                glyphs.insert(at, glyph);
+                for row in &mut pairs {
+                    row.insert(at, 0);
+                }
+                pairs.insert(at, vec![0; glyphs.len()]);
+                at
+            }
+        };
+        // The ligature kerns like `f` on its left and like the second
+        // character on its right
+        let (f, second) = (index(&glyphs, 'f').unwrap(), index(&glyphs, next).unwrap());
+        pairs[ligature] = pairs[second].clone();
+        for row in &mut pairs {
+            row[ligature] = row[f];
+        }
+    }
+
+    let (kerning_classes, kerning) = class_kerning(&pairs);
+    let (glyph_pages, glyph_blocks) = build_glyph_index(&glyphs).expect("Glyphs must be sorted by codepoint");
+    Fitted { glyphs, glyph_pages, glyph_blocks, kerning_classes, kerning, bitmap }
+}
+
+/// Set `second` `offset` after `first` as one glyph, appending its bitmap.
+fn compose(codepoint: u32, advance: u8, first: &Raster, second: &Raster, offset: i32, bitmap: &mut Vec<u8>) -> Glyph {
+    let left = first.left.min(offset + second.left);
+    let right = (first.left + first.width).max(offset + second.left + second.width);
+    let top = first.top.min(second.top);
+    let bottom = (first.top + first.height()).max(second.top + second.height());
+    let mut levels = Vec::with_capacity(((right - left) * (bottom - top)) as usize);
+    for y in top..bottom {
+        for x in left..right {
+            levels.push(first.level(x, y).max(second.level(x - offset, y)));
+        }
+    }
+    let glyph = Glyph::new(
+        codepoint,
+        bitmap.len() as u32,
+        advance,
+        (right - left) as u8,
+        (bottom - top) as u8,
+        left as i8,
+        -bottom as i8,
+    );
+    encode_bitmap(&levels, bitmap);
+    glyph
+}
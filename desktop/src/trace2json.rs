@@ -0,0 +1,93 @@
+use std::fmt::Write;
+
+use argh::FromArgs;
+
+#[derive(FromArgs)]
+/// Convert a `trace` dump from the X4 serial log into a Chrome trace
+/// (chrome://tracing or ui.perfetto.dev)
+struct Args {
+    /// serial log containing the dump
+    #[argh(option, short = 'i')]
+    input_path: String,
+
+    /// output JSON file path
+    #[argh(option, short = 'o')]
+    output_path: String,
+}
+
+/// A span with its start and end in microseconds.
+struct Event<'a> {
+    name: &'a str,
+    start: f64,
+    end: f64,
+    heap: u32,
+}
+
+fn main() {
+    let args: Args = argh::from_env();
+
+    let log = std::fs::read_to_string(&args.input_path).expect("Failed to read serial log");
+
+    let mut clock_hz = 1_000_000u64;
+    let mut events = Vec::new();
+    for line in log.lines() {
+        let Some((_, record)) = line.split_once("trace: ") else {
+            continue;
+        };
+        let mut fields = record.split_whitespace();
+        match fields.next() {
+            // Every dump starts with the clock, only keep the last one
+            Some("clock") => {
+                clock_hz = fields.next().and_then(|hz| hz.parse().ok()).expect("Invalid clock line");
+                events.clear();
+            }
+            Some("span") => {
+                let (Some(name), Some(end), Some(ticks), Some(heap)) =
+                    (fields.next(), fields.next(), fields.next(), fields.next())
+                else {
+                    continue;
+                };
+                let (Ok(end), Ok(ticks), Ok(heap)) = (end.parse::<u64>(), ticks.parse::<u32>(), heap.parse()) else {
+                    continue;
+                };
+                // The end is in microseconds, the duration in clock ticks
+                let end = end as f64;
+                let start = end - ticks as f64 * 1_000_000.0 / clock_hz as f64;
+                events.push(Event { name, start, end, heap });
+            }
+            _ => {}
+        }
+    }
+
+    let origin = events.iter().map(|e| e.start).fold(f64::INFINITY, f64::min);
+    let micros = |time: f64| time - origin;
+
+    let mut json = String::from("{\"traceEvents\":[\n");
+    for (idx, event) in events.iter().enumerate() {
+        if idx > 0 {
+            json.push_str(",\n");
+        }
+        write!(
+            json,
+            "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":{:.3},\"dur\":{:.3}}}",
+            event.name,
+            micros(event.start),
+            micros(event.end) - micros(event.start),
+        )
+        .unwrap();
+        // Only the spans that sample the heap carry it
+        if event.heap > 0 {
+            write!(
+                json,
+                ",\n{{\"name\":\"heap\",\"ph\":\"C\",\"pid\":0,\"ts\":{:.3},\"args\":{{\"max_usage\":{}}}}}",
+                micros(event.end),
+                event.heap,
+            )
+            .unwrap();
+        }
+    }
+    json.push_str("\n]}\n");
+
+    std::fs::write(&args.output_path, json).expect("Failed to write trace");
+    println!("Wrote {} spans to {}", events.len(), args.output_path);
+}
@@ -1,10 +1,9 @@
 use criterion::{black_box, criterion_group, criterion_main, Criterion};
 
-use embedded_io::Read;
 use embedded_xml::{Event, Reader};
 
 /// Consume every event from the reader, return the count.
-fn drain_events<T: Read>(mut reader: Reader<T, &mut [u8]>) -> usize {
+fn drain_events(mut reader: Reader<&mut [u8]>) -> usize {
     let mut count = 0usize;
     loop {
         match reader.next_event().unwrap() {
@@ -37,8 +36,74 @@ fn bench_stream_parse(c: &mut Criterion) {
     });
 }
 
+// ---------------------------------------------------------------------------
+// Benchmark: look up styling attributes on attribute-heavy XHTML elements
+// ---------------------------------------------------------------------------
+fn bench_extract_attributes(c: &mut Criterion) {
+    let fragment = r#"<p xml:lang="en" dir="ltr" data-page="12" class="calibre_3" id="p12" style="text-indent: 1em">Text</p>"#;
+    let mut data = String::new();
+    for _ in 0..2000 {
+        data.push_str(fragment);
+    }
+    let bytes = data.into_bytes();
+    let total = bytes.len();
+    let mut buf = vec![0u8; 4096];
+
+    c.bench_function("extract_attributes_2k_elements", |b| {
+        b.iter(|| {
+            let mut slice: &[u8] = black_box(&bytes);
+            let mut reader = Reader::new_borrowed(&mut slice, total, &mut buf).unwrap();
+            let mut found = 0usize;
+            loop {
+                match reader.next_event().unwrap() {
+                    Event::StartElement { attrs, .. } => {
+                        let values = attrs.extract(["id", "class", "style"]);
+                        found += values.iter().flatten().count();
+                    }
+                    Event::EndOfFile => break,
+                    _ => {}
+                }
+            }
+            black_box(found)
+        })
+    });
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: text-heavy XHTML, validating per event vs. once per read
+// ---------------------------------------------------------------------------
+fn bench_validate_on_read(c: &mut Criterion) {
+    let fragment = "<p class=\"calibre\">It was the best of times, it was the worst of times, \
+        it was the age of wisdom, it was the age of foolishness \u{2014} \u{201c}Grüße\u{201d}.</p>\n";
+    let mut data = String::new();
+    for _ in 0..2000 {
+        data.push_str(fragment);
+    }
+    let bytes = data.into_bytes();
+    let total = bytes.len();
+    let mut buf = vec![0u8; 4096];
+
+    c.bench_function("text_2k_paragraphs_validate_per_event", |b| {
+        b.iter(|| {
+            let mut slice: &[u8] = black_box(&bytes);
+            let reader = Reader::new_borrowed(&mut slice, total, &mut buf).unwrap();
+            black_box(drain_events(reader))
+        })
+    });
+    c.bench_function("text_2k_paragraphs_validate_on_read", |b| {
+        b.iter(|| {
+            let mut slice: &[u8] = black_box(&bytes);
+            let mut reader = Reader::new_borrowed(&mut slice, total, &mut buf).unwrap();
+            reader.validate_on_read().unwrap();
+            black_box(drain_events(reader))
+        })
+    });
+}
+
 criterion_group!(
     benches,
     bench_stream_parse,
+    bench_extract_attributes,
+    bench_validate_on_read,
 );
 criterion_main!(benches);
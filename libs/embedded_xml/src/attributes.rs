@@ -53,6 +53,30 @@ impl<'a> AttributeReader<'a> {
         }
         None
     }
+
+    /// Case-insensitive search for several attributes in one pass over the
+    /// block. Returns the value of each name or None, like [`Self::get`].
+    /// ```
+    /// # use embedded_xml::AttributeReader;
+    /// let reader = AttributeReader::from_block(r#"class="c" ID='x' style="s""#);
+    /// assert_eq!(reader.extract(["id", "class", "title"]), [Some("x"), Some("c"), None]);
+    /// ```
+    pub fn extract<const N: usize>(&self, names: [&str; N]) -> [Option<&'a str>; N] {
+        let mut values = [None; N];
+        let mut missing = N;
+        for (n, v) in self.clone() {
+            if missing == 0 {
+                break;
+            }
+            for (name, value) in names.iter().zip(&mut values) {
+                if value.is_none() && n.eq_ignore_ascii_case(name) {
+                    *value = Some(v);
+                    missing -= 1;
+                }
+            }
+        }
+        values
+    }
 }
 
 impl<'a> Iterator for AttributeReader<'a> {
@@ -102,4 +126,12 @@ mod tests {
         assert_eq!(reader.next(), Some(("style", "text-align: center")));
         assert_eq!(reader.next(), None);
     }
+
+    #[test]
+    fn extract() {
+        let reader = AttributeReader::from_block(r#"id="a" class="b" id="c""#);
+        // The first occurrence wins, as with get
+        assert_eq!(reader.extract(["class", "id"]), [Some("b"), Some("a")]);
+        assert_eq!(reader.extract(["style"]), [None]);
+    }
 }
@@ -34,7 +34,7 @@ loop {
 - no rewinding
 - no DTD support
 - no XPath
-- no decoding
+- text is only decoded on request, see `decode_text`
 - individual "Events" have to fit inside the internal buffer
 */
 
@@ -45,6 +45,9 @@ loop {
 mod reader;
 mod attributes;
 mod events;
+mod tags;
+#[cfg(feature = "alloc")]
+mod text;
 
 #[cfg(test)]
 mod tests;
@@ -55,9 +58,13 @@ extern crate alloc;
 pub use events::Event;
 pub use reader::Reader;
 pub use attributes::AttributeReader;
+pub use tags::TagTable;
+#[cfg(feature = "alloc")]
+pub use text::{decode_text, Whitespace};
 
 #[cfg(feature = "alloc")]
 pub type OwnedReader<'a> = Reader<'a, alloc::vec::Vec<u8>>;
+pub type BorrowedReader<'a> = Reader<'a, &'a mut [u8]>;
 
 #[derive(Debug)]
 pub enum Error {
@@ -4,6 +4,7 @@ use memchr::arch::all::rabinkarp::Finder;
 use crate::Result;
 use crate::attributes::AttributeReader;
 use crate::events::Event;
+use crate::tags::TagTable;
 
 use core::ops::Range;
 
@@ -24,8 +25,18 @@ pub trait ReadBytes {
 }
 
 impl<R: embedded_io::Read> ReadBytes for R {
+    /// Fills `buf` unless the reader runs out first. The parser assumes every
+    /// refill tops up the whole buffer, so short reads must not end early.
     fn read_bytes(&mut self, buf: &mut [u8]) -> Result<usize> {
-        self.read(buf).map_err(|e| crate::Error::IoError(e.kind()))
+        let mut filled = 0;
+        while filled < buf.len() {
+            match self.read(&mut buf[filled..]) {
+                Ok(0) => break,
+                Ok(n) => filled += n,
+                Err(e) => return Err(crate::Error::IoError(e.kind())),
+            }
+        }
+        Ok(filled)
     }
 }
 
@@ -89,6 +100,9 @@ pub struct Reader<'a, Buffer> {
     pos: usize,
     end: usize,
     self_closing: Option<Range<usize>>,
+    /// End of the buffer contents known to be valid UTF-8 if validating on
+    /// read. Only an incomplete character can follow it.
+    checked: Option<usize>,
 }
 
 impl<'a> Reader<'a, &'a mut [u8]> {
@@ -138,9 +152,35 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
             pos: 0,
             end,
             self_closing: None,
+            checked: None,
         })
     }
 
+    /// Validates UTF-8 once whenever the buffer is refilled instead of for
+    /// every event, which is cheaper for text-heavy documents. The rest of
+    /// the document has to be UTF-8 then, including CDATA sections, and
+    /// invalid data fails the read that brings it in.
+    ///
+    /// # Examples
+    /// ```
+    /// # use embedded_xml as xml;
+    /// # fn main() -> Result<(), xml::Error> {
+    /// # let xml = "<p>Grüße</p>";
+    /// # let mut reader = xml.as_bytes();
+    /// # let mut buffer = [0u8; 256];
+    /// let mut reader = xml::Reader::new_borrowed(&mut reader, xml.len(), &mut buffer)?;
+    /// reader.validate_on_read()?;
+    /// assert!(matches!(reader.next_event()?, xml::Event::StartElement { name: "p", .. }));
+    /// assert!(matches!(reader.next_event()?, xml::Event::Text { content: "Grüße" }));
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn validate_on_read(&mut self) -> Result<()> {
+        let valid = utf8_prefix(self.buffer(), self.remaining == 0)?;
+        self.checked = Some(self.pos + valid);
+        Ok(())
+    }
+
     /// Advances the reader to the next event and returns it.
     ///
     /// # Examples
@@ -177,9 +217,10 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
             return Ok(Event::EndOfFile);
         }
 
+        let validated = self.checked.is_some();
         if let Some(range) = self.self_closing.take() {
             let block = &self.buffer.as_ref()[range].trim_ascii();
-            let name = core::str::from_utf8(block)?
+            let name = as_str(validated, block)?
                 .split_ascii_whitespace()
                 .next()
                 .ok_or(crate::Error::InvalidState)?;
@@ -195,7 +236,7 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
         let curr = self.buffer()[..curr_end].trim_ascii();
         if !curr.is_empty() {
             let block = &self.buffer.as_ref()[self.pos..self.pos + curr_end];
-            let content = core::str::from_utf8(block)?;
+            let content = as_str(validated, block)?;
             self.pos += curr_end;
             return Ok(Event::Text { content });
         }
@@ -243,20 +284,20 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
         let event = match ty {
             BlockType::Cdata => Event::CDATA { data: block },
             BlockType::Comment => Event::Comment {
-                content: core::str::from_utf8(block)?,
+                content: as_str(validated, block)?,
             },
             BlockType::Dtd => Event::Dtd {
-                content: core::str::from_utf8(block)?,
+                content: as_str(validated, block)?,
             },
             BlockType::PI => {
-                let (name, attrs) = Self::name_and_attrs(block)?;
+                let (name, attrs) = Self::name_and_attrs(validated, block)?;
                 Event::ProcessingInstruction { name, attrs }
             }
             BlockType::EndElement => Event::EndElement {
-                name: core::str::from_utf8(block)?,
+                name: as_str(validated, block)?,
             },
             BlockType::StartElement => {
-                let (name, attrs) = Self::name_and_attrs(block)?;
+                let (name, attrs) = Self::name_and_attrs(validated, block)?;
                 Event::StartElement { name, attrs }
             }
         };
@@ -264,8 +305,124 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
         Ok(event)
     }
 
-    fn name_and_attrs(block: &[u8]) -> Result<(&str, AttributeReader<'_>)> {
-        let block = core::str::from_utf8(block)?;
+    /// Like [`Self::next_event`], but also looks up the name of start and end
+    /// elements in `tags`, so callers can dispatch on the id.
+    ///
+    /// # Examples
+    /// ```
+    /// # use embedded_xml as xml;
+    /// # fn main() -> Result<(), xml::Error> {
+    /// # let xml = "<body><p>Text</p></body>";
+    /// # let mut reader = xml.as_bytes();
+    /// # let mut buffer = [0u8; 256];
+    /// # let mut reader = xml::Reader::new_borrowed(&mut reader, xml.len(), &mut buffer)?;
+    /// const TAGS: xml::TagTable<2> = xml::TagTable::new(["body", "p"]);
+    /// let (tag, _) = reader.next_tagged(&TAGS)?;
+    /// assert_eq!(tag, Some(0));
+    /// let (tag, event) = reader.next_tagged(&TAGS)?;
+    /// assert_eq!(tag, Some(1));
+    /// assert!(matches!(event, xml::Event::StartElement { name: "p", .. }));
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn next_tagged<const N: usize>(&mut self, tags: &TagTable<N>) -> Result<(Option<u8>, Event<'_>)> {
+        let event = self.next_event()?;
+        let tag = match &event {
+            Event::StartElement { name, .. } | Event::EndElement { name } => tags.get(name),
+            _ => None,
+        };
+        Ok((tag, event))
+    }
+
+    /// Skips the rest of the element whose start was just returned, up to and
+    /// including its end. Only looks for `<` and the end of each markup block
+    /// to track depth, so text and attributes are neither validated nor parsed.
+    /// Reaching the end of the file while skipping is not an error.
+    ///
+    /// # Examples
+    /// ```
+    /// # use embedded_xml as xml;
+    /// # fn main() -> Result<(), xml::Error> {
+    /// # let xml = "<root><svg><g><path d=\"M0 0\"/></g></svg><p>Text</p></root>";
+    /// # let mut reader = xml.as_bytes();
+    /// # let mut buffer = [0u8; 256];
+    /// # let mut reader = xml::Reader::new_borrowed(&mut reader, xml.len(), &mut buffer)?;
+    /// assert!(matches!(reader.next_event()?, xml::Event::StartElement { name: "root", .. }));
+    /// assert!(matches!(reader.next_event()?, xml::Event::StartElement { name: "svg", .. }));
+    /// reader.skip_element()?;
+    /// assert!(matches!(reader.next_event()?, xml::Event::StartElement { name: "p", .. }));
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn skip_element(&mut self) -> Result<()> {
+        if self.self_closing.take().is_some() {
+            return Ok(());
+        }
+        match self.skip_to_depth_zero() {
+            Err(crate::Error::Eof) => {
+                self.pos = self.end;
+                Ok(())
+            }
+            result => result,
+        }
+    }
+
+    fn skip_to_depth_zero(&mut self) -> Result<()> {
+        let mut depth = 1u32;
+        while depth > 0 {
+            loop {
+                if let Some(pos) = memchr::memchr(b'<', self.buffer()) {
+                    self.pos += pos;
+                    break;
+                }
+                self.advance(self.end)?;
+            }
+            self.ensure(3)?;
+            let b = self.buffer();
+            let kind = b[1];
+            let n_end = match (kind, b[2]) {
+                (b'!', b'[') => N_CDATA.1,
+                (b'!', b'-') => N_COMMENT.1,
+                (b'!', _) => N_DTD.1,
+                (b'?', _) => N_PI.1,
+                (b'/', _) => {
+                    depth -= 1;
+                    N_END_ELEMENT.1
+                }
+                (_, _) => N_START_ELEMENT.1,
+            };
+            let end = self.skip_past(&n_end)?;
+            if matches!(kind, b'!' | b'?' | b'/') {
+                continue;
+            }
+            if self.buffer.as_ref()[end - 1] != b'/' {
+                depth += 1;
+            }
+        }
+        Ok(())
+    }
+
+    /// Moves past the next occurrence of `needle`, discarding everything
+    /// before it. Returns the buffer index the needle was found at.
+    fn skip_past(&mut self, needle: &Needle) -> Result<usize> {
+        // Searching starts behind the `<` so a `>` is never at index 0.
+        let mut from = 1;
+        loop {
+            if let Some(pos) = needle.find(&self.buffer()[from..]) {
+                let at = self.pos + from + pos;
+                self.pos = at + needle.len();
+                return Ok(at);
+            }
+            // Keep enough to find a needle split across reads, and the byte
+            // before a `>` to tell self-closing tags apart.
+            let keep = needle.len().min(self.buffer().len());
+            self.advance(self.end - keep)?;
+            from = 0;
+        }
+    }
+
+    fn name_and_attrs(validated: bool, block: &[u8]) -> Result<(&str, AttributeReader<'_>)> {
+        let block = as_str(validated, block)?;
 
         if let Some((name, rest)) = block.split_once(|c: char| c.is_ascii_whitespace()) {
             Ok((name, AttributeReader::from_block(rest)))
@@ -286,6 +443,17 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
         }
         assert!(offset <= self.end);
         assert!(offset <= self.buffer.as_ref().len());
+        // Keep the start of a character split by the previous read if it is
+        // about to be dropped, so it can still be checked as a whole.
+        let mut split = [0u8; 4];
+        let split_len = match self.checked {
+            Some(checked) if checked < offset => {
+                split[..self.end - checked].copy_from_slice(&self.buffer.as_ref()[checked..self.end]);
+                self.end - checked
+            }
+            _ => 0,
+        };
+        let old_end = self.end;
         trace!("Copying {} bytes to start of buffer", self.end - offset);
         self.buffer.as_mut().copy_within(offset..self.end, 0);
         self.pos = 0;
@@ -296,6 +464,21 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
             .read_bytes(&mut self.buffer.as_mut()[data_start..])?;
         self.end += read_bytes;
         self.remaining -= read_bytes;
+        if let Some(checked) = self.checked {
+            let start = if split_len > 0 {
+                // The rest of the split character starts where the read did.
+                let width = utf8_width(split[0]);
+                let next = old_end - offset;
+                let missing = (width - split_len).min(self.end - next);
+                split[split_len..split_len + missing].copy_from_slice(&self.buffer.as_ref()[next..next + missing]);
+                utf8_prefix(&split[..split_len + missing], true)?;
+                next + missing
+            } else {
+                checked - offset
+            };
+            let valid = utf8_prefix(&self.buffer.as_ref()[start..self.end], self.remaining == 0)?;
+            self.checked = Some(start + valid);
+        }
         trace!(
             "Read {read_bytes} bytes, new buffer len: {}, remaining: {}",
             self.buffer().len(),
@@ -369,6 +552,49 @@ impl<'a, Buffer: AsRef<[u8]> + AsMut<[u8]>> Reader<'a, Buffer> {
     }
 }
 
+/// Blocks start and end at ASCII delimiters, so once the buffer has been
+/// validated on read every block is valid UTF-8 on its own.
+fn as_str(validated: bool, block: &[u8]) -> Result<&str> {
+    if validated {
+        // SAFETY: the block lies before the checked end of the buffer and
+        // does not split a character.
+        Ok(unsafe { core::str::from_utf8_unchecked(block) })
+    } else {
+        Ok(core::str::from_utf8(block)?)
+    }
+}
+
+/// Returns how many leading bytes are valid UTF-8. Unless `at_end`, an
+/// incomplete character at the end is left for the next read.
+fn utf8_prefix(bytes: &[u8], at_end: bool) -> Result<usize> {
+    // Books are mostly ASCII, so skip that a word at a time before handing
+    // the rest to the full validator.
+    const WORD: usize = core::mem::size_of::<usize>();
+    const HIGH_BITS: usize = usize::MAX / 0xff * 0x80;
+    let mut ascii = 0;
+    for chunk in bytes.chunks_exact(WORD) {
+        if usize::from_ne_bytes(chunk.try_into().unwrap()) & HIGH_BITS != 0 {
+            break;
+        }
+        ascii += WORD;
+    }
+    match core::str::from_utf8(&bytes[ascii..]) {
+        Ok(_) => Ok(bytes.len()),
+        Err(e) if e.error_len().is_none() && !at_end => Ok(ascii + e.valid_up_to()),
+        Err(e) => Err(e.into()),
+    }
+}
+
+/// Length of the character started by a valid lead byte.
+fn utf8_width(lead: u8) -> usize {
+    match lead {
+        ..0x80 => 1,
+        ..0xe0 => 2,
+        ..0xf0 => 3,
+        _ => 4,
+    }
+}
+
 fn find_span(buffer: &[u8], start: &Needle, end: &Needle) -> Option<(usize, Option<usize>)> {
     let start = start.find(buffer)? + start.len();
     let end = end.find(&buffer[start..]).map(|pos| pos + start);
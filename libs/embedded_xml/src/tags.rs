@@ -0,0 +1,88 @@
+const SLOTS: usize = 64;
+const SHIFT: u32 = u32::BITS - SLOTS.trailing_zeros();
+
+/// A compile-time set of element names with a perfect hash, so dispatching
+/// on a tag is one hash over the name and one comparison instead of a chain
+/// of string matches. The id of a name is its index in the array passed to
+/// [`TagTable::new`].
+/// ```
+/// # use embedded_xml::TagTable;
+/// const TAGS: TagTable<3> = TagTable::new(["p", "em", "dc:title"]);
+/// assert_eq!(TAGS.get("em"), Some(1));
+/// assert_eq!(TAGS.get("dc:title"), Some(2));
+/// assert_eq!(TAGS.get("span"), None);
+/// ```
+#[derive(Debug)]
+pub struct TagTable<const N: usize> {
+    names: [&'static str; N],
+    seed: u32,
+    /// Index + 1 of the name hashed to each slot, 0 if empty.
+    slots: [u8; SLOTS],
+}
+
+impl<const N: usize> TagTable<N> {
+    /// Searches for a seed that maps every name to its own slot. Meant to
+    /// run in a `const` so a failing set is a compile error.
+    pub const fn new(names: [&'static str; N]) -> Self {
+        assert!(N <= SLOTS / 2, "Too many tags for the table");
+        let mut seed = 0;
+        while seed < 4096 {
+            let mut slots = [0u8; SLOTS];
+            let mut i = 0;
+            while i < N {
+                let slot = Self::slot(names[i].as_bytes(), seed);
+                if slots[slot] != 0 {
+                    break;
+                }
+                slots[slot] = i as u8 + 1;
+                i += 1;
+            }
+            if i == N {
+                return Self { names, seed, slots };
+            }
+            seed += 1;
+        }
+        panic!("No perfect hash found for the tags");
+    }
+
+    /// Returns the id of `name` if it is part of the table.
+    pub fn get(&self, name: &str) -> Option<u8> {
+        let index = self.slots[Self::slot(name.as_bytes(), self.seed)].checked_sub(1)?;
+        (self.names[index as usize] == name).then_some(index)
+    }
+
+    /// FNV-1a followed by a seeded finalizer, since names like `h1`..`h6`
+    /// only differ in the low bits of the plain hash.
+    const fn slot(name: &[u8], seed: u32) -> usize {
+        let mut hash: u32 = 0x811c9dc5;
+        let mut i = 0;
+        while i < name.len() {
+            hash ^= name[i] as u32;
+            hash = hash.wrapping_mul(0x01000193);
+            i += 1;
+        }
+        hash ^= seed;
+        hash ^= hash >> 16;
+        hash = hash.wrapping_mul(0x7feb352d);
+        hash ^= hash >> 15;
+        (hash >> SHIFT) as usize
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::TagTable;
+
+    #[test]
+    fn perfect() {
+        const NAMES: [&str; 17] = [
+            "h1", "h2", "h3", "h4", "h5", "h6", "p", "li", "b", "i", "em", "br", "tr", "img", "image", "hr", "body",
+        ];
+        const TAGS: TagTable<17> = TagTable::new(NAMES);
+        for (id, name) in NAMES.iter().enumerate() {
+            assert_eq!(TAGS.get(name), Some(id as u8));
+        }
+        assert_eq!(TAGS.get("div"), None);
+        assert_eq!(TAGS.get(""), None);
+    }
+}
@@ -157,6 +157,43 @@ fn invalid_doc() {
     assert_matches!(parser.next_event(), Ok(Event::EndOfFile));
 }
 
+/// Hands out a single byte per read, like a buffered reader does when a
+/// refill straddles its chunk boundary.
+struct Trickle<'a>(&'a [u8]);
+
+impl embedded_io::ErrorType for Trickle<'_> {
+    type Error = core::convert::Infallible;
+}
+
+impl embedded_io::Read for Trickle<'_> {
+    fn read(&mut self, buf: &mut [u8]) -> core::result::Result<usize, Self::Error> {
+        let Some((&byte, rest)) = self.0.split_first() else {
+            return Ok(0);
+        };
+        if buf.is_empty() {
+            return Ok(0);
+        }
+        buf[0] = byte;
+        self.0 = rest;
+        Ok(1)
+    }
+}
+
+#[test]
+fn short_reads() {
+    let xml = "<?xml?><root><child>Some longer text</child></root>";
+    let mut reader = Trickle(xml.as_bytes());
+    let mut buffer = [0u8; 20];
+    let mut parser = Reader::new_borrowed(&mut reader, xml.len(), &mut buffer).unwrap();
+    assert_matches!(parser.next_event(), Ok(Event::ProcessingInstruction { name: "xml", .. }));
+    assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "root", .. }));
+    assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "child", .. }));
+    assert_matches!(parser.next_event(), Ok(Event::Text { content: "Some longer text" }));
+    assert_matches!(parser.next_event(), Ok(Event::EndElement { name: "child" }));
+    assert_matches!(parser.next_event(), Ok(Event::EndElement { name: "root" }));
+    assert_matches!(parser.next_event(), Ok(Event::EndOfFile));
+}
+
 #[test]
 fn non_owning() {
     let xml = "<?xml?><root>Text</root>";
@@ -169,3 +206,72 @@ fn non_owning() {
     assert_matches!(parser.next_event(), Ok(Event::EndElement { name: "root" }));
     assert_matches!(parser.next_event(), Ok(Event::EndOfFile));
 }
+
+#[test]
+fn skip_element() {
+    let xml = "<?xml?><root><skip a=\"1\"><!-- <not/> --><![CDATA[</skip>]]><inner>Text<br/></inner><empty/></skip><after/>Tail</root>";
+    // The small buffer makes skipping refill in the middle of markup.
+    for size in [16, 512] {
+        let mut bytes = xml.as_bytes();
+        let mut buffer = std::vec![0u8; size];
+        let mut parser = Reader::new_borrowed(&mut bytes, xml.len(), &mut buffer[..]).unwrap();
+        assert_matches!(parser.next_event(), Ok(Event::ProcessingInstruction { name: "xml", .. }));
+        assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "root", .. }));
+        assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "skip", .. }));
+        parser.skip_element().unwrap();
+        assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "after", .. }));
+        parser.skip_element().unwrap();
+        assert_matches!(parser.next_event(), Ok(Event::Text { content: "Tail" }));
+        assert_matches!(parser.next_event(), Ok(Event::EndElement { name: "root" }));
+        assert_matches!(parser.next_event(), Ok(Event::EndOfFile));
+    }
+
+    // Running out of input while skipping just ends the document.
+    let xml = "<root><skip>unclosed";
+    let mut bytes = xml.as_bytes();
+    let mut buffer = [0u8; 512];
+    let mut parser = Reader::new_borrowed(&mut bytes, xml.len(), &mut buffer).unwrap();
+    assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "root", .. }));
+    assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "skip", .. }));
+    parser.skip_element().unwrap();
+    assert_matches!(parser.next_event(), Ok(Event::EndOfFile));
+}
+
+#[test]
+fn validate_on_read() {
+    let xml = "<?xml?><root><a>Grüße</a><a>–“”</a><b>😀😀</b><skip>ü😀–<x/>é</skip><a>ß😀</a></root>";
+    // Every buffer size splits the multi-byte characters somewhere else.
+    for size in 12..40 {
+        let mut bytes = xml.as_bytes();
+        let mut buffer = std::vec![0u8; size];
+        let mut parser = Reader::new_borrowed(&mut bytes, xml.len(), &mut buffer[..]).unwrap();
+        parser.validate_on_read().unwrap();
+        let mut texts = Vec::new();
+        loop {
+            match parser.next_event().unwrap() {
+                Event::StartElement { name: "skip", .. } => parser.skip_element().unwrap(),
+                Event::Text { content } => texts.push(String::from(content)),
+                Event::EndOfFile => break,
+                _ => {}
+            }
+        }
+        assert_eq!(texts, ["Grüße", "–“”", "😀😀", "ß😀"], "buffer size {size}");
+    }
+
+    // Invalid or truncated characters fail the read that brings them in.
+    for xml in [&b"<a>text</a><a>\xc3(</a>"[..], b"<a>text</a><a>\xe2\x80"] {
+        let mut bytes = xml;
+        let mut buffer = [0u8; 512];
+        let mut parser = Reader::new_borrowed(&mut bytes, xml.len(), &mut buffer).unwrap();
+        assert_matches!(parser.validate_on_read(), Err(Error::Utf8Error(_)));
+
+        let mut bytes = xml;
+        let mut buffer = [0u8; 12];
+        let mut parser = Reader::new_borrowed(&mut bytes, xml.len(), &mut buffer).unwrap();
+        parser.validate_on_read().unwrap();
+        assert_matches!(parser.next_event(), Ok(Event::StartElement { name: "a", .. }));
+        assert_matches!(parser.next_event(), Ok(Event::Text { content: "text" }));
+        assert_matches!(parser.next_event(), Ok(Event::EndElement { name: "a" }));
+        assert_matches!(parser.next_event(), Err(Error::Utf8Error(_)));
+    }
+}
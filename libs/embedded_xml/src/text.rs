@@ -0,0 +1,151 @@
+use alloc::string::String;
+
+/// What [`decode_text`] does with whitespace.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Whitespace {
+    /// Copy it as is.
+    Preserve,
+    /// Drop it at the start and end and turn every run in between into a
+    /// single space, like joining `split_whitespace` with spaces.
+    Collapse,
+}
+
+/// Appends `text` to `out` with character references decoded, in one pass
+/// and without intermediate copies.
+///
+/// Numeric references and the five entities predefined by XML are decoded
+/// here. Other names are passed to `named` without the `&` and `;`, and kept
+/// verbatim if it returns None.
+/// ```
+/// # use embedded_xml::{decode_text, Whitespace};
+/// let mut out = String::from("Say:");
+/// decode_text("  Tom &amp;\n  Jerry&#x21; ", Whitespace::Collapse, &mut out, |_| None);
+/// assert_eq!(out, "Say:Tom & Jerry!");
+/// ```
+pub fn decode_text(text: &str, whitespace: Whitespace, out: &mut String, mut named: impl FnMut(&str) -> Option<char>) {
+    let mut sink = Sink { out, collapse: whitespace == Whitespace::Collapse, written: false, space: false };
+    let bytes = text.as_bytes();
+    // Start of the bytes that can be copied verbatim.
+    let mut span = 0;
+    let mut i = 0;
+    while i < bytes.len() {
+        let (c, len) = match bytes[i] {
+            b'&' => match reference(&text[i..], &mut named) {
+                Some(decoded) => decoded,
+                None => {
+                    i += 1;
+                    continue;
+                }
+            },
+            b'\t'..=b'\r' | b' ' if sink.collapse => (' ', 1),
+            // Only lead bytes of multi-byte characters can start Unicode
+            // whitespace, e.g. a no-break space.
+            0xc0.. if sink.collapse => {
+                let c = text[i..].chars().next().unwrap_or_default();
+                if !c.is_whitespace() {
+                    i += c.len_utf8();
+                    continue;
+                }
+                (c, c.len_utf8())
+            }
+            _ => {
+                i += 1;
+                continue;
+            }
+        };
+        sink.push_str(&text[span..i]);
+        sink.push(c);
+        i += len;
+        span = i;
+    }
+    sink.push_str(&text[span..]);
+}
+
+/// Decodes the reference at the start of `text`, returning the character and
+/// the length of the reference.
+fn reference(text: &str, named: &mut impl FnMut(&str) -> Option<char>) -> Option<(char, usize)> {
+    // The longest HTML entity name has 31 characters.
+    let end = text.bytes().take(34).position(|b| b == b';')?;
+    let name = &text[1..end];
+    let c = if let Some(number) = name.strip_prefix('#') {
+        let (digits, radix) = match number.strip_prefix(['x', 'X']) {
+            Some(hex) => (hex, 16),
+            None => (number, 10),
+        };
+        u32::from_str_radix(digits, radix).ok().and_then(char::from_u32)?
+    } else {
+        match name {
+            "amp" => '&',
+            "lt" => '<',
+            "gt" => '>',
+            "quot" => '"',
+            "apos" => '\'',
+            _ => named(name)?,
+        }
+    };
+    Some((c, end + 1))
+}
+
+struct Sink<'a> {
+    out: &'a mut String,
+    collapse: bool,
+    /// Whether anything was appended yet, so leading whitespace is dropped.
+    written: bool,
+    /// Whether a space is owed before the next character.
+    space: bool,
+}
+
+impl Sink<'_> {
+    fn push_str(&mut self, text: &str) {
+        if text.is_empty() {
+            return;
+        }
+        if self.space {
+            self.out.push(' ');
+            self.space = false;
+        }
+        self.out.push_str(text);
+        self.written = true;
+    }
+
+    fn push(&mut self, c: char) {
+        if self.collapse && c.is_whitespace() {
+            self.space = self.written;
+            return;
+        }
+        if self.space {
+            self.out.push(' ');
+            self.space = false;
+        }
+        self.out.push(c);
+        self.written = true;
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{decode_text, Whitespace};
+    use alloc::string::String;
+
+    fn decode(text: &str, whitespace: Whitespace) -> String {
+        let mut out = String::new();
+        decode_text(text, whitespace, &mut out, |name| (name == "mdash").then_some('—'));
+        out
+    }
+
+    #[test]
+    fn references() {
+        let text = "&lt;a&gt; &amp;&quot;&apos; &#65;&#x42;&#X43; &mdash; &unknown; & &#xffffffff; &;";
+        assert_eq!(decode(text, Whitespace::Preserve), "<a> &\"' ABC — &unknown; & &#xffffffff; &;");
+    }
+
+    #[test]
+    fn collapse() {
+        assert_eq!(decode("  one\t two\r\n\n three  ", Whitespace::Collapse), "one two three");
+        // Decoded and non-ASCII whitespace collapses as well
+        assert_eq!(decode("&#32;a&#32;&#32;b\u{a0}\u{2003}c\u{a0}", Whitespace::Collapse), "a b c");
+        assert_eq!(decode("\u{e9}t\u{e9} ", Whitespace::Collapse), "\u{e9}t\u{e9}");
+        assert_eq!(decode(" \n ", Whitespace::Collapse), "");
+        assert_eq!(decode(" a  b ", Whitespace::Preserve), " a  b ");
+    }
+}
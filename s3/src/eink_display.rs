@@ -495,6 +495,10 @@ where
             // Force half refresh if screen is off
             mode = RefreshMode::Half;
         }
+        if mode == RefreshMode::Fast && !buffers.has_previous() {
+            // The previous frame was overwritten as scratch memory
+            mode = RefreshMode::Half;
+        }
 
         // If currently in grayscale mode, revert first to black/white
         if self.in_grayscale_mode {
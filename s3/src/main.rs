@@ -35,7 +35,7 @@ use esp_hal::system::Cpu;
 use esp_hal::timer::timg::TimerGroup;
 use esp_hal::usb_serial_jtag::{UsbSerialJtag, UsbSerialJtagRx};
 use log::info;
-use trusty_core::application::Application;
+use trusty_core::application::{Application, Snapshot};
 use trusty_core::display::{Display, RefreshMode};
 use trusty_core::framebuffer::DisplayBuffers;
 use trusty_core::{battery, input};
@@ -54,6 +54,14 @@ pub extern "Rust" fn _esp_println_timestamp() -> u64 {
         .as_millis()
 }
 
+/// Where the application was before deep sleep. RTC fast memory keeps
+/// its contents through deep sleep but not through a power cycle.
+#[esp_hal::ram(unstable(rtc_fast, persistent))]
+static mut SNAPSHOT: [u8; 1024] = [0; 1024];
+
+/// Free heap below which activities are asked to drop what they cache.
+const LOW_HEAP: usize = 32 * 1024;
+
 fn log_heap() {
     let stats = esp_alloc::HEAP.stats();
     info!("{stats}");
@@ -124,6 +132,10 @@ async fn main(spawner: Spawner) {
     info!("reset reason: {:?}", reason);
     let wake_reason = wakeup_cause();
     info!("wake reason: {:?}", wake_reason);
+    let snapshot = match reason {
+        SocResetReason::CoreDeepSleep => Snapshot::decode(unsafe { &*core::ptr::addr_of!(SNAPSHOT) }),
+        _ => None,
+    };
 
     esp_alloc::heap_allocator!(#[esp_hal::ram(reclaimed)] size: 0x10000);
     esp_alloc::heap_allocator!(size: 270000);
@@ -181,8 +193,11 @@ async fn main(spawner: Spawner) {
     // Initialize the display
     display.begin().expect("Failed to initialize display");
 
-    info!("Clearing screen");
-    display.display(&mut display_buffers, RefreshMode::Full);
+    // Resuming draws its page over the sleep image right away
+    if snapshot.is_none() {
+        info!("Clearing screen");
+        display.display(&mut display_buffers, RefreshMode::Full);
+    }
 
     let sdcard = {
         // Initialize shared SPI bus
@@ -204,7 +219,13 @@ async fn main(spawner: Spawner) {
     };
 
     info!("Display complete! Starting Application...");
-    let mut application = Application::new(&mut display_buffers, sdcard);
+    let mut application = match snapshot {
+        Some(snapshot) => {
+            info!("Resuming from deep sleep");
+            Application::resume(&mut display_buffers, sdcard, snapshot)
+        }
+        None => Application::new(&mut display_buffers, sdcard),
+    };
 
     let up = Input::new(peripherals.GPIO4, InputConfig::default());
     let confirm = Input::new(peripherals.GPIO5, InputConfig::default());
@@ -217,8 +238,11 @@ async fn main(spawner: Spawner) {
     let mut confirm_long_fired = false;
 
     let mut button_state = input::ButtonState::default();
+    let mut busy = false;
     while application.running() {
-        embassy_time::Timer::after(embassy_time::Duration::from_millis(10)).await;
+        // Poll input sooner while there is background work to get back to
+        let idle = if busy { 1 } else { 10 };
+        embassy_time::Timer::after(embassy_time::Duration::from_millis(idle)).await;
 
         let charge = battery::ChargeState::default();
 
@@ -258,6 +282,12 @@ async fn main(spawner: Spawner) {
         button_state.update(buttons);
 
         application.update(&button_state, charge);
+        busy = application.work();
+        // The heap only shrinks when input changed something or work ran,
+        // which leaves work pending or the screen to redraw
+        if (busy || application.dirty()) && esp_alloc::HEAP.free() < LOW_HEAP {
+            application.reclaim();
+        }
         application.draw(&mut display);
     }
 
@@ -267,6 +297,9 @@ async fn main(spawner: Spawner) {
     }
 
     info!("Application exiting, entering sleep mode.");
+    if !application.suspend().encode(unsafe { &mut *core::ptr::addr_of_mut!(SNAPSHOT) }) {
+        info!("Snapshot doesn't fit, waking up on the home screen");
+    }
 
     let mut power_pin = peripherals.GPIO0;
     let wakeup_pins: &mut [(&mut dyn RtcPin, WakeupLevel)] =
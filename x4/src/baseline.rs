@@ -9,7 +9,9 @@
 
 pub mod adc_input;
 pub mod eink_display;
+pub mod heap;
 pub mod sdspi_fatfs;
+pub mod trace;
 
 use core::cell::RefCell;
 
@@ -47,6 +49,9 @@ pub extern "Rust" fn _esp_println_timestamp() -> u64 {
         .as_millis()
 }
 
+#[global_allocator]
+static ALLOCATOR: heap::EspHeap = heap::EspHeap;
+
 fn log_heap() {
     let stats = esp_alloc::HEAP.stats();
     info!("{stats}");
@@ -58,6 +63,7 @@ async fn main(_spawner: Spawner) {
 
     let config = esp_hal::Config::default().with_cpu_clock(CpuClock::max());
     let peripherals = esp_hal::init(config);
+    trace::init();
 
     info!("up and runnning!");
     let reason = reset_reason(Cpu::ProCpu).unwrap_or(SocResetReason::ChipPowerOn);
@@ -201,7 +207,7 @@ pub fn parse_all_books<FS: fs::Filesystem>(filesystem: &mut FS) -> Result<(), Er
             // Landscape
             let start = Instant::now();
             let mut reader = zip::ZipEntryReader::new(&mut file, entry).map_err(|_| ErrorKind::Other)?;
-            match image::decode(format, &mut reader, entry.size, 800, 480) {
+            match image::decode(format, &mut reader, entry.size, 800, 480, &mut []) {
                 Ok(img) => {
                     let duration = Instant::now() - start;
                     log::warn!(
@@ -218,11 +224,12 @@ pub fn parse_all_books<FS: fs::Filesystem>(filesystem: &mut FS) -> Result<(), Er
                     log::error!("Failed to decode image '{}': {}", entry.name, e);
                 }
             }
+            drop(reader);
 
             // Portrait
             let start = Instant::now();
             let mut reader = zip::ZipEntryReader::new(&mut file, entry).map_err(|_| ErrorKind::Other)?;
-            match image::decode(format, &mut reader, entry.size, 480, 800) {
+            match image::decode(format, &mut reader, entry.size, 480, 800, &mut []) {
                 Ok(img) => {
                     let duration = Instant::now() - start;
                     log::warn!(
@@ -9,7 +9,9 @@
 
 pub mod adc_input;
 pub mod eink_display;
+pub mod heap;
 pub mod sdspi_fatfs;
+pub mod trace;
 
 use core::cell::RefCell;
 
@@ -50,12 +52,32 @@ fn log_heap() {
     info!("{stats}");
 }
 
+#[cfg(not(feature = "heap-tags"))]
+#[global_allocator]
+static ALLOCATOR: heap::EspHeap = heap::EspHeap;
+
+#[cfg(feature = "heap-tags")]
+#[global_allocator]
+static ALLOCATOR: trusty_core::heap::TaggingAllocator<heap::EspHeap> = trusty_core::heap::TaggingAllocator::new(heap::EspHeap);
+
+/// Log peak and leftover bytes and the allocation count of each scope
+/// since the last call.
+fn log_heap_tags(name: &str) {
+    for (tag, stats) in trusty_core::heap::stats() {
+        if stats.count > 0 {
+            log::warn!("Book '{}' {}: peak {} bytes, live {} bytes, {} allocations", name, tag.name(), stats.peak, stats.live, stats.count);
+        }
+    }
+    trusty_core::heap::reset();
+}
+
 #[esp_rtos::main]
 async fn main(_spawner: Spawner) {
     esp_println::logger::init_logger_from_env();
 
     let config = esp_hal::Config::default().with_cpu_clock(CpuClock::max());
     let peripherals = esp_hal::init(config);
+    trace::init();
 
     info!("up and runnning!");
     let reason = reset_reason(Cpu::ProCpu).unwrap_or(SocResetReason::ChipPowerOn);
@@ -112,7 +134,8 @@ pub fn parse_all_books<FS: fs::Filesystem>(filesystem: &mut FS) -> Result<(), Er
         if entry.is_directory() {
             continue;
         }
-        if !entry.name().ends_with("ohler.epub") {
+        // Copy the corpus written by `epubgen` to the card
+        if !entry.name().ends_with(".epub") {
             continue;
         }
         let start = Instant::now();
@@ -137,6 +160,7 @@ pub fn parse_all_books<FS: fs::Filesystem>(filesystem: &mut FS) -> Result<(), Er
         timings.push((entry.name().to_string(), duration));
 
         log_heap();
+        log_heap_tags(entry.name());
 
         let entries = book.file_resolver.entries();
         for idx in 0..entries.len() {
@@ -13,6 +13,7 @@ use log::{error, info, warn};
 use trusty_core::{
     display::{Display, GrayscaleMode, RefreshMode},
     framebuffer::{BUFFER_SIZE, DisplayBuffers},
+    trace,
 };
 
 // SSD1677 Command Definitions
@@ -294,6 +295,7 @@ where
     }
 
     fn wait_while_busy(&mut self, comment: &str) {
+        let _span = trace::span(trace::Span::WaitBusy);
         let mut iterations = 0u32;
         while self.busy.is_high() {
             self.delay.delay_millis(1);
@@ -395,6 +397,7 @@ where
     }
 
     fn write_ram_buffer(&mut self, ram_buffer: u8, data: &[u8]) -> Result<(), SPI::Error> {
+        let _span = trace::span(trace::Span::WriteRam);
         let buffer_name = if ram_buffer == commands::WRITE_RAM_BW {
             "BW"
         } else {
@@ -494,6 +497,10 @@ where
             // Force half refresh if screen is off
             mode = RefreshMode::Half;
         }
+        if mode == RefreshMode::Fast && !buffers.has_previous() {
+            // The previous frame was overwritten as scratch memory
+            mode = RefreshMode::Half;
+        }
 
         // If currently in grayscale mode, revert first to black/white
         if self.in_grayscale_mode {
@@ -0,0 +1,27 @@
+//! esp-alloc's heap as a plain allocator.
+//!
+//! esp-alloc is built without its own global allocator, so each binary
+//! picks one: the heap itself, or core's layers around it.
+
+use core::alloc::{GlobalAlloc, Layout};
+
+/// Forwards to esp-alloc's heap so it can be wrapped.
+pub struct EspHeap;
+
+unsafe impl GlobalAlloc for EspHeap {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        unsafe { GlobalAlloc::alloc(&esp_alloc::HEAP, layout) }
+    }
+
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        unsafe { GlobalAlloc::alloc_zeroed(&esp_alloc::HEAP, layout) }
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        unsafe { GlobalAlloc::dealloc(&esp_alloc::HEAP, ptr, layout) }
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        unsafe { GlobalAlloc::realloc(&esp_alloc::HEAP, ptr, layout, new_size) }
+    }
+}
@@ -9,7 +9,9 @@
 
 pub mod adc_input;
 pub mod eink_display;
+pub mod heap;
 pub mod sdspi_fatfs;
+pub mod trace;
 
 use core::cell::RefCell;
 
@@ -34,7 +36,7 @@ use esp_hal::system::Cpu;
 use esp_hal::timer::timg::TimerGroup;
 use esp_hal::usb_serial_jtag::{UsbSerialJtag, UsbSerialJtagRx};
 use log::info;
-use trusty_core::application::Application;
+use trusty_core::application::{Application, Snapshot};
 use trusty_core::display::{Display, RefreshMode};
 use trusty_core::framebuffer::DisplayBuffers;
 
@@ -52,6 +54,17 @@ pub extern "Rust" fn _esp_println_timestamp() -> u64 {
         .as_millis()
 }
 
+/// Where the application was before deep sleep. RTC fast memory keeps
+/// its contents through deep sleep but not through a power cycle.
+#[esp_hal::ram(unstable(rtc_fast, persistent))]
+static mut SNAPSHOT: [u8; 1024] = [0; 1024];
+
+/// Free heap below which activities are asked to drop what they cache.
+const LOW_HEAP: usize = 32 * 1024;
+
+#[global_allocator]
+static ALLOCATOR: heap::EspHeap = heap::EspHeap;
+
 fn log_heap() {
     let stats = esp_alloc::HEAP.stats();
     info!("{stats}");
@@ -62,22 +75,39 @@ fn handle_cmd(input_bytes: &[u8]) {
         return;
     };
     info!("Handling command: {input}");
-    let parts = input.split_whitespace();
-    let command = parts.into_iter().next().unwrap_or("");
+    let mut parts = input.split_whitespace();
+    let command = parts.next().unwrap_or("");
     if command.eq_ignore_ascii_case("ls") {
         /* ... */
     } else if command.eq_ignore_ascii_case("heap") {
         log_heap();
+    } else if command.eq_ignore_ascii_case("trace") {
+        handle_trace(parts.next());
     } else if command.eq_ignore_ascii_case("help") {
         info!("Available commands:");
-        info!("  ls   - List files (not implemented)");
-        info!("  heap - Show heap usage statistics");
-        info!("  help - Show this help message");
+        info!("  ls    - List files (not implemented)");
+        info!("  heap  - Show heap usage statistics");
+        info!("  trace - Dump recorded spans, 'trace clear' to reset");
+        info!("  help  - Show this help message");
     } else {
         info!("Unknown command: {}", command);
     }
 }
 
+#[cfg(feature = "trace")]
+fn handle_trace(argument: Option<&str>) {
+    if argument.is_some_and(|arg| arg.eq_ignore_ascii_case("clear")) {
+        trusty_core::trace::clear();
+    } else {
+        trace::dump();
+    }
+}
+
+#[cfg(not(feature = "trace"))]
+fn handle_trace(_: Option<&str>) {
+    info!("Tracing is disabled, rebuild with --features trace");
+}
+
 #[embassy_executor::task]
 async fn reader(mut rx: UsbSerialJtagRx<'static, Async>) {
     let mut rbuf = [0u8; MAX_BUFFER_SIZE];
@@ -114,6 +144,7 @@ async fn main(spawner: Spawner) {
 
     let config = esp_hal::Config::default().with_cpu_clock(CpuClock::max());
     let peripherals = esp_hal::init(config);
+    trace::init();
 
     let mut rtc = Rtc::new(peripherals.LPWR);
 
@@ -122,6 +153,10 @@ async fn main(spawner: Spawner) {
     info!("reset reason: {:?}", reason);
     let wake_reason = wakeup_cause();
     info!("wake reason: {:?}", wake_reason);
+    let snapshot = match reason {
+        SocResetReason::CoreDeepSleep => Snapshot::decode(unsafe { &*core::ptr::addr_of!(SNAPSHOT) }),
+        _ => None,
+    };
 
     esp_alloc::heap_allocator!(#[esp_hal::ram(reclaimed)] size: 0x10000);
     esp_alloc::heap_allocator!(size: 270000);
@@ -170,6 +205,10 @@ async fn main(spawner: Spawner) {
     let mut display_buffers = Box::new(DisplayBuffers::with_rotation(
         trusty_core::framebuffer::Rotation::Rotate90,
     ));
+    // Parser and decoder scratch buffers live next to the framebuffers
+    // instead of between chapter data
+    trusty_core::pool::reserve(8096);
+    trusty_core::pool::reserve(32768);
 
     // Create E-Ink Display instance
     info!("Creating E-Ink Display driver");
@@ -178,8 +217,11 @@ async fn main(spawner: Spawner) {
     // Initialize the display
     display.begin().expect("Failed to initialize display");
 
-    info!("Clearing screen");
-    display.display(&mut display_buffers, RefreshMode::Full);
+    // Resuming draws its page over the sleep image right away
+    if snapshot.is_none() {
+        info!("Clearing screen");
+        display.display(&mut display_buffers, RefreshMode::Full);
+    }
 
     let mut button_state = GpioButtonState::new(
         peripherals.GPIO0,
@@ -197,15 +239,30 @@ async fn main(spawner: Spawner) {
     let sdcard = FatFs::new(sdcard_spi, delay);
 
     info!("Display complete! Starting Application...");
-    let mut application = Application::new(&mut display_buffers, sdcard);
+    let mut application = match snapshot {
+        Some(snapshot) => {
+            info!("Resuming from deep sleep");
+            Application::resume(&mut display_buffers, sdcard, snapshot)
+        }
+        None => Application::new(&mut display_buffers, sdcard),
+    };
 
+    let mut busy = false;
     while application.running() {
-        embassy_time::Timer::after(embassy_time::Duration::from_millis(10)).await;
+        // Poll input sooner while there is background work to get back to
+        let idle = if busy { 1 } else { 10 };
+        embassy_time::Timer::after(embassy_time::Duration::from_millis(idle)).await;
 
         button_state.update();
         let buttons = button_state.get_buttons();
         let charge = button_state.get_charge_state();
         application.update(&buttons, charge);
+        busy = application.work();
+        // The heap only shrinks when input changed something or work ran,
+        // which leaves work pending or the screen to redraw
+        if (busy || application.dirty()) && esp_alloc::HEAP.free() < LOW_HEAP {
+            application.reclaim();
+        }
         application.draw(&mut display);
     }
 
@@ -215,6 +272,9 @@ async fn main(spawner: Spawner) {
     }
 
     info!("Application exiting, entering sleep mode.");
+    if !application.suspend().encode(unsafe { &mut *core::ptr::addr_of_mut!(SNAPSHOT) }) {
+        info!("Snapshot doesn't fit, waking up on the home screen");
+    }
 
     let mut power_pin = peripherals.GPIO3;
     let wakeup_pins: &mut [(&mut dyn RtcPinWithResistors, WakeupLevel)] =
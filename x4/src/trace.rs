@@ -0,0 +1,55 @@
+//! Clock and heap hooks for the core span recorder, and the serial dump.
+//!
+//! Build with `--features trace` to record spans. Durations come from
+//! the ESP32-C3 performance counter, which counts CPU cycles, and span
+//! ends from esp-hal's microsecond clock.
+
+#[cfg(feature = "trace")]
+use log::info;
+
+/// The counter runs at `CpuClock::max()`.
+#[cfg(feature = "trace")]
+const CLOCK_HZ: u32 = 160_000_000;
+
+/// Start the cycle counter. Does nothing without the `trace` feature.
+pub fn init() {
+    #[cfg(feature = "trace")]
+    unsafe {
+        // Count cycles (mpcer) and enable counting (mpcmr)
+        core::arch::asm!("csrw 0x7e0, {0}", "csrw 0x7e1, {0}", in(reg) 1u32);
+    }
+}
+
+#[cfg(feature = "trace")]
+#[unsafe(no_mangle)]
+pub extern "Rust" fn _trusty_trace_clock() -> u32 {
+    let cycles: u32;
+    unsafe {
+        core::arch::asm!("csrr {0}, 0x7e2", out(reg) cycles);
+    }
+    cycles
+}
+
+#[cfg(feature = "trace")]
+#[unsafe(no_mangle)]
+pub extern "Rust" fn _trusty_trace_micros() -> u64 {
+    esp_hal::time::Instant::now().duration_since_epoch().as_micros()
+}
+
+/// Collecting the stats takes a lock and walks every region, core only
+/// asks once per update and draw.
+#[cfg(feature = "trace")]
+#[unsafe(no_mangle)]
+pub extern "Rust" fn _trusty_trace_heap() -> u32 {
+    esp_alloc::HEAP.stats().max_usage as u32
+}
+
+/// Log every recorded span in the format `trace2json` reads.
+#[cfg(feature = "trace")]
+pub fn dump() {
+    info!("trace: clock {CLOCK_HZ}");
+    for record in trusty_core::trace::records() {
+        info!("trace: {record}");
+    }
+    info!("trace: end");
+}